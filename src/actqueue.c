@@ -0,0 +1,50 @@
+// The coalescing queue of the activations that arrive while a translation is busy.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "actqueue.h"
+
+void ActivationQueueInit( ActivationQueue* q )
+{
+	memset(q, 0, sizeof(*q));
+}
+
+static void RemoveAt( ActivationQueue* q, unsigned i )
+{
+	memmove(&q->items[i], &q->items[i + 1], (q->count - i - 1) * sizeof(q->items[0]));
+	--q->count;
+}
+
+void ActivationQueuePush( ActivationQueue* q, const Activation* act )
+{
+	++q->nqueued;
+
+	// a newer switch supersedes the pending one, a newer translation of the
+	// same window supersedes the pending translation; the new one goes last
+	for( unsigned i = 0; i < q->count; ++i )
+	{
+		if( q->items[i].target == act->target )
+		{
+			RemoveAt(q, i);
+			++q->ncoalesced;
+			break;
+		}
+	}
+
+	if( q->count == ACTQ_SIZE )
+	{
+		RemoveAt(q, 0);
+		++q->ndropped;
+	}
+
+	q->items[q->count++] = *act;
+}
+
+bool ActivationQueuePop( ActivationQueue* q, Activation* act )
+{
+	if( q->count == 0 )  return false;
+	*act = q->items[0];
+	RemoveAt(q, 0);
+	return true;
+}
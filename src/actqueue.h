@@ -0,0 +1,55 @@
+#ifndef ACTQUEUE_H
+#define ACTQUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Activations (layout switches and selection translations) that arrive while
+// a translation is in progress are parked here until the translation finishes,
+// instead of being dropped.
+//
+// The queue is small and coalescing:
+//   - there is at most one pending layout switch: the latest one wins;
+//   - there is at most one pending translation per target window: the latest
+//     target layout wins;
+//   - otherwise activations are kept in arrival order; when the queue is full,
+//     the oldest one is dropped.
+//
+// It is a plain fixed-size array, never allocates and is owned by a single thread
+// (the main one). The hook thread doesn't touch it: activations reach the main
+// thread as posted messages, so the hook never waits for anything.
+
+enum { ACTQ_SIZE = 8 };
+
+typedef struct
+{
+	unsigned   binding;    // the index of the switch key (what it is bound to) ...
+	uint32_t   generation; // ... in this generation of the configuration
+	uintptr_t  target;     // the focus window to translate the selection in; 0 for a plain layout switch
+	bool       modifier;   // a modifier key was pressed along with the switch key
+	uint64_t   queued_us;  // when it was queued, to measure the delay
+} Activation;
+
+typedef struct
+{
+	Activation  items [ACTQ_SIZE];   // oldest first
+	unsigned    count;
+
+	// for the statistics
+	unsigned    nqueued;
+	unsigned    ncoalesced;   // replaced by a later one
+	unsigned    ndropped;     // pushed out of a full queue
+} ActivationQueue;
+
+
+// ---- provided by actqueue.c -------------------------------------------------
+
+void ActivationQueueInit( ActivationQueue* q );
+
+// Queues the activation, replacing a pending one it supersedes (see above).
+void ActivationQueuePush( ActivationQueue* q, const Activation* act );
+
+// Takes the oldest activation out of the queue; returns false if it is empty.
+bool ActivationQueuePop( ActivationQueue* q, Activation* act );
+
+#endif
@@ -0,0 +1,93 @@
+// The bump allocator for transient buffers (see arena.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "arena.h"
+
+struct ArenaBlock
+{
+	ArenaBlock*  next;
+	size_t       size;    // of the data
+	size_t       used;
+	_Alignas(ARENA_ALIGN) unsigned char  data [];
+};
+
+void ArenaInit( Arena* a, size_t keep )
+{
+	*a = (Arena){ .keep = keep };
+}
+
+static size_t AlignUp( size_t n )
+{
+	return (n + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+void* ArenaAlloc( Arena* a, size_t size )
+{
+	size = AlignUp(size ? size : 1);
+	if( size == 0 )  return NULL;   // wrapped around
+
+	// the blocks after the current one are free since the last reset
+	ArenaBlock* b = a->current;
+	while( b && (b->size - b->used < size) )  b = b->next;
+	if( b == NULL )
+	{
+		// at least double the memory held, so that a growing load takes few blocks
+		size_t want = (a->held > size) ? a->held : size;
+		if( want < ARENA_MIN_BLOCK - sizeof(ArenaBlock) )  want = ARENA_MIN_BLOCK - sizeof(ArenaBlock);
+		if( want > SIZE_MAX - sizeof(ArenaBlock) )  return NULL;
+		b = malloc(sizeof(ArenaBlock) + want);
+		if( b == NULL )  return NULL;
+		b->size = want;
+		b->used = 0;
+
+		// linked after the current one (before any unused blocks too small for this)
+		ArenaBlock** link = a->current ? &a->current->next : &a->first;
+		b->next = *link;
+		*link = b;
+		a->held += want;
+	}
+
+	a->current = b;
+	void* p = b->data + b->used;
+	b->used += size;
+	a->used += size;
+	if( a->used > a->peak )  a->peak = a->used;
+	return p;
+}
+
+void ArenaReset( Arena* a )
+{
+	for( ArenaBlock* b = a->first; b; b = b->next )  b->used = 0;
+	a->current = a->first;
+	a->used = 0;
+}
+
+void ArenaTrim( Arena* a )
+{
+	ArenaReset(a);
+	ArenaBlock** link = &a->first;
+	size_t kept = 0;
+	while( *link && (kept + (*link)->size <= a->keep) )
+	{
+		kept += (*link)->size;
+		link = &(*link)->next;
+	}
+	for( ArenaBlock* b = *link, *next; b; b = next )
+	{
+		next = b->next;
+		a->held -= b->size;
+		free(b);
+	}
+	*link = NULL;
+	a->current = a->first;
+}
+
+void ArenaFree( Arena* a )
+{
+	size_t keep = a->keep;
+	a->keep = 0;
+	ArenaTrim(a);
+	a->keep = keep;
+}
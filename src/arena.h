@@ -0,0 +1,49 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// A bump allocator for the buffers that only live as long as one translation: they
+// are all given back at once with ArenaReset, which keeps the memory for the next one.
+// It grows by blocks, as big as needed; ArenaTrim frees the blocks beyond a small cap,
+// so that a giant selection doesn't leave the resident process holding its buffers
+// all day. Owned by a single thread.
+
+enum
+{
+	ARENA_ALIGN      = 16,
+	ARENA_MIN_BLOCK  = 64 * 1024,   // bytes, with the header
+};
+
+typedef struct ArenaBlock ArenaBlock;
+
+typedef struct
+{
+	ArenaBlock*  first;
+	ArenaBlock*  current;    // where the allocations go
+	size_t       used;       // bytes handed out since the last reset
+	size_t       held;       // bytes of all the blocks
+	size_t       peak;       // the most ever `used` at once
+	size_t       keep;       // bytes of blocks that ArenaTrim keeps
+} Arena;
+
+
+// ---- provided by arena.c ----------------------------------------------------
+
+void ArenaInit( Arena* a, size_t keep );
+
+// `size` bytes aligned to ARENA_ALIGN; NULL if out of memory.
+void* ArenaAlloc( Arena* a, size_t size );
+
+// Gives back everything allocated; keeps the blocks.
+void ArenaReset( Arena* a );
+
+// Resets, and frees the blocks after the first ones that add up to no more than `keep`.
+void ArenaTrim( Arena* a );
+
+// Frees all the blocks (`peak` stays).
+void ArenaFree( Arena* a );
+
+#endif
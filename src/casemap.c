@@ -0,0 +1,268 @@
+// The case mappings and the case translators (see casemap.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "casemap.h"
+#include "common.h"
+#include "casetab.h"
+
+static const CaseRecord* RecordOf( uint32_t cp )
+{
+	if( cp >= CASE_LIMIT )  return &kCaseRecords[0];
+	return &kCaseRecords[kCaseBlocks[kCaseIndex[cp >> CASE_BLOCK_SHIFT]][cp & ((1 << CASE_BLOCK_SHIFT) - 1)]];
+}
+
+uint32_t CaseToUpper( uint32_t cp )
+{
+	return cp + RecordOf(cp)->upper;
+}
+
+uint32_t CaseToLower( uint32_t cp )
+{
+	return cp + RecordOf(cp)->lower;
+}
+
+uint32_t CaseToTitle( uint32_t cp )
+{
+	return cp + RecordOf(cp)->title;
+}
+
+// ---- the translators --------------------------------------------------------
+
+typedef enum
+{
+	cmUndecided,   // CYCLE, until it has seen enough letters: the text is held back
+	cmInvert,
+	cmUpper,
+	cmLower,
+	cmTitle,
+} CaseMode;
+
+typedef struct
+{
+	UTF16    high;          // a high surrogate waiting for its pair
+	uint8_t  mode;          // CaseMode
+	bool     in_word;       // after a letter (for cmTitle)
+	bool     first_upper;   // CYCLE: the first letter is upper (or title) case
+	uint8_t  nheld;
+	UTF16    held [48];     // CYCLE: the text so far
+} CaseState;
+
+static_assert(sizeof(CaseState) <= TR_STATE_SIZE, "CaseState doesn't fit in a stage");
+
+static size_t CaseMaxOutput( size_t n )
+{
+	return n;   // a codepoint for a codepoint, and in the same plane (see ucdgen)
+}
+
+static void CaseInvertInit( void* state, const void* _ )
+{
+	memset(state, 0, sizeof(CaseState));
+	((CaseState*)state)->mode = cmInvert;
+}
+
+static void CaseCycleInit( void* state, const void* _ )
+{
+	memset(state, 0, sizeof(CaseState));
+}
+
+static void EmitCodepoint( TrStage* stage, uint32_t u )
+{
+	if( u < 0x10000 )
+	{
+		TrEmit(stage, (UTF16)u);
+		return;
+	}
+	u -= 0x10000;
+	TrEmit(stage, (UTF16)(0xD800 + (u >> 10)));
+	TrEmit(stage, (UTF16)(0xDC00 + (u & 0x3FF)));
+}
+
+static uint32_t Convert( CaseState* st, uint32_t cp )
+{
+	const CaseRecord* r = RecordOf(cp);
+	bool word_start = !st->in_word;
+	bool cased = (r->upper | r->lower | r->title) != 0;
+	st->in_word = cased || (st->in_word && ((cp == '\'') || (cp == 0x2019) || ((cp >= '0') && (cp <= '9'))));
+
+	switch( (CaseMode)st->mode )
+	{
+		case cmInvert:  return cp + (r->lower ? r->lower : r->upper);
+		case cmUpper:   return cp + r->upper;
+		case cmLower:   return cp + r->lower;
+		case cmTitle:   return cp + (word_start ? r->title : r->lower);
+		default:        return cp;
+	}
+}
+
+// passes on the text held back by CYCLE, in the mode it has decided on
+static void ReleaseHeld( TrStage* stage, CaseState* st )
+{
+	for( unsigned i = 0; i < st->nheld; ++i )
+	{
+		uint32_t cp = st->held[i];
+		if( ((cp & 0xFC00) == 0xD800) && (i + 1 < st->nheld) && ((st->held[i + 1] & 0xFC00) == 0xDC00) )
+			cp = ((cp - 0xD800) << 10) + (st->held[++i] - 0xDC00) + 0x10000;
+		EmitCodepoint(stage, Convert(st, cp));
+	}
+	st->nheld = 0;
+}
+
+// CYCLE: lower -> UPPER -> Title -> lower, by the first two letters
+static void HoldUndecided( TrStage* stage, CaseState* st, uint32_t cp )
+{
+	const CaseRecord* r = RecordOf(cp);
+	bool upper = (r->lower != 0), lower = !upper && (r->upper != 0);
+	bool first = (upper || lower) && !st->first_upper;
+
+	if( first && lower )  st->mode = cmUpper;
+	else if( first )  st->first_upper = true;
+	else if( upper )  st->mode = cmTitle;
+	else if( lower )  st->mode = cmLower;
+
+	if( cp >= 0x10000 )
+	{
+		st->held[st->nheld++] = 0xD800 + ((cp - 0x10000) >> 10);
+		st->held[st->nheld++] = 0xDC00 + ((cp - 0x10000) & 0x3FF);
+	}
+	else st->held[st->nheld++] = cp;
+
+	// it's too long to wait for the second letter
+	if( (st->mode == cmUndecided) && st->first_upper && (st->nheld + 2u > COUNTOF(st->held)) )
+		st->mode = cmLower;
+
+	// (what is held before any letters has no case, it can go on as is)
+	if( (st->mode != cmUndecided) || (st->nheld + 2u > COUNTOF(st->held)) )
+		ReleaseHeld(stage, st);
+}
+
+static void Put( TrStage* stage, CaseState* st, uint32_t cp )
+{
+	if( st->mode == cmUndecided )  HoldUndecided(stage, st, cp);
+	else EmitCodepoint(stage, Convert(st, cp));
+}
+
+static void CaseFeed( TrStage* stage, UTF16 u )
+{
+	CaseState* st = TR_STATE(stage, CaseState);
+
+	if( st->high )
+	{
+		UTF16 high = st->high;
+		st->high = 0;
+		if( (u & 0xFC00) == 0xDC00 )
+		{
+			Put(stage, st, ((uint32_t)(high - 0xD800) << 10) + (u - 0xDC00) + 0x10000);
+			return;
+		}
+		Put(stage, st, high);  // unpaired
+	}
+
+	if( u == 0 )
+	{
+		// CYCLE with a single capital letter: to lower case
+		if( st->mode == cmUndecided )  st->mode = st->first_upper ? cmLower : cmUndecided;
+		ReleaseHeld(stage, st);
+		return;
+	}
+	if( (u & 0xFC00) == 0xD800 )
+	{
+		st->high = u;
+		return;
+	}
+	Put(stage, st, u);
+}
+
+// Converts the ASCII units at the start of `p` (up to the first other one) into `out`;
+// returns how many.
+static size_t ConvertAscii( const UTF16* p, size_t n, UTF16* out, CaseMode mode )
+{
+	UTF16 flip_upper = (mode == cmUpper) ? 0 : 0x20;   // the upper case letters go to lower case
+	UTF16 flip_lower = (mode == cmLower) ? 0 : 0x20;   // and vice versa
+	size_t i = 0;
+#ifdef __SSE2__
+	const __m128i non_ascii = _mm_set1_epi16((short)0xFF80), zero = _mm_setzero_si128();
+	const __m128i a = _mm_set1_epi16('a' - 1), z = _mm_set1_epi16('z' + 1);
+	const __m128i A = _mm_set1_epi16('A' - 1), Z = _mm_set1_epi16('Z' + 1);
+	const __m128i fu = _mm_set1_epi16(flip_upper), fl = _mm_set1_epi16(flip_lower);
+	for( ; i + 16 <= n; i += 16 )
+	{
+		__m128i v0 = _mm_loadu_si128((const __m128i*)(p + i));
+		__m128i v1 = _mm_loadu_si128((const __m128i*)(p + i + 8));
+		__m128i high_bits = _mm_and_si128(_mm_or_si128(v0, v1), non_ascii);
+		if( _mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, zero)) != 0xFFFF )  break;
+
+		__m128i lower0 = _mm_and_si128(_mm_cmpgt_epi16(v0, a), _mm_cmplt_epi16(v0, z));
+		__m128i upper0 = _mm_and_si128(_mm_cmpgt_epi16(v0, A), _mm_cmplt_epi16(v0, Z));
+		__m128i lower1 = _mm_and_si128(_mm_cmpgt_epi16(v1, a), _mm_cmplt_epi16(v1, z));
+		__m128i upper1 = _mm_and_si128(_mm_cmpgt_epi16(v1, A), _mm_cmplt_epi16(v1, Z));
+		v0 = _mm_xor_si128(v0, _mm_or_si128(_mm_and_si128(lower0, fl), _mm_and_si128(upper0, fu)));
+		v1 = _mm_xor_si128(v1, _mm_or_si128(_mm_and_si128(lower1, fl), _mm_and_si128(upper1, fu)));
+		_mm_storeu_si128((__m128i*)(out + i), v0);
+		_mm_storeu_si128((__m128i*)(out + i + 8), v1);
+	}
+#endif
+	for( ; (i < n) && (p[i] < 0x80); ++i )
+	{
+		UTF16 u = p[i];
+		if(      (u >= 'a') && (u <= 'z') )  u ^= flip_lower;
+		else if( (u >= 'A') && (u <= 'Z') )  u ^= flip_upper;
+		out[i] = u;
+	}
+	return i;
+}
+
+static void CaseFeedRun( TrStage* stage, const UTF16* units, size_t n )
+{
+	CaseState* st = TR_STATE(stage, CaseState);
+	UTF16 buffer [256];
+
+	for( size_t i = 0; i < n; )
+	{
+		if( (st->high != 0) || (st->mode == cmUndecided) )
+		{
+			CaseFeed(stage, units[i++]);
+			continue;
+		}
+
+		// up to a surrogate (no mapping leaves the BMP, nor enters it)
+		size_t count = (n - i < COUNTOF(buffer)) ? n - i : COUNTOF(buffer), k = 0;
+		while( k < count )
+		{
+			if( st->mode != cmTitle )  k += ConvertAscii(units + i + k, count - k, buffer + k, st->mode);
+			if( (k == count) || ((units[i + k] & 0xF800) == 0xD800) )  break;
+			buffer[k] = (UTF16)Convert(st, units[i + k]);
+			++k;
+		}
+		TrEmitRun(stage, buffer, k);
+		i += k;
+		if( (k < count) )  CaseFeed(stage, units[i++]);
+	}
+}
+
+const TranslatorClass kCaseInvert =
+{
+	.name = "CASE",
+	.inverse = "CASE",
+	.description = "upper case letters to lower case and vice versa",
+	.max_output = CaseMaxOutput,
+	.init = CaseInvertInit,
+	.feed = CaseFeed,
+	.feed_run = CaseFeedRun,
+};
+
+const TranslatorClass kCaseCycle =
+{
+	.name = "CYCLE",
+	.inverse = NULL,
+	.description = "lower case -> UPPER CASE -> Title Case -> lower case",
+	.max_output = CaseMaxOutput,
+	.init = CaseCycleInit,
+	.feed = CaseFeed,
+	.feed_run = CaseFeedRun,
+};
@@ -0,0 +1,35 @@
+#ifndef CASEMAP_H
+#define CASEMAP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "translate.h"
+
+// Letter case: the simple (one to one) case mappings of Unicode, and the translators for
+// text typed with CapsLock on by mistake.
+//
+// The mappings are in two-level tables (casetab.h), generated from UnicodeData.txt by
+// tools/ucdgen.c. ASCII letters are flipped by SSE2, 16 units at a time, where there is
+// SSE2.
+
+typedef struct
+{
+	int32_t  upper, lower, title;   // the differences from the codepoint
+} CaseRecord;
+
+
+// ---- provided by casemap.c --------------------------------------------------
+
+uint32_t CaseToUpper( uint32_t codepoint );
+uint32_t CaseToLower( uint32_t codepoint );
+uint32_t CaseToTitle( uint32_t codepoint );
+
+// "CASE": lower case letters to upper case and vice versa ("hELLO" <-> "Hello"); its own
+// inverse (but for a few letters, like the long s, which have no case of their own to go
+// back to).
+extern const TranslatorClass kCaseInvert;
+
+// "CYCLE": "hello" -> "HELLO" -> "Hello" -> "hello", going by the first two letters.
+extern const TranslatorClass kCaseCycle;
+
+#endif
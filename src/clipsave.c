@@ -0,0 +1,156 @@
+// The clipboard snapshot (see clipsave.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "clipsave.h"
+#include "common.h"
+
+void ClipSnapshotInit( ClipSnapshot* snap, const ClipBackend* backend, size_t budget, uint32_t budget_ms )
+{
+	memset(snap, 0, sizeof(*snap));
+	snap->backend = *backend;
+	snap->budget = budget;
+	snap->budget_ms = budget_ms;
+}
+
+void ClipSnapshotDrop( ClipSnapshot* snap )
+{
+	const ClipBackend* b = &snap->backend;
+	for( size_t i = 0; i < snap->count; ++i )
+	{
+		if( snap->items[i].data )  b->release(b->ctx, snap->items[i].format, snap->items[i].data);
+	}
+	snap->count = 0;
+	snap->taken = snap->offered = false;
+}
+
+// the item of `format` still on offer, not rendered yet
+static ClipItem* FindOnOffer( ClipSnapshot* snap, ClipFormat format )
+{
+	if( !snap->offered )  return NULL;
+	for( size_t i = 0; i < snap->count; ++i )
+	{
+		if( (snap->items[i].format == format) && snap->items[i].data )  return &snap->items[i];
+	}
+	return NULL;
+}
+
+bool ClipSnapshotTake( ClipSnapshot* snap )
+{
+	const ClipBackend* b = &snap->backend;
+	if( !b->open(b->ctx) )  return false;
+
+	// the previous snapshot is kept until the end: if it's still on offer, the clipboard
+	// is still ours, and what hasn't been rendered is carried over rather than retained
+	// again (which would make the system ask us to render it first)
+	ClipItem items [CLIP_MAX_FORMATS];
+	size_t count = 0;
+
+	ClipFormat formats [CLIP_MAX_FORMATS];
+	size_t nformats = b->list_formats(b->ctx, formats, CLIP_MAX_FORMATS);
+	if( nformats > CLIP_MAX_FORMATS )
+	{
+		snap->formats_skipped += nformats - CLIP_MAX_FORMATS;
+		nformats = CLIP_MAX_FORMATS;
+	}
+
+	size_t total = 0;
+	uint32_t start_ms = b->now_ms(b->ctx);
+	for( size_t i = 0; i < nformats; ++i )
+	{
+		if( !b->is_preservable(b->ctx, formats[i], formats, nformats) )  continue;
+
+		ClipItem* on_offer = FindOnOffer(snap, formats[i]);
+		if( on_offer )
+		{
+			items[count++] = *on_offer;
+			on_offer->data = 0;
+			++snap->formats_carried;
+			continue;
+		}
+
+		// the formats are listed in the order the app put them, the ones it prefers first
+		if( b->now_ms(b->ctx) - start_ms >= snap->budget_ms )
+		{
+			LOG("format %lu not preserved: out of time", (unsigned long)formats[i]);
+			++snap->formats_skipped;
+			continue;
+		}
+
+		size_t copied = 0;
+		ClipHandle data = b->retain(b->ctx, formats[i], snap->budget - total, &copied);
+		if( data == 0 )
+		{
+			LOG("format %lu not preserved", (unsigned long)formats[i]);
+			++snap->formats_skipped;
+			continue;
+		}
+		items[count++] = (ClipItem){ formats[i], data };
+		total += copied;
+	}
+	b->close(b->ctx);
+
+	ClipSnapshotDrop(snap);
+	memcpy(snap->items, items, count * sizeof(items[0]));
+	snap->count = count;
+	snap->bytes_copied += total;
+	snap->taken = true;
+	LOG("%llu formats, %llu bytes copied", (unsigned long long)count, (unsigned long long)total);
+	return true;
+}
+
+bool ClipSnapshotRestore( ClipSnapshot* snap )
+{
+	const ClipBackend* b = &snap->backend;
+	if( !snap->taken )  return false;
+	if( !b->open(b->ctx) )  return false;
+
+	ClipFormat formats [CLIP_MAX_FORMATS];
+	for( size_t i = 0; i < snap->count; ++i )
+	{
+		formats[i] = snap->items[i].format;
+	}
+
+	// emptying the clipboard notifies its previous owner, which may be us (see ClipSnapshotOwnershipLost)
+	snap->offering = true;
+	bool ok = b->offer(b->ctx, formats, snap->count);
+	snap->offering = false;
+	b->close(b->ctx);
+
+	snap->offered = ok;
+	if( !ok )  ClipSnapshotDrop(snap);
+	return ok;
+}
+
+void ClipSnapshotOwnershipLost( ClipSnapshot* snap )
+{
+	if( snap->offered && !snap->offering )  ClipSnapshotDrop(snap);
+}
+
+bool ClipSnapshotRender( ClipSnapshot* snap, ClipFormat format )
+{
+	const ClipBackend* b = &snap->backend;
+	ClipItem* item = FindOnOffer(snap, format);
+	if( item == NULL )  return false;
+
+	if( !b->render(b->ctx, format, item->data) )  return false;
+	item->data = 0;   // the clipboard's now
+	return true;
+}
+
+bool ClipSnapshotRenderAll( ClipSnapshot* snap )
+{
+	const ClipBackend* b = &snap->backend;
+	if( !snap->offered )  return false;
+	if( !b->open(b->ctx) )  return false;
+
+	bool ok = true;
+	for( size_t i = 0; i < snap->count; ++i )
+	{
+		if( snap->items[i].data )  ok = ClipSnapshotRender(snap, snap->items[i].format) && ok;
+	}
+	b->close(b->ctx);
+	return ok;
+}
@@ -0,0 +1,109 @@
+#ifndef CLIPSAVE_H
+#define CLIPSAVE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Keeping the user's clipboard contents across a selection translation, which
+// otherwise replaces them (the selection is copied and pasted through the clipboard).
+//
+// Right before the selection is copied, the formats the system can't synthesize from
+// the others are retained: the backend keeps each one alive past the emptying of the
+// clipboard, as cheaply as it can (a GDI object is duplicated by GDI, without its bits
+// going through this process; plain memory has to be copied, once). That is bounded,
+// as the translation waits for it: the memory formats only up to a byte budget, so that
+// a huge image isn't copied on every translation, and all of them only for so long, as
+// reading a format the app has only promised makes it render that format first (an
+// office app can promise dozens). What doesn't fit is given up on. After the paste, the
+// snapshot is offered back lazily: the formats are only promised (delayed rendering on
+// Windows), and the retained data is handed over to the clipboard as it is, only when
+// some app actually asks for the format. A snapshot still on offer when the next
+// translation starts is carried over, not retained again.
+//
+// The system clipboard is accessed through a ClipBackend.
+
+typedef uint32_t  ClipFormat;
+typedef uintptr_t ClipHandle;   // the backend's; 0 for none
+
+typedef struct
+{
+	bool   (*open)( void* ctx );
+	void   (*close)( void* ctx );
+	// Fills in up to `max` formats currently on the clipboard; returns how many there are.
+	size_t (*list_formats)( void* ctx, ClipFormat* formats, size_t max );
+	// Whether `format` is to be saved, given all the `formats` on the clipboard
+	// (false for the synthesized ones, and for the ones that can't be retained).
+	bool   (*is_preservable)( void* ctx, ClipFormat format, const ClipFormat* formats, size_t nformats );
+	// Keeps the data of `format` alive after the clipboard is emptied; 0 if it can't, or if
+	// that takes copying more than `max_copy` bytes. *pcopied is set to the bytes copied.
+	ClipHandle (*retain)( void* ctx, ClipFormat format, size_t max_copy, size_t* pcopied );
+	void   (*release)( void* ctx, ClipFormat format, ClipHandle data );
+	// Empties the clipboard, becomes its owner and promises the `formats`;
+	// the clipboard is open.
+	bool   (*offer)( void* ctx, const ClipFormat* formats, size_t nformats );
+	// Puts retained data of a promised format, which the clipboard then owns;
+	// the clipboard is open.
+	bool   (*render)( void* ctx, ClipFormat format, ClipHandle data );
+	uint32_t (*now_ms)( void* ctx );   // a wrapping millisecond clock
+	void*  ctx;
+} ClipBackend;
+
+enum { CLIP_MAX_FORMATS = 32 };
+
+typedef struct
+{
+	ClipFormat  format;
+	ClipHandle  data;           // 0 once handed over to the clipboard
+} ClipItem;
+
+typedef struct
+{
+	ClipBackend  backend;
+	size_t       budget;        // bytes copied per snapshot
+	uint32_t     budget_ms;     // spent retaining the formats of a snapshot
+	ClipItem     items [CLIP_MAX_FORMATS];
+	size_t       count;
+	bool         taken;         // there is a snapshot to restore
+	bool         offered;       // ... and it has been offered back
+	bool         offering;      // ClipSnapshotRestore is in progress
+
+	// for diagnostics
+	uint64_t     bytes_copied;  // by this process, to retain the formats
+	unsigned     formats_skipped;
+	unsigned     formats_carried;   // over from a snapshot still on offer
+} ClipSnapshot;
+
+
+// ---- provided by clipsave.c -------------------------------------------------
+
+void ClipSnapshotInit( ClipSnapshot* snap, const ClipBackend* backend, size_t budget, uint32_t budget_ms );
+
+// Retains the current clipboard contents, dropping the previous snapshot (what of it is
+// still on offer is carried over).
+bool ClipSnapshotTake( ClipSnapshot* snap );
+
+// Makes the snapshot the clipboard contents again, promising its formats;
+// the data stays in the snapshot until rendered or dropped.
+bool ClipSnapshotRestore( ClipSnapshot* snap );
+
+// Delayed rendering: puts the data of one promised format into the clipboard
+// (which must be open already), or all of them (opens the clipboard itself).
+bool ClipSnapshotRender( ClipSnapshot* snap, ClipFormat format );
+bool ClipSnapshotRenderAll( ClipSnapshot* snap );
+
+// To be called when the owner window loses the clipboard (WM_DESTROYCLIPBOARD):
+// drops the snapshot if it has been offered, as it's no longer needed then.
+void ClipSnapshotOwnershipLost( ClipSnapshot* snap );
+
+// Releases the retained data.
+void ClipSnapshotDrop( ClipSnapshot* snap );
+
+
+// ---- provided by clipsave_win.c ---------------------------------------------
+
+// The system clipboard; `owner` is the window to own the promised formats (HWND),
+// it has to handle WM_RENDERFORMAT, WM_RENDERALLFORMATS and WM_DESTROYCLIPBOARD.
+ClipBackend SystemClipboard( void* owner );
+
+#endif
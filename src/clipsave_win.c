@@ -0,0 +1,166 @@
+// The Windows ClipBackend: HGLOBAL formats and GDI objects, delayed rendering.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <windows.h>
+#include "clipsave.h"
+#include "common.h"
+
+static bool Open( void* owner )
+{
+	if( !OpenClipboard((HWND)owner) )  return ERR("OpenClipboard"), false;
+	return true;
+}
+
+static void Close( void* _ )
+{
+	CloseClipboard();
+}
+
+static size_t ListFormats( void* _, ClipFormat* formats, size_t max )
+{
+	size_t n = 0;
+	for( UINT format = 0; (format = EnumClipboardFormats(format)) != 0; ++n )
+	{
+		if( n < max )  formats[n] = format;
+	}
+	return n;
+}
+
+// the formats the system synthesizes from one another: only the one put first is kept,
+// and the system makes up the others again when the snapshot is restored
+static int SynthesisFamily( ClipFormat format )
+{
+	switch( format )
+	{
+		case CF_UNICODETEXT:
+		case CF_TEXT:
+		case CF_OEMTEXT:
+			return 1;
+
+		case CF_BITMAP:
+		case CF_DIB:
+		case CF_DIBV5:
+			return 2;
+	}
+	return 0;
+}
+
+static bool IsPreservable( void* _, ClipFormat format, const ClipFormat* formats, size_t nformats )
+{
+	switch( format )
+	{
+		// not kept: a palette comes with a bitmap, a METAFILEPICT holds a metafile handle
+		// that copying it doesn't duplicate, the display formats are drawn by their owner
+		case CF_METAFILEPICT:
+		case CF_PALETTE:
+		case CF_DSPBITMAP:
+		case CF_DSPMETAFILEPICT:
+		case CF_DSPENHMETAFILE:
+		case CF_OWNERDISPLAY:
+			return false;
+	}
+
+	// private and GDI object formats are not HGLOBALs either
+	if( ((format >= CF_PRIVATEFIRST) && (format <= CF_PRIVATELAST))
+	 || ((format >= CF_GDIOBJFIRST) && (format <= CF_GDIOBJLAST)) )
+		return false;
+
+	// the synthesized formats are listed after the one they are made from
+	int family = SynthesisFamily(format);
+	for( size_t i = 0; family && (i < nformats) && (formats[i] != format); ++i )
+	{
+		if( SynthesisFamily(formats[i]) == family )  return false;
+	}
+	return true;
+}
+
+static ClipHandle Retain( void* _, ClipFormat format, size_t max_copy, size_t* pcopied )
+{
+	*pcopied = 0;
+	HANDLE h = GetClipboardData(format);
+	if( h == NULL )  return ERR("GetClipboardData"), 0;
+
+	// GDI objects are duplicated by GDI; the clipboard's own get deleted when it's emptied
+	if( format == CF_BITMAP )
+	{
+		HANDLE copy = CopyImage(h, IMAGE_BITMAP, 0, 0, 0);
+		if( copy == NULL )  ERR("CopyImage");
+		return (ClipHandle)copy;
+	}
+	if( format == CF_ENHMETAFILE )
+	{
+		HENHMETAFILE copy = CopyEnhMetaFileW((HENHMETAFILE)h, NULL);
+		if( copy == NULL )  ERR("CopyEnhMetaFile");
+		return (ClipHandle)copy;
+	}
+
+	// memory is copied, once: the copy is what goes back into the clipboard
+	size_t size = GlobalSize(h);
+	if( size > max_copy )  return LOG("format %u: %llu bytes, over the budget", format, (unsigned long long)size), 0;
+	HGLOBAL hmem = GlobalAlloc(GMEM_MOVEABLE, size ? size : 1);
+	if( hmem == NULL )  return ERR("GlobalAlloc"), 0;
+
+	const void* p = GlobalLock(h);
+	void* q = GlobalLock(hmem);
+	if( (p == NULL) || (q == NULL) )
+	{
+		ERR("GlobalLock");
+		if( p )  GlobalUnlock(h);
+		if( q )  GlobalUnlock(hmem);
+		GlobalFree(hmem);
+		return 0;
+	}
+	memcpy(q, p, size);
+	GlobalUnlock(hmem);
+	GlobalUnlock(h);
+	*pcopied = size;
+	return (ClipHandle)hmem;
+}
+
+static void Release( void* _, ClipFormat format, ClipHandle data )
+{
+	if( format == CF_BITMAP )  DeleteObject((HGDIOBJ)data);
+	else if( format == CF_ENHMETAFILE )  DeleteEnhMetaFile((HENHMETAFILE)data);
+	else GlobalFree((HGLOBAL)data);
+}
+
+static bool Offer( void* _, const ClipFormat* formats, size_t nformats )
+{
+	if( !EmptyClipboard() )  return ERR("EmptyClipboard"), false;
+	for( size_t i = 0; i < nformats; ++i )
+	{
+		SetClipboardData(formats[i], NULL);  // rendered on WM_RENDERFORMAT
+	}
+	return true;
+}
+
+// the handle itself goes into the clipboard, nothing is copied
+static bool Render( void* _, ClipFormat format, ClipHandle data )
+{
+	if( SetClipboardData(format, (HANDLE)data) == NULL )  return ERR("SetClipboardData"), false;
+	return true;
+}
+
+static uint32_t Now( void* _ )
+{
+	return GetTickCount();
+}
+
+ClipBackend SystemClipboard( void* owner )
+{
+	return (ClipBackend)
+	{
+		.open = Open,
+		.close = Close,
+		.list_formats = ListFormats,
+		.is_preservable = IsPreservable,
+		.retain = Retain,
+		.release = Release,
+		.offer = Offer,
+		.render = Render,
+		.now_ms = Now,
+		.ctx = owner,
+	};
+}
@@ -15,8 +15,6 @@
 
 typedef unsigned VKEY; // for VK_xxx
 
-enum { MAX_KEYBOARD_LAYOUTS = 8 };
-
 extern const VKEY kModifierVKeys []; // terminated with a 0
 
 #endif
@@ -0,0 +1,100 @@
+// The platform-independent part of the control channel: message framing and dispatch.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "control.h"
+
+void CtlPutU32( uint8_t* p, uint32_t v )
+{
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+	p[2] = (uint8_t)(v >> 16);
+	p[3] = (uint8_t)(v >> 24);
+}
+
+void CtlPutU64( uint8_t* p, uint64_t v )
+{
+	CtlPutU32(p, (uint32_t)v);
+	CtlPutU32(p + 4, (uint32_t)(v >> 32));
+}
+
+uint32_t CtlGetU32( const uint8_t* p )
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint64_t CtlGetU64( const uint8_t* p )
+{
+	return CtlGetU32(p) | ((uint64_t)CtlGetU32(p + 4) << 32);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t CtlEncode( void* buffer, size_t buffer_size, unsigned code, uint32_t seq,
+                  const void* payload, size_t length )
+{
+	if( (length > CTL_MAX_PAYLOAD) || (buffer_size < CTL_HEADER_SIZE + length) )  return 0;
+
+	uint8_t* p = (uint8_t*) buffer;
+	CtlPutU32(p + 0, CTL_MAGIC);
+	p[4] = (uint8_t)CTL_VERSION;
+	p[5] = (uint8_t)(CTL_VERSION >> 8);
+	p[6] = (uint8_t)code;
+	p[7] = (uint8_t)(code >> 8);
+	CtlPutU32(p + 8, seq);
+	CtlPutU32(p + 12, (uint32_t)length);
+
+	// the payload may already be in place (see CtlServeRequest)
+	if( length && (payload != p + CTL_HEADER_SIZE) )  memmove(p + CTL_HEADER_SIZE, payload, length);
+
+	return CTL_HEADER_SIZE + length;
+}
+
+bool CtlDecode( const void* buffer, size_t size, CtlMessage* pmsg )
+{
+	const uint8_t* p = (const uint8_t*) buffer;
+	if( size < CTL_HEADER_SIZE )  return false;
+	if( CtlGetU32(p) != CTL_MAGIC )  return false;
+	if( (p[4] | (p[5] << 8)) != CTL_VERSION )  return false;
+
+	pmsg->code    = p[6] | (p[7] << 8);
+	pmsg->seq     = CtlGetU32(p + 8);
+	pmsg->length  = CtlGetU32(p + 12);
+	pmsg->payload = p + CTL_HEADER_SIZE;
+
+	return (pmsg->length <= CTL_MAX_PAYLOAD) && (size >= CTL_HEADER_SIZE + pmsg->length);
+}
+
+size_t CtlServeRequest( const void* request, size_t size, void* reply )
+{
+	CtlMessage rq;
+	if( !CtlDecode(request, size, &rq) )
+		return CtlEncode(reply, CTL_MAX_MESSAGE, ctlErrProtocol, 0, NULL, 0);
+
+	uint8_t* reply_payload = (uint8_t*)reply + CTL_HEADER_SIZE;
+	size_t reply_length = 0;
+	CtlResult rc = ctlErrUnknown;
+
+	if( (rq.code >= ctlStatus) && (rq.code <= CTL_COMMAND_LAST) )
+		rc = AppControlRequest((CtlCommand)rq.code, rq.payload, rq.length, reply_payload, &reply_length);
+
+	if( reply_length > CTL_MAX_PAYLOAD )  reply_length = 0;
+	return CtlEncode(reply, CTL_MAX_MESSAGE, rc, rq.seq, reply_payload, reply_length);
+}
+
+// -----------------------------------------------------------------------------
+
+void CtlStatusEncode( uint8_t* p, const CtlStatus* ps )
+{
+	CtlPutU32(p + 0, ps->pid);
+	CtlPutU32(p + 4, ps->flags);
+	CtlPutU32(p + 8, ps->uptime_s);
+}
+
+void CtlStatusDecode( const uint8_t* p, CtlStatus* ps )
+{
+	ps->pid      = CtlGetU32(p + 0);
+	ps->flags    = CtlGetU32(p + 4);
+	ps->uptime_s = CtlGetU32(p + 8);
+}
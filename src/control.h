@@ -0,0 +1,129 @@
+#ifndef CONTROL_H
+#define CONTROL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// A request/response channel for controlling the running instance:
+// a named pipe on Windows, a Unix domain socket elsewhere.
+//
+// Every message (a request or a reply) is a 16-byte header followed by
+// `length` bytes of payload. All integers are little-endian.
+//   u32  magic    CTL_MAGIC
+//   u16  version  CTL_VERSION
+//   u16  code     CtlCommand in a request, CtlResult in a reply
+//   u32  seq      arbitrary in a request, echoed back in the reply
+//   u32  length   payload size, at most CTL_MAX_PAYLOAD
+
+enum
+{
+	CTL_MAGIC       = 0x7773626B,  // "kbsw"
+	CTL_VERSION     = 1,
+	CTL_HEADER_SIZE = 16,
+	CTL_MAX_PAYLOAD = 4096,
+	CTL_MAX_MESSAGE = CTL_HEADER_SIZE + CTL_MAX_PAYLOAD,
+};
+
+typedef enum
+{
+	ctlStatus = 1,    // reply: CtlStatus, followed by the UTF-8 command line
+	ctlMetrics,       // reply: u32 count, followed by count * u64 (indexed by CtlMetric)
+	ctlPause,
+	ctlResume,
+	ctlReconfigure,   // request: NUL-terminated UTF-8 command line arguments, one after another
+	ctlQuit,
+	ctlTrace,         // request: empty to start recording trace events, or a UTF-8 file name
+	                  // to write the recorded ones into (and stop); reply: u32 number of events written
+} CtlCommand;
+
+enum { CTL_COMMAND_LAST = ctlTrace };
+
+typedef enum
+{
+	ctlOk = 0,
+	ctlErrProtocol,   // malformed request or unsupported version
+	ctlErrUnknown,    // unknown command
+	ctlErrFailed,     // the command was understood but could not be carried out
+} CtlResult;
+
+// ctlStatus reply payload, followed by the command line text
+enum
+{
+	CTL_STATUS_SIZE    = 12,
+	CTL_STATUS_PAUSED  = 1,   // bits in CtlStatus.flags
+	CTL_STATUS_TRACING = 2,
+};
+
+typedef struct
+{
+	uint32_t  pid;
+	uint32_t  flags;
+	uint32_t  uptime_s;
+} CtlStatus;
+
+// ctlMetrics reply payload; new metrics are only ever appended
+typedef enum
+{
+	ctlmActivations,         // layout switch key activations received from the hook
+	ctlmIgnoredFullscreen,   // ... ignored because of a fullscreen app
+	ctlmIgnoredBusy,         // ... ignored because a translation was in progress
+	ctlmTranslations,        // selection translations started
+	ctlmHookReinstalls,      // the keyboard hook found gone, and reinstalled
+	CTL_METRICS_COUNT
+} CtlMetric;
+
+typedef struct
+{
+	uint16_t        code;
+	uint32_t        seq;
+	uint32_t        length;
+	const uint8_t*  payload;
+} CtlMessage;
+
+
+// ---- provided by control.c --------------------------------------------------
+
+void     CtlPutU32( uint8_t* p, uint32_t v );
+void     CtlPutU64( uint8_t* p, uint64_t v );
+uint32_t CtlGetU32( const uint8_t* p );
+uint64_t CtlGetU64( const uint8_t* p );
+
+// Writes a message into `buffer`; returns its total size, or 0 if it doesn't fit.
+size_t CtlEncode( void* buffer, size_t buffer_size, unsigned code, uint32_t seq,
+                  const void* payload, size_t length );
+
+// Validates the message in `buffer` and fills in *pmsg, which then points into `buffer`.
+// `size` may be larger than the message; returns false if it is incomplete or malformed.
+bool CtlDecode( const void* buffer, size_t size, CtlMessage* pmsg );
+
+// Server side: handles one request by calling AppControlRequest,
+// writes the reply into `reply` (CTL_MAX_MESSAGE bytes) and returns its size.
+size_t CtlServeRequest( const void* request, size_t size, void* reply );
+
+void CtlStatusEncode( uint8_t* p, const CtlStatus* ps );
+void CtlStatusDecode( const uint8_t* p, CtlStatus* ps );
+
+
+// ---- provided by control_win.c / control_posix.c ----------------------------
+
+// Starts listening for requests on a background thread.
+// Fails if another instance is already listening.
+bool ControlServerStart( void );
+void ControlServerStop( void );
+
+// Sends a request to the running instance and waits for the reply.
+// `reply` must have room for CTL_MAX_PAYLOAD bytes.
+// Returns false if there is no running instance or the transport failed.
+bool ControlCall( CtlCommand cmd, const void* payload, size_t length,
+                  CtlResult* presult, void* reply, size_t* preply_length );
+
+
+// ---- should be defined by the application -----------------------------------
+
+// Called on the control server thread for each well-formed request.
+// Should write up to CTL_MAX_PAYLOAD bytes into `reply` and set *preply_length.
+CtlResult AppControlRequest( CtlCommand cmd, const uint8_t* payload, size_t length,
+                             uint8_t* reply, size_t* preply_length );
+
+#endif
@@ -0,0 +1,282 @@
+// The control channel transport on POSIX systems: a Unix domain stream socket
+// in $XDG_RUNTIME_DIR, or else in a directory of our own in /tmp, one per user.
+//
+// The server serves one client at a time, so every read and write has a deadline: a
+// client that connects and says nothing is dropped after CLIENT_TIMEOUT_ms. Both ends
+// check that the other one runs as the same user.
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "control.h"
+#include "common.h"
+
+enum
+{
+	CLIENT_TIMEOUT_ms = 1000,   // the server waits this long for each part of a request
+	CALL_TIMEOUT_ms   = 3000,   // a client, for the reply: more than the above, for a busy server
+};
+
+static int          gListenFd = -1;
+static int          gWakePipe [2] = { -1, -1 };   // written to by ControlServerStop
+static pthread_t    gThread;
+static atomic_bool  gStopping;
+
+// NULL if there is no place for it that only we can get at
+static const struct sockaddr_un* GetSocketAddress( void )
+{
+	static struct sockaddr_un addr;
+	if( addr.sun_family == 0 )
+	{
+		const char* dir = getenv("XDG_RUNTIME_DIR");
+		if( dir && *dir )
+		{
+			// made by the system, for this user only
+			snprintf(addr.sun_path, sizeof(addr.sun_path), "%s/kbsw.sock", dir);
+		}
+		else
+		{
+			// /tmp is everyone's: a directory of our own in it, that nobody else can write into
+			char private_dir [64];
+			snprintf(private_dir, sizeof(private_dir), "/tmp/kbsw-%u", (unsigned)getuid());
+			struct stat st;
+			if( (mkdir(private_dir, 0700) != 0) && (errno != EEXIST) )
+				return LOG("mkdir %s: %s", private_dir, strerror(errno)), NULL;
+			if( (lstat(private_dir, &st) != 0) || !S_ISDIR(st.st_mode) || (st.st_uid != getuid())
+			 || (st.st_mode & 077) )
+				return LOG("%s is not ours alone", private_dir), NULL;
+			snprintf(addr.sun_path, sizeof(addr.sun_path), "%s/kbsw.sock", private_dir);
+		}
+		addr.sun_family = AF_UNIX;
+	}
+	return &addr;
+}
+
+static bool PeerIsUs( int fd )
+{
+#if defined(SO_PEERCRED)
+	struct ucred cred;
+	socklen_t size = sizeof(cred);
+	return (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &size) == 0) && (cred.uid == getuid());
+#else
+	uid_t uid;
+	gid_t gid;
+	return (getpeereid(fd, &uid, &gid) == 0) && (uid == getuid());
+#endif
+}
+
+static uint64_t Now_ms( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000;
+}
+
+// waits until `fd` is ready for `events`, the deadline passes or the server is stopped
+static bool WaitFor( int fd, short events, uint64_t deadline_ms, int wake_fd )
+{
+	for( ;; )
+	{
+		uint64_t now_ms = Now_ms();
+		if( now_ms >= deadline_ms )  return false;
+
+		struct pollfd fds [2] = { { .fd = fd, .events = events }, { .fd = wake_fd, .events = POLLIN } };
+		int n = poll(fds, (wake_fd >= 0) ? 2 : 1, (int)(deadline_ms - now_ms));
+		if( (n < 0) && (errno == EINTR) )  continue;
+		if( (n < 0) || (fds[1].revents & POLLIN) )  return false;
+		if( fds[0].revents )  return true;
+	}
+}
+
+static bool ReadExactly( int fd, void* buffer, size_t size, uint64_t deadline_ms, int wake_fd )
+{
+	for( uint8_t* p = buffer; size > 0; )
+	{
+		if( !WaitFor(fd, POLLIN, deadline_ms, wake_fd) )  return false;
+		ssize_t n = recv(fd, p, size, MSG_DONTWAIT);
+		if( (n < 0) && ((errno == EINTR) || (errno == EAGAIN)) )  continue;
+		if( n <= 0 )  return false;
+		p += n;
+		size -= n;
+	}
+	return true;
+}
+
+static bool WriteExactly( int fd, const void* buffer, size_t size, uint64_t deadline_ms, int wake_fd )
+{
+	for( const uint8_t* p = buffer; size > 0; )
+	{
+		if( !WaitFor(fd, POLLOUT, deadline_ms, wake_fd) )  return false;
+		ssize_t n = send(fd, p, size, MSG_NOSIGNAL | MSG_DONTWAIT);
+		if( (n < 0) && ((errno == EINTR) || (errno == EAGAIN)) )  continue;
+		if( n <= 0 )  return false;
+		p += n;
+		size -= n;
+	}
+	return true;
+}
+
+// reads one framed message; returns its size or 0
+static size_t ReadMessage( int fd, uint8_t* buffer, uint64_t deadline_ms, int wake_fd )
+{
+	if( !ReadExactly(fd, buffer, CTL_HEADER_SIZE, deadline_ms, wake_fd) )  return 0;
+	uint32_t length = CtlGetU32(buffer + 12);
+	if( length > CTL_MAX_PAYLOAD )  return 0;
+	if( !ReadExactly(fd, buffer + CTL_HEADER_SIZE, length, deadline_ms, wake_fd) )  return 0;
+	return CTL_HEADER_SIZE + length;
+}
+
+static void* ControlThread( void* _ )
+{
+	static uint8_t request [CTL_MAX_MESSAGE], reply [CTL_MAX_MESSAGE];
+
+	while( !atomic_load(&gStopping) )
+	{
+		if( !WaitFor(gListenFd, POLLIN, UINT64_MAX, gWakePipe[0]) )  break;
+		int fd = accept4(gListenFd, NULL, NULL, SOCK_CLOEXEC);
+		if( fd < 0 )
+		{
+			if( errno == EINTR || errno == ECONNABORTED || errno == EAGAIN )  continue;
+			break;
+		}
+		if( !PeerIsUs(fd) )
+		{
+			LOG("a client of another user");
+			close(fd);
+			continue;
+		}
+
+		// serve requests until the client disconnects, or keeps quiet for too long
+		size_t n;
+		while( !atomic_load(&gStopping)
+		    && (n = ReadMessage(fd, request, Now_ms() + CLIENT_TIMEOUT_ms, gWakePipe[0])) > 0 )
+		{
+			n = CtlServeRequest(request, n, reply);
+			if( !WriteExactly(fd, reply, n, Now_ms() + CLIENT_TIMEOUT_ms, gWakePipe[0]) )  break;
+		}
+		close(fd);
+	}
+	return NULL;
+}
+
+bool ControlServerStart( void )
+{
+	const struct sockaddr_un* addr = GetSocketAddress();
+	if( addr == NULL )  return false;
+
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+	if( fd < 0 )  return LOG("socket: %s", strerror(errno)), false;
+
+	if( bind(fd, (const struct sockaddr*)addr, sizeof(*addr)) != 0 )
+	{
+		// either another instance is listening, or a stale socket was left behind
+		int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		bool alive = (probe >= 0) && (connect(probe, (const struct sockaddr*)addr, sizeof(*addr)) == 0);
+		if( probe >= 0 )  close(probe);
+
+		if( alive || (unlink(addr->sun_path) != 0) ||
+		    (bind(fd, (const struct sockaddr*)addr, sizeof(*addr)) != 0) )
+		{
+			LOG("bind %s: %s", addr->sun_path, alive ? "already running" : strerror(errno));
+			close(fd);
+			return false;
+		}
+	}
+	chmod(addr->sun_path, 0600);
+
+	if( listen(fd, 8) != 0 )
+	{
+		LOG("listen: %s", strerror(errno));
+		close(fd);
+		unlink(addr->sun_path);
+		return false;
+	}
+	if( pipe2(gWakePipe, O_CLOEXEC) != 0 )
+	{
+		LOG("pipe: %s", strerror(errno));
+		close(fd);
+		unlink(addr->sun_path);
+		return false;
+	}
+
+	gListenFd = fd;
+	atomic_store(&gStopping, false);
+	if( pthread_create(&gThread, NULL, ControlThread, NULL) != 0 )
+	{
+		LOG("pthread_create failed");
+		close(fd);
+		close(gWakePipe[0]);
+		close(gWakePipe[1]);
+		gWakePipe[0] = gWakePipe[1] = -1;
+		unlink(addr->sun_path);
+		gListenFd = -1;
+		return false;
+	}
+	return true;
+}
+
+void ControlServerStop( void )
+{
+	if( gListenFd < 0 )  return;
+	atomic_store(&gStopping, true);
+	// wakes the thread up wherever it waits: for a client, or for a client's request
+	if( write(gWakePipe[1], "", 1) < 0 )  LOG("write: %s", strerror(errno));
+	pthread_join(gThread, NULL);
+	close(gListenFd);
+	close(gWakePipe[0]);
+	close(gWakePipe[1]);
+	gWakePipe[0] = gWakePipe[1] = -1;
+	unlink(GetSocketAddress()->sun_path);
+	gListenFd = -1;
+}
+
+bool ControlCall( CtlCommand cmd, const void* payload, size_t length,
+                  CtlResult* presult, void* reply, size_t* preply_length )
+{
+	uint8_t request_msg [CTL_MAX_MESSAGE], reply_msg [CTL_MAX_MESSAGE];
+	static atomic_uint seq;
+	uint32_t my_seq = atomic_fetch_add(&seq, 1) + 1;
+
+	size_t n = CtlEncode(request_msg, sizeof(request_msg), cmd, my_seq, payload, length);
+	if( n == 0 )  return LOG("request too large"), false;
+
+	const struct sockaddr_un* addr = GetSocketAddress();
+	if( addr == NULL )  return false;
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if( fd < 0 )  return LOG("socket: %s", strerror(errno)), false;
+
+	uint64_t deadline_ms = Now_ms() + CALL_TIMEOUT_ms;
+	bool connected = (connect(fd, (const struct sockaddr*)addr, sizeof(*addr)) == 0);
+	if( connected && !PeerIsUs(fd) )
+	{
+		close(fd);
+		return LOG("%s is served by another user", addr->sun_path), false;
+	}
+	bool ok = connected
+	       && WriteExactly(fd, request_msg, n, deadline_ms, -1)
+	       && ((n = ReadMessage(fd, reply_msg, deadline_ms, -1)) > 0);
+	close(fd);
+	if( !ok )  return LOG("%s: %s", addr->sun_path, connected ? "no reply" : strerror(errno)), false;
+
+	CtlMessage msg;
+	if( !CtlDecode(reply_msg, n, &msg) || (msg.seq != my_seq) )
+		return LOG("malformed reply"), false;
+
+	memcpy(reply, msg.payload, msg.length);
+	*preply_length = msg.length;
+	*presult = (CtlResult) msg.code;
+	return true;
+}
@@ -0,0 +1,179 @@
+// The control channel transport on Windows: a message-mode named pipe,
+// one per logon session.
+//
+// The server serves one client at a time, so its reads and writes are overlapped and
+// have a deadline: a client that connects and says nothing is dropped after
+// CLIENT_TIMEOUT_ms. A client waits no longer than CALL_TIMEOUT_ms for the reply,
+// either: the server may be stuck (its main thread in a message box, say).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <windows.h>
+#include <process.h>
+#include "control.h"
+#include "common.h"
+
+enum
+{
+	CLIENT_TIMEOUT_ms = 1000,   // the server waits this long for each part of a request
+	CALL_TIMEOUT_ms   = 3000,   // a client, for the reply: more than the above, for a busy server
+};
+
+static HANDLE       ghPipe = INVALID_HANDLE_VALUE;
+static HANDLE       ghThread = NULL;
+static HANDLE       ghStop;   // set by ControlServerStop
+static atomic_bool  gStopping;
+
+// returns a pointer to an internal buffer
+static const WCHAR* GetPipeName( void )
+{
+	static WCHAR name [128];
+	if( name[0] == 0 )
+	{
+		DWORD session = 0;
+		ProcessIdToSessionId(GetCurrentProcessId(), &session);
+		snwprintf(name, COUNTOF(name), L"\\\\.\\pipe\\kbsw.%lu.6qZK6nb0dYxsgS6H4b8w", session);
+	}
+	return name;
+}
+
+// waits for an overlapped operation on the pipe to complete; false if it has failed,
+// has not completed in time, or the server is being stopped
+static bool Complete( OVERLAPPED* ov, BOOL done, DWORD timeout_ms, DWORD* pn )
+{
+	if( !done && (GetLastError() != ERROR_IO_PENDING) )  return false;
+
+	HANDLE handles [2] = { ov->hEvent, ghStop };
+	if( WaitForMultipleObjects(2, handles, FALSE, timeout_ms) != WAIT_OBJECT_0 )
+	{
+		CancelIo(ghPipe);
+		GetOverlappedResult(ghPipe, ov, pn, TRUE);   // the buffers are ours again
+		return false;
+	}
+	return GetOverlappedResult(ghPipe, ov, pn, FALSE);
+}
+
+static unsigned __stdcall ControlThread( void* _ )
+{
+	static uint8_t request [CTL_MAX_MESSAGE], reply [CTL_MAX_MESSAGE];
+	OVERLAPPED ov = { .hEvent = CreateEventW(NULL, TRUE, FALSE, NULL) };
+
+	while( !atomic_load(&gStopping) )
+	{
+		DWORD n;
+		BOOL done = ConnectNamedPipe(ghPipe, &ov);
+		bool connected = (!done && (GetLastError() == ERROR_PIPE_CONNECTED)) || Complete(&ov, done, INFINITE, &n);
+		if( !connected )
+		{
+			if( !atomic_load(&gStopping) )  ERR("ConnectNamedPipe");
+			break;
+		}
+
+		// serve requests until the client disconnects, or keeps quiet for too long
+		DWORD nread, nwritten;
+		while( Complete(&ov, ReadFile(ghPipe, request, sizeof(request), NULL, &ov), CLIENT_TIMEOUT_ms, &nread) )
+		{
+			size_t n = CtlServeRequest(request, nread, reply);
+			if( !Complete(&ov, WriteFile(ghPipe, reply, n, NULL, &ov), CLIENT_TIMEOUT_ms, &nwritten) )  break;
+		}
+
+		DisconnectNamedPipe(ghPipe);
+	}
+
+	CloseHandle(ov.hEvent);
+	CloseHandle(ghPipe);
+	ghPipe = INVALID_HANDLE_VALUE;
+	return 0;
+}
+
+bool ControlServerStart( void )
+{
+	HANDLE pipe = CreateNamedPipeW(GetPipeName(),
+	                               PIPE_ACCESS_DUPLEX | FILE_FLAG_FIRST_PIPE_INSTANCE | FILE_FLAG_OVERLAPPED,
+	                               PIPE_TYPE_MESSAGE | PIPE_READMODE_MESSAGE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+	                               1, CTL_MAX_MESSAGE, CTL_MAX_MESSAGE, 0, NULL);
+	if( pipe == INVALID_HANDLE_VALUE )  return ERR("CreateNamedPipe"), false;
+	if( !ghStop && !(ghStop = CreateEventW(NULL, TRUE, FALSE, NULL)) )
+	{
+		ERR("CreateEvent");
+		CloseHandle(pipe);
+		return false;
+	}
+
+	ghPipe = pipe;
+	ResetEvent(ghStop);
+	atomic_store(&gStopping, false);
+	ghThread = (HANDLE)_beginthreadex(NULL, 0, ControlThread, NULL, 0, NULL);
+	if( ghThread == NULL )
+	{
+		ERR("_beginthreadex");
+		CloseHandle(ghPipe);
+		ghPipe = INVALID_HANDLE_VALUE;
+		return false;
+	}
+	return true;
+}
+
+void ControlServerStop( void )
+{
+	if( ghThread == NULL )  return;
+	atomic_store(&gStopping, true);
+
+	// wakes the thread up wherever it waits: for a client, or for a client's request
+	// (or, for at most a request timeout, for the main thread to answer one)
+	SetEvent(ghStop);
+	WaitForSingleObject(ghThread, INFINITE);
+	CloseHandle(ghThread);
+	ghThread = NULL;
+}
+
+bool ControlCall( CtlCommand cmd, const void* payload, size_t length,
+                  CtlResult* presult, void* reply, size_t* preply_length )
+{
+	static uint8_t request_msg [CTL_MAX_MESSAGE], reply_msg [CTL_MAX_MESSAGE];
+	static uint32_t seq;
+
+	size_t n = CtlEncode(request_msg, sizeof(request_msg), cmd, ++seq, payload, length);
+	if( n == 0 )  return LOG("request too large"), false;
+
+	// as CallNamedPipe, which only bounds the wait for the pipe, not the one for the reply
+	ULONGLONG deadline_ms = GetTickCount64() + CALL_TIMEOUT_ms;
+	HANDLE pipe;
+	while( (pipe = CreateFileW(GetPipeName(), GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING,
+	                           FILE_FLAG_OVERLAPPED, NULL)) == INVALID_HANDLE_VALUE )
+	{
+		// another client is being served
+		ULONGLONG now_ms = GetTickCount64();
+		if( (GetLastError() != ERROR_PIPE_BUSY) || (now_ms >= deadline_ms)
+		 || !WaitNamedPipeW(GetPipeName(), (DWORD)(deadline_ms - now_ms)) )
+			return ERR("CreateFile"), false;
+	}
+
+	DWORD mode = PIPE_READMODE_MESSAGE, nread = 0;
+	OVERLAPPED ov = { .hEvent = CreateEventW(NULL, TRUE, FALSE, NULL) };
+	bool ok = ov.hEvent && SetNamedPipeHandleState(pipe, &mode, NULL, NULL);
+	if( ok )
+	{
+		ULONGLONG now_ms = GetTickCount64();
+		DWORD timeout_ms = (now_ms < deadline_ms) ? (DWORD)(deadline_ms - now_ms) : 0;
+		BOOL done = TransactNamedPipe(pipe, request_msg, n, reply_msg, sizeof(reply_msg), NULL, &ov);
+		bool pending = !done && (GetLastError() == ERROR_IO_PENDING);
+		if( pending && (WaitForSingleObject(ov.hEvent, timeout_ms) != WAIT_OBJECT_0) )  CancelIo(pipe);
+		// fails if cancelled; either way the buffers are ours again
+		ok = (done || pending) && GetOverlappedResult(pipe, &ov, &nread, TRUE);
+	}
+	if( !ok )  ERR("TransactNamedPipe");
+	if( ov.hEvent )  CloseHandle(ov.hEvent);
+	CloseHandle(pipe);
+	if( !ok )  return false;
+
+	CtlMessage msg;
+	if( !CtlDecode(reply_msg, nread, &msg) || (msg.seq != seq) )
+		return LOG("malformed reply"), false;
+
+	memcpy(reply, msg.payload, msg.length);
+	*preply_length = msg.length;
+	*presult = (CtlResult) msg.code;
+	return true;
+}
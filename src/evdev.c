@@ -0,0 +1,311 @@
+// The keyboard input of Linux, from evdev (see evdev.h).
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/ioctl.h>
+#include <sys/epoll.h>
+#include <linux/input.h>
+#include "evdev.h"
+#include "common.h"
+
+// the same as kModifierVKeys
+static const uint16_t kModifierCodes [] =
+{
+	KEY_LEFTSHIFT, KEY_LEFTCTRL, KEY_LEFTALT, KEY_LEFTMETA,
+	KEY_RIGHTSHIFT, KEY_RIGHTCTRL, KEY_RIGHTALT, KEY_RIGHTMETA,
+};
+
+// the same names as in the usage of kbsw.c
+static const struct { const char* names; uint16_t code; } kKeyNames [] =
+{
+	{ "LC LCtrl LeftCtrl LeftControl",    KEY_LEFTCTRL },
+	{ "RC RCtrl RightCtrl RightControl",  KEY_RIGHTCTRL },
+	{ "LS LShift LeftShift",              KEY_LEFTSHIFT },
+	{ "RS RShift RightShift",             KEY_RIGHTSHIFT },
+	{ "LA LAlt LeftAlt",                  KEY_LEFTALT },
+	{ "RA RAlt RightAlt",                 KEY_RIGHTALT },
+	{ "LW LWin LeftWin",                  KEY_LEFTMETA },
+	{ "RW RWin RightWin",                 KEY_RIGHTMETA },
+	{ "CL Caps CapsLock",                 KEY_CAPSLOCK },
+	{ "NL NumLock",                       KEY_NUMLOCK },
+	{ "SL ScrollLock",                    KEY_SCROLLLOCK },
+};
+
+#define TEST_BIT( bits, n )  ((bits)[(n) / 8] & (1 << ((n) % 8)))
+
+uint16_t EvdevKeyCode( const char* name, size_t length )
+{
+	for( unsigned i = 0; i < COUNTOF(kKeyNames); ++i )
+	{
+		for( const char* word = kKeyNames[i].names; *word; )
+		{
+			size_t word_length = strcspn(word, " ");
+			if( (word_length == length) && (strncmp(word, name, length) == 0) )
+				return kKeyNames[i].code;
+			word += word_length;
+			word += (*word == ' ');
+		}
+	}
+	return 0;
+}
+
+static unsigned ModifierBit( uint16_t code )
+{
+	for( unsigned i = 0; i < COUNTOF(kModifierCodes); ++i )
+	{
+		if( kModifierCodes[i] == code )  return 1u << i;
+	}
+	return 0;
+}
+
+static uint32_t EventTime_ms( const struct input_event* ev )
+{
+	// a wrapping millisecond clock, like the time of the events on Windows
+	return (uint32_t)ev->input_event_sec * 1000u + (uint32_t)ev->input_event_usec / 1000u;
+}
+
+// -----------------------------------------------------------------------------
+
+bool EvdevInit( EvdevReader* r, const EvdevHost* host )
+{
+	memset(r, 0, sizeof(*r));
+	r->host = *host;
+	r->config.tap_timeout_ms = 300;
+	TapDetectorReset(&r->tap);
+	r->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	if( r->epoll_fd < 0 )  return LOG("epoll_create1: %s", strerror(errno)), false;
+	return true;
+}
+
+void EvdevConfigure( EvdevReader* r, const EvdevConfig* config )
+{
+	r->config = *config;
+	if( r->config.nkeys > EVDEV_MAX_KEYS )  r->config.nkeys = EVDEV_MAX_KEYS;
+	// the key indices may have changed meaning
+	TapDetectorOther(&r->tap);
+}
+
+static void RemoveSource( EvdevReader* r, unsigned index )
+{
+	EvdevSource* s = &r->sources[index];
+	if( s->regular )
+		--r->nregular;
+	else
+		epoll_ctl(r->epoll_fd, EPOLL_CTL_DEL, s->fd, NULL);
+	close(s->fd);
+	*s = r->sources[--r->nsources];
+}
+
+void EvdevClose( EvdevReader* r )
+{
+	while( r->nsources > 0 )  RemoveSource(r, r->nsources - 1);
+	if( r->epoll_fd >= 0 )  close(r->epoll_fd);
+	r->epoll_fd = -1;
+}
+
+bool EvdevAddFd( EvdevReader* r, int fd )
+{
+	if( r->nsources == EVDEV_MAX_SOURCES )
+		return LOG("too many sources"), close(fd), false;
+
+	int flags = fcntl(fd, F_GETFL);
+	if( (flags < 0) || (fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) )
+		return LOG("fcntl: %s", strerror(errno)), close(fd), false;
+
+	struct stat st;
+	bool regular = (fstat(fd, &st) == 0) && S_ISREG(st.st_mode);
+
+	// the default is CLOCK_REALTIME, which jumps when the clock is set, and breaks the taps then
+	int clock = CLOCK_MONOTONIC;
+	if( S_ISCHR(st.st_mode) && (ioctl(fd, EVIOCSCLOCKID, &clock) < 0) )  LOG("EVIOCSCLOCKID: %s", strerror(errno));
+	if( !regular )
+	{
+		struct epoll_event ev = { .events = EPOLLIN, .data.fd = fd };
+		if( epoll_ctl(r->epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0 )
+			return LOG("epoll_ctl: %s", strerror(errno)), close(fd), false;
+	}
+
+	r->sources[r->nsources++] = (EvdevSource){ .fd = fd, .regular = regular };
+	r->nregular += regular;
+	return true;
+}
+
+unsigned EvdevOpenKeyboards( EvdevReader* r )
+{
+	DIR* dir = opendir("/dev/input");
+	if( dir == NULL )  return LOG("/dev/input: %s", strerror(errno)), 0;
+
+	unsigned count = 0;
+	struct dirent* de;
+	while( (de = readdir(dir)) != NULL )
+	{
+		if( strncmp(de->d_name, "event", 5) != 0 )  continue;
+
+		char path [300];
+		snprintf(path, sizeof(path), "/dev/input/%s", de->d_name);
+		int fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+		if( fd < 0 )
+		{
+			LOG("%s: %s", path, strerror(errno));
+			continue;
+		}
+
+		// a keyboard has letters; the power buttons, mice and such do not
+		uint8_t keys [KEY_MAX / 8 + 1] = {0};
+		if( (ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(keys)), keys) < 0)
+		    || !TEST_BIT(keys, KEY_A) || !TEST_BIT(keys, KEY_Z) || !TEST_BIT(keys, KEY_SPACE) )
+		{
+			close(fd);
+			continue;
+		}
+		LOG("%s", path);
+		count += EvdevAddFd(r, fd);
+	}
+	closedir(dir);
+	return count;
+}
+
+// -----------------------------------------------------------------------------
+
+// after the kernel has dropped events of `s`: the keys held on it may have changed meanwhile
+static void Resync( EvdevSource* s )
+{
+	uint8_t keys [KEY_MAX / 8 + 1] = {0};
+	s->modifiers = 0;
+	if( ioctl(s->fd, EVIOCGKEY(sizeof(keys)), keys) < 0 )  return;   // not a device
+	for( unsigned i = 0; i < COUNTOF(kModifierCodes); ++i )
+	{
+		if( TEST_BIT(keys, kModifierCodes[i]) )  s->modifiers |= 1u << i;
+	}
+}
+
+// the modifiers held on any of the sources, but for the switch key `code` pressed on `s`
+static bool AnyModifier( const EvdevReader* r, const EvdevSource* s, uint16_t code )
+{
+	uint8_t held = 0;
+	for( unsigned i = 0; i < r->nsources; ++i )
+	{
+		held |= (&r->sources[i] == s) ? (s->modifiers & ~ModifierBit(code)) : r->sources[i].modifiers;
+	}
+	return held != 0;
+}
+
+static void OnKey( EvdevReader* r, EvdevSource* s, const struct input_event* ev )
+{
+	s->modifiers = (ev->value != 0) ? (s->modifiers | ModifierBit(ev->code))
+	                                 : (s->modifiers & ~ModifierBit(ev->code));
+	r->stats.keystrokes += (ev->value == 1);
+
+	const EvdevConfig* cfg = &r->config;
+	for( unsigned i = 0; i < cfg->nkeys; ++i )
+	{
+		if( ev->code != cfg->codes[i] )  continue;
+
+		// an autorepeat (2) is one more press, as on Windows
+		if( ev->value != 0 )
+			TapDetectorDown(&r->tap, i, EventTime_ms(ev), cfg->tap_timeout_ms);
+		else if( TapDetectorUp(&r->tap, i, EventTime_ms(ev), cfg->tap_timeout_ms) )
+		{
+			++r->stats.activations;
+			r->host.activate(r->host.ctx, i, AnyModifier(r, s, ev->code));
+		}
+		return;
+	}
+
+	TapDetectorOther(&r->tap);
+}
+
+static void Feed( EvdevReader* r, EvdevSource* s, const struct input_event* events, size_t count )
+{
+	r->stats.events += count;
+	for( size_t i = 0; i < count; ++i )
+	{
+		const struct input_event* ev = &events[i];
+		if( ev->type == EV_SYN )
+		{
+			if( ev->code == SYN_DROPPED )
+			{
+				// skip the rest of the report, and start over from the state of the keys then
+				++r->stats.dropped;
+				s->dropping = true;
+				TapDetectorOther(&r->tap);
+			}
+			else if( (ev->code == SYN_REPORT) && s->dropping )
+			{
+				s->dropping = false;
+				Resync(s);
+			}
+		}
+		else if( (ev->type == EV_KEY) && !s->dropping )
+		{
+			OnKey(r, s, ev);
+		}
+	}
+}
+
+// reads all there is in `s`; false at its end, or on an error
+static bool ReadSource( EvdevReader* r, EvdevSource* s )
+{
+	struct input_event batch [EVDEV_BATCH];
+	for( ;; )
+	{
+		unsigned partial = s->partial;
+		memcpy(batch, s->pending, partial);
+		ssize_t n = read(s->fd, (uint8_t*)batch + partial, sizeof(batch) - partial);
+		if( n < 0 )
+		{
+			if( errno == EINTR )  continue;
+			if( (errno == EAGAIN) || (errno == EWOULDBLOCK) )  return true;
+			return LOG("read: %s", strerror(errno)), false;   // e.g. ENODEV: unplugged
+		}
+		if( n == 0 )  return false;
+
+		++r->stats.reads;
+		size_t bytes = partial + (size_t)n;
+		size_t count = bytes / sizeof(batch[0]);
+		s->partial = bytes % sizeof(batch[0]);
+		memcpy(s->pending, (uint8_t*)batch + count * sizeof(batch[0]), s->partial);
+		Feed(r, s, batch, count);
+
+		// a short read has taken all there was, but for a regular file, which goes on to its end
+		if( !s->regular && (bytes < sizeof(batch)) )  return true;
+	}
+}
+
+bool EvdevWait( EvdevReader* r, int timeout_ms )
+{
+	if( r->nsources == 0 )  return false;
+
+	struct epoll_event ready [EVDEV_MAX_SOURCES];
+	int n = 0;
+	if( r->nsources > r->nregular )
+	{
+		n = epoll_wait(r->epoll_fd, ready, COUNTOF(ready), r->nregular ? 0 : timeout_ms);
+		if( n < 0 )  return (errno == EINTR) ? true : (LOG("epoll_wait: %s", strerror(errno)), false);
+	}
+	if( (n > 0) || (r->nregular > 0) )  ++r->stats.wakeups;
+
+	for( int k = 0; k < n; ++k )
+	{
+		for( unsigned i = 0; i < r->nsources; ++i )
+		{
+			if( r->sources[i].fd != ready[k].data.fd )  continue;
+			if( !ReadSource(r, &r->sources[i]) )  RemoveSource(r, i);
+			break;
+		}
+	}
+	for( unsigned i = r->nsources; i-- > 0; )
+	{
+		if( r->sources[i].regular && !ReadSource(r, &r->sources[i]) )  RemoveSource(r, i);
+	}
+	return (r->nsources > 0);
+}
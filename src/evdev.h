@@ -0,0 +1,102 @@
+#ifndef EVDEV_H
+#define EVDEV_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <linux/input.h>
+#include "tapdetect.h"
+
+// The keyboard input of Linux: the `struct input_event`s of evdev devices
+// (/dev/input/event*), read in batches from the descriptors an epoll instance reports
+// ready, and fed to the tap detector with the kernel's timestamps; what the low-level
+// keyboard hook (kbswhook.c) is on Windows.
+//
+// Any descriptor that delivers input_events will do: a device, a pipe or a FIFO fed
+// with a recorded trace (`cat /dev/input/eventN > trace`), or a regular file. Events
+// split between reads are put together again. When the kernel drops events
+// (SYN_DROPPED), the rest of that report is skipped and the state of that device is
+// resynced. The modifiers are kept per device, and a modifier held on any of them
+// counts. The devices are asked for CLOCK_MONOTONIC timestamps, which the clock being
+// set does not make jump.
+//
+// Everything runs on the thread that calls EvdevWait.
+
+enum
+{
+	EVDEV_MAX_KEYS = 8,
+	EVDEV_MAX_SOURCES = 32,
+	EVDEV_BATCH = 64,   // events per read()
+};
+
+typedef struct
+{
+	unsigned  tap_timeout_ms;
+	unsigned  nkeys;
+	uint16_t  codes [EVDEV_MAX_KEYS];   // KEY_xxx of the switch keys
+} EvdevConfig;
+
+typedef struct
+{
+	// the switch key `index` has been double-tapped
+	void (*activate)( void* ctx, unsigned index, bool any_modifier_pressed );
+	void* ctx;
+} EvdevHost;
+
+typedef struct
+{
+	uint64_t  events;        // input_events read, of any type
+	uint64_t  keystrokes;    // key presses, not counting the autorepeats
+	uint64_t  wakeups;       // returns of epoll_wait with something to read
+	uint64_t  reads;         // read() calls that returned something
+	uint64_t  activations;
+	uint64_t  dropped;       // SYN_DROPPED reports: the kernel's buffer had overflowed
+} EvdevStats;
+
+typedef struct
+{
+	int       fd;
+	bool      regular;       // a regular file, which epoll does not take: always ready
+	bool      dropping;      // after SYN_DROPPED, until the next SYN_REPORT
+	uint8_t   modifiers;     // a bit for each of the modifier keys held down on this one
+	unsigned  partial;       // bytes of an incomplete event read so far
+	uint8_t   pending [sizeof(struct input_event)];
+} EvdevSource;
+
+typedef struct
+{
+	EvdevConfig  config;
+	EvdevHost    host;
+	TapDetector  tap;
+	int          epoll_fd;
+	unsigned     nsources;
+	unsigned     nregular;
+	EvdevSource  sources [EVDEV_MAX_SOURCES];
+	EvdevStats   stats;
+} EvdevReader;
+
+
+// ---- provided by evdev.c ----------------------------------------------------
+
+bool EvdevInit( EvdevReader* r, const EvdevHost* host );
+// Closes the sources too.
+void EvdevClose( EvdevReader* r );
+
+// Effective from the next event; a sequence under way is broken.
+void EvdevConfigure( EvdevReader* r, const EvdevConfig* config );
+
+// Adds a descriptor to read from, which the reader takes over (and closes at its end
+// of file, on an error, or in EvdevClose).
+bool EvdevAddFd( EvdevReader* r, int fd );
+// Adds the devices under /dev/input that have letter keys; returns how many.
+unsigned EvdevOpenKeyboards( EvdevReader* r );
+
+// Waits up to `timeout_ms` (-1: for as long as it takes) for events, and handles
+// everything there is to read; returns false on an error, or when there is nothing
+// left to read from.
+bool EvdevWait( EvdevReader* r, int timeout_ms );
+
+// KEY_xxx of a switch key name of the command line (LC, LCtrl, LeftCtrl, ...), or 0.
+uint16_t EvdevKeyCode( const char* name, size_t length );
+
+#endif
@@ -0,0 +1,89 @@
+// The per-focus-target layout cache.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "focuscache.h"
+
+void FocusCacheInit( FocusCache* cache )
+{
+	memset(cache, 0, sizeof(*cache));
+}
+
+void FocusCacheClear( FocusCache* cache )
+{
+	memset(cache->entries, 0, sizeof(cache->entries));
+}
+
+static FocusEntry* Find( FocusCache* cache, uintptr_t target )
+{
+	if( target == 0 )  return NULL;
+	for( unsigned i = 0; i < FOCUS_CACHE_SIZE; ++i )
+	{
+		if( cache->entries[i].target == target )  return &cache->entries[i];
+	}
+	return NULL;
+}
+
+uintptr_t FocusCacheLookup( FocusCache* cache, uintptr_t target, uintptr_t app )
+{
+	FocusEntry* e = Find(cache, target);
+	if( e && (e->app != app) )  memset(e, 0, sizeof(*e)), e = NULL;
+	if( e == NULL )  return ++cache->nmisses, 0;
+
+	++cache->nhits;
+	e->last_used = ++cache->clock;
+	return e->layout;
+}
+
+uintptr_t FocusCacheAppLayout( FocusCache* cache, uintptr_t app )
+{
+	const FocusEntry* best = NULL;
+	for( unsigned i = 0; i < FOCUS_CACHE_SIZE; ++i )
+	{
+		const FocusEntry* e = &cache->entries[i];
+		if( e->target && (e->app == app) && (!best || (int)(e->last_used - best->last_used) > 0) )
+			best = e;
+	}
+	return best ? best->layout : 0;
+}
+
+void FocusCacheStore( FocusCache* cache, uintptr_t target, uintptr_t app, uintptr_t layout )
+{
+	if( target == 0 )  return;
+
+	FocusEntry* e = Find(cache, target);
+	if( e == NULL )
+	{
+		// an unused entry, or else the least recently used one
+		e = &cache->entries[0];
+		for( unsigned i = 0; (i < FOCUS_CACHE_SIZE) && e->target; ++i )
+		{
+			FocusEntry* c = &cache->entries[i];
+			if( !c->target || (int)(c->last_used - e->last_used) < 0 )  e = c;
+		}
+		if( e->target )  ++cache->nevictions;
+	}
+
+	e->target = target;
+	e->app = app;
+	e->layout = layout;
+	e->last_used = ++cache->clock;
+}
+
+void FocusCacheForgetTarget( FocusCache* cache, uintptr_t target )
+{
+	FocusEntry* e = Find(cache, target);
+	if( e )  memset(e, 0, sizeof(*e));
+}
+
+unsigned FocusCacheRetainLayouts( FocusCache* cache, bool (*installed)( void* ctx, uintptr_t layout ), void* ctx )
+{
+	unsigned dropped = 0;
+	for( unsigned i = 0; i < FOCUS_CACHE_SIZE; ++i )
+	{
+		FocusEntry* e = &cache->entries[i];
+		if( e->target && !installed(ctx, e->layout) )  memset(e, 0, sizeof(*e)), ++dropped;
+	}
+	return dropped;
+}
@@ -0,0 +1,63 @@
+#ifndef FOCUSCACHE_H
+#define FOCUSCACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Remembers the keyboard layout last applied to (or seen in) each focus target,
+// so that a switch to the layout a window already has can be skipped: some apps
+// re-layout their whole UI on every WM_INPUTLANGCHANGEREQUEST.
+//
+// It also lets the app restore the layout an application had last when it gets
+// the focus back: each entry knows the application (process) of its window.
+//
+// A fixed number of entries, the least recently used one is evicted. Entries of
+// destroyed windows are not tracked down: they age out, and one whose handle has been
+// reused by a window of another application is dropped when it is looked up. When the
+// set of installed layouts changes, only the entries of the layouts gone are dropped
+// (FocusCacheRetainLayouts), so the rest of what is remembered per app survives. The
+// cache can't see layout changes made by other means (the system hotkey, the language
+// bar), so its answer is a hint to be checked against the actual layout before
+// skipping anything.
+
+enum { FOCUS_CACHE_SIZE = 32 };
+
+typedef struct
+{
+	uintptr_t  target;      // HWND on Windows; 0 marks an unused entry
+	uintptr_t  app;         // process id on Windows
+	uintptr_t  layout;      // HKL on Windows
+	unsigned   last_used;   // for the LRU eviction
+} FocusEntry;
+
+typedef struct
+{
+	FocusEntry  entries [FOCUS_CACHE_SIZE];
+	unsigned    clock;
+
+	// for diagnostics
+	unsigned    nhits;
+	unsigned    nmisses;
+	unsigned    nevictions;
+} FocusCache;
+
+
+// ---- provided by focuscache.c -----------------------------------------------
+
+void FocusCacheInit( FocusCache* cache );
+void FocusCacheClear( FocusCache* cache );
+
+// Returns the layout remembered for `target`, or 0; and 0 if the entry was made for a
+// window of another app than `app` (the handle reused), which is then dropped.
+uintptr_t FocusCacheLookup( FocusCache* cache, uintptr_t target, uintptr_t app );
+
+// Returns the layout most recently remembered for any window of `app`, or 0.
+uintptr_t FocusCacheAppLayout( FocusCache* cache, uintptr_t app );
+
+void FocusCacheStore( FocusCache* cache, uintptr_t target, uintptr_t app, uintptr_t layout );
+void FocusCacheForgetTarget( FocusCache* cache, uintptr_t target );
+
+// Drops the entries whose layout `installed` says is no longer there; returns how many.
+unsigned FocusCacheRetainLayouts( FocusCache* cache, bool (*installed)( void* ctx, uintptr_t layout ), void* ctx );
+
+#endif
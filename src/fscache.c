@@ -0,0 +1,37 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "fscache.h"
+
+void FullscreenCacheInit( FullscreenCache* cache, const FullscreenSource* source, uint32_t ttl_ms )
+{
+	*cache = (FullscreenCache){ .source = *source, .ttl_ms = ttl_ms };
+}
+
+void FullscreenCacheInvalidate( FullscreenCache* cache )
+{
+	cache->valid = false;
+}
+
+static bool IsFresh( const FullscreenCache* cache )
+{
+	if( !cache->valid )  return false;
+	uint32_t age_ms = cache->source.now_ms(cache->source.ctx) - cache->fetched_ms;
+	return age_ms < cache->ttl_ms;
+}
+
+void FullscreenCacheRefresh( FullscreenCache* cache )
+{
+	if( IsFresh(cache) )  return;
+
+	bool fullscreen = false;
+	++cache->nqueries;
+	cache->valid = cache->source.query(cache->source.ctx, &fullscreen);
+	cache->fullscreen = cache->valid && fullscreen;
+	cache->fetched_ms = cache->source.now_ms(cache->source.ctx);
+}
+
+bool FullscreenCacheGet( FullscreenCache* cache )
+{
+	FullscreenCacheRefresh(cache);
+	return cache->fullscreen;
+}
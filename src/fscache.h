@@ -0,0 +1,46 @@
+#ifndef FSCACHE_H
+#define FSCACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// A cache for the "is a fullscreen app (likely a game) running?" check, which is too
+// slow to query on every layout switch activation.
+//
+// The cached answer is dropped when the foreground window or the display configuration
+// changes (the app calls FullscreenCacheInvalidate from its notification handlers),
+// and in any case after `ttl_ms`. It is re-fetched from the source on the first
+// FullscreenCacheRefresh/FullscreenCacheGet after that.
+
+typedef struct
+{
+	uint32_t (*now_ms)( void* ctx );                    // a wrapping millisecond clock
+	bool     (*query)( void* ctx, bool* pfullscreen );  // returns false on failure
+	void*    ctx;
+} FullscreenSource;
+
+typedef struct
+{
+	FullscreenSource  source;
+	uint32_t          ttl_ms;
+	uint32_t          fetched_ms;
+	bool              valid;
+	bool              fullscreen;
+	unsigned          nqueries;    // for diagnostics
+} FullscreenCache;
+
+
+void FullscreenCacheInit( FullscreenCache* cache, const FullscreenSource* source, uint32_t ttl_ms );
+
+// Forgets the cached answer.
+void FullscreenCacheInvalidate( FullscreenCache* cache );
+
+// Re-fetches the answer if it is missing or expired; meant to be called ahead
+// of time (e.g. right after an invalidation) to keep FullscreenCacheGet cheap.
+void FullscreenCacheRefresh( FullscreenCache* cache );
+
+// Returns the cached answer, refreshing it first if needed.
+// If the source fails, reports "not fullscreen" and doesn't cache that.
+bool FullscreenCacheGet( FullscreenCache* cache );
+
+#endif
@@ -0,0 +1,54 @@
+// The extended grapheme cluster boundaries (see grapheme.h), by the rules of UAX #29.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "grapheme.h"
+#include "graphemetab.h"
+
+GraphemeBreak GraphemeBreakOf( uint32_t cp )
+{
+	if( cp >= 0x110000 )  return gbOther;
+	uint8_t pair = kGraphemeBlocks[kGraphemeIndex[cp >> GRAPHEME_BLOCK_SHIFT]]
+	                              [(cp & ((1 << GRAPHEME_BLOCK_SHIFT) - 1)) >> 1];
+	return (GraphemeBreak)((cp & 1) ? (pair >> 4) : (pair & 0xF));
+}
+
+static bool IsBoundary( const GraphemeState* st, GraphemeBreak prev, GraphemeBreak next )
+{
+	if( (prev == gbCR) && (next == gbLF) )  return false;                                     // GB3
+	if( (prev == gbCR) || (prev == gbLF) || (prev == gbControl) )  return true;              // GB4
+	if( (next == gbCR) || (next == gbLF) || (next == gbControl) )  return true;              // GB5
+
+	switch( prev )                                                                            // GB6-8
+	{
+		case gbL:   if( (next == gbL) || (next == gbV) || (next == gbLV) || (next == gbLVT) )  return false;  break;
+		case gbLV:
+		case gbV:   if( (next == gbV) || (next == gbT) )  return false;  break;
+		case gbLVT:
+		case gbT:   if( next == gbT )  return false;  break;
+		default:    break;
+	}
+
+	if( (next == gbExtend) || (next == gbZWJ) || (next == gbSpacingMark) )  return false;   // GB9, 9a
+	if( prev == gbPrepend )  return false;                                                   // GB9b
+	if( (prev == gbZWJ) && (next == gbExtendedPictographic) && st->pictographic )  return false;  // GB11
+	if( (prev == gbRegionalIndicator) && (next == gbRegionalIndicator) && st->odd_ri )  return false;  // GB12, 13
+	return true;                                                                              // GB999
+}
+
+bool GraphemeIsBoundary( GraphemeState* st, uint32_t codepoint )
+{
+	GraphemeBreak next = GraphemeBreakOf(codepoint);
+	bool boundary = !st->started || IsBoundary(st, (GraphemeBreak)st->prev, next);
+
+	// keep track of what the rules GB11-13 look back at
+	if( next == gbExtendedPictographic )
+		st->pictographic = true;
+	else if( ((next != gbExtend) && (next != gbZWJ)) || (st->prev == gbZWJ) )
+		st->pictographic = false;
+
+	st->odd_ri = (next == gbRegionalIndicator) && !(st->odd_ri && !boundary);
+	st->prev = next;
+	st->started = true;
+	return boundary;
+}
@@ -0,0 +1,52 @@
+#ifndef GRAPHEME_H
+#define GRAPHEME_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Extended grapheme clusters (UAX #29): what the user sees as one character, e.g. a letter
+// with combining marks, a flag, or an emoji ZWJ sequence.
+//
+// The property lookup is a two-level table (graphemetab.h), generated from the UCD files
+// by tools/ucdgen.c.
+
+// the Grapheme_Cluster_Break property values, plus Extended_Pictographic (which is
+// only ever assigned to characters that are Other otherwise)
+typedef enum
+{
+	gbOther,
+	gbCR,
+	gbLF,
+	gbControl,
+	gbExtend,
+	gbZWJ,
+	gbRegionalIndicator,
+	gbPrepend,
+	gbSpacingMark,
+	gbL,
+	gbV,
+	gbT,
+	gbLV,
+	gbLVT,
+	gbExtendedPictographic,
+	GRAPHEME_BREAK_VALUES
+} GraphemeBreak;
+
+typedef struct
+{
+	uint8_t  prev;          // GraphemeBreak of the previous codepoint
+	bool     started;       // seen a codepoint yet
+	bool     pictographic;  // after Extended_Pictographic Extend*, maybe ZWJ (rule GB11)
+	bool     odd_ri;        // after an odd number of Regional_Indicators in a row (GB12/13)
+} GraphemeState;
+
+
+// ---- provided by grapheme.c -------------------------------------------------
+
+GraphemeBreak GraphemeBreakOf( uint32_t codepoint );
+
+// The segmenter: feed it the codepoints in turn, starting from a zeroed state; returns true
+// if there is a cluster boundary before `codepoint` (always true for the first one).
+bool GraphemeIsBoundary( GraphemeState* state, uint32_t codepoint );
+
+#endif
@@ -0,0 +1,515 @@
+// The hexadecimal <-> Unicode translators.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "hex.h"
+#include "grapheme.h"
+#include "common.h"
+
+#define UNICODE_CODESPACE_END  0x110000
+#define UNICODE_BMP_END        0x010000
+
+#define IS_HIGH_SURROGATE_UNIT(u)  (((u) & 0xFC00) == 0xD800)
+#define IS_LOW_SURROGATE_UNIT(u)   (((u) & 0xFC00) == 0xDC00)
+
+enum { HEX_MAX_DIGITS = 8 };
+
+static int HexDigitValue( UTF16 u )
+{
+	if( (u >= '0') && (u <= '9') )  return u - '0';
+	if( (u >= 'a') && (u <= 'f') )  return u - 'a' + 10;
+	if( (u >= 'A') && (u <= 'F') )  return u - 'A' + 10;
+	return -1;
+}
+
+static void EmitCodepoint( TrStage* stage, uint32_t u )
+{
+	if( u < UNICODE_BMP_END )
+	{
+		TrEmit(stage, (UTF16)u);
+	}
+	else
+	{
+		u -= UNICODE_BMP_END;
+		TrEmit(stage, (UTF16)(0xD800 + ((u >> 10) & 0x3FF)));
+		TrEmit(stage, (UTF16)(0xDC00 + (u & 0x3FF)));
+	}
+}
+
+// ---- HEX --------------------------------------------------------------------
+
+// The notations recognized, as the states of the parser: what has been seen so far.
+typedef enum
+{
+	hnNone,
+	hnU,             // U
+	hnUPlus,         // U+      then 1..8 hex digits
+	hnBackslash,     // a backslash
+	hnBackslashU4,   // \u      then exactly 4 hex digits
+	hnBackslashU8,   // \U      then exactly 8 hex digits
+	hnZero,          // 0       (not in the middle of a word or a number)
+	hnZeroX,         // 0x      then 1..8 hex digits
+	hnAmp,           // &
+	hnAmpHash,       // &#
+	hnAmpHashX,      // &#x     then 1..8 hex digits and ;
+	hnAmpHashDec,    // &#      then 1..7 decimal digits and ;
+} HexNotation;
+
+enum
+{
+	HEX_MAX_ESCAPE = 12,   // &#xXXXXXXXX;
+	HEX_MAX_DECIMAL_DIGITS = 7,
+};
+
+typedef struct
+{
+	// the escape being parsed, after the one of a high surrogate waiting for its pair (if any)
+	UTF16     held [2 * HEX_MAX_ESCAPE];
+	uint8_t   nheld;
+	uint8_t   high_length;   // of the high surrogate's escape in `held`; 0 if none
+	uint8_t   notation;      // HexNotation
+	uint8_t   ndigits;
+	UTF16     high;
+	UTF16     prev;          // the unit before the escape
+	uint32_t  value;
+} HexDecodeState;
+
+static_assert(sizeof(HexDecodeState) <= TR_STATE_SIZE, "HexDecodeState doesn't fit in a stage");
+
+static bool IsTrigger( UTF16 u )
+{
+	return (u == 'U') || (u == '\\') || (u == '0') || (u == '&');
+}
+
+static bool IsWordUnit( UTF16 u )
+{
+	return ((u >= '0') && (u <= '9')) || ((u | 0x20) >= 'a' && (u | 0x20) <= 'z') || (u == '_');
+}
+
+// the index of the first unit that can start an escape, or `n`
+static size_t FindTrigger( const UTF16* p, size_t n )
+{
+	size_t i = 0;
+#ifdef __SSE2__
+	const __m128i backslash = _mm_set1_epi16('\\'), amp = _mm_set1_epi16('&');
+	const __m128i zero = _mm_set1_epi16('0'), u = _mm_set1_epi16('U');
+	for( ; i + 8 <= n; i += 8 )
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+		__m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(v, backslash), _mm_cmpeq_epi16(v, amp)),
+		                            _mm_or_si128(_mm_cmpeq_epi16(v, zero), _mm_cmpeq_epi16(v, u)));
+		unsigned mask = _mm_movemask_epi8(hits);
+		if( mask )  return i + __builtin_ctz(mask) / 2;
+	}
+#endif
+	for( ; i < n; ++i )
+	{
+		if( IsTrigger(p[i]) )  return i;
+	}
+	return n;
+}
+
+static size_t HexDecodeMaxOutput( size_t n )
+{
+	// any escape converts to a shorter sequence (1 or 2 units)
+	// worst case: no escapes, input is copied as is
+	return n;
+}
+
+static void HexDecodeInit( void* state, const void* _ )
+{
+	memset(state, 0, sizeof(HexDecodeState));
+}
+
+static void Hold( HexDecodeState* st, UTF16 u, HexNotation notation )
+{
+	if( st->nheld < COUNTOF(st->held) )  st->held[st->nheld++] = u;
+	st->notation = notation;
+}
+
+static void ResetEscape( HexDecodeState* st )
+{
+	st->notation = hnNone;
+	st->ndigits = 0;
+	st->value = 0;
+}
+
+// passes the units held from `from` on as they are
+static void Release( TrStage* stage, HexDecodeState* st, unsigned from )
+{
+	if( from < st->nheld )
+	{
+		TrEmitRun(stage, st->held + from, st->nheld - from);
+		st->prev = st->held[st->nheld - 1];
+	}
+	st->nheld = from;
+}
+
+// not an escape after all
+static void Reject( TrStage* stage, HexDecodeState* st )
+{
+	Release(stage, st, 0);
+	st->high_length = 0;
+	ResetEscape(st);
+}
+
+// a lone high surrogate is left as it was written
+static void RejectHigh( TrStage* stage, HexDecodeState* st )
+{
+	if( st->high_length == 0 )  return;
+
+	TrEmitRun(stage, st->held, st->high_length);
+	st->prev = st->held[st->high_length - 1];
+	memmove(st->held, st->held + st->high_length, (st->nheld - st->high_length) * sizeof(UTF16));
+	st->nheld -= st->high_length;
+	st->high_length = 0;
+}
+
+static void Complete( TrStage* stage, HexDecodeState* st )
+{
+	uint32_t u = st->value;
+	if( (u == 0) || (u >= UNICODE_CODESPACE_END) || (IS_LOW_SURROGATE_UNIT(u) && (st->high_length == 0)) )
+		return Reject(stage, st);
+
+	if( IS_HIGH_SURROGATE_UNIT(u) )
+	{
+		// wait for the low one: JSON and such write the characters outside the BMP as two escapes
+		RejectHigh(stage, st);
+		st->high = (UTF16)u;
+		st->high_length = st->nheld;
+		ResetEscape(st);
+		return;
+	}
+
+	if( IS_LOW_SURROGATE_UNIT(u) )
+	{
+		TrEmit(stage, st->high);
+		TrEmit(stage, (UTF16)u);
+	}
+	else
+	{
+		RejectHigh(stage, st);
+		EmitCodepoint(stage, u);
+	}
+	st->prev = st->held[st->nheld - 1];
+	st->nheld = 0;
+	st->high_length = 0;
+	ResetEscape(st);
+}
+
+// returns false if `u` is not a digit, or there are too many of them
+static bool AddDigit( HexDecodeState* st, UTF16 u, unsigned base, unsigned max_digits )
+{
+	int d = HexDigitValue(u);
+	if( (d < 0) || (d >= base) || (st->ndigits == max_digits) )  return false;
+
+	st->value = st->value * base + d;
+	++st->ndigits;
+	Hold(st, u, st->notation);
+	return true;
+}
+
+// Returns false if `u` doesn't continue the escape being parsed; it is then
+// to be fed again, as what ended the escape may start a new one.
+static bool Parse( TrStage* stage, HexDecodeState* st, UTF16 u )
+{
+	switch( (HexNotation) st->notation )
+	{
+		case hnNone:
+			if( (u == 'U') || (u == '\\') || (u == '&') || ((u == '0') && !IsWordUnit(st->prev)) )
+			{
+				Hold(st, u, (u == 'U') ? hnU : (u == '\\') ? hnBackslash : (u == '&') ? hnAmp : hnZero);
+				return true;
+			}
+			RejectHigh(stage, st);
+			TrEmit(stage, u);
+			st->prev = u;
+			return true;
+
+		case hnU:
+			if( u != '+' )  return false;
+			Hold(st, u, hnUPlus);
+			return true;
+
+		case hnBackslash:
+			if( u == '\\' )  // an escaped backslash: what follows is not an escape
+			{
+				Hold(st, u, hnBackslash);
+				Reject(stage, st);
+				return true;
+			}
+			if( (u != 'u') && (u != 'U') )  return false;
+			Hold(st, u, (u == 'u') ? hnBackslashU4 : hnBackslashU8);
+			return true;
+
+		case hnZero:
+			if( (u != 'x') && (u != 'X') )  return false;
+			Hold(st, u, hnZeroX);
+			return true;
+
+		case hnAmp:
+			if( u != '#' )  return false;
+			Hold(st, u, hnAmpHash);
+			return true;
+
+		case hnAmpHash:
+			if( (u == 'x') || (u == 'X') )
+			{
+				Hold(st, u, hnAmpHashX);
+				return true;
+			}
+			st->notation = hnAmpHashDec;
+			return AddDigit(st, u, 10, HEX_MAX_DECIMAL_DIGITS);
+
+		case hnBackslashU4:
+		case hnBackslashU8:
+		{
+			unsigned ndigits = (st->notation == hnBackslashU4) ? 4 : 8;
+			if( !AddDigit(st, u, 16, ndigits) )  return false;
+			if( st->ndigits == ndigits )  Complete(stage, st);
+			return true;
+		}
+
+		case hnUPlus:
+		case hnZeroX:
+			if( AddDigit(st, u, 16, HEX_MAX_DIGITS) )  return true;
+			if( (st->ndigits == 0) || (HexDigitValue(u) >= 0) )  return false;
+			Complete(stage, st);
+			return false;  // not a part of the escape
+
+		case hnAmpHashX:
+		case hnAmpHashDec:
+			if( AddDigit(st, u, (st->notation == hnAmpHashX) ? 16 : 10,
+			             (st->notation == hnAmpHashX) ? HEX_MAX_DIGITS : HEX_MAX_DECIMAL_DIGITS) )
+				return true;
+			if( (u != ';') || (st->ndigits == 0) )  return false;
+			Hold(st, u, st->notation);
+			Complete(stage, st);
+			return true;
+	}
+	return false;
+}
+
+static void HexDecodeFeed( TrStage* stage, UTF16 u )
+{
+	HexDecodeState* st = TR_STATE(stage, HexDecodeState);
+
+	if( u == 0 )
+	{
+		// the end of the input ends the escapes of variable length too
+		if( ((st->notation == hnUPlus) || (st->notation == hnZeroX)) && st->ndigits )  Complete(stage, st);
+		Reject(stage, st);
+		return;
+	}
+
+	if( Parse(stage, st, u) )  return;
+
+	if( st->notation != hnNone )  Reject(stage, st);
+	Parse(stage, st, u);  // always takes it when not in an escape
+}
+
+static void HexDecodeFeedRun( TrStage* stage, const UTF16* units, size_t n )
+{
+	HexDecodeState* st = TR_STATE(stage, HexDecodeState);
+	for( size_t i = 0; i < n; )
+	{
+		if( (st->notation == hnNone) && (st->high_length == 0) )
+		{
+			// copy the text up to a possible escape as is
+			size_t k = i + FindTrigger(units + i, n - i);
+			if( k > i )
+			{
+				TrEmitRun(stage, units + i, k - i);
+				st->prev = units[k - 1];
+				i = k;
+				if( i == n )  break;
+			}
+		}
+		HexDecodeFeed(stage, units[i++]);
+	}
+}
+
+const TranslatorClass kHexToUnicode =
+{
+	.name = "HEX",
+	.inverse = "UHEX",
+	.description = "U+XXXX, \\uXXXX, 0xXX, &#xXX; and such to characters",
+	.max_output = HexDecodeMaxOutput,
+	.init = HexDecodeInit,
+	.feed = HexDecodeFeed,
+	.feed_run = HexDecodeFeedRun,
+};
+
+// ---- UHEX -------------------------------------------------------------------
+
+typedef struct
+{
+	UTF16  high;   // a high surrogate waiting for its pair
+} HexEncodeState;
+
+static size_t HexEncodeMaxOutput( size_t n )
+{
+	// character itself, plus '=U+', plus the trailing ' ', plus up to 6 digits for the codepoint
+	return n * (1 + 3 + 1 + 6);
+}
+
+static void HexEncodeInit( void* state, const void* _ )
+{
+	memset(state, 0, sizeof(HexEncodeState));
+}
+
+// U+XXXX
+static void EmitHexCode( TrStage* stage, uint32_t u )
+{
+	static const char kDigits [] = "0123456789ABCDEF";
+	TrEmit(stage, 'U');
+	TrEmit(stage, '+');
+
+	int shift = 20;
+	while( (shift > 4) && ((u >> shift) == 0) )  shift -= 4;  // at least 2 digits, as "%02X"
+	for( ; shift >= 0; shift -= 4 )
+	{
+		TrEmit(stage, kDigits[(u >> shift) & 0xF]);
+	}
+}
+
+// =U+XXXX and a space, after the character
+static void EmitAnnotation( TrStage* stage, uint32_t u )
+{
+	TrEmit(stage, '=');
+	EmitHexCode(stage, u);
+	TrEmit(stage, ' ');
+}
+
+static void HexEncodeFeed( TrStage* stage, UTF16 u )
+{
+	HexEncodeState* st = TR_STATE(stage, HexEncodeState);
+
+	if( st->high )
+	{
+		UTF16 high = st->high;
+		st->high = 0;
+		TrEmit(stage, high);
+		if( IS_LOW_SURROGATE_UNIT(u) )
+		{
+			TrEmit(stage, u);
+			EmitAnnotation(stage, ((uint32_t)(high - 0xD800) << 10) + (u - 0xDC00) + UNICODE_BMP_END);
+			return;
+		}
+		EmitAnnotation(stage, high);  // unpaired
+	}
+
+	if( u == 0 )  return;
+	if( IS_HIGH_SURROGATE_UNIT(u) )
+	{
+		st->high = u;
+		return;
+	}
+
+	TrEmit(stage, u);
+	EmitAnnotation(stage, u);
+}
+
+const TranslatorClass kUnicodeToHex =
+{
+	.name = "UHEX",
+	.inverse = "HEX",
+	.description = "characters to c=U+XXXX",
+	.max_output = HexEncodeMaxOutput,
+	.init = HexEncodeInit,
+	.feed = HexEncodeFeed,
+};
+
+// ---- GHEX -------------------------------------------------------------------
+
+enum { CLUSTER_MAX_UNITS = 48 };  // a longer cluster (zalgo text) is split
+
+typedef struct
+{
+	UTF16          units [CLUSTER_MAX_UNITS];   // of the cluster so far
+	uint8_t        nunits;
+	UTF16          high;                        // a high surrogate waiting for its pair
+	GraphemeState  segmenter;
+} ClusterHexState;
+
+static_assert(sizeof(ClusterHexState) <= TR_STATE_SIZE, "ClusterHexState doesn't fit in a stage");
+
+static void ClusterHexInit( void* state, const void* _ )
+{
+	memset(state, 0, sizeof(ClusterHexState));
+}
+
+// the cluster, '=', the codepoints separated with spaces, and a space
+static void EmitCluster( TrStage* stage, ClusterHexState* st )
+{
+	if( st->nunits == 0 )  return;
+
+	TrEmitRun(stage, st->units, st->nunits);
+	TrEmit(stage, '=');
+	for( unsigned i = 0; i < st->nunits; ++i )
+	{
+		if( i > 0 )  TrEmit(stage, ' ');
+
+		uint32_t u = st->units[i];
+		if( IS_HIGH_SURROGATE_UNIT(u) && (i + 1 < st->nunits) && IS_LOW_SURROGATE_UNIT(st->units[i + 1]) )
+		{
+			u = ((u - 0xD800) << 10) + (st->units[++i] - 0xDC00) + UNICODE_BMP_END;
+		}
+		EmitHexCode(stage, u);
+	}
+	TrEmit(stage, ' ');
+	st->nunits = 0;
+}
+
+static void AddCodepoint( TrStage* stage, ClusterHexState* st, uint32_t u, const UTF16* units, unsigned n )
+{
+	if( GraphemeIsBoundary(&st->segmenter, u) || (st->nunits + n > CLUSTER_MAX_UNITS) )
+		EmitCluster(stage, st);
+
+	for( unsigned i = 0; i < n; ++i )  st->units[st->nunits++] = units[i];
+}
+
+static void ClusterHexFeed( TrStage* stage, UTF16 u )
+{
+	ClusterHexState* st = TR_STATE(stage, ClusterHexState);
+
+	if( st->high )
+	{
+		UTF16 pair [2] = { st->high, u };
+		st->high = 0;
+		if( IS_LOW_SURROGATE_UNIT(u) )
+		{
+			AddCodepoint(stage, st, ((uint32_t)(pair[0] - 0xD800) << 10) + (u - 0xDC00) + UNICODE_BMP_END, pair, 2);
+			return;
+		}
+		AddCodepoint(stage, st, pair[0], pair, 1);  // unpaired
+	}
+
+	if( u == 0 )
+	{
+		EmitCluster(stage, st);
+		return;
+	}
+	if( IS_HIGH_SURROGATE_UNIT(u) )
+	{
+		st->high = u;
+		return;
+	}
+
+	AddCodepoint(stage, st, u, &u, 1);
+}
+
+const TranslatorClass kClusterToHex =
+{
+	.name = "GHEX",
+	.inverse = "HEX",
+	.description = "characters to c=U+XXXX, by grapheme clusters",
+	.max_output = HexEncodeMaxOutput,   // a cluster of several codepoints takes fewer
+	.init = ClusterHexInit,
+	.feed = ClusterHexFeed,
+};
@@ -0,0 +1,20 @@
+#ifndef HEX_H
+#define HEX_H
+
+#include "translate.h"
+
+// ---- provided by hex.c ------------------------------------------------------
+
+// "HEX": replaces the codepoint escapes with the characters; copies the rest as is. Understands
+// U+XXXX and 0xXXXX (1 to 8 hex digits, any case), \uXXXX, \UXXXXXXXX, &#xXXXX; and &#DDDD;
+// (the characters outside the BMP may also be written as two escapes of UTF-16 surrogates).
+// Scans for the start of an escape with SSE2 where available.
+extern const TranslatorClass kHexToUnicode;
+
+// "UHEX": replaces each character c with 'c=U+XXXX '.
+extern const TranslatorClass kUnicodeToHex;
+
+// "GHEX": the same for each grapheme cluster: '👩‍💻=U+1F469 U+200D U+1F4BB '.
+extern const TranslatorClass kClusterToHex;
+
+#endif
@@ -0,0 +1,94 @@
+// The watchdog of the keyboard hook (see hookwatch.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "hookwatch.h"
+#include "common.h"
+
+void HookWatchInit( HookWatchdog* w, const HookWatchHost* host, const HookWatchConfig* config )
+{
+	memset(w, 0, sizeof(*w));
+	w->host = *host;
+	w->config = *config;
+	w->state = hwHealthy;
+	w->event_ms = w->probe_ms = host->now_ms(host->ctx);
+}
+
+// how long to wait before probing a hook that has been reinstalled `failures` times in vain
+static uint32_t Backoff_ms( const HookWatchdog* w )
+{
+	uint32_t backoff_ms = w->config.period_ms;
+	for( unsigned i = 1; (i < w->failures) && (backoff_ms < w->config.max_backoff_ms); ++i )  backoff_ms *= 2;
+	return (backoff_ms < w->config.max_backoff_ms) ? backoff_ms : w->config.max_backoff_ms;
+}
+
+static void Probe( HookWatchdog* w, HookWatchReason reason, uint32_t now_ms )
+{
+	const HookWatchHost* h = &w->host;
+	w->probe_ms = now_ms;
+	if( !h->send_probe(h->ctx) )
+	{
+		// nothing learnt: the same again after the same wait
+		++w->stats.probes_failed;
+		if( w->state == hwHealthy )  w->event_ms = now_ms, w->unseen = false;
+		return;
+	}
+	++w->stats.probes[reason];
+	w->state = hwProbing;
+	LOG("probing the hook (reason %d)", reason);
+}
+
+void HookWatchTick( HookWatchdog* w, HookPulse* pulse )
+{
+	const HookWatchHost* h = &w->host;
+	uint32_t now_ms = h->now_ms(h->ctx);
+	unsigned events = atomic_load_explicit(&pulse->events, memory_order_relaxed);
+	unsigned probes = atomic_load_explicit(&pulse->probes, memory_order_relaxed);
+	uint32_t worst_us = atomic_exchange_explicit(&pulse->worst_us, 0, memory_order_relaxed);
+	unsigned keyboard = atomic_load_explicit(&pulse->keyboard, memory_order_relaxed);
+	HookWatchStats before = w->stats;
+
+	bool beat = (events != w->events), probed = (probes != w->probes), input = (keyboard != w->keyboard);
+	w->events = events;
+	w->probes = probes;
+	w->keyboard = keyboard;
+	if( beat )  w->event_ms = now_ms;
+	w->unseen = !beat && (w->unseen || input);
+	if( worst_us > w->stats.worst_us )  w->stats.worst_us = worst_us;
+
+	switch( w->state )
+	{
+		case hwHealthy:
+			if( worst_us >= w->config.slow_us )
+				Probe(w, hrSlow, now_ms);
+			else if( w->unseen && (now_ms - w->event_ms >= w->config.unseen_ms) )
+				Probe(w, hrInput, now_ms);
+			break;
+
+		case hwProbing:
+			if( probed )
+			{
+				w->stats.last_probe_ms = now_ms - w->probe_ms;
+				if( w->failures )  LOG("the hook is back, after %u reinstall(s)", w->failures);
+				w->failures = 0;
+				w->state = hwHealthy;
+			}
+			else if( now_ms - w->probe_ms >= w->config.probe_timeout_ms )
+			{
+				LOG("the probe has not come: reinstalling the hook");
+				++w->stats.losses;
+				++w->failures;
+				w->probe_ms = now_ms;
+				w->state = hwReinstalled;
+				h->reinstall(h->ctx);
+			}
+			break;
+
+		case hwReinstalled:
+			if( now_ms - w->probe_ms >= Backoff_ms(w) )  Probe(w, hrReinstalled, now_ms);
+			break;
+	}
+
+	if( memcmp(&before, &w->stats, sizeof(before)) != 0 )  h->changed(h->ctx);
+}
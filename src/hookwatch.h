@@ -0,0 +1,119 @@
+#ifndef HOOKWATCH_H
+#define HOOKWATCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+// The watchdog of the keyboard hook. Windows removes a WH_KEYBOARD_LL hook whose
+// callback once takes longer than LowLevelHooksTimeout, and says nothing: the hook
+// then just sees no more events. The watchdog notices by comparing what the hook sees
+// with the keyboard input the system has seen (counted from raw input): keystrokes that
+// have not reached the hook for a while, or a slow callback, make it inject a probe, an
+// event the hook recognizes and swallows; a probe that does not arrive in time means the
+// hook is gone, and it is reinstalled, then probed again (with a growing interval if that
+// keeps failing).
+//
+// A probe is input, too: it resets the idle timer of the system (the screensaver, the
+// locking, the sleep) and the hooks installed after ours see it. So only keyboard input
+// the hook has missed makes one: neither idle time nor the mouse, which never reaches a
+// keyboard hook, do, and a hook removed during either is found by the first keystrokes.
+//
+// The hook thread only bumps the counters of a HookPulse, with no syscalls, so that it
+// never blocks; the watchdog runs on a thread of its own, ticking every period_ms,
+// and knows nothing of the system: the host gives it the clock and does the probing
+// and the reinstalling (see kbswhook.c, and tools/watchsim.c for a simulated hook).
+
+// Written by the hook thread, read by the watchdog.
+typedef struct
+{
+	atomic_uint  events;     // all the events the callback has seen, the probes included
+	atomic_uint  probes;
+	atomic_uint  worst_us;   // the slowest callback since the last tick
+	atomic_uint  keyboard;   // the keyboard input the system has seen, hooked or not
+} HookPulse;
+
+typedef struct
+{
+	uint32_t  period_ms;        // between the ticks
+	uint32_t  probe_timeout_ms;
+	uint32_t  unseen_ms;        // a probe if there has been keyboard input but no event for this long
+	uint32_t  slow_us;          // a callback this slow may have got the hook removed: probe
+	uint32_t  max_backoff_ms;   // between reinstalls, if they keep failing
+} HookWatchConfig;
+
+#define HOOKWATCH_DEFAULT_CONFIG  { .period_ms = 1000, .probe_timeout_ms = 500, .unseen_ms = 5000, \
+                                    .slow_us = 100000, .max_backoff_ms = 60000 }
+
+typedef struct
+{
+	uint32_t  (*now_ms)( void* ctx );            // a wrapping millisecond clock
+	bool      (*send_probe)( void* ctx );        // false if it could not be injected
+	void      (*reinstall)( void* ctx );         // asks the hook thread to unhook and hook again
+	void      (*changed)( void* ctx );           // the stats have changed
+	void*     ctx;
+} HookWatchHost;
+
+typedef enum
+{
+	hwHealthy,
+	hwProbing,        // a probe is on its way
+	hwReinstalled,    // ... and failed: the hook is being reinstalled, to be probed again
+} HookWatchState;
+
+typedef enum
+{
+	hrInput,          // the system has seen keyboard input the hook has not
+	hrSlow,
+	hrReinstalled,
+	HOOKWATCH_REASONS
+} HookWatchReason;
+
+typedef struct
+{
+	uint64_t  probes [HOOKWATCH_REASONS];   // sent, by why
+	uint64_t  probes_failed;                // could not be sent (e.g. UIPI)
+	uint64_t  losses;                       // probes that did not arrive: the hook reinstalled
+	uint32_t  worst_us;                     // the slowest callback ever
+	uint32_t  last_probe_ms;                // how long the last probe took to arrive
+} HookWatchStats;
+
+typedef struct
+{
+	HookWatchHost    host;
+	HookWatchConfig  config;
+	HookWatchState   state;
+	unsigned         events, probes;        // the pulse, as of the last tick
+	unsigned         keyboard;              // ... and the keyboard input of the system
+	uint32_t         event_ms;              // when the pulse last changed
+	bool             unseen;                // the system has seen keyboard input since then
+	uint32_t         probe_ms;              // when the probe was sent, or the reinstall asked for
+	unsigned         failures;              // reinstalls in a row that have not helped
+	HookWatchStats   stats;
+} HookWatchdog;
+
+
+// ---- provided by hookwatch.c ------------------------------------------------
+
+void HookWatchInit( HookWatchdog* w, const HookWatchHost* host, const HookWatchConfig* config );
+
+// Every period_ms, on the watchdog thread.
+void HookWatchTick( HookWatchdog* w, HookPulse* pulse );
+
+// On the hook thread, at the end of each callback.
+static inline void HookPulseBeat( HookPulse* p, bool probe, uint32_t elapsed_us )
+{
+	atomic_fetch_add_explicit(&p->events, 1, memory_order_relaxed);
+	if( probe )  atomic_fetch_add_explicit(&p->probes, 1, memory_order_relaxed);
+	// only this thread raises it, and the watchdog only resets it
+	if( elapsed_us > atomic_load_explicit(&p->worst_us, memory_order_relaxed) )
+		atomic_store_explicit(&p->worst_us, elapsed_us, memory_order_relaxed);
+}
+
+// On the hook thread, for each keystroke the system has seen, whether the hook has or not.
+static inline void HookPulseKeyboard( HookPulse* p )
+{
+	atomic_fetch_add_explicit(&p->keyboard, 1, memory_order_relaxed);
+}
+
+#endif
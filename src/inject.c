@@ -0,0 +1,56 @@
+// Batches of synthesized key events (see inject.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inject.h"
+
+void InjectBatchInit( InjectBatch* b )
+{
+	b->count = 0;
+	b->overflow = false;
+}
+
+static void Add( InjectBatch* b, uint16_t vk, UTF16 unit )
+{
+	if( b->count + 2 > INJECT_MAX_EVENTS )
+	{
+		b->overflow = true;
+		return;
+	}
+	b->events[b->count++] = (InjectEvent){ .vk = vk, .unit = unit, .up = false };
+	b->events[b->count++] = (InjectEvent){ .vk = vk, .unit = unit, .up = true };
+}
+
+void InjectKey( InjectBatch* b, uint16_t vk, unsigned times )
+{
+	for( unsigned i = 0; i < times; ++i )  Add(b, vk, 0);
+}
+
+void InjectText( InjectBatch* b, const UTF16* text, size_t length )
+{
+	for( size_t i = 0; i < length; ++i )  Add(b, 0, text[i]);
+}
+
+bool InjectSend( const InjectBatch* b, const Injector* injector )
+{
+	if( b->overflow )  return false;
+	return (b->count == 0) || injector->send(injector->ctx, b->events, b->count);
+}
+
+// the characters that editors pair as they are typed
+static bool IsAutoPaired( UTF16 u )
+{
+	return (u == '(') || (u == '[') || (u == '{') || (u == '"') || (u == '\'') || (u == '`');
+}
+
+bool InjectPlanTyping( InjectBatch* b, const UTF16* text, size_t length, bool special_target )
+{
+	InjectBatchInit(b);
+	if( special_target || (length == 0) || (length > INJECT_MAX_TYPED) )  return false;
+	for( size_t i = 0; i < length; ++i )
+	{
+		if( (text[i] < 0x20) || (text[i] == 0x7F) || IsAutoPaired(text[i]) )  return false;
+	}
+	InjectText(b, text, length);
+	return !b->overflow;
+}
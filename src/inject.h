@@ -0,0 +1,70 @@
+#ifndef INJECT_H
+#define INJECT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "translate.h"
+
+// Typing into the focused window with synthesized key events, all of them in one batch:
+// text as characters (a press and a release of each UTF-16 unit, KEYEVENTF_UNICODE on
+// Windows), and keys such as Backspace as themselves. The batch is built here; sending it
+// goes through an Injector (inject_win.c sends it with a single SendInput).
+
+enum
+{
+	INJECT_MAX_EVENTS = 512,
+	INJECT_VK_BACK = 0x08,     // the virtual key codes of Windows
+	INJECT_VK_TAB = 0x09,
+	INJECT_VK_RETURN = 0x0D,
+	INJECT_MAX_TYPED = 64,     // UTF-16 units of a translated selection to type rather than paste
+};
+
+typedef struct
+{
+	uint16_t  vk;     // 0 for a character
+	UTF16     unit;   // of the character
+	bool      up;
+} InjectEvent;
+
+typedef struct
+{
+	InjectEvent  events [INJECT_MAX_EVENTS];
+	size_t       count;
+	bool         overflow;   // some events did not fit; the batch is not to be sent
+} InjectBatch;
+
+typedef struct
+{
+	// Sends all the events at once; false if not all of them went through.
+	bool  (*send)( void* ctx, const InjectEvent* events, size_t count );
+	void*  ctx;
+} Injector;
+
+
+// ---- provided by inject.c ---------------------------------------------------
+
+void InjectBatchInit( InjectBatch* b );
+
+// Presses and releases the key `times` times.
+void InjectKey( InjectBatch* b, uint16_t vk, unsigned times );
+
+void InjectText( InjectBatch* b, const UTF16* text, size_t length );
+
+// False if the batch has overflowed, or not all of it was sent.
+bool InjectSend( const InjectBatch* b, const Injector* injector );
+
+// Plans typing a translated selection over itself, instead of pasting it through the clipboard.
+// True, with the text in the (cleared) batch, if it is up to INJECT_MAX_TYPED units long and
+// safe to type: no control characters (a line break or a tab typed may act as a command), and
+// none of the brackets and quotes that editors close automatically as they are typed.
+// A `special_target` (one that gets special copy/paste keys) always gets a paste.
+bool InjectPlanTyping( InjectBatch* b, const UTF16* text, size_t length, bool special_target );
+
+
+// ---- provided by inject_win.c -----------------------------------------------
+
+// Sends with SendInput; the modifier keys held down are released for the time of it.
+const Injector* SystemInjector( void );
+
+#endif
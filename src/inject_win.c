@@ -0,0 +1,56 @@
+// The Windows Injector: SendInput (see inject.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <windows.h>
+#include "inject.h"
+#include "common.h"
+
+static void SetKey( INPUT* pi, VKEY vk, bool up )
+{
+	memset(pi, 0, sizeof(*pi));
+	pi->type = INPUT_KEYBOARD;
+	pi->ki.wVk = vk;
+	pi->ki.wScan = MapVirtualKeyA(vk, MAPVK_VK_TO_VSC);
+	pi->ki.dwFlags = up ? KEYEVENTF_KEYUP : 0;
+}
+
+static bool Send( void* _, const InjectEvent* events, size_t count )
+{
+	// with the modifiers up around them: e.g. Ctrl+Backspace deletes a whole word
+	static INPUT inputs [INJECT_MAX_EVENTS + 16];
+	VKEY held [16];
+	unsigned nheld = 0, n = 0;
+	for( unsigned i = 0; (kModifierVKeys[i] != 0) && (nheld < COUNTOF(held)); ++i )
+	{
+		if( GetAsyncKeyState(kModifierVKeys[i]) & 0x8000 )  held[nheld++] = kModifierVKeys[i];
+	}
+	if( count + nheld * 2 > COUNTOF(inputs) )  return false;
+
+	for( unsigned i = 0; i < nheld; ++i )  SetKey(&inputs[n++], held[i], true);
+	for( size_t i = 0; i < count; ++i )
+	{
+		INPUT* pi = &inputs[n++];
+		if( events[i].vk )
+		{
+			SetKey(pi, events[i].vk, events[i].up);
+			continue;
+		}
+		memset(pi, 0, sizeof(*pi));
+		pi->type = INPUT_KEYBOARD;
+		pi->ki.wScan = events[i].unit;
+		pi->ki.dwFlags = KEYEVENTF_UNICODE | (events[i].up ? KEYEVENTF_KEYUP : 0);
+	}
+	for( unsigned i = 0; i < nheld; ++i )  SetKey(&inputs[n++], held[i], false);
+
+	UINT sent = SendInput(n, inputs, sizeof(inputs[0]));
+	if( sent != n )  return ERR("SendInput: %u of %u", sent, n), false;
+	return true;
+}
+
+const Injector* SystemInjector( void )
+{
+	static const Injector injector = { Send, NULL };
+	return &injector;
+}
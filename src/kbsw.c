@@ -1,5 +1,9 @@
 // MINGW64:
 // gcc -std=c11 -Wall -Werror -mwindows -O2 -flto -o kbsw.exe kbsw.c kbswhook.c mojibake.c docopt.c monospacebox.c
+//     control.c control_win.c rcu.c stats.c stats_win.c fscache.c layouts.c layouts_win.c
+//     actqueue.c focuscache.c trace.c pipeline.c clipsave.c clipsave_win.c translate.c hex.c
+//     grapheme.c names.c names_win.c translit.c translit_win.c casemap.c keyhist.c livedetect.c
+//     livedetect_win.c retype.c inject.c inject_win.c arena.c tapdetect.c hookwatch.c
 //     -DKBSW_STDOUT -- enable logging to stdout (run from mintty to see the output)
 
 #include "version.h"
@@ -22,20 +26,32 @@ const char kUsage [] =
 	"and LAYOUT codes can be obtained by running\n"
 	"    "PROG" --list-layouts\n"
 	"\n"
-	"A special dummy layout named 'HEX' can be used for Hexadecimal<->Unicode\n"
+	"Instead of a LAYOUT, a KEY can be bound to a text TRANSLATOR, or to a chain\n"
+	"of them applied in turn: KEY=NAME[+NAME...]. The list of TRANSLATORs is\n"
+	"shown by "PROG" --list-layouts too; e.g. 'HEX' does Hexadecimal<->Unicode\n"
 	"conversion (see Usage below).\n"
 	"\n"
 	"You can omit '=LAYOUT' for some or all KEYs; these layouts will be assigned\n"
 	"automatically in the order they appear in --list-layouts.\n"
 	"\n"
+	"If "PROG" is already running, it is reconfigured with the new KEYs\n"
+	"and options instead of starting another copy.\n"
+	"\n"
 	"-t --timeout=300   KEY double-press timeout, in milliseconds\n"
 	"-q --quiet         suppress error messages (only return error code)\n"
 	"-F --fullscreen    do not ignore fullscreen apps\n"
+	"-a --per-app       remember the layout of each app, restore it when the app gets focus\n"
+	"-k --keep-clip     keep the clipboard contents when correcting a selection\n"
+	"-d --detect=off    watch for words typed in a wrong layout: off, beep, or switch\n"
+	"                   (to the layout they are likely meant for; see Usage below)\n"
+	"-w --fix-word      retype the word just typed when switching to another LAYOUT\n"
 	"-x --exit          stop the running copy of "PROG"\n"
 	"-p --pause         make the running instance stop doing anything\n"
 	"-r --resume        make a paused running instance resume working\n"
 	"-s --status        show parameters of the running instance\n"
-	"-l --list-layouts  display installed keyboard layouts\n"
+	"-T --trace         make the running instance record trace events; run again\n"
+	"                   to save them into %TEMP%\\"PROG"-trace.json (chrome://tracing)\n"
+	"-l --list-layouts  display installed keyboard layouts and text translators\n"
 	"-h --help          show this text\n"
 	"\n"
 	"Usage:\n"
@@ -45,25 +61,66 @@ const char kUsage [] =
 	" - To correct some text mistakenly typed in a wrong keyboard layout,\n"
 	"   select it and press the correct layout's KEY quickly twice while\n"
 	"   holding down any other modifier key (such as Shift, Alt, Ctrl).\n"
-	"   This action replaces the clipboard content.\n"
+	"   Unless the correction is short enough to be typed over the selection,\n"
+	"   it replaces the clipboard content (--keep-clip restores it afterwards).\n"
 	"\n"
 	" - To convert hexadecimal Unicode codepoint(s) into character(s),\n"
 	"   for example 'U+0040' to '@', select them and double-tap a KEY\n"
-	"   assigned to the special LAYOUT named 'HEX'.\n"
+	"   assigned to the TRANSLATOR named 'HEX'. It also understands the escapes\n"
+	"   of JSON, C and HTML: \\u0040, \\U00000040, 0x40, &#x40; and &#64;.\n"
 	"\n"
 	" - To do the reverse of the above, select some characters and double-tap a KEY\n"
-	"   assigned to a special LAYOUT 'HEX' while holding down any other modifier key.\n"
+	"   assigned to 'HEX' while holding down any other modifier key. This works\n"
+	"   for any TRANSLATOR (or chain) that can be undone.\n"
+	"\n"
+	" - The TRANSLATOR 'NAME' replaces Unicode character names with the characters,\n"
+	"   for example 'COMMERCIAL AT' with '@', and 'UNAME' does the reverse; a chain\n"
+	"   HEX+UNAME names the codepoints. These need the file kbsw-names.bin next to\n"
+	"   "PROG".exe (see Building in README.md).\n"
+	"\n"
+	" - More TRANSLATORs come from the rule files in the folder 'translit' next\n"
+	"   to "PROG".exe, e.g. RU-GOST and GOST-RU for Russian <-> Latin (GOST 7.79).\n"
+	"   See the files there for the format.\n"
+	"\n"
+	" - Text typed with CapsLock on by mistake ('hELLO wORLD') is fixed by the\n"
+	"   TRANSLATOR 'CASE', which swaps the case of the letters, e.g. with\n"
+	"   CL=CASE. 'CYCLE' turns the selection to UPPER, Title and lower case in turn.\n"
+	"\n"
+	" - With --detect=beep, "PROG" beeps when the word being typed looks like it\n"
+	"   is meant for another of the LAYOUTs bound to the KEYs (in English, Russian,\n"
+	"   Ukrainian, German, French or Spanish); with --detect=switch, it switches\n"
+	"   to that layout. The keys typed are only looked at, never kept.\n"
+	"\n"
+	" - With --fix-word, double-tapping a LAYOUT's KEY right after typing a word\n"
+	"   in another layout retypes the word in that LAYOUT, without selecting it\n"
+	"   or using the clipboard. So is a word followed by spaces, if --detect has\n"
+	"   found it suspicious; and with --detect=switch, the words are fixed as\n"
+	"   they are switched.\n"
 	;
 
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <assert.h>
+#include <stdatomic.h>
 #include <windows.h>
 #include "docopt.h"
 #include "common.h"
+#include "control.h"
+#include "stats.h"
+#include "fscache.h"
+#include "layouts.h"
+#include "actqueue.h"
+#include "focuscache.h"
+#include "trace.h"
 #include "kbswhook.h"
+#include "keyhist.h"
+#include "livedetect.h"
+#include "retype.h"
+#include "inject.h"
 #include "mojibake.h"
+#include "translit.h"
 #include "monospacebox.h"
 
 typedef struct { char str[KL_NAMELENGTH]; } KLID;
@@ -89,26 +146,62 @@ typedef enum
 	cmdRun,
 	cmdResume,
 	cmdPause,
+	cmdTrace,
 	cmdListLayouts,
 	cmdShowStatus,
 	cmdQuit,
 	cmdHelp,
 } Command;
 
-enum { MAX_SWITCHES = 8 };
+typedef enum
+{
+	detectOff,
+	detectBeep,
+	detectSwitch,
+} DetectMode;
+
+enum { MAX_SWITCHES = HOOK_MAX_KEYS };
 
 struct Options
 {
 	Command   command;
 	unsigned  tap_timeout_ms;
 	VKEY      keys     [MAX_SWITCHES];
-	HKL       layouts  [MAX_SWITCHES];    // can be HKL_AUTOASSIGN after parse
+	Translation bindings [MAX_SWITCHES];  // neither a layout nor translators: to be loaded or auto-assigned
+	KLID      klids    [MAX_SWITCHES];    // of the LAYOUTs given by code, loaded by LoadBindings
 	bool      quiet;
 	bool      ignore_fullscreen;
+	bool      per_app_layouts;
+	bool      keep_clipboard;
+	DetectMode detect;
+	bool      fix_word;
 };
 
 static Options gOptions;
 
+// What the hook is configured with: the snapshot of kbswhook.h, and which bindings go with it.
+typedef struct
+{
+	HookConfig  hook;         // first, as kbswhook.h wants it
+	uint32_t    generation;   // of its bindings in gBindings
+} Config;
+
+// The bindings of the latest configurations, by generation. An activation carries the
+// generation the hook matched it against, and runs with those bindings, even if it
+// comes out of the queue after a reconfiguration; the hook's snapshot is gone by then.
+enum { BINDING_GENERATIONS = 4 };
+
+typedef struct
+{
+	uint32_t     generation;   // 0 until loaded
+	Translation  bindings [MAX_SWITCHES];
+} Bindings;
+
+static Bindings  gBindings [BINDING_GENERATIONS];
+static uint32_t  gGeneration;   // of the latest configuration published
+
+static bool      gPaused;
+
 static void MsgBox( const char* text, UINT flag )
 {
 	if( !gOptions.quiet )  MessageBoxA(NULL, text, PROG, MB_OK | flag);
@@ -148,7 +241,7 @@ static VKEY ParseKeyName( const char* keyname, size_t keyname_len )
 // returns the new switch index, or -1 on error
 static int AddLayoutSwitchKey( Options* po, VKEY vk )
 {
-	static_assert(COUNTOF(po->keys) == COUNTOF(po->layouts), "keys & layouts must be of same size");
+	static_assert(COUNTOF(po->keys) == COUNTOF(po->bindings), "keys & bindings must be of same size");
 	for( unsigned i = 0; i < COUNTOF(po->keys); ++i )
 	{
 		if( po->keys[i] == vk )
@@ -163,9 +256,43 @@ static int AddLayoutSwitchKey( Options* po, VKEY vk )
 	return -1; // no room left
 }
 
+// NAME[+NAME...]: a chain of translators; returns false if any of the names is unknown
+static bool ParseTranslators( const char* names, Translation* pt )
+{
+	pt->ntranslators = 0;
+	for( const char* p = names; ; ++p )
+	{
+		size_t len = strcspn(p, "+");
+		const TranslatorClass* cls = TranslatorFind(p, len);
+		if( (cls == NULL) || (pt->ntranslators == TR_MAX_STAGES) )  return false;
+		pt->translators[pt->ntranslators++] = cls;
+
+		p += len;
+		if( *p == 0 )  return true;
+	}
+}
+
+// KLID is an 8-digit hex number, but it is not documented (except its length)
+// so we do not want to rely on that beyond treating leading zeros as not significant
+static bool ParseKlid( const char* val, KLID* pklid )
+{
+	while( *val == '0' )  ++val; // skip the leading zeros
+
+	size_t len = strlen(val);
+	if( (len == 0) || (len >= COUNTOF(pklid->str)) || (strspn(val, "0123456789abcdefABCDEF") != len) )
+		return false;
+	size_t pad = COUNTOF(pklid->str) - 1 - len;
+	memset(pklid->str, '0', pad);
+	memcpy(pklid->str + pad, val, len + 1);
+	return true;
+}
+
+// No layout APIs here: the layouts are loaded by LoadBindings, once they are needed.
+// The translators of the rule files are only loaded for a name that is none of the others.
 static bool ParseNonOptionArg( Options* po, const char* arg )
 {
-	HKL hkl = HKL_AUTOASSIGN;
+	Translation binding = { .layout = NULL, .ntranslators = 0 };
+	KLID klid = {{0}};
 
 	const char* eq = strchr(arg, '=');
 	size_t keyname_len = eq ? eq - arg : strlen(arg);
@@ -173,36 +300,17 @@ static bool ParseNonOptionArg( Options* po, const char* arg )
 	VKEY vk = ParseKeyName(arg, keyname_len);
 	if( vk == 0 )  return false;
 
-	if( eq != NULL )
+	if( (eq != NULL) && !ParseTranslators(eq + 1, &binding) && !ParseKlid(eq + 1, &klid) )
 	{
-		if( strcmp(eq + 1, "HEX") == 0 )
-		{
-			hkl = HKL_HEX_TO_UNICODE;
-		}
-		else
-		{
-			// KLID is an 8-digit hex number, but it is not documented (except its length)
-			// so we do not want to rely on that beyond treating leading zeros as not significant
-
-			const char* val = eq;
-			while( *++val == '0' ); // skip the leading zeros
-
-			KLID klid;
-			unsigned len = strlen(val);
-			unsigned pad = COUNTOF(klid.str) - 1 - len;
-			if( len >= COUNTOF(klid.str) )  return false;
-			memset(klid.str, '0', pad);
-			memcpy(klid.str + pad, val, len + 1);
-
-			hkl = LoadKeyboardLayoutA(klid.str, KLF_SUBSTITUTE_OK);
-			if( hkl == NULL )  return ERR("LoadKeyboardLayout"), false;
-		}
+		TranslitLoad();
+		if( !ParseTranslators(eq + 1, &binding) )  return false;
 	}
 
 	int idx = AddLayoutSwitchKey(po, vk);
 	if( idx < 0 )  return false;
 
-	po->layouts[idx] = hkl;
+	po->bindings[idx] = binding;
+	po->klids[idx] = klid;
 	return true;
 }
 
@@ -217,60 +325,92 @@ bool AppDocOptSetOption( Options* po, char opt, const char* val )
 		case 'l':  cmd = cmdListLayouts; break;
 		case 's':  cmd = cmdShowStatus; break;
 		case 'p':  cmd = cmdPause; break;
+		case 'T':  cmd = cmdTrace; break;
 		case 'r':  cmd = cmdResume; break;
 		case 'x':  cmd = cmdQuit; break;
 		case 'h':  cmd = cmdHelp; break;
 
 		case 'q':  po->quiet = true; break;
 		case 'F':  po->ignore_fullscreen = false; break;
+		case 'a':  po->per_app_layouts = true; break;
+		case 'k':  po->keep_clipboard = true; break;
+		case 'w':  po->fix_word = true; break;
 
 		case 't':
 			po->tap_timeout_ms = atoi(val);
 			break;
 
+		case 'd':
+		{
+			static const char* const modes [] = { [detectOff] = "off", [detectBeep] = "beep", [detectSwitch] = "switch" };
+			size_t len = strcspn(val, " \t\n");
+			unsigned i = 0;
+			while( (i < COUNTOF(modes)) && ((strlen(modes[i]) != len) || (strncmp(val, modes[i], len) != 0)) )  ++i;
+			if( i == COUNTOF(modes) )  return false;
+			po->detect = (DetectMode) i;
+			break;
+		}
+
 		default: return false;
 	}
 	if( cmd > po->command )  po->command = cmd;
 	return true;
 }
 
+static HWND ghMainWindow = NULL;
+
 void AppDocOptReportError( const char* arg )
 {
+	// the running instance only parses command lines on behalf of a control client
+	if( ghMainWindow != NULL )  return LOG("invalid argument: %s", arg);
+
 	char buffer [1024];
 	snprintf(buffer, sizeof(buffer), "Invalid command line argument:\n\n%s", arg);
 	MessageBoxA(NULL, buffer, PROG, MB_OK | MB_ICONERROR);
 }
 
 
-static int GetKeyboardLayoutListChecked( int nlayouts, HKL* layouts )
+static size_t GetKeyboardLayoutCountChecked( void )
 {
-	int n = GetKeyboardLayoutList(nlayouts, layouts);
+	size_t n = LayoutRegistryCount(SystemLayouts());
 	if( n == 0 )  MsgBox("Failed to get keyboard layouts list", MB_ICONERROR);
 	return n;
 }
 
-static bool AutoAssignLayouts( Options* po )
+// Loads the LAYOUTs given by code, and assigns the installed ones in turn to the KEYs given
+// without any; returns NULL, or what went wrong.
+static const char* LoadBindings( Options* po )
 {
-	HKL installed_layouts [MAX_KEYBOARD_LAYOUTS];
-	int n_installed_layouts = -1, installed_layouts_idx = 0;
+	static char error [128];
+	size_t installed_layouts_idx = 0;
 
-	for( unsigned i = 0; i < COUNTOF(po->layouts); ++i )
+	for( unsigned i = 0; i < COUNTOF(po->bindings); ++i )
 	{
-		if( po->layouts[i] != HKL_AUTOASSIGN )  continue;
+		Translation* binding = &po->bindings[i];
+		if( (po->keys[i] == 0) || binding->layout || binding->ntranslators )  continue;
 
-		if( n_installed_layouts < 0 )
+		if( po->klids[i].str[0] )
 		{
-			n_installed_layouts = GetKeyboardLayoutListChecked(COUNTOF(installed_layouts), installed_layouts);
-			if( n_installed_layouts <= 0 )  return false;
+			binding->layout = LoadKeyboardLayoutA(po->klids[i].str, KLF_SUBSTITUTE_OK);
+			if( binding->layout == NULL )
+			{
+				ERR("LoadKeyboardLayout");
+				snprintf(error, sizeof(error), "Failed to load the keyboard layout %s.", po->klids[i].str);
+				return error;
+			}
+			continue;
 		}
 
+		size_t n_installed_layouts = LayoutRegistryCount(SystemLayouts());
+		if( n_installed_layouts == 0 )  return "Failed to get keyboard layouts list";
+
 		if( installed_layouts_idx >= n_installed_layouts )
-			return MsgBox("There are more auto-assign KEY arguments\nthan keyboard layouts installed in the system.", MB_ICONERROR), false;
+			return "There are more auto-assign KEY arguments\nthan keyboard layouts installed in the system.";
 
-		po->layouts[i] = installed_layouts[installed_layouts_idx++];
+		binding->layout = (HKL) LayoutRegistryAt(SystemLayouts(), installed_layouts_idx++)->handle;
 	}
 
-	return true;
+	return NULL;
 }
 
 // -----------------------------------------------------------------------------
@@ -285,7 +425,9 @@ static int MessageLoop( void )
 	return msg.wParam;
 }
 
-static HWND CreateMessageWindow( LPCWSTR class_name, WNDPROC wndproc )
+// A message-only window, unless `top_level`: a hidden top-level window is needed
+// to receive broadcasts such as WM_SETTINGCHANGE and WM_DISPLAYCHANGE.
+static HWND CreateMessageWindowEx( LPCWSTR class_name, WNDPROC wndproc, bool top_level )
 {
 	WNDCLASSW wc =
 	{
@@ -295,52 +437,57 @@ static HWND CreateMessageWindow( LPCWSTR class_name, WNDPROC wndproc )
 	};
 	ATOM wca = RegisterClassW(&wc);
 	if( wca == 0 )  return ERR("RegisterClassW"), NULL;
-	HWND wnd = CreateWindowW((LPCWSTR)(intptr_t)wca, L"msg", 0, 0,0, 0,0, HWND_MESSAGE, NULL, GetModuleHandle(NULL), NULL);
+	HWND wnd = CreateWindowW((LPCWSTR)(intptr_t)wca, L"msg", top_level ? WS_POPUP : 0, 0,0, 0,0,
+	                         top_level ? NULL : HWND_MESSAGE, NULL, GetModuleHandle(NULL), NULL);
 	if( wnd == NULL )  return ERR("CreateWindow"), NULL;
 	return wnd;
 }
 
-// -----------------------------------------------------------------------------
-
-// returns a pointer to an internal buffer that gets overwritten with each call
-static const char* GetKeyboardLayoutText( const KLID* pklid )
+static HWND CreateMessageWindow( LPCWSTR class_name, WNDPROC wndproc )
 {
-	char path [256];
-	snprintf(path, COUNTOF(path), "%s\\%s",
-	         "SYSTEM\\CurrentControlSet\\Control\\Keyboard Layouts",
-	         pklid->str);
-
-	static char name [256];
-	DWORD namesz = sizeof(name);
-	LSTATUS err = RegGetValueA(HKEY_LOCAL_MACHINE, path, "Layout Text", RRF_RT_REG_SZ, NULL, name, &namesz);
-	if( err != 0 )  { name[0] = '?'; name[1] = 0; }
-
-	return name;
+	return CreateMessageWindowEx(class_name, wndproc, false);
 }
 
+// -----------------------------------------------------------------------------
+
 static void ShowKeyboardLayouts( void )
 {
-	HKL layouts [MAX_KEYBOARD_LAYOUTS];
-	int n = GetKeyboardLayoutListChecked(COUNTOF(layouts), layouts);
+	LayoutRegistry* reg = SystemLayouts();
+	size_t n = GetKeyboardLayoutCountChecked();
 	if( n == 0 )  return;
 
-	char output [4096], *po = output;
-	size_t remaining_size = COUNTOF(output);
+	size_t output_size = 1;
+	for( size_t i = 0; i < n; ++i )
+	{
+		const LayoutInfo* layout = LayoutRegistryAt(reg, i);
+		output_size += LAYOUT_ID_SIZE + 3 + strlen(LayoutRegistryName(reg, layout)) + 1;
+	}
+	output_size += 32;  // the translators heading
+	for( size_t i = 0, nt = TranslatorCount(); i < nt; ++i )
+	{
+		const TranslatorClass* cls = TranslatorAt(i);
+		output_size += LAYOUT_ID_SIZE + strlen(cls->name) + 3 + strlen(cls->description) + 1;
+	}
+
+	char* output = malloc(output_size);
+	if( output == NULL )  return MsgBox("Out of memory", MB_ICONERROR);
+
+	char* po = output;
+	size_t remaining_size = output_size;
+	*po = 0;
 
-	HKL initial_layout = GetKeyboardLayout(GetCurrentThreadId());
-	for( int i = 0; i < n; ++i )
+	for( size_t i = 0; i < n; ++i )
 	{
-		KLID klid;
-		if( ActivateKeyboardLayout(layouts[i], 0) == NULL )  continue;
-		if( !GetKeyboardLayoutNameA(klid.str) ) continue;
+		const LayoutInfo* layout = LayoutRegistryAt(reg, i);
+		if( !layout->id[0] )  continue;
 
 		int len = snprintf(po, remaining_size, "%*s   %s\n",
-		                   (int)(COUNTOF(klid.str) - 1), klid.str,
-		                   GetKeyboardLayoutText(&klid));
-		if( len < 0 )
+		                   KL_NAMELENGTH - 1, layout->id,
+		                   LayoutRegistryName(reg, layout));
+		if( (len < 0) || (len >= remaining_size) )
 		{
 			MsgBox("Formatting failed (?)", MB_ICONERROR);
-			ActivateKeyboardLayout(initial_layout, 0);
+			free(output);
 			return;
 		}
 
@@ -348,14 +495,24 @@ static void ShowKeyboardLayouts( void )
 		remaining_size -= len;
 	}
 
-	ActivateKeyboardLayout(initial_layout, 0);
+	int len = snprintf(po, remaining_size, "\nTranslators:\n");
+	for( size_t i = 0, nt = TranslatorCount(); (len > 0) && (len < remaining_size) && (i < nt); ++i )
+	{
+		po += len;
+		remaining_size -= len;
+
+		const TranslatorClass* cls = TranslatorAt(i);
+		len = snprintf(po, remaining_size, "%*s   %s\n", KL_NAMELENGTH - 1, cls->name, cls->description);
+	}
 
 	MonospaceBox(PROG, output);
+	free(output);
 }
 
 // -----------------------------------------------------------------------------
 
-static HWND SetFocusedWindowLayout( HKL new_layout, bool modifier )
+// returns the window with the keyboard focus, or NULL
+static HWND GetFocusTarget( void )
 {
 	HWND target = GetForegroundWindow();
 	if( target == NULL )  return ERR("GetForegroundWindow"), NULL;
@@ -366,36 +523,95 @@ static HWND SetFocusedWindowLayout( HKL new_layout, bool modifier )
 	GUITHREADINFO gti;
 	gti.cbSize = sizeof(gti);
 	if( GetGUIThreadInfo(fg_thread, &gti) && gti.hwndFocus )  target = gti.hwndFocus;
+	return target;
+}
+
+// ---- the last layout of each focus target (see focuscache.h) ----
 
-	// retrofitted into existing system, doesn't quite fit... a refactoring's in order?
-	if( new_layout == HKL_HEX_TO_UNICODE )
+static FocusCache  gFocusCache;
+
+// The cache alone can't be trusted (the user may have switched with the system hotkey
+// meanwhile), and neither can GetKeyboardLayout alone (e.g. for console windows it
+// reports the layout of the console host), so a switch is skipped only if both agree.
+static bool HasLayout( HWND target, DWORD pid, HKL layout )
+{
+	return (FocusCacheLookup(&gFocusCache, (uintptr_t)target, pid) == (uintptr_t)layout)
+	    && (GetKeyboardLayout(GetWindowThreadProcessId(target, NULL)) == layout);
+}
+
+static void RequestLayout( HWND target, HKL layout )
+{
+	DWORD pid = 0;
+	GetWindowThreadProcessId(target, &pid);
+
+	if( HasLayout(target, pid, layout) )
+	{
+		LOG("%p already has %llx", target, (UINT_PTR)layout);
+		StatsData* st = StatsBeginUpdate();
+		++st->switches_skipped;
+		StatsEndUpdate();
+	}
+	else PostMessage(target, WM_INPUTLANGCHANGEREQUEST, 0, (LPARAM)layout);
+
+	FocusCacheStore(&gFocusCache, (uintptr_t)target, pid, (uintptr_t)layout);
+}
+
+static bool IsLayoutInstalled( void* _, uintptr_t layout )
+{
+	return LayoutRegistryFindHandle(SystemLayouts(), layout) != NULL;
+}
+
+// the translators undoing `t`, in reverse order; false if some of them have no inverse
+static bool InverseTranslation( const Translation* t, Translation* pinverse )
+{
+	pinverse->layout = NULL;
+	pinverse->ntranslators = t->ntranslators;
+	for( unsigned i = 0; i < t->ntranslators; ++i )
 	{
-		MojibakeTranslateSelection(target, modifier ? HKL_UNICODE_TO_HEX : HKL_HEX_TO_UNICODE);
-		return target;
+		const char* name = t->translators[i]->inverse;
+		const TranslatorClass* cls = name ? TranslatorFind(name, strlen(name)) : NULL;
+		if( cls == NULL )  return false;
+		pinverse->translators[t->ntranslators - 1 - i] = cls;
+	}
+	return true;
+}
+
+// With a layout: switches the target to it, and with a modifier also fixes the selection
+// typed in a wrong layout. With translators: translates the selection, with a modifier
+// back (if the translators can be undone).
+static void SetWindowLayout( HWND target, const Translation* binding, bool modifier )
+{
+	if( binding->layout == NULL )
+	{
+		Translation inverse;
+		MojibakeTranslateSelection(target, (modifier && InverseTranslation(binding, &inverse)) ? &inverse : binding);
+		return;
 	}
 
 	if( modifier )
 	{
-		MojibakeTranslateSelection(target, new_layout);
+		MojibakeTranslateSelection(target, binding);
 	}
 
-	PostMessage(target, WM_INPUTLANGCHANGEREQUEST, 0, (LPARAM)new_layout);
-	return target;
+	RequestLayout(target, binding->layout);
 }
 
 // -----------------------------------------------------------------------------
 
 enum
 {
-	UWM_ACTIVATE_LAYOUT = WM_USER,
-	UWM_PAUSE_RESUME,               // wParam: false to pause, true to resume
+	UWM_ACTIVATE_LAYOUT = WM_USER,  // wParam: LOWORD any modifier pressed, HIWORD switch index; lParam: generation
+	UWM_CONTROL_REQUEST,            // lParam: ControlRequest*
+	UWM_REFRESH_FULLSCREEN,
+	UWM_DRAIN_ACTIVATIONS,
+	UWM_KEYSTROKES,                 // there are keystrokes to read in gKeyHistory
+	UWM_HOOK_STARTED,               // wParam: whether the hook is live
+	UWM_HOOK_HEALTH,                // the hook watchdog has news
 };
 
 static const WCHAR kMainWindowClassName [] = L""PROG".main.6qZK6nb0dYxsgS6H4b8w";
 static const WCHAR kHookWindowClassName [] = L""PROG".hook.6qZK6nb0dYxsgS6H4b8w";
 
-static HWND ghMainWindow = NULL;
-
 
 HWND AppHookCreateMessageWindow( WNDPROC wndproc )
 {
@@ -407,26 +623,644 @@ void AppHookMessageLoop( void )
 	MessageLoop();
 }
 
-void AppHookNotify( unsigned idx, bool any_modifier_pressed )
+// called on the hook thread; comes before any of the hook's other messages
+void AppHookStarted( bool ok )
 {
-	if( idx >= COUNTOF(gOptions.layouts) )  return;
-	HKL new_layout = gOptions.layouts[idx];
-//	LOG("%p", new_layout);
-	PostMessage(ghMainWindow, UWM_ACTIVATE_LAYOUT, any_modifier_pressed, (LPARAM)new_layout);
+	PostMessage(ghMainWindow, UWM_HOOK_STARTED, ok, 0);
 }
 
+// called on the hook thread
+void AppHookNotify( const HookConfig* config, unsigned idx, bool any_modifier_pressed )
+{
+	// the main thread looks up what the key is bound to, in the generation matched against
+	PostMessage(ghMainWindow, UWM_ACTIVATE_LAYOUT, MAKEWPARAM(any_modifier_pressed, idx),
+	            ((const Config*)config)->generation);
+}
 
-static bool IsFullscreenAppRunning( void )
+// called on the hook thread, once per batch of keystrokes
+void AppHookKeysRecorded( const HookConfig* config )
+{
+	PostMessage(ghMainWindow, UWM_KEYSTROKES, 0, 0);
+}
+
+// called on the watchdog thread
+void AppHookHealthChanged( void )
+{
+	PostMessage(ghMainWindow, UWM_HOOK_HEALTH, 0, 0);
+}
+
+
+// ---- fullscreen app detection, cached (see fscache.h) ----
+
+enum { FULLSCREEN_CHECK_TTL_ms = 1000 };
+
+static FullscreenCache  gFullscreenCache;
+static HWINEVENTHOOK    ghWinEventHook = NULL;
+static bool             gFullscreenRefreshPending = false;
+
+static uint32_t TickCount( void* _ )
+{
+	return GetTickCount();
+}
+
+static bool QueryFullscreenApp( void* _, bool* pfullscreen )
 {
 	QUERY_USER_NOTIFICATION_STATE ns;
 	HRESULT hr = SHQueryUserNotificationState(&ns);
 	if( FAILED(hr) )  return LOG("SHQueryUserNotificationState error 0x%lx", hr), false;
 	LOG("%d", ns);
 
-	return (ns == QUNS_BUSY)
-	    || (ns == QUNS_RUNNING_D3D_FULL_SCREEN)
-	    || (ns == QUNS_PRESENTATION_MODE)
-	    ;
+	*pfullscreen = (ns == QUNS_BUSY)
+	            || (ns == QUNS_RUNNING_D3D_FULL_SCREEN)
+	            || (ns == QUNS_PRESENTATION_MODE)
+	            ;
+	return true;
+}
+
+static void InitFullscreenCache( void )
+{
+	const FullscreenSource source = { TickCount, QueryFullscreenApp, NULL };
+	FullscreenCacheInit(&gFullscreenCache, &source, FULLSCREEN_CHECK_TTL_ms);
+}
+
+static bool IsFullscreenAppRunning( void )
+{
+	return FullscreenCacheGet(&gFullscreenCache);
+}
+
+// --per-app: remembers the layout the window that had focus ended up with (whichever way
+// it was switched), and restores the layout the newly focused app had last
+static void OnFocusChange( void )
+{
+	static HWND hwnd_last_focus = NULL;
+
+	if( hwnd_last_focus && IsWindow(hwnd_last_focus) )
+	{
+		DWORD pid = 0;
+		DWORD thread = GetWindowThreadProcessId(hwnd_last_focus, &pid);
+		FocusCacheStore(&gFocusCache, (uintptr_t)hwnd_last_focus, pid, (uintptr_t)GetKeyboardLayout(thread));
+	}
+
+	HWND target = GetFocusTarget();
+	hwnd_last_focus = target;
+	if( target == NULL )  return;
+
+	DWORD pid = 0;
+	GetWindowThreadProcessId(target, &pid);
+	HKL layout = (HKL) FocusCacheLookup(&gFocusCache, (uintptr_t)target, pid);
+	if( layout == NULL )  layout = (HKL) FocusCacheAppLayout(&gFocusCache, pid);
+	if( layout )
+	{
+		LOG("restoring %llx for %p", (UINT_PTR)layout, target);
+		RequestLayout(target, layout);
+	}
+}
+
+// ---- --detect: the words typed in a wrong layout (see livedetect.h) ----
+
+static KeyHistory   gKeyHistory;    // filled in by the hook
+static LiveKeymap   gLiveKeymaps [MAX_SWITCHES];
+static unsigned     gNumLiveKeymaps;
+static LiveDetector gDetector;
+static bool         gLiveKeymapsStale = true;
+
+// the keymaps of the layouts bound to the keys, read again whenever they may have changed
+static void LoadLiveKeymaps( void )
+{
+	const LiveKeymap* keymaps [MAX_SWITCHES];
+	unsigned n = 0;
+	for( unsigned i = 0; i < MAX_SWITCHES; ++i )
+	{
+		HKL layout = gOptions.bindings[i].layout;
+		bool seen = false;
+		for( unsigned k = 0; k < n; ++k )  seen |= (keymaps[k]->layout == (LayoutHandle)layout);
+		if( (gOptions.keys[i] == 0) || (layout == NULL) || seen )  continue;
+
+		if( LiveKeymapLoad(&gLiveKeymaps[n], (LayoutHandle)layout) )
+		{
+			if( gLiveKeymaps[n].model == NULL )  LOG("no language model for %llx", (UINT_PTR)layout);
+			keymaps[n] = &gLiveKeymaps[n];
+			++n;
+		}
+	}
+	LiveDetectorInit(&gDetector, keymaps, n);
+	gNumLiveKeymaps = n;
+	gLiveKeymapsStale = false;
+}
+
+static const LiveKeymap* FindLiveKeymap( HKL layout )
+{
+	for( unsigned i = 0; i < gNumLiveKeymaps; ++i )
+	{
+		if( gLiveKeymaps[i].layout == (LayoutHandle)layout )  return &gLiveKeymaps[i];
+	}
+	return NULL;
+}
+
+// --fix-word: retypes the word just typed in `from` as typed in `to`, with one SendInput
+static bool RetypeLastWord( HWND target, const LiveKeymap* from, const LiveKeymap* to )
+{
+	const uint8_t* keys;
+	unsigned spaces;
+	bool reported;
+	unsigned n = LiveDetectorLastWord(&gDetector, &keys, &spaces, &reported);
+	if( (from == NULL) || (to == NULL) || (from == to) || (n == 0) || (spaces && !reported) )  return false;
+
+	TRACE_BEGIN("retype", n);
+	static InjectBatch batch;
+	InjectBatchInit(&batch);
+	bool capslock = GetKeyState(VK_CAPITAL) & 1;
+	bool done = RetypeWord(&batch, keys, n, spaces, from, to, capslock) && InjectSend(&batch, SystemInjector());
+	if( done )
+	{
+		LOG("retyped %u keys and %u spaces in %p", n, spaces, target);
+		LiveDetectorSettle(&gDetector);
+		StatsData* st = StatsBeginUpdate();
+		++st->words_retyped;
+		StatsEndUpdate();
+	}
+	TRACE_END("retype", batch.count);
+	return done;
+}
+
+static void OnWrongLayout( HWND target, const LiveKeymap* keymap )
+{
+	if( gOptions.detect == detectOff )  return;   // only reading the keystrokes for --fix-word
+
+	LOG("wrong layout? %s is likely", keymap->model->language);
+	TRACE_INSTANT("wrong layout", keymap->layout);
+	StatsData* st = StatsBeginUpdate();
+	++st->wrong_layout_words;
+	StatsEndUpdate();
+
+	if( gOptions.ignore_fullscreen && IsFullscreenAppRunning() )  return;
+	if( gOptions.detect == detectSwitch )
+	{
+		if( gOptions.fix_word )  RetypeLastWord(target, gDetector.keymaps[gDetector.current], keymap);
+		RequestLayout(target, (HKL)keymap->layout);
+	}
+	else MessageBeep(MB_ICONWARNING);
+}
+
+// feeds the detector with the keystrokes recorded by the hook so far
+static void ReadKeystrokes( void )
+{
+	if( gLiveKeymapsStale )  LoadLiveKeymaps();
+
+	// (the layout of the window the keys go to, as of now: close enough for a batch)
+	HWND target = GetFocusTarget();
+	DWORD thread = target ? GetWindowThreadProcessId(target, NULL) : 0;
+	LiveDetectorSetCurrent(&gDetector, thread ? (LayoutHandle)GetKeyboardLayout(thread) : 0);
+
+	Keystroke ks;
+	unsigned dropped = atomic_load_explicit(&gKeyHistory.dropped, memory_order_relaxed);
+	while( KeyHistoryPop(&gKeyHistory, &ks) )
+	{
+		const LiveKeymap* keymap = LiveDetectorFeed(&gDetector, &ks, dropped);
+		if( keymap && target )  OnWrongLayout(target, keymap);
+	}
+}
+
+// reads the keystrokes until there are none left
+static void OnKeystrokes( void )
+{
+	do ReadKeystrokes();
+	while( !KeyHistoryWait(&gKeyHistory) );
+}
+
+// --fix-word: before switching the target to `layout`
+static void FixLastWord( HWND target, HKL layout )
+{
+	ReadKeystrokes();   // up to the taps of the switch key
+	HKL current = GetKeyboardLayout(GetWindowThreadProcessId(target, NULL));
+	RetypeLastWord(target, FindLiveKeymap(current), FindLiveKeymap(layout));
+}
+
+// out-of-context, so it runs on the main thread while it's retrieving messages
+static void CALLBACK WinEventProc( HWINEVENTHOOK _hook, DWORD event, HWND hwnd,
+                                   LONG id_object, LONG id_child, DWORD _thread, DWORD _time )
+{
+	if( event == EVENT_SYSTEM_FOREGROUND )
+	{
+		FullscreenCacheInvalidate(&gFullscreenCache);
+
+		// re-query once the burst of notifications has been processed, not on the switch path
+		if( gOptions.ignore_fullscreen && !gFullscreenRefreshPending )
+			gFullscreenRefreshPending = PostMessage(ghMainWindow, UWM_REFRESH_FULLSCREEN, 0, 0);
+
+		if( gOptions.per_app_layouts )  OnFocusChange();
+		LiveDetectorReset(&gDetector);
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+static bool PublishConfig( const Options* opt )
+{
+	static_assert(COUNTOF(opt->keys) == COUNTOF(((HookConfig*)0)->vkeys), "keys & vkeys must be of same size");
+
+	Config* config = malloc(sizeof(Config));
+	if( config == NULL )  return LOG("out of memory"), false;
+
+	config->hook.tap_timeout_ms = opt->tap_timeout_ms;
+	config->hook.nkeys = COUNTOF(opt->keys);
+	memcpy(config->hook.vkeys, opt->keys, sizeof(opt->keys));
+	config->hook.history = ((opt->detect != detectOff) || opt->fix_word) ? &gKeyHistory : NULL;
+	config->generation = gGeneration + 1;
+
+	if( !HookConfigure(&config->hook) )  return free(config), false;
+	++gGeneration;
+	return true;
+}
+
+// The bindings of the latest configuration published, once loaded (see LoadBindings).
+static void KeepBindings( const Options* opt )
+{
+	Bindings* b = &gBindings[gGeneration % BINDING_GENERATIONS];
+	b->generation = gGeneration;
+	memcpy(b->bindings, opt->bindings, sizeof(b->bindings));
+}
+
+// NULL if the configuration has been replaced too many times since, or not loaded yet
+static const Translation* FindBinding( uint32_t generation, unsigned idx )
+{
+	const Bindings* b = &gBindings[generation % BINDING_GENERATIONS];
+	if( (b->generation != generation) || (generation == 0) || (idx >= MAX_SWITCHES) )  return NULL;
+	return &b->bindings[idx];
+}
+
+static void SetStatsCommandLine( int argc, char* argv[] )
+{
+	StatsData* st = StatsBeginUpdate();
+	char* p = st->command_line;
+	size_t remaining_size = sizeof(st->command_line);
+	for( int i = 0; (i < argc) && (remaining_size > 1); ++i )
+	{
+		int len = snprintf(p, remaining_size, (i == 0) ? "%s" : " %s", argv[i]);
+		if( len < 0 )  break;
+		if( len >= remaining_size )  len = remaining_size - 1;
+		p += len;
+		remaining_size -= len;
+	}
+	StatsEndUpdate();
+}
+
+// A request from the control thread, handled on the main thread. The control thread waits
+// for it no longer than CONTROL_REQUEST_TIMEOUT_ms (less than the client waits for the reply),
+// but the message is handled all the same once the main thread gets to it: whichever of
+// the two is done with it last frees it.
+enum { CONTROL_REQUEST_TIMEOUT_ms = 2000 };
+
+typedef struct
+{
+	atomic_uint  refs;
+	CtlCommand   cmd;
+	size_t       length;
+	size_t       reply_length;
+	CtlResult    result;         // set by the main thread
+	uint8_t      payload [CTL_MAX_PAYLOAD];
+	uint8_t      reply [CTL_MAX_PAYLOAD];
+} ControlRequest;
+
+static void ReleaseControlRequest( ControlRequest* rq )
+{
+	if( atomic_fetch_sub(&rq->refs, 1) == 1 )  free(rq);
+}
+
+static bool Reconfigure( const char* args, size_t length )
+{
+	if( (length == 0) || (args[length - 1] != 0) )  return false;
+
+	char* argv [64] = { PROG };
+	int argc = 1;
+	for( const char* p = args; (p < args + length) && (argc < COUNTOF(argv)); p += strlen(p) + 1 )
+	{
+		argv[argc++] = (char*)p;
+	}
+
+	Options opt = { .command = cmdRun, .ignore_fullscreen = true };
+	if( !DocOptParseCommandLine(&opt, kUsage, argc, argv) || (opt.command != cmdRun) || (opt.keys[0] == 0) )
+		return false;
+	const char* error = LoadBindings(&opt);
+	if( error )  return LOG("%s", error), false;
+
+	// the hook picks up the new snapshot with the next keyboard event; no downtime
+	if( !PublishConfig(&opt) )  return false;
+	KeepBindings(&opt);
+	gOptions = opt;
+	gLiveKeymapsStale = true;
+	MojibakePreserveClipboard(gOptions.keep_clipboard ? ghMainWindow : NULL);
+	SetStatsCommandLine(argc, argv);
+
+	LOG("reconfigured");
+	return true;
+}
+
+// ---- the start-up timing ----
+
+static uint64_t gProcessStart_us;
+
+static const char* const kStartupPhaseNames [STARTUP_PHASES] =
+{
+	[spMain] = "main",
+	[spCommandLine] = "command line",
+	[spInstanceCheck] = "instance check",
+	[spWindow] = "window",
+	[spControlServer] = "control server",
+	[spHook] = "hook",
+	[spLayouts] = "layouts",
+};
+
+// notes the end of a phase of the start-up; shown by --status
+static void StartupMark( StartupPhase phase )
+{
+	uint64_t at_us = StatsNow_us() - gProcessStart_us;
+	StatsData* st = StatsBeginUpdate();
+	st->startup_us[phase] = (at_us < UINT32_MAX) ? (uint32_t)at_us : UINT32_MAX;
+	StatsEndUpdate();
+	LOG("startup: %s at %lu.%03lums", kStartupPhaseNames[phase],
+	    (unsigned long)(at_us / 1000), (unsigned long)(at_us % 1000));
+}
+
+// the hook is live: now the layouts, which take a while and are not needed before a KEY
+// is pressed (its activation is queued after this message). Until KeepBindings, there is
+// nothing for FindBinding to find, so the activations that come meanwhile are dropped:
+// the ones dispatched by the message box of a failure, too.
+static void OnHookStarted( bool ok )
+{
+	if( !ok )
+	{
+		ERR("hook");
+		PostQuitMessage(1);
+		return;
+	}
+	StartupMark(spHook);
+
+	const char* error = LoadBindings(&gOptions);
+	if( error )
+	{
+		MsgBox(error, MB_ICONERROR);
+		PostQuitMessage(1);
+		return;
+	}
+	KeepBindings(&gOptions);
+	StartupMark(spLayouts);
+}
+
+static void OnHookHealth( void )
+{
+	HookWatchStats hs;
+	HookGetHealth(&hs);
+
+	StatsData* st = StatsBeginUpdate();
+	st->hook_probes = 0;
+	for( unsigned i = 0; i < HOOKWATCH_REASONS; ++i )  st->hook_probes += hs.probes[i];
+	st->hook_probes_failed = hs.probes_failed;
+	st->hook_reinstalls = hs.losses;
+	st->hook_worst_us = hs.worst_us;
+	StatsEndUpdate();
+}
+
+uint64_t AppTraceNow_us( void )
+{
+	return StatsNow_us();
+}
+
+// stops recording and writes the events into the file `utf8_path`
+static bool SaveTrace( const char* utf8_path, size_t length, size_t* pcount )
+{
+	if( utf8_path[length - 1] != 0 )  return LOG("file name not terminated"), false;
+
+	WCHAR path [MAX_PATH];
+	if( !MultiByteToWideChar(CP_UTF8, 0, utf8_path, -1, path, COUNTOF(path)) )
+		return ERR("MultiByteToWideChar"), false;
+
+	TraceStop();
+	FILE* f = _wfopen(path, L"w");
+	if( f == NULL )  return LOG("cannot create %s", utf8_path), false;
+	*pcount = TraceDumpJson(f);
+	bool ok = !ferror(f);
+	return (fclose(f) == 0) && ok;
+}
+
+// runs on the main thread
+static CtlResult HandleControlRequest( ControlRequest* rq )
+{
+	rq->reply_length = 0;
+	switch( rq->cmd )
+	{
+		case ctlStatus:
+		{
+			const StatsData* sd = StatsCurrent();
+			CtlStatus st =
+			{
+				.pid = sd->pid,
+				.flags = (gPaused ? CTL_STATUS_PAUSED : 0) | (TRACE_ON() ? CTL_STATUS_TRACING : 0),
+				.uptime_s = StatsWallClock_s() - sd->start_time_s,
+			};
+			CtlStatusEncode(rq->reply, &st);
+			size_t n = strlen(sd->command_line) + 1;
+			memcpy(rq->reply + CTL_STATUS_SIZE, sd->command_line, n);
+			rq->reply_length = CTL_STATUS_SIZE + n;
+			return ctlOk;
+		}
+
+		case ctlMetrics:
+		{
+			const StatsData* sd = StatsCurrent();
+			uint64_t metrics [CTL_METRICS_COUNT] =
+			{
+				[ctlmIgnoredFullscreen] = sd->ignored_fullscreen,
+				[ctlmIgnoredBusy] = sd->ignored_busy,
+				[ctlmHookReinstalls] = sd->hook_reinstalls,
+			};
+			for( unsigned i = 0; i < STATS_MAX_KEYS; ++i )  metrics[ctlmActivations] += sd->activations[i];
+			for( unsigned i = 0; i < STATS_MODES; ++i )  metrics[ctlmTranslations] += sd->translations[i];
+			metrics[ctlmTranslations] += sd->translations_other;
+
+			CtlPutU32(rq->reply, CTL_METRICS_COUNT);
+			for( unsigned i = 0; i < CTL_METRICS_COUNT; ++i )
+			{
+				CtlPutU64(rq->reply + 4 + i * 8, metrics[i]);
+			}
+			rq->reply_length = 4 + CTL_METRICS_COUNT * 8;
+			return ctlOk;
+		}
+
+		case ctlPause:
+		case ctlResume:
+		{
+			if( !HookPauseResume(rq->cmd == ctlResume) )  return ctlErrFailed;
+			gPaused = (rq->cmd == ctlPause);
+			StatsData* st = StatsBeginUpdate();
+			st->flags = gPaused ? (st->flags | STATS_PAUSED) : (st->flags & ~STATS_PAUSED);
+			StatsEndUpdate();
+			return ctlOk;
+		}
+
+		case ctlReconfigure:
+			return Reconfigure((const char*)rq->payload, rq->length) ? ctlOk : ctlErrFailed;
+
+		case ctlTrace:
+		{
+			size_t n = 0;
+			if( rq->length == 0 )
+				TraceStart();
+			else if( !SaveTrace((const char*)rq->payload, rq->length, &n) )
+				return ctlErrFailed;
+
+			CtlPutU32(rq->reply, n);
+			rq->reply_length = 4;
+			return ctlOk;
+		}
+
+		case ctlQuit:
+			LOG("quit requested");
+			PostQuitMessage(0);
+			return ctlOk;
+	}
+	return ctlErrUnknown;
+}
+
+CtlResult AppControlRequest( CtlCommand cmd, const uint8_t* payload, size_t length,
+                             uint8_t* reply, size_t* preply_length )
+{
+	ControlRequest* rq = malloc(sizeof(*rq));
+	if( rq == NULL )  return ctlErrFailed;
+	atomic_init(&rq->refs, 2);
+	rq->cmd = cmd;
+	rq->length = length;
+	memcpy(rq->payload, payload, length);
+
+	// e.g. stuck in a message box: the request is answered with a failure, and handled later
+	CtlResult result = ctlErrFailed;
+	DWORD_PTR _;
+	if( SendMessageTimeoutW(ghMainWindow, UWM_CONTROL_REQUEST, 0, (LPARAM)rq, SMTO_NORMAL, CONTROL_REQUEST_TIMEOUT_ms, &_) )
+	{
+		memcpy(reply, rq->reply, rq->reply_length);
+		*preply_length = rq->reply_length;
+		result = rq->result;
+	}
+	else if( GetLastError() == ERROR_TIMEOUT )
+		LOG("the main thread has not handled a control request in %u ms", CONTROL_REQUEST_TIMEOUT_ms);
+	else
+		ReleaseControlRequest(rq);   // never to be handled: the window is gone
+	ReleaseControlRequest(rq);
+	return result;
+}
+
+// -----------------------------------------------------------------------------
+
+// Activations that come while a translation is in progress wait here. A translation
+// is queued with its target window, as focused at the time of the activation.
+static ActivationQueue  gPendingActivations;
+static bool             gDrainPending = false;
+
+static void UpdateQueueStats( void )
+{
+	StatsData* st = StatsBeginUpdate();
+	st->ignored_busy = gPendingActivations.ndropped;
+	st->activations_queued = gPendingActivations.nqueued;
+	st->activations_coalesced = gPendingActivations.ncoalesced;
+	StatsEndUpdate();
+}
+
+// the translations are the ones with a modifier, and all of the hex ones
+static bool IsTranslation( const Translation* binding, bool modifier )
+{
+	return modifier || (binding->layout == NULL);
+}
+
+// the same whether the activation is run at once or comes out of the queue
+static void RunActivation( HWND target, const Translation* binding, bool modifier )
+{
+	if( gOptions.fix_word && !modifier && binding->layout )  FixLastWord(target, binding->layout);
+	SetWindowLayout(target, binding, modifier);
+}
+
+static void OnActivateLayout( unsigned idx, bool modifier, uint32_t generation )
+{
+	const Translation* binding = FindBinding(generation, idx);
+	if( binding == NULL )  return LOG("activation %u of configuration %lu: gone", idx, (unsigned long)generation);
+
+	TRACE_BEGIN("activate", idx);
+	uint64_t start_us = StatsNow_us();
+	StatsData* st = StatsBeginUpdate();
+	if( idx < STATS_MAX_KEYS )  ++st->activations[idx];
+	StatsEndUpdate();
+
+	// ignore the switch commands when a fullscreen app is running (likely a game)
+	if( gOptions.ignore_fullscreen && IsFullscreenAppRunning() )
+	{
+		LOG("ignoring activation: fullscreen");
+		st = StatsBeginUpdate();
+		++st->ignored_fullscreen;
+		StatsEndUpdate();
+		TRACE_END("activate", 0);
+		return;
+	}
+
+	HWND target = GetFocusTarget();
+	if( target == NULL )
+	{
+		TRACE_END("activate", 0);
+		return;
+	}
+
+	if( MojibakeIsBusy() || (gPendingActivations.count > 0) )
+	{
+		LOG("busy, queueing activation");
+		Activation act =
+		{
+			.binding = idx,
+			.generation = generation,
+			// a layout switch is applied to whatever is focused when it gets its turn
+			.target = IsTranslation(binding, modifier) ? (uintptr_t)target : 0,
+			.modifier = modifier,
+			.queued_us = start_us,
+		};
+		ActivationQueuePush(&gPendingActivations, &act);
+		UpdateQueueStats();
+		if( !MojibakeIsBusy() )  AppMojibakeIdle();
+		TRACE_END("activate", gPendingActivations.count);
+		return;
+	}
+
+	RunActivation(target, binding, modifier);
+
+	st = StatsBeginUpdate();
+	StatsRecordTime(st, sthSwitch, StatsNow_us() - start_us);
+	StatsEndUpdate();
+	TRACE_END("activate", target);
+}
+
+// runs the queued activations until one of them starts a translation
+static void DrainActivations( void )
+{
+	Activation act;
+	while( !MojibakeIsBusy() && ActivationQueuePop(&gPendingActivations, &act) )
+	{
+		HWND target = act.target ? (HWND)act.target : GetFocusTarget();
+		if( (target == NULL) || !IsWindow(target) )  continue;
+
+		const Translation* binding = FindBinding(act.generation, act.binding);
+		if( binding == NULL )  continue;
+
+		LOG("running queued activation %u", act.binding);
+		TRACE_INSTANT("dequeue", act.binding);
+		RunActivation(target, binding, act.modifier);
+
+		StatsData* st = StatsBeginUpdate();
+		StatsRecordTime(st, sthQueueDelay, StatsNow_us() - act.queued_us);
+		StatsEndUpdate();
+	}
+}
+
+void AppMojibakeIdle( void )
+{
+	// not right away: give the target window a chance to process the paste first
+	if( (gPendingActivations.count > 0) && !gDrainPending )
+		gDrainPending = PostMessage(ghMainWindow, UWM_DRAIN_ACTIVATIONS, 0, 0);
 }
 
 static LRESULT CALLBACK MainWindowProc( HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam )
@@ -434,11 +1268,20 @@ static LRESULT CALLBACK MainWindowProc( HWND hwnd, UINT msg, WPARAM wParam, LPAR
 	switch( msg )
 	{
 		case WM_CREATE:
+			ghMainWindow = hwnd;   // for the hook thread, which may report before CreateWindow returns
 			if( !HookStart() )  return -1;
 			if( !AddClipboardFormatListener(hwnd) )  ERR("AddClipboardFormatListener");
+			InitFullscreenCache();
+			ActivationQueueInit(&gPendingActivations);
+			MojibakePreserveClipboard(gOptions.keep_clipboard ? hwnd : NULL);
+			ghWinEventHook = SetWinEventHook(EVENT_SYSTEM_FOREGROUND, EVENT_SYSTEM_FOREGROUND, NULL, WinEventProc,
+			                                 0, 0, WINEVENT_OUTOFCONTEXT | WINEVENT_SKIPOWNPROCESS);
+			if( ghWinEventHook == NULL )  ERR("SetWinEventHook");
+			FocusCacheInit(&gFocusCache);
 			break;
 
 		case WM_DESTROY:
+			if( ghWinEventHook )  UnhookWinEvent(ghWinEventHook);
 			HookShutdown();
 			RemoveClipboardFormatListener(hwnd);
 			LOG("%p exited", hwnd);
@@ -449,110 +1292,291 @@ static LRESULT CALLBACK MainWindowProc( HWND hwnd, UINT msg, WPARAM wParam, LPAR
 			MojibakeOnClipboardUpdate(hwnd);
 			break;
 
-		case WM_GETTEXT:
-			return snwprintf((WCHAR*)lParam, wParam, L"%ls", GetCommandLineW());
+		case WM_RENDERFORMAT:
+			MojibakeOnRenderFormat((UINT)wParam);
+			return 0;
+
+		case WM_RENDERALLFORMATS:
+			MojibakeOnRenderAllFormats();
+			return 0;
+
+		case WM_DESTROYCLIPBOARD:
+			MojibakeOnDestroyClipboard();
+			return 0;
 
 		case UWM_ACTIVATE_LAYOUT:
-			// ignore the switch commands when a fullscreen app is running (likely a game)
-			if( gOptions.ignore_fullscreen && IsFullscreenAppRunning() )
-				return LOG("ignoring activation: fullscreen"), 0;
-			if( MojibakeIsBusy() )
-				return LOG("ignoring activation: busy"), 0;
-			SetFocusedWindowLayout((HKL)lParam, wParam);
+			OnActivateLayout(HIWORD(wParam), LOWORD(wParam), (uint32_t)lParam);
+			return 0;
+
+		case UWM_DRAIN_ACTIVATIONS:
+			gDrainPending = false;
+			DrainActivations();
+			return 0;
+
+		case UWM_CONTROL_REQUEST:
+		{
+			ControlRequest* rq = (ControlRequest*)lParam;
+			rq->result = HandleControlRequest(rq);
+			ReleaseControlRequest(rq);
+			return 0;
+		}
+
+		case UWM_KEYSTROKES:
+			OnKeystrokes();
+			return 0;
+
+		case UWM_HOOK_STARTED:
+			OnHookStarted(wParam);
 			return 0;
 
-		case UWM_PAUSE_RESUME:
-			return HookPauseResume(!!wParam);
+		case UWM_HOOK_HEALTH:
+			OnHookHealth();
+			return 0;
+
+		case WM_INPUTLANGCHANGE:
+		case WM_SETTINGCHANGE:
+			// a layout may have been added or removed: forget only what was remembered of those gone
+			LayoutRegistryInvalidate(SystemLayouts());
+			FocusCacheRetainLayouts(&gFocusCache, IsLayoutInstalled, NULL);
+			gLiveKeymapsStale = true;
+			break;
+
+		case WM_DISPLAYCHANGE:
+			FullscreenCacheInvalidate(&gFullscreenCache);
+			break;
+
+		case UWM_REFRESH_FULLSCREEN:
+			gFullscreenRefreshPending = false;
+			FullscreenCacheRefresh(&gFullscreenCache);
+			return 0;
 	}
 	return DefWindowProcW(hwnd, msg, wParam, lParam);
 }
 
 // -----------------------------------------------------------------------------
 
-static HWND FindRunningInstance( void )
+// returns false if there is no running instance to talk to
+static bool CallRunningInstance( CtlCommand cmd, const void* payload, size_t length,
+                                 CtlResult* presult, uint8_t* reply, size_t* preply_length )
 {
-	return FindWindowW(kMainWindowClassName, NULL);
+	if( ControlCall(cmd, payload, length, presult, reply, preply_length) )  return true;
+	MsgBox(PROG" is not running.", MB_ICONINFORMATION);
+	return false;
 }
 
-static bool StopRunningInstance( HWND hwnd_running )
+// returns true if there was a running instance (*prunning) and it accepted the new command line
+static bool ReconfigureRunningInstance( int argc, char* argv[], bool* prunning )
 {
-	HWND running = hwnd_running ? hwnd_running : FindRunningInstance();
-	if( running )
+	*prunning = false;
+	char args [CTL_MAX_PAYLOAD];
+	size_t length = 0;
+	for( int i = 1; i < argc; ++i )
 	{
-		LOG("stopping %p", running);
-		PostMessageW(running, WM_QUIT, 0, 0);
+		size_t n = strlen(argv[i]) + 1;
+		if( length + n > sizeof(args) )  return false;
+		memcpy(args + length, argv[i], n);
+		length += n;
 	}
-	else
-	{
-		LOG("not running");
-	}
-	return !!running;
+
+	static uint8_t reply [CTL_MAX_PAYLOAD];
+	size_t reply_length;
+	CtlResult rc;
+	if( !ControlCall(ctlReconfigure, args, length, &rc, reply, &reply_length) )  return false;
+	*prunning = true;
+	if( rc != ctlOk )  LOG("reconfigure failed: %d", rc);
+	return rc == ctlOk;
 }
 
-static bool Run( const Options* opt )
+static bool StopRunningInstance( void )
 {
-	HWND running = FindRunningInstance();
+	static uint8_t reply [CTL_MAX_PAYLOAD];
+	size_t reply_length;
+	CtlResult rc;
+	if( !CallRunningInstance(ctlQuit, NULL, 0, &rc, reply, &reply_length) )  return false;
+	return rc == ctlOk;
+}
+
+static bool Run( const Options* opt, int argc, char* argv[] )
+{
+	KeyHistoryInit(&gKeyHistory);
+	KeyHistoryWait(&gKeyHistory);   // to be told about the first keystrokes
 
-	HookConfigure(opt->keys, COUNTOF(opt->keys), opt->tap_timeout_ms);
+	if( !PublishConfig(opt) )
+		return false;
 
-	ghMainWindow = CreateMessageWindow(kMainWindowClassName, MainWindowProc);
+	ghMainWindow = CreateMessageWindowEx(kMainWindowClassName, MainWindowProc, true);
 	if( ghMainWindow == NULL )
 		return false;
+	StartupMark(spWindow);
 
-	if( running )  StopRunningInstance(running);
+	// fails if another instance has started meanwhile
+	if( !ControlServerStart() )
+	{
+		DestroyWindow(ghMainWindow);
+		return false;
+	}
+
+	// not fatal: the counters are still collected, just not visible outside
+	StatsPublish();
+	StatsData* st = StatsBeginUpdate();
+	st->pid = GetCurrentProcessId();
+	st->flags = STATS_RUNNING;
+	st->start_time_s = StatsWallClock_s();
+	StatsEndUpdate();
+	SetStatsCommandLine(argc, argv);
+	StartupMark(spControlServer);
 
 	int rc = MessageLoop();
 
+	StatsUnpublish();
+	ControlServerStop();
 	HookShutdown();
 	return rc == 0;
 }
 
 
+// reads the shared statistics: works even if the running instance is busy
 static bool ShowRunningInstanceStatus( void )
 {
-	HWND running = FindRunningInstance();
-	if( running )
-	{
-		char buffer [256] = PROG" is running.\n\nCommand line:\n\n";
-		SendMessageA(running, WM_GETTEXT, COUNTOF(buffer) - strlen(buffer), (LPARAM)(buffer + strlen(buffer)));
-		MsgBox(buffer, MB_ICONINFORMATION);
-	}
-	else
+	const StatsShared* shm = StatsOpen();
+	StatsData st;
+	bool running = shm && StatsRead(shm, &st) && (st.flags & STATS_RUNNING);
+	StatsClose(shm);
+	if( !running )
+		return MsgBox(PROG" is not running.", MB_ICONINFORMATION), false;
+
+	uint64_t activations = 0;
+	for( unsigned i = 0; i < STATS_MAX_KEYS; ++i )  activations += st.activations[i];
+
+	char last_error [STATS_WHERE_SIZE + 32] = "none";
+	if( st.last_error_where[0] )
+		snprintf(last_error, sizeof(last_error), "%s (%lu)", st.last_error_where, (unsigned long)st.last_error);
+
+	// in milliseconds since the process was created
+	char startup [STARTUP_PHASES * 32] = "";
+	for( unsigned i = 0, len = 0; (i < STARTUP_PHASES) && (len < sizeof(startup)); ++i )
 	{
-		MsgBox(PROG" is not running.", MB_ICONINFORMATION);
+		int n = snprintf(startup + len, sizeof(startup) - len, "%s%s %.1f", i ? ", " : "",
+		                 kStartupPhaseNames[i], st.startup_us[i] / 1000.0);
+		if( n < 0 )  break;
+		len += n;
 	}
-	return running;
+
+	char buffer [STATS_CMDLINE_SIZE + 1024];
+	snprintf(buffer, sizeof(buffer),
+	         PROG" is running%s.\n\n"
+	         "Process ID: %lu\n"
+	         "Uptime: %llus\n"
+	         "Startup (ms): %s\n"
+	         "Activations: %llu (ignored: %llu fullscreen, %llu dropped while busy; queued: %llu, coalesced: %llu)\n"
+	         "Switches skipped (already in layout): %llu\n"
+	         "Clipboard preservation: %llu bytes copied, %llu formats not kept\n"
+	         "Translation buffers: %llu bytes held, %llu at the peak\n"
+	         "Translations: %llu layout, %llu hex->unicode, %llu unicode->hex, %llu other (typed: %llu)\n"
+	         "Layout detection: %llu hits, %llu misses\n"
+	         "Words typed in a wrong layout: %llu (retyped: %llu)\n"
+	         "Keyboard hook: %llu reinstalls, %llu probes (%llu failed), slowest callback %.1f ms\n"
+	         "Last error: %s\n"
+	         "\nCommand line:\n\n%s",
+	         (st.flags & STATS_PAUSED) ? " (paused)" : "",
+	         (unsigned long)st.pid,
+	         (unsigned long long)(StatsWallClock_s() - st.start_time_s),
+	         startup,
+	         (unsigned long long)activations,
+	         (unsigned long long)st.ignored_fullscreen,
+	         (unsigned long long)st.ignored_busy,
+	         (unsigned long long)st.activations_queued,
+	         (unsigned long long)st.activations_coalesced,
+	         (unsigned long long)st.switches_skipped,
+	         (unsigned long long)st.clipboard_bytes_copied,
+	         (unsigned long long)st.clipboard_formats_skipped,
+	         (unsigned long long)st.arena_bytes,
+	         (unsigned long long)st.arena_peak_bytes,
+	         (unsigned long long)st.translations[stmLayout],
+	         (unsigned long long)st.translations[stmHexToUnicode],
+	         (unsigned long long)st.translations[stmUnicodeToHex],
+	         (unsigned long long)st.translations_other,
+	         (unsigned long long)st.translations_typed,
+	         (unsigned long long)st.detection_hits,
+	         (unsigned long long)st.detection_misses,
+	         (unsigned long long)st.wrong_layout_words,
+	         (unsigned long long)st.words_retyped,
+	         (unsigned long long)st.hook_reinstalls,
+	         (unsigned long long)st.hook_probes,
+	         (unsigned long long)st.hook_probes_failed,
+	         st.hook_worst_us / 1000.0,
+	         last_error,
+	         st.command_line);
+	MsgBox(buffer, MB_ICONINFORMATION);
+	return true;
 }
 
 
-static bool PauseResume( Command cmd )
+// the first call starts the recording, the next one saves the events
+static bool ToggleTrace( void )
 {
-	HWND running = FindRunningInstance();
-	if( running )
-	{
-		if( !SendMessageA(running, UWM_PAUSE_RESUME, cmd == cmdResume, 0) )
-			return MsgBox("Failed to pause/resume", MB_ICONERROR), false;
-	}
-	else
+	static uint8_t reply [CTL_MAX_PAYLOAD];
+	size_t reply_length;
+	CtlResult rc;
+	if( !CallRunningInstance(ctlStatus, NULL, 0, &rc, reply, &reply_length) )  return false;
+
+	CtlStatus status = {0};
+	if( (rc == ctlOk) && (reply_length >= CTL_STATUS_SIZE) )  CtlStatusDecode(reply, &status);
+	if( !(status.flags & CTL_STATUS_TRACING) )
 	{
-		MsgBox(PROG" is not running.", MB_ICONINFORMATION);
+		if( !CallRunningInstance(ctlTrace, NULL, 0, &rc, reply, &reply_length) || (rc != ctlOk) )
+			return MsgBox("Failed to start tracing", MB_ICONERROR), false;
+		return MsgBox("Recording trace events.\nRun "PROG" --trace again to save them.", MB_ICONINFORMATION), true;
 	}
-	return running;
+
+	WCHAR wpath [MAX_PATH];
+	char path [MAX_PATH * 3];
+	DWORD n = GetTempPathW(COUNTOF(wpath), wpath);
+	if( (n == 0) || (n + 20 > COUNTOF(wpath)) )  return ERR("GetTempPath"), false;
+	wcscat(wpath, L""PROG"-trace.json");
+	if( !WideCharToMultiByte(CP_UTF8, 0, wpath, -1, path, sizeof(path), NULL, NULL) )
+		return ERR("WideCharToMultiByte"), false;
+
+	if( !CallRunningInstance(ctlTrace, path, strlen(path) + 1, &rc, reply, &reply_length) || (rc != ctlOk) )
+		return MsgBox("Failed to save the trace events", MB_ICONERROR), false;
+
+	char text [MAX_PATH * 3 + 64];
+	snprintf(text, sizeof(text), "%lu events saved into\n%s",
+	         (unsigned long)((reply_length >= 4) ? CtlGetU32(reply) : 0), path);
+	MsgBox(text, MB_ICONINFORMATION);
+	return true;
+}
+
+static bool PauseResume( Command cmd )
+{
+	static uint8_t reply [CTL_MAX_PAYLOAD];
+	size_t reply_length;
+	CtlResult rc;
+	if( !CallRunningInstance((cmd == cmdResume) ? ctlResume : ctlPause, NULL, 0, &rc, reply, &reply_length) )
+		return false;
+	if( rc != ctlOk )
+		return MsgBox("Failed to pause/resume", MB_ICONERROR), false;
+	return true;
 }
 
 
+// Only a start runs into the layout APIs, after the hook is live (see OnHookStarted);
+// the control commands, and a command line handed over to the running instance, never do.
 int main( int argc, char* argv[] )
 {
+	gProcessStart_us = StatsProcessStart_us();
+	StartupMark(spMain);
+
 	gOptions.command = cmdRun;
 	gOptions.ignore_fullscreen = true;
 	if( !DocOptParseCommandLine(&gOptions, kUsage, argc, argv) && (gOptions.command != cmdHelp) )
 		return 1;
-	if( !AutoAssignLayouts(&gOptions) )
-		return 1;
+	StartupMark(spCommandLine);
 
 	switch( gOptions.command )
 	{
 		case cmdRun:
+		{
 			if( gOptions.keys[0] == 0 )
 			{
 				MessageBoxA(NULL, "No switches specified on command line.\n"
@@ -561,21 +1585,35 @@ int main( int argc, char* argv[] )
 				            PROG, MB_OK | MB_ICONERROR);
 				return 1;
 			}
-			if( !Run(&gOptions) )
+			bool running;
+			if( ReconfigureRunningInstance(argc, argv, &running) )
+				return 0;
+			if( running )
+			{
+				MsgBox("The running "PROG" did not accept the new command line.", MB_ICONERROR);
+				return 1;
+			}
+			StartupMark(spInstanceCheck);
+			if( !Run(&gOptions, argc, argv) )
 			{
 				MsgBox("Something went wrong.\n"PROG" failed to start.", MB_ICONERROR);
 				return 1;
 			}
 			return 0;
+		}
 
 		case cmdPause:
 		case cmdResume:
 			return PauseResume(gOptions.command) ? 0 : 1;
 
 		case cmdQuit:
-			return StopRunningInstance(NULL) ? 0 : 1;
+			return StopRunningInstance() ? 0 : 1;
+
+		case cmdTrace:
+			return ToggleTrace() ? 0 : 1;
 
 		case cmdListLayouts:
+			TranslitLoad();
 			ShowKeyboardLayouts();
 			return 0;
 
@@ -1,40 +1,42 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include <assert.h>
 #include <windows.h>
 #include <process.h>
 #include "kbswhook.h"
 #include "common.h"
+#include "rcu.h"
+#include "trace.h"
+#include "tapdetect.h"
+#include "hookwatch.h"
 
-// events coming faster are assumed to be injected
-#define MIN_DELAY_MS               10
+// config: written by the app thread, read by the hook thread (see rcu.h)
+static RcuCell            gConfig = RCU_CELL_INIT(free);
+static bool               gEnabled = true;
 
-#define NONE                       -1
-#define COUNT_ACTIVATE              4  // on which transition count value to activate
-#define COUNT_OFF_UP                8  // this sequence should be ignored (switch is up)
-#define COUNT_OFF_DOWN              9  // this sequence should be ignored (switch is down)
-#define ISDOWN( transition_count )  (transition_count & 1)
-#define ISUP( transition_count )    !ISDOWN(transition_count & 1)
+// state
+static uint64_t           gLastEpoch;   // of the snapshot gTap.current refers to
+static TapDetector        gTap = { .current = TAP_NONE };
 
-// config
-static unsigned      gConfTapTimeout_ms;
-static const VKEY*   gConfVKeys;
-static unsigned      gConfVKeysCount;
-static bool          gEnabled = true;
+// health: bumped by the hook thread, watched by the watchdog thread (see hookwatch.h)
+static HookPulse          gPulse;
+static double             gQpcPerUs;
 
-// state
-static int      gCurrentSwitch = NONE;	// index in gConfVKeys[]
-static DWORD    gLastPressTime_ms;
-static unsigned gTransitionCount;   // counts both presses and releases; odd = switch is down
+enum
+{
+	PROBE_VKEY = 0xE8,        // unassigned
+	PROBE_TAG  = 0x6B627377,  // "kbsw", in dwExtraInfo
+};
 
 // -----------------------------------------------------------------------------
 
-static void SwitchActivate( unsigned sw )
+static void SwitchActivate( const HookConfig* cfg, unsigned sw )
 {
 	bool any_modifier_pressed = false;
 	for( unsigned i = 0; kModifierVKeys[i] != 0; ++i )
 	{
-		if( kModifierVKeys[i] == gConfVKeys[sw] )  continue;
+		if( kModifierVKeys[i] == cfg->vkeys[sw] )  continue;
 		if( GetAsyncKeyState(kModifierVKeys[i]) & 0x8000 )
 		{
 			any_modifier_pressed = true;
@@ -42,94 +44,85 @@ static void SwitchActivate( unsigned sw )
 		}
 	}
 
-	AppHookNotify(sw, any_modifier_pressed);
+	TRACE_INSTANT("hook.activate", sw);
+	AppHookNotify(cfg, sw, any_modifier_pressed);
 }
 
-// -----------------------------------------------------------------------------
-
-static void SwitchDown( unsigned sw, DWORD timestamp_ms )
-{
-	DWORD elapsed_ms = timestamp_ms - gLastPressTime_ms;
-
-	gLastPressTime_ms = timestamp_ms;
-
-	if( (sw != gCurrentSwitch) || (elapsed_ms > gConfTapTimeout_ms) )
-	{
-		// could be a new double-press sequence
-		gCurrentSwitch = sw;
-		gTransitionCount = 1;
-		return;
-	}
-
-	if( ISDOWN(gTransitionCount) || (elapsed_ms <= MIN_DELAY_MS) )
-	{
-		// must be an autorepeat or an injected keypress
-		gTransitionCount = COUNT_OFF_DOWN;
-		return;
-	}
 
-	++gTransitionCount;
-}
-
-static void SwitchUp( unsigned sw, DWORD timestamp_ms )
+// No work that may block here: Windows removes a hook that once takes longer than
+// LowLevelHooksTimeout. Whatever has to be done elsewhere is posted (AppHookNotify).
+static void OnKeyboardEvent( const HookConfig* cfg, int code, const KBDLLHOOKSTRUCT* ev )
 {
-	if( sw != gCurrentSwitch )
-	{
-		gCurrentSwitch = NONE;
-		return;
-	}
-
-	DWORD elapsed_ms = timestamp_ms - gLastPressTime_ms;
-
-	if( ISUP(gTransitionCount) || (elapsed_ms <= MIN_DELAY_MS) || (elapsed_ms > gConfTapTimeout_ms) )
-	{
-		gTransitionCount = COUNT_OFF_UP;
-		return;
-	}
-
-	++gTransitionCount;
-
-	if( gTransitionCount == COUNT_ACTIVATE )
+	if( RcuReadEpoch(&gConfig) != gLastEpoch )
 	{
-		SwitchActivate(sw);
+		// the key indices may have changed meaning
+		gLastEpoch = RcuReadEpoch(&gConfig);
+		TapDetectorOther(&gTap);
 	}
-}
-
 
-static LRESULT CALLBACK LowLevelKeyboardHook( int code, WPARAM wParam, LPARAM lParam )
-{
-	if( (code == HC_ACTION) && gEnabled )
+	if( (code == HC_ACTION) && gEnabled && cfg )
 	{
-		const KBDLLHOOKSTRUCT* ev = (KBDLLHOOKSTRUCT*)lParam;
-
 		if( (ev->flags & LLKHF_INJECTED) == 0 )
 		{
+			if( cfg->history )
+			{
+				Keystroke ks = {
+					.scancode = (ev->scanCode & 0xFF) | ((ev->flags & LLKHF_EXTENDED) ? 0xE000 : 0),
+					.flags = (ev->flags & LLKHF_UP) ? KS_UP : 0,
+					.time_ms = ev->time,
+				};
+				if( KeyHistoryPush(cfg->history, &ks) )  AppHookKeysRecorded(cfg);
+			}
+
 			VKEY vk = ev->vkCode;
-			for( unsigned i = 0; i < gConfVKeysCount; ++i )
+			for( unsigned i = 0; i < cfg->nkeys; ++i )
 			{
-				if( vk == gConfVKeys[i] )
+				if( vk == cfg->vkeys[i] )
 				{
-					((ev->flags & LLKHF_UP) ? SwitchUp : SwitchDown)(i, ev->time);
-					return CallNextHookEx(NULL, code, wParam, lParam);
+					if( !(ev->flags & LLKHF_UP) )
+						TapDetectorDown(&gTap, i, ev->time, cfg->tap_timeout_ms);
+					else if( TapDetectorUp(&gTap, i, ev->time, cfg->tap_timeout_ms) )
+						SwitchActivate(cfg, i);
+					return;
 				}
-				else if( gConfVKeys[i] == 0 )
+				else if( cfg->vkeys[i] == 0 )
 				{
 					break;
 				}
 			}
 		}
 
-		gCurrentSwitch = NONE;
+		TapDetectorOther(&gTap);
 	}
-	return CallNextHookEx(NULL, code, wParam, lParam);
+}
+
+static LRESULT CALLBACK LowLevelKeyboardHook( int code, WPARAM wParam, LPARAM lParam )
+{
+	LARGE_INTEGER start, end;
+	QueryPerformanceCounter(&start);
+
+	const KBDLLHOOKSTRUCT* ev = (KBDLLHOOKSTRUCT*)lParam;
+	bool probe = (code == HC_ACTION) && (ev->vkCode == PROBE_VKEY) && (ev->dwExtraInfo == PROBE_TAG);
+	if( !probe )
+	{
+		// the snapshot is only held for the callback: the app thread can free the
+		// old ones as soon as it publishes, however long the keyboard stays idle
+		OnKeyboardEvent(RcuRead(&gConfig), code, ev);
+		RcuReadEnd(&gConfig);
+	}
+
+	QueryPerformanceCounter(&end);
+	HookPulseBeat(&gPulse, probe, (uint32_t)((end.QuadPart - start.QuadPart) / gQpcPerUs));
+	// the watchdog's probes go no further
+	return probe ? 1 : CallNextHookEx(NULL, code, wParam, lParam);
 }
 
 // -----------------------------------------------------------------------------
 
 enum
 {
-	UWM_REPORT_READINESS = WM_USER,
-	UWM_PAUSE_RESUME,  // wParam: false to pause, true to resume
+	UWM_PAUSE_RESUME = WM_USER,  // wParam: false to pause, true to resume
+	UWM_REINSTALL,               // from the watchdog
 };
 
 static HHOOK ghHook = NULL;
@@ -153,21 +146,34 @@ static LRESULT CALLBACK HookWindowProc( HWND hwnd, UINT msg, WPARAM wParam, LPAR
 	switch( msg )
 	{
 		case WM_CREATE:
+		{
 			if( !HookInstall() ) return ERR("HookInstall"), -1;
+			// the keystrokes of the system, for the watchdog to compare with what the hook sees;
+			// without them it only probes after a slow callback
+			const RAWINPUTDEVICE rid = { .usUsagePage = 0x01, .usUsage = 0x06, .dwFlags = RIDEV_INPUTSINK, .hwndTarget = hwnd };
+			if( !RegisterRawInputDevices(&rid, 1, sizeof(rid)) )  ERR("RegisterRawInputDevices");
 			break;
+		}
+
+		case WM_INPUT:
+			HookPulseKeyboard(&gPulse);
+			break;   // DefWindowProc frees the input
 
 		case WM_DESTROY:
 			HookUninstall();
 			break;
 
-		case UWM_REPORT_READINESS:
-			SetEvent((HANDLE)lParam);
-			return TRUE;
-
 		case UWM_PAUSE_RESUME:
 			gEnabled = !!wParam;
-			if( !gEnabled )  gCurrentSwitch = NONE;
+			if( !gEnabled )  TapDetectorOther(&gTap);
 			return TRUE;
+
+		case UWM_REINSTALL:
+			// Windows may have removed it without a word
+			HookUninstall();
+			if( !HookInstall() )  ERR("HookInstall");
+			TapDetectorOther(&gTap);
+			return 0;
 	}
 	return DefWindowProcW(hwnd, msg, wParam, lParam);
 }
@@ -176,50 +182,112 @@ static LRESULT CALLBACK HookWindowProc( HWND hwnd, UINT msg, WPARAM wParam, LPAR
 
 static HWND ghHookWindow = NULL;
 
-static void HookThread( void* ready_evt )
+// the watchdog: its own thread, so that the probes and the rest never hold up the hook
+static HookWatchdog  gWatchdog;
+static SRWLOCK       gWatchdogLock = SRWLOCK_INIT;   // for gWatchdog.stats, read by HookGetHealth
+static HANDLE        ghWatchdogStop = NULL;
+
+static uint32_t WatchNow( void* _ )
 {
-	ghHookWindow = AppHookCreateMessageWindow(HookWindowProc);
-	if( ghHookWindow == NULL )  return;
-	PostMessageW(ghHookWindow, UWM_REPORT_READINESS, 0, (LPARAM)ready_evt);
-	AppHookMessageLoop();
-	HookUninstall();
+	return GetTickCount();
 }
 
-bool HookStart( void )
+static bool WatchSendProbe( void* _ )
 {
-	HANDLE thread_ready_evt = CreateEvent(NULL, FALSE, FALSE, NULL);
-	if( thread_ready_evt == NULL )
-		return ERR("CreateEvent"), false;
+	// the release of a key no keyboard has; the hook swallows it, but it is input all the same,
+	// to the idle timer and to the hooks after ours, so the watchdog sends as few as it can
+	// (raw input sees it too: it is counted as keyboard input, which the hook has seen)
+	INPUT in = { .type = INPUT_KEYBOARD, .ki = { .wVk = PROBE_VKEY, .dwFlags = KEYEVENTF_KEYUP, .dwExtraInfo = PROBE_TAG } };
+	return SendInput(1, &in, sizeof(in)) == 1;
+}
 
-	bool ok = true;
+static void WatchReinstall( void* _ )
+{
+	PostMessageW(ghHookWindow, UWM_REINSTALL, 0, 0);
+}
 
-	if( _beginthread(HookThread, 0, (void*)thread_ready_evt) == -1 )
-		ok = (ERR("_beginthread"), false);
+static void WatchChanged( void* _ )
+{
+	AppHookHealthChanged();
+}
 
-	if( ok )
+// in ms; absent, it is taken to be what it is on Windows 7
+static uint32_t LowLevelHooksTimeout( void )
+{
+	DWORD timeout_ms = 0, size = sizeof(timeout_ms);
+	if( RegGetValueW(HKEY_CURRENT_USER, L"Control Panel\\Desktop", L"LowLevelHooksTimeout", RRF_RT_REG_DWORD,
+	                 NULL, &timeout_ms, &size) != ERROR_SUCCESS || (timeout_ms == 0) )
+		timeout_ms = 300;
+	return timeout_ms;
+}
+
+static void WatchdogThread( void* _ )
+{
+	HookWatchConfig config = HOOKWATCH_DEFAULT_CONFIG;
+	// a callback taking half the timeout is close enough to it to check
+	config.slow_us = LowLevelHooksTimeout() * 500;
+	const HookWatchHost host = { WatchNow, WatchSendProbe, WatchReinstall, WatchChanged, NULL };
+
+	AcquireSRWLockExclusive(&gWatchdogLock);
+	HookWatchInit(&gWatchdog, &host, &config);
+	ReleaseSRWLockExclusive(&gWatchdogLock);
+
+	while( WaitForSingleObject(ghWatchdogStop, config.period_ms) == WAIT_TIMEOUT )
 	{
-		if( WaitForSingleObject(thread_ready_evt, 100) != 0 )
-			ok = (ERR("WaitForSingleObject"), false);
+		AcquireSRWLockExclusive(&gWatchdogLock);
+		HookWatchTick(&gWatchdog, &gPulse);
+		ReleaseSRWLockExclusive(&gWatchdogLock);
 	}
+}
+
+static void HookThread( void* _ )
+{
+	// the hook is called through this thread's message loop: it should get the CPU at once
+	if( !SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) )  ERR("SetThreadPriority");
 
-	CloseHandle(thread_ready_evt);
-	return ok;
+	// the hook is installed as the window is created; its events come with the message loop
+	ghHookWindow = AppHookCreateMessageWindow(HookWindowProc);
+	AppHookStarted(ghHookWindow != NULL);
+	if( ghHookWindow == NULL )  return;
+	if( _beginthread(WatchdogThread, 0, NULL) == -1 )  ERR("_beginthread");
+	AppHookMessageLoop();
+	HookUninstall();
+}
+
+bool HookStart( void )
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	gQpcPerUs = freq.QuadPart / 1e6;
+
+	ghWatchdogStop = CreateEventW(NULL, TRUE, FALSE, NULL);
+	if( ghWatchdogStop == NULL )  return ERR("CreateEvent"), false;
+	if( _beginthread(HookThread, 0, NULL) == -1 )  return ERR("_beginthread"), false;
+	return true;
 }
 
 void HookShutdown( void )
 {
+	if( ghWatchdogStop )  SetEvent(ghWatchdogStop);
 	if( ghHookWindow )
 	{
 		SendMessageW(ghHookWindow, WM_CLOSE, 0, 0);
 		ghHookWindow = NULL;
 	}
+	RcuShutdown(&gConfig);
+}
+
+void HookGetHealth( HookWatchStats* stats )
+{
+	AcquireSRWLockShared(&gWatchdogLock);
+	*stats = gWatchdog.stats;
+	ReleaseSRWLockShared(&gWatchdogLock);
 }
 
-void HookConfigure( const VKEY* vkeys, unsigned nkeys, unsigned tap_timeout_ms )
+bool HookConfigure( HookConfig* config )
 {
-	gConfVKeys = vkeys;
-	gConfVKeysCount = nkeys;
-	gConfTapTimeout_ms = tap_timeout_ms;
+	if( !RcuPublish(&gConfig, config) )  return LOG("too many pending configs"), false;
+	return true;
 }
 
 bool HookPauseResume( bool should_work )
@@ -4,19 +4,50 @@
 #include <stdbool.h>
 #include <windows.h>
 #include "common.h"
+#include "keyhist.h"
+#include "hookwatch.h"
+
+enum { HOOK_MAX_KEYS = 8 };
+
+// An immutable configuration snapshot. The application can embed it as the first
+// member of a larger struct: AppHookNotify receives the snapshot the event was matched against.
+typedef struct
+{
+	unsigned  tap_timeout_ms;
+	unsigned  nkeys;
+	VKEY      vkeys [HOOK_MAX_KEYS];
+	KeyHistory*  history;   // where to record the keystrokes typed, if anywhere
+} HookConfig;
 
 // ---- provided by kbswhook.c -------------------------------------------------
 
-// vkeys must live until HookShutdown
-void HookConfigure( const VKEY* vkeys, unsigned nkeys, unsigned tap_timeout_ms );
+// Publishes a new configuration, effective from the next keyboard event; can be called
+// before or after HookStart, always from the same thread.
+// `config` must come from malloc; the hook takes ownership and frees it once the hook
+// thread is known to have stopped using it. Returns false if too many previous snapshots
+// are still in use; `config` then stays with the caller.
+bool HookConfigure( HookConfig* config );
+// Starts the hook thread, without waiting for it: the thread reports with AppHookStarted.
 bool HookStart( void );
 void HookShutdown( void );
 bool HookPauseResume( bool should_work );  // false to pause, true to resume
+// What the watchdog has seen of the hook: probes, reinstalls, the slowest callback.
+void HookGetHealth( HookWatchStats* stats );
 
 // ---- should be defined by the application -----------------------------------
 
+// The ones called on the hook thread must not block (post, don't send): a hook that
+// once takes longer than LowLevelHooksTimeout is removed by Windows.
+
 HWND AppHookCreateMessageWindow( WNDPROC wndproc );
 void AppHookMessageLoop( void );
-void AppHookNotify( unsigned index, bool any_modifier_pressed );
+// Called on the hook thread once the hook is installed (or has failed to be), before
+// the first AppHookNotify or AppHookKeysRecorded.
+void AppHookStarted( bool ok );
+void AppHookNotify( const HookConfig* config, unsigned index, bool any_modifier_pressed );
+// Called when keystrokes have been recorded into a waiting HookConfig.history (see keyhist.h).
+void AppHookKeysRecorded( const HookConfig* config );
+// Called on the watchdog thread when what HookGetHealth returns has changed.
+void AppHookHealthChanged( void );
 
 #endif
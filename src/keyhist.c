@@ -0,0 +1,52 @@
+// The ring of keystrokes between the hook thread and the main thread (see keyhist.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <string.h>
+#include "keyhist.h"
+
+void KeyHistoryInit( KeyHistory* h )
+{
+	memset(h->items, 0, sizeof(h->items));
+	atomic_init(&h->head, 0);
+	atomic_init(&h->tail, 0);
+	atomic_init(&h->waiting, false);
+	atomic_init(&h->dropped, 0);
+}
+
+bool KeyHistoryPush( KeyHistory* h, const Keystroke* ks )
+{
+	unsigned head = atomic_load_explicit(&h->head, memory_order_relaxed);
+	unsigned tail = atomic_load_explicit(&h->tail, memory_order_acquire);
+	if( head - tail == KEYHIST_SIZE )
+	{
+		atomic_fetch_add_explicit(&h->dropped, 1, memory_order_relaxed);
+		return false;   // the consumer has been woken up already
+	}
+
+	h->items[head % KEYHIST_SIZE] = *ks;
+
+	// (sequentially consistent, as the store of `waiting` and the load of `head` in
+	// KeyHistoryWait: either the consumer sees the new head, or this sees it waiting)
+	atomic_store(&h->head, head + 1);
+	return atomic_exchange(&h->waiting, false);
+}
+
+bool KeyHistoryPop( KeyHistory* h, Keystroke* ks )
+{
+	unsigned tail = atomic_load_explicit(&h->tail, memory_order_relaxed);
+	unsigned head = atomic_load_explicit(&h->head, memory_order_acquire);
+	if( head == tail )  return false;
+
+	*ks = h->items[tail % KEYHIST_SIZE];
+	atomic_store_explicit(&h->tail, tail + 1, memory_order_release);
+	return true;
+}
+
+bool KeyHistoryWait( KeyHistory* h )
+{
+	atomic_store(&h->waiting, true);
+	unsigned head = atomic_load(&h->head);
+	return head == atomic_load_explicit(&h->tail, memory_order_relaxed);
+}
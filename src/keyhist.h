@@ -0,0 +1,77 @@
+#ifndef KEYHIST_H
+#define KEYHIST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+// The keystrokes seen by the hook, on their way to the main thread: a single-producer,
+// single-consumer ring. The hook thread only appends to it, which takes a few stores and
+// never waits; the main thread does everything else with them, in batches.
+//
+// To be told when there is something to read, the consumer arms the ring after it has
+// emptied it (KeyHistoryWait); the next append then returns true, once, and the producer
+// wakes the consumer up (e.g. with a posted message). So there is at most one wake-up
+// per batch, however fast the keys come.
+//
+// If the consumer falls behind, the keystrokes that don't fit are dropped and counted.
+
+enum { KEYHIST_SIZE = 256 };   // a power of 2
+
+typedef struct
+{
+	uint16_t  scancode;   // set 1; with 0xE000 for the extended keys
+	uint8_t   flags;      // KS_xxx
+	uint32_t  time_ms;
+} Keystroke;
+
+enum { KS_UP = 1 };
+
+// the scancodes of the keys the consumers care about
+enum
+{
+	SC_ESCAPE = 0x01,
+	SC_BACKSPACE = 0x0E,
+	SC_TAB = 0x0F,
+	SC_ENTER = 0x1C,
+	SC_LCTRL = 0x1D,
+	SC_LSHIFT = 0x2A,
+	SC_RSHIFT = 0x36,
+	SC_LALT = 0x38,
+	SC_SPACE = 0x39,
+	SC_CAPSLOCK = 0x3A,
+	SC_SCROLLLOCK = 0x46,
+	SC_NUMPAD_ENTER = 0xE01C,
+	SC_NUMLOCK = 0xE045,
+	SC_RCTRL = 0xE01D,
+	SC_RALT = 0xE038,    // AltGr
+	SC_LWIN = 0xE05B,
+	SC_RWIN = 0xE05C,
+};
+
+typedef struct
+{
+	Keystroke    items [KEYHIST_SIZE];
+	atomic_uint  head;      // the next one to write; only the producer changes it
+	atomic_uint  tail;      // the next one to read; only the consumer changes it
+	atomic_bool  waiting;   // the consumer wants to be woken up
+	atomic_uint  dropped;
+} KeyHistory;
+
+
+// ---- provided by keyhist.c --------------------------------------------------
+
+void KeyHistoryInit( KeyHistory* h );
+
+// Producer: appends the keystroke (or drops it, if full); returns true if the consumer
+// should be woken up.
+bool KeyHistoryPush( KeyHistory* h, const Keystroke* ks );
+
+// Consumer: takes the oldest keystroke; returns false if there are none.
+bool KeyHistoryPop( KeyHistory* h, Keystroke* ks );
+
+// Consumer: asks to be woken up by the next push; returns false if there are keystrokes
+// already (which have to be read first: no wake-up will come for them).
+bool KeyHistoryWait( KeyHistory* h );
+
+#endif
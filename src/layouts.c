@@ -0,0 +1,145 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "layouts.h"
+#include "common.h"
+
+enum
+{
+	LAYOUTS_SPARE        = 8,   // room in the buffer for layouts added while it is filled
+	LAYOUTS_MAX_ATTEMPTS = 8,
+};
+
+void LayoutRegistryInit( LayoutRegistry* reg, const LayoutProvider* provider )
+{
+	*reg = (LayoutRegistry){ .provider = *provider, .stale = true };
+}
+
+static void FreeLayouts( LayoutInfo* layouts, size_t count )
+{
+	for( size_t i = 0; i < count; ++i )
+	{
+		free(layouts[i].name);
+	}
+	free(layouts);
+}
+
+void LayoutRegistryFree( LayoutRegistry* reg )
+{
+	FreeLayouts(reg->layouts, reg->count);
+	reg->layouts = NULL;
+	reg->count = 0;
+	reg->stale = true;
+}
+
+void LayoutRegistryInvalidate( LayoutRegistry* reg )
+{
+	reg->stale = true;
+}
+
+static void Refresh( LayoutRegistry* reg )
+{
+	const LayoutProvider* p = &reg->provider;
+
+	// The list can change between the two calls, and the provider only says how many it
+	// has filled in: a full buffer may have been too small. So the buffer has room to
+	// spare, and if even that is filled, the count is asked for again.
+	LayoutHandle* handles = NULL;
+	size_t n = p->enumerate(p->ctx, NULL, 0);
+	for( unsigned attempt = 1; ; ++attempt )
+	{
+		size_t capacity = n + LAYOUTS_SPARE;
+		LayoutHandle* h = realloc(handles, capacity * sizeof(*handles));
+		if( h == NULL )  { free(handles); return LOG("out of memory"); }
+		handles = h;
+		n = p->enumerate(p->ctx, handles, capacity);
+		if( n < capacity )  break;
+
+		n = capacity;
+		if( attempt == LAYOUTS_MAX_ATTEMPTS )
+		{
+			LOG("the layout list keeps growing; %u of them taken", (unsigned)n);
+			break;
+		}
+		size_t total = p->enumerate(p->ctx, NULL, 0);
+		if( total > n )  n = total;
+	}
+
+	LayoutInfo* layouts = calloc(n ? n : 1, sizeof(*layouts));
+	if( layouts == NULL )  { free(handles); return LOG("out of memory"); }
+
+	for( size_t i = 0; i < n; ++i )
+	{
+		layouts[i].handle = handles[i];
+		if( !p->get_id(p->ctx, handles[i], layouts[i].id) )  layouts[i].id[0] = 0;
+
+		// keep the name fetched before, if any
+		for( size_t j = 0; j < reg->count; ++j )
+		{
+			LayoutInfo* old = &reg->layouts[j];
+			if( old->name && (strcmp(old->id, layouts[i].id) == 0) )
+			{
+				layouts[i].name = old->name;
+				old->name = NULL;
+				break;
+			}
+		}
+	}
+	free(handles);
+
+	FreeLayouts(reg->layouts, reg->count);
+	reg->layouts = layouts;
+	reg->count = n;
+	reg->stale = false;
+	++reg->generation;
+	LOG("%u layouts", (unsigned)n);
+}
+
+size_t LayoutRegistryCount( LayoutRegistry* reg )
+{
+	if( reg->stale )  Refresh(reg);
+	return reg->count;
+}
+
+const LayoutInfo* LayoutRegistryAt( LayoutRegistry* reg, size_t index )
+{
+	return (index < LayoutRegistryCount(reg)) ? &reg->layouts[index] : NULL;
+}
+
+const LayoutInfo* LayoutRegistryFindHandle( LayoutRegistry* reg, LayoutHandle handle )
+{
+	for( size_t i = 0, n = LayoutRegistryCount(reg); i < n; ++i )
+	{
+		if( reg->layouts[i].handle == handle )  return &reg->layouts[i];
+	}
+	return NULL;
+}
+
+const LayoutInfo* LayoutRegistryFindId( LayoutRegistry* reg, const char* id )
+{
+	for( size_t i = 0, n = LayoutRegistryCount(reg); i < n; ++i )
+	{
+		if( strcmp(reg->layouts[i].id, id) == 0 )  return &reg->layouts[i];
+	}
+	return NULL;
+}
+
+const char* LayoutRegistryName( LayoutRegistry* reg, const LayoutInfo* layout )
+{
+	if( layout->name )  return layout->name;
+
+	char name [256];
+	const LayoutProvider* p = &reg->provider;
+	if( !layout->id[0] || !p->get_name(p->ctx, layout->id, name, sizeof(name)) )
+		return "?";
+
+	size_t size = strlen(name) + 1;
+	char* copy = malloc(size);
+	if( copy == NULL )  return "?";
+	memcpy(copy, name, size);
+
+	// the entries are owned by the registry; only the name cache is mutable
+	((LayoutInfo*)layout)->name = copy;
+	return copy;
+}
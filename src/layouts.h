@@ -0,0 +1,68 @@
+#ifndef LAYOUTS_H
+#define LAYOUTS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// A registry of the installed keyboard layouts: enumerates them once and caches
+// the handle <-> layout id <-> display name mappings until told to refresh
+// (on layout/settings change notifications). Any number of layouts is supported.
+//
+// The actual system queries go through a LayoutProvider.
+
+typedef uintptr_t LayoutHandle;  // HKL on Windows
+
+enum { LAYOUT_ID_SIZE = 16 };    // KLID (8 hex digits) on Windows, plus a terminator and some room
+
+typedef struct
+{
+	// Fills in up to `max` handles and returns how many it has filled in; with `max` 0,
+	// how many layouts there are. The list can change between the calls.
+	size_t (*enumerate)( void* ctx, LayoutHandle* handles, size_t max );
+	bool   (*get_id)( void* ctx, LayoutHandle handle, char id [LAYOUT_ID_SIZE] );
+	bool   (*get_name)( void* ctx, const char* id, char* name, size_t name_size );
+	void*  ctx;
+} LayoutProvider;
+
+typedef struct
+{
+	LayoutHandle  handle;
+	char          id [LAYOUT_ID_SIZE];   // "" if not known
+	char*         name;                  // NULL until first asked for (see LayoutRegistryName)
+} LayoutInfo;
+
+typedef struct
+{
+	LayoutProvider  provider;
+	LayoutInfo*     layouts;
+	size_t          count;
+	bool            stale;
+	unsigned        generation;   // incremented by each refresh
+} LayoutRegistry;
+
+
+// ---- provided by layouts.c --------------------------------------------------
+
+void LayoutRegistryInit( LayoutRegistry* reg, const LayoutProvider* provider );
+void LayoutRegistryFree( LayoutRegistry* reg );
+
+// Makes the next access re-enumerate the layouts. Names are kept for the ids still present.
+void LayoutRegistryInvalidate( LayoutRegistry* reg );
+
+// These refresh the registry first if it is stale.
+size_t            LayoutRegistryCount( LayoutRegistry* reg );
+const LayoutInfo* LayoutRegistryAt( LayoutRegistry* reg, size_t index );
+const LayoutInfo* LayoutRegistryFindHandle( LayoutRegistry* reg, LayoutHandle handle );
+const LayoutInfo* LayoutRegistryFindId( LayoutRegistry* reg, const char* id );
+
+// Returns the display name of the layout, fetching it on first use; "?" if unknown.
+const char* LayoutRegistryName( LayoutRegistry* reg, const LayoutInfo* layout );
+
+
+// ---- provided by layouts_win.c ----------------------------------------------
+
+// The registry of the layouts installed in the system, created on first use.
+LayoutRegistry* SystemLayouts( void );
+
+#endif
@@ -0,0 +1,104 @@
+// The Windows LayoutProvider: HKLs from GetKeyboardLayoutList, KLIDs derived from
+// the HKLs (without activating each layout), names from the registry.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <windows.h>
+#include "layouts.h"
+#include "common.h"
+
+static const char kKeyboardLayoutsKey [] = "SYSTEM\\CurrentControlSet\\Control\\Keyboard Layouts";
+
+static size_t EnumerateLayouts( void* _, LayoutHandle* handles, size_t max )
+{
+	int n = GetKeyboardLayoutList(0, NULL);
+	if( (max == 0) || (n <= 0) )  return (n > 0) ? n : 0;
+
+	HKL* hkls = (HKL*) handles;  // same size; converted in place below
+	static_assert(sizeof(HKL) == sizeof(LayoutHandle), "HKL must fit LayoutHandle");
+	n = GetKeyboardLayoutList(max, hkls);
+	if( n == 0 )  ERR("GetKeyboardLayoutList");
+
+	for( int i = 0; i < n; ++i )
+	{
+		handles[i] = (LayoutHandle) hkls[i];
+	}
+	return n;
+}
+
+// Finds the KLID whose "Layout Id" value is `layout_id` (for the non-default
+// layouts of a language, such as Dvorak, the HKL only holds this id).
+static bool FindLayoutIdKlid( unsigned layout_id, char id [LAYOUT_ID_SIZE] )
+{
+	HKEY hkey;
+	if( RegOpenKeyExA(HKEY_LOCAL_MACHINE, kKeyboardLayoutsKey, 0, KEY_READ, &hkey) != ERROR_SUCCESS )
+		return ERR("RegOpenKeyEx"), false;
+
+	bool found = false;
+	char klid [LAYOUT_ID_SIZE];
+	for( DWORD i = 0; !found; ++i )
+	{
+		DWORD klid_len = sizeof(klid);
+		if( RegEnumKeyExA(hkey, i, klid, &klid_len, NULL, NULL, NULL, NULL) != ERROR_SUCCESS )  break;
+
+		char value [16];
+		DWORD value_size = sizeof(value);
+		if( RegGetValueA(hkey, klid, "Layout Id", RRF_RT_REG_SZ, NULL, value, &value_size) != ERROR_SUCCESS )
+			continue;
+
+		if( strtoul(value, NULL, 16) == layout_id )
+		{
+			memcpy(id, klid, klid_len + 1);
+			found = true;
+		}
+	}
+
+	RegCloseKey(hkey);
+	return found;
+}
+
+static bool GetLayoutId( void* _, LayoutHandle handle, char id [LAYOUT_ID_SIZE] )
+{
+	DWORD hkl = (DWORD)(uintptr_t) handle;
+	WORD device = HIWORD(hkl);
+
+	switch( device & 0xF000 )
+	{
+		case 0xF000:  // a layout variant: the low bits are its "Layout Id"
+			return FindLayoutIdKlid(device & 0x0FFF, id);
+
+		case 0xE000:  // an IME: the KLID is the HKL itself
+			snprintf(id, LAYOUT_ID_SIZE, "%08lX", (unsigned long)hkl);
+			return true;
+
+		default:      // the default layout of a language
+			snprintf(id, LAYOUT_ID_SIZE, "%08X", (unsigned)device);
+			return true;
+	}
+}
+
+static bool GetLayoutName( void* _, const char* id, char* name, size_t name_size )
+{
+	char path [256];
+	snprintf(path, COUNTOF(path), "%s\\%s", kKeyboardLayoutsKey, id);
+
+	DWORD namesz = name_size;
+	return RegGetValueA(HKEY_LOCAL_MACHINE, path, "Layout Text", RRF_RT_REG_SZ, NULL, name, &namesz) == ERROR_SUCCESS;
+}
+
+LayoutRegistry* SystemLayouts( void )
+{
+	static LayoutRegistry reg;
+	static bool initialized = false;
+	if( !initialized )
+	{
+		const LayoutProvider provider = { EnumerateLayouts, GetLayoutId, GetLayoutName, NULL };
+		LayoutRegistryInit(&reg, &provider);
+		initialized = true;
+	}
+	return &reg;
+}
@@ -0,0 +1,287 @@
+// The detection of the words typed in a wrong layout (see livedetect.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include "livedetect.h"
+#include "casemap.h"
+#include "common.h"
+#include "ngramtab.h"
+
+enum
+{
+	NOT_A_WORD = LIVE_MAX_WORD + 1,   // LiveDetector.length until the next word boundary
+
+	// LiveDetector.modifiers
+	MOD_SHIFT = 1 | 2,
+	MOD_CTRL  = 4,
+	MOD_ALT   = 8,
+	MOD_WIN   = 16,
+	MOD_ALTGR = 32,
+};
+
+const LangModel* LangModelFind( const char* language )
+{
+	for( unsigned i = 0; i < COUNTOF(kLangModels); ++i )
+	{
+		if( strcmp(kLangModels[i].language, language) == 0 )  return &kLangModels[i];
+	}
+	return NULL;
+}
+
+static unsigned SymbolOf( const LangModel* m, UTF16 ch )
+{
+	UTF16 lower = (UTF16)CaseToLower(ch);
+	unsigned lo = 0, hi = m->nsymbols - 2;
+	while( lo < hi )
+	{
+		unsigned mid = (lo + hi) / 2;
+		if( m->letters[mid] < lower )  lo = mid + 1;
+		else hi = mid;
+	}
+	return ((lo < m->nsymbols - 2u) && (m->letters[lo] == lower)) ? lo + 2 : 1;
+}
+
+void LiveKeymapInit( LiveKeymap* km, LayoutHandle layout, const char* language,
+                     const UTF16 chars [LIVE_SCANCODES][2] )
+{
+	km->layout = layout;
+	km->model = LangModelFind(language);
+	memcpy(km->chars, chars, sizeof(km->chars));
+	for( unsigned sc = 0; sc < LIVE_SCANCODES; ++sc )
+	{
+		for( unsigned shifted = 0; shifted < 2; ++shifted )
+			km->symbols[sc][shifted] = km->model ? SymbolOf(km->model, chars[sc][shifted]) : 1;
+	}
+}
+
+// what it costs for `c` to follow `a` and `b`, in bits
+static unsigned Cost( const LangModel* m, unsigned a, unsigned b, unsigned c )
+{
+	unsigned row = m->contexts[a * m->nsymbols + b];
+	uint8_t costs = m->costs[row * ((m->nsymbols + 1) / 2) + c / 2];
+	return (c & 1) ? (costs >> 4) : (costs & 15);
+}
+
+// ---- the detector -----------------------------------------------------------
+
+static void StartWord( LiveDetector* d )
+{
+	d->length = 0;
+	d->reported = false;
+	memset(d->symbols[0], 0, sizeof(d->symbols[0]) * 2);
+	memset(d->costs[0], 0, sizeof(d->costs[0]));
+}
+
+void LiveDetectorInit( LiveDetector* d, const LiveKeymap* const* keymaps, unsigned count )
+{
+	memset(d, 0, sizeof(*d));
+	for( unsigned i = 0; (i < count) && (d->nkeymaps < LIVE_MAX_LAYOUTS); ++i )
+	{
+		if( keymaps[i]->model )  d->keymaps[d->nkeymaps++] = keymaps[i];
+	}
+	d->current = -1;
+	StartWord(d);
+}
+
+void LiveDetectorReset( LiveDetector* d )
+{
+	d->modifiers = 0;
+	d->last_length = 0;
+	StartWord(d);
+}
+
+void LiveDetectorSetCurrent( LiveDetector* d, LayoutHandle layout )
+{
+	d->current = -1;
+	for( unsigned i = 0; i < d->nkeymaps; ++i )
+	{
+		if( d->keymaps[i]->layout == layout )  d->current = i;
+	}
+}
+
+// whether the keys of the word type the same in the two layouts (so that it makes no
+// difference which one it is)
+static bool SameText( const LiveDetector* d, const LiveKeymap* a, const LiveKeymap* b )
+{
+	for( unsigned k = 0; k < d->length; ++k )
+	{
+		unsigned sc = d->keys[k] & 0x7F, shifted = d->keys[k] >> 7;
+		if( a->chars[sc][shifted] != b->chars[sc][shifted] )  return false;
+	}
+	return true;
+}
+
+// the keymap of the layout the word costs the least in, if the current layout loses to
+// it by enough over `nsymbols`; before the word has ended, the others must lose to it
+// by as much too. The layouts that type the word the same as the current one count as
+// the current one (with the least of their costs).
+static const LiveKeymap* Verdict( LiveDetector* d, const unsigned* totals, unsigned nsymbols, bool ended )
+{
+	if( d->reported || (d->current < 0) )  return NULL;
+
+	const LiveKeymap* current = d->keymaps[d->current];
+	unsigned stay = totals[d->current], best = UINT_MAX, second = UINT_MAX;
+	for( unsigned i = 0; i < d->nkeymaps; ++i )
+	{
+		if( (i == (unsigned)d->current) || SameText(d, d->keymaps[i], current) )
+		{
+			if( totals[i] < stay )  stay = totals[i];
+		}
+		else if( (best == UINT_MAX) || (totals[i] < totals[best]) )
+		{
+			second = best;
+			best = i;
+		}
+		else if( (second == UINT_MAX) || (totals[i] < totals[second]) )  second = i;
+	}
+	unsigned margin = LIVE_MARGIN * nsymbols;
+	if( (best == UINT_MAX) || (totals[best] > stay) || ((stay - totals[best]) * 8 < margin) )  return NULL;
+	if( !ended && (second != UINT_MAX) && ((totals[second] - totals[best]) * 8 < margin) )  return NULL;
+
+	d->reported = true;
+	return d->keymaps[best];
+}
+
+static const LiveKeymap* EndWord( LiveDetector* d )
+{
+	unsigned n = d->length, totals [LIVE_MAX_LAYOUTS] = {0};
+	if( (n == NOT_A_WORD) || (n < LIVE_MIN_KEYS_AT_END) )  return NULL;
+
+	for( unsigned i = 0; i < d->nkeymaps; ++i )
+		totals[i] = d->costs[n][i] + Cost(d->keymaps[i]->model, d->symbols[n][i], d->symbols[n + 1][i], 0);
+	return Verdict(d, totals, n + 1, true);
+}
+
+static unsigned ModifierOf( unsigned scancode )
+{
+	switch( scancode )
+	{
+		case SC_LSHIFT:  return 1;
+		case SC_RSHIFT:  return 2;
+		case SC_LCTRL:
+		case SC_RCTRL:   return MOD_CTRL;
+		case SC_LALT:    return MOD_ALT;
+		case SC_RALT:    return MOD_ALTGR;
+		case SC_LWIN:
+		case SC_RWIN:    return MOD_WIN;
+	}
+	return 0;
+}
+
+// the keys of the main block that type something (the rest move around, or aren't words)
+static bool IsTypingKey( unsigned sc )
+{
+	return ((sc >= 0x02) && (sc <= 0x0D)) || ((sc >= 0x10) && (sc <= 0x1B))
+	    || ((sc >= 0x1E) && (sc <= 0x29)) || ((sc >= 0x2B) && (sc <= 0x35)) || (sc == 0x56);
+}
+
+const LiveKeymap* LiveDetectorFeed( LiveDetector* d, const Keystroke* ks, unsigned dropped )
+{
+	if( dropped != d->dropped )
+	{
+		// some keystrokes are missing, maybe key releases too
+		d->dropped = dropped;
+		LiveDetectorReset(d);
+		d->length = NOT_A_WORD;
+	}
+
+	unsigned mod = ModifierOf(ks->scancode);
+	if( mod )
+	{
+		d->modifiers = (ks->flags & KS_UP) ? (d->modifiers & ~mod) : (d->modifiers | mod);
+		return NULL;
+	}
+	if( ks->flags & KS_UP )  return NULL;
+
+	switch( ks->scancode )
+	{
+		case SC_CAPSLOCK:
+		case SC_NUMLOCK:
+		case SC_SCROLLLOCK:
+			return NULL;
+
+		case SC_SPACE:
+			if( (d->length == 0) && d->last_length )
+			{
+				++d->spaces;
+				return NULL;
+			}
+			// fall through
+		case SC_ENTER:
+		case SC_NUMPAD_ENTER:
+		case SC_TAB:
+		{
+			const LiveKeymap* verdict = EndWord(d);
+			bool keep = (ks->scancode == SC_SPACE) && (d->length >= 1) && (d->length <= LIVE_MAX_WORD);
+			d->last_length = keep ? d->length : 0;
+			d->last_reported = d->reported;
+			d->spaces = 1;
+			StartWord(d);
+			return verdict;
+		}
+
+		case SC_BACKSPACE:
+			if( (d->length == 0) && d->last_length )
+			{
+				// back to the end of the last word: it is the one being typed again
+				if( --d->spaces == 0 )
+				{
+					d->length = d->last_length;
+					d->reported = d->last_reported;
+					d->last_length = 0;
+				}
+			}
+			// (back into the word before, which can't be told from here)
+			else if( d->length == 0 )  d->length = NOT_A_WORD;
+			else if( d->length != NOT_A_WORD )  --d->length;
+			return NULL;
+	}
+	d->last_length = 0;
+
+	// with AltGr the keys type something else, which doesn't count as letters (and the
+	// Ctrl that comes with it is not a shortcut)
+	bool altgr = d->modifiers & MOD_ALTGR;
+	if( !IsTypingKey(ks->scancode) || (!altgr && (d->modifiers & (MOD_CTRL | MOD_ALT | MOD_WIN))) )
+	{
+		d->length = NOT_A_WORD;
+		return NULL;
+	}
+	if( d->length >= LIVE_MAX_WORD )
+	{
+		d->length = NOT_A_WORD;
+		return NULL;
+	}
+
+	unsigned n = d->length++, sc = ks->scancode, shifted = !!(d->modifiers & MOD_SHIFT), totals [LIVE_MAX_LAYOUTS];
+	d->keys[n] = altgr ? 0 : (sc | (shifted << 7));
+	for( unsigned i = 0; i < d->nkeymaps; ++i )
+	{
+		const LiveKeymap* km = d->keymaps[i];
+		unsigned c = altgr ? 1 : km->symbols[sc][shifted];
+		d->symbols[n + 2][i] = c;
+		totals[i] = d->costs[n + 1][i] = d->costs[n][i] + Cost(km->model, d->symbols[n][i], d->symbols[n + 1][i], c);
+	}
+	return (n + 1 >= LIVE_MIN_KEYS) ? Verdict(d, totals, n + 1, false) : NULL;
+}
+
+unsigned LiveDetectorLastWord( const LiveDetector* d, const uint8_t** pkeys, unsigned* pspaces, bool* preported )
+{
+	*pkeys = d->keys;
+	if( (d->length == 0) && d->last_length )
+	{
+		*pspaces = d->spaces;
+		*preported = d->last_reported;
+		return d->last_length;
+	}
+	*pspaces = 0;
+	*preported = d->reported;
+	return (d->length <= LIVE_MAX_WORD) ? d->length : 0;
+}
+
+void LiveDetectorSettle( LiveDetector* d )
+{
+	if( d->length == 0 )  d->last_length = 0;
+	else d->length = NOT_A_WORD;
+}
@@ -0,0 +1,116 @@
+#ifndef LIVEDETECT_H
+#define LIVEDETECT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "translate.h"
+#include "layouts.h"
+#include "keyhist.h"
+
+// Detects words being typed in a wrong keyboard layout, as they are typed.
+//
+// The keystrokes (see keyhist.h) are read in every configured layout at once: the keys
+// of the word so far are kept, and for each layout the text they type is scored by a
+// letter trigram model of the language of the layout (the cost of a word is -log2 of
+// its probability, in bits). Each keystroke adds a cost per layout, from a table,
+// so it takes O(1) per layout; a backspace takes one back. When the text in another
+// layout costs much less than in the current one, that layout is the likely one.
+//
+// The models are in ngramtab.h, generated by tools/ngramgen.c from plain text. The
+// symbols of a model are: 0 the word boundary, 1 anything that is not one of its
+// letters, then the letters (lower case).
+
+enum
+{
+	LIVE_MAX_LAYOUTS = 8,
+	LIVE_MAX_WORD = 32,       // keys; a longer run of keys is not a word
+	LIVE_SCANCODES = 0x80,    // the keys that type something (set 1, not extended)
+	LIVE_MIN_KEYS = 4,        // before a verdict mid-word
+	LIVE_MIN_KEYS_AT_END = 2, // ... and once the word has ended
+	LIVE_MARGIN = 12,         // what the current layout must lose by, per key, in 1/8 bits
+};
+
+typedef struct
+{
+	char             language [4];   // ISO 639-1 ("en")
+	uint8_t          nsymbols;
+	const UTF16*     letters;        // sorted; nsymbols - 2 of them
+	const uint16_t*  contexts;       // [a * nsymbols + b]: the row of the costs of what follows "a b"
+	const uint8_t*   costs;          // the rows, of nsymbols nibbles (the even symbols in the low ones),
+	                                 // padded to a byte
+} LangModel;
+
+// What the keys type in a layout, and which symbols of its model that is.
+typedef struct
+{
+	LayoutHandle      layout;
+	const LangModel*  model;                          // NULL if there is none for its language
+	UTF16             chars [LIVE_SCANCODES][2];      // unshifted and shifted; 0 for nothing
+	uint8_t           symbols [LIVE_SCANCODES][2];
+} LiveKeymap;
+
+typedef struct
+{
+	const LiveKeymap*  keymaps [LIVE_MAX_LAYOUTS];   // the ones with a model
+	unsigned           nkeymaps;
+	int                current;     // the index of the current layout in keymaps, or -1
+
+	uint8_t            modifiers;   // the modifier keys held down
+	unsigned           dropped;     // KeyHistory.dropped last seen
+
+	// the word so far: its keys, and for each layout the symbols they type (after two
+	// boundaries) and the costs of the first n keys
+	unsigned           length;      // LIVE_MAX_WORD + 1 when not in a word
+	uint8_t            keys [LIVE_MAX_WORD];          // scancode | 0x80 if shifted; 0 if with AltGr
+	uint8_t            symbols [LIVE_MAX_WORD + 2][LIVE_MAX_LAYOUTS];
+	uint16_t           costs [LIVE_MAX_WORD + 1][LIVE_MAX_LAYOUTS];
+	bool               reported;    // a verdict has been given for this word
+
+	// the word before, while only spaces have been typed after it (its keys etc. stay
+	// in place until the next word starts); its length, or 0
+	unsigned           last_length;
+	unsigned           spaces;
+	bool               last_reported;
+} LiveDetector;
+
+
+// ---- provided by livedetect.c -----------------------------------------------
+
+// The model for the language, or NULL.
+const LangModel* LangModelFind( const char* language );
+
+// Fills in the symbols for the `chars` (see LiveKeymap).
+void LiveKeymapInit( LiveKeymap* km, LayoutHandle layout, const char* language,
+                     const UTF16 chars [LIVE_SCANCODES][2] );
+
+// Keymaps without a model are left out; they must stay in place while in use.
+void LiveDetectorInit( LiveDetector* d, const LiveKeymap* const* keymaps, unsigned count );
+
+// Forgets the word being typed (e.g. when the focus moves).
+void LiveDetectorReset( LiveDetector* d );
+
+// The layout the keys type in (from the next keystroke); if it isn't one of the
+// keymaps, there are no verdicts.
+void LiveDetectorSetCurrent( LiveDetector* d, LayoutHandle layout );
+
+// Takes the next keystroke; returns the keymap of the layout the word is likely meant
+// for, when it is time to tell (once per word), otherwise NULL. `dropped` is that of
+// the KeyHistory it comes from.
+const LiveKeymap* LiveDetectorFeed( LiveDetector* d, const Keystroke* ks, unsigned dropped );
+
+// The keys of the word just typed: the one being typed (then `*pspaces` is 0), or else
+// the last one, with the spaces typed after it. Returns how many keys there are, 0 if
+// there is no such word. `*preported` tells if there was a verdict for it.
+unsigned LiveDetectorLastWord( const LiveDetector* d, const uint8_t** pkeys, unsigned* pspaces, bool* preported );
+
+// Forgets the word just typed (e.g. it has been retyped in the right layout): no more
+// verdicts for it, and LiveDetectorLastWord has none until the next one.
+void LiveDetectorSettle( LiveDetector* d );
+
+
+// ---- provided by livedetect_win.c -------------------------------------------
+
+// Reads what the keys type in the layout, with the model of its language.
+bool LiveKeymapLoad( LiveKeymap* km, LayoutHandle layout );
+
+#endif
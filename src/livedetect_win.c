@@ -0,0 +1,41 @@
+// What the keys type in a Windows keyboard layout, for the live detection (see livedetect.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <windows.h>
+#include "livedetect.h"
+#include "common.h"
+
+#define TUE_KEEPKBSTATE  4   // don't touch the dead key state (Windows 10 1607 and later)
+
+bool LiveKeymapLoad( LiveKeymap* km, LayoutHandle layout )
+{
+	HKL hkl = (HKL) layout;
+	static UTF16 chars [LIVE_SCANCODES][2];
+	memset(chars, 0, sizeof(chars));
+
+	BYTE keystate [256] = {0};
+	for( unsigned sc = 1; sc < LIVE_SCANCODES; ++sc )
+	{
+		UINT vk = MapVirtualKeyExW(sc, MAPVK_VSC_TO_VK, hkl);
+		if( vk == 0 )  continue;
+
+		for( unsigned shifted = 0; shifted < 2; ++shifted )
+		{
+			keystate[VK_SHIFT] = shifted ? 0x80 : 0;
+			WCHAR out [4];
+			// (dead keys, and keys that type more than one unit, count as no letter)
+			if( ToUnicodeEx(vk, sc, keystate, out, COUNTOF(out), TUE_KEEPKBSTATE, hkl) == 1 )
+				chars[sc][shifted] = out[0];
+		}
+	}
+
+	char language [9] = "";
+	LCID lcid = MAKELCID(LOWORD((uintptr_t)hkl), SORT_DEFAULT);
+	if( GetLocaleInfoA(lcid, LOCALE_SISO639LANGNAME, language, sizeof(language)) == 0 )
+		return ERR("GetLocaleInfo"), false;
+
+	LiveKeymapInit(km, layout, language, chars);
+	return true;
+}
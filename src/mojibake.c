@@ -5,37 +5,43 @@
 #include <windows.h>
 #include "mojibake.h"
 #include "common.h"
+#include "stats.h"
+#include "layouts.h"
+#include "trace.h"
+#include "pipeline.h"
+#include "clipsave.h"
+#include "hex.h"
+#include "inject.h"
+#include "arena.h"
+
+
+// The timeouts are the defaults from pipeline.h. About the paste delay: for some reason,
+// sometimes paste right after SetKeyboardData doesn't work (observed in Far).
+static const PipelineTimeouts kTimeouts = PIPELINE_DEFAULT_TIMEOUTS;
+
+static Pipeline         gPipeline;
+static bool             gPipelineReady = false;
+static HWND             ghWorkerWnd;        // the nominal clipboard owner during a translation
+static uint64_t         gTranslationStart_us;
+static UINT_PTR         gTimer;
+static Translation      gTranslation;       // of the translation in progress
 
-
+// the user's clipboard contents, when preserving them (see clipsave.h)
 enum
 {
-	WMCOPY_TIMEOUT_ms = 100,
-	CTRL_INSERT_TIMEOUT_ms = 300,
-	PASTE_DELAY_ms = 100,  // for some reason, sometimes paste right after SetKeyboardData doesn't work (observed in Far)
+	RESTORE_DELAY_ms    = 500,                // after the paste keys, for the app to have read the clipboard
+	CLIPBOARD_BUDGET    = 16 * 1024 * 1024,   // bytes copied: a Full HD image as a DIB and a PNG
+	CLIPBOARD_BUDGET_ms = 100,                // spent retaining the formats, rendered for us by their app
 };
 
-typedef enum
-{
-	sIdle,
-	sWaitingForWmCopy,
-	sWaitingForKeyboardCopy,
-	sDelayBeforePaste,
-} State;
-
-typedef enum
-{
-	shNoSpecialHandling,
-	shIgnore,
-	shCtrlInsert,
-} SpecialHandling;
+static ClipSnapshot     gClipSnapshot;
+static HWND             ghClipOwner;        // NULL if not preserving
+static UINT_PTR         gRestoreTimer;
 
+// the buffers of a translation, given back as it ends (see arena.h)
+enum { ARENA_KEEP = ARENA_MIN_BLOCK };   // bytes kept between the translations
 
-static State            gState = sIdle;
-static HWND             ghWndTarget;
-static HKL              ghTargetLayout;
-static DWORD            gStartTime_ms;
-static UINT_PTR         gTimer;
-static SpecialHandling  gSpecialHandling;
+static Arena            gArena = { .keep = ARENA_KEEP };
 
 
 // -----------------------------------------------------------------------------
@@ -64,6 +70,7 @@ static SpecialHandling GetWindowSpecialHandling( HWND hwnd )
 	while( (exe != exepath) && (*exe != '/') && (*exe != '\\') ) --exe;
 	if( exe != exepath ) ++exe;
 	LOG("exe: %s", exe);
+	TRACE_DETAIL(trInstant, "target", hwnd, exe);
 
 	// check the list of exceptional exe names
 	for( unsigned i = 0; i < COUNTOF(kExeSpecialHandling); ++i )
@@ -86,103 +93,6 @@ static SpecialHandling GetWindowSpecialHandling( HWND hwnd )
 
 // -----------------------------------------------------------------------------
 
-#define UNICODE_CODESPACE_END  0x110000
-#define UNICODE_BMP_END        0x010000
-
-
-static WCHAR* AddCharToBuffer( WCHAR ch, WCHAR* buffer, size_t* pbuffer_cch )
-{
-	if( *pbuffer_cch > 0 )
-	{
-		*buffer++ = ch;
-		*pbuffer_cch -= 1;
-	}
-	return buffer;
-}
-
-static size_t OutputSizeForHexToUnicode( size_t source_cch )
-{
-	// any U+xxxxx substring converts to a shorter sequence (1 or 2 WCHARs)
-	// worst case: no U+xxxx substrings, input is copied as is
-	return source_cch;
-}
-
-// `output_text` must be large enough to fit `output_cch` chars NOT COUNTING the null terminator
-// Finds instances of U+xxxxx in `source_text` and replaces them with corresponding
-// Unicode characters. Copies the rest as is.
-static void TranslateHexToUnicode( const WCHAR* source_text,
-                                   WCHAR* output_text, size_t output_cch )
-{
-	WCHAR ch;
-	while( (ch = *source_text++) )
-	{
-		if( (ch == L'U') && (source_text[0] == L'+') && isxdigit(source_text[1]) )
-		{
-			WCHAR* eptr;
-			unsigned long u = wcstoul(source_text + 1, &eptr, 16);
-			if( (u < UNICODE_CODESPACE_END) && !IS_LOW_SURROGATE(u) && !IS_HIGH_SURROGATE(u) )
-			{
-				LOG("U+%lx", u);
-				if( u < UNICODE_BMP_END )
-				{
-					ch = (WCHAR) u;
-				}
-				else
-				{
-					u -= UNICODE_BMP_END;
-					WCHAR high_surrogate = (WCHAR)(((u >> 10) & 0x3ff) + HIGH_SURROGATE_START);
-					WCHAR low_surrogate = (WCHAR)((u & 0x3ff) + LOW_SURROGATE_START);
-					output_text = AddCharToBuffer(high_surrogate, output_text, &output_cch);
-					ch = low_surrogate;
-				}
-				source_text = eptr;
-			}
-		}
-		output_text = AddCharToBuffer(ch, output_text, &output_cch);
-	}
-	*output_text = 0;
-}
-
-static size_t OutputSizeForUnicodeToHex( size_t source_cch )
-{
-	// character itself, plus '=U+', plus the trailing ' ', plus up to 6 digits for the codepoint
-	return source_cch * (1 + 3 + 1 + 6);
-}
-
-// `output_text` must be large enough to fit `output_cch` chars NOT COUNTING the null terminator
-// Converts each source character into 'c=U+xxxxx ', where c is the original character
-// and xxxxx is its Unicode codepoint value.
-static void TranslateUnicodeToHex( const WCHAR* source_text,
-                                   WCHAR* output_text, size_t output_cch )
-{
-	uint32_t u;
-	while( (u = *source_text++) != 0 )
-	{
-		output_text = AddCharToBuffer(u, output_text, &output_cch);
-
-		uint32_t next_ch = source_text[0];
-		if( IS_SURROGATE_PAIR(u, next_ch) )
-		{
-			u = ((u - HIGH_SURROGATE_START) << 10)
-			  + (next_ch - LOW_SURROGATE_START)
-			  + UNICODE_BMP_END;
-			output_text = AddCharToBuffer(next_ch, output_text, &output_cch);
-			++source_text;
-		}
-
-		int n = snwprintf(output_text, output_cch + 1, L"=U+%02X ", u);
-		if( n > 0 )
-		{
-			output_text += n;
-			output_cch -= n;
-		}
-		else LOG("formatting failed (u=%x)", u);
-	}
-	*output_text = 0;
-}
-
-// -----------------------------------------------------------------------------
-
 #define VKS_NO_MAPPING       -1
 #define VKS_SHIFT            0x100
 #define VKS_CTRL             0x200
@@ -220,51 +130,95 @@ static unsigned TranslateChar( WCHAR ch, WCHAR** ppout, size_t* pout_remaining_c
 	return 0;
 }
 
-// `output_text` must be large enough to fit `output_cch` chars NOT COUNTING the null terminator
-static void TranslateBuffer( const WCHAR* source_text, WCHAR* output_text, size_t output_cch,
-                             HKL source_layout, HKL target_layout )
+// ---- the keyboard layout translator: the chars as they would be typed in another layout ----
+
+typedef struct { HKL source, target; } LayoutParams;
+
+static size_t LayoutMaxOutput( size_t n )
 {
-	WCHAR ch;
-	while( (ch = *source_text++) != 0 )
-	{
-		unsigned n = TranslateChar(ch, &output_text, &output_cch, source_layout, target_layout);
-		if( n == 0 )  output_text = AddCharToBuffer(ch, output_text, &output_cch);
-	}
-	*output_text = 0;
+	return n * 2;  // double in case target layout produces more UTF16 units
 }
 
-static HGLOBAL TranslateString( const WCHAR* source_text, HKL source_layout, HKL target_layout )
+static void LayoutInit( void* state, const void* params )
 {
-	size_t source_cch = wcslen(source_text);
-	size_t output_cch = (target_layout == HKL_UNICODE_TO_HEX) ? OutputSizeForUnicodeToHex(source_cch)
-	                  : (target_layout == HKL_HEX_TO_UNICODE) ? OutputSizeForHexToUnicode(source_cch)
-	                  : source_cch * 2;  // double in case target layout produces more UTF16 units
+	*(LayoutParams*)state = *(const LayoutParams*)params;
+}
 
-	HGLOBAL hmem = GlobalAlloc(GMEM_MOVEABLE, (output_cch + 1) * sizeof(WCHAR));
-	if( hmem == NULL )  return ERR("GlobalAlloc"), NULL;
+static void LayoutFeed( TrStage* stage, UTF16 unit )
+{
+	if( unit == 0 )  return;
+
+	const LayoutParams* lp = TR_STATE(stage, LayoutParams);
+	WCHAR chars [8];
+	WCHAR* pout = chars;
+	size_t remaining = COUNTOF(chars);
+	unsigned n = TranslateChar(unit, &pout, &remaining, lp->source, lp->target);
+	if( n == 0 )  TrEmit(stage, unit);
+	for( unsigned i = 0; i < n; ++i )  TrEmit(stage, chars[i]);
+}
+
+static const TranslatorClass kLayoutTranslator =
+{
+	.name = "LAYOUT",  // not registered: layouts are bound by their KLID
+	.description = "retype in another keyboard layout",
+	.max_output = LayoutMaxOutput,
+	.init = LayoutInit,
+	.feed = LayoutFeed,
+};
 
-	WCHAR* output_text = (WCHAR*) GlobalLock(hmem);
-	if( output_text == NULL )  return ERR("GlobalLock"), GlobalFree(hmem), NULL;
+// the translation is in gArena, valid until the reset
+static const WCHAR* TranslateString( const WCHAR* source_text, HKL source_layout, const Translation* t,
+                                     size_t* plength )
+{
+	static_assert(sizeof(WCHAR) == sizeof(UTF16), "WCHAR must be a UTF-16 unit");
+	static_assert(sizeof(LayoutParams) <= TR_STATE_SIZE, "LayoutParams don't fit in a stage");
 
-	if( target_layout == HKL_HEX_TO_UNICODE )
-	{
-		TranslateHexToUnicode(source_text, output_text, output_cch);
-	}
-	else if( target_layout == HKL_UNICODE_TO_HEX )
-	{
-		TranslateUnicodeToHex(source_text, output_text, output_cch);
-	}
-	else
-	{
-		TranslateBuffer(source_text, output_text, output_cch, source_layout, target_layout);
-	}
+	TrPipeline pipeline;
+	const LayoutParams lp = { .source = source_layout, .target = t->layout };
+	const TranslatorClass* const layout_classes [] = { &kLayoutTranslator };
+	const void* const layout_params [] = { &lp };
+	bool ok = t->layout ? TrPipelineInit(&pipeline, layout_classes, layout_params, 1)
+	                    : TrPipelineInit(&pipeline, t->translators, NULL, t->ntranslators);
+	if( !ok )  return LOG("bad translator chain"), NULL;
+
+	size_t source_cch = wcslen(source_text);
+	size_t output_cch = TrPipelineMaxOutput(&pipeline, source_cch);
+
+	WCHAR* output_text = (output_cch < SIZE_MAX / sizeof(WCHAR))
+	                   ? ArenaAlloc(&gArena, (output_cch + 1) * sizeof(WCHAR)) : NULL;
+	if( output_text == NULL )  return LOG("out of memory"), NULL;
+
+	TrBuffer out = { .data = (UTF16*)output_text, .size = output_cch };
+	if( !TrPipelineRun(&pipeline, (const UTF16*)source_text, source_cch, &out) )
+		LOG("output truncated");
 
 	LOG("[%ls]", output_text);
+	*plength = out.length;
+	return output_text;
+}
 
+// the exact-size copy of `length` units of `text` for the clipboard, 0-terminated
+static HGLOBAL CopyToGlobal( const WCHAR* text, size_t length )
+{
+	HGLOBAL hmem = GlobalAlloc(GMEM_MOVEABLE, (length + 1) * sizeof(WCHAR));
+	if( hmem == NULL )  return ERR("GlobalAlloc"), NULL;
+
+	WCHAR* p = (WCHAR*) GlobalLock(hmem);
+	if( p == NULL )  return ERR("GlobalLock"), GlobalFree(hmem), NULL;
+	memcpy(p, text, length * sizeof(WCHAR));
+	p[length] = 0;
 	GlobalUnlock(hmem);
 	return hmem;
 }
 
+static void UpdateArenaStats( void )
+{
+	StatsData* st = StatsBeginUpdate();
+	st->arena_bytes = gArena.held;
+	st->arena_peak_bytes = gArena.peak;
+	StatsEndUpdate();
+}
+
 // returns a (unnormalized) score of how likely it is that `str` was typed in `layout`
 static size_t MatchStringToLayout( const WCHAR* str, HKL layout )
 {
@@ -281,25 +235,45 @@ static HKL DetectStringLayout( const WCHAR* str, HKL preferred_layout )
 {
 	HKL best_layout = 0;
 	size_t best_score = 0;
-	HKL layouts [MAX_KEYBOARD_LAYOUTS];
-	int n = GetKeyboardLayoutList(COUNTOF(layouts), layouts);
-	for( int i = 0; i < n; ++i )
+	LayoutRegistry* reg = SystemLayouts();
+	for( size_t i = 0, n = LayoutRegistryCount(reg); i < n; ++i )
 	{
-		size_t score = MatchStringToLayout(str, layouts[i]);
+		HKL layout = (HKL) LayoutRegistryAt(reg, i)->handle;
+		size_t score = MatchStringToLayout(str, layout);
 		if( (score > best_score) || ((score == best_score) && score && (best_layout != preferred_layout)) )
 		{
 			best_score = score;
-			best_layout = layouts[i];
+			best_layout = layout;
 		}
 	}
 	LOG("%llx (score %llu/%llu)", (UINT_PTR)best_layout, best_score, wcslen(str));
+
+	StatsData* st = StatsBeginUpdate();
+	++*(best_score ? &st->detection_hits : &st->detection_misses);
+	StatsEndUpdate();
+
 	return best_score ? best_layout : NULL;
 }
 
-// `worker_hwnd` is only used as a nominal clipboard data owner
-static bool TranslateClipboard( HKL target_layout, HWND worker_hwnd )
+static void CountTranslation( const Translation* t, bool typed )
 {
-	bool done = false;
+	StatsData* st = StatsBeginUpdate();
+	if( typed )  ++st->translations_typed;
+	if( t->layout )  ++st->translations[stmLayout];
+	else if( (t->ntranslators == 1) && (t->translators[0] == &kHexToUnicode) )  ++st->translations[stmHexToUnicode];
+	else if( (t->ntranslators == 1) && (t->translators[0] == &kUnicodeToHex) )  ++st->translations[stmUnicodeToHex];
+	else ++st->translations_other;
+	StatsEndUpdate();
+}
+
+// Short translations are typed over the selection (see InjectPlanTyping), which leaves the
+// clipboard alone and needs no delay before the paste; the rest replace the clipboard contents.
+// `worker_hwnd` is only used as a nominal clipboard data owner.
+static PipeOutput TranslateClipboard( const Translation* t, HWND worker_hwnd, SpecialHandling sh )
+{
+	static InjectBatch batch;
+	PipeOutput done = poFailed;
+	bool noop = false;
 	HANDLE hcd = NULL;
 	const WCHAR* txt = NULL;
 	HGLOBAL hmem_translated = NULL;
@@ -324,39 +298,70 @@ static bool TranslateClipboard( HKL target_layout, HWND worker_hwnd )
 		goto cleanup;
 	}
 
-	HKL source_layout = ((target_layout != HKL_HEX_TO_UNICODE) && (target_layout != HKL_UNICODE_TO_HEX))
-	                  ? DetectStringLayout(txt, target_layout)
-	                  : NULL;
-
-	LOG("clip [%.60ls] %llx->%llx", txt, (UINT_PTR)source_layout, (UINT_PTR)target_layout);
-	if( source_layout == target_layout )
+	HKL source_layout = NULL;
+	if( t->layout )
 	{
-		LOG("noop");
-		goto cleanup;
+		TRACE_BEGIN("detect", wcslen(txt));
+		source_layout = DetectStringLayout(txt, t->layout);
+		TRACE_END("detect", source_layout);
+
+		LOG("clip [%.60ls] %llx->%llx", txt, (UINT_PTR)source_layout, (UINT_PTR)t->layout);
+		if( source_layout == t->layout )
+		{
+			LOG("noop");
+			noop = true;
+			goto cleanup;
+		}
 	}
+	else LOG("clip [%.60ls] %u translator(s), first %s", txt, t->ntranslators, t->translators[0]->name);
 
-	hmem_translated = TranslateString(txt, source_layout, target_layout);
-	if( hmem_translated == NULL )  goto cleanup;
+	TRACE_BEGIN("translate", t->layout ? (UINT_PTR)t->layout : t->ntranslators);
+	size_t length;
+	const WCHAR* translated = TranslateString(txt, source_layout, t, &length);
+	TRACE_END("translate", translated != NULL);
+	if( translated == NULL )  goto cleanup;
 
-	if( !EmptyClipboard() )
+	if( InjectPlanTyping(&batch, translated, length, sh != shNoSpecialHandling) )
 	{
-		ERR("EmptyClipboard");
-		goto cleanup;
+		LOG("typing %u units", (unsigned)(batch.count / 2));
+		if( !InjectSend(&batch, SystemInjector()) )  goto cleanup;
+		done = poTyped;
 	}
-
-	if( SetClipboardData(CF_UNICODETEXT, hmem_translated) == NULL )
+	else
 	{
-		ERR("SetClipboardData");
-		goto cleanup;
+		hmem_translated = CopyToGlobal(translated, length);
+		if( hmem_translated == NULL )  goto cleanup;
+
+		if( !EmptyClipboard() )
+		{
+			ERR("EmptyClipboard");
+			goto cleanup;
+		}
+
+		if( SetClipboardData(CF_UNICODETEXT, hmem_translated) == NULL )
+		{
+			ERR("SetClipboardData");
+			goto cleanup;
+		}
+
+		hmem_translated = NULL;  // now the handle is owned by the clipboard
+		done = poPaste;
 	}
 
-	hmem_translated = NULL;  // now the handle is owned by the clipboard
-	done = true;
+	CountTranslation(t, done == poTyped);
 
 cleanup:
+	if( (done == poFailed) && !noop )
+	{
+		StatsData* st = StatsBeginUpdate();
+		StatsRecordError(st, "TranslateClipboard", GetLastError());
+		StatsEndUpdate();
+	}
 	if( hmem_translated )  GlobalFree(hmem_translated);
 	if( txt )  GlobalUnlock(hcd);
 	CloseClipboard();
+	ArenaReset(&gArena);
+	UpdateArenaStats();
 	return done;
 }
 
@@ -428,86 +433,179 @@ static bool SimulateKeyboardPaste( SpecialHandling sh )
 	return false;
 }
 
-// -----------------------------------------------------------------------------
+// ---- the pipeline host (see pipeline.h) ----
 
-static void MojibakeTimer( HWND _hwnd, UINT _msg, UINT_PTR _id, DWORD current_time_ms )
+static uint32_t HostNow( void* _ )
 {
-	DWORD elapsed_ms = current_time_ms - gStartTime_ms;
+	return GetTickCount();
+}
+
+static void CALLBACK MojibakeTimer( HWND _hwnd, UINT _msg, UINT_PTR _id, DWORD _time )
+{
+	PipelineOnTimer(&gPipeline);
+}
 
-	switch( gState )
+static bool HostStartTimer( void* _ )
+{
+	gTimer = SetTimer(NULL, 0, 10, MojibakeTimer);
+	if( gTimer == 0 )  return ERR("SetTimer"), false;
+	return true;
+}
+
+static void HostStopTimer( void* _ )
+{
+	KillTimer(NULL, gTimer);
+}
+
+static SpecialHandling HostSpecialHandling( void* _, PipeWindow target )
+{
+	return GetWindowSpecialHandling((HWND)target);
+}
+
+static void UpdateClipboardStats( void )
+{
+	StatsData* st = StatsBeginUpdate();
+	st->clipboard_bytes_copied = gClipSnapshot.bytes_copied;
+	st->clipboard_formats_skipped = gClipSnapshot.formats_skipped;
+	StatsEndUpdate();
+}
+
+static void HostPostCopy( void* _, PipeWindow target )
+{
+	if( ghClipOwner )
 	{
-		case sWaitingForWmCopy:
-			if( elapsed_ms >= WMCOPY_TIMEOUT_ms )
-			{
-				LOG("WM_COPY timed out");
-				gStartTime_ms = current_time_ms;
-				gState = SimulateKeyboardCopy(gSpecialHandling)
-				       ? sWaitingForKeyboardCopy
-				       : (KillTimer(NULL, gTimer), sIdle);
-			}
-			break;
-
-		case sWaitingForKeyboardCopy:
-			if( elapsed_ms >= CTRL_INSERT_TIMEOUT_ms )
-			{
-				KillTimer(NULL, gTimer);
-				gState = sIdle;
-				LOG("keyboard copy timed out");
-			}
-			break;
-
-		case sDelayBeforePaste:
-			if( elapsed_ms >= PASTE_DELAY_ms )
-			{
-				KillTimer(NULL, gTimer);
-				gState = sIdle;
-				SimulateKeyboardPaste(gSpecialHandling);
-			}
-			break;
-
-		default:
-			LOG("turning off timer in state %d (elapsed %ldms)", gState, elapsed_ms);
-			KillTimer(NULL, gTimer);
+		// if the previous translation hasn't restored the contents yet, they are still in the snapshot
+		if( gRestoreTimer )
+		{
+			KillTimer(NULL, gRestoreTimer);
+			gRestoreTimer = 0;
+		}
+		else ClipSnapshotTake(&gClipSnapshot);
+		UpdateClipboardStats();
 	}
+
+	PostMessage((HWND)target, WM_COPY, 0, 0);
 }
 
-// -----------------------------------------------------------------------------
+static bool HostSendCopyKeys( void* _, SpecialHandling sh )
+{
+	return SimulateKeyboardCopy(sh);
+}
 
-void MojibakeOnClipboardUpdate( HWND worker_hwnd )
+static bool HostSendPasteKeys( void* _, SpecialHandling sh )
+{
+	return SimulateKeyboardPaste(sh);
+}
+
+static PipeOutput HostTranslateClipboard( void* _, PipeLayout translation, SpecialHandling sh )
+{
+	return TranslateClipboard((const Translation*)translation, ghWorkerWnd, sh);
+}
+
+static void CALLBACK RestoreTimer( HWND _hwnd, UINT _msg, UINT_PTR _id, DWORD _time )
+{
+	KillTimer(NULL, gRestoreTimer);
+	gRestoreTimer = 0;
+	if( ghClipOwner && ClipSnapshotRestore(&gClipSnapshot) )  LOG("clipboard restored");
+}
+
+static void HostIdle( void* _, bool pasted )
 {
-	if( (gState == sWaitingForWmCopy) || (gState == sWaitingForKeyboardCopy) )
+	// whatever a giant selection has made the arena grow to is not kept
+	ArenaTrim(&gArena);
+	UpdateArenaStats();
+
+	if( ghClipOwner && gClipSnapshot.taken && !gClipSnapshot.offered )
+	{
+		gRestoreTimer = SetTimer(NULL, 0, RESTORE_DELAY_ms, RestoreTimer);
+		if( gRestoreTimer == 0 )  ERR("SetTimer");
+	}
+
+	if( pasted )
+	{
+		StatsData* st = StatsBeginUpdate();
+		StatsRecordTime(st, sthTranslation, StatsNow_us() - gTranslationStart_us);
+		StatsEndUpdate();
+	}
+	AppMojibakeIdle();
+}
+
+static Pipeline* GetPipeline( void )
+{
+	if( !gPipelineReady )
 	{
-		if( TranslateClipboard(ghTargetLayout, worker_hwnd) )
+		const PipelineHost host =
 		{
-			gStartTime_ms = GetTickCount();
-			gState = sDelayBeforePaste;
-		}
+			.now_ms = HostNow,
+			.start_timer = HostStartTimer,
+			.stop_timer = HostStopTimer,
+			.special_handling = HostSpecialHandling,
+			.post_copy = HostPostCopy,
+			.send_copy_keys = HostSendCopyKeys,
+			.send_paste_keys = HostSendPasteKeys,
+			.translate_clipboard = HostTranslateClipboard,
+			.idle = HostIdle,
+		};
+		PipelineInit(&gPipeline, &host, &kTimeouts);
+		gPipelineReady = true;
 	}
+	return &gPipeline;
+}
+
+// -----------------------------------------------------------------------------
+
+void MojibakeOnClipboardUpdate( HWND worker_hwnd )
+{
+	ghWorkerWnd = worker_hwnd;
+	PipelineOnClipboardUpdate(GetPipeline());
 }
 
 
 // correct only if all Mojibake* functions are called from within the same thread
 bool MojibakeIsBusy( void )
 {
-	return (gState != sIdle);
+	return PipelineIsBusy(GetPipeline());
 }
 
 
-void MojibakeTranslateSelection( HWND hwnd_target, HKL target_layout )
+void MojibakeTranslateSelection( HWND hwnd_target, const Translation* translation )
 {
-	if( MojibakeIsBusy() )  return LOG("busy");
+	if( MojibakeIsBusy() )  return;
+	if( (translation->layout == NULL) && (translation->ntranslators == 0) )  return LOG("nothing to translate with");
+	gTranslationStart_us = StatsNow_us();
+	gTranslation = *translation;
+	PipelineStart(GetPipeline(), (PipeWindow)hwnd_target, (PipeLayout)&gTranslation);
+}
 
-	gSpecialHandling = GetWindowSpecialHandling(hwnd_target);
-	if( gSpecialHandling == shIgnore )  return LOG("ignored (special handling)");
 
-	ghWndTarget    = hwnd_target;
-	ghTargetLayout = target_layout;
-	gStartTime_ms  = GetTickCount();
-	gTimer         = SetTimer(NULL, 0, 10, MojibakeTimer);
+void MojibakePreserveClipboard( HWND owner_hwnd )
+{
+	if( owner_hwnd == ghClipOwner )  return;
 
-	if( gTimer == 0 )  return ERR("SetTimer");
+	if( gRestoreTimer )  KillTimer(NULL, gRestoreTimer);
+	gRestoreTimer = 0;
+	if( ghClipOwner )  ClipSnapshotDrop(&gClipSnapshot);
 
-	gState = sWaitingForWmCopy;
-	PostMessage(hwnd_target, WM_COPY, 0, 0);
-	LOG("sent WM_COPY");
+	ghClipOwner = owner_hwnd;
+	if( owner_hwnd )
+	{
+		const ClipBackend backend = SystemClipboard(owner_hwnd);
+		ClipSnapshotInit(&gClipSnapshot, &backend, CLIPBOARD_BUDGET, CLIPBOARD_BUDGET_ms);
+	}
+}
+
+void MojibakeOnRenderFormat( UINT format )
+{
+	if( ghClipOwner )  ClipSnapshotRender(&gClipSnapshot, format);
+	UpdateClipboardStats();
+}
+
+void MojibakeOnRenderAllFormats( void )
+{
+	if( ghClipOwner && (GetClipboardOwner() == ghClipOwner) )  ClipSnapshotRenderAll(&gClipSnapshot);
+}
+
+void MojibakeOnDestroyClipboard( void )
+{
+	if( ghClipOwner )  ClipSnapshotOwnershipLost(&gClipSnapshot);
 }
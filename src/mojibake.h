@@ -3,10 +3,16 @@
 
 #include <stdbool.h>
 #include <windows.h>
+#include "translate.h"
 
-#define HKL_AUTOASSIGN      ((HKL)-1)
-#define HKL_HEX_TO_UNICODE  ((HKL)-2)
-#define HKL_UNICODE_TO_HEX  ((HKL)-3)
+// What a selection is translated with: either a keyboard layout (the text is assumed
+// to have been typed in a wrong one, which is detected), or a chain of text translators.
+typedef struct
+{
+	HKL                     layout;        // NULL if translating with `translators`
+	const TranslatorClass*  translators [TR_MAX_STAGES];
+	unsigned                ntranslators;
+} Translation;
 
 
 // ---- provided by mojibake.c -------------------------------------------------
@@ -15,13 +21,28 @@
 
 bool MojibakeIsBusy( void );
 
-// Translate current selection in the window `hwnd_target` into `target_layout`.
-// `target_layout` can also be HKL_HEX_TO_UNICODE or HKL_UNICODE_TO_HEX.
+// Translate current selection in the window `hwnd_target` as `translation` says (it is copied).
 // Will start a thread-associated timer (SetTimer) and complete asynchronously.
-void MojibakeTranslateSelection( HWND hwnd_target, HKL target_layout );
+// Does nothing if a translation is already in progress (see MojibakeIsBusy).
+void MojibakeTranslateSelection( HWND hwnd_target, const Translation* translation );
 
 // The app should register with AddClipboardFormatListener and call this fn on WM_CLIPBOARDUPDATE.
 // `worker_hwnd` is only used as a nominal clipboard data owner when copying/pasting.
 void MojibakeOnClipboardUpdate( HWND worker_hwnd );
 
+// Makes translations keep the user's clipboard contents (see clipsave.h), with `owner_hwnd`
+// owning them once restored; NULL turns it off. The window must pass its WM_RENDERFORMAT,
+// WM_RENDERALLFORMATS and WM_DESTROYCLIPBOARD to the functions below.
+void MojibakePreserveClipboard( HWND owner_hwnd );
+void MojibakeOnRenderFormat( UINT format );
+void MojibakeOnRenderAllFormats( void );
+void MojibakeOnDestroyClipboard( void );
+
+
+// ---- should be defined by the application -----------------------------------
+
+// Called (from the timer) when a translation has finished, successfully or not,
+// and MojibakeIsBusy() has become false again.
+void AppMojibakeIdle( void );
+
 #endif
@@ -0,0 +1,513 @@
+// The character name index (see names.h) and the translators using it.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include "names.h"
+#include "common.h"
+
+// the jamo short names, for the names of the Hangul syllables
+static const char* const kJamoL [19] =
+{
+	"G", "GG", "N", "D", "DD", "R", "M", "B", "BB", "S", "SS", "", "J", "JJ", "C", "K", "T", "P", "H",
+};
+static const char* const kJamoV [21] =
+{
+	"A", "AE", "YA", "YAE", "EO", "E", "YEO", "YE", "O", "WA", "WAE", "OE", "YO", "U", "WEO", "WE", "WI",
+	"YU", "EU", "YI", "I",
+};
+static const char* const kJamoT [28] =
+{
+	"", "G", "GG", "GS", "N", "NJ", "NH", "D", "L", "LG", "LM", "LB", "LS", "LT", "LP", "LH", "M", "B",
+	"BS", "S", "SS", "NG", "J", "C", "K", "T", "P", "H",
+};
+
+enum { HANGUL_FIRST = 0xAC00, HANGUL_COUNT = 19 * 21 * 28 };
+
+bool NameIndexInit( NameIndex* ix, const void* data, size_t size )
+{
+	const NameFileHeader* h = (const NameFileHeader*) data;
+	if( (size < sizeof(*h)) || (memcmp(h->magic, NAMES_MAGIC, sizeof(h->magic)) != 0) || (h->size != size) )
+		return LOG("not a name index"), false;
+
+	// the sections must be within the file, and aligned
+	const struct { uint32_t offset; size_t length; } sections [] =
+	{
+		{ h->codepoints, h->ncodepoints * sizeof(uint32_t) },
+		{ h->order,      h->ncodepoints * sizeof(uint16_t) },
+		{ h->names,      1 },
+		{ h->blocks,     h->nblocks * sizeof(uint32_t) },
+		{ h->ranges,     h->nranges * sizeof(NameRange) },
+	};
+	for( unsigned i = 0; i < COUNTOF(sections); ++i )
+	{
+		if( (sections[i].offset > size) || (sections[i].length > size - sections[i].offset)
+		 || (sections[i].offset % 4) )
+			return LOG("bad section %u", i), false;
+	}
+	if( (h->ncodepoints == 0) || (h->nblocks != (h->ncodepoints + NAMES_BLOCK - 1) / NAMES_BLOCK)
+	 || (h->names > h->blocks) )
+		return LOG("bad counts"), false;
+
+	const uint8_t* base = (const uint8_t*) data;
+	ix->data = base;
+	ix->header = h;
+	ix->codepoints = (const uint32_t*)(base + h->codepoints);
+	ix->order = (const uint16_t*)(base + h->order);
+	ix->blocks = (const uint32_t*)(base + h->blocks);
+	ix->ranges = (const NameRange*)(base + h->ranges);
+	return true;
+}
+
+// ---- the front-coded names --------------------------------------------------
+
+typedef struct
+{
+	const uint8_t*  p;       // the next entry
+	const uint8_t*  end;
+	unsigned        left;    // entries left in the block
+	char            name [NAMES_MAX_LENGTH];
+	size_t          length;
+	uint32_t        codepoint;
+} BlockReader;
+
+static void ReaderStart( const NameIndex* ix, BlockReader* r, uint32_t block )
+{
+	const NameFileHeader* h = ix->header;
+	uint32_t offset = ix->blocks[block];
+	r->p = ix->data + h->names + offset;
+	r->end = ix->data + h->blocks;
+	r->left = (offset >= h->blocks - h->names) ? 0
+	        : (block + 1 < h->nblocks) ? NAMES_BLOCK : h->ncodepoints - block * NAMES_BLOCK;
+	r->length = 0;
+}
+
+// returns false at the end of the block, or if the data is broken
+static bool ReaderNext( BlockReader* r )
+{
+	if( (r->left == 0) || (r->end - r->p < 2) )  return false;
+
+	unsigned prefix = r->p[0], rest = r->p[1];
+	if( (prefix > r->length) || (prefix + rest >= sizeof(r->name)) || (r->end - r->p < 2 + rest + 3) )  return false;
+
+	memcpy(r->name + prefix, r->p + 2, rest);
+	r->length = prefix + rest;
+	r->name[r->length] = 0;
+
+	const uint8_t* cp = r->p + 2 + rest;
+	r->codepoint = cp[0] | (cp[1] << 8) | ((uint32_t)cp[2] << 16);
+	r->p = cp + 3;
+	--r->left;
+	return true;
+}
+
+// ---- the derived names ------------------------------------------------------
+
+static size_t HangulName( uint32_t cp, char* buffer, size_t size )
+{
+	unsigned s = cp - HANGUL_FIRST;
+	int n = snprintf(buffer, size, "HANGUL SYLLABLE %s%s%s",
+	                 kJamoL[s / (21 * 28)], kJamoV[(s / 28) % 21], kJamoT[s % 28]);
+	return ((n > 0) && ((size_t)n < size)) ? n : 0;
+}
+
+// the syllable with the short name, e.g. GAG for U+AC01
+static bool HangulCodepoint( const char* name, size_t length, uint32_t* pcp )
+{
+	// the names are unique, but not every split of one into jamo is a name: try them all
+	for( unsigned l = 0; l < COUNTOF(kJamoL); ++l )
+	{
+		size_t ll = strlen(kJamoL[l]);
+		if( (ll > length) || (memcmp(name, kJamoL[l], ll) != 0) )  continue;
+
+		for( unsigned v = 0; v < COUNTOF(kJamoV); ++v )
+		{
+			size_t lv = strlen(kJamoV[v]);
+			if( (ll + lv > length) || (memcmp(name + ll, kJamoV[v], lv) != 0) )  continue;
+
+			for( unsigned t = 0; t < COUNTOF(kJamoT); ++t )
+			{
+				if( (strlen(kJamoT[t]) == length - ll - lv) && (memcmp(name + ll + lv, kJamoT[t], length - ll - lv) == 0) )
+					return *pcp = HANGUL_FIRST + (l * 21 + v) * 28 + t, true;
+			}
+		}
+	}
+	return false;
+}
+
+static size_t DerivedName( const NameIndex* ix, uint32_t cp, char* buffer, size_t size )
+{
+	for( uint32_t i = 0; i < ix->header->nranges; ++i )
+	{
+		const NameRange* r = &ix->ranges[i];
+		if( (cp < r->first) || (cp > r->last) )  continue;
+
+		if( (r->kind == nrHangul) && (cp - HANGUL_FIRST < HANGUL_COUNT) )  return HangulName(cp, buffer, size);
+
+		int n = snprintf(buffer, size, "%.*s%04X", (int)sizeof(r->prefix), r->prefix, (unsigned)cp);
+		return ((n > 0) && ((size_t)n < size)) ? n : 0;
+	}
+	return 0;
+}
+
+static bool DerivedCodepoint( const NameIndex* ix, const char* name, size_t length, uint32_t* pcp )
+{
+	for( uint32_t i = 0; i < ix->header->nranges; ++i )
+	{
+		const NameRange* r = &ix->ranges[i];
+		const char* nul = memchr(r->prefix, 0, sizeof(r->prefix));
+		size_t plen = nul ? (size_t)(nul - r->prefix) : sizeof(r->prefix);
+
+		if( r->kind == nrHangul )
+		{
+			if( (length > 16) && (memcmp(name, "HANGUL SYLLABLE ", 16) == 0) && HangulCodepoint(name + 16, length - 16, pcp) )
+				return (*pcp >= r->first) && (*pcp <= r->last);
+			continue;
+		}
+
+		if( (length <= plen) || (length > plen + 6) || (memcmp(name, r->prefix, plen) != 0) )  continue;
+
+		uint32_t cp = 0;
+		for( size_t k = plen; k < length; ++k )
+		{
+			char c = name[k];
+			int d = ((c >= '0') && (c <= '9')) ? c - '0' : ((c >= 'A') && (c <= 'F')) ? c - 'A' + 10 : -1;
+			if( d < 0 )  return false;
+			cp = (cp << 4) | d;
+		}
+		bool canonical = (length - plen == 4) || (name[plen] != '0');
+		if( canonical && (length - plen >= 4) && (cp >= r->first) && (cp <= r->last) )  return *pcp = cp, true;
+	}
+	return false;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t NameOfCodepoint( const NameIndex* ix, uint32_t cp, char* buffer, size_t size )
+{
+	// the codepoints with names of their own
+	size_t lo = 0, hi = ix->header->ncodepoints;
+	while( lo < hi )
+	{
+		size_t mid = (lo + hi) / 2;
+		if( ix->codepoints[mid] < cp )  lo = mid + 1;
+		else hi = mid;
+	}
+
+	if( (lo < ix->header->ncodepoints) && (ix->codepoints[lo] == cp) )
+	{
+		uint32_t k = ix->order[lo];
+		if( k >= ix->header->ncodepoints )  return 0;
+		BlockReader r;
+		ReaderStart(ix, &r, k / NAMES_BLOCK);
+		for( unsigned i = 0; i <= k % NAMES_BLOCK; ++i )
+		{
+			if( !ReaderNext(&r) )  return 0;
+		}
+		if( (r.codepoint != cp) || (r.length >= size) )  return 0;
+		memcpy(buffer, r.name, r.length + 1);
+		return r.length;
+	}
+
+	return DerivedName(ix, cp, buffer, size);
+}
+
+// upper case, single spaces, no spaces around
+static size_t NormalizeName( const char* name, size_t length, char* buffer, size_t size )
+{
+	size_t n = 0;
+	for( size_t i = 0; i < length; ++i )
+	{
+		char c = name[i];
+		if( c == '_' )  c = ' ';
+		if( (c >= 'a') && (c <= 'z') )  c -= 'a' - 'A';
+		if( (c == ' ') && ((n == 0) || (buffer[n - 1] == ' ')) )  continue;
+		if( n + 1 >= size )  return 0;
+		buffer[n++] = c;
+	}
+	if( (n > 0) && (buffer[n - 1] == ' ') )  --n;
+	buffer[n] = 0;
+	return n;
+}
+
+bool CodepointOfName( const NameIndex* ix, const char* query, size_t query_length, uint32_t* pcp )
+{
+	char name [NAMES_MAX_LENGTH];
+	size_t length = NormalizeName(query, query_length, name, sizeof(name));
+	if( length == 0 )  return false;
+
+	// the last block whose first name is not after the name (the first names are stored
+	// whole, so they're compared in place)
+	const NameFileHeader* h = ix->header;
+	uint32_t lo = 0, hi = h->nblocks;
+	while( hi - lo > 1 )
+	{
+		uint32_t mid = (lo + hi) / 2;
+		uint32_t offset = ix->blocks[mid];
+		if( offset + 2 > h->blocks - h->names )  return false;
+		const uint8_t* entry = ix->data + h->names + offset;
+		size_t first_length = entry[1];
+		if( (entry[0] != 0) || (offset + 2 + first_length > h->blocks - h->names) )  return false;
+
+		int cmp = memcmp(entry + 2, name, (first_length < length) ? first_length : length);
+		if( (cmp < 0) || ((cmp == 0) && (first_length <= length)) )  lo = mid;
+		else hi = mid;
+	}
+
+	BlockReader r;
+	ReaderStart(ix, &r, lo);
+	while( ReaderNext(&r) )
+	{
+		int cmp = strcmp(r.name, name);
+		if( cmp == 0 )  return *pcp = r.codepoint, true;
+		if( cmp > 0 )  break;
+	}
+
+	return DerivedCodepoint(ix, name, length, pcp);
+}
+
+// ---- NAME -------------------------------------------------------------------
+
+typedef struct
+{
+	const NameIndex*  ix;
+	char              held [NAMES_MAX_LENGTH];   // the name so far (ASCII)
+	uint8_t           nheld;
+	UTF16             lead [2];                  // the character of a 'c NAME' (as UNAME puts it)
+	uint8_t           nlead;
+	uint8_t           lead_at;                   // where it goes in the held text
+	bool              skipping;                  // not a name: pass the rest of it on
+} NameDecodeState;
+
+static_assert(sizeof(NameDecodeState) <= TR_STATE_SIZE, "NameDecodeState doesn't fit in a stage");
+
+static bool IsNameSeparator( UTF16 u )
+{
+	return (u == '\n') || (u == '\r') || (u == '\t') || (u == ',') || (u == ';');
+}
+
+static bool IsNameChar( UTF16 u )
+{
+	return ((u >= 'A') && (u <= 'Z')) || ((u >= 'a') && (u <= 'z')) || ((u >= '0') && (u <= '9'))
+	    || (u == ' ') || (u == '-') || (u == '_');
+}
+
+static size_t NameDecodeMaxOutput( size_t n )
+{
+	// a name is longer than the 1 or 2 units of its character
+	return n;
+}
+
+static void NameDecodeInit( void* state, const void* _ )
+{
+	NameDecodeState* st = (NameDecodeState*) state;
+	memset(st, 0, sizeof(*st));
+	st->ix = NamesLoad();
+}
+
+static void EmitAscii( TrStage* stage, const char* s, size_t n )
+{
+	for( size_t i = 0; i < n; ++i )  TrEmit(stage, (UTF16)s[i]);
+}
+
+static void EmitCodepoint( TrStage* stage, uint32_t u )
+{
+	if( u < 0x10000 )
+	{
+		TrEmit(stage, (UTF16)u);
+		return;
+	}
+	u -= 0x10000;
+	TrEmit(stage, (UTF16)(0xD800 + (u >> 10)));
+	TrEmit(stage, (UTF16)(0xDC00 + (u & 0x3FF)));
+}
+
+static uint32_t LeadCodepoint( const NameDecodeState* st )
+{
+	if( st->nlead == 2 )  return ((uint32_t)(st->lead[0] - 0xD800) << 10) + (st->lead[1] - 0xDC00) + 0x10000;
+	return st->lead[0];
+}
+
+static bool IsLeadComplete( const NameDecodeState* st )
+{
+	return (st->nlead == 2) || ((st->nlead == 1) && ((st->lead[0] & 0xFC00) != 0xD800));
+}
+
+// passes the held text (and the lead character) on as is
+static void FlushHeld( TrStage* stage, NameDecodeState* st )
+{
+	EmitAscii(stage, st->held, st->lead_at);
+	for( unsigned i = 0; i < st->nlead; ++i )  TrEmit(stage, st->lead[i]);
+	EmitAscii(stage, st->held + st->lead_at, st->nheld - st->lead_at);
+	st->nheld = st->nlead = st->lead_at = 0;
+}
+
+// replaces the name held with its character, keeping the spaces around it; the name may
+// come after its character and a space ('c NAME'), as long as it is the name of that one
+static void DecodeHeldName( TrStage* stage, NameDecodeState* st )
+{
+	size_t first = 0, last = st->nheld;
+	while( (last > first) && (st->held[last - 1] == ' ') )  --last;
+
+	uint32_t lead = 0;
+	if( st->nlead )
+	{
+		if( !IsLeadComplete(st) || (st->lead_at == last) || (st->held[st->lead_at] != ' ') )
+		{
+			FlushHeld(stage, st);
+			return;
+		}
+		lead = LeadCodepoint(st);
+		first = st->lead_at;
+	}
+	while( (first < last) && (st->held[first] == ' ') )  ++first;
+
+	uint32_t cp;
+	bool found = (first < last) && st->ix && CodepointOfName(st->ix, st->held + first, last - first, &cp);
+	if( !found && st->ix && !st->nlead && (last - first > 2) && (st->held[first + 1] == ' ') )
+	{
+		// an ASCII 'c NAME'
+		lead = (uint8_t)st->held[first];
+		first += 2;
+		found = CodepointOfName(st->ix, st->held + first, last - first, &cp);
+	}
+	if( !found || (lead && (cp != lead)) )
+	{
+		FlushHeld(stage, st);
+		return;
+	}
+
+	EmitAscii(stage, st->held, st->nlead ? st->lead_at : first - (lead ? 2 : 0));
+	EmitCodepoint(stage, cp);
+	EmitAscii(stage, st->held + last, st->nheld - last);
+	st->nheld = st->nlead = st->lead_at = 0;
+}
+
+static void NameDecodeFeed( TrStage* stage, UTF16 u )
+{
+	NameDecodeState* st = TR_STATE(stage, NameDecodeState);
+
+	if( (u == 0) || IsNameSeparator(u) )
+	{
+		if( !st->skipping )  DecodeHeldName(stage, st);
+		st->skipping = false;
+		if( u != 0 )  TrEmit(stage, u);
+		return;
+	}
+
+	if( st->skipping )
+	{
+		TrEmit(stage, u);
+		return;
+	}
+
+	if( IsNameChar(u) && (st->nheld < sizeof(st->held)) && (!st->nlead || IsLeadComplete(st)) )
+	{
+		st->held[st->nheld++] = (char)u;
+		return;
+	}
+
+	// a character (other than a letter or a digit) where the name is about to start
+	bool spaces_only = true;
+	for( unsigned i = 0; i < st->nheld; ++i )  spaces_only &= (st->held[i] == ' ');
+	if( spaces_only && (st->nlead == 0) )
+	{
+		st->lead[st->nlead++] = u;
+		st->lead_at = st->nheld;
+		return;
+	}
+	if( (st->nlead == 1) && (st->nheld == st->lead_at) && ((st->lead[0] & 0xFC00) == 0xD800) && ((u & 0xFC00) == 0xDC00) )
+	{
+		st->lead[st->nlead++] = u;
+		return;
+	}
+
+	FlushHeld(stage, st);
+	st->skipping = true;
+	TrEmit(stage, u);
+}
+
+const TranslatorClass kNameToChar =
+{
+	.name = "NAME",
+	.inverse = "UNAME",
+	.description = "Unicode character names to characters",
+	.max_output = NameDecodeMaxOutput,
+	.init = NameDecodeInit,
+	.feed = NameDecodeFeed,
+};
+
+// ---- UNAME ------------------------------------------------------------------
+
+typedef struct
+{
+	const NameIndex*  ix;
+	UTF16             high;       // a high surrogate waiting for its pair
+	bool              annotated;  // something before: a separator is due
+} NameEncodeState;
+
+static size_t NameEncodeMaxOutput( size_t n )
+{
+	// ", ", the character, ' ', and the name
+	return n * (2 + 1 + 1 + NAMES_MAX_LENGTH);
+}
+
+static void NameEncodeInit( void* state, const void* _ )
+{
+	NameEncodeState* st = (NameEncodeState*) state;
+	memset(st, 0, sizeof(*st));
+	st->ix = NamesLoad();
+}
+
+static void Annotate( TrStage* stage, NameEncodeState* st, uint32_t cp )
+{
+	if( (cp == ' ') || (cp == '\t') || (cp == '\r') || (cp == '\n') )  return;
+
+	if( st->annotated )  EmitAscii(stage, ", ", 2);
+	st->annotated = true;
+
+	EmitCodepoint(stage, cp);
+	TrEmit(stage, ' ');
+
+	char name [NAMES_MAX_LENGTH];
+	size_t n = st->ix ? NameOfCodepoint(st->ix, cp, name, sizeof(name)) : 0;
+	if( n == 0 )  n = snprintf(name, sizeof(name), "U+%04X", (unsigned)cp);
+	EmitAscii(stage, name, n);
+}
+
+static void NameEncodeFeed( TrStage* stage, UTF16 u )
+{
+	NameEncodeState* st = TR_STATE(stage, NameEncodeState);
+
+	if( st->high )
+	{
+		UTF16 high = st->high;
+		st->high = 0;
+		if( (u & 0xFC00) == 0xDC00 )
+		{
+			Annotate(stage, st, ((uint32_t)(high - 0xD800) << 10) + (u - 0xDC00) + 0x10000);
+			return;
+		}
+		Annotate(stage, st, high);  // unpaired
+	}
+
+	if( u == 0 )  return;
+	if( (u & 0xFC00) == 0xD800 )
+	{
+		st->high = u;
+		return;
+	}
+	Annotate(stage, st, u);
+}
+
+const TranslatorClass kCharToName =
+{
+	.name = "UNAME",
+	.inverse = "NAME",
+	.description = "characters to c NAME",
+	.max_output = NameEncodeMaxOutput,
+	.init = NameEncodeInit,
+	.feed = NameEncodeFeed,
+};
@@ -0,0 +1,98 @@
+#ifndef NAMES_H
+#define NAMES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "translate.h"
+
+// The Unicode character names, from a read-only index file (kbsw-names.bin) built from
+// UnicodeData.txt by tools/ucdgen.c. The file is memory-mapped on the first use of a name
+// translator, so it costs nothing (not even a file open) unless names are asked for.
+//
+// The file: a NameFileHeader, then the sections it points at (offsets from the start of the
+// file; the integers are little-endian):
+//   - the codepoints with a name of their own, ascending, as uint32_t [ncodepoints];
+//   - for each of them, the index of its name in the sorted names, as uint16_t [ncodepoints];
+//   - the names, sorted and front-coded in blocks of NAMES_BLOCK: each entry is the length
+//     of the prefix it shares with the previous one in the block (0 for the first one),
+//     the length of the rest, the rest, and the codepoint (3 bytes);
+//   - the offsets of the blocks in the above, as uint32_t [nblocks];
+//   - the ranges of codepoints with derived names (CJK UNIFIED IDEOGRAPH-4E00 and such).
+
+#define NAMES_MAGIC  "KBSWNAM1"
+
+enum
+{
+	NAMES_BLOCK = 16,
+	NAMES_MAX_LENGTH = 96,   // the longest name is 88 chars (Unicode 14)
+};
+
+typedef enum
+{
+	nrHexSuffix,   // the prefix and the codepoint in hex
+	nrHangul,      // HANGUL SYLLABLE and the jamo short names
+} NameRangeKind;
+
+typedef struct
+{
+	uint32_t  first, last;
+	uint32_t  kind;          // NameRangeKind
+	char      prefix [28];   // not necessarily 0-terminated
+} NameRange;
+
+typedef struct
+{
+	char      magic [8];
+	char      unicode_version [16];
+	uint32_t  size;          // of the whole file
+	uint32_t  ncodepoints;
+	uint32_t  nblocks;
+	uint32_t  nranges;
+	uint32_t  codepoints;    // the offsets of the sections
+	uint32_t  order;
+	uint32_t  names;
+	uint32_t  blocks;
+	uint32_t  ranges;
+} NameFileHeader;
+
+typedef struct
+{
+	const uint8_t*         data;
+	const NameFileHeader*  header;
+	const uint32_t*        codepoints;
+	const uint16_t*        order;
+	const uint32_t*        blocks;
+	const NameRange*       ranges;
+} NameIndex;
+
+
+// ---- provided by names.c ----------------------------------------------------
+
+// Checks that `data` looks like an index file; returns false if it doesn't.
+bool NameIndexInit( NameIndex* ix, const void* data, size_t size );
+
+// Writes the 0-terminated name of `codepoint` into `buffer`, which should be NAMES_MAX_LENGTH
+// chars long; returns its length, or 0 if the codepoint has no name.
+size_t NameOfCodepoint( const NameIndex* ix, uint32_t codepoint, char* buffer, size_t size );
+
+// Finds the codepoint with the `name` (case, '_' for ' ' and extra spaces don't matter);
+// returns false if there is no such name.
+bool CodepointOfName( const NameIndex* ix, const char* name, size_t length, uint32_t* pcodepoint );
+
+// "NAME": replaces the character names (one per line, or separated with ',' or ';') with
+// the characters, also when a name comes after its character ('c NAME', as UNAME puts it);
+// copies the rest as is.
+extern const TranslatorClass kNameToChar;
+
+// "UNAME": replaces each character c (not whitespace) with 'c NAME', separated with ", ".
+extern const TranslatorClass kCharToName;
+
+
+// ---- provided by names_win.c / names_posix.c --------------------------------
+
+// Maps the index file on the first call (the file next to the executable; on POSIX,
+// $KBSW_NAMES if set), and keeps it mapped. Returns NULL if it's not there or invalid.
+const NameIndex* NamesLoad( void );
+
+#endif
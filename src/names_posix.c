@@ -0,0 +1,60 @@
+// Maps the character name index (see names.h) on POSIX systems.
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "names.h"
+#include "common.h"
+
+static NameIndex  gIndex;
+static bool       gLoaded = false;   // tried already
+
+// $KBSW_NAMES, or kbsw-names.bin next to the executable
+static bool GetIndexPath( char* path, size_t size )
+{
+	const char* env = getenv("KBSW_NAMES");
+	if( env && *env )  return snprintf(path, size, "%s", env) < size;
+
+	ssize_t n = readlink("/proc/self/exe", path, size - 1);
+	if( n <= 0 )  return LOG("readlink: %s", strerror(errno)), false;
+	path[n] = 0;
+
+	char* slash = strrchr(path, '/');
+	size_t dir_length = slash ? slash + 1 - path : 0;
+	return snprintf(path + dir_length, size - dir_length, "kbsw-names.bin") < size - dir_length;
+}
+
+const NameIndex* NamesLoad( void )
+{
+	if( gLoaded )  return gIndex.data ? &gIndex : NULL;
+	gLoaded = true;
+
+	char path [4096];
+	if( !GetIndexPath(path, sizeof(path)) )  return NULL;
+
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if( fd < 0 )  return LOG("%s: %s", path, strerror(errno)), NULL;
+
+	struct stat sb;
+	void* p = MAP_FAILED;
+	if( (fstat(fd, &sb) == 0) && (sb.st_size > 0) )
+		p = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if( p == MAP_FAILED )  return LOG("fstat/mmap: %s", strerror(errno)), NULL;
+
+	if( !NameIndexInit(&gIndex, p, sb.st_size) )
+	{
+		munmap(p, sb.st_size);
+		gIndex.data = NULL;
+		return NULL;
+	}
+	return &gIndex;
+}
@@ -0,0 +1,56 @@
+// Maps the character name index (see names.h) on Windows.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <windows.h>
+#include "names.h"
+#include "common.h"
+
+static NameIndex  gIndex;
+static bool       gLoaded = false;   // tried already
+
+// kbsw-names.bin next to the executable
+static bool GetIndexPath( WCHAR* path, DWORD size )
+{
+	DWORD n = GetModuleFileNameW(NULL, path, size);
+	if( (n == 0) || (n >= size) )  return ERR("GetModuleFileName"), false;
+
+	WCHAR* name = wcsrchr(path, L'\\');
+	name = name ? name + 1 : path;
+	static const WCHAR kFileName [] = L"kbsw-names.bin";
+	if( name - path + COUNTOF(kFileName) > size )  return LOG("path too long"), false;
+	wcscpy(name, kFileName);
+	return true;
+}
+
+const NameIndex* NamesLoad( void )
+{
+	if( gLoaded )  return gIndex.data ? &gIndex : NULL;
+	gLoaded = true;
+
+	WCHAR path [MAX_PATH];
+	if( !GetIndexPath(path, COUNTOF(path)) )  return NULL;
+
+	HANDLE file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if( file == INVALID_HANDLE_VALUE )  return ERR("CreateFile"), NULL;
+
+	LARGE_INTEGER size;
+	HANDLE mapping = NULL;
+	if( GetFileSizeEx(file, &size) && (size.QuadPart > 0) && (size.QuadPart < 0x10000000) )
+		mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if( mapping == NULL )  return ERR("GetFileSizeEx/CreateFileMapping"), NULL;
+
+	// the view keeps the mapping alive
+	const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if( view == NULL )  return ERR("MapViewOfFile"), NULL;
+
+	if( !NameIndexInit(&gIndex, view, (size_t)size.QuadPart) )
+	{
+		UnmapViewOfFile(view);
+		gIndex.data = NULL;
+		return NULL;
+	}
+	return &gIndex;
+}
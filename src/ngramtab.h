@@ -0,0 +1,3699 @@
+// Generated by tools/ngramgen.c. Do not edit.
+//
+// en: 28 symbols, 475 rows, 1568 + 6650 bytes; from 1724 KB of text
+// ru: 34 symbols, 521 rows, 2312 + 8857 bytes; from 2301 KB of text
+// uk: 34 symbols, 579 rows, 2312 + 9843 bytes; from 2794 KB of text
+// de: 32 symbols, 575 rows, 2048 + 9200 bytes; from 1561 KB of text
+// fr: 32 symbols, 527 rows, 2048 + 8432 bytes; from 2015 KB of text
+// es: 34 symbols, 477 rows, 2312 + 8109 bytes; from 1464 KB of text
+
+static const UTF16 kLettersEn [26] =
+{
+	0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C,
+	0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+	0x0079, 0x007A,
+};
+
+static const uint16_t kContextsEn [784] =
+{
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 0, 28, 29, 30,
+	31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+	47, 48, 49, 50, 51, 52, 53, 54, 0, 55, 56, 57, 58, 59, 60, 61,
+	62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+	78, 79, 80, 81, 0, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92,
+	93, 94, 95, 96, 97, 98, 72, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+	0, 108, 109, 110, 111, 112, 113, 114, 89, 115, 116, 38, 117, 118, 119, 96,
+	120, 121, 72, 122, 123, 124, 125, 103, 104, 105, 126, 107, 0, 127, 128, 129,
+	85, 130, 131, 114, 89, 132, 133, 134, 93, 135, 136, 137, 138, 139, 72, 140,
+	141, 142, 143, 103, 144, 105, 145, 107, 0, 146, 147, 148, 149, 150, 151, 152,
+	153, 154, 155, 38, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+	168, 169, 170, 107, 0, 171, 172, 110, 85, 173, 174, 175, 89, 90, 176, 38,
+	93, 177, 119, 96, 178, 179, 72, 180, 181, 182, 183, 103, 104, 105, 184, 107,
+	0, 185, 186, 187, 85, 86, 188, 114, 189, 190, 191, 38, 93, 192, 193, 194,
+	195, 196, 72, 197, 198, 199, 200, 103, 104, 105, 201, 107, 0, 202, 203, 110,
+	85, 86, 204, 114, 89, 90, 205, 38, 93, 206, 207, 96, 208, 98, 72, 209,
+	210, 211, 212, 103, 104, 105, 201, 107, 0, 213, 214, 215, 216, 217, 218, 219,
+	220, 90, 221, 222, 223, 224, 225, 226, 227, 228, 72, 229, 230, 231, 232, 233,
+	104, 234, 235, 236, 0, 237, 238, 110, 85, 86, 239, 114, 89, 90, 240, 38,
+	93, 206, 119, 96, 241, 98, 72, 242, 243, 244, 245, 103, 104, 105, 201, 107,
+	0, 246, 247, 110, 85, 86, 248, 114, 249, 250, 251, 38, 93, 206, 119, 252,
+	253, 98, 72, 254, 255, 256, 257, 103, 104, 105, 201, 107, 0, 258, 259, 110,
+	85, 260, 261, 262, 263, 90, 264, 38, 93, 265, 266, 96, 267, 268, 72, 269,
+	270, 271, 272, 273, 104, 105, 274, 107, 0, 275, 276, 277, 85, 278, 279, 114,
+	89, 90, 280, 38, 93, 281, 282, 283, 284, 285, 72, 242, 286, 287, 288, 103,
+	104, 105, 201, 107, 0, 289, 290, 110, 291, 292, 293, 294, 295, 296, 297, 298,
+	299, 300, 301, 302, 303, 304, 72, 305, 306, 307, 308, 309, 104, 105, 310, 107,
+	0, 311, 312, 313, 314, 315, 316, 317, 318, 90, 319, 38, 320, 321, 322, 323,
+	324, 325, 72, 326, 327, 328, 329, 330, 331, 105, 201, 107, 0, 332, 333, 110,
+	334, 335, 336, 114, 337, 338, 339, 38, 340, 341, 119, 96, 342, 343, 72, 344,
+	345, 346, 347, 103, 104, 105, 348, 107, 0, 349, 350, 110, 85, 86, 351, 114,
+	89, 90, 352, 38, 93, 206, 119, 96, 353, 98, 72, 242, 243, 244, 354, 103,
+	104, 105, 201, 107, 0, 355, 356, 357, 358, 359, 360, 361, 362, 90, 363, 38,
+	364, 365, 366, 367, 368, 369, 72, 370, 371, 372, 373, 374, 375, 105, 376, 107,
+	0, 377, 378, 110, 379, 86, 380, 381, 89, 382, 383, 38, 384, 385, 386, 387,
+	388, 389, 72, 390, 391, 392, 393, 394, 395, 105, 396, 107, 0, 397, 398, 110,
+	399, 400, 401, 402, 89, 403, 404, 38, 93, 405, 406, 407, 408, 409, 72, 410,
+	411, 412, 413, 103, 414, 105, 415, 107, 0, 416, 417, 418, 419, 420, 421, 422,
+	423, 90, 424, 38, 425, 426, 427, 428, 429, 430, 72, 431, 432, 433, 232, 103,
+	104, 434, 201, 107, 0, 435, 436, 110, 85, 86, 437, 114, 89, 90, 438, 38,
+	93, 206, 119, 96, 439, 98, 72, 242, 243, 244, 232, 103, 104, 105, 201, 107,
+	0, 440, 441, 110, 85, 86, 442, 114, 89, 443, 444, 38, 93, 445, 119, 446,
+	447, 98, 72, 448, 449, 244, 232, 103, 104, 105, 201, 107, 0, 450, 451, 110,
+	452, 86, 453, 114, 89, 90, 454, 38, 93, 206, 119, 96, 353, 455, 72, 242,
+	243, 456, 232, 103, 104, 105, 201, 107, 0, 457, 458, 110, 85, 86, 459, 114,
+	89, 90, 460, 38, 93, 461, 462, 463, 464, 465, 72, 466, 467, 468, 469, 103,
+	104, 105, 201, 107, 0, 470, 471, 110, 85, 86, 472, 114, 89, 90, 473, 38,
+	93, 206, 119, 96, 474, 98, 72, 242, 243, 244, 232, 103, 104, 105, 201, 107,
+};
+
+static const uint8_t kCostsEn [6650] =
+{
+	63, 84, 84, 69, 102, 148, 86, 69, 84, 89, 68, 101, 149, 152, 49, 118,
+	102, 118, 134, 167, 121, 103, 103, 121, 118, 135, 104, 152, 115, 91, 69, 108,
+	166, 185, 57, 55, 91, 63, 68, 101, 184, 153, 70, 211, 201, 114, 139, 212,
+	93, 188, 180, 79, 152, 243, 170, 147, 137, 194, 136, 165, 59, 248, 92, 201,
+	113, 79, 121, 181, 203, 170, 101, 131, 187, 194, 140, 146, 139, 139, 114, 127,
+	135, 149, 198, 166, 121, 148, 104, 123, 168, 167, 91, 36, 135, 39, 118, 89,
+	43, 187, 154, 243, 124, 198, 252, 210, 95, 235, 114, 76, 168, 245, 221, 253,
+	120, 100, 135, 162, 124, 178, 95, 89, 100, 63, 150, 164, 248, 137, 106, 241,
+	170, 162, 159, 244, 156, 247, 163, 143, 106, 163, 248, 248, 137, 154, 88, 89,
+	181, 202, 122, 21, 122, 140, 82, 187, 186, 188, 87, 114, 247, 244, 127, 148,
+	255, 135, 98, 159, 246, 146, 248, 255, 120, 115, 105, 193, 91, 244, 140, 106,
+	132, 76, 152, 116, 198, 247, 121, 195, 106, 115, 175, 177, 154, 185, 162, 159,
+	135, 214, 139, 153, 121, 114, 137, 163, 204, 243, 169, 135, 131, 173, 135, 147,
+	202, 201, 135, 163, 138, 179, 199, 182, 186, 188, 209, 223, 121, 227, 238, 200,
+	154, 74, 135, 45, 185, 169, 104, 56, 42, 63, 104, 83, 231, 187, 138, 178,
+	150, 196, 105, 212, 72, 202, 147, 43, 134, 245, 185, 249, 68, 244, 153, 248,
+	255, 245, 255, 255, 151, 137, 127, 144, 246, 255, 105, 244, 152, 144, 173, 182,
+	159, 169, 149, 204, 169, 149, 186, 252, 121, 196, 166, 178, 76, 227, 118, 183,
+	68, 154, 56, 147, 247, 195, 139, 196, 234, 245, 26, 197, 125, 219, 178, 79,
+	153, 199, 216, 196, 84, 122, 154, 191, 186, 183, 136, 24, 79, 93, 113, 170,
+	255, 155, 88, 145, 153, 114, 207, 179, 127, 150, 134, 143, 167, 201, 172, 251,
+	154, 210, 201, 244, 41, 241, 253, 219, 212, 79, 253, 248, 252, 252, 17, 117,
+	118, 135, 135, 245, 143, 245, 102, 255, 86, 248, 135, 127, 101, 243, 255, 243,
+	255, 245, 255, 175, 161, 255, 255, 165, 250, 137, 85, 130, 143, 113, 73, 245,
+	89, 159, 244, 143, 150, 150, 255, 248, 17, 119, 135, 119, 136, 183, 120, 120,
+	136, 123, 117, 153, 121, 170, 51, 70, 70, 120, 119, 135, 56, 86, 89, 41,
+	68, 100, 170, 121, 52, 147, 136, 84, 248, 243, 79, 136, 149, 79, 148, 243,
+	120, 100, 68, 131, 135, 85, 53, 248, 103, 136, 82, 95, 103, 149, 255, 247,
+	68, 116, 127, 145, 127, 147, 143, 119, 117, 127, 150, 87, 247, 150, 52, 86,
+	102, 121, 73, 118, 73, 37, 154, 70, 85, 87, 63, 167, 68, 245, 103, 117,
+	250, 242, 79, 118, 83, 58, 150, 245, 255, 255, 53, 117, 103, 116, 127, 162,
+	95, 58, 68, 79, 102, 245, 249, 111, 51, 131, 68, 242, 111, 115, 119, 127,
+	116, 255, 88, 133, 246, 248, 68, 118, 70, 70, 245, 152, 106, 20, 102, 95,
+	101, 120, 122, 143, 100, 130, 136, 161, 142, 164, 185, 136, 115, 158, 182, 147,
+	233, 169, 50, 131, 111, 242, 104, 243, 120, 135, 116, 88, 135, 117, 248, 255,
+	52, 147, 87, 99, 170, 242, 111, 119, 114, 175, 102, 166, 166, 122, 68, 98,
+	119, 115, 159, 243, 167, 134, 131, 159, 117, 244, 168, 247, 50, 131, 104, 244,
+	117, 245, 136, 122, 146, 127, 120, 244, 170, 152, 67, 106, 151, 74, 247, 247,
+	102, 71, 41, 63, 101, 100, 247, 250, 84, 162, 101, 245, 88, 244, 86, 250,
+	83, 42, 117, 165, 247, 250, 20, 247, 255, 255, 255, 254, 255, 95, 247, 255,
+	255, 243, 242, 245, 51, 116, 87, 97, 120, 165, 151, 102, 164, 154, 133, 117,
+	135, 153, 50, 133, 134, 131, 90, 244, 118, 136, 85, 137, 56, 148, 167, 149,
+	81, 148, 151, 164, 74, 245, 89, 247, 244, 95, 152, 247, 138, 180, 68, 127,
+	103, 159, 135, 244, 118, 39, 63, 79, 98, 247, 137, 137, 50, 114, 248, 99,
+	255, 244, 111, 244, 86, 127, 118, 255, 127, 255, 51, 131, 104, 244, 55, 242,
+	246, 111, 132, 79, 255, 246, 120, 255, 48, 247, 134, 88, 136, 247, 255, 247,
+	120, 143, 135, 159, 95, 105, 21, 242, 255, 243, 248, 119, 248, 140, 117, 255,
+	232, 246, 255, 245, 36, 100, 103, 83, 95, 246, 39, 247, 247, 246, 244, 86,
+	247, 247, 49, 101, 86, 150, 135, 134, 102, 102, 117, 105, 117, 151, 152, 152,
+	98, 104, 118, 127, 246, 246, 53, 51, 111, 56, 69, 248, 255, 133, 101, 100,
+	249, 245, 188, 243, 27, 156, 180, 143, 197, 246, 185, 200, 119, 166, 196, 243,
+	42, 246, 146, 207, 199, 87, 40, 249, 255, 248, 82, 165, 41, 195, 138, 116,
+	127, 182, 182, 127, 197, 136, 250, 164, 82, 116, 188, 238, 245, 255, 52, 67,
+	118, 70, 87, 127, 214, 245, 102, 245, 255, 67, 246, 118, 127, 127, 134, 95,
+	24, 247, 152, 249, 100, 131, 159, 241, 103, 245, 175, 104, 198, 127, 116, 198,
+	249, 250, 82, 146, 143, 245, 247, 244, 105, 104, 244, 95, 120, 242, 255, 249,
+	116, 152, 119, 170, 248, 154, 24, 39, 137, 92, 87, 171, 152, 154, 99, 113,
+	111, 244, 127, 132, 136, 248, 99, 127, 247, 244, 255, 248, 67, 243, 248, 146,
+	79, 243, 134, 137, 117, 127, 118, 165, 246, 248, 82, 133, 153, 117, 183, 194,
+	41, 167, 135, 108, 85, 147, 168, 185, 83, 84, 154, 193, 186, 196, 139, 151,
+	86, 159, 151, 167, 202, 252, 82, 165, 36, 214, 163, 133, 151, 58, 198, 221,
+	86, 215, 203, 133, 65, 255, 125, 111, 120, 248, 111, 70, 111, 79, 117, 227,
+	254, 248, 99, 243, 184, 148, 79, 244, 111, 249, 36, 123, 68, 245, 251, 251,
+	68, 230, 138, 232, 234, 230, 174, 142, 152, 136, 137, 176, 229, 233, 100, 115,
+	68, 99, 147, 164, 134, 70, 135, 106, 69, 167, 202, 180, 114, 182, 246, 211,
+	75, 246, 149, 119, 167, 186, 51, 184, 221, 183, 99, 196, 244, 146, 94, 178,
+	124, 171, 166, 175, 71, 148, 238, 171, 117, 152, 71, 250, 182, 139, 24, 89,
+	139, 95, 35, 187, 89, 136, 119, 242, 175, 241, 168, 243, 159, 143, 132, 95,
+	135, 247, 143, 250, 83, 97, 137, 148, 152, 147, 119, 72, 150, 111, 136, 245,
+	248, 245, 49, 147, 247, 151, 255, 242, 159, 255, 150, 127, 121, 248, 152, 249,
+	65, 115, 171, 181, 248, 245, 122, 151, 245, 143, 116, 150, 251, 248, 84, 241,
+	143, 243, 103, 243, 136, 104, 244, 255, 136, 133, 255, 116, 49, 135, 134, 135,
+	247, 151, 102, 103, 136, 95, 117, 249, 248, 120, 100, 103, 35, 152, 101, 134,
+	70, 71, 185, 79, 82, 183, 248, 149, 100, 244, 255, 83, 255, 212, 95, 254,
+	246, 31, 253, 245, 255, 252, 100, 179, 150, 164, 58, 213, 100, 186, 130, 91,
+	55, 181, 220, 184, 65, 148, 89, 163, 154, 147, 124, 137, 132, 111, 133, 150,
+	168, 183, 113, 168, 117, 69, 102, 182, 72, 105, 170, 44, 87, 172, 171, 199,
+	86, 251, 15, 205, 255, 243, 223, 255, 250, 207, 221, 246, 255, 254, 66, 132,
+	153, 162, 103, 195, 105, 71, 117, 94, 117, 196, 201, 169, 82, 195, 154, 162,
+	156, 179, 139, 151, 180, 125, 120, 181, 248, 249, 83, 132, 100, 119, 148, 153,
+	71, 41, 152, 105, 37, 139, 249, 169, 152, 253, 135, 128, 255, 254, 255, 255,
+	249, 255, 249, 253, 255, 143, 66, 147, 120, 146, 103, 211, 137, 73, 117, 93,
+	101, 133, 215, 216, 168, 244, 255, 240, 255, 164, 250, 255, 244, 255, 252, 249,
+	159, 246, 99, 199, 255, 251, 248, 246, 255, 253, 112, 255, 255, 253, 255, 255,
+	82, 164, 69, 100, 147, 165, 102, 104, 115, 140, 52, 102, 202, 167, 101, 134,
+	107, 170, 134, 248, 23, 87, 165, 75, 69, 100, 122, 137, 100, 195, 102, 179,
+	104, 245, 72, 186, 67, 59, 70, 164, 170, 247, 118, 241, 170, 243, 255, 165,
+	152, 143, 244, 255, 250, 166, 255, 248, 66, 255, 70, 243, 143, 246, 249, 159,
+	82, 79, 53, 255, 255, 150, 51, 243, 244, 246, 191, 243, 255, 255, 118, 47,
+	237, 253, 255, 243, 134, 135, 118, 89, 146, 163, 86, 70, 250, 79, 37, 171,
+	170, 152, 86, 146, 153, 145, 218, 195, 157, 136, 133, 143, 151, 185, 170, 250,
+	99, 178, 137, 179, 58, 226, 123, 74, 164, 79, 183, 248, 171, 201, 50, 165,
+	149, 132, 138, 211, 173, 184, 40, 156, 57, 183, 122, 151, 97, 247, 250, 248,
+	247, 255, 138, 159, 138, 255, 41, 255, 255, 255, 84, 115, 154, 129, 88, 164,
+	105, 151, 165, 138, 167, 151, 250, 151, 49, 118, 118, 118, 152, 246, 106, 87,
+	119, 106, 85, 89, 120, 248, 118, 139, 165, 186, 154, 170, 59, 39, 90, 91,
+	37, 166, 207, 200, 69, 131, 168, 130, 155, 84, 57, 151, 147, 79, 134, 179,
+	169, 164, 84, 244, 255, 145, 223, 246, 255, 255, 243, 143, 153, 243, 255, 255,
+	50, 244, 223, 67, 111, 244, 239, 255, 87, 63, 100, 253, 63, 254, 65, 153,
+	79, 197, 156, 246, 111, 70, 95, 79, 146, 203, 255, 255, 98, 244, 122, 69,
+	187, 178, 94, 186, 130, 77, 86, 213, 188, 246, 82, 242, 171, 242, 172, 194,
+	203, 185, 165, 143, 170, 197, 253, 250, 166, 131, 107, 20, 255, 166, 123, 69,
+	55, 143, 69, 251, 251, 255, 66, 178, 191, 115, 183, 244, 122, 170, 118, 159,
+	131, 245, 247, 185, 133, 242, 249, 163, 255, 244, 255, 154, 242, 175, 248, 242,
+	255, 249, 99, 66, 138, 162, 187, 227, 138, 132, 67, 173, 135, 149, 186, 218,
+	167, 168, 58, 139, 181, 220, 92, 34, 89, 60, 152, 131, 219, 202, 84, 246,
+	255, 251, 255, 245, 127, 255, 136, 111, 197, 240, 255, 255, 119, 245, 183, 241,
+	191, 242, 95, 175, 243, 255, 143, 247, 187, 244, 49, 246, 246, 245, 143, 246,
+	247, 143, 56, 79, 86, 120, 255, 110, 99, 215, 191, 115, 255, 241, 124, 207,
+	243, 143, 181, 244, 159, 249, 118, 119, 168, 249, 255, 247, 95, 115, 159, 31,
+	37, 159, 255, 168, 48, 120, 245, 255, 255, 255, 255, 117, 93, 95, 141, 255,
+	255, 255, 64, 118, 135, 136, 136, 183, 121, 118, 118, 104, 117, 136, 169, 202,
+	100, 89, 122, 247, 119, 135, 103, 70, 105, 58, 23, 120, 248, 148, 33, 245,
+	247, 247, 246, 214, 191, 119, 101, 111, 254, 243, 255, 245, 82, 167, 175, 243,
+	138, 243, 95, 255, 151, 31, 247, 168, 255, 250, 82, 71, 69, 57, 185, 218,
+	75, 71, 87, 60, 84, 91, 75, 203, 68, 242, 247, 244, 95, 242, 255, 255,
+	244, 127, 239, 243, 255, 247, 134, 147, 101, 55, 182, 171, 154, 56, 198, 43,
+	66, 105, 155, 186, 118, 242, 255, 244, 255, 242, 255, 255, 245, 255, 254, 98,
+	255, 247, 134, 246, 136, 241, 249, 147, 79, 255, 246, 255, 255, 255, 143, 244,
+	52, 179, 111, 246, 255, 241, 255, 252, 91, 255, 95, 246, 255, 255, 20, 244,
+	125, 246, 247, 119, 254, 239, 244, 255, 194, 238, 255, 246, 114, 121, 164, 146,
+	246, 247, 105, 52, 153, 107, 103, 132, 148, 187, 66, 244, 238, 118, 255, 243,
+	113, 255, 198, 95, 206, 246, 119, 255, 67, 244, 175, 241, 255, 244, 159, 255,
+	132, 255, 150, 246, 255, 248, 49, 119, 167, 247, 95, 250, 247, 255, 85, 159,
+	106, 250, 250, 250, 36, 247, 143, 247, 31, 139, 136, 255, 102, 95, 247, 254,
+	255, 248, 117, 117, 147, 164, 167, 154, 40, 83, 58, 58, 102, 169, 249, 159,
+	40, 241, 255, 119, 207, 246, 255, 223, 243, 143, 255, 255, 255, 143, 81, 246,
+	159, 249, 247, 248, 111, 30, 233, 255, 137, 247, 255, 255, 64, 135, 103, 119,
+	118, 167, 121, 135, 119, 127, 117, 136, 200, 155, 119, 124, 20, 172, 203, 251,
+	86, 85, 143, 79, 51, 120, 255, 252, 84, 98, 247, 166, 255, 243, 95, 151,
+	164, 111, 167, 161, 255, 248, 101, 246, 202, 214, 111, 243, 133, 204, 195, 127,
+	24, 180, 255, 255, 48, 217, 156, 197, 234, 212, 159, 189, 216, 175, 199, 231,
+	252, 239, 82, 138, 41, 135, 250, 249, 116, 38, 72, 95, 101, 251, 155, 123,
+	84, 242, 249, 83, 191, 242, 107, 170, 243, 127, 85, 245, 255, 255, 101, 163,
+	255, 147, 152, 241, 159, 148, 148, 95, 247, 245, 186, 246, 35, 242, 111, 245,
+	255, 243, 255, 143, 132, 111, 143, 243, 246, 255, 83, 104, 118, 105, 100, 159,
+	105, 39, 121, 63, 39, 63, 255, 249, 65, 244, 71, 131, 104, 243, 135, 104,
+	100, 239, 102, 244, 246, 248, 83, 196, 56, 67, 168, 180, 74, 185, 82, 143,
+	118, 168, 251, 197, 83, 52, 170, 243, 170, 246, 191, 175, 50, 191, 165, 182,
+	255, 204, 83, 164, 51, 164, 148, 166, 171, 154, 135, 171, 21, 119, 203, 169,
+	66, 159, 247, 63, 118, 159, 47, 70, 73, 79, 149, 243, 255, 255, 100, 243,
+	249, 243, 159, 245, 59, 175, 98, 79, 55, 148, 255, 251, 101, 250, 255, 250,
+	255, 249, 255, 255, 175, 250, 255, 240, 255, 255, 82, 116, 153, 100, 166, 229,
+	122, 69, 118, 63, 83, 89, 247, 199, 65, 185, 197, 212, 143, 215, 215, 124,
+	101, 255, 50, 215, 252, 168, 65, 180, 181, 163, 90, 197, 139, 154, 167, 95,
+	69, 181, 181, 168, 100, 232, 40, 244, 255, 246, 95, 124, 207, 56, 66, 255,
+	104, 255, 85, 164, 170, 241, 249, 162, 159, 175, 244, 175, 248, 249, 255, 255,
+	81, 244, 250, 244, 127, 245, 58, 239, 165, 95, 166, 249, 255, 168, 83, 245,
+	180, 196, 143, 243, 207, 251, 44, 207, 47, 248, 207, 255, 65, 103, 135, 136,
+	247, 136, 153, 135, 134, 95, 67, 153, 246, 249, 33, 101, 117, 102, 117, 246,
+	95, 117, 119, 111, 117, 118, 159, 153, 151, 250, 165, 250, 170, 241, 87, 118,
+	191, 91, 102, 146, 170, 250, 17, 246, 111, 244, 255, 252, 255, 87, 70, 239,
+	245, 254, 255, 255, 84, 149, 100, 246, 175, 169, 127, 121, 255, 31, 57, 255,
+	246, 250, 67, 249, 255, 66, 137, 147, 127, 154, 249, 175, 146, 255, 255, 255,
+	137, 202, 196, 163, 244, 175, 27, 61, 221, 95, 143, 223, 79, 253, 137, 241,
+	175, 248, 248, 146, 255, 255, 242, 255, 154, 245, 255, 249, 100, 251, 175, 223,
+	252, 253, 79, 123, 185, 15, 219, 212, 255, 255, 50, 245, 254, 247, 255, 247,
+	207, 247, 124, 63, 87, 242, 95, 255, 103, 243, 255, 243, 250, 245, 255, 255,
+	241, 255, 249, 111, 255, 250, 83, 249, 246, 145, 248, 248, 255, 244, 88, 159,
+	73, 255, 255, 246, 66, 249, 255, 129, 159, 247, 255, 255, 103, 159, 247, 159,
+	242, 249, 133, 255, 255, 248, 247, 127, 24, 24, 239, 95, 68, 153, 255, 249,
+	80, 248, 255, 249, 255, 243, 255, 253, 217, 159, 254, 255, 255, 255, 64, 150,
+	137, 135, 152, 166, 105, 120, 185, 127, 101, 168, 250, 185, 67, 103, 102, 152,
+	135, 243, 58, 69, 102, 63, 53, 118, 167, 118, 52, 242, 255, 242, 255, 212,
+	79, 255, 244, 111, 254, 244, 255, 252, 49, 185, 74, 204, 220, 187, 121, 56,
+	199, 79, 51, 189, 123, 219, 85, 243, 248, 241, 143, 242, 79, 223, 246, 111,
+	255, 245, 248, 247, 82, 115, 127, 244, 255, 245, 79, 137, 246, 159, 40, 245,
+	248, 248, 134, 134, 85, 170, 250, 250, 139, 56, 181, 140, 34, 57, 252, 154,
+	153, 244, 255, 242, 255, 242, 239, 255, 242, 127, 255, 247, 255, 245, 118, 196,
+	255, 240, 255, 248, 111, 253, 117, 255, 111, 253, 255, 255, 115, 178, 251, 244,
+	250, 243, 255, 244, 178, 255, 250, 243, 251, 255, 83, 135, 153, 151, 248, 247,
+	74, 54, 164, 47, 38, 102, 248, 138, 66, 248, 95, 251, 98, 253, 79, 143,
+	140, 63, 200, 246, 135, 255, 117, 161, 255, 243, 255, 245, 255, 255, 129, 255,
+	250, 249, 175, 255, 33, 150, 104, 246, 111, 246, 248, 248, 117, 255, 68, 249,
+	255, 255, 85, 244, 255, 246, 15, 252, 135, 255, 245, 127, 248, 246, 255, 247,
+	117, 146, 139, 244, 185, 132, 79, 98, 134, 63, 117, 251, 250, 184, 65, 133,
+	169, 182, 217, 182, 122, 84, 68, 127, 84, 183, 216, 170, 65, 134, 102, 86,
+	136, 133, 90, 86, 101, 95, 118, 135, 248, 143, 102, 104, 105, 169, 153, 150,
+	88, 37, 121, 43, 51, 71, 248, 152, 129, 164, 101, 200, 171, 247, 91, 70,
+	203, 60, 133, 203, 121, 184, 117, 103, 116, 104, 197, 186, 57, 39, 105, 104,
+	66, 63, 171, 186, 99, 147, 89, 114, 184, 179, 74, 168, 131, 141, 86, 133,
+	169, 181, 66, 200, 255, 242, 255, 244, 143, 245, 210, 255, 245, 244, 248, 255,
+	133, 152, 88, 168, 185, 166, 88, 68, 117, 63, 84, 130, 242, 186, 118, 242,
+	143, 129, 255, 245, 255, 231, 114, 239, 238, 134, 255, 247, 49, 253, 247, 245,
+	111, 246, 118, 255, 61, 127, 60, 253, 255, 253, 65, 246, 255, 245, 143, 246,
+	127, 132, 244, 127, 38, 248, 246, 247, 101, 114, 136, 134, 135, 148, 103, 35,
+	105, 88, 104, 120, 246, 170, 49, 117, 103, 117, 134, 134, 102, 87, 99, 136,
+	101, 103, 152, 151, 67, 75, 152, 171, 150, 248, 57, 40, 135, 107, 53, 168,
+	251, 250, 84, 117, 135, 244, 249, 243, 42, 134, 149, 63, 118, 242, 247, 246,
+	82, 194, 252, 148, 79, 245, 197, 250, 181, 127, 70, 249, 255, 246, 65, 245,
+	90, 179, 167, 150, 143, 143, 201, 159, 85, 247, 123, 203, 133, 159, 39, 167,
+	169, 251, 57, 71, 159, 74, 98, 91, 165, 255, 114, 247, 170, 54, 255, 241,
+	127, 191, 167, 175, 95, 247, 255, 243, 100, 182, 252, 245, 53, 244, 251, 25,
+	169, 140, 153, 243, 250, 255, 49, 231, 108, 77, 246, 244, 87, 70, 235, 95,
+	102, 215, 246, 231, 115, 241, 255, 244, 255, 242, 247, 127, 244, 255, 245, 246,
+	255, 255, 67, 131, 143, 242, 104, 244, 103, 143, 115, 255, 118, 245, 246, 247,
+	118, 149, 90, 176, 188, 181, 76, 154, 200, 252, 86, 182, 255, 248, 117, 82,
+	138, 242, 185, 243, 171, 179, 55, 175, 185, 244, 255, 255, 115, 181, 69, 84,
+	146, 181, 149, 158, 104, 220, 68, 71, 191, 202, 150, 207, 171, 255, 253, 223,
+	140, 12, 175, 123, 170, 198, 250, 255, 83, 243, 247, 243, 111, 245, 59, 250,
+	56, 127, 52, 102, 127, 255, 84, 180, 136, 241, 152, 197, 200, 150, 181, 122,
+	99, 184, 251, 248, 113, 180, 198, 166, 92, 246, 120, 134, 71, 175, 36, 249,
+	223, 252, 82, 214, 167, 163, 45, 179, 124, 151, 181, 159, 84, 247, 218, 164,
+	100, 85, 101, 116, 166, 165, 72, 52, 72, 75, 51, 170, 137, 169, 151, 148,
+	249, 240, 255, 244, 187, 159, 247, 255, 184, 185, 255, 255, 49, 247, 152, 243,
+	255, 246, 121, 249, 214, 127, 63, 244, 255, 249, 84, 241, 255, 244, 255, 245,
+	255, 219, 179, 255, 220, 246, 255, 247, 183, 244, 251, 240, 127, 244, 185, 187,
+	182, 175, 251, 250, 255, 143, 33, 118, 102, 119, 135, 167, 120, 103, 119, 121,
+	101, 135, 120, 153, 82, 79, 117, 121, 104, 151, 70, 52, 73, 71, 118, 85,
+	245, 119, 132, 143, 224, 250, 154, 143, 111, 127, 249, 105, 169, 143, 247, 175,
+	82, 51, 213, 231, 102, 103, 69, 52, 117, 95, 70, 239, 246, 127, 100, 31,
+	238, 143, 88, 131, 111, 72, 239, 63, 213, 119, 247, 103, 83, 132, 102, 114,
+	166, 180, 135, 85, 132, 92, 85, 117, 185, 197, 66, 165, 166, 147, 91, 244,
+	119, 136, 85, 155, 52, 165, 215, 181, 82, 180, 151, 147, 59, 195, 124, 169,
+	115, 79, 102, 182, 184, 182, 84, 85, 94, 135, 255, 142, 86, 50, 127, 71,
+	98, 143, 103, 248, 49, 103, 86, 151, 103, 247, 103, 86, 118, 95, 118, 152,
+	248, 249, 99, 104, 103, 152, 130, 85, 71, 69, 120, 59, 85, 119, 167, 117,
+	99, 170, 58, 117, 188, 249, 106, 71, 138, 79, 53, 203, 184, 241, 33, 245,
+	255, 250, 238, 247, 239, 79, 125, 63, 231, 252, 255, 255, 68, 241, 255, 244,
+	255, 244, 111, 244, 243, 111, 118, 115, 247, 248, 116, 86, 120, 246, 153, 121,
+	73, 22, 39, 95, 100, 138, 248, 168, 137, 247, 175, 247, 250, 249, 255, 255,
+	240, 255, 239, 255, 255, 255, 99, 87, 86, 105, 104, 246, 53, 52, 86, 63,
+	69, 83, 248, 133, 108, 18, 255, 246, 255, 243, 248, 238, 244, 239, 238, 243,
+	255, 135, 49, 118, 255, 246, 111, 247, 79, 159, 89, 255, 110, 83, 255, 153,
+	85, 245, 255, 247, 111, 133, 143, 255, 242, 31, 248, 248, 255, 246, 84, 102,
+	127, 119, 247, 118, 69, 68, 38, 63, 69, 134, 246, 152, 49, 118, 119, 103,
+	119, 167, 103, 71, 102, 105, 132, 120, 121, 167, 116, 72, 132, 202, 116, 182,
+	119, 54, 104, 60, 51, 102, 103, 131, 64, 245, 151, 149, 159, 246, 175, 88,
+	168, 127, 165, 249, 255, 255, 65, 165, 53, 121, 166, 218, 138, 85, 170, 110,
+	83, 106, 155, 201, 33, 246, 143, 151, 255, 150, 255, 246, 242, 239, 248, 117,
+	120, 255, 117, 115, 255, 244, 239, 244, 239, 127, 241, 127, 254, 247, 255, 255,
+	133, 85, 35, 117, 213, 187, 166, 37, 139, 188, 83, 139, 186, 91, 81, 133,
+	191, 195, 255, 245, 207, 201, 162, 191, 166, 185, 172, 244, 49, 194, 255, 244,
+	127, 245, 255, 77, 101, 255, 245, 246, 255, 245, 134, 84, 145, 171, 148, 169,
+	153, 71, 117, 111, 101, 120, 146, 186, 49, 245, 245, 115, 63, 245, 223, 255,
+	135, 111, 216, 247, 255, 255, 100, 246, 255, 240, 255, 248, 111, 238, 244, 239,
+	231, 254, 247, 142, 49, 136, 104, 244, 120, 248, 104, 248, 244, 175, 89, 153,
+	255, 255, 34, 181, 255, 243, 120, 178, 137, 255, 246, 143, 181, 251, 255, 185,
+	117, 134, 54, 161, 165, 184, 119, 100, 184, 73, 68, 186, 151, 170, 88, 243,
+	255, 241, 255, 242, 255, 247, 254, 255, 255, 248, 255, 255, 48, 247, 171, 255,
+	251, 246, 191, 120, 143, 159, 151, 251, 175, 191, 49, 135, 86, 151, 119, 247,
+	88, 87, 105, 95, 84, 118, 136, 143, 116, 152, 116, 186, 132, 117, 68, 40,
+	90, 74, 37, 153, 89, 132, 118, 244, 255, 242, 255, 244, 79, 175, 241, 127,
+	255, 246, 250, 249, 18, 83, 95, 245, 246, 245, 95, 255, 245, 95, 245, 253,
+	255, 255, 66, 182, 72, 186, 169, 218, 138, 36, 152, 79, 67, 251, 186, 171,
+	101, 118, 100, 200, 198, 204, 89, 40, 92, 106, 34, 252, 72, 105, 50, 244,
+	223, 245, 255, 241, 207, 255, 246, 127, 215, 253, 255, 247, 118, 177, 159, 243,
+	255, 242, 255, 250, 244, 171, 255, 246, 143, 250, 66, 244, 126, 243, 243, 244,
+	254, 239, 132, 127, 98, 238, 255, 246, 117, 153, 39, 156, 153, 169, 120, 56,
+	170, 59, 69, 37, 191, 153, 100, 243, 143, 150, 139, 244, 47, 255, 179, 57,
+	54, 246, 170, 251, 33, 100, 111, 245, 102, 245, 118, 143, 71, 127, 134, 247,
+	143, 143, 34, 242, 254, 246, 95, 243, 111, 255, 119, 207, 229, 244, 247, 254,
+	133, 153, 119, 187, 169, 155, 39, 83, 250, 95, 81, 191, 187, 120, 65, 135,
+	134, 119, 153, 248, 136, 120, 120, 119, 38, 152, 202, 250, 116, 57, 119, 154,
+	117, 168, 55, 97, 137, 92, 55, 119, 184, 217, 117, 180, 171, 242, 47, 244,
+	79, 249, 243, 79, 58, 251, 255, 245, 65, 164, 191, 179, 173, 148, 91, 219,
+	165, 143, 180, 248, 138, 203, 66, 151, 53, 164, 214, 215, 106, 87, 151, 59,
+	84, 123, 67, 169, 119, 255, 249, 105, 255, 242, 63, 191, 161, 143, 251, 247,
+	255, 255, 49, 149, 154, 163, 152, 183, 88, 170, 198, 142, 86, 245, 185, 220,
+	99, 241, 255, 243, 255, 243, 255, 255, 247, 255, 255, 245, 255, 255, 100, 132,
+	116, 135, 166, 137, 135, 21, 120, 183, 52, 151, 122, 73, 115, 242, 255, 243,
+	255, 243, 247, 255, 243, 255, 244, 244, 255, 247, 82, 244, 255, 244, 143, 244,
+	255, 31, 151, 255, 163, 248, 255, 255, 169, 246, 249, 244, 175, 244, 255, 168,
+	163, 175, 255, 250, 249, 240, 119, 210, 255, 240, 255, 247, 255, 254, 101, 255,
+	255, 254, 255, 255, 151, 245, 251, 243, 249, 244, 191, 155, 240, 255, 186, 249,
+	251, 249, 99, 138, 121, 154, 187, 202, 171, 72, 122, 63, 24, 103, 212, 253,
+	136, 243, 255, 248, 244, 246, 127, 255, 232, 73, 153, 240, 255, 255, 104, 247,
+	255, 240, 159, 247, 255, 255, 249, 159, 120, 255, 255, 255, 50, 246, 201, 116,
+	127, 244, 119, 106, 120, 207, 41, 196, 249, 251, 66, 195, 203, 146, 127, 196,
+	111, 253, 181, 63, 244, 215, 205, 249, 68, 133, 152, 149, 185, 246, 71, 113,
+	104, 123, 117, 250, 90, 251, 136, 240, 255, 244, 255, 245, 255, 255, 181, 255,
+	251, 255, 255, 255, 81, 243, 151, 247, 255, 116, 249, 132, 230, 255, 88, 246,
+	245, 249, 49, 117, 101, 134, 119, 150, 118, 118, 102, 90, 101, 118, 247, 166,
+	148, 153, 23, 255, 121, 255, 105, 88, 127, 95, 37, 153, 111, 152, 84, 115,
+	255, 150, 159, 22, 63, 159, 133, 127, 100, 167, 249, 249, 83, 193, 245, 179,
+	111, 246, 131, 202, 181, 127, 101, 148, 255, 252, 100, 150, 105, 177, 154, 243,
+	155, 187, 150, 143, 151, 163, 251, 247, 246, 255, 158, 255, 255, 248, 152, 120,
+	255, 143, 144, 152, 127, 255, 112, 200, 188, 60, 255, 199, 175, 255, 249, 255,
+	92, 248, 255, 252, 99, 118, 154, 244, 133, 243, 111, 42, 244, 47, 247, 245,
+	255, 249, 132, 118, 53, 248, 127, 255, 135, 24, 137, 79, 118, 255, 248, 249,
+	66, 133, 255, 241, 127, 244, 136, 150, 116, 79, 245, 243, 247, 248, 82, 165,
+	73, 244, 170, 164, 57, 137, 148, 207, 132, 68, 252, 184, 98, 84, 155, 164,
+	255, 245, 188, 130, 38, 188, 185, 249, 250, 250, 65, 198, 88, 84, 213, 182,
+	75, 120, 184, 220, 67, 123, 252, 152, 97, 255, 90, 154, 249, 255, 67, 70,
+	73, 105, 52, 168, 255, 250, 84, 183, 116, 178, 159, 246, 124, 169, 102, 111,
+	22, 248, 207, 244, 65, 150, 71, 196, 200, 181, 181, 148, 167, 95, 54, 250,
+	249, 212, 83, 246, 249, 146, 91, 178, 135, 121, 118, 154, 36, 248, 251, 249,
+	112, 245, 187, 243, 79, 183, 159, 207, 181, 175, 136, 249, 253, 220, 131, 104,
+	183, 137, 198, 186, 57, 57, 77, 63, 37, 191, 189, 187, 118, 131, 184, 241,
+	250, 243, 171, 155, 118, 175, 246, 250, 151, 248, 82, 247, 187, 147, 175, 244,
+	143, 47, 251, 191, 165, 250, 255, 186, 49, 118, 86, 103, 119, 135, 102, 88,
+	103, 87, 133, 119, 136, 248, 118, 122, 98, 251, 133, 182, 71, 71, 122, 41,
+	35, 151, 168, 169, 49, 153, 159, 151, 127, 249, 105, 249, 146, 79, 214, 255,
+	159, 255, 100, 80, 255, 118, 255, 245, 255, 255, 158, 159, 159, 255, 127, 255,
+	83, 214, 82, 183, 153, 249, 125, 56, 217, 44, 134, 252, 169, 223, 50, 253,
+	246, 247, 239, 245, 127, 116, 45, 47, 246, 108, 255, 255, 84, 243, 89, 243,
+	255, 243, 255, 127, 146, 63, 245, 148, 255, 244, 116, 150, 51, 244, 249, 143,
+	54, 40, 56, 58, 103, 153, 159, 154, 218, 245, 242, 250, 225, 244, 255, 207,
+	247, 239, 118, 253, 255, 255, 151, 242, 191, 242, 255, 162, 255, 191, 247, 255,
+	95, 149, 175, 148, 151, 202, 136, 159, 137, 244, 73, 55, 87, 27, 83, 200,
+	245, 251, 184, 248, 181, 243, 255, 244, 47, 251, 161, 90, 246, 247, 255, 249,
+	103, 248, 250, 145, 252, 242, 255, 170, 241, 255, 137, 183, 207, 255, 49, 119,
+	151, 115, 111, 245, 246, 247, 120, 111, 38, 153, 249, 255, 82, 151, 255, 197,
+	111, 241, 207, 156, 245, 159, 246, 248, 207, 244, 84, 54, 139, 247, 186, 248,
+	88, 104, 250, 75, 20, 255, 255, 184, 81, 246, 255, 246, 255, 243, 255, 236,
+	221, 63, 87, 247, 255, 255, 49, 114, 119, 102, 127, 255, 255, 127, 255, 111,
+	231, 244, 255, 117, 100, 89, 68, 138, 133, 149, 55, 52, 105, 59, 52, 118,
+	136, 150, 82, 133, 68, 102, 166, 184, 89, 69, 104, 55, 84, 121, 87, 183,
+	117, 101, 85, 85, 181, 170, 72, 37, 99, 90, 51, 106, 122, 106, 115, 103,
+	85, 71, 166, 168, 87, 36, 86, 60, 70, 100, 165, 186, 136, 164, 191, 178,
+	255, 241, 255, 175, 244, 255, 170, 255, 255, 255, 49, 118, 119, 119, 151, 151,
+	119, 103, 119, 127, 101, 135, 152, 154, 116, 106, 99, 153, 118, 118, 70, 35,
+	105, 73, 38, 121, 246, 134, 38, 147, 255, 243, 152, 147, 143, 255, 243, 143,
+	255, 245, 255, 246, 100, 246, 255, 129, 31, 246, 159, 143, 248, 191, 139, 184,
+	255, 255, 49, 246, 191, 163, 143, 164, 107, 186, 168, 191, 180, 246, 245, 169,
+	99, 115, 67, 86, 196, 137, 76, 69, 88, 149, 99, 89, 185, 203, 82, 243,
+	246, 150, 255, 116, 41, 255, 243, 159, 119, 246, 95, 249, 85, 182, 255, 241,
+	143, 245, 159, 191, 150, 159, 245, 178, 251, 248, 116, 68, 85, 100, 212, 159,
+	136, 38, 70, 169, 54, 90, 171, 120, 82, 244, 143, 131, 127, 242, 137, 134,
+	247, 255, 52, 150, 248, 248, 50, 130, 127, 101, 255, 244, 239, 249, 150, 255,
+	244, 255, 255, 244, 67, 145, 171, 148, 255, 243, 159, 123, 246, 191, 151, 103,
+	249, 249, 98, 242, 159, 164, 248, 162, 191, 187, 247, 255, 148, 249, 251, 255,
+	100, 104, 116, 121, 148, 138, 87, 83, 85, 44, 85, 83, 119, 152, 67, 244,
+	242, 247, 95, 246, 223, 247, 211, 47, 119, 246, 255, 255, 134, 180, 255, 242,
+	188, 244, 204, 143, 161, 255, 207, 196, 251, 245, 50, 246, 183, 179, 108, 242,
+	199, 252, 246, 127, 56, 154, 252, 201, 82, 182, 248, 162, 79, 243, 139, 139,
+	167, 159, 149, 197, 255, 149, 117, 120, 129, 133, 166, 169, 87, 37, 58, 159,
+	116, 170, 185, 154, 87, 244, 255, 145, 255, 242, 255, 159, 136, 159, 127, 255,
+	255, 255, 85, 243, 255, 244, 127, 242, 255, 223, 243, 47, 255, 255, 95, 255,
+	48, 248, 170, 255, 251, 246, 191, 169, 73, 255, 122, 191, 255, 255, 64, 135,
+	135, 169, 134, 184, 121, 120, 136, 127, 135, 184, 201, 202, 100, 55, 135, 88,
+	130, 165, 70, 51, 105, 95, 101, 87, 136, 246, 84, 242, 143, 245, 58, 244,
+	135, 137, 243, 47, 151, 137, 255, 250, 82, 182, 66, 134, 198, 234, 89, 86,
+	109, 55, 53, 151, 171, 235, 101, 246, 103, 194, 127, 116, 127, 255, 243, 63,
+	221, 242, 127, 244, 66, 195, 136, 131, 255, 195, 136, 135, 242, 122, 120, 246,
+	250, 251, 150, 86, 87, 168, 179, 219, 121, 38, 162, 141, 70, 107, 123, 59,
+	66, 163, 255, 245, 143, 241, 255, 255, 149, 111, 69, 168, 250, 248, 83, 241,
+	127, 148, 255, 245, 233, 247, 146, 127, 159, 249, 255, 244, 100, 96, 247, 103,
+	255, 245, 143, 158, 147, 255, 150, 254, 255, 255, 18, 245, 222, 246, 248, 244,
+	255, 247, 134, 255, 212, 255, 255, 255, 99, 153, 148, 79, 184, 251, 58, 68,
+	137, 59, 136, 146, 249, 249, 101, 243, 159, 177, 111, 247, 47, 171, 244, 111,
+	249, 246, 255, 255, 50, 244, 226, 244, 254, 244, 247, 126, 102, 223, 214, 78,
+	111, 253, 82, 243, 251, 115, 127, 242, 108, 252, 101, 191, 170, 197, 244, 250,
+	82, 178, 106, 178, 173, 245, 155, 136, 197, 63, 150, 182, 188, 199, 118, 38,
+	116, 70, 247, 246, 88, 83, 27, 92, 151, 170, 201, 252, 19, 244, 116, 242,
+	246, 246, 255, 255, 253, 79, 255, 255, 127, 255, 125, 243, 95, 244, 223, 242,
+	255, 239, 113, 239, 159, 255, 255, 255, 118, 251, 187, 250, 255, 255, 139, 49,
+	255, 127, 242, 251, 255, 255, 49, 118, 118, 119, 134, 167, 104, 103, 87, 89,
+	101, 119, 152, 202, 83, 58, 101, 156, 148, 163, 70, 53, 138, 61, 53, 152,
+	104, 169, 86, 119, 175, 255, 15, 255, 143, 255, 103, 159, 239, 247, 250, 255,
+	68, 52, 232, 243, 255, 242, 255, 248, 242, 143, 254, 254, 255, 255, 82, 150,
+	37, 186, 182, 219, 122, 68, 123, 46, 164, 204, 90, 204, 33, 252, 255, 221,
+	255, 243, 127, 255, 99, 111, 119, 254, 255, 255, 98, 244, 190, 241, 254, 243,
+	207, 151, 229, 111, 199, 247, 248, 252, 167, 101, 180, 88, 249, 190, 122, 52,
+	97, 155, 119, 76, 204, 219, 52, 243, 159, 243, 159, 245, 159, 159, 245, 249,
+	242, 255, 249, 242, 53, 193, 127, 243, 255, 246, 63, 247, 67, 255, 85, 246,
+	255, 255, 68, 241, 189, 227, 247, 117, 238, 239, 245, 127, 183, 221, 255, 255,
+	97, 156, 150, 141, 182, 203, 135, 102, 84, 63, 103, 152, 250, 221, 100, 246,
+	247, 253, 248, 247, 169, 246, 248, 127, 230, 240, 250, 255, 119, 179, 169, 147,
+	255, 242, 127, 171, 164, 255, 156, 242, 207, 195, 48, 183, 183, 246, 143, 244,
+	183, 251, 183, 191, 127, 184, 249, 249, 86, 149, 255, 242, 143, 242, 95, 255,
+	70, 47, 249, 249, 255, 244, 116, 68, 121, 154, 182, 137, 119, 85, 106, 31,
+	83, 138, 153, 169, 141, 242, 255, 242, 223, 244, 255, 239, 242, 239, 255, 255,
+	255, 255, 66, 184, 191, 249, 255, 249, 73, 159, 31, 175, 249, 250, 255, 255,
+	49, 101, 104, 150, 104, 246, 104, 86, 85, 95, 134, 102, 120, 247, 83, 143,
+	103, 170, 146, 135, 40, 55, 143, 95, 53, 119, 143, 166, 100, 148, 102, 150,
+	255, 102, 36, 114, 86, 127, 83, 132, 255, 249, 136, 245, 244, 244, 63, 246,
+	133, 255, 247, 175, 31, 248, 249, 255, 101, 132, 255, 145, 127, 146, 159, 248,
+	99, 255, 104, 149, 255, 143, 65, 121, 117, 248, 153, 255, 107, 79, 251, 95,
+	114, 135, 191, 155, 86, 246, 143, 8, 255, 245, 239, 255, 244, 111, 88, 248,
+	255, 255, 50, 132, 175, 150, 51, 243, 127, 150, 246, 127, 165, 244, 248, 170,
+	117, 135, 53, 246, 137, 175, 41, 72, 152, 27, 69, 95, 255, 152, 51, 243,
+	143, 245, 79, 243, 143, 120, 84, 79, 120, 242, 245, 255, 117, 180, 42, 115,
+	200, 246, 73, 155, 183, 207, 40, 198, 252, 249, 83, 36, 204, 194, 191, 198,
+	175, 86, 72, 188, 151, 247, 251, 188, 132, 115, 52, 164, 117, 148, 83, 103,
+	104, 76, 52, 215, 215, 185, 99, 239, 102, 127, 254, 103, 118, 103, 110, 111,
+	23, 114, 253, 247, 82, 199, 58, 246, 182, 247, 79, 172, 24, 191, 68, 250,
+	255, 250, 115, 148, 115, 146, 166, 163, 86, 71, 119, 63, 117, 165, 204, 202,
+	83, 148, 250, 241, 92, 244, 121, 207, 138, 155, 55, 247, 252, 249, 81, 181,
+	152, 131, 58, 245, 143, 187, 53, 175, 134, 246, 255, 202, 49, 253, 253, 245,
+	127, 242, 255, 255, 167, 255, 79, 111, 127, 255, 33, 120, 134, 103, 117, 143,
+	150, 87, 118, 87, 101, 248, 247, 255, 134, 139, 90, 191, 186, 180, 8, 106,
+	201, 79, 103, 186, 172, 252, 82, 250, 70, 251, 172, 201, 92, 57, 191, 28,
+	150, 255, 143, 250, 118, 163, 51, 180, 152, 185, 89, 59, 163, 63, 100, 175,
+	255, 171, 99, 127, 99, 239, 150, 131, 50, 89, 159, 63, 118, 247, 255, 248,
+	65, 117, 87, 87, 134, 134, 95, 115, 102, 95, 102, 246, 88, 248, 100, 121,
+	121, 251, 121, 148, 87, 55, 107, 31, 99, 137, 185, 164, 148, 101, 47, 243,
+	166, 151, 95, 104, 250, 47, 130, 127, 153, 249, 250, 244, 255, 241, 255, 241,
+	255, 255, 245, 255, 255, 255, 255, 250, 151, 248, 87, 250, 250, 187, 56, 58,
+	175, 127, 21, 255, 207, 249, 231, 243, 223, 243, 255, 241, 207, 255, 251, 255,
+	222, 253, 255, 243, 64, 250, 255, 243, 246, 248, 79, 255, 170, 255, 175, 170,
+	250, 250, 115, 255, 250, 159, 249, 168, 102, 104, 168, 10, 143, 244, 248, 249,
+	151, 245, 250, 247, 255, 240, 255, 250, 243, 255, 175, 255, 159, 250, 33, 247,
+	254, 244, 111, 251, 247, 255, 215, 255, 188, 253, 255, 253, 33, 166, 103, 118,
+	153, 248, 122, 150, 119, 95, 118, 137, 247, 175, 134, 87, 50, 255, 248, 246,
+	103, 82, 255, 88, 56, 143, 255, 255, 135, 245, 255, 241, 95, 254, 29, 255,
+	244, 239, 207, 254, 255, 255, 85, 255, 33, 255, 249, 255, 143, 151, 255, 127,
+	148, 255, 249, 255, 150, 150, 102, 249, 255, 249, 95, 83, 174, 175, 33, 255,
+	255, 175, 102, 244, 159, 241, 255, 244, 95, 251, 244, 47, 250, 255, 255, 255,
+	66, 248, 248, 241, 239, 249, 127, 250, 168, 63, 248, 249, 250, 248, 64, 136,
+	152, 121, 152, 247, 122, 55, 119, 138, 118, 122, 137, 175, 82, 87, 117, 153,
+	69, 153, 69, 36, 103, 72, 86, 134, 133, 135, 132, 244, 56, 248, 119, 246,
+	86, 69, 134, 70, 35, 104, 232, 135, 83, 254, 87, 239, 119, 255, 118, 22,
+	141, 111, 120, 127, 248, 120, 231, 245, 79, 240, 127, 244, 79, 255, 244, 255,
+	222, 109, 255, 253, 101, 6, 187, 185, 251, 249, 91, 183, 166, 175, 120, 143,
+	255, 255, 118, 241, 147, 245, 247, 255, 255, 249, 244, 159, 39, 249, 143, 249,
+	101, 137, 170, 255, 248, 170, 119, 87, 175, 105, 119, 240, 255, 249, 154, 247,
+	249, 240, 111, 248, 255, 255, 248, 143, 63, 250, 255, 255, 85, 243, 125, 245,
+	244, 240, 255, 221, 247, 223, 197, 253, 255, 253, 50, 246, 249, 244, 138, 245,
+	137, 255, 138, 143, 31, 95, 255, 247, 252, 243, 255, 240, 79, 152, 255, 255,
+	247, 159, 248, 249, 255, 248, 82, 117, 228, 246, 68, 247, 84, 69, 79, 71,
+	70, 247, 246, 247, 33, 101, 103, 255, 247, 255, 118, 95, 127, 79, 237, 117,
+	119, 247, 99, 87, 134, 255, 102, 136, 85, 52, 40, 71, 39, 119, 135, 119,
+	65, 169, 38, 249, 185, 255, 136, 104, 247, 63, 165, 251, 255, 255, 83, 100,
+	104, 230, 132, 248, 72, 37, 44, 95, 200, 255, 255, 95, 83, 230, 221, 207,
+	254, 255, 79, 20, 198, 84, 86, 116, 247, 245,
+};
+
+static const UTF16 kLettersRu [32] =
+{
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B,
+	0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+	0x0448, 0x0449, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x0451,
+};
+
+static const uint16_t kContextsRu [1156] =
+{
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 0, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 11, 44, 45,
+	46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 27, 28, 29,
+	59, 60, 61, 33, 0, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72,
+	73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88,
+	28, 29, 59, 89, 90, 91, 0, 92, 93, 94, 95, 96, 97, 98, 41, 99,
+	100, 11, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 56, 57,
+	58, 113, 114, 29, 59, 60, 61, 33, 0, 115, 116, 94, 117, 96, 118, 119,
+	41, 99, 120, 11, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 111, 131,
+	56, 57, 58, 27, 132, 29, 59, 60, 133, 33, 0, 134, 135, 94, 95, 96,
+	136, 137, 41, 99, 138, 11, 139, 140, 141, 142, 143, 106, 144, 145, 109, 146,
+	111, 55, 56, 57, 58, 27, 28, 29, 59, 60, 61, 33, 0, 147, 148, 94,
+	149, 96, 150, 151, 152, 99, 153, 11, 154, 155, 156, 157, 158, 159, 160, 161,
+	109, 162, 111, 55, 56, 57, 163, 27, 164, 29, 59, 60, 61, 165, 0, 166,
+	167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+	183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 28, 29, 59, 60, 61, 33,
+	0, 193, 194, 94, 95, 96, 195, 196, 41, 99, 197, 11, 198, 199, 103, 200,
+	77, 106, 201, 145, 109, 202, 111, 55, 56, 57, 58, 27, 28, 29, 59, 60,
+	61, 33, 0, 203, 204, 205, 206, 96, 207, 208, 41, 99, 209, 11, 210, 199,
+	211, 212, 213, 106, 214, 145, 109, 215, 111, 55, 56, 57, 58, 27, 216, 29,
+	59, 60, 217, 33, 0, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+	229, 230, 231, 232, 233, 234, 235, 236, 237, 202, 238, 239, 240, 241, 242, 27,
+	28, 29, 59, 243, 244, 33, 0, 245, 63, 94, 95, 96, 246, 247, 41, 99,
+	248, 11, 249, 250, 103, 251, 252, 106, 201, 253, 254, 202, 111, 55, 56, 57,
+	58, 27, 28, 29, 59, 60, 61, 33, 0, 255, 256, 94, 257, 96, 97, 258,
+	41, 99, 259, 11, 139, 260, 103, 261, 262, 106, 263, 264, 265, 266, 111, 55,
+	267, 57, 58, 27, 28, 29, 59, 60, 61, 33, 0, 268, 269, 94, 95, 96,
+	97, 270, 271, 99, 272, 11, 273, 274, 103, 275, 276, 106, 201, 277, 109, 278,
+	111, 55, 56, 279, 58, 27, 280, 281, 59, 282, 283, 284, 0, 285, 286, 287,
+	288, 96, 97, 289, 41, 99, 290, 11, 139, 199, 291, 292, 293, 294, 201, 295,
+	109, 296, 111, 55, 56, 57, 58, 27, 297, 29, 59, 60, 298, 33, 0, 299,
+	300, 94, 95, 301, 302, 303, 41, 99, 304, 11, 305, 199, 103, 306, 307, 106,
+	201, 308, 309, 310, 311, 55, 312, 313, 58, 27, 314, 315, 59, 60, 316, 317,
+	0, 318, 63, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331,
+	332, 333, 334, 335, 336, 202, 111, 337, 338, 339, 340, 341, 28, 29, 59, 60,
+	342, 33, 0, 193, 343, 94, 95, 96, 97, 344, 41, 99, 345, 11, 139, 346,
+	103, 347, 348, 349, 350, 351, 352, 353, 111, 55, 56, 57, 58, 27, 354, 29,
+	59, 60, 355, 33, 0, 356, 357, 94, 358, 359, 360, 361, 362, 99, 363, 11,
+	364, 199, 365, 366, 367, 106, 368, 369, 370, 371, 111, 372, 56, 57, 373, 27,
+	374, 29, 59, 60, 375, 33, 0, 376, 377, 378, 379, 96, 380, 381, 382, 99,
+	383, 11, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 111, 394, 56, 395,
+	396, 27, 397, 398, 59, 60, 399, 33, 0, 400, 401, 94, 402, 96, 97, 403,
+	41, 99, 404, 11, 405, 406, 407, 408, 409, 410, 411, 412, 109, 413, 111, 55,
+	56, 414, 58, 27, 415, 416, 59, 60, 61, 33, 0, 417, 418, 419, 95, 420,
+	421, 422, 423, 424, 248, 425, 426, 427, 428, 429, 77, 430, 431, 432, 433, 202,
+	434, 55, 56, 435, 436, 437, 28, 29, 59, 438, 61, 33, 0, 193, 439, 94,
+	95, 96, 97, 440, 41, 99, 441, 11, 139, 442, 103, 261, 443, 106, 444, 145,
+	109, 445, 446, 55, 56, 57, 58, 27, 28, 29, 59, 60, 61, 33, 0, 447,
+	448, 94, 95, 96, 97, 449, 41, 99, 450, 11, 139, 199, 103, 261, 451, 106,
+	452, 145, 109, 202, 111, 55, 56, 57, 58, 27, 28, 29, 59, 60, 61, 33,
+	0, 193, 453, 94, 95, 96, 97, 454, 41, 99, 455, 11, 456, 199, 103, 261,
+	77, 106, 201, 145, 109, 202, 111, 55, 56, 57, 58, 27, 457, 29, 59, 60,
+	61, 33, 0, 193, 458, 94, 95, 96, 97, 459, 41, 99, 460, 11, 461, 199,
+	103, 462, 77, 106, 201, 145, 463, 202, 111, 55, 56, 57, 58, 27, 28, 29,
+	59, 60, 61, 464, 0, 193, 465, 94, 95, 96, 97, 466, 41, 99, 467, 11,
+	468, 199, 103, 469, 470, 106, 201, 145, 109, 202, 111, 55, 56, 57, 58, 27,
+	28, 29, 59, 60, 61, 33, 0, 193, 471, 94, 95, 96, 97, 472, 41, 99,
+	473, 11, 139, 199, 103, 261, 77, 106, 201, 145, 109, 202, 111, 55, 56, 57,
+	58, 27, 28, 29, 59, 60, 61, 474, 0, 475, 63, 476, 477, 96, 478, 479,
+	41, 480, 248, 481, 482, 483, 484, 261, 77, 485, 486, 145, 487, 202, 111, 488,
+	56, 489, 490, 27, 28, 29, 59, 60, 61, 33, 0, 491, 63, 94, 95, 96,
+	97, 247, 41, 492, 248, 11, 493, 199, 103, 494, 77, 106, 201, 495, 496, 202,
+	111, 55, 56, 57, 497, 27, 28, 29, 59, 498, 499, 33, 0, 193, 63, 94,
+	95, 96, 97, 247, 41, 99, 248, 11, 500, 501, 103, 261, 77, 106, 201, 145,
+	502, 202, 111, 55, 56, 57, 58, 27, 28, 29, 59, 60, 61, 33, 0, 503,
+	63, 94, 95, 96, 97, 247, 41, 99, 248, 11, 139, 199, 103, 261, 77, 106,
+	201, 145, 504, 202, 111, 55, 56, 505, 58, 506, 28, 29, 59, 60, 61, 33,
+	0, 507, 63, 94, 508, 96, 509, 510, 41, 511, 248, 11, 139, 199, 512, 513,
+	77, 106, 514, 145, 515, 202, 111, 55, 56, 57, 58, 516, 28, 29, 59, 517,
+	518, 33, 0, 193, 63, 94, 95, 96, 97, 247, 41, 99, 248, 11, 139, 199,
+	103, 519, 77, 106, 201, 145, 520, 202, 111, 55, 56, 57, 58, 27, 28, 29,
+	59, 60, 61, 33,
+};
+
+static const uint8_t kCostsRu [8857] =
+{
+	47, 102, 116, 132, 90, 212, 116, 70, 52, 69, 86, 149, 120, 248, 255, 183,
+	232, 17, 137, 168, 184, 158, 248, 168, 121, 104, 121, 153, 168, 172, 250, 255,
+	235, 253, 244, 95, 116, 243, 143, 127, 70, 71, 107, 82, 68, 167, 159, 252,
+	255, 255, 251, 201, 242, 255, 63, 255, 244, 63, 255, 243, 246, 63, 159, 255,
+	255, 194, 250, 255, 178, 245, 230, 61, 159, 246, 118, 70, 180, 69, 183, 95,
+	255, 255, 146, 255, 255, 255, 132, 245, 38, 255, 244, 79, 143, 243, 241, 95,
+	255, 255, 255, 255, 248, 153, 173, 195, 245, 77, 183, 243, 31, 125, 210, 245,
+	143, 207, 255, 255, 185, 251, 207, 173, 255, 53, 101, 250, 175, 120, 218, 255,
+	25, 254, 255, 255, 79, 255, 255, 95, 247, 245, 255, 20, 255, 245, 255, 191,
+	255, 255, 47, 255, 255, 255, 255, 255, 79, 251, 240, 250, 135, 255, 249, 175,
+	47, 249, 252, 159, 255, 255, 255, 255, 255, 255, 147, 191, 89, 149, 63, 255,
+	58, 51, 250, 40, 248, 111, 255, 175, 255, 175, 255, 81, 187, 186, 134, 191,
+	250, 39, 120, 183, 73, 196, 219, 138, 250, 251, 191, 250, 181, 178, 200, 124,
+	255, 246, 63, 159, 177, 212, 107, 155, 255, 255, 187, 167, 255, 159, 243, 255,
+	63, 255, 242, 255, 255, 242, 255, 79, 159, 255, 255, 143, 79, 152, 159, 146,
+	187, 47, 255, 244, 121, 79, 242, 187, 95, 255, 250, 255, 152, 248, 169, 168,
+	243, 207, 10, 191, 246, 253, 207, 244, 255, 111, 255, 255, 255, 159, 207, 207,
+	181, 47, 121, 244, 132, 204, 150, 106, 63, 72, 242, 186, 122, 243, 255, 255,
+	255, 239, 195, 254, 63, 223, 248, 110, 255, 225, 130, 94, 255, 223, 255, 202,
+	223, 251, 255, 241, 255, 31, 175, 247, 255, 255, 246, 255, 111, 255, 255, 255,
+	250, 251, 246, 163, 102, 134, 71, 247, 243, 70, 133, 66, 86, 83, 122, 120,
+	250, 188, 191, 255, 143, 146, 249, 63, 255, 243, 159, 255, 242, 147, 111, 159,
+	255, 207, 249, 153, 255, 245, 121, 134, 241, 117, 169, 147, 116, 73, 54, 248,
+	207, 108, 255, 255, 248, 252, 170, 241, 255, 127, 255, 245, 92, 255, 243, 245,
+	79, 255, 255, 255, 207, 252, 255, 155, 243, 244, 47, 255, 244, 255, 246, 242,
+	243, 95, 255, 255, 255, 152, 245, 248, 255, 248, 117, 31, 255, 242, 255, 255,
+	63, 255, 143, 255, 255, 255, 247, 143, 255, 191, 243, 255, 63, 248, 242, 111,
+	255, 248, 248, 97, 175, 255, 255, 143, 255, 111, 255, 241, 244, 63, 255, 242,
+	119, 239, 149, 244, 101, 255, 255, 255, 248, 255, 248, 154, 244, 255, 31, 255,
+	242, 255, 175, 255, 255, 111, 255, 255, 255, 95, 255, 95, 66, 111, 164, 55,
+	121, 47, 85, 148, 95, 133, 244, 63, 109, 247, 255, 253, 252, 81, 159, 170,
+	138, 63, 251, 245, 56, 185, 94, 246, 251, 184, 214, 255, 111, 183, 255, 159,
+	152, 250, 175, 138, 35, 102, 127, 86, 241, 150, 255, 249, 255, 255, 255, 202,
+	231, 255, 255, 241, 255, 246, 37, 95, 245, 245, 255, 175, 175, 255, 255, 255,
+	251, 137, 145, 244, 26, 255, 247, 102, 104, 167, 122, 255, 255, 127, 255, 255,
+	255, 116, 238, 152, 233, 136, 158, 104, 21, 238, 100, 226, 126, 238, 238, 238,
+	238, 238, 2, 140, 203, 222, 207, 203, 235, 203, 172, 172, 205, 234, 207, 255,
+	253, 239, 255, 71, 111, 133, 115, 127, 95, 70, 87, 71, 98, 69, 85, 231,
+	255, 255, 255, 254, 255, 242, 255, 63, 255, 241, 109, 255, 246, 245, 95, 255,
+	255, 255, 134, 255, 255, 132, 244, 244, 63, 127, 245, 100, 103, 243, 69, 255,
+	111, 255, 255, 242, 127, 255, 124, 243, 79, 78, 255, 246, 79, 206, 242, 242,
+	79, 255, 255, 255, 255, 246, 255, 72, 243, 243, 39, 244, 245, 63, 95, 243,
+	246, 95, 255, 255, 255, 111, 127, 255, 119, 255, 136, 243, 255, 127, 224, 222,
+	255, 89, 253, 255, 255, 255, 255, 255, 255, 152, 132, 204, 35, 255, 242, 198,
+	41, 167, 140, 111, 255, 255, 251, 175, 251, 143, 253, 240, 253, 140, 255, 254,
+	255, 60, 248, 255, 223, 255, 255, 255, 253, 255, 255, 85, 127, 70, 214, 79,
+	142, 62, 50, 143, 38, 247, 136, 248, 255, 255, 255, 253, 86, 242, 255, 87,
+	255, 244, 63, 103, 242, 228, 94, 111, 255, 248, 255, 245, 255, 252, 241, 255,
+	63, 254, 242, 254, 223, 242, 255, 79, 255, 255, 255, 110, 111, 251, 131, 241,
+	253, 63, 255, 243, 143, 117, 115, 255, 87, 255, 255, 255, 141, 248, 253, 84,
+	242, 255, 30, 143, 245, 255, 104, 243, 143, 118, 255, 255, 255, 119, 255, 255,
+	124, 40, 101, 230, 228, 239, 196, 103, 79, 53, 242, 246, 127, 244, 255, 255,
+	255, 175, 242, 255, 79, 255, 247, 111, 248, 241, 131, 95, 154, 255, 255, 143,
+	255, 255, 118, 241, 127, 47, 254, 244, 255, 238, 244, 239, 94, 255, 255, 255,
+	247, 111, 245, 100, 101, 248, 72, 245, 243, 71, 148, 68, 88, 66, 127, 103,
+	244, 255, 249, 254, 108, 243, 253, 63, 255, 242, 254, 223, 241, 116, 95, 255,
+	255, 255, 183, 255, 255, 231, 229, 85, 195, 103, 229, 84, 84, 127, 21, 245,
+	255, 223, 223, 255, 100, 255, 246, 240, 255, 127, 255, 118, 127, 143, 243, 245,
+	63, 255, 255, 255, 255, 255, 255, 81, 149, 246, 92, 255, 243, 159, 104, 194,
+	116, 121, 159, 255, 251, 187, 248, 251, 117, 196, 168, 43, 191, 241, 181, 255,
+	103, 159, 107, 175, 250, 255, 245, 191, 255, 117, 242, 252, 44, 250, 242, 133,
+	59, 248, 155, 116, 191, 191, 249, 143, 255, 95, 102, 195, 247, 63, 255, 241,
+	100, 73, 197, 103, 118, 255, 191, 255, 155, 255, 106, 135, 158, 119, 232, 158,
+	122, 35, 86, 126, 85, 145, 150, 234, 229, 238, 238, 238, 66, 107, 191, 248,
+	150, 187, 168, 121, 171, 134, 243, 251, 43, 47, 255, 139, 255, 65, 173, 166,
+	86, 91, 175, 154, 86, 172, 151, 181, 141, 184, 142, 255, 107, 247, 80, 137,
+	134, 247, 143, 168, 119, 151, 105, 120, 138, 248, 187, 250, 255, 248, 249, 83,
+	106, 101, 85, 71, 73, 69, 53, 91, 84, 131, 121, 102, 152, 255, 126, 149,
+	249, 116, 169, 111, 159, 245, 47, 159, 145, 71, 95, 143, 255, 251, 246, 255,
+	255, 199, 243, 175, 59, 255, 242, 37, 63, 166, 104, 148, 255, 255, 151, 118,
+	251, 248, 148, 243, 248, 87, 255, 244, 79, 102, 242, 98, 106, 175, 255, 255,
+	255, 255, 255, 117, 177, 185, 56, 246, 246, 101, 102, 164, 98, 138, 159, 150,
+	246, 247, 255, 143, 134, 255, 249, 255, 255, 255, 250, 242, 255, 175, 240, 255,
+	175, 255, 255, 255, 255, 111, 244, 255, 18, 255, 244, 159, 102, 255, 127, 255,
+	255, 255, 255, 255, 255, 111, 118, 98, 197, 114, 202, 247, 119, 67, 243, 132,
+	95, 255, 248, 255, 244, 255, 255, 227, 79, 226, 198, 223, 205, 54, 35, 127,
+	182, 243, 254, 239, 255, 255, 239, 245, 164, 154, 184, 180, 159, 250, 24, 103,
+	181, 104, 243, 250, 191, 251, 255, 191, 249, 82, 245, 185, 42, 245, 245, 120,
+	153, 243, 52, 116, 155, 246, 249, 255, 171, 250, 133, 132, 107, 74, 249, 243,
+	105, 169, 145, 127, 104, 184, 255, 255, 40, 191, 101, 116, 101, 203, 26, 255,
+	242, 171, 163, 102, 111, 143, 171, 186, 255, 248, 207, 244, 100, 180, 108, 99,
+	139, 242, 248, 43, 243, 92, 149, 191, 135, 250, 118, 207, 167, 115, 75, 83,
+	84, 85, 87, 53, 84, 87, 68, 164, 138, 104, 166, 255, 220, 248, 191, 242,
+	255, 95, 255, 242, 104, 191, 85, 131, 57, 255, 255, 255, 159, 159, 244, 118,
+	130, 57, 86, 191, 244, 134, 87, 164, 88, 68, 57, 191, 247, 134, 255, 250,
+	116, 246, 249, 143, 250, 246, 148, 74, 53, 63, 130, 175, 143, 243, 86, 255,
+	251, 132, 243, 251, 63, 255, 244, 168, 108, 212, 118, 106, 169, 127, 255, 21,
+	255, 223, 244, 135, 127, 210, 79, 103, 85, 94, 239, 85, 241, 255, 136, 255,
+	255, 231, 255, 116, 243, 79, 79, 255, 241, 223, 255, 244, 99, 118, 245, 255,
+	255, 79, 255, 255, 49, 132, 247, 137, 255, 245, 127, 119, 243, 69, 137, 255,
+	255, 248, 255, 255, 255, 249, 249, 159, 159, 255, 240, 246, 255, 249, 159, 249,
+	255, 255, 255, 250, 255, 255, 120, 243, 250, 31, 255, 243, 246, 91, 248, 143,
+	143, 175, 255, 255, 255, 255, 255, 118, 244, 255, 47, 255, 241, 150, 54, 246,
+	95, 102, 255, 255, 255, 255, 255, 111, 255, 241, 255, 47, 255, 242, 255, 255,
+	255, 255, 255, 255, 255, 255, 239, 255, 95, 117, 255, 255, 255, 255, 255, 255,
+	255, 255, 143, 241, 255, 207, 31, 255, 255, 255, 64, 255, 175, 251, 255, 255,
+	137, 170, 255, 143, 251, 159, 255, 255, 255, 255, 255, 252, 255, 255, 255, 255,
+	255, 239, 157, 255, 237, 240, 255, 255, 255, 255, 255, 255, 102, 119, 255, 15,
+	255, 255, 255, 249, 159, 127, 255, 255, 255, 248, 255, 255, 116, 117, 143, 114,
+	150, 58, 41, 72, 70, 255, 101, 149, 122, 122, 248, 255, 255, 248, 86, 163,
+	202, 78, 189, 244, 51, 91, 195, 99, 75, 111, 185, 94, 179, 219, 199, 99,
+	242, 199, 57, 191, 244, 69, 87, 131, 102, 86, 127, 255, 153, 147, 238, 168,
+	100, 180, 120, 70, 255, 243, 90, 71, 178, 131, 74, 172, 220, 255, 251, 187,
+	188, 117, 194, 182, 37, 183, 244, 55, 88, 99, 101, 74, 157, 154, 248, 166,
+	188, 137, 133, 175, 138, 246, 23, 127, 54, 72, 255, 67, 246, 255, 247, 249,
+	255, 255, 255, 116, 114, 180, 100, 171, 245, 135, 67, 211, 134, 79, 255, 186,
+	255, 213, 223, 246, 151, 55, 103, 105, 159, 122, 103, 57, 247, 100, 241, 127,
+	136, 249, 255, 255, 245, 255, 240, 255, 95, 255, 244, 255, 255, 245, 255, 111,
+	255, 255, 255, 255, 255, 255, 143, 243, 255, 63, 255, 241, 255, 255, 242, 175,
+	255, 255, 255, 255, 159, 120, 167, 99, 115, 196, 44, 255, 244, 154, 101, 99,
+	141, 109, 222, 236, 252, 196, 219, 149, 255, 242, 255, 127, 255, 249, 255, 239,
+	241, 255, 127, 255, 255, 255, 244, 255, 255, 117, 170, 118, 133, 121, 57, 37,
+	134, 159, 115, 242, 255, 63, 251, 255, 255, 250, 150, 211, 253, 63, 239, 244,
+	123, 141, 114, 130, 72, 207, 216, 252, 167, 190, 248, 255, 240, 251, 79, 250,
+	245, 255, 159, 244, 255, 143, 255, 175, 255, 152, 171, 248, 253, 254, 255, 223,
+	255, 252, 81, 255, 193, 239, 227, 255, 127, 255, 223, 255, 252, 115, 163, 229,
+	58, 175, 243, 133, 89, 147, 67, 106, 188, 143, 255, 54, 205, 202, 136, 248,
+	121, 34, 153, 89, 68, 137, 255, 148, 243, 164, 159, 249, 255, 88, 255, 151,
+	241, 175, 95, 255, 179, 93, 185, 211, 164, 88, 198, 255, 255, 155, 253, 253,
+	218, 244, 255, 239, 255, 252, 255, 255, 240, 253, 255, 255, 255, 255, 255, 255,
+	255, 255, 244, 255, 31, 255, 242, 255, 255, 255, 255, 143, 255, 255, 255, 255,
+	255, 255, 130, 255, 248, 127, 255, 127, 58, 247, 255, 90, 241, 175, 63, 255,
+	255, 255, 255, 80, 137, 121, 255, 159, 247, 248, 143, 105, 111, 159, 249, 255,
+	255, 255, 255, 249, 100, 207, 251, 56, 200, 137, 105, 39, 253, 134, 242, 159,
+	153, 246, 255, 95, 245, 124, 252, 255, 31, 255, 253, 238, 239, 241, 255, 239,
+	255, 255, 255, 252, 255, 255, 252, 245, 254, 173, 254, 246, 190, 207, 224, 237,
+	207, 255, 255, 255, 254, 255, 255, 149, 156, 159, 133, 168, 111, 86, 75, 250,
+	49, 243, 175, 153, 191, 255, 251, 255, 134, 150, 86, 68, 135, 118, 41, 88,
+	175, 69, 242, 250, 105, 244, 255, 191, 244, 255, 242, 255, 79, 255, 242, 47,
+	255, 245, 255, 63, 255, 255, 255, 255, 255, 255, 255, 245, 255, 31, 255, 244,
+	255, 255, 246, 255, 255, 255, 255, 255, 239, 255, 114, 124, 252, 254, 15, 255,
+	253, 255, 254, 252, 255, 255, 255, 255, 255, 254, 255, 254, 248, 245, 255, 47,
+	255, 243, 255, 255, 242, 255, 47, 255, 255, 255, 243, 255, 183, 116, 127, 86,
+	83, 41, 70, 37, 134, 139, 86, 185, 255, 143, 252, 255, 175, 191, 255, 240,
+	255, 95, 255, 246, 127, 255, 250, 247, 223, 255, 255, 255, 255, 255, 255, 248,
+	243, 255, 15, 255, 246, 255, 255, 245, 255, 95, 255, 255, 255, 255, 255, 255,
+	250, 250, 255, 31, 255, 254, 131, 255, 94, 255, 242, 255, 255, 255, 255, 127,
+	89, 249, 253, 254, 223, 255, 253, 255, 239, 240, 233, 255, 255, 255, 255, 207,
+	255, 249, 133, 248, 255, 30, 159, 255, 136, 168, 255, 111, 248, 95, 255, 246,
+	255, 47, 255, 234, 254, 255, 239, 255, 252, 255, 255, 240, 254, 255, 255, 255,
+	255, 255, 255, 255, 148, 79, 162, 85, 79, 79, 245, 246, 63, 131, 250, 63,
+	111, 245, 255, 255, 249, 201, 255, 254, 222, 15, 255, 255, 55, 255, 255, 246,
+	255, 255, 255, 255, 239, 255, 48, 246, 111, 255, 255, 246, 245, 245, 102, 111,
+	255, 246, 255, 247, 255, 255, 255, 66, 111, 165, 71, 111, 86, 63, 53, 136,
+	100, 116, 104, 151, 249, 255, 120, 246, 244, 241, 254, 62, 246, 244, 207, 223,
+	231, 125, 223, 255, 255, 255, 255, 255, 255, 83, 143, 248, 249, 143, 127, 111,
+	21, 245, 130, 248, 143, 159, 255, 255, 248, 248, 84, 111, 152, 95, 127, 103,
+	120, 85, 104, 23, 247, 111, 95, 255, 255, 175, 246, 116, 194, 216, 92, 201,
+	243, 74, 155, 194, 85, 84, 173, 229, 250, 205, 201, 254, 254, 242, 255, 95,
+	255, 242, 255, 255, 242, 255, 47, 255, 255, 255, 134, 239, 248, 123, 246, 252,
+	15, 255, 252, 255, 237, 219, 255, 223, 255, 255, 255, 252, 255, 253, 255, 242,
+	255, 127, 255, 248, 255, 239, 241, 255, 95, 255, 255, 255, 253, 255, 255, 80,
+	153, 133, 134, 207, 111, 57, 102, 175, 101, 246, 204, 255, 255, 255, 255, 249,
+	127, 241, 255, 79, 250, 246, 255, 255, 246, 175, 31, 255, 255, 255, 248, 159,
+	250, 132, 117, 167, 88, 249, 244, 67, 118, 68, 87, 82, 139, 137, 248, 86,
+	207, 180, 115, 164, 255, 231, 143, 248, 62, 113, 255, 116, 243, 255, 255, 248,
+	255, 120, 255, 65, 101, 117, 247, 255, 245, 116, 87, 101, 117, 111, 127, 247,
+	255, 248, 245, 255, 83, 159, 150, 74, 247, 159, 38, 39, 175, 165, 163, 159,
+	107, 251, 255, 111, 105, 156, 243, 255, 79, 255, 242, 239, 239, 241, 255, 63,
+	255, 255, 255, 253, 255, 255, 127, 253, 255, 15, 255, 248, 239, 255, 247, 255,
+	255, 143, 143, 255, 255, 255, 255, 117, 154, 249, 252, 205, 77, 36, 39, 247,
+	98, 245, 248, 218, 249, 255, 255, 202, 100, 114, 119, 60, 255, 242, 255, 199,
+	99, 103, 95, 255, 255, 246, 255, 255, 255, 117, 163, 152, 248, 143, 122, 134,
+	35, 245, 83, 146, 247, 185, 249, 255, 175, 246, 253, 243, 255, 63, 255, 243,
+	47, 255, 242, 238, 78, 255, 255, 255, 255, 255, 255, 191, 248, 255, 111, 255,
+	243, 255, 255, 248, 191, 255, 255, 255, 255, 159, 255, 240, 235, 251, 252, 95,
+	255, 242, 255, 237, 209, 255, 79, 255, 255, 255, 252, 255, 253, 175, 244, 255,
+	63, 255, 244, 255, 255, 241, 255, 111, 255, 255, 255, 242, 143, 245, 132, 75,
+	100, 154, 169, 105, 36, 84, 39, 54, 249, 249, 95, 255, 255, 255, 255, 249,
+	247, 255, 223, 255, 241, 255, 255, 242, 244, 111, 255, 255, 255, 255, 255, 255,
+	246, 244, 255, 31, 249, 246, 255, 255, 243, 255, 47, 255, 255, 255, 255, 159,
+	249, 136, 255, 247, 255, 255, 246, 225, 255, 233, 255, 129, 255, 127, 255, 255,
+	255, 254, 83, 104, 159, 73, 159, 175, 57, 88, 41, 133, 244, 249, 255, 79,
+	255, 58, 255, 222, 244, 255, 31, 255, 241, 219, 207, 253, 239, 110, 255, 255,
+	255, 255, 255, 239, 33, 255, 118, 99, 255, 95, 239, 245, 255, 246, 254, 223,
+	255, 255, 255, 255, 255, 108, 255, 255, 255, 244, 255, 239, 13, 255, 237, 243,
+	255, 255, 255, 255, 255, 255, 80, 135, 154, 247, 154, 248, 120, 136, 137, 122,
+	168, 248, 255, 255, 255, 255, 250, 230, 239, 253, 213, 207, 199, 19, 45, 87,
+	102, 123, 255, 238, 255, 255, 255, 253, 103, 246, 255, 63, 255, 246, 93, 143,
+	244, 246, 31, 255, 255, 255, 253, 255, 245, 150, 244, 175, 37, 255, 246, 175,
+	127, 241, 102, 143, 255, 255, 246, 132, 255, 255, 133, 246, 249, 118, 255, 241,
+	249, 244, 241, 247, 95, 175, 191, 255, 255, 255, 255, 149, 196, 247, 47, 183,
+	243, 120, 76, 82, 74, 47, 250, 255, 246, 150, 255, 143, 81, 255, 137, 255,
+	255, 255, 239, 152, 255, 93, 242, 255, 255, 255, 255, 255, 255, 249, 165, 255,
+	97, 255, 241, 255, 127, 175, 111, 111, 255, 255, 255, 159, 255, 143, 129, 242,
+	136, 55, 111, 245, 138, 88, 243, 105, 79, 255, 255, 255, 248, 159, 255, 134,
+	255, 159, 232, 15, 255, 255, 99, 255, 88, 249, 255, 255, 255, 255, 255, 254,
+	65, 255, 255, 87, 175, 255, 119, 87, 175, 40, 245, 175, 86, 247, 255, 255,
+	255, 117, 245, 255, 143, 255, 246, 108, 159, 242, 37, 65, 255, 247, 255, 255,
+	255, 255, 100, 243, 154, 63, 255, 243, 120, 255, 244, 207, 143, 250, 255, 255,
+	38, 143, 83, 83, 84, 191, 27, 255, 248, 159, 95, 132, 143, 95, 255, 255,
+	250, 243, 255, 244, 116, 180, 143, 71, 159, 241, 187, 63, 244, 127, 131, 235,
+	202, 251, 102, 191, 135, 117, 31, 94, 246, 242, 255, 105, 111, 63, 175, 244,
+	248, 175, 255, 255, 255, 255, 255, 245, 255, 79, 255, 247, 159, 175, 97, 146,
+	127, 175, 255, 255, 175, 255, 249, 100, 115, 148, 41, 243, 244, 134, 55, 118,
+	73, 133, 120, 202, 245, 135, 255, 183, 117, 149, 248, 127, 252, 249, 51, 136,
+	69, 79, 81, 175, 252, 255, 108, 255, 246, 82, 245, 246, 111, 255, 246, 164,
+	111, 245, 35, 153, 255, 159, 255, 118, 191, 253, 235, 239, 239, 193, 237, 239,
+	116, 213, 95, 39, 244, 255, 223, 223, 255, 207, 255, 245, 245, 255, 79, 255,
+	241, 111, 255, 243, 117, 214, 246, 255, 255, 255, 255, 255, 65, 244, 243, 127,
+	255, 245, 111, 111, 242, 125, 255, 95, 255, 255, 255, 255, 255, 66, 248, 255,
+	127, 255, 241, 130, 255, 143, 159, 143, 255, 248, 255, 255, 255, 255, 249, 241,
+	255, 47, 255, 243, 248, 79, 255, 175, 126, 255, 159, 255, 95, 255, 95, 68,
+	244, 255, 47, 255, 242, 247, 47, 248, 79, 248, 255, 143, 255, 255, 255, 95,
+	120, 244, 255, 15, 255, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	79, 18, 137, 169, 137, 158, 201, 169, 153, 121, 138, 169, 185, 189, 251, 252,
+	235, 236, 133, 111, 247, 63, 239, 111, 63, 70, 255, 101, 129, 255, 255, 79,
+	255, 95, 248, 255, 244, 255, 31, 255, 248, 239, 255, 243, 255, 63, 255, 255,
+	255, 245, 255, 57, 83, 159, 170, 191, 255, 127, 122, 25, 255, 102, 243, 255,
+	250, 250, 255, 255, 255, 247, 143, 242, 130, 186, 191, 167, 114, 175, 167, 242,
+	159, 248, 255, 255, 255, 249, 252, 242, 255, 127, 255, 241, 207, 255, 244, 221,
+	60, 255, 253, 255, 255, 255, 255, 116, 163, 156, 59, 246, 243, 135, 90, 195,
+	143, 106, 219, 127, 255, 54, 93, 115, 255, 244, 255, 111, 255, 247, 255, 255,
+	240, 255, 191, 255, 255, 255, 243, 175, 248, 117, 146, 102, 40, 181, 244, 151,
+	86, 147, 103, 70, 106, 203, 199, 149, 221, 183, 100, 103, 104, 67, 101, 105,
+	84, 84, 74, 53, 196, 151, 90, 87, 255, 72, 250, 66, 245, 255, 247, 31,
+	255, 103, 255, 95, 255, 255, 255, 255, 255, 255, 255, 255, 116, 127, 52, 147,
+	172, 169, 132, 52, 47, 135, 243, 136, 198, 119, 255, 255, 255, 222, 251, 255,
+	47, 255, 242, 43, 223, 242, 230, 191, 239, 255, 223, 244, 255, 255, 126, 242,
+	255, 31, 255, 247, 79, 159, 244, 243, 143, 255, 255, 255, 249, 255, 111, 175,
+	241, 251, 31, 250, 255, 255, 143, 248, 255, 255, 255, 255, 255, 255, 255, 255,
+	243, 255, 126, 253, 255, 111, 54, 52, 143, 209, 252, 246, 245, 255, 255, 255,
+	255, 133, 247, 137, 239, 255, 69, 88, 70, 150, 147, 241, 255, 116, 255, 255,
+	255, 244, 252, 241, 255, 63, 255, 241, 223, 255, 244, 214, 93, 255, 254, 255,
+	255, 255, 255, 120, 250, 255, 31, 255, 255, 255, 191, 241, 255, 255, 255, 255,
+	255, 250, 255, 255, 191, 240, 255, 175, 255, 245, 255, 255, 246, 255, 159, 255,
+	255, 255, 245, 255, 255, 249, 79, 241, 250, 255, 159, 153, 56, 79, 248, 255,
+	255, 175, 245, 255, 255, 255, 254, 243, 255, 15, 254, 247, 255, 239, 247, 255,
+	127, 255, 255, 255, 244, 255, 248, 84, 250, 255, 30, 255, 47, 73, 117, 169,
+	136, 255, 255, 255, 255, 255, 79, 246, 100, 255, 241, 239, 255, 223, 145, 151,
+	255, 255, 255, 239, 175, 255, 255, 255, 255, 96, 255, 254, 223, 239, 255, 255,
+	95, 255, 255, 245, 255, 255, 255, 255, 255, 255, 96, 143, 249, 247, 159, 150,
+	135, 137, 121, 106, 159, 249, 143, 250, 255, 249, 255, 119, 255, 111, 255, 143,
+	255, 39, 63, 31, 120, 116, 255, 247, 255, 255, 255, 255, 119, 246, 169, 111,
+	255, 247, 64, 255, 244, 152, 63, 255, 143, 255, 255, 255, 255, 132, 241, 255,
+	79, 255, 245, 169, 63, 245, 152, 127, 255, 255, 248, 245, 255, 182, 117, 148,
+	79, 105, 255, 245, 127, 31, 245, 165, 73, 143, 255, 255, 255, 255, 255, 150,
+	241, 249, 41, 149, 245, 143, 143, 151, 111, 105, 255, 255, 255, 249, 255, 143,
+	32, 175, 248, 255, 255, 111, 170, 117, 207, 120, 251, 255, 251, 255, 255, 255,
+	255, 245, 245, 255, 27, 255, 243, 247, 31, 246, 255, 239, 255, 255, 255, 255,
+	255, 127, 82, 117, 242, 134, 255, 244, 152, 114, 243, 137, 159, 255, 255, 255,
+	250, 255, 255, 48, 255, 175, 255, 255, 255, 255, 255, 255, 249, 255, 255, 255,
+	250, 255, 255, 255, 64, 255, 255, 255, 255, 255, 191, 124, 255, 79, 191, 255,
+	255, 255, 255, 255, 250, 100, 241, 175, 106, 255, 245, 89, 122, 244, 55, 100,
+	175, 255, 249, 255, 255, 255, 134, 180, 255, 89, 255, 241, 105, 175, 179, 95,
+	137, 175, 255, 255, 47, 255, 246, 100, 131, 242, 47, 255, 245, 251, 153, 99,
+	155, 127, 255, 255, 250, 244, 255, 115, 133, 243, 90, 83, 255, 244, 184, 95,
+	245, 43, 84, 115, 170, 249, 133, 255, 102, 82, 127, 104, 246, 255, 239, 216,
+	46, 111, 83, 242, 127, 255, 255, 255, 255, 255, 65, 243, 255, 90, 255, 246,
+	111, 255, 84, 247, 83, 255, 249, 248, 246, 255, 255, 165, 245, 121, 58, 251,
+	244, 122, 184, 241, 127, 54, 175, 255, 255, 255, 255, 248, 134, 244, 200, 111,
+	255, 244, 68, 172, 37, 159, 130, 92, 141, 250, 71, 255, 248, 115, 243, 251,
+	47, 255, 247, 249, 87, 244, 104, 139, 255, 255, 255, 22, 255, 249, 168, 252,
+	255, 143, 255, 240, 159, 166, 248, 242, 245, 249, 255, 255, 249, 255, 255, 64,
+	246, 255, 255, 255, 246, 255, 127, 248, 95, 135, 255, 255, 255, 255, 255, 255,
+	150, 146, 255, 63, 159, 242, 246, 255, 247, 143, 79, 255, 249, 255, 242, 255,
+	255, 168, 245, 255, 31, 255, 244, 248, 41, 255, 143, 167, 255, 255, 255, 159,
+	255, 255, 69, 243, 255, 95, 255, 244, 129, 79, 248, 127, 103, 255, 255, 255,
+	127, 255, 255, 33, 255, 255, 255, 255, 255, 143, 143, 255, 255, 254, 255, 223,
+	223, 255, 255, 255, 48, 255, 191, 154, 255, 255, 207, 85, 255, 255, 252, 111,
+	255, 255, 255, 175, 255, 80, 255, 137, 152, 159, 255, 104, 119, 121, 249, 247,
+	246, 159, 249, 255, 255, 159, 245, 246, 255, 15, 244, 246, 223, 239, 248, 255,
+	143, 255, 255, 255, 255, 255, 137, 98, 121, 101, 117, 118, 103, 69, 52, 103,
+	67, 163, 153, 120, 103, 255, 189, 186, 99, 87, 101, 70, 89, 85, 85, 68,
+	120, 69, 180, 118, 103, 167, 255, 111, 196, 245, 242, 255, 111, 255, 241, 111,
+	255, 244, 109, 77, 111, 253, 255, 111, 255, 255, 66, 242, 255, 79, 255, 251,
+	255, 255, 243, 255, 111, 255, 255, 255, 180, 255, 249, 83, 244, 255, 45, 255,
+	246, 127, 207, 242, 79, 86, 255, 255, 255, 242, 255, 102, 244, 223, 214, 236,
+	237, 223, 205, 6, 223, 196, 245, 255, 230, 254, 255, 255, 255, 245, 246, 255,
+	143, 255, 255, 241, 255, 249, 255, 161, 255, 255, 255, 170, 255, 245, 66, 244,
+	255, 47, 255, 242, 255, 143, 243, 154, 255, 143, 255, 255, 230, 255, 255, 80,
+	247, 255, 255, 127, 248, 248, 247, 119, 120, 255, 255, 255, 255, 255, 255, 255,
+	66, 140, 167, 104, 54, 156, 84, 102, 171, 134, 211, 124, 102, 249, 255, 143,
+	243, 85, 242, 255, 63, 255, 242, 205, 223, 245, 237, 222, 255, 255, 255, 242,
+	255, 255, 66, 249, 171, 247, 159, 159, 105, 88, 255, 118, 241, 255, 143, 248,
+	255, 255, 255, 65, 159, 248, 59, 255, 47, 169, 118, 170, 117, 248, 95, 252,
+	250, 255, 255, 250, 135, 243, 255, 111, 255, 245, 255, 255, 244, 255, 255, 255,
+	255, 255, 175, 15, 250, 117, 211, 122, 37, 173, 243, 199, 77, 211, 93, 101,
+	183, 153, 251, 131, 191, 150, 115, 124, 84, 99, 191, 95, 74, 50, 91, 99,
+	132, 207, 252, 255, 255, 250, 255, 249, 242, 255, 79, 255, 243, 255, 255, 244,
+	255, 63, 255, 255, 255, 242, 255, 143, 82, 244, 255, 95, 255, 242, 244, 95,
+	69, 255, 99, 249, 255, 255, 247, 255, 255, 116, 243, 255, 111, 255, 243, 255,
+	47, 243, 245, 63, 255, 255, 255, 245, 175, 250, 65, 127, 248, 248, 143, 119,
+	135, 67, 152, 116, 246, 249, 127, 56, 255, 105, 249, 175, 255, 255, 159, 255,
+	240, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 64, 245, 245, 246,
+	255, 249, 249, 255, 102, 105, 255, 151, 127, 249, 245, 248, 255, 65, 106, 68,
+	100, 250, 127, 153, 84, 153, 55, 132, 95, 185, 248, 255, 155, 248, 115, 252,
+	132, 83, 101, 91, 117, 19, 184, 134, 152, 250, 104, 255, 255, 255, 248, 255,
+	245, 255, 30, 255, 244, 255, 31, 255, 255, 159, 255, 255, 255, 255, 255, 255,
+	98, 122, 149, 137, 91, 107, 148, 72, 134, 101, 243, 169, 68, 132, 255, 255,
+	245, 246, 242, 255, 79, 255, 241, 127, 111, 244, 136, 62, 255, 255, 255, 255,
+	255, 255, 84, 242, 255, 47, 255, 242, 255, 232, 244, 127, 111, 255, 255, 255,
+	111, 223, 252, 175, 246, 255, 47, 255, 242, 255, 255, 244, 143, 143, 255, 255,
+	255, 245, 255, 242, 116, 111, 50, 122, 164, 175, 195, 69, 191, 40, 166, 122,
+	111, 255, 255, 255, 255, 244, 109, 255, 223, 255, 247, 197, 255, 198, 79, 102,
+	255, 255, 255, 222, 255, 240, 115, 85, 106, 248, 244, 71, 119, 103, 104, 127,
+	247, 249, 31, 244, 255, 153, 255, 159, 240, 255, 191, 255, 252, 255, 223, 255,
+	255, 253, 255, 255, 255, 255, 255, 255, 48, 255, 249, 111, 255, 127, 248, 133,
+	255, 255, 254, 111, 255, 255, 255, 255, 255, 84, 143, 153, 168, 47, 255, 243,
+	41, 171, 93, 245, 250, 167, 181, 255, 143, 248, 134, 95, 175, 247, 143, 255,
+	167, 255, 255, 127, 244, 255, 10, 239, 255, 255, 255, 81, 191, 251, 60, 255,
+	143, 203, 150, 255, 166, 245, 143, 246, 255, 255, 90, 248, 125, 255, 127, 255,
+	255, 255, 255, 5, 255, 247, 251, 255, 255, 255, 255, 255, 255, 80, 246, 152,
+	248, 143, 248, 150, 127, 104, 121, 248, 247, 159, 249, 255, 247, 255, 115, 247,
+	121, 104, 139, 123, 68, 40, 169, 85, 130, 137, 147, 245, 255, 159, 244, 230,
+	244, 255, 95, 255, 242, 28, 239, 244, 246, 63, 255, 255, 239, 247, 255, 255,
+	137, 250, 255, 143, 255, 255, 255, 255, 240, 255, 255, 255, 255, 255, 159, 255,
+	255, 133, 191, 184, 105, 246, 159, 154, 31, 255, 67, 242, 175, 104, 57, 255,
+	124, 251, 49, 122, 255, 168, 111, 191, 102, 57, 175, 101, 242, 255, 79, 249,
+	255, 255, 247, 101, 243, 255, 73, 255, 241, 255, 79, 247, 255, 95, 255, 255,
+	255, 242, 255, 255, 254, 244, 255, 71, 255, 244, 255, 239, 241, 255, 94, 255,
+	255, 255, 242, 255, 255, 132, 249, 72, 68, 129, 106, 55, 86, 159, 70, 165,
+	170, 159, 89, 255, 251, 255, 149, 244, 255, 111, 255, 243, 79, 255, 241, 248,
+	135, 143, 255, 247, 89, 255, 255, 100, 245, 255, 111, 255, 245, 193, 254, 204,
+	223, 215, 255, 255, 255, 222, 255, 243, 65, 248, 255, 232, 143, 159, 56, 101,
+	239, 69, 247, 127, 255, 248, 255, 79, 255, 66, 255, 249, 63, 255, 47, 168,
+	100, 255, 95, 255, 63, 249, 248, 255, 255, 255, 49, 255, 175, 255, 255, 255,
+	255, 95, 250, 249, 242, 255, 255, 255, 255, 249, 255, 65, 134, 151, 245, 136,
+	249, 149, 102, 104, 105, 117, 120, 255, 248, 255, 246, 249, 82, 124, 150, 134,
+	87, 73, 70, 86, 106, 85, 150, 123, 56, 249, 255, 143, 179, 83, 242, 150,
+	55, 255, 244, 56, 231, 115, 86, 86, 104, 248, 255, 247, 255, 255, 83, 242,
+	249, 47, 166, 245, 171, 79, 164, 87, 79, 143, 255, 255, 243, 175, 255, 145,
+	137, 115, 117, 122, 117, 101, 54, 69, 85, 117, 171, 135, 247, 255, 251, 168,
+	133, 236, 151, 26, 136, 68, 133, 149, 174, 135, 180, 139, 102, 251, 255, 95,
+	242, 245, 243, 255, 127, 255, 244, 239, 255, 244, 133, 101, 255, 241, 255, 255,
+	255, 255, 184, 244, 255, 127, 255, 247, 255, 143, 242, 255, 95, 255, 255, 255,
+	241, 175, 245, 82, 185, 51, 58, 153, 63, 153, 116, 159, 69, 154, 253, 173,
+	249, 255, 255, 251, 246, 246, 255, 139, 255, 246, 145, 191, 151, 255, 161, 255,
+	255, 255, 169, 255, 255, 82, 242, 251, 63, 255, 243, 175, 111, 244, 133, 127,
+	191, 255, 255, 148, 255, 250, 100, 136, 255, 133, 148, 154, 55, 149, 152, 135,
+	146, 255, 255, 255, 255, 47, 249, 151, 251, 255, 143, 255, 244, 47, 255, 240,
+	247, 143, 255, 255, 255, 255, 255, 255, 254, 242, 255, 31, 255, 243, 253, 255,
+	247, 255, 47, 255, 255, 255, 247, 255, 255, 253, 242, 255, 79, 255, 241, 253,
+	191, 247, 111, 91, 255, 255, 255, 255, 255, 111, 99, 255, 255, 47, 255, 31,
+	255, 244, 255, 255, 255, 63, 255, 255, 255, 255, 255, 81, 255, 127, 95, 207,
+	246, 244, 127, 245, 79, 255, 255, 111, 242, 255, 79, 243, 117, 255, 249, 47,
+	247, 143, 111, 122, 255, 255, 242, 255, 255, 154, 255, 79, 242, 252, 255, 255,
+	246, 255, 255, 239, 6, 255, 237, 250, 255, 255, 255, 255, 255, 255, 97, 85,
+	134, 165, 138, 248, 117, 102, 87, 87, 133, 137, 127, 255, 255, 249, 255, 53,
+	196, 251, 92, 191, 248, 71, 57, 245, 130, 127, 79, 255, 63, 244, 255, 182,
+	83, 242, 207, 76, 255, 245, 84, 102, 100, 134, 118, 255, 255, 143, 196, 255,
+	253, 99, 244, 252, 102, 255, 245, 111, 175, 241, 179, 79, 207, 255, 255, 255,
+	175, 255, 99, 180, 137, 51, 200, 243, 133, 54, 69, 86, 88, 127, 127, 250,
+	200, 255, 247, 80, 255, 150, 244, 255, 191, 246, 79, 255, 255, 246, 255, 251,
+	255, 255, 255, 255, 251, 182, 255, 38, 255, 242, 248, 31, 255, 191, 255, 255,
+	255, 255, 159, 255, 255, 250, 247, 243, 114, 249, 243, 186, 49, 247, 247, 255,
+	255, 255, 255, 255, 255, 255, 246, 255, 79, 230, 47, 255, 255, 71, 255, 39,
+	243, 127, 47, 255, 255, 255, 254, 80, 255, 255, 248, 255, 255, 165, 121, 255,
+	74, 245, 255, 255, 255, 255, 255, 250, 82, 242, 255, 79, 255, 243, 168, 143,
+	180, 100, 72, 191, 187, 249, 207, 251, 255, 116, 133, 159, 73, 244, 245, 121,
+	61, 243, 207, 75, 252, 79, 255, 21, 127, 197, 81, 114, 255, 63, 255, 246,
+	152, 116, 69, 159, 92, 255, 255, 255, 255, 255, 249, 99, 243, 86, 55, 207,
+	243, 182, 79, 180, 76, 115, 244, 101, 250, 167, 252, 151, 253, 31, 253, 249,
+	255, 255, 216, 254, 79, 231, 242, 255, 255, 255, 255, 255, 255, 154, 244, 255,
+	47, 255, 243, 153, 191, 244, 179, 39, 255, 245, 252, 245, 255, 255, 116, 164,
+	167, 86, 143, 243, 150, 82, 243, 99, 116, 202, 169, 156, 244, 255, 165, 134,
+	246, 247, 127, 255, 245, 56, 103, 118, 101, 129, 251, 191, 255, 39, 255, 249,
+	131, 116, 244, 87, 111, 245, 67, 85, 83, 53, 120, 251, 111, 255, 182, 255,
+	247, 234, 243, 246, 239, 255, 244, 255, 255, 242, 241, 119, 255, 255, 255, 255,
+	255, 255, 255, 253, 255, 8, 255, 244, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 175, 249, 255, 57, 255, 242, 243, 31, 255, 255, 148, 255, 255,
+	255, 159, 255, 255, 250, 185, 255, 79, 255, 240, 79, 255, 248, 255, 249, 255,
+	255, 255, 255, 255, 143, 255, 251, 255, 111, 255, 247, 255, 111, 255, 255, 239,
+	255, 255, 255, 15, 255, 111, 134, 127, 244, 239, 111, 255, 255, 24, 255, 72,
+	243, 255, 255, 63, 255, 255, 255, 116, 191, 168, 244, 59, 191, 98, 100, 124,
+	81, 149, 143, 191, 252, 255, 175, 252, 247, 255, 186, 249, 191, 140, 153, 95,
+	207, 128, 247, 127, 68, 247, 255, 255, 255, 247, 169, 250, 136, 143, 134, 71,
+	107, 255, 4, 246, 255, 154, 249, 255, 111, 247, 254, 241, 255, 63, 255, 244,
+	255, 255, 242, 255, 127, 255, 255, 255, 111, 95, 133, 253, 242, 255, 173, 255,
+	251, 255, 207, 242, 223, 125, 255, 255, 255, 241, 255, 255, 164, 172, 149, 243,
+	88, 166, 21, 85, 109, 69, 198, 143, 109, 255, 255, 249, 248, 115, 242, 255,
+	79, 255, 244, 255, 255, 245, 140, 63, 255, 255, 255, 242, 95, 255, 154, 243,
+	255, 47, 255, 242, 255, 255, 242, 223, 255, 255, 255, 251, 248, 255, 247, 252,
+	247, 255, 15, 255, 251, 195, 254, 124, 223, 215, 255, 255, 255, 110, 255, 252,
+	85, 245, 253, 191, 255, 242, 253, 223, 241, 91, 239, 255, 255, 255, 183, 255,
+	255, 134, 55, 255, 255, 255, 255, 106, 127, 255, 22, 243, 251, 175, 72, 255,
+	250, 255, 65, 255, 253, 207, 255, 191, 110, 253, 239, 254, 241, 207, 255, 255,
+	255, 255, 255, 198, 255, 254, 222, 223, 255, 255, 222, 255, 245, 240, 255, 255,
+	79, 255, 239, 255, 33, 127, 255, 248, 255, 247, 245, 120, 111, 86, 249, 119,
+	255, 248, 249, 245, 255, 100, 77, 131, 152, 37, 88, 119, 51, 159, 73, 148,
+	151, 149, 120, 255, 191, 248, 135, 243, 255, 31, 255, 243, 255, 79, 243, 255,
+	111, 255, 255, 255, 243, 255, 255, 69, 244, 248, 95, 255, 245, 143, 143, 245,
+	125, 15, 255, 255, 255, 249, 255, 255, 99, 243, 255, 78, 243, 243, 135, 223,
+	244, 62, 79, 255, 255, 244, 247, 79, 255, 134, 87, 69, 162, 83, 119, 116,
+	67, 86, 55, 150, 135, 121, 117, 255, 191, 250, 255, 243, 255, 134, 255, 240,
+	244, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 130, 86, 85, 120, 122,
+	86, 86, 68, 102, 83, 148, 151, 86, 255, 255, 159, 132, 245, 242, 255, 47,
+	255, 242, 111, 117, 245, 110, 54, 255, 255, 246, 255, 255, 255, 158, 240, 255,
+	95, 255, 244, 175, 255, 247, 143, 111, 255, 255, 255, 247, 255, 246, 151, 242,
+	255, 79, 255, 245, 255, 255, 242, 127, 79, 255, 255, 255, 161, 255, 250, 151,
+	89, 66, 102, 168, 69, 67, 101, 93, 75, 198, 152, 85, 182, 255, 255, 248,
+	255, 245, 255, 15, 255, 245, 255, 255, 246, 255, 239, 255, 255, 255, 255, 255,
+	255, 150, 245, 248, 111, 255, 241, 242, 169, 245, 169, 166, 255, 255, 255, 248,
+	255, 255, 101, 243, 152, 95, 255, 241, 118, 63, 245, 121, 79, 249, 255, 255,
+	164, 255, 255, 117, 136, 63, 55, 67, 107, 162, 102, 63, 89, 248, 155, 105,
+	246, 255, 89, 250, 134, 246, 255, 255, 255, 240, 255, 63, 153, 249, 111, 255,
+	255, 255, 255, 255, 255, 255, 243, 255, 31, 255, 241, 253, 239, 249, 248, 255,
+	255, 255, 255, 255, 255, 79, 50, 255, 243, 79, 246, 79, 159, 150, 255, 255,
+	242, 95, 255, 249, 255, 255, 255, 148, 255, 255, 65, 127, 255, 127, 67, 143,
+	255, 243, 255, 111, 255, 255, 63, 255, 65, 117, 255, 244, 255, 246, 102, 103,
+	118, 87, 103, 143, 255, 255, 248, 246, 95, 66, 102, 150, 249, 159, 120, 86,
+	35, 137, 118, 99, 104, 132, 255, 255, 255, 247, 232, 245, 255, 223, 255, 247,
+	205, 239, 240, 242, 223, 255, 255, 239, 253, 255, 255, 252, 243, 255, 47, 255,
+	246, 239, 239, 241, 255, 255, 255, 255, 255, 253, 255, 98, 253, 246, 241, 30,
+	255, 252, 207, 223, 231, 237, 223, 255, 255, 255, 254, 255, 255, 115, 102, 68,
+	248, 159, 75, 100, 68, 159, 162, 165, 90, 127, 191, 255, 255, 255, 255, 240,
+	255, 171, 255, 244, 254, 175, 255, 255, 239, 255, 255, 255, 255, 255, 255, 99,
+	171, 86, 135, 255, 116, 103, 65, 154, 53, 164, 169, 105, 255, 255, 111, 244,
+	134, 241, 249, 95, 255, 241, 95, 191, 243, 133, 127, 255, 255, 255, 255, 255,
+	255, 152, 244, 255, 47, 255, 241, 255, 255, 242, 255, 95, 255, 255, 255, 186,
+	255, 248, 88, 245, 255, 31, 255, 247, 255, 255, 242, 255, 143, 255, 255, 255,
+	244, 255, 255, 254, 244, 255, 95, 255, 244, 255, 239, 241, 255, 142, 255, 255,
+	255, 242, 255, 246, 165, 95, 99, 83, 63, 159, 84, 101, 99, 68, 184, 92,
+	152, 255, 255, 159, 255, 175, 246, 255, 63, 255, 243, 143, 252, 241, 244, 79,
+	255, 255, 255, 255, 251, 249, 249, 242, 255, 31, 255, 248, 255, 255, 242, 255,
+	239, 255, 255, 255, 255, 248, 255, 116, 243, 249, 63, 255, 244, 244, 245, 243,
+	255, 132, 255, 175, 255, 241, 255, 255, 135, 243, 243, 79, 255, 243, 248, 75,
+	212, 178, 95, 191, 255, 255, 72, 191, 185, 100, 102, 249, 166, 249, 153, 119,
+	100, 111, 116, 145, 244, 255, 47, 255, 119, 255, 234, 254, 255, 31, 255, 252,
+	255, 255, 241, 245, 143, 255, 255, 255, 255, 255, 255, 254, 251, 255, 63, 255,
+	241, 254, 207, 255, 255, 252, 255, 255, 255, 255, 255, 47, 247, 243, 255, 143,
+	255, 240, 253, 223, 255, 255, 116, 255, 255, 255, 255, 255, 255, 100, 255, 243,
+	143, 255, 223, 15, 255, 127, 249, 254, 159, 127, 255, 255, 255, 255, 80, 255,
+	255, 143, 255, 255, 255, 246, 248, 255, 255, 255, 255, 255, 255, 127, 249, 64,
+	255, 255, 255, 255, 255, 251, 251, 255, 255, 247, 159, 248, 143, 255, 255, 255,
+	65, 134, 249, 132, 159, 150, 102, 151, 88, 103, 119, 248, 159, 255, 247, 246,
+	255, 66, 77, 148, 87, 191, 105, 52, 38, 175, 180, 147, 122, 248, 253, 255,
+	143, 198, 151, 244, 255, 47, 255, 243, 79, 255, 243, 249, 47, 255, 255, 255,
+	170, 255, 155, 98, 191, 104, 255, 203, 95, 35, 52, 127, 116, 247, 155, 155,
+	255, 255, 255, 191, 82, 137, 132, 127, 168, 119, 102, 99, 63, 116, 164, 131,
+	73, 251, 255, 255, 246, 255, 242, 255, 79, 255, 242, 63, 255, 244, 242, 79,
+	175, 255, 255, 255, 249, 255, 253, 241, 255, 95, 255, 242, 255, 239, 117, 255,
+	239, 255, 255, 255, 191, 239, 245, 98, 245, 253, 31, 255, 246, 255, 238, 228,
+	255, 127, 255, 255, 255, 246, 255, 253, 255, 243, 255, 143, 255, 248, 255, 255,
+	241, 175, 111, 255, 255, 255, 241, 255, 255, 99, 79, 83, 119, 104, 88, 52,
+	100, 123, 146, 197, 252, 79, 251, 255, 255, 245, 254, 251, 255, 47, 255, 246,
+	255, 255, 250, 240, 127, 255, 255, 255, 255, 255, 255, 83, 243, 255, 63, 255,
+	244, 255, 255, 241, 255, 63, 255, 255, 203, 244, 255, 151, 249, 249, 249, 187,
+	255, 252, 101, 251, 167, 255, 51, 175, 159, 255, 252, 207, 241, 83, 148, 103,
+	105, 175, 255, 135, 103, 47, 82, 248, 255, 248, 255, 255, 95, 249, 67, 243,
+	255, 63, 255, 241, 254, 207, 255, 255, 140, 255, 255, 255, 255, 255, 79, 49,
+	255, 243, 79, 249, 79, 250, 132, 255, 150, 255, 95, 255, 246, 255, 255, 255,
+	80, 255, 255, 191, 255, 252, 255, 255, 255, 95, 249, 255, 255, 255, 255, 127,
+	250, 96, 102, 103, 246, 255, 248, 247, 119, 63, 95, 143, 255, 255, 255, 248,
+	255, 255, 227, 239, 125, 230, 111, 111, 39, 52, 127, 83, 245, 95, 228, 255,
+	255, 255, 247, 95, 148, 255, 111, 248, 244, 29, 233, 247, 132, 134, 255, 255,
+	255, 152, 143, 255, 242, 243, 246, 127, 255, 242, 79, 239, 242, 119, 95, 255,
+	255, 255, 255, 255, 255, 175, 240, 251, 79, 247, 245, 255, 249, 246, 191, 90,
+	255, 255, 255, 154, 255, 255, 254, 255, 255, 255, 255, 255, 255, 227, 255, 255,
+	240, 255, 255, 255, 255, 255, 255, 255, 68, 255, 8, 255, 245, 255, 63, 255,
+	143, 127, 255, 255, 255, 255, 255, 255, 246, 86, 126, 71, 255, 242, 66, 109,
+	245, 63, 127, 255, 95, 255, 246, 255, 255, 135, 255, 103, 127, 255, 246, 207,
+	255, 255, 63, 128, 255, 255, 255, 255, 111, 255, 150, 241, 245, 159, 255, 248,
+	153, 249, 246, 135, 101, 159, 242, 250, 255, 255, 255, 165, 148, 248, 40, 255,
+	244, 249, 149, 249, 255, 87, 255, 255, 255, 47, 111, 98, 149, 101, 175, 31,
+	255, 255, 159, 100, 146, 127, 127, 255, 255, 255, 246, 255, 248, 116, 243, 95,
+	98, 255, 243, 241, 159, 117, 111, 150, 255, 246, 248, 125, 255, 255, 117, 243,
+	255, 79, 255, 247, 127, 63, 37, 129, 143, 255, 175, 255, 250, 255, 255, 132,
+	130, 73, 69, 255, 244, 134, 71, 243, 56, 71, 159, 168, 255, 243, 255, 248,
+	166, 247, 255, 127, 255, 248, 67, 247, 86, 95, 160, 191, 255, 255, 159, 255,
+	255, 115, 117, 184, 63, 255, 244, 248, 143, 245, 35, 122, 175, 255, 255, 69,
+	255, 137, 247, 250, 255, 31, 255, 247, 223, 255, 251, 119, 223, 241, 255, 255,
+	255, 255, 255, 159, 243, 255, 31, 255, 242, 255, 79, 248, 255, 151, 255, 255,
+	245, 255, 255, 79, 102, 244, 255, 47, 255, 244, 225, 223, 254, 95, 244, 255,
+	255, 255, 127, 255, 255, 159, 245, 255, 15, 255, 243, 255, 143, 255, 255, 111,
+	255, 255, 255, 255, 255, 255, 97, 255, 255, 255, 255, 255, 255, 159, 255, 143,
+	243, 255, 223, 47, 255, 255, 255, 248, 255, 183, 255, 255, 15, 153, 137, 255,
+	167, 185, 255, 255, 255, 255, 255, 255, 229, 255, 230, 243, 255, 47, 212, 109,
+	255, 97, 248, 255, 255, 255, 255, 255, 255, 249, 255, 95, 152, 127, 249, 64,
+	95, 248, 111, 255, 255, 85, 255, 255, 255, 248, 253, 241, 111, 127, 255, 241,
+	255, 239, 246, 255, 239, 255, 255, 255, 127, 239, 252, 118, 255, 254, 249, 255,
+	255, 122, 73, 255, 240, 246, 255, 255, 255, 255, 255, 255, 86, 241, 255, 127,
+	255, 244, 255, 255, 242, 255, 95, 255, 255, 255, 244, 249, 255, 248, 255, 255,
+	214, 126, 255, 85, 13, 223, 206, 246, 255, 239, 239, 255, 215, 255, 245, 247,
+	255, 79, 255, 240, 223, 255, 244, 252, 223, 110, 255, 255, 255, 255, 255, 96,
+	111, 143, 247, 255, 247, 111, 134, 255, 134, 255, 255, 127, 255, 255, 255, 255,
+	100, 95, 103, 238, 95, 72, 70, 52, 239, 66, 68, 255, 143, 247, 255, 255,
+	244, 123, 143, 231, 246, 255, 143, 125, 81, 255, 213, 244, 255, 255, 242, 255,
+	255, 255, 100, 255, 129, 153, 255, 103, 95, 102, 248, 230, 242, 143, 143, 255,
+	255, 159, 248, 247, 255, 248, 112, 245, 111, 153, 167, 249, 117, 132, 255, 159,
+	255, 255, 255, 255, 110, 240, 255, 79, 254, 253, 255, 239, 243, 255, 127, 255,
+	255, 255, 254, 255, 255, 65, 255, 247, 255, 239, 239, 239, 101, 159, 244, 242,
+	111, 255, 255, 255, 255, 254, 115, 255, 118, 245, 255, 143, 42, 55, 111, 39,
+	250, 255, 255, 255, 255, 255, 255, 249, 164, 255, 90, 255, 65, 134, 153, 165,
+	247, 250, 244, 255, 255, 255, 63, 242, 252, 241, 255, 223, 255, 242, 31, 255,
+	247, 221, 221, 255, 254, 255, 255, 255, 255, 48, 255, 92, 207, 255, 191, 222,
+	253, 223, 254, 252, 207, 255, 255, 255, 255, 255, 83, 175, 154, 72, 255, 111,
+	57, 39, 255, 56, 178, 255, 255, 143, 255, 95, 247, 151, 207, 87, 159, 143,
+	79, 121, 21, 255, 36, 246, 159, 159, 247, 255, 255, 255, 117, 143, 165, 111,
+	255, 89, 84, 71, 143, 42, 241, 159, 175, 127, 255, 255, 246, 253, 241, 255,
+	95, 255, 242, 223, 255, 242, 238, 77, 255, 254, 255, 255, 255, 255, 159, 244,
+	255, 143, 255, 243, 255, 255, 241, 255, 95, 255, 255, 255, 241, 255, 249, 250,
+	246, 250, 47, 255, 246, 255, 255, 241, 254, 159, 255, 255, 255, 229, 255, 175,
+	253, 255, 255, 255, 255, 255, 255, 40, 255, 244, 241, 255, 255, 255, 255, 255,
+	255, 51, 47, 87, 72, 239, 127, 103, 85, 159, 133, 244, 104, 255, 255, 255,
+	79, 244, 98, 159, 79, 117, 255, 95, 102, 20, 250, 54, 247, 249, 143, 255,
+	255, 255, 255, 119, 25, 150, 105, 255, 111, 90, 70, 255, 163, 244, 100, 255,
+	255, 255, 255, 250, 254, 245, 255, 127, 255, 243, 239, 255, 240, 238, 110, 255,
+	255, 255, 255, 255, 255, 248, 245, 255, 46, 255, 241, 255, 223, 242, 239, 254,
+	255, 255, 255, 252, 95, 243, 244, 207, 70, 39, 221, 47, 189, 70, 95, 198,
+	115, 255, 239, 254, 255, 255, 255, 246, 255, 254, 31, 223, 79, 142, 206, 255,
+	238, 243, 255, 255, 255, 255, 79, 242, 166, 255, 79, 74, 255, 63, 255, 21,
+	191, 63, 186, 255, 255, 255, 255, 255, 255, 170, 255, 255, 47, 255, 47, 116,
+	244, 255, 239, 245, 63, 255, 95, 255, 255, 255, 242, 255, 255, 255, 255, 255,
+	239, 29, 255, 236, 250, 239, 255, 255, 255, 255, 255, 80, 250, 247, 250, 255,
+	248, 250, 248, 106, 255, 175, 249, 255, 255, 255, 255, 255, 239, 252, 255, 79,
+	255, 243, 204, 239, 242, 241, 207, 255, 255, 239, 252, 255, 255, 168, 241, 255,
+	63, 255, 255, 255, 111, 241, 255, 175, 255, 255, 255, 250, 255, 255, 253, 243,
+	255, 30, 255, 252, 207, 223, 236, 238, 31, 255, 255, 255, 255, 255, 255, 80,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	253, 250, 242, 252, 255, 254, 255, 204, 241, 143, 223, 255, 255, 255, 242, 255,
+	255, 96, 255, 255, 252, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255,
+	255, 255, 101, 245, 255, 239, 255, 241, 47, 159, 245, 127, 254, 255, 255, 255,
+	255, 255, 255, 243, 243, 248, 239, 255, 244, 241, 255, 242, 159, 249, 255, 255,
+	255, 127, 255, 254, 64, 254, 255, 127, 255, 242, 137, 255, 254, 127, 255, 255,
+	255, 255, 255, 255, 250, 255, 247, 255, 223, 255, 254, 255, 255, 240, 249, 79,
+	255, 255, 255, 255, 255, 255, 150, 240, 119, 120, 255, 254, 255, 143, 243, 255,
+	127, 255, 255, 255, 255, 255, 127, 150, 245, 255, 175, 255, 243, 244, 255, 245,
+	255, 255, 255, 255, 255, 20, 255, 255, 64, 255, 250, 255, 255, 255, 255, 255,
+	243, 255, 255, 255, 255, 255, 255, 255, 255, 254, 247, 255, 111, 255, 242, 243,
+	31, 255, 255, 108, 255, 255, 255, 255, 255, 239, 238, 242, 255, 31, 255, 245,
+	101, 207, 253, 47, 254, 255, 255, 255, 111, 255, 239, 64, 103, 85, 150, 255,
+	247, 134, 137, 102, 105, 119, 86, 255, 248, 255, 151, 255, 138, 250, 255, 159,
+	255, 255, 255, 255, 241, 255, 47, 255, 255, 255, 255, 255, 243, 254, 248, 255,
+	255, 255, 244, 255, 159, 240, 255, 127, 255, 255, 255, 255, 255, 255, 255, 244,
+	255, 143, 255, 248, 255, 255, 241, 255, 95, 255, 255, 248, 241, 159, 255, 248,
+	127, 255, 255, 255, 254, 225, 255, 238, 143, 247, 127, 255, 255, 255, 255, 241,
+	69, 242, 254, 31, 255, 243, 255, 239, 246, 84, 143, 255, 255, 255, 118, 255,
+	255, 255, 244, 255, 31, 255, 243, 253, 239, 242, 255, 103, 255, 255, 255, 255,
+	255, 247, 48, 143, 255, 247, 255, 143, 247, 247, 127, 248, 243, 247, 191, 191,
+	255, 247, 255, 98, 95, 71, 213, 223, 255, 247, 19, 255, 83, 246, 255, 111,
+	255, 255, 239, 255, 141, 118, 243, 143, 79, 252, 223, 255, 107, 18, 221, 255,
+	254, 248, 255, 255, 255, 248, 246, 255, 15, 255, 253, 111, 255, 253, 255, 255,
+	255, 255, 255, 63, 255, 253, 254, 244, 255, 159, 255, 244, 255, 255, 240, 254,
+	90, 255, 255, 255, 239, 255, 255, 80, 159, 127, 248, 255, 143, 248, 247, 143,
+	152, 255, 255, 255, 255, 255, 255, 255, 82, 249, 255, 95, 255, 254, 255, 63,
+	248, 30, 255, 255, 255, 255, 223, 255, 255, 82, 242, 255, 47, 255, 242, 255,
+	255, 245, 255, 127, 255, 255, 255, 255, 255, 95, 255, 244, 255, 47, 255, 241,
+	255, 255, 255, 255, 95, 255, 255, 255, 255, 255, 255, 80, 137, 152, 168, 127,
+	249, 137, 175, 120, 120, 138, 248, 159, 255, 255, 250, 255, 252, 246, 255, 223,
+	255, 246, 15, 63, 253, 143, 255, 255, 255, 248, 253, 255, 255, 132, 244, 255,
+	94, 127, 248, 194, 95, 242, 243, 63, 255, 255, 255, 255, 255, 255, 253, 255,
+	255, 255, 255, 255, 255, 211, 255, 254, 240, 255, 255, 255, 255, 255, 255, 247,
+	242, 249, 126, 255, 246, 244, 125, 253, 255, 159, 255, 255, 255, 113, 255, 255,
+	83, 132, 247, 111, 255, 241, 255, 254, 244, 255, 111, 255, 255, 255, 243, 255,
+	254, 117, 246, 102, 118, 143, 241, 244, 103, 247, 63, 111, 255, 255, 255, 153,
+	255, 255, 100, 244, 244, 164, 253, 246, 111, 30, 244, 127, 94, 239, 255, 255,
+	103, 255, 255, 246, 243, 255, 127, 255, 242, 255, 95, 244, 94, 127, 255, 255,
+	255, 22, 255, 255, 255, 244, 255, 47, 255, 241, 255, 255, 255, 255, 95, 255,
+	255, 255, 223, 255, 223, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 242,
+	255, 191, 31, 255, 255, 255, 80, 255, 254, 223, 239, 255, 255, 239, 255, 127,
+	253, 255, 255, 255, 255, 255, 255, 66, 254, 255, 217, 255, 248, 255, 31, 253,
+	255, 255, 255, 255, 255, 249, 255, 255, 131, 247, 254, 143, 255, 253, 248, 47,
+	247, 29, 255, 255, 63, 255, 199, 255, 255,
+};
+
+static const UTF16 kLettersUk [32] =
+{
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B,
+	0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+	0x0448, 0x0449, 0x044C, 0x044E, 0x044F, 0x0454, 0x0456, 0x0457,
+};
+
+static const uint16_t kContextsUk [1156] =
+{
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 0, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 43, 44, 45,
+	46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 28, 60,
+	61, 62, 63, 64, 0, 65, 66, 67, 68, 69, 70, 71, 72, 73, 10, 74,
+	75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 59,
+	28, 90, 91, 92, 93, 94, 0, 95, 96, 97, 98, 99, 100, 101, 41, 102,
+	103, 43, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+	118, 59, 28, 60, 119, 120, 121, 64, 0, 122, 123, 97, 124, 125, 126, 127,
+	128, 102, 129, 43, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 114, 140,
+	116, 117, 118, 59, 28, 60, 119, 120, 141, 64, 0, 142, 143, 144, 145, 146,
+	100, 147, 41, 102, 148, 43, 149, 150, 151, 152, 153, 109, 154, 155, 156, 157,
+	114, 115, 116, 117, 118, 59, 28, 60, 119, 120, 158, 64, 0, 159, 160, 161,
+	162, 99, 100, 163, 164, 102, 165, 43, 166, 167, 168, 169, 170, 171, 172, 173,
+	174, 175, 114, 176, 116, 117, 118, 59, 177, 60, 119, 120, 178, 64, 0, 179,
+	180, 181, 182, 183, 184, 71, 185, 186, 10, 187, 188, 189, 190, 191, 192, 193,
+	194, 195, 196, 197, 198, 199, 200, 201, 202, 59, 28, 60, 203, 120, 93, 64,
+	0, 204, 205, 97, 98, 99, 100, 206, 41, 102, 207, 43, 149, 208, 209, 210,
+	211, 109, 212, 155, 112, 213, 114, 115, 116, 117, 118, 59, 28, 60, 119, 120,
+	214, 64, 0, 215, 216, 217, 218, 219, 220, 221, 41, 102, 222, 43, 223, 224,
+	225, 226, 227, 228, 229, 230, 112, 231, 114, 115, 116, 117, 232, 59, 233, 60,
+	119, 120, 234, 64, 0, 235, 236, 237, 238, 239, 240, 71, 241, 242, 10, 243,
+	244, 245, 246, 247, 248, 249, 250, 251, 252, 197, 253, 254, 255, 256, 257, 258,
+	28, 60, 259, 120, 93, 64, 0, 260, 236, 97, 261, 99, 262, 71, 41, 102,
+	10, 43, 263, 264, 265, 266, 267, 109, 212, 268, 269, 197, 114, 115, 116, 117,
+	118, 59, 28, 60, 119, 120, 93, 64, 0, 270, 271, 97, 272, 99, 100, 273,
+	41, 102, 274, 43, 149, 275, 209, 276, 277, 109, 278, 279, 280, 281, 114, 115,
+	282, 117, 118, 283, 28, 60, 119, 120, 284, 64, 0, 285, 286, 97, 98, 287,
+	100, 288, 41, 102, 289, 43, 290, 291, 209, 292, 293, 109, 212, 155, 294, 295,
+	114, 115, 116, 117, 118, 59, 296, 297, 298, 120, 299, 64, 0, 300, 301, 302,
+	303, 99, 100, 304, 41, 102, 305, 43, 306, 307, 209, 308, 309, 310, 212, 311,
+	112, 312, 114, 115, 116, 313, 118, 59, 28, 60, 119, 120, 314, 64, 0, 315,
+	316, 97, 98, 317, 318, 319, 41, 320, 321, 43, 322, 224, 209, 323, 324, 109,
+	212, 325, 326, 327, 328, 115, 329, 330, 331, 59, 332, 333, 334, 120, 335, 64,
+	0, 336, 337, 338, 339, 340, 341, 71, 342, 343, 10, 344, 345, 346, 347, 348,
+	349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 59, 28, 360, 361, 362,
+	363, 364, 0, 365, 366, 97, 98, 99, 100, 367, 41, 102, 368, 43, 369, 370,
+	209, 371, 372, 373, 374, 375, 376, 377, 114, 115, 116, 117, 118, 59, 28, 60,
+	119, 120, 378, 64, 0, 379, 380, 381, 382, 383, 384, 385, 41, 102, 386, 43,
+	387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 114, 397, 398, 117, 399, 59,
+	28, 400, 401, 120, 402, 64, 0, 403, 404, 97, 405, 99, 100, 406, 41, 102,
+	407, 43, 408, 409, 410, 411, 412, 413, 212, 414, 415, 416, 114, 417, 418, 117,
+	118, 59, 419, 60, 420, 120, 421, 64, 0, 422, 423, 97, 424, 99, 100, 425,
+	41, 102, 426, 43, 427, 428, 429, 430, 431, 109, 432, 433, 434, 435, 114, 115,
+	116, 117, 118, 59, 436, 437, 438, 120, 439, 64, 0, 440, 441, 442, 443, 444,
+	445, 446, 447, 448, 10, 449, 450, 451, 452, 453, 248, 454, 455, 456, 457, 197,
+	458, 459, 116, 460, 461, 462, 28, 463, 119, 464, 93, 465, 0, 204, 466, 97,
+	98, 99, 100, 467, 41, 102, 10, 43, 149, 468, 209, 292, 469, 109, 470, 155,
+	112, 471, 114, 115, 116, 117, 118, 59, 28, 60, 119, 120, 472, 64, 0, 473,
+	474, 97, 98, 99, 100, 475, 41, 102, 476, 43, 149, 224, 209, 477, 478, 109,
+	479, 155, 112, 480, 114, 115, 116, 117, 118, 59, 28, 60, 119, 120, 481, 64,
+	0, 204, 482, 97, 98, 99, 100, 483, 41, 102, 484, 43, 149, 224, 209, 292,
+	248, 109, 212, 155, 485, 486, 114, 115, 116, 117, 118, 59, 487, 488, 489, 120,
+	490, 64, 0, 204, 491, 97, 98, 99, 100, 492, 41, 102, 493, 43, 494, 224,
+	209, 495, 496, 109, 212, 155, 112, 497, 114, 115, 116, 117, 118, 59, 28, 60,
+	119, 120, 498, 64, 0, 499, 500, 97, 501, 99, 100, 502, 41, 102, 503, 43,
+	504, 505, 209, 506, 507, 109, 212, 155, 508, 509, 114, 115, 116, 117, 118, 59,
+	28, 60, 119, 120, 510, 64, 0, 204, 511, 97, 98, 99, 100, 512, 41, 102,
+	10, 43, 149, 224, 209, 292, 513, 109, 212, 155, 112, 197, 114, 115, 116, 117,
+	118, 59, 28, 60, 119, 120, 93, 64, 0, 514, 236, 97, 98, 99, 100, 71,
+	41, 102, 10, 43, 515, 224, 209, 516, 517, 109, 212, 518, 519, 197, 114, 115,
+	116, 117, 520, 59, 28, 60, 521, 522, 93, 64, 0, 523, 236, 97, 524, 99,
+	100, 71, 41, 102, 10, 43, 149, 224, 209, 292, 248, 109, 525, 155, 526, 197,
+	114, 115, 116, 527, 118, 59, 28, 60, 119, 528, 93, 64, 0, 529, 236, 97,
+	530, 531, 532, 71, 41, 533, 10, 43, 534, 535, 536, 537, 248, 109, 538, 155,
+	539, 197, 114, 540, 541, 117, 118, 59, 28, 60, 119, 120, 93, 64, 0, 542,
+	236, 97, 98, 99, 543, 71, 41, 102, 10, 43, 544, 224, 545, 546, 248, 109,
+	547, 155, 548, 197, 114, 115, 116, 117, 118, 59, 28, 60, 119, 120, 93, 64,
+	0, 549, 550, 551, 552, 553, 554, 71, 555, 556, 10, 557, 558, 559, 560, 561,
+	562, 563, 564, 565, 566, 567, 114, 568, 569, 570, 571, 572, 28, 573, 574, 575,
+	93, 576, 0, 577, 236, 97, 98, 99, 100, 71, 41, 102, 10, 43, 149, 224,
+	209, 578, 248, 109, 212, 155, 112, 197, 114, 115, 116, 117, 118, 59, 28, 60,
+	119, 120, 93, 64,
+};
+
+static const uint8_t kCostsUk [9843] =
+{
+	47, 85, 116, 132, 72, 159, 100, 69, 53, 69, 85, 134, 103, 120, 191, 119,
+	166, 18, 119, 135, 167, 127, 191, 118, 119, 88, 104, 150, 152, 136, 217, 207,
+	202, 200, 149, 42, 100, 163, 140, 111, 53, 69, 106, 82, 117, 136, 134, 247,
+	207, 187, 143, 249, 242, 200, 63, 255, 185, 79, 255, 244, 245, 47, 125, 255,
+	255, 249, 207, 243, 166, 132, 214, 67, 135, 209, 115, 103, 134, 73, 120, 111,
+	255, 255, 252, 237, 243, 159, 82, 244, 74, 191, 186, 111, 159, 243, 242, 58,
+	153, 255, 255, 168, 249, 243, 255, 195, 198, 77, 149, 245, 47, 143, 242, 246,
+	95, 140, 255, 255, 170, 255, 244, 249, 111, 117, 245, 127, 111, 34, 68, 111,
+	68, 133, 133, 255, 248, 255, 249, 248, 116, 245, 255, 24, 255, 245, 239, 217,
+	242, 255, 63, 255, 255, 255, 255, 255, 248, 115, 81, 133, 153, 207, 204, 175,
+	52, 246, 103, 127, 251, 159, 255, 255, 253, 245, 82, 124, 133, 231, 105, 63,
+	68, 83, 93, 54, 228, 86, 103, 135, 255, 216, 239, 227, 247, 255, 246, 255,
+	246, 207, 228, 240, 223, 246, 255, 255, 248, 255, 255, 255, 156, 146, 182, 76,
+	223, 183, 63, 175, 129, 164, 90, 140, 255, 253, 153, 252, 244, 175, 242, 169,
+	63, 255, 242, 155, 250, 243, 255, 79, 143, 255, 255, 104, 167, 242, 159, 97,
+	201, 59, 223, 249, 173, 123, 130, 172, 91, 251, 221, 255, 186, 248, 243, 155,
+	242, 110, 24, 175, 215, 217, 191, 244, 207, 90, 207, 239, 253, 183, 252, 245,
+	171, 40, 105, 244, 111, 143, 116, 87, 42, 54, 179, 169, 89, 249, 255, 250,
+	255, 174, 211, 250, 63, 239, 249, 139, 207, 177, 130, 125, 157, 223, 255, 206,
+	251, 243, 191, 244, 251, 45, 191, 247, 255, 252, 241, 253, 95, 255, 223, 255,
+	255, 243, 245, 187, 211, 247, 63, 255, 242, 68, 185, 53, 186, 66, 89, 250,
+	250, 185, 251, 245, 127, 145, 249, 59, 188, 178, 124, 255, 243, 116, 79, 143,
+	191, 250, 137, 250, 245, 192, 134, 100, 135, 106, 143, 135, 101, 106, 70, 247,
+	171, 143, 155, 255, 250, 159, 154, 241, 202, 111, 255, 191, 123, 255, 243, 245,
+	79, 255, 255, 255, 251, 255, 244, 252, 242, 245, 63, 255, 246, 143, 244, 146,
+	246, 57, 255, 255, 255, 248, 255, 244, 255, 249, 143, 47, 127, 243, 255, 255,
+	168, 255, 143, 255, 255, 255, 82, 245, 242, 255, 241, 255, 79, 245, 241, 143,
+	255, 245, 248, 105, 143, 255, 255, 255, 255, 247, 255, 242, 244, 79, 255, 242,
+	54, 247, 149, 245, 69, 255, 255, 255, 255, 248, 244, 255, 255, 255, 79, 255,
+	255, 255, 255, 240, 255, 255, 255, 255, 255, 255, 255, 247, 82, 143, 153, 249,
+	191, 143, 193, 56, 148, 62, 246, 187, 170, 198, 143, 117, 143, 197, 245, 54,
+	255, 255, 255, 98, 53, 63, 115, 244, 127, 117, 255, 111, 207, 255, 249, 121,
+	117, 165, 175, 175, 96, 85, 104, 135, 120, 138, 255, 255, 255, 255, 255, 112,
+	255, 102, 248, 159, 255, 104, 134, 255, 135, 249, 159, 255, 255, 255, 255, 159,
+	146, 143, 71, 244, 59, 191, 119, 20, 172, 70, 134, 168, 251, 201, 191, 123,
+	191, 115, 255, 127, 246, 255, 111, 127, 70, 255, 133, 247, 31, 127, 255, 255,
+	255, 47, 2, 140, 202, 253, 191, 222, 235, 187, 173, 172, 220, 251, 207, 253,
+	255, 255, 253, 119, 79, 101, 244, 111, 95, 53, 52, 87, 83, 84, 103, 247,
+	246, 111, 246, 111, 249, 242, 247, 63, 255, 255, 79, 255, 244, 245, 63, 122,
+	255, 255, 246, 255, 241, 87, 131, 246, 63, 111, 242, 101, 136, 134, 72, 79,
+	127, 255, 255, 159, 255, 243, 135, 82, 117, 63, 255, 255, 111, 239, 242, 242,
+	40, 248, 255, 255, 255, 247, 245, 89, 242, 245, 41, 147, 246, 95, 127, 242,
+	246, 95, 138, 255, 255, 127, 255, 244, 54, 127, 110, 244, 126, 111, 36, 68,
+	111, 52, 118, 245, 254, 245, 255, 255, 255, 133, 115, 202, 40, 249, 243, 71,
+	58, 149, 172, 73, 175, 111, 251, 252, 217, 245, 116, 65, 151, 104, 255, 247,
+	159, 69, 246, 89, 143, 246, 255, 255, 255, 249, 248, 81, 138, 151, 198, 175,
+	251, 39, 86, 148, 56, 196, 218, 185, 249, 207, 232, 189, 152, 162, 246, 73,
+	255, 246, 79, 121, 242, 101, 56, 143, 255, 250, 248, 255, 244, 254, 241, 255,
+	79, 255, 243, 254, 255, 243, 255, 63, 255, 255, 255, 88, 246, 243, 122, 97,
+	247, 63, 143, 254, 255, 167, 147, 248, 74, 175, 255, 255, 143, 154, 243, 70,
+	242, 111, 38, 127, 244, 248, 121, 243, 127, 87, 143, 255, 255, 134, 254, 243,
+	92, 40, 108, 245, 95, 143, 83, 86, 79, 52, 245, 101, 79, 245, 255, 247,
+	143, 127, 242, 248, 79, 255, 250, 111, 250, 243, 179, 111, 138, 255, 255, 249,
+	251, 241, 254, 243, 159, 41, 255, 246, 255, 255, 242, 246, 63, 255, 255, 255,
+	143, 243, 243, 151, 242, 137, 63, 255, 244, 86, 248, 85, 137, 67, 41, 249,
+	245, 247, 248, 245, 159, 242, 249, 63, 255, 242, 95, 255, 243, 117, 89, 127,
+	255, 255, 246, 255, 244, 114, 115, 69, 72, 95, 127, 68, 53, 103, 85, 119,
+	255, 127, 255, 255, 232, 111, 247, 241, 255, 95, 255, 127, 127, 127, 243, 243,
+	111, 255, 255, 255, 255, 255, 243, 234, 242, 245, 79, 255, 248, 103, 239, 243,
+	255, 47, 127, 255, 255, 127, 255, 243, 255, 247, 255, 15, 95, 244, 255, 255,
+	255, 255, 110, 255, 255, 255, 235, 252, 244, 254, 242, 255, 79, 247, 241, 111,
+	191, 244, 255, 111, 255, 255, 255, 255, 255, 253, 237, 98, 243, 79, 255, 242,
+	77, 207, 244, 244, 100, 255, 255, 255, 255, 255, 244, 249, 244, 255, 47, 255,
+	247, 255, 255, 241, 255, 91, 255, 255, 255, 255, 255, 247, 66, 137, 115, 183,
+	152, 175, 135, 103, 123, 118, 243, 187, 42, 251, 127, 75, 159, 83, 143, 246,
+	248, 42, 255, 100, 71, 119, 246, 114, 255, 138, 255, 255, 255, 255, 118, 255,
+	104, 242, 255, 143, 113, 99, 255, 245, 245, 255, 255, 255, 255, 255, 255, 86,
+	111, 84, 245, 87, 79, 85, 22, 111, 68, 70, 247, 255, 245, 255, 119, 255,
+	64, 139, 135, 167, 123, 175, 103, 87, 153, 118, 246, 91, 155, 252, 255, 255,
+	111, 96, 102, 119, 134, 143, 172, 102, 86, 120, 120, 135, 152, 171, 249, 175,
+	185, 184, 67, 105, 111, 245, 143, 111, 69, 50, 111, 83, 246, 246, 121, 255,
+	255, 255, 111, 167, 147, 183, 79, 159, 248, 55, 139, 161, 70, 75, 143, 255,
+	251, 207, 255, 245, 149, 146, 250, 37, 246, 243, 88, 74, 150, 87, 100, 255,
+	167, 249, 143, 255, 243, 118, 113, 150, 103, 250, 248, 111, 70, 162, 134, 70,
+	143, 255, 255, 255, 255, 245, 85, 243, 154, 87, 132, 246, 149, 86, 245, 82,
+	83, 127, 246, 255, 249, 155, 244, 99, 120, 101, 181, 102, 111, 84, 37, 103,
+	67, 149, 136, 134, 248, 191, 169, 189, 166, 242, 255, 26, 255, 244, 111, 143,
+	248, 143, 70, 255, 79, 255, 255, 255, 244, 100, 242, 162, 122, 175, 246, 183,
+	111, 243, 191, 63, 191, 255, 255, 248, 255, 244, 100, 121, 165, 196, 159, 255,
+	23, 86, 133, 71, 243, 249, 207, 250, 207, 247, 175, 83, 243, 199, 90, 191,
+	244, 102, 136, 147, 52, 53, 138, 169, 247, 248, 251, 244, 117, 131, 106, 57,
+	201, 245, 120, 184, 146, 159, 87, 153, 223, 255, 146, 200, 244, 68, 67, 152,
+	40, 255, 243, 169, 88, 85, 105, 88, 154, 186, 255, 204, 252, 243, 85, 164,
+	74, 99, 139, 243, 183, 43, 227, 92, 101, 173, 151, 250, 246, 207, 244, 49,
+	127, 124, 247, 239, 255, 103, 54, 111, 52, 247, 143, 127, 143, 127, 255, 111,
+	151, 242, 251, 127, 255, 241, 148, 185, 147, 132, 55, 175, 175, 255, 170, 255,
+	246, 101, 114, 72, 86, 159, 246, 118, 88, 148, 86, 100, 72, 171, 248, 216,
+	202, 243, 82, 148, 186, 95, 255, 245, 132, 70, 148, 90, 66, 255, 252, 248,
+	246, 246, 244, 116, 179, 201, 108, 251, 241, 117, 92, 179, 117, 87, 153, 169,
+	253, 200, 207, 245, 82, 132, 100, 101, 95, 127, 69, 56, 137, 83, 244, 121,
+	121, 247, 255, 136, 111, 85, 243, 86, 79, 255, 255, 111, 127, 243, 82, 70,
+	245, 255, 255, 248, 255, 242, 66, 179, 136, 103, 255, 245, 138, 135, 244, 101,
+	71, 255, 255, 250, 249, 255, 241, 152, 247, 175, 111, 255, 247, 255, 255, 248,
+	159, 163, 255, 255, 255, 69, 255, 240, 117, 243, 251, 31, 255, 244, 246, 123,
+	199, 127, 105, 191, 187, 255, 255, 255, 245, 68, 243, 135, 79, 255, 243, 132,
+	54, 243, 111, 67, 255, 143, 248, 255, 255, 245, 115, 127, 108, 255, 255, 255,
+	102, 95, 127, 135, 240, 255, 79, 255, 255, 239, 255, 66, 95, 99, 247, 255,
+	255, 69, 38, 88, 245, 101, 127, 255, 255, 255, 255, 255, 97, 255, 249, 255,
+	255, 255, 169, 131, 175, 168, 243, 175, 175, 255, 255, 255, 255, 99, 102, 99,
+	163, 88, 95, 68, 70, 135, 69, 149, 137, 104, 134, 127, 133, 91, 65, 127,
+	102, 246, 95, 143, 70, 54, 120, 84, 244, 248, 255, 255, 255, 255, 255, 100,
+	248, 255, 134, 255, 255, 255, 248, 143, 111, 255, 255, 255, 143, 255, 6, 255,
+	99, 103, 71, 134, 86, 47, 69, 54, 201, 84, 100, 104, 60, 248, 191, 151,
+	111, 102, 146, 168, 63, 190, 197, 54, 103, 195, 100, 58, 141, 155, 253, 217,
+	221, 243, 84, 146, 151, 68, 167, 242, 101, 72, 147, 89, 87, 127, 202, 251,
+	205, 236, 243, 100, 99, 118, 88, 237, 182, 88, 70, 162, 132, 55, 139, 189,
+	251, 202, 251, 243, 116, 115, 151, 73, 148, 245, 69, 73, 99, 101, 85, 140,
+	201, 249, 183, 203, 243, 132, 136, 159, 134, 40, 95, 70, 71, 185, 98, 245,
+	251, 183, 251, 255, 250, 175, 115, 98, 116, 116, 191, 214, 135, 52, 85, 119,
+	88, 234, 172, 247, 183, 233, 245, 113, 255, 246, 245, 255, 239, 105, 88, 255,
+	82, 242, 159, 245, 255, 255, 255, 255, 253, 243, 255, 239, 255, 241, 239, 255,
+	245, 238, 61, 255, 255, 255, 255, 255, 246, 104, 243, 255, 63, 255, 243, 255,
+	255, 242, 175, 175, 255, 255, 255, 88, 245, 242, 236, 230, 253, 15, 255, 252,
+	254, 255, 236, 255, 223, 255, 255, 255, 255, 255, 244, 254, 243, 239, 62, 255,
+	242, 255, 207, 242, 239, 94, 255, 255, 255, 255, 124, 243, 81, 119, 117, 167,
+	143, 143, 55, 70, 155, 99, 180, 121, 123, 255, 159, 249, 159, 134, 195, 250,
+	62, 239, 244, 120, 124, 130, 131, 71, 157, 172, 252, 172, 252, 243, 250, 241,
+	249, 73, 249, 245, 255, 143, 242, 255, 95, 255, 153, 255, 159, 249, 243, 254,
+	254, 127, 239, 255, 253, 126, 255, 226, 255, 117, 255, 255, 255, 240, 244, 254,
+	117, 179, 214, 78, 219, 242, 118, 89, 211, 115, 72, 171, 186, 251, 148, 216,
+	244, 117, 150, 100, 130, 137, 111, 53, 87, 250, 116, 177, 118, 255, 248, 127,
+	88, 143, 135, 241, 154, 92, 255, 187, 108, 168, 243, 148, 72, 248, 207, 255,
+	202, 253, 242, 82, 211, 168, 90, 255, 246, 154, 102, 195, 134, 72, 175, 207,
+	252, 185, 223, 242, 135, 182, 175, 63, 143, 244, 191, 207, 184, 175, 102, 191,
+	203, 255, 83, 244, 241, 117, 242, 253, 45, 247, 242, 151, 60, 198, 138, 90,
+	159, 155, 255, 255, 254, 244, 101, 195, 197, 47, 255, 242, 101, 72, 180, 135,
+	68, 204, 156, 252, 255, 250, 244, 49, 155, 134, 164, 109, 159, 132, 85, 153,
+	151, 149, 125, 184, 253, 175, 143, 223, 97, 191, 118, 245, 186, 175, 117, 99,
+	175, 118, 179, 159, 201, 252, 111, 252, 111, 100, 54, 87, 150, 168, 95, 37,
+	72, 135, 84, 178, 127, 154, 247, 255, 117, 159, 81, 250, 151, 249, 159, 255,
+	250, 153, 175, 137, 159, 250, 175, 255, 143, 98, 249, 83, 154, 104, 214, 150,
+	127, 88, 22, 170, 117, 146, 139, 73, 247, 159, 106, 143, 135, 241, 255, 46,
+	255, 252, 254, 239, 243, 255, 239, 255, 255, 255, 255, 255, 243, 236, 227, 254,
+	79, 255, 241, 223, 206, 243, 245, 95, 255, 255, 255, 255, 255, 243, 251, 241,
+	255, 47, 250, 255, 255, 255, 245, 249, 255, 255, 255, 255, 255, 255, 247, 99,
+	155, 154, 147, 122, 111, 70, 72, 202, 49, 199, 159, 167, 251, 191, 143, 255,
+	89, 253, 255, 36, 255, 241, 239, 79, 255, 255, 95, 255, 255, 255, 255, 255,
+	255, 116, 111, 163, 245, 79, 79, 66, 116, 111, 100, 245, 95, 111, 90, 255,
+	245, 255, 255, 240, 255, 255, 255, 245, 79, 175, 248, 251, 111, 255, 255, 255,
+	255, 255, 245, 255, 243, 255, 15, 255, 255, 255, 255, 250, 255, 255, 255, 255,
+	255, 73, 148, 248, 108, 235, 253, 207, 255, 242, 254, 255, 231, 255, 223, 255,
+	255, 255, 255, 255, 240, 152, 245, 143, 79, 255, 243, 255, 255, 243, 255, 63,
+	255, 255, 255, 69, 243, 242, 83, 171, 72, 243, 171, 159, 37, 101, 159, 82,
+	248, 159, 191, 255, 95, 122, 95, 254, 245, 255, 95, 255, 252, 63, 255, 241,
+	243, 223, 255, 39, 255, 255, 255, 245, 85, 243, 239, 63, 255, 242, 255, 238,
+	242, 239, 70, 111, 111, 254, 255, 247, 243, 250, 255, 255, 95, 255, 255, 151,
+	255, 255, 255, 241, 255, 255, 255, 115, 244, 243, 247, 252, 255, 79, 255, 249,
+	255, 159, 240, 244, 143, 255, 255, 255, 254, 255, 245, 82, 168, 241, 167, 89,
+	111, 117, 103, 255, 135, 168, 255, 191, 250, 95, 63, 175, 123, 247, 255, 239,
+	255, 255, 255, 127, 242, 127, 111, 255, 255, 255, 255, 255, 240, 115, 183, 166,
+	209, 153, 95, 86, 85, 175, 84, 245, 172, 121, 165, 255, 216, 207, 81, 117,
+	103, 117, 119, 255, 100, 102, 111, 111, 247, 119, 255, 255, 127, 246, 246, 66,
+	103, 118, 133, 127, 111, 40, 53, 118, 84, 100, 121, 169, 248, 111, 103, 111,
+	231, 241, 255, 47, 255, 253, 207, 255, 243, 231, 79, 255, 255, 255, 255, 255,
+	244, 253, 241, 255, 61, 255, 251, 254, 223, 245, 239, 111, 255, 255, 255, 255,
+	255, 241, 103, 225, 246, 52, 255, 254, 223, 206, 244, 252, 47, 95, 255, 255,
+	255, 255, 245, 99, 103, 118, 244, 127, 79, 55, 52, 117, 98, 245, 255, 159,
+	248, 255, 249, 255, 50, 255, 253, 255, 79, 47, 93, 116, 63, 206, 253, 63,
+	255, 255, 255, 255, 255, 100, 178, 199, 92, 207, 196, 89, 123, 146, 85, 68,
+	157, 198, 106, 202, 253, 244, 254, 243, 255, 79, 255, 243, 254, 255, 244, 143,
+	79, 255, 255, 255, 120, 243, 241, 236, 227, 253, 15, 255, 248, 254, 255, 236,
+	255, 223, 255, 255, 255, 255, 255, 247, 175, 242, 127, 143, 255, 254, 255, 239,
+	241, 255, 111, 255, 255, 255, 255, 254, 246, 81, 137, 151, 182, 159, 191, 58,
+	86, 201, 116, 151, 170, 175, 251, 95, 203, 159, 159, 145, 255, 79, 249, 246,
+	255, 255, 245, 143, 47, 255, 255, 255, 255, 255, 246, 117, 180, 185, 77, 255,
+	244, 85, 105, 85, 139, 66, 107, 249, 249, 179, 228, 244, 245, 242, 253, 111,
+	255, 241, 254, 207, 244, 245, 79, 95, 255, 255, 252, 246, 246, 83, 115, 117,
+	101, 127, 127, 79, 66, 138, 100, 150, 175, 159, 248, 255, 151, 111, 132, 106,
+	148, 167, 127, 111, 71, 87, 133, 20, 246, 250, 111, 249, 175, 151, 169, 65,
+	116, 134, 101, 255, 255, 150, 105, 102, 119, 137, 255, 143, 255, 255, 47, 245,
+	100, 136, 116, 248, 153, 143, 39, 38, 187, 132, 131, 127, 123, 250, 111, 89,
+	143, 248, 240, 255, 223, 255, 244, 223, 255, 253, 248, 95, 255, 255, 255, 255,
+	255, 249, 253, 243, 255, 78, 255, 246, 254, 143, 242, 255, 239, 255, 255, 255,
+	255, 255, 241, 83, 121, 136, 185, 159, 111, 83, 21, 134, 85, 183, 151, 170,
+	199, 255, 247, 191, 133, 162, 168, 25, 255, 244, 255, 250, 116, 171, 79, 143,
+	255, 249, 250, 184, 244, 67, 255, 133, 248, 90, 255, 246, 37, 255, 67, 242,
+	245, 152, 247, 255, 250, 255, 255, 242, 255, 159, 255, 243, 63, 255, 243, 243,
+	63, 255, 255, 255, 255, 255, 243, 175, 251, 255, 127, 255, 250, 255, 255, 249,
+	175, 191, 255, 255, 255, 255, 144, 247, 219, 213, 252, 111, 255, 251, 237, 111,
+	211, 255, 79, 255, 255, 255, 255, 255, 241, 249, 242, 255, 95, 255, 242, 255,
+	255, 242, 255, 111, 255, 255, 255, 148, 118, 243, 114, 105, 99, 180, 109, 191,
+	99, 83, 71, 70, 185, 201, 125, 251, 127, 188, 250, 255, 248, 255, 223, 255,
+	241, 255, 255, 241, 245, 143, 255, 255, 255, 255, 255, 254, 150, 243, 255, 31,
+	249, 248, 255, 255, 243, 250, 63, 175, 255, 255, 143, 250, 244, 133, 254, 247,
+	152, 255, 243, 249, 255, 246, 159, 50, 143, 255, 255, 241, 254, 255, 153, 254,
+	245, 255, 255, 247, 255, 255, 242, 241, 255, 255, 255, 255, 255, 255, 250, 66,
+	70, 99, 152, 165, 255, 55, 86, 138, 100, 150, 137, 170, 246, 175, 106, 159,
+	214, 242, 255, 95, 255, 243, 255, 239, 244, 254, 47, 255, 255, 255, 246, 255,
+	242, 33, 255, 255, 255, 255, 143, 246, 198, 245, 207, 246, 143, 255, 255, 111,
+	84, 127, 100, 99, 133, 248, 127, 79, 23, 71, 184, 103, 118, 170, 251, 249,
+	143, 133, 90, 65, 118, 103, 117, 121, 247, 101, 85, 102, 103, 85, 102, 255,
+	249, 255, 169, 245, 227, 111, 126, 254, 239, 127, 19, 39, 95, 229, 246, 127,
+	239, 255, 255, 255, 127, 245, 83, 255, 63, 255, 134, 79, 143, 131, 117, 24,
+	255, 255, 255, 255, 255, 245, 154, 164, 175, 83, 255, 242, 169, 111, 133, 135,
+	143, 255, 170, 249, 250, 255, 241, 133, 132, 120, 95, 255, 255, 73, 243, 245,
+	246, 85, 159, 255, 250, 255, 249, 241, 116, 52, 250, 41, 130, 245, 246, 57,
+	244, 104, 111, 249, 143, 255, 251, 255, 244, 152, 242, 255, 63, 246, 241, 255,
+	63, 255, 159, 89, 255, 255, 255, 255, 255, 244, 114, 131, 119, 70, 127, 248,
+	255, 118, 40, 248, 79, 249, 255, 255, 117, 255, 244, 65, 127, 134, 246, 175,
+	255, 102, 68, 101, 37, 244, 154, 133, 247, 255, 168, 255, 85, 181, 182, 111,
+	159, 181, 138, 156, 146, 54, 81, 255, 169, 255, 255, 255, 245, 101, 243, 153,
+	42, 255, 243, 89, 137, 244, 159, 87, 169, 171, 255, 130, 248, 243, 99, 66,
+	138, 58, 143, 243, 111, 90, 99, 138, 89, 255, 250, 249, 250, 255, 244, 133,
+	165, 108, 102, 143, 244, 169, 29, 242, 108, 99, 219, 153, 247, 165, 251, 245,
+	84, 53, 88, 244, 143, 255, 36, 94, 111, 135, 248, 111, 47, 255, 255, 255,
+	255, 150, 244, 255, 47, 255, 247, 152, 159, 83, 146, 170, 143, 159, 255, 255,
+	249, 242, 117, 115, 133, 23, 168, 214, 136, 103, 117, 72, 85, 104, 186, 244,
+	255, 252, 245, 100, 164, 250, 111, 255, 245, 133, 121, 52, 127, 34, 156, 252,
+	255, 246, 245, 245, 100, 244, 244, 79, 250, 244, 119, 111, 245, 81, 86, 175,
+	152, 255, 246, 251, 245, 82, 101, 99, 133, 120, 127, 85, 84, 89, 85, 148,
+	135, 107, 120, 127, 89, 124, 133, 243, 255, 63, 255, 255, 127, 255, 244, 247,
+	102, 248, 127, 255, 255, 255, 241, 101, 242, 247, 79, 255, 255, 95, 135, 242,
+	244, 85, 255, 127, 255, 255, 143, 242, 135, 250, 159, 143, 255, 243, 159, 255,
+	151, 159, 154, 255, 153, 255, 240, 255, 244, 247, 245, 255, 47, 255, 246, 104,
+	63, 255, 127, 25, 143, 79, 255, 255, 255, 245, 83, 247, 255, 95, 255, 243,
+	244, 216, 244, 255, 35, 249, 159, 255, 255, 255, 243, 18, 255, 99, 253, 255,
+	255, 243, 118, 255, 255, 254, 255, 255, 255, 255, 255, 255, 18, 120, 152, 168,
+	142, 205, 135, 136, 121, 121, 167, 169, 154, 234, 191, 135, 217, 84, 95, 149,
+	135, 143, 111, 86, 50, 137, 132, 98, 104, 255, 249, 111, 56, 143, 162, 143,
+	167, 250, 250, 143, 122, 25, 255, 52, 246, 170, 250, 250, 175, 255, 255, 253,
+	88, 134, 249, 137, 111, 119, 34, 159, 117, 242, 159, 149, 255, 255, 255, 255,
+	254, 253, 255, 239, 255, 240, 254, 255, 253, 255, 239, 255, 255, 255, 253, 253,
+	248, 83, 82, 181, 58, 190, 243, 118, 122, 99, 122, 73, 204, 156, 252, 203,
+	234, 243, 111, 241, 255, 111, 255, 244, 255, 255, 243, 255, 127, 255, 255, 255,
+	117, 116, 243, 99, 71, 101, 242, 143, 127, 115, 56, 239, 210, 110, 135, 255,
+	255, 255, 255, 255, 117, 131, 103, 39, 186, 227, 151, 102, 147, 104, 70, 106,
+	185, 246, 138, 245, 244, 99, 115, 243, 255, 247, 127, 85, 85, 79, 243, 243,
+	248, 159, 255, 127, 79, 255, 65, 117, 101, 252, 255, 79, 110, 79, 246, 215,
+	242, 255, 255, 245, 255, 118, 247, 65, 247, 247, 255, 79, 255, 255, 255, 127,
+	255, 255, 255, 255, 255, 255, 21, 255, 163, 91, 67, 246, 127, 111, 85, 53,
+	59, 86, 116, 74, 166, 247, 255, 140, 191, 255, 247, 255, 31, 255, 242, 79,
+	255, 246, 254, 111, 255, 255, 255, 255, 255, 242, 68, 242, 255, 95, 255, 242,
+	255, 255, 243, 255, 63, 255, 255, 255, 255, 255, 244, 253, 242, 255, 111, 255,
+	255, 95, 223, 241, 245, 127, 255, 255, 255, 255, 255, 244, 151, 246, 251, 159,
+	249, 255, 255, 255, 250, 250, 143, 255, 255, 255, 255, 250, 240, 244, 95, 142,
+	126, 255, 127, 69, 36, 255, 113, 104, 248, 255, 255, 255, 255, 255, 115, 255,
+	87, 247, 255, 223, 70, 61, 230, 214, 245, 230, 65, 255, 255, 255, 255, 253,
+	244, 255, 239, 255, 242, 79, 255, 241, 228, 45, 255, 254, 255, 255, 255, 245,
+	100, 147, 138, 74, 235, 244, 116, 169, 179, 173, 72, 171, 221, 254, 83, 179,
+	243, 119, 249, 255, 111, 255, 250, 255, 255, 166, 255, 175, 250, 255, 255, 255,
+	255, 240, 186, 240, 255, 143, 255, 246, 250, 255, 247, 255, 175, 255, 255, 255,
+	252, 247, 246, 133, 63, 242, 152, 255, 255, 85, 19, 255, 246, 248, 159, 255,
+	255, 143, 249, 255, 255, 244, 255, 47, 255, 254, 255, 255, 243, 253, 143, 255,
+	255, 255, 255, 255, 241, 93, 243, 255, 95, 255, 242, 255, 110, 241, 230, 78,
+	255, 255, 255, 255, 254, 243, 254, 247, 255, 127, 255, 253, 238, 255, 238, 255,
+	7, 255, 255, 255, 252, 253, 245, 82, 150, 242, 255, 255, 175, 56, 117, 55,
+	118, 153, 255, 255, 255, 111, 63, 255, 142, 252, 254, 191, 255, 240, 253, 223,
+	253, 255, 221, 255, 255, 255, 255, 255, 253, 120, 255, 255, 255, 255, 255, 240,
+	200, 246, 207, 255, 255, 255, 255, 255, 126, 255, 97, 54, 99, 135, 159, 79,
+	121, 85, 159, 148, 255, 143, 255, 255, 255, 244, 105, 80, 255, 248, 248, 159,
+	255, 169, 249, 170, 185, 185, 251, 186, 251, 175, 255, 255, 82, 88, 101, 165,
+	87, 79, 69, 52, 89, 84, 116, 105, 87, 200, 143, 104, 141, 255, 245, 245,
+	79, 255, 244, 120, 95, 244, 82, 47, 255, 127, 255, 255, 255, 244, 69, 243,
+	255, 47, 255, 245, 127, 63, 242, 111, 111, 255, 191, 248, 255, 255, 244, 102,
+	244, 255, 87, 255, 247, 95, 22, 244, 245, 63, 111, 255, 255, 255, 255, 246,
+	134, 145, 245, 111, 247, 244, 148, 127, 244, 255, 95, 255, 255, 243, 255, 255,
+	245, 117, 245, 255, 175, 255, 251, 199, 31, 253, 255, 111, 255, 47, 255, 255,
+	255, 253, 138, 244, 245, 255, 255, 246, 255, 15, 246, 153, 95, 255, 255, 255,
+	245, 255, 255, 64, 255, 255, 251, 255, 255, 252, 135, 248, 159, 247, 255, 255,
+	253, 255, 255, 255, 116, 243, 250, 127, 255, 244, 58, 143, 193, 172, 111, 255,
+	255, 255, 255, 255, 245, 152, 243, 186, 127, 255, 246, 177, 255, 245, 191, 57,
+	207, 204, 255, 131, 249, 246, 82, 179, 242, 111, 255, 243, 195, 223, 245, 159,
+	79, 255, 108, 251, 255, 255, 244, 99, 146, 106, 87, 255, 243, 246, 79, 244,
+	95, 68, 111, 137, 255, 247, 167, 245, 83, 88, 67, 181, 86, 143, 69, 68,
+	90, 67, 149, 153, 104, 184, 111, 170, 121, 98, 245, 255, 107, 255, 246, 123,
+	191, 162, 245, 35, 255, 251, 255, 255, 255, 246, 132, 242, 120, 42, 255, 244,
+	185, 139, 246, 111, 127, 255, 255, 249, 105, 249, 243, 100, 245, 250, 127, 207,
+	246, 68, 111, 148, 204, 65, 255, 255, 255, 247, 245, 245, 166, 243, 250, 111,
+	255, 241, 168, 182, 245, 136, 86, 255, 255, 255, 243, 248, 248, 170, 252, 255,
+	127, 255, 255, 255, 246, 254, 242, 245, 255, 255, 255, 255, 255, 240, 64, 255,
+	255, 191, 255, 255, 255, 175, 245, 255, 170, 255, 255, 255, 255, 255, 244, 255,
+	248, 255, 111, 255, 246, 255, 255, 255, 255, 255, 255, 255, 255, 68, 242, 241,
+	248, 243, 255, 79, 255, 244, 250, 31, 255, 255, 111, 255, 249, 255, 255, 255,
+	255, 246, 246, 243, 15, 255, 245, 246, 239, 248, 143, 134, 255, 255, 255, 255,
+	255, 247, 246, 242, 255, 31, 255, 244, 255, 255, 247, 255, 47, 255, 255, 255,
+	255, 255, 245, 198, 255, 240, 253, 255, 255, 253, 231, 255, 255, 254, 255, 255,
+	255, 255, 255, 255, 64, 120, 134, 246, 127, 255, 118, 102, 118, 127, 247, 120,
+	143, 249, 255, 247, 255, 236, 242, 255, 77, 255, 242, 237, 223, 245, 239, 111,
+	255, 255, 255, 255, 255, 241, 245, 244, 255, 31, 244, 247, 222, 223, 245, 247,
+	95, 255, 255, 255, 255, 255, 245, 84, 243, 255, 79, 255, 245, 111, 255, 241,
+	124, 76, 118, 254, 239, 255, 246, 245, 66, 242, 255, 127, 255, 244, 175, 255,
+	244, 251, 122, 255, 255, 255, 250, 250, 242, 124, 225, 254, 47, 255, 252, 255,
+	63, 243, 95, 111, 255, 255, 255, 255, 255, 246, 100, 243, 111, 72, 255, 242,
+	143, 223, 242, 95, 101, 255, 255, 255, 249, 244, 244, 83, 104, 36, 247, 143,
+	255, 100, 36, 159, 100, 117, 255, 249, 255, 255, 248, 249, 247, 248, 248, 127,
+	255, 250, 175, 95, 249, 175, 103, 255, 255, 255, 240, 255, 248, 84, 244, 255,
+	47, 255, 242, 159, 137, 244, 137, 121, 159, 255, 255, 248, 249, 242, 64, 103,
+	120, 135, 255, 255, 133, 117, 88, 103, 245, 136, 143, 248, 255, 102, 248, 65,
+	121, 136, 183, 55, 127, 88, 70, 138, 117, 131, 122, 151, 248, 159, 119, 157,
+	253, 241, 255, 46, 255, 252, 254, 239, 244, 255, 143, 255, 255, 255, 255, 255,
+	242, 82, 119, 135, 149, 127, 95, 71, 69, 119, 99, 131, 137, 58, 243, 255,
+	249, 255, 49, 255, 251, 246, 191, 47, 255, 100, 255, 119, 245, 95, 255, 252,
+	255, 191, 175, 136, 242, 255, 111, 255, 243, 255, 255, 247, 255, 143, 255, 255,
+	255, 26, 170, 245, 159, 244, 255, 47, 255, 246, 255, 223, 244, 255, 31, 255,
+	255, 255, 255, 134, 245, 102, 136, 99, 180, 166, 159, 88, 51, 105, 113, 151,
+	138, 156, 252, 111, 217, 143, 175, 242, 255, 63, 255, 242, 250, 255, 244, 255,
+	79, 255, 255, 250, 250, 255, 244, 83, 245, 248, 95, 255, 242, 152, 127, 68,
+	255, 66, 248, 255, 255, 244, 255, 244, 132, 245, 255, 143, 255, 243, 255, 31,
+	244, 166, 63, 255, 255, 255, 168, 255, 245, 65, 118, 147, 152, 159, 143, 102,
+	52, 120, 116, 134, 249, 155, 248, 159, 104, 105, 175, 255, 255, 143, 255, 248,
+	255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 240, 255, 248, 255, 223, 255,
+	255, 255, 255, 240, 255, 255, 255, 255, 255, 255, 255, 255, 114, 104, 147, 183,
+	143, 111, 40, 54, 120, 54, 150, 139, 107, 249, 255, 183, 186, 48, 134, 151,
+	117, 111, 246, 247, 137, 105, 105, 127, 120, 143, 247, 255, 159, 249, 66, 104,
+	100, 164, 156, 95, 118, 52, 103, 54, 101, 107, 153, 214, 173, 120, 159, 236,
+	98, 246, 79, 255, 255, 111, 223, 241, 86, 79, 255, 255, 255, 255, 255, 246,
+	99, 136, 102, 184, 115, 111, 100, 20, 135, 101, 135, 136, 159, 249, 255, 185,
+	159, 83, 143, 242, 255, 137, 111, 243, 85, 159, 127, 197, 111, 99, 242, 255,
+	255, 255, 248, 241, 255, 159, 255, 244, 175, 255, 242, 187, 95, 255, 255, 255,
+	255, 255, 249, 68, 242, 127, 63, 255, 253, 253, 127, 243, 127, 79, 255, 255,
+	247, 85, 253, 243, 101, 179, 91, 53, 158, 244, 182, 59, 195, 93, 85, 184,
+	168, 248, 134, 163, 244, 99, 137, 51, 184, 138, 191, 131, 68, 138, 39, 134,
+	137, 168, 247, 143, 207, 141, 68, 242, 110, 47, 255, 247, 254, 223, 244, 91,
+	111, 255, 255, 246, 246, 255, 243, 65, 101, 118, 135, 132, 143, 101, 86, 135,
+	118, 151, 137, 47, 246, 255, 168, 127, 68, 127, 119, 247, 159, 175, 243, 23,
+	132, 63, 244, 201, 152, 165, 159, 118, 255, 133, 127, 163, 246, 159, 159, 247,
+	127, 255, 111, 244, 255, 26, 255, 127, 95, 175, 96, 191, 186, 151, 175, 143,
+	202, 103, 251, 134, 197, 95, 197, 255, 143, 111, 255, 83, 119, 130, 163, 91,
+	95, 147, 86, 85, 88, 149, 152, 87, 248, 255, 134, 186, 97, 137, 143, 134,
+	175, 255, 249, 151, 127, 122, 159, 248, 250, 255, 255, 242, 255, 99, 151, 103,
+	166, 138, 111, 52, 38, 137, 84, 131, 121, 134, 246, 127, 57, 140, 135, 242,
+	247, 63, 255, 249, 63, 255, 243, 245, 63, 255, 255, 255, 250, 248, 243, 137,
+	246, 255, 107, 255, 254, 255, 255, 240, 250, 159, 255, 255, 255, 255, 255, 249,
+	85, 185, 138, 151, 163, 111, 103, 41, 249, 115, 178, 123, 134, 255, 255, 187,
+	175, 66, 207, 251, 255, 255, 79, 21, 149, 255, 186, 249, 127, 250, 250, 255,
+	255, 255, 170, 245, 255, 159, 255, 241, 255, 31, 244, 255, 63, 255, 255, 255,
+	255, 255, 247, 254, 244, 255, 15, 255, 253, 254, 255, 247, 255, 239, 255, 255,
+	255, 77, 243, 245, 248, 243, 255, 63, 255, 242, 255, 223, 242, 143, 142, 255,
+	255, 255, 255, 248, 243, 99, 152, 66, 164, 130, 159, 102, 71, 143, 85, 151,
+	153, 159, 251, 95, 186, 143, 85, 243, 255, 111, 255, 255, 88, 255, 241, 167,
+	71, 127, 255, 248, 255, 255, 244, 85, 244, 255, 87, 255, 253, 238, 143, 222,
+	255, 123, 255, 255, 255, 240, 253, 245, 81, 136, 131, 166, 111, 255, 71, 86,
+	251, 68, 245, 123, 175, 248, 111, 75, 143, 253, 240, 255, 175, 255, 250, 254,
+	175, 247, 255, 95, 255, 255, 255, 255, 255, 245, 100, 137, 119, 135, 101, 143,
+	103, 42, 186, 35, 196, 143, 89, 84, 207, 199, 191, 81, 101, 102, 101, 159,
+	255, 101, 100, 88, 104, 117, 86, 255, 248, 255, 152, 247, 66, 121, 102, 212,
+	75, 95, 69, 69, 105, 118, 133, 138, 56, 154, 159, 137, 174, 66, 98, 86,
+	87, 255, 169, 69, 119, 131, 103, 70, 121, 154, 249, 249, 255, 245, 83, 242,
+	184, 63, 132, 243, 249, 111, 180, 86, 79, 127, 255, 255, 185, 191, 243, 129,
+	137, 116, 182, 111, 143, 147, 68, 70, 102, 167, 187, 199, 250, 207, 247, 174,
+	245, 225, 252, 92, 255, 255, 127, 189, 228, 255, 63, 255, 255, 255, 245, 245,
+	242, 117, 255, 169, 255, 134, 31, 164, 163, 251, 255, 245, 47, 182, 159, 255,
+	255, 255, 151, 242, 247, 111, 255, 162, 159, 255, 147, 119, 70, 143, 242, 255,
+	248, 255, 244, 201, 244, 191, 143, 255, 245, 207, 156, 245, 255, 143, 255, 255,
+	255, 135, 160, 245, 65, 120, 51, 186, 137, 175, 167, 100, 158, 69, 167, 202,
+	123, 250, 111, 239, 95, 118, 246, 250, 111, 255, 248, 119, 255, 134, 250, 82,
+	175, 255, 255, 241, 249, 245, 83, 242, 251, 63, 251, 243, 143, 127, 245, 115,
+	95, 191, 159, 249, 183, 191, 244, 82, 118, 131, 137, 191, 175, 53, 101, 135,
+	119, 146, 182, 255, 175, 111, 73, 143, 246, 250, 255, 111, 255, 255, 31, 255,
+	241, 246, 111, 255, 255, 255, 255, 255, 244, 111, 244, 255, 63, 127, 249, 255,
+	255, 248, 255, 47, 255, 255, 255, 76, 243, 241, 253, 243, 255, 47, 245, 242,
+	255, 111, 100, 79, 47, 95, 255, 255, 255, 255, 245, 119, 244, 255, 63, 255,
+	241, 248, 223, 243, 255, 103, 255, 255, 255, 255, 255, 242, 66, 175, 255, 250,
+	175, 111, 151, 255, 242, 111, 248, 138, 152, 255, 111, 99, 95, 114, 255, 241,
+	255, 255, 159, 143, 127, 127, 111, 253, 255, 207, 255, 111, 47, 255, 32, 207,
+	252, 252, 191, 223, 204, 101, 255, 255, 247, 175, 255, 255, 175, 159, 255, 81,
+	152, 102, 200, 135, 79, 133, 100, 138, 74, 151, 105, 54, 246, 223, 133, 155,
+	81, 102, 119, 133, 79, 255, 118, 117, 88, 71, 118, 119, 135, 249, 255, 138,
+	247, 83, 103, 134, 136, 111, 239, 85, 37, 95, 99, 99, 68, 230, 255, 255,
+	247, 255, 68, 180, 137, 111, 255, 243, 52, 101, 243, 130, 73, 127, 121, 255,
+	250, 255, 245, 104, 243, 127, 76, 213, 242, 70, 79, 131, 139, 54, 175, 185,
+	249, 255, 255, 243, 100, 134, 250, 137, 255, 246, 127, 191, 241, 179, 95, 207,
+	255, 255, 191, 255, 245, 115, 195, 183, 90, 164, 243, 191, 59, 243, 102, 63,
+	175, 191, 250, 249, 248, 244, 165, 153, 255, 47, 255, 248, 47, 31, 255, 255,
+	95, 255, 255, 255, 255, 255, 255, 169, 100, 101, 129, 255, 245, 247, 67, 55,
+	150, 150, 248, 255, 244, 251, 255, 247, 99, 111, 118, 245, 127, 255, 117, 54,
+	100, 69, 241, 255, 136, 248, 255, 246, 255, 66, 242, 185, 95, 255, 246, 103,
+	156, 132, 99, 56, 191, 170, 249, 249, 255, 245, 99, 165, 139, 72, 203, 243,
+	120, 154, 162, 188, 72, 175, 187, 255, 99, 180, 243, 83, 99, 250, 79, 252,
+	242, 91, 138, 68, 123, 56, 253, 207, 255, 252, 252, 245, 83, 243, 56, 69,
+	159, 246, 181, 107, 148, 79, 52, 181, 153, 250, 247, 249, 244, 211, 207, 203,
+	245, 125, 255, 85, 52, 31, 83, 247, 255, 239, 255, 239, 255, 255, 136, 182,
+	255, 31, 255, 244, 123, 175, 179, 150, 53, 255, 248, 251, 255, 255, 244, 117,
+	164, 151, 39, 220, 242, 169, 100, 195, 104, 85, 187, 183, 203, 107, 245, 244,
+	102, 247, 250, 95, 255, 244, 86, 73, 149, 138, 98, 171, 255, 255, 183, 242,
+	245, 118, 244, 249, 63, 248, 245, 102, 95, 242, 114, 70, 175, 159, 249, 250,
+	247, 244, 66, 228, 86, 254, 255, 255, 36, 69, 70, 85, 243, 255, 245, 255,
+	255, 102, 255, 84, 242, 255, 111, 255, 255, 111, 255, 243, 243, 95, 245, 255,
+	255, 246, 255, 242, 114, 242, 120, 79, 255, 243, 143, 255, 243, 246, 85, 255,
+	255, 255, 255, 255, 243, 103, 255, 255, 15, 127, 247, 255, 255, 255, 255, 255,
+	255, 255, 255, 253, 248, 243, 135, 242, 255, 74, 255, 242, 245, 47, 246, 255,
+	143, 191, 251, 255, 255, 255, 242, 134, 246, 248, 63, 255, 244, 242, 239, 246,
+	143, 35, 255, 249, 255, 255, 255, 245, 48, 249, 250, 255, 143, 255, 250, 255,
+	255, 255, 248, 255, 239, 255, 255, 255, 255, 66, 255, 100, 245, 239, 111, 38,
+	69, 101, 53, 245, 111, 127, 255, 255, 255, 255, 117, 255, 82, 241, 255, 255,
+	243, 68, 255, 231, 251, 255, 255, 255, 239, 255, 239, 235, 254, 12, 244, 239,
+	239, 125, 85, 255, 116, 254, 255, 239, 255, 255, 254, 239, 96, 175, 246, 250,
+	255, 255, 152, 121, 159, 137, 247, 175, 175, 255, 255, 255, 255, 49, 255, 255,
+	255, 255, 255, 111, 245, 255, 111, 246, 255, 255, 255, 63, 51, 111, 101, 169,
+	136, 166, 63, 127, 84, 68, 89, 97, 134, 127, 122, 248, 159, 249, 143, 168,
+	220, 199, 216, 191, 143, 117, 105, 207, 128, 134, 159, 85, 249, 255, 207, 191,
+	116, 255, 169, 255, 255, 175, 139, 87, 255, 15, 244, 111, 159, 250, 255, 255,
+	255, 85, 242, 255, 239, 255, 243, 223, 255, 241, 125, 93, 255, 254, 255, 255,
+	255, 246, 253, 242, 255, 47, 255, 243, 253, 255, 244, 255, 111, 255, 255, 255,
+	69, 99, 243, 246, 243, 239, 94, 255, 241, 255, 207, 242, 239, 126, 255, 255,
+	255, 255, 247, 242, 151, 139, 146, 214, 75, 159, 85, 82, 79, 67, 180, 143,
+	95, 245, 175, 137, 207, 243, 251, 255, 63, 255, 252, 255, 255, 53, 107, 207,
+	255, 255, 255, 31, 255, 242, 155, 243, 255, 95, 255, 242, 255, 255, 241, 175,
+	173, 255, 255, 251, 255, 246, 247, 245, 244, 255, 31, 255, 252, 214, 239, 215,
+	255, 202, 255, 255, 255, 242, 252, 245, 99, 248, 255, 127, 255, 242, 255, 239,
+	241, 108, 79, 255, 255, 255, 253, 255, 243, 82, 53, 136, 105, 255, 127, 103,
+	87, 249, 36, 246, 187, 170, 55, 175, 168, 143, 166, 167, 162, 161, 79, 127,
+	86, 90, 187, 71, 183, 159, 153, 246, 111, 167, 127, 49, 86, 104, 101, 143,
+	143, 102, 118, 111, 101, 247, 246, 255, 249, 111, 116, 119, 83, 90, 100, 166,
+	70, 79, 85, 50, 89, 103, 132, 119, 133, 153, 175, 153, 127, 231, 242, 255,
+	47, 255, 253, 207, 255, 243, 56, 79, 127, 255, 255, 255, 255, 242, 153, 242,
+	255, 30, 255, 249, 255, 63, 244, 255, 127, 255, 255, 255, 255, 143, 244, 68,
+	244, 248, 95, 255, 246, 127, 255, 245, 247, 31, 255, 255, 255, 255, 255, 245,
+	132, 243, 255, 79, 243, 243, 120, 152, 244, 56, 79, 111, 255, 246, 103, 255,
+	243, 134, 87, 68, 243, 84, 111, 83, 69, 102, 54, 245, 103, 150, 247, 175,
+	138, 188, 83, 95, 133, 245, 76, 127, 149, 83, 79, 41, 211, 135, 139, 247,
+	255, 191, 255, 116, 242, 246, 95, 255, 242, 95, 101, 244, 110, 54, 111, 255,
+	245, 143, 255, 243, 230, 97, 255, 63, 255, 247, 252, 247, 99, 127, 95, 255,
+	255, 255, 214, 252, 242, 118, 128, 255, 95, 255, 247, 143, 249, 245, 143, 95,
+	255, 255, 255, 255, 255, 243, 117, 242, 127, 57, 255, 243, 255, 153, 242, 159,
+	71, 255, 255, 255, 245, 249, 243, 116, 57, 68, 183, 38, 111, 85, 84, 90,
+	89, 165, 152, 101, 153, 127, 172, 134, 246, 241, 255, 95, 255, 252, 255, 127,
+	245, 242, 79, 255, 255, 255, 255, 255, 245, 85, 241, 118, 63, 255, 247, 119,
+	127, 84, 246, 79, 143, 255, 255, 255, 255, 243, 118, 166, 248, 127, 255, 245,
+	247, 249, 245, 249, 101, 255, 255, 255, 241, 255, 241, 85, 243, 247, 79, 255,
+	242, 116, 63, 244, 106, 47, 154, 248, 255, 249, 255, 245, 99, 118, 67, 167,
+	121, 175, 146, 68, 58, 104, 150, 90, 106, 246, 143, 91, 143, 134, 245, 248,
+	127, 255, 255, 255, 47, 246, 246, 143, 159, 255, 255, 255, 255, 240, 255, 246,
+	255, 63, 255, 253, 255, 255, 246, 255, 238, 255, 255, 255, 91, 243, 241, 246,
+	244, 255, 31, 255, 242, 247, 255, 244, 168, 58, 255, 255, 255, 255, 255, 245,
+	214, 255, 241, 255, 255, 255, 143, 127, 255, 119, 252, 255, 191, 255, 95, 47,
+	255, 151, 255, 249, 240, 159, 255, 249, 116, 159, 255, 245, 159, 255, 250, 143,
+	143, 255, 83, 69, 82, 151, 73, 95, 85, 70, 118, 104, 134, 184, 136, 244,
+	159, 116, 127, 81, 116, 134, 117, 120, 255, 102, 86, 86, 69, 133, 134, 249,
+	248, 255, 246, 248, 83, 85, 118, 151, 175, 127, 69, 35, 56, 100, 100, 103,
+	169, 249, 159, 168, 127, 236, 242, 255, 44, 255, 250, 237, 207, 242, 223, 223,
+	255, 255, 255, 255, 244, 242, 117, 102, 68, 167, 154, 111, 68, 51, 127, 113,
+	149, 169, 191, 255, 255, 255, 255, 100, 143, 69, 249, 255, 255, 55, 65, 143,
+	55, 247, 204, 89, 255, 255, 255, 255, 134, 242, 248, 111, 255, 244, 95, 255,
+	242, 115, 63, 175, 255, 255, 250, 255, 244, 151, 243, 255, 95, 255, 248, 255,
+	255, 242, 250, 95, 255, 255, 255, 106, 243, 242, 123, 209, 252, 79, 255, 251,
+	253, 239, 229, 255, 111, 255, 255, 255, 255, 255, 242, 255, 245, 159, 63, 255,
+	242, 255, 239, 241, 255, 47, 255, 255, 255, 127, 250, 244, 101, 71, 98, 250,
+	255, 255, 66, 68, 121, 131, 118, 168, 134, 255, 95, 247, 159, 255, 165, 255,
+	63, 191, 242, 127, 255, 243, 242, 63, 255, 255, 255, 255, 255, 243, 68, 241,
+	255, 63, 255, 245, 238, 239, 212, 255, 216, 255, 255, 255, 245, 253, 243, 150,
+	242, 244, 79, 239, 243, 216, 138, 211, 163, 79, 203, 239, 255, 132, 248, 244,
+	66, 102, 129, 134, 255, 207, 103, 83, 123, 117, 149, 165, 143, 255, 159, 123,
+	159, 156, 253, 249, 63, 255, 255, 255, 255, 243, 245, 255, 255, 255, 255, 255,
+	255, 240, 255, 254, 255, 31, 255, 252, 255, 255, 255, 255, 238, 255, 255, 255,
+	211, 241, 243, 166, 255, 255, 255, 255, 159, 240, 249, 248, 255, 255, 255, 255,
+	255, 175, 123, 255, 80, 255, 127, 255, 251, 255, 252, 143, 255, 255, 247, 255,
+	152, 255, 255, 255, 255, 82, 86, 115, 182, 255, 79, 86, 69, 119, 86, 136,
+	90, 159, 249, 95, 115, 58, 65, 103, 102, 84, 152, 255, 86, 69, 87, 89,
+	245, 118, 127, 255, 143, 137, 248, 83, 73, 118, 214, 165, 95, 52, 37, 137,
+	116, 116, 121, 104, 247, 175, 121, 137, 250, 245, 255, 95, 255, 248, 255, 255,
+	240, 255, 255, 255, 255, 255, 255, 255, 245, 67, 137, 104, 201, 135, 95, 98,
+	83, 72, 83, 150, 138, 163, 249, 255, 255, 255, 81, 159, 165, 252, 202, 127,
+	119, 101, 79, 89, 245, 149, 90, 255, 255, 255, 255, 255, 243, 255, 111, 255,
+	242, 255, 255, 161, 255, 63, 159, 255, 255, 255, 255, 245, 109, 240, 255, 95,
+	255, 248, 254, 255, 246, 255, 143, 255, 255, 255, 229, 245, 244, 81, 211, 252,
+	111, 255, 247, 237, 239, 212, 255, 47, 255, 255, 255, 255, 255, 244, 250, 243,
+	175, 63, 255, 241, 255, 255, 243, 175, 127, 255, 255, 255, 181, 151, 243, 99,
+	122, 82, 247, 187, 159, 100, 68, 139, 98, 150, 153, 74, 139, 143, 250, 153,
+	83, 195, 255, 95, 220, 242, 255, 175, 195, 255, 60, 255, 255, 252, 249, 251,
+	243, 244, 243, 133, 87, 255, 248, 136, 248, 116, 255, 91, 159, 255, 255, 241,
+	253, 244, 133, 242, 255, 95, 255, 247, 143, 239, 243, 87, 111, 255, 255, 255,
+	103, 130, 243, 82, 133, 98, 200, 191, 143, 118, 86, 57, 99, 181, 175, 154,
+	250, 159, 123, 159, 81, 255, 255, 255, 255, 255, 248, 250, 249, 28, 250, 255,
+	255, 255, 191, 118, 207, 49, 95, 107, 255, 255, 255, 254, 86, 111, 243, 245,
+	255, 175, 255, 255, 207, 111, 65, 255, 62, 253, 255, 255, 252, 51, 255, 255,
+	114, 143, 255, 255, 255, 255, 255, 65, 135, 114, 151, 159, 95, 85, 69, 137,
+	134, 167, 154, 154, 249, 255, 134, 154, 96, 120, 101, 135, 175, 255, 151, 102,
+	127, 105, 119, 138, 159, 249, 255, 248, 250, 66, 143, 118, 246, 143, 111, 69,
+	37, 127, 83, 101, 106, 135, 247, 255, 152, 143, 120, 115, 255, 79, 255, 247,
+	31, 248, 246, 103, 86, 255, 255, 255, 136, 255, 244, 133, 208, 255, 127, 255,
+	250, 207, 255, 248, 255, 111, 255, 255, 255, 255, 255, 245, 98, 114, 133, 79,
+	255, 132, 95, 127, 243, 249, 63, 143, 255, 255, 255, 255, 246, 118, 132, 249,
+	47, 115, 246, 255, 135, 243, 121, 72, 127, 255, 255, 242, 255, 245, 83, 63,
+	116, 246, 126, 79, 54, 55, 239, 83, 101, 143, 247, 255, 127, 255, 255, 247,
+	44, 255, 23, 255, 244, 210, 95, 245, 255, 95, 255, 255, 255, 255, 255, 253,
+	246, 53, 61, 86, 255, 244, 63, 200, 244, 255, 111, 255, 255, 255, 242, 136,
+	244, 52, 95, 79, 254, 255, 255, 191, 101, 244, 87, 113, 255, 127, 244, 111,
+	245, 247, 100, 243, 246, 107, 255, 248, 151, 152, 117, 102, 52, 175, 241, 250,
+	255, 255, 245, 101, 147, 120, 88, 255, 246, 104, 150, 163, 191, 71, 185, 191,
+	255, 114, 243, 243, 100, 67, 170, 25, 159, 246, 138, 137, 115, 121, 87, 170,
+	191, 250, 250, 255, 243, 84, 179, 57, 83, 159, 247, 162, 152, 149, 95, 86,
+	159, 136, 250, 246, 255, 244, 99, 147, 249, 89, 255, 242, 127, 63, 148, 121,
+	63, 159, 255, 255, 249, 255, 244, 116, 115, 91, 69, 143, 164, 134, 70, 246,
+	54, 54, 139, 159, 249, 250, 247, 243, 101, 244, 159, 111, 255, 247, 130, 143,
+	68, 111, 66, 255, 255, 255, 165, 255, 243, 100, 132, 169, 111, 255, 241, 123,
+	89, 245, 99, 87, 175, 154, 250, 164, 255, 245, 101, 246, 255, 47, 255, 255,
+	255, 255, 242, 245, 127, 247, 255, 255, 255, 255, 241, 229, 243, 246, 111, 255,
+	255, 255, 127, 241, 111, 79, 255, 255, 255, 255, 255, 243, 85, 242, 255, 47,
+	247, 242, 255, 79, 246, 255, 255, 255, 255, 255, 255, 249, 245, 117, 244, 247,
+	47, 255, 243, 227, 207, 246, 111, 67, 255, 248, 255, 255, 255, 243, 255, 246,
+	255, 15, 255, 255, 255, 255, 250, 255, 239, 255, 255, 255, 255, 255, 245, 116,
+	246, 119, 255, 255, 255, 247, 247, 255, 254, 240, 255, 63, 255, 255, 223, 255,
+	81, 255, 255, 255, 255, 255, 255, 147, 255, 255, 242, 255, 255, 255, 255, 255,
+	255, 66, 87, 102, 101, 87, 255, 68, 69, 246, 69, 243, 111, 127, 255, 255,
+	255, 255, 182, 249, 152, 186, 207, 15, 104, 104, 255, 134, 183, 159, 255, 255,
+	191, 187, 159, 101, 246, 238, 243, 255, 63, 67, 102, 255, 81, 245, 135, 255,
+	255, 255, 255, 127, 252, 243, 255, 95, 255, 252, 253, 255, 244, 255, 223, 255,
+	255, 255, 214, 252, 240, 116, 248, 169, 249, 255, 159, 106, 71, 255, 240, 166,
+	250, 255, 255, 255, 248, 255, 86, 241, 255, 111, 255, 243, 255, 255, 242, 255,
+	47, 255, 255, 255, 255, 255, 244, 133, 255, 72, 134, 255, 255, 54, 23, 248,
+	132, 132, 143, 255, 255, 143, 255, 255, 134, 249, 106, 182, 127, 255, 65, 74,
+	166, 120, 248, 255, 71, 255, 255, 167, 159, 64, 111, 111, 143, 255, 255, 255,
+	143, 127, 135, 248, 247, 247, 255, 255, 143, 255, 83, 103, 118, 149, 127, 79,
+	68, 51, 119, 99, 84, 120, 143, 248, 175, 247, 127, 83, 103, 246, 246, 246,
+	79, 86, 66, 255, 116, 100, 127, 255, 242, 255, 255, 255, 84, 70, 253, 255,
+	127, 191, 44, 91, 223, 46, 252, 222, 239, 47, 255, 255, 255, 245, 251, 239,
+	182, 255, 252, 255, 207, 246, 239, 93, 255, 255, 255, 98, 65, 242, 100, 119,
+	243, 242, 136, 127, 87, 67, 88, 84, 117, 152, 79, 248, 255, 247, 159, 93,
+	243, 239, 31, 255, 251, 255, 238, 98, 239, 77, 239, 255, 254, 255, 247, 244,
+	83, 115, 131, 86, 127, 95, 69, 51, 104, 133, 246, 255, 247, 246, 127, 248,
+	95, 117, 170, 131, 161, 255, 175, 104, 87, 170, 134, 243, 255, 175, 251, 175,
+	168, 143, 65, 111, 229, 247, 223, 223, 78, 93, 239, 99, 244, 95, 223, 255,
+	255, 239, 255, 99, 255, 117, 246, 111, 63, 121, 37, 175, 38, 249, 255, 159,
+	255, 143, 255, 255, 248, 255, 94, 246, 127, 223, 83, 68, 255, 216, 246, 65,
+	255, 255, 255, 255, 255, 236, 250, 247, 15, 255, 250, 254, 207, 251, 251, 207,
+	255, 255, 255, 252, 255, 252, 215, 237, 91, 253, 15, 255, 198, 198, 223, 220,
+	252, 255, 239, 255, 255, 223, 255, 99, 255, 255, 255, 255, 255, 241, 255, 242,
+	255, 255, 255, 255, 255, 255, 255, 255, 113, 255, 99, 255, 243, 255, 255, 127,
+	255, 247, 252, 255, 191, 255, 95, 47, 255, 65, 255, 255, 254, 255, 255, 254,
+	84, 255, 255, 243, 111, 255, 255, 255, 255, 255, 99, 181, 246, 255, 255, 63,
+	79, 143, 247, 143, 255, 255, 255, 255, 79, 83, 47, 66, 143, 136, 247, 175,
+	79, 119, 102, 143, 24, 131, 255, 138, 251, 143, 74, 175, 117, 255, 199, 250,
+	191, 255, 135, 5, 159, 100, 182, 139, 159, 249, 255, 255, 255, 147, 152, 135,
+	255, 255, 111, 84, 39, 143, 40, 161, 155, 127, 122, 191, 169, 191, 236, 242,
+	255, 111, 255, 242, 223, 255, 242, 221, 60, 255, 254, 239, 255, 255, 252, 159,
+	242, 255, 79, 255, 242, 255, 255, 242, 255, 95, 255, 255, 255, 255, 251, 243,
+	68, 116, 35, 120, 223, 255, 67, 55, 111, 99, 244, 255, 143, 255, 127, 255,
+	127, 101, 113, 243, 255, 255, 127, 116, 85, 127, 117, 102, 127, 127, 255, 143,
+	111, 255, 51, 247, 130, 254, 255, 255, 129, 103, 159, 148, 247, 255, 249, 255,
+	255, 255, 255, 97, 103, 246, 102, 255, 255, 244, 255, 239, 95, 247, 246, 255,
+	243, 255, 255, 255, 67, 39, 246, 246, 255, 127, 69, 52, 143, 116, 118, 88,
+	255, 255, 143, 104, 95, 236, 245, 255, 45, 255, 241, 237, 223, 252, 239, 223,
+	255, 255, 255, 255, 255, 246, 81, 159, 153, 159, 255, 143, 119, 23, 255, 246,
+	135, 121, 255, 248, 143, 255, 255, 246, 143, 149, 255, 255, 63, 71, 67, 143,
+	130, 244, 83, 122, 255, 255, 255, 255, 246, 243, 255, 79, 255, 244, 239, 255,
+	241, 238, 93, 255, 255, 255, 255, 255, 245, 236, 245, 255, 111, 255, 246, 252,
+	255, 245, 255, 207, 255, 255, 255, 107, 240, 245, 255, 244, 255, 143, 255, 247,
+	255, 223, 243, 255, 142, 255, 255, 255, 99, 113, 243, 87, 239, 34, 135, 239,
+	143, 101, 68, 95, 134, 132, 255, 111, 247, 79, 255, 63, 151, 243, 255, 31,
+	255, 244, 111, 239, 243, 150, 47, 255, 255, 255, 246, 255, 245, 82, 102, 130,
+	255, 255, 95, 98, 101, 249, 255, 248, 143, 248, 247, 111, 63, 255, 49, 118,
+	116, 247, 255, 95, 110, 101, 247, 39, 247, 255, 255, 255, 255, 118, 255, 65,
+	223, 229, 243, 223, 95, 205, 92, 223, 220, 244, 95, 223, 255, 127, 127, 255,
+	98, 255, 255, 255, 255, 255, 254, 9, 255, 237, 255, 255, 255, 255, 255, 255,
+	255, 113, 63, 175, 242, 255, 159, 255, 251, 255, 127, 251, 255, 255, 255, 255,
+	255, 255, 81, 69, 102, 101, 247, 255, 117, 100, 105, 87, 135, 87, 127, 246,
+	127, 244, 248, 251, 240, 255, 127, 255, 243, 255, 255, 245, 255, 159, 255, 255,
+	255, 255, 255, 244, 187, 242, 255, 79, 255, 241, 255, 255, 242, 175, 95, 255,
+	255, 248, 143, 251, 243, 100, 135, 34, 250, 143, 159, 103, 83, 121, 101, 135,
+	103, 249, 255, 111, 137, 71, 249, 170, 250, 191, 255, 255, 248, 255, 250, 255,
+	168, 175, 255, 255, 242, 240, 247, 70, 242, 255, 47, 255, 244, 255, 239, 245,
+	83, 111, 127, 255, 255, 253, 255, 245, 133, 245, 254, 31, 255, 242, 237, 223,
+	244, 255, 119, 255, 255, 255, 255, 246, 244, 66, 104, 69, 248, 255, 143, 85,
+	36, 118, 84, 102, 127, 255, 255, 255, 255, 255, 66, 255, 102, 245, 246, 111,
+	103, 52, 127, 82, 101, 111, 255, 255, 255, 247, 255, 80, 127, 127, 247, 255,
+	127, 248, 119, 127, 246, 255, 255, 255, 255, 255, 255, 255, 247, 240, 255, 127,
+	255, 253, 255, 255, 254, 159, 255, 255, 255, 255, 255, 255, 254, 225, 99, 239,
+	103, 255, 246, 245, 231, 246, 102, 71, 239, 255, 246, 255, 253, 243, 135, 246,
+	255, 95, 255, 249, 95, 63, 247, 141, 239, 255, 255, 255, 112, 255, 249, 82,
+	242, 255, 63, 255, 244, 255, 111, 245, 255, 143, 255, 255, 255, 255, 255, 242,
+	97, 255, 255, 254, 255, 255, 254, 242, 255, 255, 243, 255, 255, 255, 255, 255,
+	255, 96, 137, 150, 169, 159, 255, 152, 184, 154, 138, 249, 153, 175, 255, 255,
+	255, 255, 118, 243, 255, 126, 255, 245, 31, 47, 253, 127, 111, 255, 255, 255,
+	255, 255, 245, 100, 227, 102, 223, 255, 254, 127, 62, 241, 92, 54, 255, 255,
+	255, 255, 255, 246, 150, 247, 255, 143, 153, 249, 241, 127, 242, 244, 127, 255,
+	255, 255, 255, 255, 247, 119, 130, 125, 253, 255, 247, 241, 77, 246, 255, 63,
+	255, 246, 255, 255, 255, 246, 146, 245, 250, 111, 255, 243, 255, 255, 244, 159,
+	95, 191, 255, 31, 250, 255, 243, 229, 242, 255, 95, 255, 247, 85, 255, 244,
+	111, 99, 255, 255, 255, 212, 251, 241, 65, 100, 247, 104, 255, 242, 255, 143,
+	101, 255, 95, 255, 249, 255, 255, 255, 247, 67, 244, 56, 84, 143, 246, 244,
+	54, 244, 63, 111, 143, 247, 248, 132, 152, 245, 68, 115, 245, 67, 255, 251,
+	111, 46, 244, 102, 86, 255, 255, 255, 255, 254, 244, 245, 246, 255, 127, 138,
+	242, 243, 106, 244, 110, 134, 255, 248, 255, 243, 255, 242, 49, 244, 255, 127,
+	255, 246, 247, 239, 244, 247, 55, 255, 255, 255, 255, 255, 245, 255, 253, 255,
+	175, 255, 252, 255, 255, 255, 255, 238, 255, 255, 255, 213, 244, 240, 80, 255,
+	255, 246, 255, 255, 246, 95, 101, 255, 255, 255, 255, 255, 255, 255, 247, 253,
+	247, 255, 207, 247, 246, 222, 8, 236, 246, 238, 255, 255, 255, 255, 255, 246,
+	246, 246, 255, 127, 255, 253, 239, 255, 247, 110, 96, 255, 255, 255, 255, 255,
+	253, 117, 120, 255, 88, 255, 253, 255, 63, 240, 136, 152, 255, 255, 255, 255,
+	255, 248, 67, 84, 79, 84, 95, 251, 246, 63, 251, 111, 210, 246, 255, 255,
+	247, 251, 244, 99, 242, 231, 79, 255, 246, 255, 110, 243, 98, 94, 255, 255,
+	254, 255, 254, 244, 152, 249, 255, 79, 255, 253, 255, 111, 254, 254, 255, 249,
+	255, 255, 240, 255, 249, 96, 102, 119, 119, 175, 255, 102, 119, 102, 89, 135,
+	152, 159, 248, 143, 159, 152, 133, 127, 56, 159, 159, 175, 55, 38, 39, 102,
+	117, 248, 248, 255, 255, 249, 143, 83, 116, 249, 63, 250, 248, 47, 47, 245,
+	131, 95, 255, 255, 255, 255, 255, 244, 49, 197, 249, 99, 251, 248, 201, 63,
+	135, 105, 93, 207, 255, 253, 255, 255, 246, 117, 114, 104, 55, 255, 250, 255,
+	31, 246, 117, 71, 175, 255, 255, 255, 255, 245, 99, 117, 136, 71, 198, 250,
+	116, 39, 51, 87, 131, 156, 223, 252, 248, 223, 247, 241, 246, 255, 79, 255,
+	248, 212, 24, 245, 255, 223, 255, 255, 255, 255, 255, 245, 146, 243, 250, 105,
+	255, 247, 159, 39, 244, 247, 79, 255, 255, 255, 246, 255, 246, 65, 255, 255,
+	249, 255, 255, 165, 58, 246, 31, 167, 255, 255, 248, 255, 250, 255, 100, 161,
+	168, 122, 255, 168, 152, 105, 148, 56, 52, 175, 255, 169, 249, 255, 246, 115,
+	164, 155, 73, 255, 244, 117, 154, 181, 143, 57, 203, 251, 255, 98, 166, 243,
+	51, 67, 249, 63, 255, 245, 131, 105, 69, 167, 105, 255, 255, 255, 255, 255,
+	244, 100, 180, 74, 67, 159, 244, 148, 74, 165, 58, 101, 181, 117, 245, 101,
+	248, 244, 83, 127, 157, 246, 127, 143, 102, 40, 95, 83, 114, 111, 255, 255,
+	255, 255, 255, 131, 243, 255, 79, 255, 242, 247, 255, 53, 101, 56, 255, 255,
+	247, 255, 255, 243, 66, 148, 120, 88, 154, 244, 100, 53, 245, 103, 69, 143,
+	246, 250, 169, 245, 244, 133, 165, 159, 127, 255, 250, 55, 58, 119, 127, 113,
+	186, 245, 255, 248, 168, 245, 100, 244, 175, 47, 248, 246, 116, 95, 242, 103,
+	86, 175, 247, 250, 243, 255, 244, 67, 84, 230, 66, 255, 255, 52, 76, 127,
+	86, 101, 255, 95, 244, 255, 223, 95, 81, 243, 255, 63, 255, 255, 255, 111,
+	246, 255, 102, 255, 255, 255, 255, 255, 244, 247, 114, 255, 47, 255, 253, 255,
+	127, 255, 127, 255, 255, 255, 255, 228, 247, 242, 166, 247, 255, 95, 255, 244,
+	247, 9, 245, 143, 95, 175, 250, 255, 255, 255, 246, 69, 244, 255, 79, 255,
+	244, 134, 24, 246, 105, 82, 255, 143, 255, 255, 255, 244, 255, 244, 255, 15,
+	255, 255, 255, 255, 249, 255, 79, 255, 255, 255, 255, 255, 255, 65, 255, 130,
+	255, 255, 255, 255, 255, 255, 255, 249, 255, 207, 255, 127, 111, 255, 33, 250,
+	170, 169, 255, 255, 135, 101, 175, 168, 248, 127, 255, 255, 175, 255, 255, 131,
+	127, 118, 247, 255, 255, 86, 54, 127, 99, 247, 255, 247, 255, 47, 255, 47,
+	48, 255, 248, 250, 255, 255, 250, 143, 175, 249, 255, 255, 255, 255, 255, 255,
+	255, 112, 111, 255, 245, 143, 255, 119, 118, 247, 104, 246, 255, 255, 255, 127,
+	247, 255, 67, 66, 55, 100, 255, 247, 254, 111, 251, 63, 85, 111, 255, 255,
+	244, 251, 244,
+};
+
+static const UTF16 kLettersDe [30] =
+{
+	0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C,
+	0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+	0x0079, 0x007A, 0x00DF, 0x00E4, 0x00F6, 0x00FC,
+};
+
+static const uint16_t kContextsDe [1024] =
+{
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	0, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+	47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 28, 59, 60, 61,
+	0, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+	77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 28, 59, 60, 61,
+	0, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+	104, 105, 79, 106, 107, 108, 109, 110, 111, 112, 113, 114, 28, 115, 60, 61,
+	0, 116, 117, 118, 119, 93, 120, 95, 121, 122, 123, 124, 125, 126, 127, 103,
+	128, 129, 79, 130, 131, 132, 133, 110, 134, 112, 135, 114, 28, 59, 60, 61,
+	0, 136, 137, 138, 92, 139, 140, 95, 141, 142, 143, 144, 100, 145, 146, 147,
+	148, 149, 79, 150, 151, 152, 153, 110, 154, 112, 135, 114, 28, 59, 60, 61,
+	0, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 124, 165, 166, 167, 168,
+	169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 61,
+	0, 184, 185, 118, 92, 93, 186, 187, 188, 189, 190, 124, 100, 191, 127, 192,
+	193, 105, 79, 194, 195, 196, 197, 110, 134, 112, 135, 198, 28, 199, 60, 200,
+	0, 201, 202, 203, 92, 93, 204, 95, 205, 206, 207, 124, 208, 209, 127, 210,
+	211, 212, 79, 213, 214, 215, 216, 110, 217, 112, 135, 114, 28, 59, 60, 218,
+	0, 219, 220, 221, 92, 93, 222, 95, 121, 189, 223, 124, 100, 224, 225, 226,
+	227, 105, 79, 228, 229, 230, 231, 110, 232, 112, 135, 114, 28, 233, 234, 61,
+	0, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249,
+	250, 251, 79, 252, 253, 254, 255, 256, 257, 258, 259, 260, 28, 59, 60, 61,
+	0, 261, 262, 118, 92, 93, 263, 95, 121, 189, 264, 124, 100, 265, 127, 103,
+	266, 105, 79, 267, 268, 152, 269, 110, 134, 112, 135, 114, 28, 59, 60, 61,
+	0, 270, 271, 118, 92, 272, 273, 95, 274, 275, 276, 124, 100, 277, 127, 278,
+	279, 280, 79, 281, 282, 283, 284, 110, 285, 112, 135, 286, 28, 59, 287, 61,
+	0, 288, 289, 290, 291, 292, 293, 294, 295, 189, 296, 124, 297, 298, 299, 300,
+	301, 302, 79, 267, 303, 304, 305, 306, 307, 112, 308, 114, 28, 309, 310, 311,
+	0, 312, 313, 314, 92, 93, 315, 95, 316, 189, 317, 124, 100, 318, 319, 320,
+	321, 322, 79, 267, 323, 324, 325, 110, 134, 112, 135, 114, 28, 326, 327, 328,
+	0, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343,
+	344, 345, 79, 346, 347, 348, 349, 350, 351, 112, 352, 353, 28, 354, 355, 356,
+	0, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371,
+	372, 373, 79, 374, 375, 376, 377, 378, 379, 112, 380, 381, 382, 59, 60, 61,
+	0, 383, 384, 118, 385, 93, 386, 387, 388, 389, 390, 124, 391, 392, 127, 103,
+	393, 394, 79, 395, 396, 397, 398, 110, 134, 112, 135, 114, 28, 59, 60, 61,
+	0, 399, 400, 118, 92, 93, 362, 95, 121, 189, 401, 124, 100, 265, 127, 103,
+	402, 105, 79, 267, 268, 152, 403, 110, 134, 112, 135, 114, 28, 59, 60, 61,
+	0, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 124, 414, 415, 416, 417,
+	418, 419, 79, 420, 421, 422, 423, 424, 425, 112, 426, 427, 28, 428, 429, 430,
+	0, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 124, 441, 442, 443, 444,
+	445, 446, 79, 447, 448, 449, 450, 451, 452, 112, 453, 454, 28, 455, 60, 456,
+	0, 457, 458, 118, 459, 460, 461, 462, 463, 464, 465, 124, 100, 466, 467, 468,
+	469, 470, 79, 471, 472, 473, 474, 110, 475, 112, 476, 477, 28, 478, 60, 479,
+	0, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 124, 490, 491, 492, 493,
+	494, 495, 79, 496, 497, 498, 499, 110, 500, 501, 502, 503, 504, 59, 60, 61,
+	0, 505, 506, 118, 92, 93, 507, 95, 121, 189, 508, 124, 100, 265, 127, 103,
+	509, 105, 79, 267, 510, 152, 499, 110, 134, 112, 135, 114, 28, 59, 60, 61,
+	0, 511, 512, 118, 92, 93, 513, 95, 121, 189, 514, 124, 100, 265, 127, 103,
+	515, 105, 79, 267, 268, 152, 516, 110, 134, 112, 135, 114, 28, 517, 60, 518,
+	0, 519, 520, 118, 92, 93, 521, 95, 121, 189, 522, 124, 100, 265, 127, 103,
+	402, 523, 79, 267, 268, 524, 499, 110, 134, 112, 135, 114, 28, 59, 60, 61,
+	0, 525, 526, 118, 92, 93, 527, 95, 121, 189, 528, 124, 100, 265, 529, 530,
+	531, 532, 79, 267, 533, 534, 535, 110, 134, 112, 135, 114, 28, 59, 60, 61,
+	0, 536, 537, 118, 92, 93, 538, 95, 121, 539, 540, 124, 100, 541, 127, 103,
+	542, 105, 79, 267, 268, 543, 544, 110, 545, 112, 135, 114, 28, 59, 546, 61,
+	0, 547, 400, 118, 92, 93, 548, 95, 121, 189, 401, 124, 100, 265, 127, 103,
+	402, 105, 79, 267, 268, 152, 499, 110, 134, 112, 135, 114, 28, 59, 60, 61,
+	0, 547, 400, 118, 92, 93, 362, 95, 549, 550, 401, 124, 100, 551, 127, 552,
+	402, 105, 79, 553, 268, 554, 499, 110, 134, 112, 135, 114, 28, 59, 60, 61,
+	0, 547, 400, 118, 555, 93, 362, 556, 557, 189, 401, 124, 100, 265, 127, 558,
+	402, 105, 79, 559, 560, 561, 499, 110, 134, 112, 135, 114, 562, 59, 60, 61,
+	0, 547, 400, 563, 564, 565, 362, 566, 567, 568, 401, 124, 100, 569, 127, 570,
+	402, 571, 79, 572, 573, 574, 499, 110, 134, 112, 135, 114, 28, 59, 60, 61,
+};
+
+static const uint8_t kCostsDe [9200] =
+{
+	63, 68, 70, 84, 101, 133, 100, 69, 86, 105, 100, 85, 165, 88, 159, 137,
+	49, 102, 103, 119, 134, 134, 119, 102, 102, 121, 101, 119, 135, 121, 191, 187,
+	137, 75, 88, 139, 151, 168, 52, 38, 106, 60, 102, 146, 184, 152, 255, 255,
+	104, 243, 218, 241, 125, 195, 111, 221, 181, 79, 153, 244, 248, 133, 191, 191,
+	105, 163, 102, 181, 41, 165, 91, 248, 114, 79, 151, 165, 249, 248, 255, 255,
+	120, 162, 188, 193, 140, 130, 206, 157, 133, 127, 200, 165, 236, 169, 175, 159,
+	122, 119, 119, 141, 153, 177, 89, 54, 153, 42, 116, 153, 73, 170, 255, 255,
+	139, 244, 139, 162, 250, 180, 111, 221, 147, 92, 151, 245, 218, 251, 127, 41,
+	122, 100, 169, 161, 125, 163, 95, 121, 117, 63, 151, 181, 248, 153, 159, 74,
+	105, 242, 172, 147, 159, 242, 156, 247, 163, 127, 105, 164, 248, 248, 127, 198,
+	137, 121, 103, 138, 85, 170, 120, 19, 121, 106, 114, 154, 153, 153, 255, 255,
+	103, 162, 255, 242, 127, 148, 255, 175, 99, 175, 248, 163, 248, 255, 143, 89,
+	138, 146, 140, 242, 107, 181, 93, 156, 130, 95, 169, 133, 247, 249, 207, 133,
+	105, 242, 104, 146, 143, 147, 159, 170, 163, 175, 151, 165, 169, 136, 95, 148,
+	121, 98, 154, 163, 188, 178, 168, 153, 131, 172, 137, 164, 168, 169, 175, 101,
+	118, 211, 122, 164, 182, 161, 185, 172, 195, 207, 153, 211, 220, 166, 143, 150,
+	136, 59, 38, 89, 71, 135, 117, 102, 40, 79, 100, 135, 185, 137, 255, 255,
+	122, 161, 167, 84, 88, 244, 87, 175, 148, 42, 184, 245, 152, 248, 175, 207,
+	85, 244, 249, 247, 255, 245, 255, 255, 150, 137, 127, 240, 246, 255, 255, 255,
+	104, 244, 138, 145, 156, 180, 207, 200, 132, 191, 168, 244, 201, 202, 175, 95,
+	122, 244, 179, 211, 91, 194, 119, 185, 68, 154, 55, 132, 233, 164, 175, 93,
+	105, 146, 247, 243, 72, 164, 106, 187, 147, 63, 117, 148, 185, 148, 175, 122,
+	101, 122, 137, 191, 137, 167, 135, 19, 111, 92, 117, 170, 253, 172, 255, 255,
+	122, 213, 252, 241, 223, 196, 159, 185, 177, 159, 200, 217, 253, 251, 159, 255,
+	155, 211, 251, 241, 137, 242, 253, 252, 213, 159, 253, 243, 253, 251, 111, 121,
+	35, 99, 102, 133, 103, 243, 143, 244, 84, 255, 101, 246, 134, 95, 255, 255,
+	84, 241, 255, 244, 255, 244, 255, 142, 147, 255, 142, 131, 248, 255, 255, 255,
+	123, 244, 207, 242, 107, 244, 168, 191, 247, 191, 202, 241, 244, 249, 143, 191,
+	67, 104, 221, 209, 152, 213, 87, 173, 157, 109, 103, 218, 221, 125, 221, 221,
+	255, 255, 255, 255, 85, 255, 79, 15, 255, 133, 111, 246, 255, 255, 255, 255,
+	255, 255, 253, 31, 252, 255, 143, 198, 255, 111, 209, 255, 248, 255, 253, 255,
+	255, 15, 255, 255, 255, 255, 223, 255, 255, 223, 137, 255, 255, 255, 255, 255,
+	17, 118, 119, 119, 137, 183, 135, 119, 119, 138, 117, 136, 136, 122, 207, 207,
+	68, 95, 71, 138, 118, 136, 53, 53, 89, 41, 85, 115, 183, 119, 255, 255,
+	70, 147, 168, 242, 143, 242, 63, 152, 245, 63, 247, 244, 247, 134, 255, 255,
+	68, 163, 118, 247, 36, 248, 95, 137, 66, 79, 119, 247, 250, 248, 255, 255,
+	85, 113, 155, 243, 123, 148, 191, 138, 115, 127, 247, 87, 255, 153, 191, 255,
+	68, 106, 102, 120, 104, 114, 88, 37, 135, 58, 100, 87, 79, 119, 255, 255,
+	85, 244, 120, 130, 249, 243, 95, 135, 147, 58, 134, 244, 175, 249, 143, 95,
+	86, 100, 255, 131, 106, 162, 95, 105, 101, 63, 103, 244, 250, 111, 175, 127,
+	68, 243, 137, 242, 111, 115, 215, 231, 243, 127, 95, 132, 248, 255, 127, 103,
+	85, 118, 37, 135, 134, 249, 104, 21, 87, 95, 117, 136, 127, 143, 255, 255,
+	37, 242, 255, 245, 255, 84, 255, 255, 115, 255, 255, 100, 255, 255, 111, 95,
+	69, 242, 111, 243, 90, 244, 89, 127, 130, 79, 136, 133, 249, 168, 255, 121,
+	52, 114, 135, 115, 255, 242, 121, 135, 131, 159, 102, 133, 255, 105, 111, 246,
+	69, 113, 143, 243, 255, 243, 151, 119, 147, 143, 119, 244, 152, 248, 255, 152,
+	50, 146, 103, 244, 100, 244, 168, 127, 179, 159, 120, 244, 255, 152, 191, 159,
+	83, 54, 71, 89, 102, 118, 102, 89, 26, 79, 117, 101, 247, 250, 255, 255,
+	85, 162, 249, 69, 88, 244, 135, 255, 243, 47, 151, 164, 255, 250, 159, 255,
+	38, 245, 255, 255, 255, 244, 255, 255, 247, 255, 255, 241, 243, 255, 255, 255,
+	67, 117, 88, 113, 104, 244, 167, 118, 131, 153, 135, 117, 151, 249, 255, 169,
+	67, 148, 164, 243, 89, 243, 117, 136, 53, 154, 56, 132, 249, 133, 175, 127,
+	68, 130, 247, 243, 106, 244, 104, 168, 244, 63, 117, 245, 121, 132, 255, 111,
+	67, 111, 102, 239, 118, 245, 104, 36, 79, 63, 99, 151, 249, 136, 255, 255,
+	69, 243, 255, 241, 255, 244, 255, 159, 114, 127, 255, 255, 255, 255, 255, 255,
+	69, 146, 249, 241, 119, 243, 255, 255, 244, 95, 255, 246, 135, 255, 159, 121,
+	33, 253, 119, 237, 111, 243, 255, 244, 118, 255, 167, 255, 85, 78, 255, 255,
+	36, 241, 255, 244, 255, 101, 255, 125, 117, 239, 216, 243, 255, 246, 255, 255,
+	54, 147, 248, 241, 111, 245, 134, 255, 255, 255, 233, 243, 245, 248, 255, 255,
+	251, 175, 102, 107, 52, 245, 79, 25, 175, 56, 53, 198, 255, 159, 134, 255,
+	169, 175, 116, 58, 99, 249, 143, 55, 127, 63, 66, 255, 249, 249, 244, 250,
+	169, 60, 68, 91, 68, 251, 58, 104, 111, 47, 67, 255, 255, 191, 253, 255,
+	81, 84, 86, 118, 118, 117, 101, 85, 118, 105, 101, 119, 152, 136, 255, 255,
+	115, 111, 86, 111, 246, 245, 69, 51, 111, 56, 53, 247, 255, 133, 255, 255,
+	102, 84, 121, 97, 84, 244, 74, 156, 166, 127, 149, 197, 247, 119, 207, 175,
+	103, 148, 166, 245, 25, 245, 131, 175, 182, 137, 136, 247, 255, 255, 255, 255,
+	67, 163, 74, 162, 104, 100, 127, 101, 149, 63, 115, 134, 250, 152, 255, 250,
+	82, 100, 255, 255, 101, 108, 52, 67, 102, 63, 86, 255, 245, 245, 255, 255,
+	86, 244, 255, 85, 245, 99, 127, 127, 245, 63, 23, 245, 151, 152, 255, 111,
+	83, 114, 143, 242, 87, 244, 143, 105, 165, 127, 84, 164, 247, 249, 255, 175,
+	99, 163, 159, 246, 248, 244, 26, 102, 246, 63, 137, 243, 250, 249, 255, 255,
+	82, 134, 87, 136, 247, 180, 54, 37, 104, 75, 69, 136, 182, 121, 255, 255,
+	83, 113, 95, 244, 120, 244, 248, 137, 100, 143, 246, 244, 255, 248, 255, 255,
+	84, 243, 200, 162, 95, 245, 150, 153, 117, 111, 39, 182, 247, 72, 255, 252,
+	83, 83, 121, 147, 150, 163, 55, 134, 118, 186, 51, 134, 169, 152, 191, 255,
+	83, 67, 140, 193, 153, 180, 138, 131, 85, 143, 103, 166, 249, 251, 111, 251,
+	83, 149, 53, 102, 114, 116, 117, 55, 166, 188, 86, 198, 182, 72, 223, 255,
+	49, 239, 127, 255, 103, 247, 95, 71, 127, 79, 85, 244, 255, 247, 255, 255,
+	68, 163, 248, 148, 79, 244, 111, 247, 66, 127, 69, 243, 255, 249, 255, 143,
+	52, 212, 170, 215, 217, 212, 157, 221, 151, 135, 121, 209, 213, 221, 221, 221,
+	84, 67, 68, 100, 132, 147, 117, 87, 134, 105, 53, 150, 184, 135, 255, 207,
+	114, 165, 245, 196, 74, 245, 133, 120, 152, 207, 50, 166, 203, 247, 255, 255,
+	99, 165, 197, 193, 111, 163, 106, 171, 149, 159, 70, 164, 252, 106, 223, 191,
+	117, 72, 101, 38, 217, 152, 104, 118, 108, 111, 65, 173, 170, 169, 245, 255,
+	86, 242, 143, 242, 255, 243, 111, 111, 115, 95, 102, 245, 143, 247, 255, 255,
+	68, 97, 136, 244, 248, 243, 134, 87, 149, 111, 153, 245, 247, 245, 255, 255,
+	51, 116, 246, 46, 255, 242, 127, 255, 133, 143, 103, 247, 118, 255, 255, 255,
+	66, 98, 143, 148, 247, 244, 121, 118, 164, 111, 85, 116, 250, 247, 255, 255,
+	68, 241, 111, 244, 102, 243, 119, 103, 244, 255, 215, 116, 254, 103, 255, 255,
+	34, 102, 84, 102, 151, 119, 101, 86, 118, 79, 85, 104, 247, 134, 255, 255,
+	83, 103, 85, 136, 102, 133, 70, 54, 184, 43, 67, 244, 247, 149, 255, 255,
+	126, 242, 255, 244, 255, 242, 111, 255, 246, 31, 255, 244, 255, 255, 255, 255,
+	102, 181, 152, 214, 9, 182, 132, 186, 132, 124, 120, 200, 251, 251, 255, 255,
+	83, 131, 138, 161, 137, 131, 123, 120, 133, 109, 150, 149, 184, 169, 191, 170,
+	100, 150, 108, 86, 102, 211, 85, 40, 154, 61, 101, 139, 199, 107, 255, 255,
+	84, 148, 138, 66, 167, 164, 92, 106, 163, 93, 86, 228, 169, 121, 127, 59,
+	232, 246, 255, 240, 255, 247, 127, 239, 254, 143, 238, 253, 255, 255, 255, 239,
+	103, 243, 255, 117, 255, 244, 191, 223, 243, 207, 191, 245, 255, 255, 31, 255,
+	101, 84, 102, 165, 132, 155, 54, 40, 136, 90, 34, 250, 249, 152, 255, 255,
+	238, 248, 159, 240, 255, 253, 255, 255, 253, 255, 255, 253, 255, 255, 255, 248,
+	84, 146, 137, 178, 103, 196, 104, 121, 131, 95, 54, 148, 247, 121, 223, 134,
+	127, 243, 255, 242, 255, 130, 251, 255, 243, 255, 255, 247, 255, 250, 175, 244,
+	68, 214, 255, 247, 247, 252, 255, 253, 112, 255, 255, 253, 255, 255, 255, 255,
+	66, 116, 71, 100, 131, 148, 135, 89, 166, 172, 69, 149, 216, 104, 175, 153,
+	67, 102, 105, 137, 118, 246, 38, 53, 133, 57, 69, 117, 104, 103, 255, 255,
+	85, 162, 136, 83, 103, 244, 87, 169, 84, 59, 70, 148, 169, 216, 159, 207,
+	121, 241, 153, 242, 255, 147, 168, 143, 243, 255, 255, 147, 255, 247, 111, 127,
+	68, 245, 66, 245, 255, 246, 255, 143, 68, 143, 37, 255, 255, 111, 143, 255,
+	49, 249, 246, 243, 255, 247, 255, 255, 247, 111, 255, 255, 255, 239, 255, 255,
+	100, 134, 84, 119, 132, 133, 69, 38, 249, 63, 52, 154, 153, 134, 255, 255,
+	85, 164, 153, 193, 219, 196, 140, 138, 130, 143, 151, 184, 204, 250, 175, 255,
+	238, 241, 255, 242, 255, 244, 255, 255, 244, 255, 255, 252, 255, 255, 111, 111,
+	51, 149, 118, 85, 138, 242, 136, 166, 86, 159, 39, 247, 120, 118, 255, 255,
+	86, 245, 246, 246, 244, 247, 95, 125, 222, 255, 5, 254, 255, 255, 255, 255,
+	101, 148, 155, 177, 121, 196, 121, 153, 166, 173, 74, 162, 245, 137, 143, 167,
+	255, 255, 111, 255, 205, 248, 143, 175, 255, 15, 206, 246, 255, 255, 255, 255,
+	49, 99, 69, 103, 151, 247, 118, 70, 102, 87, 69, 119, 247, 136, 255, 255,
+	67, 104, 116, 135, 103, 119, 55, 69, 71, 71, 52, 119, 137, 133, 255, 255,
+	85, 115, 169, 129, 119, 100, 76, 151, 180, 95, 102, 180, 232, 134, 127, 191,
+	50, 242, 255, 115, 143, 243, 252, 247, 245, 111, 118, 255, 255, 255, 255, 255,
+	34, 102, 111, 152, 152, 247, 95, 39, 111, 79, 116, 136, 249, 255, 255, 255,
+	83, 116, 170, 161, 119, 180, 87, 89, 133, 78, 85, 196, 200, 169, 159, 91,
+	67, 133, 172, 146, 170, 244, 73, 73, 183, 95, 38, 230, 248, 159, 143, 154,
+	84, 100, 93, 86, 254, 132, 119, 56, 21, 127, 68, 249, 248, 255, 255, 255,
+	68, 130, 143, 242, 138, 131, 249, 138, 116, 159, 167, 148, 248, 249, 159, 104,
+	50, 117, 127, 130, 147, 245, 105, 136, 133, 143, 67, 151, 247, 138, 255, 191,
+	69, 243, 230, 243, 126, 242, 207, 119, 243, 255, 197, 243, 255, 246, 255, 239,
+	83, 66, 155, 146, 183, 195, 121, 132, 84, 172, 119, 165, 200, 170, 143, 135,
+	116, 133, 55, 170, 167, 170, 73, 34, 86, 74, 101, 134, 169, 151, 255, 255,
+	36, 244, 255, 203, 223, 244, 223, 255, 215, 127, 182, 241, 255, 255, 255, 255,
+	86, 244, 133, 242, 143, 243, 47, 111, 243, 255, 110, 245, 248, 244, 255, 255,
+	34, 246, 245, 247, 126, 252, 245, 127, 38, 127, 101, 103, 255, 254, 127, 255,
+	50, 246, 143, 132, 255, 242, 71, 127, 244, 127, 101, 245, 95, 223, 255, 255,
+	252, 66, 116, 197, 254, 244, 95, 52, 111, 47, 84, 95, 255, 84, 255, 255,
+	103, 162, 155, 193, 137, 211, 155, 123, 180, 143, 200, 244, 186, 232, 111, 120,
+	67, 130, 136, 181, 167, 133, 119, 84, 52, 111, 68, 148, 186, 168, 255, 255,
+	65, 85, 85, 117, 134, 135, 102, 85, 85, 71, 68, 135, 247, 136, 191, 255,
+	100, 122, 139, 152, 119, 152, 119, 86, 123, 59, 19, 118, 248, 152, 248, 255,
+	36, 243, 255, 244, 255, 236, 207, 247, 244, 79, 238, 242, 255, 245, 255, 255,
+	50, 115, 143, 245, 87, 243, 95, 255, 117, 63, 247, 116, 255, 247, 255, 255,
+	99, 119, 136, 123, 169, 216, 104, 37, 136, 46, 83, 151, 108, 139, 255, 255,
+	86, 229, 255, 242, 79, 241, 223, 215, 244, 79, 221, 246, 255, 246, 255, 95,
+	68, 242, 255, 244, 127, 242, 191, 223, 244, 111, 191, 243, 255, 247, 255, 255,
+	117, 133, 136, 97, 180, 170, 136, 88, 214, 93, 100, 119, 186, 137, 255, 255,
+	101, 241, 255, 244, 255, 242, 255, 255, 243, 255, 255, 99, 255, 246, 255, 239,
+	120, 244, 248, 243, 249, 129, 159, 255, 247, 255, 223, 243, 255, 255, 127, 255,
+	53, 211, 255, 244, 255, 241, 255, 252, 213, 255, 255, 244, 255, 255, 47, 255,
+	85, 243, 223, 241, 252, 119, 255, 239, 245, 255, 211, 242, 255, 246, 255, 255,
+	83, 87, 149, 119, 148, 153, 83, 52, 72, 73, 132, 133, 131, 111, 255, 255,
+	69, 244, 255, 118, 239, 246, 225, 255, 214, 47, 207, 245, 119, 255, 255, 255,
+	86, 244, 239, 242, 143, 243, 255, 255, 244, 255, 153, 242, 255, 255, 255, 63,
+	65, 246, 130, 246, 95, 248, 134, 143, 73, 143, 104, 245, 247, 249, 159, 255,
+	66, 164, 151, 114, 105, 179, 106, 137, 133, 93, 85, 165, 183, 87, 143, 124,
+	101, 102, 136, 167, 167, 153, 55, 37, 106, 42, 131, 152, 248, 111, 255, 255,
+	103, 242, 255, 241, 255, 245, 255, 255, 245, 255, 255, 253, 255, 255, 239, 255,
+	49, 101, 87, 102, 119, 150, 118, 101, 102, 89, 100, 104, 184, 122, 159, 191,
+	68, 159, 37, 255, 151, 249, 51, 67, 127, 63, 100, 149, 255, 248, 255, 255,
+	119, 116, 249, 193, 191, 245, 127, 105, 197, 95, 167, 196, 255, 249, 79, 255,
+	66, 245, 167, 183, 31, 246, 131, 186, 133, 175, 71, 150, 251, 255, 255, 255,
+	83, 163, 120, 129, 168, 147, 111, 143, 164, 95, 151, 165, 248, 175, 255, 255,
+	67, 154, 88, 122, 249, 245, 86, 39, 104, 31, 119, 255, 138, 122, 255, 255,
+	134, 245, 250, 81, 255, 244, 106, 171, 244, 95, 134, 242, 249, 255, 127, 63,
+	102, 165, 191, 241, 151, 242, 95, 168, 166, 79, 74, 244, 250, 249, 255, 255,
+	119, 245, 255, 243, 255, 248, 31, 118, 247, 63, 111, 246, 250, 255, 127, 246,
+	99, 91, 115, 133, 149, 251, 75, 36, 187, 159, 53, 222, 255, 159, 234, 223,
+	68, 242, 249, 164, 139, 243, 106, 139, 148, 191, 40, 244, 248, 250, 255, 143,
+	83, 84, 70, 115, 152, 165, 41, 72, 102, 175, 69, 134, 247, 138, 175, 246,
+	81, 68, 121, 131, 248, 245, 139, 139, 51, 207, 118, 167, 249, 138, 127, 203,
+	49, 119, 73, 133, 182, 183, 151, 91, 153, 172, 69, 149, 234, 106, 255, 168,
+	67, 111, 135, 79, 101, 159, 39, 72, 95, 63, 133, 133, 255, 143, 255, 255,
+	101, 163, 248, 163, 143, 245, 105, 159, 82, 95, 72, 162, 255, 249, 159, 255,
+	50, 246, 255, 255, 255, 246, 255, 255, 254, 246, 255, 241, 253, 255, 255, 255,
+	82, 101, 73, 100, 102, 230, 102, 71, 120, 111, 52, 101, 245, 91, 143, 203,
+	81, 135, 243, 211, 139, 229, 215, 218, 104, 173, 52, 216, 252, 188, 239, 255,
+	50, 164, 135, 147, 107, 181, 123, 121, 167, 74, 68, 152, 248, 56, 191, 251,
+	84, 247, 143, 242, 162, 247, 119, 104, 159, 89, 37, 159, 127, 159, 249, 255,
+	68, 115, 134, 242, 248, 115, 111, 143, 242, 127, 127, 246, 255, 255, 255, 255,
+	100, 242, 249, 130, 136, 243, 88, 255, 133, 127, 134, 248, 255, 151, 63, 101,
+	67, 245, 118, 149, 159, 242, 152, 248, 73, 143, 47, 246, 175, 255, 255, 255,
+	50, 84, 117, 244, 245, 85, 101, 102, 197, 111, 68, 102, 247, 246, 255, 255,
+	84, 247, 255, 130, 120, 241, 255, 143, 245, 248, 233, 244, 249, 135, 111, 127,
+	220, 127, 255, 240, 255, 253, 53, 255, 255, 255, 95, 255, 255, 255, 255, 255,
+	255, 255, 238, 239, 189, 254, 207, 15, 255, 191, 206, 254, 255, 255, 255, 255,
+	255, 255, 252, 15, 235, 255, 255, 191, 239, 191, 202, 255, 255, 255, 251, 255,
+	49, 101, 71, 103, 151, 249, 103, 118, 119, 95, 101, 105, 248, 119, 255, 159,
+	133, 248, 36, 249, 73, 246, 39, 54, 175, 75, 100, 246, 153, 248, 255, 255,
+	117, 169, 170, 204, 31, 184, 70, 56, 250, 47, 101, 255, 255, 207, 255, 255,
+	67, 247, 255, 162, 143, 164, 127, 42, 245, 159, 115, 255, 255, 143, 255, 95,
+	136, 244, 255, 240, 79, 248, 239, 239, 254, 63, 238, 247, 255, 255, 255, 239,
+	67, 131, 172, 146, 170, 212, 58, 87, 181, 77, 55, 165, 248, 170, 111, 168,
+	150, 167, 119, 133, 242, 175, 50, 42, 171, 127, 133, 255, 74, 59, 255, 255,
+	137, 243, 255, 246, 255, 113, 239, 255, 244, 255, 159, 244, 255, 255, 95, 83,
+	136, 244, 223, 240, 252, 246, 255, 232, 247, 255, 222, 247, 255, 255, 255, 255,
+	85, 249, 143, 175, 120, 249, 47, 105, 168, 31, 104, 169, 191, 255, 255, 255,
+	103, 241, 239, 243, 255, 243, 255, 255, 245, 255, 239, 114, 255, 249, 111, 111,
+	68, 88, 117, 115, 152, 247, 111, 244, 63, 63, 69, 131, 246, 70, 255, 255,
+	65, 246, 154, 162, 255, 247, 127, 248, 104, 79, 245, 247, 243, 250, 255, 255,
+	118, 255, 175, 247, 246, 127, 71, 8, 255, 111, 102, 153, 255, 255, 247, 255,
+	237, 252, 255, 240, 255, 247, 255, 255, 254, 255, 207, 243, 253, 255, 79, 255,
+	255, 255, 238, 239, 44, 253, 31, 47, 255, 63, 189, 253, 255, 255, 254, 255,
+	255, 255, 255, 255, 35, 255, 111, 143, 255, 31, 255, 255, 255, 191, 255, 255,
+	65, 101, 104, 103, 151, 166, 120, 103, 135, 121, 86, 119, 249, 169, 255, 255,
+	67, 24, 106, 154, 135, 166, 73, 53, 119, 79, 85, 119, 167, 135, 255, 255,
+	70, 241, 255, 243, 255, 245, 239, 255, 244, 127, 255, 245, 255, 255, 255, 255,
+	99, 59, 137, 73, 100, 202, 72, 38, 119, 79, 99, 188, 166, 139, 127, 247,
+	55, 242, 255, 241, 127, 244, 143, 239, 245, 111, 110, 244, 247, 255, 255, 239,
+	68, 241, 111, 244, 255, 244, 111, 103, 244, 127, 55, 244, 246, 247, 255, 255,
+	117, 70, 89, 148, 244, 250, 105, 55, 165, 111, 19, 249, 250, 153, 255, 255,
+	102, 243, 255, 241, 63, 247, 239, 255, 244, 143, 207, 245, 255, 255, 255, 255,
+	126, 243, 255, 242, 255, 241, 239, 255, 244, 143, 239, 255, 255, 248, 255, 143,
+	104, 161, 250, 245, 248, 243, 255, 255, 146, 255, 255, 244, 255, 249, 255, 255,
+	66, 102, 119, 137, 247, 247, 57, 53, 133, 63, 85, 101, 246, 120, 255, 255,
+	35, 246, 255, 123, 97, 252, 63, 255, 101, 79, 207, 245, 127, 255, 255, 255,
+	103, 242, 255, 243, 255, 243, 255, 191, 131, 255, 250, 242, 191, 255, 255, 131,
+	51, 100, 71, 85, 102, 246, 101, 101, 85, 106, 52, 72, 247, 74, 255, 143,
+	49, 245, 255, 243, 127, 254, 169, 255, 246, 143, 248, 247, 255, 248, 255, 255,
+	100, 131, 106, 245, 168, 116, 79, 50, 139, 63, 102, 255, 250, 167, 255, 255,
+	231, 241, 255, 241, 255, 245, 255, 255, 243, 127, 255, 245, 255, 246, 223, 118,
+	255, 255, 255, 249, 255, 248, 15, 169, 255, 223, 254, 255, 255, 255, 255, 255,
+	81, 69, 103, 101, 119, 134, 119, 86, 104, 107, 117, 121, 185, 139, 255, 255,
+	100, 72, 103, 72, 136, 149, 38, 52, 120, 74, 69, 132, 247, 135, 255, 255,
+	221, 241, 255, 242, 255, 227, 207, 255, 252, 223, 238, 245, 255, 254, 255, 255,
+	98, 118, 150, 185, 154, 197, 87, 38, 170, 60, 115, 186, 120, 154, 255, 255,
+	100, 118, 134, 147, 149, 153, 55, 37, 119, 72, 68, 63, 137, 169, 255, 255,
+	83, 195, 207, 194, 244, 245, 255, 219, 246, 255, 70, 198, 251, 223, 159, 44,
+	70, 228, 255, 241, 255, 244, 143, 246, 228, 255, 255, 242, 255, 255, 255, 255,
+	134, 246, 127, 242, 255, 241, 95, 255, 169, 191, 121, 244, 255, 255, 255, 255,
+	100, 86, 67, 135, 136, 134, 54, 52, 101, 79, 68, 117, 245, 159, 255, 255,
+	116, 134, 111, 113, 143, 243, 127, 255, 166, 191, 70, 181, 255, 154, 95, 175,
+	66, 152, 244, 242, 105, 245, 143, 255, 102, 159, 46, 149, 255, 159, 255, 255,
+	80, 168, 255, 244, 221, 246, 111, 184, 249, 175, 102, 216, 252, 175, 255, 207,
+	100, 81, 135, 134, 248, 148, 86, 52, 88, 88, 87, 120, 150, 154, 255, 255,
+	103, 242, 255, 241, 255, 243, 255, 255, 252, 95, 255, 246, 255, 246, 111, 255,
+	255, 255, 63, 127, 222, 249, 31, 23, 255, 143, 111, 246, 255, 255, 143, 255,
+	246, 255, 242, 111, 59, 255, 255, 95, 63, 31, 202, 255, 246, 255, 252, 255,
+	65, 100, 86, 117, 102, 136, 117, 70, 85, 120, 101, 102, 247, 119, 255, 175,
+	66, 58, 135, 170, 133, 246, 55, 38, 117, 89, 85, 134, 255, 250, 255, 255,
+	85, 100, 183, 98, 247, 244, 75, 151, 165, 127, 55, 130, 246, 134, 255, 255,
+	136, 246, 253, 246, 15, 250, 246, 220, 199, 159, 140, 250, 255, 251, 255, 255,
+	50, 243, 111, 162, 149, 100, 143, 127, 150, 143, 132, 245, 152, 250, 255, 255,
+	113, 95, 88, 126, 103, 220, 90, 56, 175, 44, 131, 205, 203, 255, 246, 255,
+	102, 166, 170, 36, 255, 241, 159, 159, 165, 127, 79, 246, 255, 246, 255, 239,
+	84, 166, 255, 241, 102, 246, 181, 57, 184, 108, 73, 244, 251, 207, 255, 255,
+	101, 244, 255, 243, 127, 245, 143, 54, 246, 31, 159, 245, 255, 255, 255, 255,
+	51, 245, 124, 246, 247, 245, 119, 70, 254, 95, 97, 248, 246, 247, 255, 255,
+	211, 241, 255, 243, 255, 243, 247, 95, 243, 255, 245, 244, 255, 255, 127, 239,
+	66, 161, 143, 245, 121, 245, 135, 154, 132, 143, 56, 246, 247, 248, 255, 255,
+	84, 116, 72, 65, 153, 147, 74, 121, 166, 250, 69, 182, 247, 184, 175, 255,
+	113, 83, 250, 244, 207, 244, 171, 180, 70, 159, 137, 246, 252, 191, 143, 255,
+	82, 132, 54, 82, 100, 149, 150, 104, 167, 155, 68, 167, 248, 105, 127, 255,
+	101, 159, 170, 204, 251, 203, 153, 10, 143, 105, 89, 247, 249, 255, 255, 255,
+	52, 242, 246, 147, 111, 245, 89, 249, 86, 111, 55, 85, 127, 255, 255, 255,
+	100, 148, 24, 163, 150, 148, 132, 133, 245, 122, 103, 150, 250, 168, 255, 255,
+	100, 166, 161, 198, 123, 244, 121, 169, 136, 175, 37, 199, 221, 199, 207, 255,
+	66, 165, 170, 147, 104, 164, 136, 135, 149, 141, 51, 181, 202, 103, 111, 159,
+	99, 85, 118, 197, 254, 111, 79, 65, 111, 102, 67, 255, 102, 255, 255, 255,
+	66, 148, 127, 145, 255, 242, 249, 127, 246, 255, 133, 152, 255, 255, 255, 255,
+	70, 241, 255, 245, 255, 244, 255, 255, 242, 255, 255, 245, 255, 255, 239, 255,
+	50, 247, 246, 243, 255, 246, 135, 249, 246, 255, 31, 246, 255, 249, 255, 255,
+	70, 241, 255, 245, 255, 244, 255, 220, 195, 239, 204, 245, 255, 245, 255, 255,
+	86, 245, 248, 242, 111, 241, 134, 120, 149, 127, 232, 246, 255, 111, 255, 127,
+	116, 85, 238, 69, 102, 247, 101, 21, 94, 79, 85, 127, 255, 95, 255, 255,
+	66, 95, 105, 121, 87, 119, 69, 52, 72, 55, 86, 86, 245, 119, 255, 255,
+	115, 159, 38, 249, 135, 142, 81, 86, 248, 88, 88, 111, 246, 159, 255, 255,
+	66, 51, 69, 247, 102, 120, 71, 53, 117, 95, 71, 255, 247, 127, 255, 255,
+	84, 99, 88, 114, 165, 147, 57, 120, 133, 187, 53, 149, 201, 152, 127, 86,
+	83, 47, 222, 127, 71, 120, 102, 56, 223, 63, 228, 101, 247, 87, 255, 255,
+	82, 100, 70, 99, 102, 164, 102, 86, 133, 108, 68, 117, 214, 104, 127, 120,
+	83, 149, 115, 131, 102, 228, 119, 136, 85, 139, 52, 118, 247, 134, 159, 127,
+	67, 83, 78, 214, 245, 143, 68, 52, 111, 54, 103, 127, 85, 120, 255, 255,
+	65, 86, 86, 118, 103, 245, 101, 86, 103, 95, 101, 105, 249, 169, 255, 175,
+	100, 104, 104, 153, 150, 86, 72, 21, 105, 79, 53, 135, 168, 150, 255, 255,
+	199, 50, 241, 101, 255, 244, 239, 255, 246, 127, 254, 252, 255, 255, 255, 255,
+	100, 153, 122, 168, 123, 241, 105, 55, 153, 95, 39, 187, 186, 246, 255, 255,
+	50, 242, 255, 242, 255, 248, 239, 111, 254, 79, 232, 253, 255, 255, 95, 239,
+	69, 241, 255, 244, 255, 244, 111, 228, 243, 111, 120, 131, 247, 249, 255, 255,
+	100, 86, 104, 243, 135, 104, 87, 53, 102, 79, 82, 121, 248, 169, 255, 255,
+	141, 241, 255, 242, 255, 131, 223, 255, 243, 255, 223, 245, 255, 255, 111, 248,
+	88, 244, 207, 132, 247, 245, 255, 223, 243, 255, 222, 120, 255, 255, 255, 31,
+	117, 122, 88, 154, 136, 248, 71, 18, 72, 79, 102, 118, 249, 168, 255, 255,
+	119, 242, 255, 98, 239, 246, 111, 255, 211, 79, 190, 245, 246, 255, 255, 255,
+	109, 50, 239, 242, 255, 242, 249, 255, 244, 255, 239, 244, 255, 247, 143, 255,
+	66, 101, 244, 115, 79, 245, 87, 127, 71, 95, 86, 69, 255, 119, 255, 255,
+	66, 166, 159, 243, 249, 178, 175, 122, 133, 107, 166, 146, 134, 152, 255, 255,
+	84, 102, 121, 136, 168, 134, 69, 34, 87, 47, 85, 247, 248, 135, 255, 255,
+	135, 241, 143, 242, 255, 244, 255, 255, 244, 255, 255, 246, 255, 255, 111, 111,
+	238, 252, 255, 240, 255, 245, 255, 255, 255, 255, 207, 245, 253, 255, 255, 255,
+	249, 255, 253, 223, 253, 255, 143, 6, 111, 127, 219, 255, 255, 255, 253, 255,
+	65, 85, 70, 102, 119, 150, 118, 69, 86, 103, 100, 103, 182, 103, 255, 175,
+	99, 104, 86, 137, 99, 165, 102, 53, 103, 90, 68, 99, 134, 134, 255, 255,
+	129, 243, 255, 242, 255, 246, 111, 249, 245, 127, 148, 244, 255, 245, 143, 255,
+	53, 244, 255, 246, 31, 244, 141, 255, 243, 127, 247, 247, 255, 255, 255, 255,
+	66, 115, 154, 242, 138, 245, 127, 106, 167, 159, 117, 131, 249, 175, 255, 175,
+	82, 135, 136, 149, 133, 180, 136, 37, 153, 44, 83, 136, 153, 184, 255, 255,
+	68, 243, 255, 129, 255, 118, 239, 246, 244, 111, 228, 243, 255, 255, 255, 207,
+	102, 133, 255, 240, 255, 246, 175, 255, 244, 79, 95, 246, 255, 255, 175, 175,
+	100, 102, 114, 131, 182, 170, 148, 70, 119, 156, 98, 122, 201, 106, 255, 255,
+	115, 242, 255, 244, 94, 243, 95, 127, 242, 111, 180, 243, 255, 255, 255, 254,
+	67, 116, 136, 129, 247, 244, 152, 169, 117, 171, 52, 132, 204, 169, 143, 175,
+	50, 210, 255, 243, 143, 245, 255, 140, 100, 255, 244, 246, 255, 245, 255, 102,
+	49, 243, 223, 243, 247, 244, 255, 255, 246, 255, 151, 245, 255, 247, 255, 248,
+	100, 69, 115, 121, 115, 118, 99, 53, 102, 79, 83, 102, 116, 137, 255, 255,
+	67, 242, 245, 99, 63, 244, 239, 255, 231, 111, 207, 242, 255, 255, 255, 255,
+	65, 135, 131, 165, 139, 248, 169, 143, 135, 251, 72, 168, 248, 91, 159, 143,
+	66, 180, 207, 162, 136, 162, 201, 140, 152, 175, 119, 247, 252, 185, 191, 255,
+	100, 102, 101, 133, 132, 134, 101, 21, 151, 105, 83, 249, 118, 136, 255, 255,
+	71, 242, 127, 241, 255, 243, 255, 255, 247, 255, 255, 246, 255, 255, 255, 255,
+	110, 243, 255, 241, 255, 244, 255, 255, 82, 255, 255, 247, 255, 255, 223, 245,
+	50, 243, 95, 253, 245, 245, 245, 53, 76, 111, 83, 246, 111, 255, 255, 255,
+	255, 255, 134, 127, 134, 255, 239, 23, 255, 47, 211, 243, 255, 255, 105, 255,
+	255, 255, 242, 223, 253, 255, 255, 143, 255, 239, 144, 255, 255, 255, 254, 255,
+	137, 143, 247, 255, 249, 255, 239, 255, 255, 223, 144, 255, 255, 255, 255, 255,
+	49, 69, 86, 118, 119, 151, 86, 69, 102, 79, 101, 122, 120, 127, 175, 143,
+	100, 135, 101, 153, 117, 133, 53, 54, 104, 58, 36, 151, 104, 102, 250, 255,
+	87, 242, 255, 243, 255, 163, 79, 159, 242, 79, 255, 163, 248, 248, 255, 255,
+	67, 169, 103, 170, 73, 197, 72, 24, 152, 63, 70, 250, 154, 153, 255, 255,
+	124, 116, 255, 240, 255, 247, 239, 239, 247, 79, 238, 247, 255, 246, 255, 223,
+	101, 118, 118, 196, 167, 187, 87, 56, 172, 106, 21, 251, 71, 200, 251, 255,
+	36, 244, 239, 242, 254, 242, 207, 255, 244, 255, 200, 244, 255, 255, 255, 229,
+	100, 131, 143, 129, 255, 242, 107, 137, 183, 251, 71, 149, 255, 175, 255, 255,
+	85, 242, 191, 228, 242, 242, 254, 207, 243, 127, 69, 253, 255, 228, 255, 246,
+	100, 118, 40, 138, 119, 120, 85, 54, 135, 73, 53, 101, 159, 135, 255, 255,
+	86, 243, 175, 52, 105, 244, 63, 255, 162, 56, 119, 165, 248, 248, 255, 255,
+	65, 100, 99, 100, 87, 245, 245, 127, 118, 127, 69, 134, 255, 255, 255, 255,
+	50, 244, 255, 243, 102, 244, 127, 247, 118, 239, 133, 245, 248, 69, 255, 143,
+	100, 119, 104, 169, 136, 106, 54, 54, 249, 79, 81, 175, 153, 102, 247, 255,
+	255, 255, 231, 230, 205, 242, 207, 47, 255, 63, 206, 247, 255, 255, 242, 255,
+	119, 255, 243, 223, 240, 255, 143, 207, 255, 223, 219, 255, 255, 255, 253, 255,
+	111, 111, 198, 223, 205, 255, 69, 79, 239, 175, 192, 255, 255, 255, 255, 255,
+	80, 119, 118, 136, 152, 199, 135, 120, 136, 136, 134, 152, 185, 138, 255, 221,
+	99, 120, 99, 137, 84, 151, 53, 66, 120, 90, 70, 117, 167, 168, 255, 255,
+	151, 242, 255, 241, 255, 245, 111, 255, 247, 95, 255, 245, 255, 248, 255, 255,
+	101, 244, 250, 244, 31, 242, 111, 249, 245, 111, 106, 255, 255, 255, 255, 255,
+	82, 132, 191, 209, 139, 132, 108, 188, 133, 143, 151, 212, 249, 187, 175, 207,
+	98, 135, 136, 186, 118, 199, 121, 37, 153, 60, 84, 148, 167, 154, 255, 255,
+	104, 244, 250, 86, 255, 242, 63, 175, 129, 79, 105, 249, 255, 255, 111, 79,
+	66, 132, 170, 146, 135, 182, 103, 152, 165, 141, 116, 230, 168, 252, 223, 60,
+	99, 241, 255, 243, 255, 247, 223, 239, 249, 239, 223, 246, 255, 255, 63, 255,
+	117, 150, 129, 164, 181, 202, 135, 103, 154, 170, 82, 152, 139, 138, 255, 255,
+	211, 242, 255, 243, 255, 242, 247, 255, 243, 127, 245, 245, 255, 248, 255, 255,
+	67, 147, 127, 146, 119, 246, 90, 137, 116, 111, 37, 165, 247, 255, 255, 121,
+	118, 243, 247, 242, 255, 242, 223, 143, 243, 255, 222, 247, 247, 245, 79, 255,
+	108, 209, 255, 241, 255, 244, 255, 253, 118, 255, 255, 247, 255, 255, 255, 244,
+	97, 197, 255, 243, 250, 246, 156, 155, 247, 207, 26, 133, 251, 106, 255, 251,
+	83, 87, 100, 136, 136, 168, 136, 69, 120, 47, 54, 54, 183, 250, 255, 255,
+	119, 242, 247, 84, 226, 244, 95, 255, 212, 63, 119, 243, 255, 255, 255, 255,
+	69, 228, 206, 225, 109, 242, 238, 222, 246, 127, 198, 245, 254, 223, 255, 63,
+	83, 148, 84, 116, 105, 245, 133, 87, 54, 127, 39, 118, 246, 121, 127, 255,
+	83, 244, 154, 65, 90, 165, 108, 175, 118, 79, 117, 182, 182, 184, 191, 143,
+	101, 119, 168, 102, 247, 248, 70, 35, 119, 59, 39, 250, 106, 251, 255, 255,
+	85, 246, 255, 241, 255, 246, 255, 255, 129, 255, 255, 255, 255, 255, 255, 255,
+	143, 244, 255, 240, 248, 245, 255, 255, 245, 159, 255, 247, 255, 247, 95, 247,
+	68, 241, 135, 244, 255, 83, 255, 116, 211, 255, 103, 245, 255, 255, 255, 255,
+	84, 163, 191, 241, 255, 244, 186, 143, 151, 255, 143, 131, 246, 95, 191, 244,
+	255, 255, 226, 239, 92, 247, 111, 167, 255, 31, 206, 254, 255, 255, 254, 255,
+	255, 255, 253, 207, 247, 255, 255, 207, 255, 31, 27, 255, 255, 255, 253, 255,
+	101, 87, 221, 231, 212, 255, 191, 255, 15, 191, 56, 255, 255, 255, 255, 255,
+	65, 100, 69, 102, 102, 117, 117, 101, 85, 106, 101, 102, 246, 135, 255, 255,
+	82, 135, 37, 255, 87, 255, 86, 54, 95, 79, 53, 120, 79, 118, 255, 255,
+	84, 116, 255, 243, 154, 37, 47, 159, 148, 127, 165, 246, 247, 249, 255, 255,
+	86, 164, 246, 167, 31, 159, 130, 137, 149, 143, 101, 250, 255, 255, 255, 255,
+	118, 166, 138, 177, 153, 244, 175, 171, 166, 127, 167, 162, 250, 248, 255, 255,
+	99, 103, 119, 104, 86, 179, 86, 38, 121, 43, 84, 151, 120, 138, 170, 251,
+	67, 244, 143, 39, 255, 132, 127, 255, 245, 239, 40, 245, 255, 248, 255, 223,
+	68, 100, 127, 245, 102, 243, 95, 90, 242, 47, 150, 245, 250, 168, 255, 255,
+	86, 84, 255, 149, 136, 245, 63, 31, 244, 127, 104, 246, 249, 255, 255, 255,
+	83, 99, 76, 246, 93, 255, 86, 38, 119, 63, 84, 255, 248, 246, 255, 255,
+	204, 67, 255, 242, 255, 242, 246, 86, 83, 111, 247, 107, 245, 255, 255, 239,
+	67, 242, 159, 243, 143, 245, 133, 137, 99, 79, 86, 243, 247, 137, 255, 255,
+	84, 148, 103, 148, 147, 131, 39, 104, 132, 175, 87, 149, 250, 152, 255, 255,
+	83, 67, 250, 148, 255, 245, 170, 114, 52, 171, 151, 247, 249, 249, 159, 255,
+	65, 197, 104, 67, 180, 149, 152, 60, 183, 255, 68, 138, 250, 168, 255, 255,
+	100, 239, 88, 103, 246, 255, 50, 69, 87, 87, 53, 133, 255, 119, 255, 255,
+	85, 166, 119, 67, 143, 244, 122, 170, 69, 127, 25, 248, 251, 247, 143, 255,
+	84, 117, 57, 132, 85, 147, 119, 115, 165, 111, 53, 184, 248, 117, 111, 191,
+	67, 245, 248, 148, 87, 242, 118, 103, 117, 139, 36, 168, 250, 248, 255, 255,
+	84, 244, 191, 242, 79, 148, 107, 143, 243, 143, 70, 245, 244, 106, 255, 255,
+	83, 100, 117, 101, 117, 118, 86, 69, 89, 63, 37, 127, 137, 120, 255, 255,
+	84, 241, 245, 243, 248, 243, 127, 105, 84, 143, 244, 247, 255, 248, 255, 255,
+	51, 243, 127, 131, 120, 132, 95, 47, 244, 143, 243, 248, 255, 247, 255, 255,
+	67, 241, 95, 245, 255, 245, 255, 220, 99, 79, 204, 244, 255, 255, 255, 255,
+	135, 245, 255, 240, 247, 148, 255, 255, 244, 255, 239, 247, 255, 248, 255, 255,
+	33, 53, 255, 243, 102, 253, 223, 255, 111, 255, 229, 255, 255, 255, 255, 255,
+	50, 84, 70, 101, 104, 149, 86, 86, 86, 103, 100, 102, 152, 120, 255, 255,
+	117, 151, 116, 185, 119, 151, 50, 70, 90, 57, 51, 135, 169, 136, 252, 255,
+	35, 252, 255, 118, 79, 246, 70, 247, 242, 63, 244, 255, 127, 255, 255, 255,
+	83, 185, 116, 167, 118, 242, 55, 55, 169, 41, 101, 169, 168, 74, 255, 255,
+	101, 97, 255, 165, 255, 246, 143, 255, 149, 255, 56, 242, 255, 79, 111, 223,
+	34, 252, 246, 250, 255, 245, 127, 116, 45, 63, 214, 124, 255, 255, 255, 223,
+	51, 242, 249, 244, 255, 243, 207, 143, 242, 95, 207, 147, 255, 246, 255, 247,
+	68, 133, 53, 242, 247, 127, 69, 55, 72, 90, 69, 135, 143, 121, 255, 255,
+	220, 244, 242, 251, 225, 244, 239, 255, 245, 223, 119, 253, 255, 255, 255, 254,
+	86, 242, 255, 242, 255, 114, 223, 255, 245, 255, 223, 100, 159, 101, 255, 249,
+	117, 168, 102, 191, 136, 245, 71, 53, 87, 42, 50, 184, 247, 248, 255, 255,
+	119, 247, 152, 241, 255, 244, 79, 249, 132, 217, 84, 148, 255, 152, 255, 255,
+	121, 242, 250, 116, 250, 243, 255, 207, 242, 255, 159, 245, 255, 255, 95, 63,
+	51, 245, 247, 100, 95, 246, 131, 246, 231, 255, 23, 143, 255, 255, 255, 255,
+	68, 135, 159, 246, 159, 240, 186, 154, 132, 255, 244, 185, 187, 249, 255, 255,
+	69, 36, 120, 85, 248, 247, 71, 54, 249, 57, 84, 255, 255, 246, 255, 255,
+	49, 114, 102, 118, 126, 254, 254, 126, 238, 111, 230, 118, 255, 244, 255, 255,
+	100, 72, 85, 121, 101, 134, 53, 52, 104, 58, 52, 116, 135, 135, 252, 255,
+	100, 102, 99, 99, 132, 169, 86, 53, 117, 90, 67, 105, 137, 121, 252, 255,
+	100, 87, 69, 105, 118, 136, 69, 36, 71, 58, 85, 102, 151, 120, 248, 255,
+	110, 115, 159, 145, 255, 242, 255, 142, 246, 239, 137, 255, 255, 255, 255, 255,
+	65, 100, 86, 118, 150, 132, 117, 86, 102, 107, 101, 135, 248, 106, 255, 175,
+	99, 74, 83, 120, 100, 118, 69, 52, 89, 90, 70, 116, 246, 135, 255, 255,
+	55, 243, 250, 241, 153, 146, 105, 250, 245, 95, 154, 245, 249, 247, 175, 255,
+	70, 246, 255, 243, 15, 247, 127, 175, 244, 255, 250, 169, 255, 255, 255, 255,
+	66, 165, 207, 129, 154, 165, 89, 103, 167, 127, 183, 168, 246, 202, 207, 249,
+	99, 101, 117, 87, 181, 163, 117, 37, 70, 88, 100, 120, 169, 153, 252, 255,
+	99, 243, 247, 147, 255, 136, 90, 255, 242, 143, 119, 247, 111, 249, 111, 63,
+	69, 179, 255, 162, 143, 245, 95, 175, 150, 111, 167, 178, 255, 250, 95, 250,
+	119, 241, 255, 242, 255, 245, 239, 159, 244, 127, 234, 247, 250, 249, 111, 247,
+	83, 84, 99, 83, 164, 143, 134, 53, 86, 153, 68, 104, 154, 119, 255, 255,
+	99, 147, 175, 163, 127, 243, 73, 53, 165, 143, 69, 148, 248, 89, 255, 151,
+	83, 129, 175, 132, 255, 242, 255, 249, 149, 255, 230, 249, 255, 255, 95, 255,
+	100, 129, 159, 116, 169, 243, 127, 105, 245, 175, 104, 165, 249, 248, 159, 246,
+	66, 131, 143, 130, 187, 149, 159, 170, 166, 255, 72, 147, 250, 255, 255, 255,
+	99, 70, 101, 122, 116, 120, 69, 68, 85, 76, 68, 85, 103, 72, 244, 255,
+	85, 243, 245, 102, 127, 246, 111, 246, 228, 31, 215, 245, 255, 255, 255, 255,
+	118, 147, 104, 242, 137, 243, 138, 121, 131, 255, 72, 163, 249, 164, 255, 159,
+	100, 246, 242, 163, 127, 243, 199, 251, 70, 191, 42, 148, 250, 172, 175, 255,
+	49, 166, 153, 130, 104, 243, 140, 159, 184, 108, 150, 166, 249, 135, 159, 223,
+	101, 119, 132, 56, 135, 168, 133, 21, 74, 143, 117, 187, 184, 138, 255, 255,
+	95, 244, 255, 240, 255, 243, 255, 159, 149, 159, 255, 255, 255, 255, 255, 255,
+	121, 242, 255, 241, 175, 248, 255, 255, 248, 191, 255, 251, 159, 255, 111, 143,
+	33, 245, 151, 255, 248, 248, 143, 133, 87, 255, 135, 158, 249, 255, 255, 255,
+	118, 183, 255, 128, 255, 247, 191, 255, 248, 255, 123, 244, 244, 185, 143, 246,
+	255, 255, 153, 63, 210, 245, 239, 47, 143, 63, 53, 245, 255, 111, 255, 255,
+	255, 255, 253, 71, 252, 246, 255, 85, 255, 207, 213, 255, 255, 255, 240, 247,
+	255, 127, 241, 31, 95, 255, 223, 79, 255, 223, 249, 255, 255, 255, 250, 255,
+	65, 102, 85, 118, 102, 166, 118, 86, 102, 106, 85, 119, 167, 120, 255, 159,
+	84, 86, 118, 121, 118, 149, 69, 34, 105, 79, 69, 101, 135, 246, 255, 255,
+	52, 242, 248, 113, 255, 244, 111, 255, 247, 127, 255, 245, 255, 246, 143, 95,
+	170, 247, 191, 252, 15, 216, 202, 253, 247, 143, 204, 252, 255, 255, 255, 255,
+	86, 241, 255, 245, 255, 247, 255, 248, 246, 31, 255, 249, 255, 255, 255, 255,
+	83, 152, 151, 136, 120, 196, 38, 37, 139, 56, 53, 137, 154, 153, 255, 255,
+	109, 244, 143, 227, 127, 117, 127, 255, 244, 143, 239, 246, 255, 255, 255, 31,
+	168, 241, 255, 161, 255, 247, 255, 250, 249, 111, 250, 248, 255, 255, 255, 249,
+	51, 162, 137, 163, 255, 243, 135, 150, 244, 105, 105, 101, 247, 249, 127, 255,
+	133, 135, 116, 210, 147, 170, 103, 54, 147, 124, 67, 122, 122, 137, 223, 255,
+	69, 162, 255, 243, 127, 243, 127, 175, 131, 47, 71, 246, 249, 249, 255, 255,
+	54, 241, 255, 148, 255, 243, 217, 247, 147, 255, 159, 247, 255, 255, 95, 150,
+	91, 82, 255, 243, 255, 244, 255, 136, 130, 255, 127, 244, 255, 255, 111, 127,
+	51, 241, 207, 245, 248, 243, 255, 232, 245, 255, 222, 242, 255, 255, 255, 255,
+	83, 120, 132, 57, 166, 255, 39, 54, 88, 58, 103, 115, 245, 104, 255, 255,
+	102, 243, 155, 130, 159, 245, 127, 159, 246, 31, 250, 245, 255, 255, 127, 191,
+	53, 242, 214, 129, 254, 243, 255, 239, 117, 255, 221, 104, 255, 239, 95, 255,
+	99, 149, 182, 145, 120, 244, 105, 153, 117, 159, 90, 182, 244, 199, 255, 207,
+	66, 163, 139, 146, 152, 196, 90, 138, 150, 76, 183, 167, 251, 167, 111, 90,
+	100, 54, 82, 102, 247, 248, 86, 51, 89, 74, 134, 136, 183, 250, 255, 255,
+	55, 242, 151, 241, 248, 247, 255, 255, 245, 159, 255, 159, 159, 255, 255, 255,
+	105, 243, 111, 243, 255, 245, 255, 255, 145, 255, 159, 255, 255, 255, 79, 69,
+	101, 247, 154, 247, 255, 255, 121, 34, 239, 95, 161, 255, 255, 255, 255, 255,
+	104, 245, 255, 241, 255, 248, 255, 255, 118, 255, 127, 242, 244, 255, 127, 134,
+	255, 255, 227, 239, 108, 254, 207, 63, 255, 191, 22, 245, 255, 255, 254, 255,
+	255, 127, 8, 255, 238, 255, 223, 249, 255, 207, 237, 255, 255, 255, 255, 255,
+	65, 85, 87, 119, 118, 150, 118, 102, 103, 105, 86, 103, 152, 137, 207, 204,
+	84, 71, 103, 139, 132, 132, 54, 53, 104, 59, 52, 134, 103, 136, 255, 255,
+	101, 85, 159, 255, 15, 255, 126, 255, 87, 143, 255, 255, 249, 255, 255, 255,
+	71, 66, 255, 241, 255, 243, 255, 255, 244, 143, 255, 246, 255, 255, 255, 255,
+	82, 170, 135, 187, 136, 195, 69, 37, 123, 63, 85, 184, 107, 188, 255, 239,
+	71, 245, 255, 240, 255, 246, 127, 255, 245, 95, 153, 255, 255, 255, 127, 143,
+	215, 246, 255, 241, 255, 245, 63, 223, 254, 47, 68, 247, 255, 255, 255, 223,
+	67, 242, 143, 242, 255, 244, 143, 148, 147, 95, 233, 245, 248, 248, 63, 159,
+	117, 101, 150, 67, 242, 154, 103, 84, 130, 138, 116, 74, 201, 139, 255, 255,
+	52, 243, 175, 243, 255, 241, 175, 255, 246, 250, 229, 250, 255, 248, 127, 250,
+	107, 193, 255, 244, 255, 245, 63, 252, 67, 255, 255, 245, 255, 255, 255, 247,
+	101, 241, 207, 243, 252, 130, 255, 223, 244, 143, 215, 245, 255, 255, 255, 255,
+	83, 104, 119, 111, 134, 152, 83, 68, 71, 47, 85, 102, 247, 171, 250, 255,
+	35, 242, 247, 85, 246, 245, 87, 244, 232, 79, 196, 244, 248, 255, 255, 255,
+	103, 161, 169, 162, 246, 242, 175, 155, 243, 255, 175, 244, 255, 167, 79, 248,
+	66, 117, 130, 133, 121, 245, 133, 135, 71, 143, 71, 71, 247, 119, 127, 255,
+	99, 164, 95, 113, 154, 244, 95, 255, 86, 79, 245, 248, 249, 245, 255, 175,
+	100, 115, 138, 99, 150, 136, 118, 36, 105, 47, 84, 159, 152, 168, 255, 255,
+	255, 241, 255, 241, 255, 245, 255, 255, 243, 255, 255, 249, 255, 255, 255, 248,
+	51, 246, 143, 246, 255, 249, 119, 126, 31, 127, 232, 136, 255, 255, 255, 255,
+	117, 118, 127, 241, 159, 247, 95, 249, 168, 207, 43, 132, 246, 159, 207, 207,
+	255, 143, 255, 255, 197, 248, 223, 31, 255, 95, 31, 247, 255, 255, 255, 255,
+	255, 95, 229, 255, 231, 255, 223, 244, 255, 79, 13, 255, 255, 255, 255, 255,
+	81, 100, 117, 117, 118, 247, 102, 69, 116, 88, 101, 246, 119, 118, 143, 255,
+	50, 127, 102, 191, 136, 119, 39, 54, 127, 79, 53, 103, 143, 165, 255, 255,
+	117, 132, 255, 243, 255, 115, 42, 147, 151, 111, 54, 164, 255, 249, 255, 159,
+	120, 244, 249, 248, 31, 247, 130, 255, 165, 159, 143, 246, 249, 249, 255, 255,
+	84, 130, 255, 131, 105, 98, 143, 245, 100, 127, 119, 131, 255, 143, 255, 255,
+	99, 107, 136, 250, 136, 248, 26, 57, 250, 47, 100, 120, 255, 122, 255, 255,
+	65, 119, 127, 67, 132, 247, 75, 143, 182, 79, 86, 186, 247, 111, 143, 79,
+	83, 131, 255, 242, 103, 244, 127, 250, 166, 63, 54, 163, 248, 153, 159, 255,
+	52, 243, 255, 243, 111, 244, 111, 111, 244, 47, 190, 243, 245, 255, 239, 255,
+	83, 101, 53, 245, 101, 143, 55, 53, 119, 72, 68, 111, 255, 118, 255, 255,
+	67, 242, 143, 245, 95, 244, 135, 136, 101, 95, 56, 242, 245, 255, 255, 127,
+	67, 115, 88, 83, 166, 244, 55, 121, 165, 191, 54, 164, 251, 248, 63, 255,
+	82, 52, 187, 130, 180, 246, 105, 163, 104, 171, 133, 246, 246, 140, 127, 159,
+	118, 86, 41, 149, 177, 150, 149, 153, 169, 157, 54, 120, 218, 137, 175, 255,
+	82, 223, 87, 239, 254, 79, 101, 70, 95, 47, 54, 103, 255, 246, 255, 255,
+	69, 149, 74, 165, 133, 244, 95, 154, 23, 127, 52, 246, 255, 247, 255, 255,
+	82, 132, 51, 149, 150, 131, 87, 119, 151, 127, 133, 165, 203, 105, 255, 79,
+	66, 116, 86, 68, 82, 246, 120, 159, 136, 122, 67, 199, 245, 105, 111, 255,
+	83, 149, 183, 99, 79, 244, 111, 137, 180, 127, 100, 149, 250, 27, 255, 255,
+	100, 85, 117, 69, 149, 150, 86, 36, 105, 59, 67, 154, 152, 136, 248, 255,
+	245, 241, 255, 242, 255, 244, 255, 255, 246, 255, 246, 247, 255, 255, 95, 255,
+	18, 252, 254, 211, 255, 244, 255, 254, 198, 255, 79, 254, 255, 254, 255, 255,
+	84, 241, 255, 245, 111, 244, 255, 92, 179, 239, 199, 242, 255, 255, 255, 255,
+	83, 244, 255, 243, 243, 98, 111, 246, 244, 255, 207, 244, 253, 111, 255, 255,
+	212, 239, 255, 240, 255, 247, 239, 255, 255, 255, 255, 255, 255, 111, 255, 255,
+	34, 118, 100, 85, 119, 246, 117, 79, 117, 72, 101, 111, 247, 255, 255, 143,
+	99, 248, 39, 138, 247, 134, 55, 56, 166, 47, 85, 135, 249, 248, 255, 255,
+	117, 249, 153, 250, 155, 184, 122, 89, 191, 12, 135, 191, 255, 249, 255, 255,
+	85, 133, 52, 161, 136, 135, 71, 57, 154, 79, 84, 143, 255, 143, 255, 255,
+	150, 191, 140, 255, 184, 153, 73, 21, 191, 47, 153, 251, 255, 249, 255, 255,
+	34, 252, 250, 246, 222, 247, 241, 255, 221, 127, 172, 253, 254, 254, 255, 255,
+	65, 69, 70, 127, 245, 245, 143, 88, 69, 79, 85, 134, 255, 95, 255, 255,
+	99, 136, 118, 170, 70, 133, 69, 54, 138, 27, 101, 152, 184, 133, 255, 255,
+	150, 138, 102, 251, 182, 163, 111, 42, 188, 31, 148, 255, 204, 187, 255, 255,
+	134, 249, 70, 242, 249, 154, 120, 73, 159, 31, 115, 255, 175, 248, 251, 255,
+	100, 111, 165, 159, 87, 134, 69, 86, 248, 25, 111, 250, 255, 248, 255, 255,
+	151, 249, 127, 255, 255, 143, 127, 70, 255, 15, 119, 159, 255, 159, 255, 255,
+	255, 127, 247, 255, 6, 255, 223, 127, 255, 79, 143, 255, 255, 255, 255, 255,
+	255, 191, 204, 223, 204, 255, 191, 47, 239, 15, 203, 255, 255, 255, 255, 255,
+	50, 85, 55, 101, 159, 246, 134, 133, 102, 95, 99, 111, 150, 86, 255, 255,
+	100, 119, 35, 255, 230, 254, 115, 52, 239, 71, 86, 107, 255, 246, 255, 255,
+	50, 239, 98, 239, 222, 251, 94, 83, 255, 79, 69, 255, 246, 255, 255, 255,
+	101, 148, 245, 248, 254, 247, 102, 83, 143, 127, 65, 255, 255, 255, 255, 255,
+	84, 244, 255, 195, 223, 244, 63, 247, 209, 79, 182, 252, 255, 255, 255, 255,
+	50, 135, 127, 129, 255, 254, 88, 247, 136, 79, 246, 135, 255, 143, 255, 255,
+	65, 85, 102, 119, 127, 245, 87, 52, 70, 105, 116, 87, 255, 143, 255, 255,
+	82, 88, 118, 153, 69, 248, 68, 36, 102, 72, 86, 134, 149, 121, 255, 255,
+	227, 239, 118, 247, 102, 245, 69, 36, 117, 54, 116, 103, 247, 136, 255, 255,
+	66, 247, 92, 252, 102, 255, 85, 37, 125, 79, 197, 95, 247, 87, 255, 255,
+	84, 5, 255, 245, 255, 246, 88, 246, 134, 143, 255, 142, 255, 249, 255, 255,
+	102, 244, 194, 244, 245, 253, 255, 231, 243, 255, 23, 254, 104, 247, 255, 255,
+	66, 102, 118, 255, 245, 119, 85, 53, 223, 55, 69, 244, 255, 118, 255, 255,
+	49, 119, 255, 243, 127, 248, 249, 143, 247, 111, 69, 248, 255, 159, 159, 255,
+	68, 249, 246, 246, 159, 244, 137, 255, 134, 255, 14, 111, 255, 249, 255, 255,
+	235, 243, 255, 240, 111, 119, 255, 255, 247, 127, 118, 248, 255, 231, 255, 255,
+	67, 117, 244, 214, 68, 248, 68, 69, 63, 71, 70, 255, 246, 247, 255, 255,
+	49, 54, 103, 247, 247, 246, 118, 88, 118, 79, 135, 119, 134, 127, 255, 255,
+	116, 104, 134, 250, 22, 152, 87, 70, 41, 89, 87, 135, 136, 119, 255, 255,
+	133, 188, 139, 251, 201, 241, 105, 41, 106, 63, 197, 244, 255, 255, 255, 255,
+	199, 243, 255, 244, 255, 245, 191, 207, 243, 207, 110, 241, 255, 247, 239, 255,
+	117, 117, 136, 49, 133, 249, 105, 84, 95, 79, 70, 255, 255, 159, 255, 255,
+	76, 229, 239, 250, 253, 240, 207, 255, 243, 255, 189, 253, 255, 255, 255, 222,
+	67, 118, 222, 255, 244, 247, 72, 37, 118, 83, 86, 100, 255, 245, 255, 255,
+	33, 250, 255, 242, 255, 254, 175, 250, 255, 255, 255, 255, 255, 248, 255, 255,
+	114, 122, 188, 71, 147, 255, 87, 67, 167, 63, 131, 175, 246, 127, 255, 255,
+	95, 246, 255, 242, 255, 241, 255, 255, 254, 255, 255, 245, 255, 255, 255, 255,
+	255, 255, 252, 191, 226, 246, 255, 95, 255, 191, 192, 255, 255, 255, 252, 255,
+	49, 101, 102, 118, 118, 150, 118, 86, 102, 105, 101, 119, 152, 121, 207, 189,
+	82, 255, 255, 255, 255, 253, 255, 41, 255, 31, 248, 255, 255, 255, 255, 255,
+	220, 252, 255, 241, 255, 253, 111, 239, 254, 223, 51, 248, 255, 243, 255, 223,
+	237, 253, 255, 246, 255, 244, 31, 63, 255, 47, 143, 255, 255, 255, 255, 255,
+	237, 252, 255, 247, 255, 244, 63, 255, 254, 255, 4, 142, 255, 127, 255, 255,
+	245, 255, 31, 246, 242, 245, 245, 255, 255, 255, 255, 255, 255, 111, 255, 255,
+	102, 105, 31, 145, 249, 136, 246, 103, 111, 255, 89, 119, 249, 143, 255, 247,
+	82, 253, 248, 242, 95, 245, 255, 255, 255, 239, 99, 255, 255, 47, 255, 255,
+	254, 253, 255, 254, 31, 255, 241, 255, 253, 255, 255, 255, 255, 255, 255, 255,
+	253, 253, 255, 11, 255, 253, 239, 255, 253, 239, 239, 247, 255, 255, 255, 207,
+	236, 253, 255, 244, 255, 253, 15, 239, 247, 239, 238, 254, 255, 255, 255, 239,
+	219, 254, 111, 253, 253, 243, 104, 15, 255, 255, 223, 255, 255, 255, 255, 255,
+	107, 125, 24, 243, 247, 245, 255, 104, 110, 255, 40, 247, 255, 143, 255, 255,
+	253, 143, 241, 244, 255, 243, 255, 255, 255, 255, 40, 244, 255, 255, 255, 255,
+	219, 247, 255, 246, 239, 240, 127, 255, 254, 239, 238, 254, 255, 143, 255, 255,
+	220, 239, 255, 240, 255, 254, 239, 255, 255, 255, 95, 255, 255, 255, 255, 255,
+	255, 249, 255, 240, 255, 254, 111, 255, 255, 111, 250, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 79, 255, 240, 255, 254, 255, 255, 255, 255, 255, 255, 255,
+	39, 117, 255, 251, 135, 244, 39, 249, 244, 151, 133, 248, 243, 143, 255, 244,
+	253, 141, 255, 225, 255, 253, 255, 255, 253, 239, 35, 242, 247, 255, 255, 207,
+	237, 40, 255, 241, 255, 247, 111, 255, 255, 239, 63, 245, 255, 255, 255, 255,
+	247, 254, 255, 246, 255, 254, 223, 255, 255, 15, 223, 255, 255, 159, 255, 255,
+	255, 255, 255, 254, 255, 254, 79, 255, 255, 255, 15, 250, 255, 255, 255, 255,
+	85, 252, 63, 60, 241, 252, 255, 127, 254, 255, 194, 253, 255, 239, 255, 255,
+	221, 251, 255, 11, 239, 252, 239, 255, 214, 191, 207, 252, 255, 255, 255, 255,
+	144, 255, 95, 111, 249, 249, 166, 255, 251, 255, 185, 255, 255, 111, 255, 255,
+	254, 255, 254, 250, 175, 255, 255, 255, 255, 255, 96, 255, 255, 255, 255, 255,
+	236, 247, 255, 252, 255, 253, 159, 255, 255, 255, 143, 255, 255, 15, 255, 255,
+};
+
+static const UTF16 kLettersFr [30] =
+{
+	0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C,
+	0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+	0x0079, 0x007A, 0x00E0, 0x00E8, 0x00E9, 0x00EA,
+};
+
+static const uint16_t kContextsFr [1024] =
+{
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	0, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+	47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 29, 60, 61,
+	0, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+	77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 59, 29, 89, 61,
+	0, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+	105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 58, 59, 29, 116, 61,
+	0, 117, 118, 92, 119, 94, 120, 96, 97, 121, 122, 42, 123, 124, 103, 104,
+	125, 126, 107, 127, 128, 129, 130, 112, 113, 114, 115, 58, 59, 131, 132, 61,
+	0, 133, 134, 92, 93, 135, 136, 96, 97, 137, 138, 139, 101, 140, 103, 104,
+	141, 142, 107, 143, 144, 145, 146, 112, 147, 114, 148, 58, 59, 149, 150, 61,
+	0, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165,
+	166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 59, 29, 89, 61,
+	0, 178, 179, 92, 93, 180, 181, 182, 97, 98, 183, 42, 101, 184, 103, 104,
+	185, 186, 107, 187, 188, 145, 189, 112, 113, 114, 115, 58, 59, 29, 190, 61,
+	0, 191, 192, 193, 93, 94, 194, 96, 195, 196, 197, 42, 101, 198, 199, 200,
+	201, 202, 107, 203, 204, 205, 206, 112, 113, 114, 115, 58, 59, 29, 207, 61,
+	0, 208, 209, 92, 93, 94, 210, 96, 97, 98, 211, 42, 101, 212, 213, 104,
+	214, 106, 107, 215, 216, 217, 218, 112, 113, 114, 115, 58, 59, 219, 220, 61,
+	0, 221, 222, 223, 224, 225, 226, 227, 228, 98, 229, 42, 230, 231, 232, 233,
+	234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 59, 246, 247, 61,
+	0, 248, 249, 92, 93, 94, 250, 96, 97, 98, 251, 42, 101, 212, 103, 104,
+	252, 106, 107, 253, 216, 145, 254, 112, 113, 114, 115, 58, 255, 29, 89, 61,
+	0, 256, 257, 92, 93, 94, 258, 96, 97, 259, 260, 42, 101, 212, 103, 104,
+	261, 106, 107, 262, 263, 145, 264, 112, 265, 114, 115, 58, 59, 29, 89, 61,
+	0, 266, 267, 268, 269, 270, 271, 272, 273, 98, 274, 42, 101, 275, 276, 104,
+	277, 278, 107, 253, 279, 280, 281, 112, 113, 114, 282, 58, 59, 283, 284, 61,
+	0, 285, 286, 287, 93, 94, 288, 96, 97, 98, 289, 42, 101, 290, 291, 104,
+	292, 293, 107, 253, 294, 295, 296, 112, 113, 114, 115, 58, 59, 297, 298, 299,
+	0, 300, 301, 92, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 103, 312,
+	313, 106, 314, 315, 316, 317, 318, 319, 113, 114, 320, 321, 59, 29, 322, 61,
+	0, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+	338, 339, 340, 341, 342, 343, 344, 345, 346, 114, 347, 58, 59, 29, 89, 61,
+	0, 348, 349, 92, 350, 94, 351, 96, 352, 353, 354, 42, 355, 356, 103, 104,
+	357, 358, 107, 359, 360, 361, 362, 112, 113, 114, 115, 58, 59, 29, 363, 61,
+	0, 364, 365, 92, 93, 94, 328, 96, 97, 98, 366, 42, 101, 212, 103, 104,
+	367, 106, 107, 253, 216, 145, 368, 112, 113, 114, 115, 58, 59, 29, 89, 61,
+	0, 369, 370, 371, 372, 373, 374, 375, 376, 98, 377, 42, 378, 379, 380, 381,
+	382, 383, 384, 385, 386, 387, 388, 389, 113, 114, 390, 58, 59, 391, 392, 393,
+	0, 394, 395, 92, 396, 94, 397, 398, 97, 399, 400, 42, 401, 402, 403, 404,
+	405, 406, 407, 408, 409, 410, 411, 112, 113, 114, 412, 58, 59, 29, 413, 61,
+	0, 414, 415, 92, 416, 417, 418, 419, 97, 420, 421, 42, 101, 422, 423, 104,
+	424, 425, 107, 426, 427, 428, 429, 112, 113, 114, 430, 58, 59, 431, 432, 61,
+	0, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
+	448, 449, 107, 450, 451, 452, 453, 454, 455, 456, 457, 458, 59, 29, 459, 61,
+	0, 460, 461, 92, 93, 94, 462, 96, 97, 98, 463, 42, 101, 212, 103, 104,
+	464, 106, 107, 465, 216, 145, 453, 112, 113, 114, 115, 58, 59, 29, 466, 61,
+	0, 467, 468, 92, 93, 94, 469, 96, 97, 98, 470, 42, 101, 212, 103, 104,
+	471, 106, 107, 253, 216, 145, 453, 112, 113, 114, 115, 58, 59, 29, 89, 61,
+	0, 472, 473, 92, 474, 94, 475, 96, 97, 98, 476, 42, 101, 212, 103, 104,
+	367, 477, 107, 253, 216, 478, 453, 112, 113, 114, 115, 58, 59, 29, 479, 61,
+	0, 480, 481, 92, 93, 94, 482, 96, 97, 98, 483, 42, 101, 484, 485, 486,
+	487, 488, 107, 253, 489, 145, 490, 112, 113, 114, 115, 58, 59, 29, 89, 61,
+	0, 491, 492, 92, 93, 94, 493, 96, 97, 494, 495, 42, 101, 212, 103, 104,
+	496, 106, 107, 253, 216, 145, 453, 112, 113, 114, 115, 58, 59, 29, 497, 61,
+	0, 364, 365, 92, 93, 94, 328, 96, 97, 98, 366, 42, 101, 212, 103, 104,
+	367, 106, 107, 253, 216, 145, 453, 112, 113, 114, 115, 58, 59, 29, 89, 61,
+	0, 364, 365, 92, 93, 94, 328, 96, 498, 98, 366, 42, 101, 499, 500, 104,
+	367, 106, 501, 502, 503, 504, 453, 112, 113, 114, 115, 58, 59, 29, 89, 61,
+	0, 505, 506, 507, 508, 509, 510, 511, 512, 98, 366, 513, 101, 514, 515, 516,
+	517, 518, 519, 520, 521, 522, 453, 523, 113, 114, 115, 58, 59, 29, 524, 61,
+	0, 364, 365, 92, 93, 94, 328, 96, 97, 98, 366, 42, 101, 212, 525, 104,
+	367, 106, 107, 253, 216, 526, 453, 112, 113, 114, 115, 58, 59, 29, 89, 61,
+};
+
+static const uint8_t kCostsFr [8432] =
+{
+	63, 100, 52, 85, 118, 133, 55, 85, 70, 87, 84, 101, 152, 153, 215, 135,
+	49, 134, 102, 119, 151, 167, 105, 119, 103, 121, 118, 135, 121, 170, 219, 249,
+	116, 90, 84, 75, 151, 103, 72, 70, 74, 61, 69, 51, 184, 151, 255, 255,
+	53, 242, 188, 116, 122, 194, 77, 171, 163, 63, 135, 244, 152, 137, 255, 247,
+	121, 195, 138, 179, 60, 246, 76, 250, 113, 79, 137, 199, 220, 251, 253, 250,
+	55, 228, 221, 225, 174, 181, 173, 173, 148, 143, 169, 180, 233, 184, 239, 243,
+	137, 153, 136, 108, 169, 169, 106, 38, 153, 61, 50, 168, 59, 189, 255, 255,
+	137, 243, 123, 181, 250, 193, 95, 218, 114, 91, 151, 244, 219, 251, 191, 248,
+	104, 83, 151, 164, 111, 179, 95, 89, 84, 47, 150, 164, 247, 121, 143, 163,
+	88, 242, 153, 147, 143, 244, 139, 245, 146, 127, 88, 179, 248, 248, 249, 246,
+	153, 137, 71, 137, 164, 170, 88, 18, 122, 123, 118, 170, 153, 170, 255, 255,
+	88, 130, 248, 243, 143, 148, 255, 152, 113, 159, 247, 163, 249, 255, 255, 248,
+	103, 114, 171, 180, 73, 243, 122, 154, 99, 91, 185, 163, 165, 247, 255, 248,
+	58, 226, 139, 177, 191, 195, 191, 203, 196, 191, 169, 247, 172, 187, 253, 250,
+	121, 97, 137, 164, 204, 195, 170, 136, 130, 172, 152, 148, 185, 186, 207, 100,
+	38, 164, 122, 178, 182, 165, 185, 188, 225, 191, 121, 244, 255, 167, 255, 229,
+	103, 58, 115, 107, 151, 136, 119, 86, 41, 79, 103, 146, 186, 170, 255, 255,
+	154, 193, 183, 195, 106, 229, 73, 203, 162, 61, 151, 245, 249, 250, 255, 248,
+	134, 246, 187, 250, 255, 246, 255, 255, 249, 155, 159, 176, 248, 255, 255, 255,
+	104, 244, 152, 161, 157, 198, 175, 169, 149, 188, 169, 166, 185, 220, 127, 241,
+	104, 211, 182, 178, 92, 211, 137, 185, 83, 154, 72, 146, 249, 180, 255, 245,
+	103, 178, 183, 195, 91, 213, 109, 186, 163, 47, 135, 181, 218, 163, 250, 150,
+	101, 122, 153, 191, 187, 183, 120, 24, 143, 111, 38, 186, 207, 186, 255, 255,
+	121, 162, 170, 130, 223, 243, 159, 168, 131, 111, 168, 216, 204, 251, 255, 244,
+	118, 161, 150, 244, 102, 243, 255, 168, 163, 95, 250, 245, 250, 248, 127, 255,
+	34, 116, 118, 134, 119, 243, 127, 245, 102, 159, 86, 247, 149, 95, 255, 248,
+	99, 241, 255, 244, 255, 243, 255, 237, 147, 255, 254, 131, 248, 137, 255, 119,
+	85, 129, 127, 117, 57, 244, 105, 154, 243, 137, 246, 118, 255, 248, 255, 243,
+	144, 255, 255, 255, 175, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	248, 175, 104, 255, 245, 255, 88, 115, 250, 35, 51, 124, 250, 159, 207, 255,
+	152, 156, 81, 150, 246, 207, 79, 117, 89, 134, 39, 92, 249, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 245, 255, 255, 15, 255, 255, 255, 255, 255,
+	17, 135, 119, 119, 136, 184, 120, 121, 136, 138, 117, 137, 122, 170, 255, 252,
+	99, 90, 68, 90, 150, 100, 73, 69, 73, 42, 85, 84, 175, 137, 255, 255,
+	52, 147, 152, 83, 249, 243, 79, 248, 244, 79, 132, 243, 111, 119, 255, 247,
+	68, 163, 120, 101, 37, 249, 88, 153, 81, 95, 104, 247, 249, 248, 255, 250,
+	67, 116, 143, 146, 127, 131, 175, 167, 132, 111, 166, 86, 249, 246, 255, 242,
+	102, 122, 152, 122, 122, 169, 108, 37, 152, 91, 129, 137, 47, 188, 255, 255,
+	68, 244, 104, 118, 249, 241, 79, 102, 84, 63, 134, 245, 255, 255, 255, 255,
+	69, 101, 119, 116, 111, 145, 95, 79, 84, 79, 103, 243, 249, 143, 255, 248,
+	36, 147, 101, 242, 127, 242, 103, 153, 131, 255, 103, 246, 246, 249, 255, 245,
+	101, 137, 70, 119, 166, 169, 79, 20, 136, 127, 102, 121, 123, 153, 255, 255,
+	85, 131, 137, 242, 139, 148, 186, 136, 114, 143, 183, 163, 249, 202, 244, 250,
+	50, 131, 143, 243, 88, 243, 103, 119, 99, 79, 246, 247, 255, 255, 255, 247,
+	69, 147, 103, 129, 169, 243, 127, 136, 131, 175, 118, 166, 167, 154, 255, 255,
+	68, 97, 120, 131, 143, 244, 248, 150, 131, 159, 149, 245, 153, 247, 255, 134,
+	50, 132, 136, 242, 101, 245, 171, 123, 162, 143, 123, 245, 187, 152, 255, 247,
+	85, 56, 148, 111, 249, 167, 137, 87, 26, 79, 151, 114, 251, 159, 255, 255,
+	101, 241, 118, 245, 89, 245, 87, 250, 99, 42, 134, 245, 249, 250, 255, 247,
+	35, 255, 255, 255, 255, 255, 255, 95, 255, 255, 255, 242, 242, 245, 255, 255,
+	51, 116, 104, 114, 103, 245, 167, 102, 244, 175, 133, 118, 135, 175, 255, 243,
+	50, 148, 134, 131, 95, 244, 120, 138, 84, 155, 55, 164, 170, 132, 175, 248,
+	66, 163, 133, 243, 127, 245, 95, 247, 244, 79, 149, 247, 143, 164, 255, 150,
+	84, 159, 103, 183, 154, 245, 169, 24, 127, 79, 36, 168, 191, 255, 255, 250,
+	51, 242, 249, 99, 255, 243, 159, 244, 116, 127, 118, 249, 159, 255, 255, 247,
+	35, 114, 87, 245, 118, 243, 245, 111, 116, 95, 254, 245, 103, 255, 255, 255,
+	49, 248, 150, 89, 120, 246, 255, 246, 121, 159, 135, 159, 111, 105, 255, 254,
+	33, 244, 247, 244, 246, 245, 239, 203, 118, 255, 252, 246, 255, 246, 255, 255,
+	81, 114, 153, 148, 87, 164, 121, 136, 164, 137, 183, 134, 250, 136, 175, 244,
+	112, 255, 207, 255, 191, 255, 255, 191, 251, 255, 255, 255, 255, 249, 255, 255,
+	248, 111, 49, 254, 246, 127, 79, 116, 111, 150, 47, 95, 255, 255, 255, 255,
+	232, 238, 230, 238, 238, 238, 174, 115, 238, 238, 14, 234, 238, 238, 238, 238,
+	65, 101, 85, 167, 168, 134, 103, 39, 117, 118, 86, 136, 151, 120, 255, 250,
+	82, 104, 117, 143, 246, 245, 53, 35, 120, 56, 69, 254, 255, 117, 255, 255,
+	102, 131, 249, 244, 154, 243, 25, 155, 149, 95, 165, 244, 183, 169, 175, 247,
+	135, 165, 163, 242, 57, 245, 165, 191, 198, 105, 24, 246, 255, 255, 175, 245,
+	83, 164, 74, 164, 120, 100, 127, 150, 164, 31, 246, 133, 250, 135, 159, 245,
+	98, 255, 253, 255, 245, 255, 52, 52, 102, 70, 102, 109, 230, 246, 255, 255,
+	135, 245, 255, 7, 247, 245, 138, 159, 247, 79, 136, 247, 169, 249, 255, 248,
+	118, 115, 143, 241, 105, 198, 159, 88, 245, 127, 118, 197, 248, 249, 255, 245,
+	98, 242, 143, 245, 247, 244, 104, 103, 244, 111, 103, 242, 255, 247, 255, 248,
+	116, 121, 89, 182, 249, 251, 56, 54, 153, 47, 50, 171, 168, 186, 255, 255,
+	54, 115, 111, 244, 136, 133, 143, 143, 113, 127, 248, 243, 255, 248, 255, 255,
+	67, 242, 169, 148, 63, 244, 118, 121, 116, 127, 119, 244, 245, 246, 255, 255,
+	98, 115, 135, 147, 182, 194, 72, 168, 134, 205, 88, 150, 170, 182, 191, 248,
+	99, 51, 122, 179, 153, 179, 137, 132, 52, 143, 119, 149, 184, 250, 79, 246,
+	100, 164, 52, 215, 163, 133, 184, 122, 214, 213, 34, 183, 202, 136, 255, 217,
+	65, 255, 118, 143, 120, 247, 111, 70, 121, 95, 101, 243, 255, 248, 255, 255,
+	100, 179, 185, 149, 95, 245, 127, 249, 35, 59, 87, 245, 250, 250, 255, 250,
+	133, 247, 249, 249, 255, 255, 255, 255, 255, 249, 159, 240, 249, 255, 255, 255,
+	98, 98, 68, 133, 147, 148, 136, 117, 150, 86, 71, 166, 185, 168, 207, 214,
+	97, 182, 246, 212, 90, 245, 151, 152, 153, 167, 99, 183, 220, 185, 255, 247,
+	99, 180, 246, 243, 108, 161, 106, 187, 150, 143, 54, 244, 220, 138, 143, 247,
+	114, 186, 99, 139, 184, 154, 105, 119, 172, 90, 37, 79, 57, 169, 255, 255,
+	136, 242, 175, 241, 171, 245, 143, 159, 148, 111, 249, 248, 159, 249, 255, 248,
+	99, 97, 120, 132, 152, 131, 134, 87, 149, 111, 120, 245, 248, 245, 255, 248,
+	83, 147, 246, 242, 255, 242, 159, 255, 149, 159, 121, 248, 135, 249, 255, 249,
+	99, 98, 159, 147, 247, 244, 120, 118, 148, 127, 84, 132, 250, 248, 255, 247,
+	84, 241, 143, 244, 102, 243, 135, 104, 244, 255, 247, 116, 255, 118, 127, 244,
+	99, 102, 83, 67, 214, 121, 90, 101, 71, 56, 68, 105, 252, 206, 255, 248,
+	64, 248, 134, 154, 247, 246, 102, 86, 175, 111, 118, 248, 248, 143, 255, 255,
+	99, 87, 102, 136, 102, 133, 54, 54, 170, 58, 82, 117, 247, 133, 255, 255,
+	85, 147, 185, 132, 138, 83, 43, 153, 163, 79, 102, 196, 168, 169, 159, 247,
+	100, 180, 150, 163, 42, 244, 87, 202, 130, 92, 56, 197, 220, 251, 142, 199,
+	53, 180, 139, 177, 154, 148, 156, 170, 149, 95, 168, 164, 169, 184, 159, 228,
+	66, 118, 121, 118, 151, 149, 54, 70, 152, 63, 83, 150, 137, 151, 255, 255,
+	100, 212, 122, 53, 186, 193, 93, 169, 115, 93, 134, 197, 187, 250, 175, 245,
+	84, 115, 153, 178, 103, 179, 88, 55, 116, 77, 134, 195, 184, 169, 159, 197,
+	84, 194, 154, 178, 139, 210, 138, 150, 180, 124, 121, 180, 249, 233, 124, 198,
+	83, 68, 102, 116, 133, 153, 70, 56, 135, 89, 37, 138, 249, 167, 255, 167,
+	152, 253, 136, 240, 255, 254, 255, 255, 248, 255, 249, 253, 255, 159, 254, 255,
+	67, 130, 152, 163, 70, 244, 120, 120, 99, 109, 102, 164, 198, 215, 223, 247,
+	168, 245, 255, 240, 255, 163, 251, 255, 245, 255, 255, 250, 159, 252, 111, 249,
+	100, 66, 154, 162, 187, 195, 155, 148, 52, 173, 135, 165, 186, 202, 127, 132,
+	82, 164, 68, 99, 165, 149, 168, 91, 164, 152, 52, 101, 203, 168, 239, 197,
+	84, 119, 123, 153, 116, 247, 23, 70, 150, 58, 103, 147, 139, 120, 255, 255,
+	101, 194, 151, 195, 105, 245, 72, 203, 66, 60, 70, 181, 186, 249, 191, 165,
+	118, 247, 203, 250, 252, 247, 191, 191, 201, 170, 157, 208, 248, 251, 255, 255,
+	120, 242, 191, 241, 255, 244, 185, 143, 245, 255, 251, 165, 255, 248, 159, 245,
+	83, 254, 73, 243, 143, 249, 248, 159, 81, 79, 52, 254, 255, 159, 255, 255,
+	84, 253, 245, 240, 255, 245, 255, 255, 136, 111, 238, 254, 255, 246, 255, 254,
+	100, 134, 87, 118, 131, 133, 53, 53, 249, 63, 36, 154, 152, 134, 255, 247,
+	103, 162, 169, 145, 203, 211, 156, 168, 148, 95, 169, 200, 171, 250, 175, 244,
+	84, 129, 120, 147, 120, 179, 120, 104, 132, 111, 133, 245, 137, 183, 143, 248,
+	66, 165, 165, 131, 154, 211, 172, 216, 55, 173, 56, 184, 153, 152, 255, 244,
+	83, 131, 152, 180, 184, 181, 105, 67, 53, 111, 115, 165, 202, 185, 191, 167,
+	227, 238, 85, 198, 254, 87, 68, 61, 111, 47, 44, 239, 255, 255, 255, 255,
+	33, 101, 102, 132, 151, 247, 127, 70, 119, 127, 70, 85, 121, 249, 249, 255,
+	116, 121, 117, 171, 136, 150, 41, 85, 89, 57, 36, 150, 175, 167, 255, 255,
+	100, 246, 255, 162, 223, 241, 255, 250, 244, 127, 169, 244, 255, 255, 63, 244,
+	81, 152, 166, 251, 171, 249, 95, 69, 95, 63, 66, 152, 255, 127, 255, 255,
+	118, 242, 189, 242, 172, 225, 186, 202, 197, 143, 154, 198, 253, 250, 159, 246,
+	116, 68, 57, 34, 255, 166, 122, 69, 87, 143, 69, 250, 250, 255, 191, 245,
+	50, 131, 159, 114, 239, 247, 111, 119, 101, 127, 100, 247, 249, 151, 255, 245,
+	118, 242, 249, 241, 255, 245, 255, 249, 244, 159, 255, 243, 255, 249, 255, 243,
+	166, 152, 73, 140, 155, 204, 92, 34, 89, 59, 135, 164, 203, 186, 255, 255,
+	69, 245, 255, 252, 255, 245, 127, 255, 119, 111, 117, 240, 255, 255, 255, 253,
+	135, 244, 248, 245, 191, 241, 127, 159, 243, 255, 159, 247, 251, 247, 95, 162,
+	49, 246, 246, 246, 143, 253, 246, 255, 55, 95, 69, 126, 255, 120, 255, 255,
+	116, 215, 191, 131, 255, 241, 159, 207, 247, 127, 183, 211, 159, 255, 79, 246,
+	119, 119, 184, 247, 255, 183, 63, 35, 79, 63, 40, 159, 255, 136, 255, 255,
+	255, 255, 79, 255, 253, 255, 223, 107, 255, 171, 176, 255, 245, 255, 255, 255,
+	82, 248, 29, 228, 255, 255, 111, 103, 239, 223, 228, 255, 255, 255, 255, 255,
+	100, 130, 152, 163, 105, 195, 138, 135, 147, 137, 135, 163, 170, 188, 191, 148,
+	100, 121, 138, 249, 117, 133, 103, 22, 122, 74, 55, 120, 249, 151, 255, 255,
+	50, 245, 143, 245, 119, 242, 111, 255, 133, 47, 255, 116, 255, 255, 255, 252,
+	96, 125, 169, 140, 155, 220, 140, 87, 108, 110, 179, 119, 108, 188, 255, 255,
+	51, 242, 247, 244, 127, 242, 255, 255, 244, 111, 255, 243, 255, 246, 255, 254,
+	148, 131, 117, 38, 168, 170, 137, 87, 179, 52, 51, 104, 154, 184, 255, 250,
+	213, 241, 255, 245, 255, 241, 255, 255, 245, 255, 255, 100, 255, 255, 253, 255,
+	197, 244, 118, 241, 247, 99, 47, 255, 244, 255, 239, 253, 127, 255, 255, 254,
+	132, 104, 164, 169, 245, 178, 105, 21, 153, 90, 134, 132, 165, 170, 255, 255,
+	67, 244, 255, 246, 239, 243, 113, 255, 218, 95, 206, 245, 119, 255, 255, 253,
+	101, 244, 175, 240, 255, 245, 175, 255, 131, 255, 249, 247, 255, 251, 255, 250,
+	49, 86, 133, 245, 95, 247, 248, 255, 67, 127, 88, 247, 247, 248, 255, 255,
+	82, 196, 168, 163, 108, 194, 123, 170, 165, 63, 85, 197, 203, 166, 110, 181,
+	96, 136, 166, 180, 200, 165, 89, 118, 107, 90, 150, 186, 251, 175, 255, 255,
+	38, 241, 255, 245, 255, 245, 255, 239, 243, 239, 253, 253, 255, 254, 255, 255,
+	100, 244, 255, 247, 246, 246, 95, 23, 199, 255, 245, 246, 255, 255, 255, 255,
+	255, 255, 231, 255, 253, 255, 15, 107, 255, 74, 180, 255, 255, 255, 255, 255,
+	117, 75, 147, 38, 251, 79, 95, 149, 54, 91, 68, 127, 255, 255, 255, 255,
+	64, 119, 119, 120, 118, 167, 122, 103, 103, 127, 117, 134, 201, 175, 252, 250,
+	149, 90, 39, 249, 153, 249, 86, 100, 122, 111, 86, 129, 255, 255, 255, 255,
+	83, 98, 150, 149, 255, 243, 89, 119, 147, 111, 246, 146, 255, 249, 255, 255,
+	114, 247, 201, 199, 79, 246, 168, 219, 164, 106, 24, 169, 253, 255, 255, 255,
+	66, 132, 119, 115, 151, 130, 143, 137, 132, 95, 134, 134, 247, 127, 255, 243,
+	82, 111, 55, 101, 247, 255, 84, 70, 70, 79, 101, 254, 127, 104, 255, 255,
+	65, 244, 248, 38, 255, 244, 95, 159, 245, 159, 115, 244, 255, 255, 255, 255,
+	85, 148, 175, 245, 151, 241, 143, 164, 166, 111, 246, 246, 175, 248, 255, 255,
+	51, 243, 111, 244, 255, 244, 127, 136, 130, 95, 111, 243, 245, 255, 255, 247,
+	82, 111, 119, 126, 100, 143, 47, 40, 121, 95, 87, 127, 255, 248, 255, 255,
+	100, 242, 255, 241, 255, 101, 255, 255, 243, 255, 111, 245, 255, 255, 252, 247,
+	66, 243, 246, 131, 87, 244, 246, 87, 100, 255, 102, 244, 245, 247, 255, 255,
+	82, 163, 153, 84, 151, 164, 41, 152, 99, 135, 101, 150, 250, 184, 200, 247,
+	133, 52, 170, 193, 170, 243, 171, 168, 54, 207, 169, 249, 255, 251, 255, 199,
+	98, 182, 68, 167, 182, 166, 139, 108, 150, 108, 21, 102, 220, 169, 239, 156,
+	82, 127, 213, 47, 71, 116, 86, 70, 95, 63, 100, 100, 255, 255, 255, 255,
+	101, 245, 248, 243, 143, 246, 105, 159, 149, 79, 23, 130, 255, 249, 255, 245,
+	117, 255, 255, 249, 255, 247, 255, 255, 159, 249, 105, 240, 255, 255, 255, 255,
+	81, 134, 134, 119, 184, 247, 138, 85, 119, 79, 67, 105, 253, 187, 255, 251,
+	81, 217, 247, 233, 175, 249, 217, 236, 88, 251, 51, 250, 252, 205, 255, 255,
+	81, 197, 215, 150, 138, 197, 140, 157, 165, 127, 51, 182, 203, 153, 252, 247,
+	165, 252, 124, 202, 255, 245, 79, 175, 223, 28, 56, 111, 95, 255, 255, 255,
+	69, 132, 247, 241, 247, 132, 127, 159, 244, 47, 255, 247, 255, 255, 255, 245,
+	67, 241, 246, 244, 103, 245, 70, 239, 243, 111, 100, 246, 255, 245, 255, 255,
+	99, 245, 245, 180, 191, 243, 175, 250, 44, 207, 44, 248, 207, 255, 255, 243,
+	65, 243, 245, 244, 245, 245, 95, 102, 181, 111, 69, 246, 245, 255, 255, 255,
+	96, 249, 255, 152, 120, 248, 255, 137, 247, 248, 255, 255, 255, 153, 255, 255,
+	33, 150, 118, 105, 133, 246, 95, 120, 159, 127, 102, 255, 159, 143, 255, 255,
+	85, 106, 147, 249, 137, 242, 88, 54, 191, 95, 87, 113, 153, 248, 255, 255,
+	18, 246, 111, 244, 255, 252, 255, 247, 53, 239, 246, 252, 255, 255, 255, 252,
+	116, 247, 242, 247, 143, 151, 111, 71, 255, 41, 55, 244, 255, 249, 255, 255,
+	84, 181, 255, 100, 154, 177, 159, 187, 246, 79, 164, 248, 255, 255, 143, 243,
+	152, 197, 145, 164, 245, 207, 91, 60, 220, 135, 168, 255, 92, 252, 255, 245,
+	142, 243, 159, 246, 255, 130, 255, 255, 242, 255, 137, 242, 255, 255, 111, 248,
+	84, 249, 159, 175, 250, 244, 127, 58, 168, 31, 167, 164, 191, 255, 255, 255,
+	34, 244, 255, 247, 239, 247, 207, 247, 103, 63, 87, 242, 95, 255, 255, 253,
+	86, 241, 255, 242, 249, 243, 255, 255, 244, 255, 248, 95, 255, 255, 255, 244,
+	65, 248, 246, 146, 255, 248, 255, 244, 127, 255, 73, 254, 255, 245, 255, 255,
+	246, 255, 255, 247, 245, 143, 55, 55, 255, 111, 65, 255, 255, 152, 255, 255,
+	248, 249, 94, 249, 255, 255, 255, 255, 239, 15, 255, 143, 255, 255, 255, 255,
+	49, 117, 120, 117, 119, 132, 87, 102, 136, 111, 69, 246, 249, 247, 255, 255,
+	66, 103, 86, 155, 132, 165, 56, 52, 118, 63, 69, 117, 151, 118, 255, 248,
+	133, 241, 255, 242, 255, 228, 79, 255, 243, 111, 254, 244, 255, 255, 255, 255,
+	65, 153, 138, 207, 191, 187, 121, 84, 184, 63, 100, 181, 139, 138, 255, 255,
+	228, 241, 247, 242, 239, 243, 127, 191, 245, 207, 255, 243, 246, 255, 111, 245,
+	84, 129, 127, 244, 255, 244, 79, 119, 244, 127, 56, 244, 246, 255, 255, 247,
+	165, 119, 84, 165, 250, 249, 105, 72, 164, 102, 33, 249, 250, 137, 255, 249,
+	233, 241, 255, 242, 255, 244, 239, 255, 242, 127, 255, 255, 255, 246, 255, 245,
+	246, 211, 255, 240, 255, 247, 127, 253, 117, 255, 127, 254, 255, 255, 255, 253,
+	136, 242, 252, 241, 250, 246, 255, 249, 178, 255, 255, 244, 252, 255, 255, 244,
+	66, 118, 117, 137, 247, 248, 73, 53, 149, 47, 69, 100, 247, 137, 255, 249,
+	66, 247, 95, 252, 82, 254, 63, 143, 119, 79, 216, 245, 136, 255, 255, 253,
+	102, 177, 255, 243, 255, 245, 255, 191, 114, 255, 250, 249, 191, 255, 175, 245,
+	50, 245, 86, 244, 79, 246, 247, 246, 99, 255, 52, 246, 255, 255, 255, 255,
+	68, 241, 255, 243, 63, 250, 118, 255, 243, 111, 215, 244, 255, 245, 239, 253,
+	101, 148, 123, 241, 185, 132, 63, 83, 159, 63, 118, 255, 251, 167, 159, 248,
+	83, 255, 254, 243, 255, 255, 255, 31, 245, 63, 245, 255, 255, 255, 255, 255,
+	65, 133, 103, 86, 119, 149, 95, 70, 101, 111, 53, 119, 255, 127, 249, 255,
+	52, 104, 101, 152, 149, 133, 87, 51, 104, 36, 102, 132, 247, 135, 255, 255,
+	98, 149, 147, 169, 154, 184, 73, 67, 172, 41, 100, 134, 104, 153, 255, 255,
+	117, 120, 151, 81, 167, 170, 105, 71, 136, 87, 70, 79, 154, 154, 207, 201,
+	68, 147, 137, 146, 184, 163, 74, 170, 148, 187, 103, 165, 187, 184, 140, 246,
+	136, 213, 255, 241, 255, 245, 143, 246, 194, 255, 248, 247, 247, 255, 255, 243,
+	132, 150, 87, 151, 168, 116, 87, 53, 119, 47, 85, 114, 245, 185, 255, 255,
+	229, 242, 143, 130, 255, 243, 255, 247, 98, 239, 221, 133, 255, 247, 255, 246,
+	81, 164, 167, 163, 108, 244, 137, 169, 101, 152, 52, 165, 234, 182, 191, 246,
+	51, 244, 255, 244, 143, 245, 255, 243, 243, 111, 46, 247, 247, 255, 255, 254,
+	100, 113, 151, 150, 247, 132, 86, 67, 88, 88, 120, 120, 246, 143, 255, 255,
+	255, 255, 255, 255, 254, 255, 223, 86, 255, 112, 180, 255, 255, 255, 255, 255,
+	84, 95, 152, 131, 255, 255, 95, 67, 239, 40, 84, 255, 255, 255, 255, 255,
+	65, 132, 119, 117, 248, 135, 105, 72, 117, 152, 102, 134, 159, 248, 255, 255,
+	83, 58, 152, 170, 149, 244, 56, 38, 118, 102, 53, 150, 251, 250, 255, 255,
+	118, 150, 152, 246, 250, 245, 12, 152, 182, 95, 152, 244, 247, 250, 191, 246,
+	134, 210, 223, 165, 31, 244, 247, 250, 214, 143, 121, 249, 255, 255, 255, 252,
+	83, 244, 138, 193, 182, 115, 159, 143, 183, 175, 198, 247, 138, 250, 175, 245,
+	83, 191, 170, 250, 186, 250, 90, 40, 175, 27, 134, 180, 202, 127, 255, 255,
+	99, 248, 171, 57, 255, 241, 143, 175, 167, 175, 149, 247, 255, 248, 207, 255,
+	118, 149, 252, 245, 88, 245, 251, 25, 184, 124, 153, 243, 250, 255, 175, 246,
+	49, 221, 92, 75, 246, 244, 103, 60, 251, 93, 85, 215, 245, 255, 255, 255,
+	66, 146, 159, 244, 89, 244, 102, 159, 115, 255, 134, 244, 246, 247, 255, 255,
+	115, 149, 121, 180, 188, 161, 45, 154, 183, 251, 101, 200, 252, 249, 143, 246,
+	150, 83, 154, 243, 250, 243, 187, 164, 23, 159, 187, 246, 251, 252, 255, 245,
+	100, 164, 51, 84, 149, 147, 167, 141, 166, 186, 51, 70, 189, 169, 255, 246,
+	150, 223, 202, 255, 253, 222, 157, 12, 175, 139, 106, 249, 250, 255, 255, 255,
+	68, 243, 246, 244, 63, 245, 57, 249, 87, 159, 36, 84, 143, 255, 255, 255,
+	154, 251, 255, 255, 255, 249, 255, 255, 255, 255, 255, 240, 255, 255, 255, 255,
+	114, 181, 185, 241, 165, 197, 137, 167, 197, 139, 119, 216, 251, 218, 255, 246,
+	98, 179, 199, 162, 123, 197, 138, 185, 86, 167, 36, 248, 223, 252, 207, 244,
+	98, 245, 169, 210, 107, 163, 139, 135, 198, 143, 100, 244, 219, 168, 175, 243,
+	226, 84, 102, 251, 255, 92, 111, 67, 95, 85, 52, 223, 86, 255, 255, 245,
+	247, 179, 250, 241, 255, 243, 186, 175, 247, 95, 187, 169, 255, 255, 255, 244,
+	69, 241, 255, 247, 255, 245, 255, 228, 242, 239, 254, 244, 255, 255, 255, 246,
+	67, 247, 247, 241, 255, 247, 136, 255, 230, 143, 47, 247, 255, 249, 255, 245,
+	212, 241, 255, 246, 255, 244, 239, 203, 179, 255, 252, 246, 255, 246, 111, 255,
+	213, 243, 255, 241, 79, 243, 119, 103, 115, 111, 247, 246, 255, 95, 255, 253,
+	255, 255, 246, 255, 246, 255, 239, 243, 255, 12, 217, 127, 255, 255, 255, 255,
+	65, 255, 253, 130, 255, 255, 111, 136, 239, 111, 51, 143, 255, 248, 255, 255,
+	33, 244, 247, 252, 255, 253, 101, 86, 109, 79, 229, 253, 255, 127, 255, 254,
+	115, 79, 102, 247, 104, 134, 70, 51, 73, 70, 118, 68, 246, 119, 255, 255,
+	115, 127, 148, 250, 137, 159, 106, 105, 255, 88, 23, 116, 249, 159, 255, 255,
+	82, 51, 229, 229, 118, 103, 68, 53, 117, 95, 88, 255, 248, 111, 255, 255,
+	133, 73, 255, 159, 120, 166, 120, 95, 255, 111, 247, 128, 248, 127, 255, 255,
+	98, 132, 102, 146, 182, 180, 137, 101, 148, 89, 69, 118, 203, 201, 143, 164,
+	68, 84, 63, 151, 249, 133, 101, 84, 127, 71, 82, 143, 103, 248, 255, 255,
+	64, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	49, 126, 85, 247, 111, 246, 86, 70, 246, 79, 102, 255, 247, 255, 255, 255,
+	99, 87, 102, 136, 116, 117, 70, 52, 104, 58, 85, 119, 150, 116, 255, 255,
+	66, 120, 87, 86, 143, 246, 71, 52, 119, 63, 54, 136, 118, 244, 255, 255,
+	84, 129, 248, 245, 255, 244, 111, 245, 243, 159, 118, 115, 247, 248, 255, 247,
+	114, 85, 87, 245, 248, 135, 70, 53, 100, 63, 67, 119, 246, 136, 143, 248,
+	115, 104, 86, 105, 103, 246, 53, 52, 102, 63, 69, 84, 247, 133, 255, 255,
+	74, 114, 254, 245, 254, 242, 246, 254, 243, 223, 221, 243, 255, 245, 255, 252,
+	114, 67, 255, 244, 63, 244, 86, 111, 108, 255, 92, 52, 255, 110, 255, 253,
+	99, 101, 103, 119, 247, 133, 69, 51, 86, 47, 69, 119, 248, 135, 255, 255,
+	102, 241, 127, 242, 255, 244, 255, 239, 245, 239, 254, 245, 255, 255, 255, 246,
+	99, 146, 168, 147, 106, 243, 154, 105, 147, 155, 152, 148, 171, 251, 255, 180,
+	129, 89, 132, 186, 132, 181, 136, 54, 136, 106, 70, 119, 135, 168, 255, 255,
+	221, 241, 255, 243, 111, 212, 127, 255, 244, 95, 126, 243, 255, 247, 255, 255,
+	68, 244, 254, 245, 79, 244, 127, 255, 243, 111, 182, 241, 255, 255, 255, 255,
+	50, 242, 120, 99, 111, 244, 127, 246, 133, 127, 111, 247, 255, 255, 255, 246,
+	81, 184, 165, 108, 187, 217, 171, 117, 171, 106, 114, 149, 155, 106, 255, 255,
+	65, 245, 255, 196, 255, 245, 239, 245, 243, 239, 254, 99, 255, 255, 255, 247,
+	135, 129, 255, 244, 255, 244, 239, 127, 241, 95, 255, 245, 255, 255, 255, 244,
+	133, 102, 53, 148, 179, 187, 168, 85, 134, 84, 66, 122, 186, 154, 141, 199,
+	84, 132, 191, 241, 255, 245, 207, 249, 196, 207, 184, 166, 204, 249, 111, 244,
+	87, 193, 255, 243, 127, 244, 255, 76, 83, 255, 247, 244, 255, 246, 255, 252,
+	133, 86, 130, 138, 131, 149, 119, 38, 102, 55, 71, 101, 134, 152, 255, 255,
+	66, 243, 245, 244, 47, 243, 207, 255, 119, 191, 206, 246, 255, 255, 255, 246,
+	49, 118, 103, 244, 151, 248, 111, 247, 247, 255, 105, 135, 255, 255, 255, 248,
+	67, 242, 255, 242, 119, 242, 168, 255, 245, 79, 247, 248, 255, 248, 127, 246,
+	83, 102, 118, 148, 167, 149, 119, 85, 135, 71, 65, 175, 70, 168, 255, 248,
+	67, 100, 102, 253, 248, 254, 143, 85, 94, 127, 129, 246, 127, 255, 255, 247,
+	255, 127, 246, 255, 244, 255, 63, 82, 247, 124, 28, 79, 255, 255, 255, 255,
+	66, 246, 148, 243, 243, 255, 135, 162, 135, 127, 99, 143, 255, 255, 255, 255,
+	33, 134, 85, 103, 102, 248, 88, 86, 103, 95, 101, 117, 135, 143, 255, 255,
+	116, 152, 117, 169, 117, 100, 70, 39, 104, 58, 53, 149, 105, 119, 255, 255,
+	118, 243, 255, 149, 255, 244, 63, 255, 241, 47, 255, 197, 249, 249, 255, 248,
+	82, 186, 121, 171, 169, 201, 121, 22, 169, 79, 68, 250, 154, 154, 255, 255,
+	100, 118, 118, 244, 167, 187, 89, 40, 106, 101, 35, 251, 71, 169, 111, 255,
+	177, 242, 255, 244, 255, 243, 207, 255, 245, 255, 231, 253, 255, 247, 255, 254,
+	119, 178, 207, 241, 255, 179, 255, 251, 246, 188, 255, 243, 159, 252, 255, 243,
+	117, 136, 38, 139, 136, 147, 103, 55, 137, 74, 55, 101, 159, 134, 255, 251,
+	116, 244, 159, 248, 156, 245, 63, 255, 193, 74, 85, 245, 170, 250, 191, 123,
+	49, 117, 127, 247, 103, 247, 143, 255, 87, 143, 152, 247, 159, 255, 255, 249,
+	66, 242, 246, 245, 79, 243, 127, 255, 102, 191, 221, 244, 246, 254, 239, 244,
+	116, 120, 104, 153, 152, 121, 38, 36, 169, 79, 69, 175, 255, 102, 255, 249,
+	255, 255, 255, 255, 254, 255, 239, 92, 255, 92, 7, 255, 255, 255, 143, 255,
+	99, 191, 57, 244, 251, 255, 111, 99, 255, 31, 53, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 143, 240, 255, 255, 159, 255, 255, 255, 255, 255,
+	82, 163, 135, 130, 169, 246, 137, 121, 134, 119, 135, 150, 201, 246, 251, 152,
+	115, 104, 102, 155, 84, 148, 38, 68, 120, 87, 55, 117, 167, 184, 255, 255,
+	134, 181, 187, 242, 63, 244, 95, 250, 194, 111, 72, 252, 255, 251, 255, 151,
+	99, 163, 251, 178, 143, 115, 138, 219, 164, 95, 199, 243, 154, 186, 255, 165,
+	65, 155, 151, 168, 200, 185, 90, 117, 185, 79, 99, 151, 104, 154, 255, 255,
+	135, 247, 249, 111, 255, 242, 63, 175, 145, 143, 250, 248, 255, 255, 255, 245,
+	82, 115, 137, 179, 102, 166, 86, 135, 148, 107, 118, 242, 135, 186, 191, 246,
+	209, 242, 255, 244, 255, 243, 255, 254, 246, 239, 255, 243, 255, 255, 255, 253,
+	83, 86, 133, 99, 198, 185, 135, 86, 117, 52, 52, 87, 123, 153, 95, 251,
+	227, 242, 255, 242, 255, 242, 247, 255, 243, 127, 245, 245, 255, 247, 253, 255,
+	67, 241, 255, 244, 95, 244, 255, 111, 100, 255, 246, 245, 247, 255, 255, 246,
+	100, 243, 246, 242, 111, 242, 207, 111, 116, 127, 239, 246, 246, 245, 63, 254,
+	199, 244, 252, 241, 249, 247, 255, 143, 246, 255, 249, 242, 255, 250, 255, 242,
+	101, 121, 136, 153, 169, 198, 122, 34, 121, 63, 87, 116, 217, 248, 255, 251,
+	247, 255, 255, 255, 255, 246, 255, 255, 255, 255, 255, 240, 255, 255, 255, 255,
+	86, 246, 255, 240, 127, 246, 255, 254, 246, 239, 103, 255, 255, 255, 255, 253,
+	81, 199, 200, 117, 143, 245, 169, 120, 136, 223, 57, 215, 251, 250, 175, 247,
+	81, 212, 203, 163, 159, 179, 175, 253, 199, 63, 244, 216, 207, 250, 239, 166,
+	66, 118, 151, 146, 184, 248, 70, 98, 119, 143, 85, 250, 90, 250, 255, 255,
+	119, 241, 255, 243, 255, 243, 255, 255, 179, 255, 251, 255, 255, 255, 255, 255,
+	83, 241, 134, 245, 255, 115, 255, 99, 196, 255, 253, 245, 255, 255, 255, 247,
+	85, 241, 247, 244, 223, 243, 255, 255, 243, 255, 255, 245, 255, 255, 255, 246,
+	83, 248, 164, 177, 245, 248, 255, 247, 118, 63, 100, 255, 255, 143, 255, 255,
+	49, 118, 102, 245, 119, 134, 134, 71, 102, 105, 86, 118, 247, 247, 255, 247,
+	130, 136, 53, 255, 94, 253, 71, 71, 95, 79, 37, 119, 79, 246, 255, 255,
+	101, 131, 255, 246, 175, 21, 63, 255, 164, 127, 52, 246, 248, 251, 255, 251,
+	100, 194, 243, 243, 79, 197, 148, 171, 197, 111, 53, 180, 255, 255, 255, 247,
+	118, 180, 185, 177, 152, 242, 159, 251, 167, 127, 154, 164, 250, 249, 95, 246,
+	81, 135, 133, 121, 167, 185, 106, 53, 122, 57, 83, 133, 106, 122, 255, 255,
+	68, 148, 153, 23, 255, 132, 127, 255, 243, 159, 73, 246, 255, 248, 255, 255,
+	100, 99, 122, 245, 119, 242, 111, 106, 243, 47, 248, 243, 255, 248, 255, 255,
+	100, 242, 255, 244, 111, 243, 79, 63, 243, 111, 102, 245, 246, 255, 255, 83,
+	133, 151, 105, 245, 151, 255, 153, 58, 203, 31, 35, 95, 122, 250, 255, 255,
+	221, 83, 255, 241, 255, 242, 245, 86, 68, 127, 247, 251, 245, 255, 252, 255,
+	50, 131, 247, 243, 95, 244, 103, 135, 83, 111, 246, 244, 246, 246, 159, 248,
+	100, 148, 105, 129, 185, 131, 88, 121, 147, 191, 119, 132, 251, 168, 95, 247,
+	99, 52, 170, 150, 255, 245, 188, 162, 38, 189, 181, 248, 250, 251, 255, 249,
+	81, 229, 86, 87, 213, 166, 202, 63, 184, 249, 51, 123, 252, 185, 255, 247,
+	99, 255, 87, 135, 246, 254, 50, 53, 87, 71, 53, 245, 255, 247, 255, 255,
+	99, 166, 117, 181, 143, 244, 155, 170, 101, 79, 24, 248, 191, 247, 175, 243,
+	245, 255, 255, 246, 255, 255, 255, 255, 244, 247, 255, 240, 255, 255, 255, 255,
+	102, 133, 70, 180, 183, 147, 151, 115, 133, 63, 35, 136, 251, 200, 255, 164,
+	115, 244, 249, 165, 107, 244, 153, 139, 150, 153, 81, 185, 251, 250, 255, 246,
+	99, 243, 170, 243, 79, 148, 122, 143, 179, 79, 69, 246, 255, 170, 79, 246,
+	147, 119, 117, 134, 136, 135, 105, 104, 93, 31, 67, 63, 189, 155, 255, 246,
+	84, 99, 117, 242, 247, 242, 121, 105, 99, 127, 247, 247, 118, 245, 111, 246,
+	67, 243, 143, 114, 127, 245, 95, 79, 253, 143, 115, 247, 255, 120, 255, 255,
+	85, 241, 127, 242, 255, 247, 255, 236, 213, 111, 253, 246, 255, 249, 143, 243,
+	50, 134, 102, 103, 119, 135, 118, 88, 118, 105, 38, 104, 136, 255, 255, 255,
+	134, 123, 149, 251, 134, 182, 104, 88, 122, 36, 81, 152, 186, 169, 255, 255,
+	50, 157, 159, 151, 111, 248, 104, 249, 146, 79, 214, 255, 159, 255, 255, 255,
+	98, 247, 132, 168, 136, 248, 91, 54, 255, 43, 85, 242, 169, 139, 255, 255,
+	50, 251, 245, 247, 239, 244, 127, 117, 28, 95, 246, 123, 255, 255, 255, 253,
+	87, 243, 105, 243, 255, 243, 255, 143, 146, 63, 255, 148, 255, 245, 159, 243,
+	116, 149, 52, 243, 248, 143, 38, 72, 73, 57, 85, 152, 175, 138, 175, 247,
+	203, 244, 242, 251, 193, 245, 255, 255, 230, 239, 230, 252, 254, 255, 255, 255,
+	151, 242, 191, 243, 255, 146, 255, 255, 246, 255, 95, 146, 175, 167, 95, 244,
+	168, 203, 153, 207, 155, 245, 106, 72, 121, 58, 82, 209, 247, 250, 223, 255,
+	169, 244, 246, 243, 255, 247, 63, 251, 242, 43, 246, 247, 255, 250, 255, 247,
+	103, 247, 250, 146, 255, 242, 255, 204, 178, 255, 155, 184, 207, 255, 79, 147,
+	49, 119, 151, 115, 127, 245, 249, 248, 136, 111, 55, 151, 249, 255, 255, 255,
+	100, 246, 255, 178, 127, 241, 191, 255, 247, 159, 246, 246, 191, 249, 255, 246,
+	66, 40, 135, 244, 169, 242, 89, 87, 249, 74, 85, 255, 255, 181, 255, 255,
+	135, 191, 177, 166, 250, 255, 159, 137, 255, 25, 87, 175, 255, 255, 255, 255,
+	49, 132, 118, 117, 135, 165, 104, 103, 117, 121, 102, 134, 137, 169, 234, 167,
+	99, 89, 101, 106, 117, 116, 55, 53, 88, 55, 52, 84, 136, 151, 255, 253,
+	116, 86, 84, 84, 165, 170, 72, 53, 115, 69, 67, 106, 122, 153, 143, 215,
+	116, 104, 85, 139, 150, 149, 88, 36, 88, 57, 85, 131, 168, 168, 255, 253,
+	89, 180, 255, 241, 255, 243, 255, 255, 248, 255, 204, 255, 255, 255, 255, 116,
+	49, 116, 119, 135, 152, 167, 55, 103, 120, 95, 101, 136, 153, 159, 255, 248,
+	100, 91, 100, 122, 117, 131, 70, 36, 89, 122, 53, 87, 247, 151, 255, 252,
+	86, 243, 255, 243, 247, 115, 191, 255, 244, 31, 255, 245, 255, 247, 95, 255,
+	84, 246, 255, 146, 31, 246, 143, 159, 246, 175, 139, 184, 255, 255, 255, 246,
+	50, 244, 255, 146, 127, 116, 111, 169, 149, 79, 165, 245, 249, 248, 159, 247,
+	81, 119, 116, 120, 196, 136, 91, 69, 124, 70, 99, 132, 187, 139, 255, 253,
+	51, 242, 245, 198, 255, 243, 56, 255, 243, 127, 118, 254, 95, 255, 143, 248,
+	85, 182, 255, 241, 127, 245, 143, 171, 150, 159, 246, 177, 249, 250, 255, 245,
+	116, 84, 69, 83, 181, 159, 135, 84, 68, 69, 52, 107, 170, 136, 127, 246,
+	83, 243, 255, 132, 95, 243, 111, 84, 245, 239, 67, 117, 246, 246, 255, 255,
+	49, 130, 143, 101, 255, 243, 239, 249, 132, 255, 245, 246, 255, 255, 255, 255,
+	85, 145, 187, 179, 255, 242, 175, 122, 247, 191, 170, 102, 251, 250, 255, 244,
+	101, 242, 159, 241, 250, 130, 143, 159, 246, 255, 137, 247, 255, 255, 255, 245,
+	99, 88, 84, 106, 164, 117, 103, 52, 55, 122, 85, 98, 136, 183, 255, 251,
+	84, 243, 243, 246, 95, 245, 223, 246, 212, 47, 100, 245, 255, 255, 255, 248,
+	245, 248, 255, 255, 255, 247, 255, 255, 255, 255, 255, 240, 255, 255, 255, 255,
+	103, 244, 255, 241, 251, 244, 251, 156, 147, 207, 207, 246, 250, 247, 207, 87,
+	81, 182, 204, 197, 140, 242, 200, 252, 245, 134, 121, 248, 251, 171, 255, 248,
+	99, 180, 255, 179, 127, 241, 155, 155, 179, 191, 183, 181, 255, 134, 255, 244,
+	100, 102, 113, 150, 166, 165, 118, 68, 90, 127, 68, 137, 151, 121, 255, 255,
+	87, 242, 255, 145, 255, 243, 255, 255, 151, 159, 255, 255, 255, 255, 127, 243,
+	49, 244, 246, 247, 247, 247, 127, 116, 69, 255, 88, 254, 255, 255, 255, 255,
+	248, 255, 249, 255, 243, 255, 255, 248, 255, 125, 49, 159, 255, 159, 255, 255,
+	100, 243, 116, 66, 197, 247, 171, 166, 38, 154, 100, 87, 255, 255, 255, 246,
+	255, 255, 254, 255, 255, 255, 255, 244, 255, 255, 15, 255, 255, 255, 255, 255,
+	64, 133, 135, 150, 151, 165, 121, 135, 135, 108, 135, 183, 169, 201, 249, 248,
+	116, 88, 132, 137, 131, 164, 87, 37, 121, 95, 38, 116, 136, 181, 255, 255,
+	85, 243, 122, 245, 63, 164, 103, 153, 243, 47, 135, 147, 255, 249, 143, 248,
+	98, 167, 147, 185, 198, 247, 88, 84, 95, 42, 85, 164, 155, 90, 255, 255,
+	117, 243, 119, 178, 111, 246, 223, 255, 242, 63, 253, 247, 127, 255, 255, 245,
+	51, 242, 137, 114, 255, 163, 120, 120, 244, 120, 87, 244, 248, 255, 255, 246,
+	131, 40, 120, 132, 163, 218, 104, 86, 162, 119, 86, 122, 138, 122, 159, 252,
+	67, 130, 255, 243, 127, 244, 255, 255, 99, 95, 54, 246, 254, 246, 255, 247,
+	82, 241, 127, 134, 255, 244, 232, 247, 130, 127, 127, 247, 255, 255, 255, 255,
+	70, 82, 246, 82, 255, 243, 111, 124, 178, 255, 111, 247, 255, 255, 255, 253,
+	50, 244, 205, 228, 247, 242, 255, 214, 117, 255, 115, 237, 255, 255, 255, 253,
+	133, 168, 165, 111, 184, 244, 73, 37, 138, 43, 120, 146, 250, 248, 255, 255,
+	100, 243, 159, 180, 191, 246, 127, 171, 242, 143, 249, 248, 255, 255, 191, 242,
+	127, 246, 255, 255, 255, 255, 127, 255, 255, 255, 255, 240, 255, 255, 255, 255,
+	49, 243, 243, 117, 254, 243, 247, 126, 117, 223, 214, 110, 127, 255, 255, 252,
+	134, 243, 251, 242, 143, 241, 127, 255, 165, 255, 188, 245, 249, 251, 143, 245,
+	113, 179, 121, 179, 157, 245, 170, 169, 181, 47, 153, 184, 207, 215, 95, 248,
+	134, 87, 70, 88, 183, 115, 88, 101, 43, 47, 164, 154, 201, 251, 159, 248,
+	151, 250, 251, 248, 255, 255, 127, 49, 255, 111, 242, 255, 255, 255, 255, 255,
+	82, 169, 132, 242, 249, 255, 63, 119, 74, 85, 132, 159, 255, 255, 255, 255,
+	65, 101, 116, 103, 150, 151, 104, 86, 88, 105, 85, 104, 169, 186, 250, 111,
+	100, 74, 102, 159, 132, 163, 55, 37, 121, 93, 55, 151, 103, 152, 255, 255,
+	69, 87, 159, 253, 15, 254, 127, 255, 102, 143, 223, 255, 249, 255, 255, 255,
+	99, 85, 255, 243, 255, 241, 255, 244, 242, 223, 255, 251, 255, 255, 255, 251,
+	82, 170, 149, 170, 185, 184, 121, 53, 106, 62, 84, 196, 107, 123, 255, 255,
+	33, 245, 255, 189, 255, 243, 223, 255, 87, 111, 119, 253, 255, 255, 255, 253,
+	84, 243, 250, 242, 250, 244, 159, 243, 147, 79, 170, 244, 248, 249, 63, 247,
+	166, 118, 152, 68, 249, 189, 58, 87, 113, 101, 102, 77, 250, 204, 159, 251,
+	35, 242, 255, 245, 255, 245, 159, 159, 245, 249, 242, 255, 249, 255, 255, 255,
+	53, 193, 255, 245, 255, 245, 63, 247, 68, 255, 84, 246, 255, 255, 255, 252,
+	100, 121, 132, 127, 167, 162, 102, 68, 88, 63, 86, 130, 248, 182, 255, 255,
+	49, 243, 245, 251, 101, 245, 118, 245, 199, 95, 195, 244, 255, 255, 255, 253,
+	88, 179, 185, 177, 255, 243, 143, 188, 195, 255, 171, 243, 255, 200, 172, 163,
+	48, 182, 248, 247, 159, 246, 252, 251, 167, 207, 143, 200, 248, 249, 255, 251,
+	119, 164, 255, 241, 159, 246, 143, 255, 101, 63, 249, 250, 255, 246, 255, 246,
+	116, 86, 121, 179, 166, 135, 119, 85, 121, 31, 86, 143, 136, 185, 255, 246,
+	68, 246, 255, 247, 255, 248, 73, 122, 15, 127, 250, 248, 255, 255, 255, 255,
+	255, 255, 255, 255, 249, 255, 255, 242, 255, 18, 238, 250, 255, 255, 255, 255,
+	81, 175, 255, 163, 165, 255, 95, 121, 255, 79, 163, 255, 255, 255, 255, 251,
+	65, 116, 137, 133, 119, 244, 143, 87, 101, 111, 135, 147, 121, 248, 244, 250,
+	67, 143, 102, 175, 134, 135, 88, 22, 143, 95, 52, 103, 143, 166, 255, 255,
+	102, 131, 255, 244, 255, 149, 26, 117, 246, 127, 116, 148, 255, 249, 255, 255,
+	135, 245, 245, 247, 63, 248, 88, 255, 182, 171, 27, 242, 251, 250, 255, 255,
+	51, 116, 255, 244, 121, 115, 143, 247, 115, 79, 118, 132, 255, 127, 255, 244,
+	65, 157, 166, 251, 170, 250, 76, 102, 252, 79, 51, 165, 207, 140, 255, 255,
+	99, 246, 143, 23, 255, 244, 143, 255, 243, 111, 143, 247, 255, 255, 255, 254,
+	51, 114, 255, 244, 69, 245, 111, 213, 244, 127, 248, 243, 247, 152, 255, 254,
+	67, 241, 255, 245, 95, 244, 255, 254, 244, 239, 255, 244, 247, 246, 255, 254,
+	115, 136, 86, 165, 138, 175, 58, 88, 153, 92, 66, 63, 255, 152, 143, 251,
+	213, 243, 111, 242, 255, 242, 255, 255, 242, 95, 255, 244, 245, 255, 253, 255,
+	67, 243, 159, 245, 79, 243, 143, 143, 84, 79, 88, 242, 245, 255, 255, 255,
+	115, 147, 105, 97, 183, 244, 89, 136, 166, 191, 38, 165, 250, 249, 255, 246,
+	83, 67, 250, 162, 175, 165, 143, 153, 87, 154, 137, 246, 255, 169, 143, 242,
+	113, 166, 87, 242, 165, 148, 153, 170, 169, 191, 103, 248, 200, 169, 255, 250,
+	82, 223, 215, 127, 254, 83, 101, 75, 79, 79, 60, 106, 255, 246, 255, 255,
+	117, 166, 106, 242, 152, 245, 79, 187, 26, 159, 103, 248, 255, 249, 175, 244,
+	81, 165, 133, 179, 200, 181, 121, 90, 184, 122, 116, 134, 221, 235, 223, 247,
+	81, 133, 246, 244, 108, 243, 185, 207, 121, 134, 84, 246, 251, 155, 255, 248,
+	66, 181, 184, 131, 95, 241, 143, 187, 180, 95, 150, 246, 255, 203, 207, 246,
+	99, 101, 117, 131, 151, 149, 88, 53, 90, 43, 52, 91, 105, 153, 223, 167,
+	169, 178, 255, 241, 255, 248, 191, 255, 247, 63, 250, 169, 187, 255, 255, 243,
+	196, 240, 255, 244, 255, 244, 239, 239, 246, 239, 246, 246, 255, 254, 255, 255,
+	48, 255, 255, 246, 175, 244, 255, 255, 239, 250, 111, 143, 175, 255, 255, 255,
+	101, 241, 255, 243, 118, 245, 239, 91, 180, 255, 252, 242, 255, 255, 255, 111,
+	82, 52, 245, 243, 211, 244, 111, 247, 244, 255, 255, 254, 255, 95, 255, 252,
+	49, 143, 110, 242, 255, 255, 138, 153, 239, 159, 164, 255, 255, 255, 255, 255,
+	33, 119, 245, 118, 133, 248, 127, 87, 136, 86, 86, 247, 247, 255, 255, 255,
+	133, 122, 120, 191, 184, 179, 25, 57, 249, 72, 103, 183, 203, 251, 255, 255,
+	99, 244, 146, 253, 167, 200, 91, 71, 191, 29, 134, 196, 175, 90, 255, 255,
+	100, 149, 36, 243, 151, 249, 74, 90, 166, 47, 67, 143, 255, 186, 127, 155,
+	117, 143, 132, 255, 248, 146, 88, 106, 255, 84, 53, 242, 255, 244, 255, 255,
+	85, 242, 255, 242, 159, 242, 255, 249, 247, 255, 143, 255, 143, 255, 255, 249,
+	66, 255, 254, 242, 245, 255, 175, 95, 255, 47, 148, 255, 255, 255, 255, 255,
+	66, 102, 87, 103, 245, 117, 95, 115, 101, 79, 71, 246, 87, 247, 255, 255,
+	82, 103, 87, 153, 86, 116, 69, 53, 105, 41, 86, 120, 151, 133, 255, 255,
+	99, 69, 110, 246, 136, 118, 79, 70, 159, 31, 100, 254, 136, 119, 255, 255,
+	99, 230, 116, 229, 246, 103, 69, 22, 108, 79, 70, 255, 127, 245, 255, 255,
+	99, 255, 231, 143, 246, 117, 51, 69, 231, 23, 94, 248, 248, 247, 255, 255,
+	33, 134, 102, 102, 121, 248, 143, 134, 118, 111, 118, 120, 247, 255, 255, 248,
+	117, 104, 34, 255, 247, 245, 102, 67, 239, 87, 40, 141, 255, 255, 255, 255,
+	86, 243, 254, 242, 127, 253, 31, 255, 244, 223, 191, 253, 255, 255, 95, 246,
+	49, 248, 132, 255, 255, 255, 127, 131, 255, 63, 132, 249, 248, 255, 255, 255,
+	117, 133, 101, 248, 245, 248, 95, 99, 147, 134, 97, 255, 255, 143, 111, 255,
+	87, 244, 255, 247, 255, 243, 79, 249, 242, 31, 248, 255, 255, 255, 255, 247,
+	84, 248, 250, 241, 255, 253, 111, 255, 168, 63, 255, 247, 249, 249, 47, 245,
+	132, 255, 240, 228, 255, 255, 248, 255, 239, 223, 229, 255, 255, 255, 255, 255,
+	65, 248, 134, 87, 119, 245, 95, 37, 102, 95, 86, 127, 127, 255, 255, 255,
+	114, 104, 118, 152, 84, 153, 69, 36, 102, 73, 101, 132, 149, 119, 255, 255,
+	244, 255, 135, 255, 143, 246, 86, 37, 143, 38, 132, 104, 255, 39, 255, 255,
+	82, 231, 77, 236, 102, 255, 86, 37, 124, 70, 86, 127, 247, 88, 255, 255,
+	204, 244, 79, 241, 95, 251, 79, 255, 245, 255, 239, 77, 255, 255, 255, 254,
+	102, 6, 249, 245, 255, 248, 143, 169, 151, 175, 121, 143, 255, 250, 255, 247,
+	102, 242, 131, 245, 246, 254, 255, 255, 244, 255, 24, 255, 127, 255, 255, 247,
+	82, 102, 134, 255, 245, 119, 69, 53, 127, 54, 69, 244, 255, 118, 255, 255,
+	159, 248, 249, 240, 111, 249, 255, 255, 248, 127, 90, 255, 255, 255, 255, 247,
+	84, 247, 248, 130, 137, 245, 136, 255, 136, 127, 30, 105, 255, 248, 255, 246,
+	98, 101, 244, 246, 68, 254, 84, 69, 63, 72, 70, 231, 245, 247, 255, 255,
+	33, 117, 247, 252, 255, 253, 103, 87, 109, 79, 230, 101, 118, 255, 255, 254,
+	99, 103, 133, 255, 101, 120, 85, 52, 39, 72, 70, 119, 247, 118, 255, 255,
+	50, 143, 118, 247, 246, 255, 69, 68, 244, 63, 213, 246, 239, 255, 255, 255,
+	108, 243, 255, 244, 255, 243, 255, 254, 243, 239, 111, 241, 255, 255, 255, 254,
+	82, 117, 93, 229, 115, 248, 95, 52, 44, 87, 214, 239, 255, 95, 255, 255,
+	67, 230, 238, 255, 255, 247, 71, 37, 214, 67, 86, 84, 255, 245, 255, 255,
+	235, 254, 219, 203, 245, 255, 86, 237, 207, 15, 204, 255, 255, 255, 255, 255,
+	220, 246, 255, 242, 239, 251, 31, 191, 252, 127, 254, 246, 255, 255, 255, 252,
+	204, 251, 255, 240, 255, 251, 95, 255, 252, 255, 239, 253, 255, 255, 255, 254,
+	254, 236, 255, 240, 255, 253, 255, 254, 222, 255, 255, 255, 255, 255, 255, 254,
+	255, 255, 255, 249, 255, 255, 255, 255, 255, 255, 255, 240, 255, 249, 255, 255,
+	253, 254, 255, 240, 255, 255, 255, 255, 255, 175, 255, 255, 255, 255, 255, 255,
+	80, 254, 255, 245, 255, 254, 255, 255, 255, 255, 222, 255, 255, 255, 255, 255,
+	252, 254, 255, 241, 255, 252, 255, 255, 255, 31, 255, 255, 255, 255, 255, 255,
+	80, 255, 154, 168, 175, 249, 152, 136, 143, 175, 246, 111, 250, 255, 255, 248,
+	151, 255, 23, 143, 255, 247, 79, 111, 127, 159, 39, 255, 255, 255, 255, 255,
+	239, 244, 255, 246, 255, 245, 111, 255, 241, 95, 255, 242, 255, 255, 255, 247,
+	175, 244, 255, 196, 47, 242, 111, 255, 244, 63, 251, 243, 255, 255, 175, 245,
+	232, 246, 255, 242, 159, 241, 255, 255, 244, 175, 255, 244, 255, 255, 255, 244,
+	49, 255, 255, 255, 255, 255, 127, 107, 252, 79, 242, 255, 159, 191, 255, 255,
+	167, 242, 255, 248, 255, 241, 255, 255, 250, 255, 248, 251, 255, 255, 127, 242,
+	254, 242, 255, 246, 255, 242, 63, 223, 244, 79, 255, 244, 255, 245, 127, 244,
+	238, 246, 255, 245, 255, 252, 255, 255, 251, 255, 255, 252, 255, 255, 240, 255,
+	250, 243, 255, 242, 255, 243, 175, 255, 245, 255, 255, 249, 255, 255, 111, 242,
+	153, 242, 255, 241, 255, 245, 255, 255, 226, 255, 255, 245, 255, 255, 255, 247,
+	246, 245, 239, 245, 255, 243, 255, 255, 245, 255, 142, 244, 255, 249, 143, 240,
+	114, 255, 238, 255, 245, 254, 31, 87, 239, 79, 246, 245, 255, 255, 255, 255,
+	55, 243, 255, 241, 159, 247, 79, 255, 245, 111, 255, 243, 255, 255, 175, 245,
+	254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240, 255, 255, 255, 255,
+	251, 242, 207, 242, 255, 242, 255, 255, 243, 207, 191, 185, 255, 250, 175, 244,
+	65, 243, 250, 243, 255, 244, 255, 255, 244, 250, 255, 244, 255, 250, 255, 248,
+	249, 242, 248, 243, 95, 243, 255, 255, 246, 95, 255, 250, 255, 255, 255, 242,
+	153, 243, 255, 243, 255, 242, 255, 255, 242, 127, 255, 245, 255, 255, 127, 245,
+	66, 238, 66, 194, 254, 255, 223, 125, 207, 191, 196, 239, 255, 255, 255, 255,
+	253, 219, 255, 240, 255, 252, 255, 253, 205, 255, 255, 254, 248, 255, 255, 253,
+	149, 255, 255, 242, 255, 254, 255, 255, 255, 31, 248, 255, 255, 255, 255, 246,
+};
+
+static const UTF16 kLettersEs [32] =
+{
+	0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C,
+	0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+	0x0079, 0x007A, 0x00E1, 0x00E9, 0x00ED, 0x00F1, 0x00F3, 0x00FA,
+};
+
+static const uint16_t kContextsEs [1156] =
+{
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 0, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+	47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 29,
+	62, 31, 63, 64, 0, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+	76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,
+	61, 29, 62, 92, 63, 64, 0, 93, 94, 95, 96, 97, 98, 99, 100, 101,
+	102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+	118, 60, 61, 29, 62, 31, 119, 120, 0, 121, 122, 95, 123, 97, 124, 99,
+	100, 125, 126, 44, 127, 128, 129, 107, 130, 131, 110, 132, 133, 134, 135, 115,
+	116, 117, 59, 60, 61, 29, 136, 31, 137, 64, 0, 138, 139, 95, 96, 140,
+	141, 99, 100, 101, 142, 44, 104, 143, 144, 107, 145, 109, 110, 146, 147, 148,
+	149, 150, 116, 117, 59, 60, 61, 29, 151, 31, 63, 64, 0, 152, 153, 154,
+	155, 156, 157, 158, 159, 101, 160, 161, 104, 162, 163, 164, 165, 166, 167, 168,
+	169, 170, 171, 172, 116, 173, 59, 174, 61, 29, 62, 175, 63, 64, 0, 176,
+	177, 95, 96, 178, 179, 180, 100, 101, 181, 44, 104, 182, 129, 107, 183, 184,
+	110, 185, 186, 187, 188, 115, 116, 117, 59, 60, 61, 29, 62, 31, 63, 64,
+	0, 189, 190, 95, 96, 97, 191, 99, 100, 101, 192, 44, 104, 193, 194, 195,
+	196, 197, 110, 198, 199, 148, 200, 115, 116, 117, 59, 60, 61, 29, 62, 31,
+	63, 201, 0, 202, 203, 95, 96, 97, 204, 99, 100, 101, 205, 44, 104, 206,
+	129, 107, 207, 109, 110, 208, 209, 210, 211, 115, 116, 117, 59, 60, 61, 29,
+	62, 31, 63, 64, 0, 212, 213, 214, 215, 216, 217, 218, 219, 101, 220, 221,
+	104, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 116, 233, 59, 234,
+	61, 235, 62, 31, 236, 64, 0, 237, 238, 95, 96, 97, 239, 99, 100, 101,
+	220, 44, 104, 206, 129, 107, 240, 109, 110, 208, 209, 148, 241, 115, 116, 117,
+	59, 60, 61, 29, 62, 31, 63, 64, 0, 242, 243, 95, 96, 97, 244, 99,
+	100, 101, 245, 44, 104, 206, 129, 107, 246, 109, 110, 208, 209, 148, 231, 115,
+	116, 117, 59, 60, 61, 29, 62, 31, 63, 64, 0, 247, 248, 95, 249, 250,
+	251, 252, 253, 101, 254, 44, 104, 255, 256, 107, 257, 109, 110, 208, 258, 259,
+	260, 261, 116, 117, 59, 60, 61, 29, 262, 31, 263, 64, 0, 264, 265, 266,
+	96, 97, 267, 99, 100, 101, 268, 44, 104, 206, 269, 270, 271, 272, 110, 208,
+	209, 148, 273, 115, 116, 117, 59, 60, 274, 275, 62, 31, 276, 277, 0, 278,
+	279, 95, 280, 281, 282, 283, 284, 101, 285, 44, 286, 287, 288, 107, 289, 109,
+	110, 208, 290, 291, 292, 293, 116, 117, 59, 294, 295, 296, 62, 31, 63, 297,
+	0, 298, 299, 300, 301, 302, 70, 303, 304, 101, 305, 44, 306, 307, 308, 309,
+	310, 311, 312, 313, 314, 315, 316, 317, 318, 117, 59, 60, 61, 29, 62, 31,
+	63, 64, 0, 319, 320, 95, 321, 97, 322, 99, 323, 101, 324, 44, 104, 325,
+	129, 107, 326, 327, 110, 328, 329, 330, 331, 115, 116, 117, 59, 60, 61, 29,
+	62, 31, 63, 332, 0, 237, 66, 95, 96, 97, 70, 99, 100, 101, 220, 44,
+	104, 206, 129, 107, 80, 109, 110, 208, 209, 148, 333, 115, 116, 117, 59, 60,
+	61, 29, 62, 31, 63, 64, 0, 334, 335, 336, 337, 338, 339, 340, 341, 101,
+	342, 44, 104, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 116, 117,
+	354, 355, 356, 29, 357, 31, 358, 64, 0, 359, 360, 361, 362, 363, 364, 99,
+	100, 365, 366, 44, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 115,
+	116, 117, 378, 60, 61, 29, 379, 31, 380, 64, 0, 381, 382, 95, 383, 97,
+	384, 99, 100, 385, 386, 44, 104, 387, 388, 107, 389, 390, 110, 391, 392, 393,
+	394, 115, 395, 117, 396, 60, 397, 398, 62, 31, 399, 64, 0, 400, 401, 402,
+	403, 404, 405, 406, 407, 101, 408, 409, 104, 410, 411, 412, 413, 414, 110, 415,
+	416, 417, 231, 418, 116, 117, 419, 420, 61, 421, 62, 31, 63, 64, 0, 422,
+	423, 95, 96, 97, 424, 99, 100, 101, 425, 44, 104, 206, 129, 107, 426, 109,
+	110, 208, 209, 148, 427, 115, 116, 117, 59, 60, 428, 29, 429, 31, 63, 64,
+	0, 237, 430, 95, 96, 97, 431, 99, 100, 101, 432, 44, 104, 206, 129, 107,
+	433, 109, 110, 208, 209, 148, 231, 115, 116, 117, 59, 60, 61, 29, 62, 31,
+	63, 64, 0, 434, 435, 95, 436, 97, 70, 99, 100, 101, 437, 44, 104, 206,
+	129, 107, 80, 438, 110, 208, 209, 439, 231, 115, 116, 117, 59, 60, 61, 29,
+	62, 31, 63, 64, 0, 440, 441, 95, 96, 97, 442, 99, 100, 101, 220, 44,
+	104, 206, 129, 107, 443, 109, 110, 208, 209, 444, 445, 115, 116, 117, 59, 60,
+	61, 29, 62, 31, 63, 64, 0, 237, 446, 95, 447, 97, 448, 99, 100, 101,
+	220, 44, 104, 206, 129, 107, 449, 109, 110, 208, 209, 148, 231, 115, 116, 117,
+	59, 60, 61, 29, 62, 31, 63, 64, 0, 237, 66, 95, 450, 97, 70, 99,
+	100, 101, 220, 44, 104, 451, 452, 453, 80, 109, 110, 454, 455, 456, 231, 115,
+	116, 457, 59, 60, 61, 29, 62, 31, 63, 64, 0, 237, 66, 95, 96, 97,
+	70, 99, 100, 101, 220, 44, 104, 206, 129, 458, 80, 109, 110, 459, 460, 461,
+	231, 115, 116, 117, 59, 60, 61, 29, 62, 31, 63, 64, 0, 237, 462, 95,
+	96, 97, 70, 99, 100, 101, 220, 44, 104, 206, 463, 464, 465, 109, 110, 208,
+	209, 148, 231, 115, 116, 117, 59, 60, 61, 29, 62, 31, 63, 64, 0, 237,
+	466, 95, 96, 97, 70, 99, 100, 101, 220, 44, 104, 206, 129, 107, 467, 109,
+	110, 208, 209, 148, 231, 115, 116, 117, 59, 60, 61, 29, 62, 31, 63, 64,
+	0, 237, 66, 95, 96, 468, 70, 99, 100, 101, 220, 44, 104, 469, 129, 470,
+	80, 109, 110, 471, 209, 148, 231, 115, 116, 117, 59, 60, 61, 29, 62, 31,
+	63, 64, 0, 237, 66, 472, 96, 97, 70, 99, 100, 101, 220, 44, 104, 473,
+	474, 475, 80, 109, 110, 208, 476, 148, 231, 115, 116, 117, 59, 60, 61, 29,
+	62, 31, 63, 64,
+};
+
+static const uint8_t kCostsEs [8109] =
+{
+	63, 100, 52, 83, 119, 165, 73, 69, 69, 87, 84, 101, 154, 183, 201, 249,
+	170, 49, 118, 102, 102, 134, 167, 121, 103, 103, 120, 117, 135, 105, 169, 255,
+	254, 223, 131, 91, 68, 140, 134, 136, 40, 70, 93, 56, 85, 84, 217, 167,
+	255, 126, 143, 102, 178, 168, 101, 138, 242, 60, 171, 163, 95, 135, 244, 159,
+	115, 151, 251, 90, 138, 243, 138, 165, 108, 246, 79, 202, 113, 79, 138, 197,
+	251, 251, 249, 253, 229, 135, 197, 220, 176, 223, 227, 156, 173, 150, 175, 168,
+	183, 217, 236, 175, 248, 250, 153, 203, 138, 139, 202, 107, 45, 38, 186, 71,
+	114, 139, 76, 207, 255, 255, 255, 154, 242, 138, 165, 251, 241, 95, 250, 115,
+	79, 151, 211, 221, 255, 250, 250, 251, 120, 133, 134, 146, 143, 242, 95, 88,
+	86, 47, 133, 148, 249, 123, 159, 255, 249, 138, 241, 170, 147, 143, 243, 187,
+	249, 164, 175, 90, 181, 249, 250, 186, 255, 127, 138, 154, 72, 137, 165, 201,
+	108, 3, 122, 109, 117, 186, 203, 127, 255, 255, 255, 246, 114, 248, 244, 143,
+	245, 255, 119, 69, 127, 245, 129, 255, 255, 255, 255, 255, 102, 66, 104, 131,
+	79, 243, 104, 135, 100, 127, 134, 243, 245, 248, 255, 255, 255, 170, 209, 123,
+	164, 223, 244, 109, 252, 178, 191, 169, 230, 189, 156, 255, 244, 250, 137, 146,
+	136, 179, 191, 195, 185, 135, 130, 159, 136, 163, 191, 251, 116, 248, 86, 135,
+	166, 155, 197, 251, 244, 191, 191, 224, 207, 139, 244, 239, 201, 253, 253, 78,
+	130, 42, 133, 121, 153, 168, 138, 149, 43, 63, 87, 168, 251, 255, 255, 255,
+	255, 156, 178, 183, 228, 170, 229, 105, 236, 163, 59, 135, 242, 187, 251, 200,
+	254, 143, 135, 250, 187, 251, 255, 251, 255, 255, 191, 255, 159, 176, 249, 255,
+	255, 255, 255, 105, 243, 152, 176, 189, 215, 175, 169, 166, 188, 185, 164, 191,
+	255, 248, 251, 207, 138, 196, 184, 193, 108, 243, 186, 233, 131, 170, 88, 164,
+	250, 249, 203, 245, 246, 122, 162, 200, 243, 123, 242, 108, 186, 147, 63, 153,
+	197, 204, 248, 137, 249, 154, 85, 108, 169, 207, 249, 247, 171, 26, 127, 93,
+	66, 248, 255, 159, 255, 255, 255, 105, 161, 171, 130, 207, 244, 159, 168, 149,
+	175, 169, 182, 175, 255, 131, 246, 255, 215, 130, 133, 244, 101, 242, 255, 135,
+	130, 79, 248, 255, 247, 247, 255, 255, 255, 17, 118, 118, 136, 119, 246, 159,
+	244, 103, 255, 86, 249, 143, 111, 255, 255, 255, 96, 243, 255, 248, 255, 247,
+	255, 255, 247, 255, 255, 248, 255, 159, 255, 255, 255, 67, 242, 109, 242, 87,
+	244, 79, 255, 243, 254, 118, 244, 255, 255, 255, 255, 247, 252, 255, 254, 255,
+	255, 255, 95, 101, 255, 15, 93, 143, 255, 255, 255, 255, 255, 115, 102, 233,
+	142, 238, 232, 110, 57, 126, 58, 49, 142, 94, 174, 238, 238, 238, 136, 248,
+	255, 255, 255, 255, 255, 8, 248, 255, 255, 255, 255, 143, 255, 255, 255, 218,
+	209, 221, 221, 221, 221, 221, 221, 209, 221, 221, 221, 221, 221, 218, 221, 217,
+	243, 255, 127, 255, 255, 255, 143, 63, 111, 15, 255, 255, 255, 255, 255, 255,
+	255, 255, 190, 254, 255, 255, 255, 31, 42, 255, 255, 56, 255, 255, 255, 255,
+	255, 255, 17, 120, 151, 135, 152, 216, 136, 121, 136, 121, 133, 153, 122, 156,
+	255, 252, 207, 52, 71, 68, 105, 134, 250, 63, 87, 74, 47, 85, 100, 143,
+	122, 255, 127, 159, 69, 243, 159, 84, 248, 227, 79, 153, 132, 79, 148, 243,
+	127, 148, 248, 248, 255, 68, 147, 152, 86, 89, 246, 95, 249, 97, 95, 104,
+	245, 255, 255, 255, 255, 246, 68, 117, 143, 113, 127, 243, 127, 135, 102, 127,
+	151, 71, 248, 246, 255, 246, 255, 69, 102, 104, 117, 95, 87, 63, 38, 137,
+	72, 98, 136, 63, 153, 255, 255, 255, 84, 244, 105, 117, 248, 242, 79, 134,
+	83, 63, 133, 245, 255, 255, 255, 249, 255, 85, 102, 150, 116, 121, 145, 79,
+	79, 68, 79, 119, 245, 255, 159, 255, 255, 255, 67, 242, 68, 242, 111, 244,
+	111, 143, 99, 255, 79, 245, 248, 255, 255, 255, 255, 85, 103, 70, 87, 244,
+	248, 255, 20, 86, 95, 85, 232, 249, 143, 255, 255, 253, 102, 147, 202, 241,
+	207, 246, 251, 170, 130, 175, 248, 164, 255, 207, 191, 255, 249, 33, 99, 126,
+	243, 87, 244, 255, 255, 84, 111, 221, 252, 255, 255, 255, 255, 255, 69, 147,
+	103, 116, 153, 242, 111, 136, 114, 143, 117, 246, 151, 121, 255, 245, 255, 68,
+	98, 102, 131, 153, 243, 247, 245, 115, 255, 150, 149, 255, 249, 133, 255, 255,
+	35, 116, 121, 244, 248, 245, 127, 111, 129, 127, 137, 244, 249, 247, 255, 255,
+	95, 67, 88, 247, 95, 255, 247, 87, 85, 25, 63, 118, 84, 248, 255, 255,
+	255, 255, 69, 146, 101, 149, 136, 244, 87, 255, 114, 41, 133, 244, 248, 255,
+	247, 255, 255, 37, 255, 255, 255, 255, 255, 255, 95, 255, 255, 255, 241, 242,
+	245, 255, 255, 255, 52, 116, 119, 129, 255, 248, 255, 118, 244, 159, 149, 148,
+	118, 159, 255, 255, 249, 35, 133, 134, 163, 74, 243, 152, 153, 101, 137, 71,
+	164, 154, 245, 255, 246, 246, 67, 114, 150, 131, 95, 244, 79, 247, 243, 79,
+	104, 246, 111, 244, 255, 255, 255, 68, 109, 135, 251, 103, 245, 120, 40, 79,
+	79, 81, 245, 255, 255, 255, 255, 255, 51, 242, 255, 98, 255, 245, 143, 244,
+	103, 255, 119, 255, 255, 255, 104, 247, 255, 35, 114, 239, 245, 101, 243, 239,
+	111, 115, 79, 252, 245, 103, 254, 255, 255, 255, 48, 247, 150, 89, 120, 249,
+	255, 246, 127, 159, 135, 255, 95, 111, 255, 255, 255, 65, 147, 168, 245, 248,
+	246, 153, 102, 101, 143, 70, 197, 186, 170, 153, 255, 105, 83, 129, 165, 245,
+	152, 245, 143, 200, 245, 150, 202, 248, 249, 169, 247, 255, 245, 130, 143, 164,
+	111, 182, 250, 47, 52, 143, 70, 83, 186, 95, 255, 255, 255, 255, 116, 147,
+	86, 89, 246, 191, 143, 34, 164, 138, 102, 191, 207, 127, 255, 255, 255, 115,
+	207, 76, 207, 249, 255, 79, 8, 173, 109, 184, 255, 191, 255, 255, 255, 255,
+	230, 53, 230, 105, 238, 238, 62, 34, 238, 142, 99, 238, 238, 158, 238, 238,
+	238, 80, 136, 103, 152, 138, 184, 135, 120, 135, 139, 134, 187, 171, 255, 251,
+	255, 255, 98, 91, 52, 170, 167, 120, 57, 69, 123, 55, 84, 103, 170, 119,
+	239, 123, 191, 119, 162, 250, 243, 255, 164, 47, 175, 245, 63, 245, 246, 191,
+	248, 159, 248, 250, 153, 167, 197, 243, 95, 241, 181, 207, 215, 124, 41, 247,
+	255, 255, 170, 245, 253, 116, 194, 125, 212, 172, 150, 175, 197, 193, 138, 250,
+	118, 252, 218, 187, 249, 255, 98, 118, 84, 119, 182, 122, 75, 53, 120, 56,
+	83, 120, 107, 139, 255, 156, 254, 85, 243, 255, 67, 244, 244, 223, 255, 242,
+	63, 94, 252, 127, 255, 255, 244, 255, 84, 116, 159, 242, 121, 245, 255, 99,
+	244, 63, 116, 245, 255, 255, 255, 255, 255, 115, 242, 255, 250, 111, 243, 79,
+	87, 242, 255, 95, 244, 255, 255, 246, 245, 255, 83, 247, 116, 137, 246, 159,
+	41, 37, 247, 89, 53, 239, 246, 103, 255, 255, 253, 247, 243, 255, 241, 255,
+	246, 255, 255, 241, 255, 250, 244, 255, 255, 255, 255, 249, 34, 243, 255, 131,
+	95, 244, 127, 119, 116, 111, 110, 244, 246, 255, 255, 255, 255, 82, 148, 135,
+	148, 246, 243, 59, 197, 148, 183, 72, 152, 171, 223, 170, 249, 155, 101, 34,
+	170, 179, 175, 242, 159, 250, 71, 159, 170, 249, 251, 255, 152, 207, 249, 99,
+	244, 36, 165, 196, 149, 185, 154, 196, 249, 38, 246, 173, 89, 137, 248, 249,
+	81, 106, 101, 139, 184, 168, 89, 52, 89, 56, 99, 153, 185, 203, 254, 255,
+	255, 84, 242, 248, 131, 111, 245, 47, 255, 69, 106, 54, 244, 255, 255, 255,
+	250, 119, 118, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240, 255, 255,
+	255, 255, 255, 98, 162, 115, 149, 180, 132, 138, 167, 135, 119, 86, 218, 203,
+	202, 165, 250, 252, 65, 245, 247, 163, 92, 244, 151, 153, 182, 191, 87, 198,
+	223, 250, 251, 249, 251, 85, 243, 247, 179, 91, 243, 159, 156, 129, 63, 105,
+	245, 255, 250, 248, 248, 248, 134, 248, 55, 253, 250, 249, 79, 103, 159, 79,
+	18, 255, 79, 168, 255, 250, 255, 155, 245, 255, 241, 255, 242, 255, 191, 163,
+	111, 255, 250, 175, 255, 107, 245, 255, 67, 242, 238, 243, 119, 243, 229, 70,
+	123, 223, 252, 245, 255, 244, 246, 255, 255, 66, 245, 247, 255, 255, 241, 255,
+	255, 118, 127, 183, 247, 255, 255, 255, 255, 255, 97, 116, 255, 246, 255, 246,
+	175, 151, 244, 255, 103, 163, 255, 250, 137, 255, 63, 115, 241, 255, 245, 255,
+	246, 255, 175, 244, 255, 250, 255, 255, 168, 255, 255, 245, 255, 242, 255, 255,
+	255, 255, 255, 255, 240, 255, 255, 255, 255, 255, 249, 255, 248, 33, 127, 246,
+	119, 143, 246, 120, 136, 247, 143, 100, 248, 246, 111, 248, 255, 255, 98, 105,
+	100, 175, 136, 39, 71, 71, 250, 79, 98, 248, 249, 167, 255, 255, 255, 102,
+	163, 168, 132, 171, 82, 60, 167, 147, 63, 102, 196, 172, 166, 170, 250, 118,
+	118, 195, 164, 164, 77, 210, 87, 203, 146, 95, 73, 213, 253, 253, 170, 248,
+	247, 101, 179, 156, 161, 187, 179, 157, 167, 146, 141, 168, 150, 186, 234, 172,
+	249, 234, 81, 138, 148, 154, 183, 175, 87, 73, 159, 63, 102, 255, 175, 58,
+	255, 159, 255, 101, 227, 122, 84, 186, 225, 94, 185, 115, 95, 102, 196, 190,
+	250, 251, 249, 251, 84, 131, 152, 163, 122, 178, 106, 69, 99, 62, 150, 178,
+	234, 155, 187, 251, 105, 84, 210, 136, 146, 124, 194, 154, 152, 164, 143, 104,
+	165, 250, 218, 123, 251, 140, 117, 67, 82, 116, 181, 255, 74, 79, 148, 74,
+	54, 191, 252, 255, 95, 255, 246, 136, 248, 152, 240, 255, 255, 255, 255, 249,
+	255, 255, 254, 255, 159, 255, 255, 255, 50, 115, 118, 115, 101, 228, 139, 151,
+	100, 126, 84, 180, 231, 184, 234, 238, 238, 167, 243, 255, 241, 255, 243, 186,
+	255, 243, 255, 255, 250, 159, 252, 207, 255, 255, 83, 198, 255, 251, 255, 251,
+	255, 254, 99, 255, 255, 254, 255, 255, 254, 255, 240, 98, 180, 68, 100, 198,
+	165, 121, 169, 163, 171, 53, 102, 220, 138, 153, 251, 122, 133, 136, 138, 191,
+	138, 250, 23, 120, 150, 47, 132, 184, 127, 247, 255, 255, 255, 102, 194, 132,
+	179, 152, 245, 73, 218, 131, 60, 102, 163, 188, 249, 217, 251, 122, 102, 251,
+	204, 251, 251, 251, 191, 175, 191, 187, 171, 192, 247, 250, 255, 255, 255, 136,
+	243, 255, 241, 255, 243, 191, 255, 245, 255, 251, 246, 255, 255, 251, 250, 251,
+	83, 254, 72, 245, 143, 245, 255, 255, 81, 95, 68, 247, 255, 136, 255, 255,
+	255, 101, 252, 246, 241, 255, 244, 255, 255, 152, 143, 255, 242, 255, 248, 255,
+	245, 255, 135, 167, 115, 101, 147, 100, 87, 54, 255, 95, 34, 255, 255, 119,
+	255, 247, 255, 103, 162, 171, 146, 221, 243, 173, 169, 162, 143, 185, 198, 170,
+	252, 131, 246, 250, 68, 146, 103, 147, 118, 147, 104, 103, 115, 94, 228, 231,
+	135, 167, 152, 238, 238, 50, 165, 148, 135, 154, 194, 191, 167, 56, 159, 56,
+	200, 122, 135, 255, 255, 255, 133, 246, 255, 254, 255, 255, 111, 127, 142, 255,
+	15, 254, 255, 255, 255, 255, 255, 134, 255, 223, 255, 255, 255, 15, 111, 255,
+	95, 143, 255, 255, 255, 255, 255, 255, 254, 173, 253, 47, 255, 255, 79, 169,
+	255, 255, 209, 255, 255, 255, 255, 255, 255, 33, 102, 151, 134, 247, 246, 111,
+	103, 102, 111, 118, 89, 120, 255, 255, 255, 255, 115, 77, 35, 255, 219, 136,
+	79, 83, 91, 44, 117, 200, 255, 251, 255, 252, 255, 118, 251, 251, 180, 255,
+	240, 255, 171, 255, 191, 191, 255, 255, 255, 255, 255, 250, 82, 152, 79, 251,
+	203, 250, 111, 76, 95, 47, 162, 171, 255, 255, 255, 207, 255, 101, 244, 172,
+	241, 252, 194, 203, 202, 181, 159, 156, 182, 251, 255, 127, 255, 175, 220, 115,
+	73, 70, 255, 249, 158, 136, 130, 127, 120, 250, 255, 255, 175, 255, 241, 50,
+	244, 159, 82, 255, 246, 255, 255, 131, 127, 100, 246, 248, 151, 255, 255, 255,
+	183, 241, 255, 180, 255, 246, 255, 255, 244, 175, 250, 243, 255, 255, 167, 255,
+	251, 118, 50, 154, 163, 188, 227, 155, 134, 51, 175, 152, 165, 205, 252, 133,
+	250, 119, 100, 204, 106, 158, 186, 182, 94, 18, 106, 79, 198, 185, 253, 255,
+	255, 255, 255, 68, 247, 252, 251, 255, 245, 127, 255, 247, 95, 117, 240, 255,
+	255, 255, 255, 239, 136, 246, 249, 241, 191, 241, 95, 255, 244, 255, 191, 246,
+	187, 248, 246, 247, 246, 34, 247, 245, 245, 127, 246, 255, 255, 44, 127, 69,
+	109, 255, 255, 255, 255, 255, 117, 244, 207, 147, 255, 243, 143, 191, 242, 111,
+	186, 194, 159, 255, 255, 252, 152, 151, 82, 164, 242, 255, 248, 79, 116, 105,
+	63, 41, 191, 255, 246, 183, 175, 255, 254, 242, 136, 40, 255, 255, 255, 187,
+	241, 255, 255, 255, 255, 255, 255, 255, 255, 115, 255, 15, 255, 255, 255, 255,
+	117, 255, 111, 255, 255, 255, 255, 255, 255, 255, 49, 86, 133, 118, 120, 246,
+	127, 117, 118, 71, 100, 119, 137, 255, 255, 255, 255, 49, 175, 56, 251, 171,
+	203, 137, 102, 139, 93, 51, 125, 250, 171, 255, 143, 255, 34, 251, 127, 244,
+	95, 244, 127, 255, 117, 47, 247, 246, 255, 255, 255, 255, 255, 129, 92, 167,
+	94, 252, 173, 78, 70, 121, 110, 99, 143, 159, 191, 255, 223, 255, 168, 148,
+	83, 53, 243, 191, 191, 87, 245, 44, 99, 106, 191, 127, 202, 255, 248, 116,
+	245, 127, 241, 247, 243, 47, 255, 244, 255, 223, 254, 111, 255, 255, 254, 254,
+	119, 150, 159, 248, 255, 240, 255, 255, 141, 255, 127, 247, 255, 255, 255, 255,
+	255, 49, 143, 214, 205, 219, 255, 159, 120, 222, 77, 179, 249, 199, 255, 255,
+	255, 255, 51, 244, 126, 242, 255, 244, 143, 254, 99, 143, 230, 245, 255, 246,
+	115, 243, 255, 49, 69, 253, 244, 255, 252, 255, 255, 51, 255, 72, 254, 255,
+	248, 255, 255, 255, 100, 178, 152, 162, 140, 243, 140, 184, 147, 63, 135, 213,
+	185, 200, 149, 250, 185, 246, 246, 130, 247, 249, 79, 47, 102, 57, 56, 169,
+	255, 255, 79, 255, 255, 255, 102, 246, 95, 241, 255, 243, 255, 255, 242, 255,
+	255, 254, 255, 255, 251, 254, 255, 245, 241, 222, 223, 242, 255, 255, 122, 247,
+	119, 210, 255, 255, 255, 255, 255, 255, 65, 119, 103, 103, 103, 150, 127, 135,
+	119, 127, 117, 103, 185, 159, 255, 251, 191, 82, 127, 53, 191, 255, 187, 72,
+	84, 155, 63, 116, 250, 255, 255, 255, 255, 255, 101, 243, 249, 241, 255, 243,
+	122, 168, 167, 111, 250, 164, 255, 249, 255, 255, 255, 135, 246, 210, 179, 95,
+	243, 87, 253, 212, 127, 42, 243, 255, 255, 255, 247, 223, 101, 196, 250, 193,
+	185, 195, 255, 252, 181, 159, 191, 246, 252, 255, 255, 252, 255, 83, 175, 89,
+	167, 255, 159, 134, 84, 119, 26, 163, 245, 143, 122, 255, 255, 255, 84, 245,
+	251, 177, 191, 241, 111, 155, 248, 111, 164, 249, 255, 255, 255, 255, 255, 118,
+	163, 191, 246, 251, 241, 95, 180, 164, 111, 247, 242, 191, 250, 251, 249, 119,
+	85, 102, 119, 93, 87, 255, 239, 22, 236, 111, 86, 95, 255, 239, 255, 255,
+	252, 88, 242, 255, 241, 255, 255, 255, 255, 243, 255, 255, 255, 255, 255, 255,
+	255, 248, 128, 197, 218, 116, 217, 245, 91, 221, 134, 175, 121, 122, 255, 255,
+	172, 250, 252, 134, 82, 171, 195, 159, 245, 255, 255, 35, 175, 170, 198, 255,
+	255, 197, 250, 248, 114, 229, 67, 211, 247, 246, 94, 186, 166, 157, 37, 137,
+	238, 140, 175, 251, 175, 33, 159, 255, 73, 246, 159, 111, 87, 159, 79, 148,
+	248, 255, 159, 255, 255, 255, 118, 243, 246, 243, 175, 247, 111, 175, 146, 79,
+	73, 147, 255, 255, 255, 250, 39, 135, 255, 255, 255, 255, 249, 255, 255, 255,
+	255, 249, 240, 255, 255, 255, 255, 255, 99, 147, 103, 116, 216, 229, 140, 84,
+	114, 63, 68, 106, 254, 156, 199, 247, 172, 82, 117, 115, 213, 156, 245, 153,
+	203, 53, 184, 41, 151, 255, 236, 255, 255, 207, 84, 194, 245, 162, 139, 243,
+	143, 143, 162, 79, 120, 200, 202, 203, 203, 250, 247, 168, 15, 79, 253, 255,
+	250, 159, 143, 255, 95, 86, 245, 255, 255, 255, 255, 255, 102, 242, 255, 243,
+	255, 242, 255, 255, 242, 255, 248, 243, 255, 255, 254, 255, 255, 101, 244, 244,
+	246, 175, 242, 255, 255, 41, 191, 47, 248, 191, 255, 255, 255, 255, 66, 241,
+	243, 249, 247, 248, 255, 255, 249, 255, 255, 246, 255, 248, 255, 255, 255, 255,
+	240, 255, 255, 255, 255, 255, 255, 243, 255, 255, 255, 255, 255, 255, 255, 255,
+	33, 134, 119, 135, 118, 246, 111, 135, 143, 127, 102, 143, 255, 255, 255, 255,
+	255, 168, 127, 134, 255, 255, 247, 8, 103, 175, 127, 102, 53, 186, 111, 255,
+	255, 255, 18, 245, 255, 244, 255, 251, 111, 247, 54, 255, 246, 254, 255, 255,
+	255, 255, 255, 135, 137, 97, 249, 255, 249, 175, 120, 255, 26, 74, 255, 255,
+	249, 255, 255, 255, 33, 157, 249, 52, 120, 147, 111, 255, 253, 159, 131, 253,
+	255, 255, 255, 255, 255, 137, 246, 161, 167, 244, 95, 75, 63, 255, 72, 156,
+	255, 143, 250, 255, 255, 255, 140, 243, 255, 246, 255, 242, 255, 255, 242, 255,
+	137, 242, 255, 255, 255, 255, 255, 84, 250, 255, 175, 255, 255, 143, 95, 152,
+	15, 103, 248, 175, 255, 255, 255, 255, 34, 244, 252, 247, 255, 247, 207, 247,
+	122, 63, 86, 242, 95, 255, 255, 255, 239, 87, 240, 255, 243, 249, 244, 255,
+	255, 246, 255, 248, 95, 255, 255, 255, 255, 255, 50, 253, 245, 115, 247, 252,
+	255, 243, 61, 143, 56, 254, 255, 244, 255, 255, 255, 82, 251, 255, 135, 255,
+	246, 255, 255, 71, 207, 245, 141, 241, 255, 254, 255, 255, 119, 255, 255, 241,
+	255, 159, 127, 47, 255, 127, 98, 255, 255, 249, 255, 255, 255, 49, 101, 111,
+	100, 119, 133, 88, 118, 247, 111, 69, 248, 248, 255, 255, 248, 255, 98, 105,
+	55, 250, 137, 247, 63, 70, 127, 47, 69, 170, 255, 135, 127, 175, 255, 83,
+	154, 137, 248, 159, 255, 104, 23, 245, 95, 69, 250, 105, 255, 255, 255, 255,
+	185, 102, 86, 184, 250, 250, 137, 73, 118, 111, 18, 251, 255, 255, 255, 255,
+	245, 248, 242, 255, 243, 255, 246, 239, 255, 242, 127, 239, 255, 255, 255, 47,
+	245, 255, 119, 198, 255, 240, 255, 252, 127, 255, 214, 255, 127, 254, 255, 255,
+	255, 255, 255, 103, 242, 239, 247, 255, 244, 255, 249, 241, 255, 217, 242, 249,
+	255, 159, 255, 246, 81, 153, 166, 255, 255, 255, 95, 111, 249, 79, 52, 137,
+	255, 143, 255, 255, 255, 50, 251, 93, 251, 98, 253, 79, 127, 107, 63, 231,
+	251, 119, 255, 255, 255, 255, 102, 161, 255, 242, 255, 244, 255, 255, 133, 255,
+	255, 242, 175, 255, 245, 249, 255, 49, 248, 86, 245, 127, 248, 255, 246, 214,
+	255, 52, 254, 255, 255, 255, 255, 255, 248, 243, 191, 245, 255, 163, 95, 50,
+	181, 47, 136, 255, 255, 248, 121, 248, 255, 247, 190, 254, 255, 255, 255, 207,
+	10, 255, 95, 236, 255, 255, 255, 255, 255, 255, 49, 246, 87, 71, 118, 245,
+	79, 102, 85, 95, 118, 135, 255, 255, 255, 255, 255, 82, 90, 115, 249, 248,
+	183, 105, 70, 143, 79, 132, 184, 248, 82, 255, 255, 255, 100, 132, 133, 252,
+	255, 248, 74, 136, 249, 24, 135, 207, 103, 250, 255, 255, 255, 118, 88, 136,
+	123, 168, 95, 74, 89, 123, 127, 117, 15, 250, 143, 255, 255, 255, 98, 162,
+	136, 131, 216, 243, 92, 183, 147, 186, 87, 134, 188, 186, 154, 246, 183, 66,
+	119, 103, 136, 247, 73, 95, 68, 117, 47, 99, 247, 245, 249, 255, 255, 255,
+	99, 130, 101, 146, 198, 164, 138, 117, 131, 88, 86, 133, 204, 169, 199, 248,
+	200, 82, 148, 133, 163, 108, 243, 137, 152, 84, 153, 56, 165, 219, 233, 220,
+	247, 232, 67, 245, 255, 116, 255, 251, 255, 243, 245, 191, 31, 253, 246, 247,
+	253, 255, 127, 117, 67, 142, 243, 248, 247, 143, 50, 95, 55, 116, 103, 255,
+	255, 86, 255, 255, 49, 102, 118, 85, 248, 134, 111, 104, 85, 255, 133, 111,
+	247, 255, 255, 255, 255, 66, 79, 54, 175, 248, 172, 58, 55, 170, 63, 67,
+	207, 255, 255, 255, 255, 255, 101, 150, 247, 244, 251, 242, 27, 247, 168, 95,
+	137, 243, 249, 247, 255, 251, 255, 150, 241, 248, 180, 47, 243, 152, 252, 211,
+	143, 106, 249, 255, 255, 251, 255, 247, 100, 241, 171, 212, 250, 182, 207, 172,
+	241, 223, 135, 250, 155, 252, 175, 253, 251, 150, 255, 105, 185, 248, 127, 143,
+	20, 207, 47, 103, 143, 250, 143, 255, 255, 255, 119, 249, 153, 68, 255, 240,
+	127, 191, 151, 79, 127, 246, 255, 248, 255, 251, 255, 100, 150, 251, 244, 111,
+	244, 187, 43, 162, 107, 159, 241, 255, 255, 255, 255, 255, 134, 84, 67, 84,
+	197, 138, 90, 53, 100, 88, 68, 91, 156, 108, 172, 255, 243, 255, 243, 255,
+	246, 255, 255, 255, 255, 240, 255, 255, 253, 255, 255, 255, 255, 255, 100, 147,
+	107, 242, 191, 241, 63, 137, 180, 255, 89, 153, 255, 248, 255, 251, 248, 135,
+	67, 155, 179, 248, 242, 175, 150, 36, 255, 249, 248, 255, 255, 135, 249, 249,
+	116, 179, 68, 68, 164, 196, 151, 166, 149, 220, 51, 54, 255, 249, 166, 251,
+	136, 82, 255, 171, 255, 255, 191, 127, 23, 175, 91, 83, 250, 250, 255, 255,
+	255, 255, 85, 245, 244, 246, 175, 246, 63, 255, 177, 143, 53, 101, 255, 255,
+	255, 255, 175, 104, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240, 255,
+	255, 255, 255, 255, 82, 245, 201, 177, 200, 246, 124, 179, 184, 127, 102, 175,
+	255, 252, 247, 248, 249, 117, 245, 181, 150, 143, 244, 95, 245, 67, 155, 24,
+	249, 202, 252, 251, 255, 250, 82, 195, 152, 178, 140, 243, 191, 197, 195, 143,
+	117, 244, 252, 248, 249, 250, 249, 117, 84, 85, 130, 199, 132, 89, 53, 88,
+	76, 68, 137, 157, 136, 122, 217, 255, 200, 194, 252, 244, 255, 245, 255, 207,
+	241, 255, 207, 255, 255, 255, 255, 255, 248, 33, 246, 124, 254, 255, 250, 127,
+	247, 166, 95, 95, 244, 255, 254, 255, 255, 255, 133, 240, 250, 245, 255, 248,
+	255, 255, 246, 245, 255, 255, 255, 175, 245, 255, 245, 245, 238, 255, 255, 255,
+	255, 239, 15, 255, 191, 121, 255, 223, 255, 255, 255, 255, 166, 255, 223, 255,
+	255, 255, 255, 15, 255, 255, 253, 255, 255, 255, 255, 255, 255, 33, 118, 102,
+	118, 135, 183, 121, 103, 103, 121, 118, 136, 121, 170, 205, 253, 223, 82, 143,
+	37, 249, 255, 248, 95, 69, 79, 47, 246, 87, 247, 120, 255, 255, 255, 99,
+	250, 146, 255, 255, 255, 175, 182, 255, 111, 21, 255, 250, 255, 255, 255, 255,
+	64, 127, 255, 255, 175, 250, 255, 239, 255, 95, 243, 255, 255, 159, 255, 255,
+	255, 254, 230, 78, 244, 245, 253, 102, 21, 143, 127, 211, 127, 255, 255, 255,
+	255, 255, 49, 103, 86, 246, 102, 246, 255, 101, 134, 127, 245, 248, 247, 255,
+	255, 255, 255, 67, 70, 198, 255, 116, 103, 87, 54, 95, 63, 68, 127, 245,
+	69, 255, 255, 255, 68, 255, 93, 69, 255, 255, 95, 55, 120, 63, 38, 135,
+	127, 243, 255, 255, 255, 83, 76, 118, 228, 253, 255, 53, 53, 70, 63, 83,
+	127, 255, 230, 255, 255, 252, 211, 230, 109, 255, 255, 255, 54, 53, 111, 79,
+	70, 242, 255, 247, 255, 255, 255, 64, 168, 135, 119, 169, 248, 105, 136, 119,
+	105, 134, 120, 120, 255, 255, 255, 255, 113, 127, 85, 223, 168, 140, 188, 85,
+	154, 79, 99, 73, 170, 89, 255, 254, 255, 69, 241, 253, 252, 127, 250, 127,
+	255, 244, 223, 207, 242, 255, 255, 255, 255, 245, 50, 242, 120, 116, 127, 244,
+	255, 245, 115, 127, 255, 248, 255, 255, 255, 255, 255, 82, 165, 147, 196, 181,
+	122, 122, 67, 181, 127, 66, 137, 155, 151, 255, 184, 251, 33, 243, 111, 231,
+	255, 246, 223, 245, 244, 223, 239, 108, 111, 255, 255, 255, 255, 232, 242, 255,
+	248, 255, 248, 255, 222, 241, 207, 255, 242, 255, 255, 255, 255, 71, 151, 101,
+	34, 135, 247, 173, 187, 68, 150, 140, 84, 159, 187, 63, 252, 255, 253, 67,
+	146, 175, 180, 255, 245, 191, 249, 179, 191, 151, 250, 187, 251, 247, 255, 242,
+	135, 209, 255, 241, 143, 247, 255, 111, 214, 255, 247, 248, 255, 248, 143, 255,
+	255, 82, 104, 212, 175, 245, 143, 250, 89, 137, 53, 98, 143, 248, 187, 255,
+	255, 255, 49, 132, 87, 243, 246, 244, 95, 247, 228, 255, 88, 126, 255, 255,
+	255, 255, 255, 84, 161, 255, 244, 135, 242, 248, 255, 244, 79, 168, 249, 255,
+	249, 120, 255, 249, 245, 102, 99, 132, 242, 68, 127, 99, 136, 159, 51, 175,
+	143, 164, 255, 247, 255, 104, 244, 255, 240, 255, 243, 255, 255, 247, 255, 255,
+	255, 255, 255, 252, 255, 255, 165, 154, 132, 127, 250, 255, 255, 18, 175, 255,
+	111, 175, 255, 255, 255, 255, 255, 48, 255, 239, 255, 245, 255, 255, 127, 255,
+	249, 255, 255, 255, 255, 255, 255, 255, 33, 119, 87, 247, 119, 246, 104, 119,
+	127, 111, 84, 119, 246, 127, 255, 255, 255, 82, 205, 83, 250, 181, 215, 71,
+	59, 106, 75, 67, 153, 141, 149, 255, 79, 255, 135, 246, 255, 247, 255, 242,
+	95, 175, 242, 31, 255, 247, 255, 255, 191, 255, 244, 100, 170, 74, 187, 249,
+	139, 171, 20, 152, 47, 71, 255, 188, 123, 255, 207, 255, 167, 121, 100, 98,
+	248, 252, 89, 40, 111, 91, 36, 255, 159, 127, 207, 255, 255, 84, 212, 159,
+	245, 255, 240, 255, 248, 211, 153, 255, 247, 127, 255, 255, 255, 159, 70, 241,
+	204, 226, 242, 244, 255, 255, 246, 111, 119, 238, 255, 255, 255, 255, 239, 114,
+	168, 39, 159, 172, 207, 122, 71, 249, 76, 67, 90, 191, 159, 255, 255, 255,
+	118, 243, 159, 245, 252, 244, 47, 255, 194, 59, 137, 245, 175, 251, 252, 255,
+	250, 134, 255, 133, 241, 255, 175, 41, 79, 170, 111, 88, 175, 255, 117, 127,
+	255, 255, 247, 255, 255, 127, 245, 255, 207, 79, 255, 116, 49, 255, 63, 255,
+	255, 255, 255, 245, 255, 255, 255, 255, 255, 239, 119, 255, 31, 23, 255, 79,
+	255, 255, 255, 255, 132, 255, 15, 255, 255, 255, 223, 63, 255, 127, 143, 255,
+	255, 255, 255, 255, 255, 254, 190, 254, 255, 255, 255, 15, 42, 255, 255, 230,
+	255, 255, 255, 255, 255, 255, 48, 153, 135, 134, 159, 248, 137, 136, 119, 118,
+	151, 153, 255, 251, 127, 255, 255, 97, 159, 53, 252, 184, 154, 57, 85, 171,
+	63, 101, 153, 223, 250, 255, 255, 255, 134, 195, 156, 245, 95, 241, 79, 250,
+	242, 111, 156, 245, 255, 252, 123, 248, 251, 101, 164, 207, 179, 175, 242, 127,
+	202, 161, 127, 248, 247, 154, 251, 127, 251, 187, 99, 195, 116, 200, 246, 106,
+	143, 88, 150, 61, 114, 173, 104, 141, 255, 255, 253, 119, 250, 249, 103, 255,
+	241, 63, 175, 241, 175, 250, 247, 255, 255, 255, 248, 255, 68, 163, 168, 165,
+	171, 147, 71, 184, 163, 95, 119, 242, 249, 255, 255, 255, 63, 133, 69, 34,
+	102, 248, 251, 122, 53, 101, 88, 85, 72, 127, 140, 255, 207, 247, 33, 243,
+	254, 245, 237, 245, 255, 111, 84, 255, 211, 252, 254, 255, 255, 255, 255, 151,
+	240, 255, 247, 255, 244, 159, 151, 246, 255, 255, 248, 255, 247, 255, 255, 255,
+	254, 196, 255, 240, 255, 246, 255, 254, 135, 255, 255, 245, 255, 255, 254, 255,
+	255, 81, 186, 132, 203, 235, 253, 191, 115, 155, 95, 101, 154, 251, 239, 255,
+	255, 255, 117, 242, 184, 100, 175, 243, 191, 90, 118, 255, 23, 165, 251, 255,
+	191, 255, 255, 119, 195, 204, 161, 205, 244, 207, 253, 178, 47, 251, 247, 255,
+	252, 136, 249, 201, 68, 131, 119, 146, 170, 247, 56, 83, 104, 95, 88, 255,
+	95, 249, 255, 255, 255, 135, 244, 255, 243, 255, 244, 255, 255, 165, 255, 255,
+	249, 255, 255, 240, 246, 255, 236, 240, 254, 245, 255, 245, 255, 255, 244, 255,
+	255, 255, 255, 255, 255, 255, 246, 250, 255, 252, 239, 110, 255, 63, 96, 255,
+	207, 220, 255, 239, 255, 255, 255, 255, 251, 238, 255, 255, 255, 255, 239, 191,
+	255, 63, 33, 255, 223, 255, 255, 255, 255, 246, 214, 244, 255, 255, 255, 143,
+	208, 255, 255, 101, 255, 255, 255, 255, 255, 255, 64, 151, 136, 169, 169, 185,
+	175, 121, 137, 123, 118, 186, 251, 252, 186, 255, 255, 115, 223, 36, 111, 110,
+	127, 95, 68, 239, 79, 53, 239, 111, 255, 255, 255, 255, 118, 147, 255, 247,
+	191, 24, 79, 255, 167, 63, 52, 249, 255, 251, 255, 255, 250, 101, 178, 247,
+	242, 143, 242, 148, 250, 245, 127, 102, 180, 255, 255, 143, 255, 250, 134, 179,
+	153, 148, 249, 242, 191, 251, 145, 111, 169, 179, 255, 248, 255, 251, 191, 84,
+	246, 255, 45, 255, 244, 255, 255, 246, 127, 25, 243, 255, 255, 255, 255, 249,
+	83, 150, 121, 149, 150, 244, 111, 239, 244, 31, 246, 245, 255, 255, 249, 255,
+	255, 143, 237, 76, 238, 254, 255, 239, 6, 253, 143, 214, 239, 255, 255, 255,
+	255, 252, 50, 116, 254, 242, 237, 244, 127, 246, 116, 255, 211, 244, 255, 246,
+	255, 255, 255, 83, 179, 119, 164, 247, 245, 106, 170, 145, 250, 136, 68, 255,
+	251, 251, 247, 248, 134, 36, 155, 181, 255, 244, 255, 163, 35, 255, 203, 247,
+	255, 252, 166, 252, 122, 98, 195, 87, 66, 245, 117, 188, 187, 212, 203, 53,
+	108, 251, 170, 124, 253, 249, 68, 239, 87, 255, 247, 255, 49, 86, 86, 191,
+	43, 127, 255, 255, 255, 255, 255, 101, 203, 113, 194, 255, 243, 143, 251, 195,
+	127, 87, 247, 207, 247, 255, 249, 248, 131, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 240, 255, 255, 255, 255, 255, 81, 181, 70, 180, 248, 211, 216,
+	115, 168, 72, 73, 248, 255, 137, 251, 248, 253, 64, 215, 219, 216, 143, 244,
+	203, 173, 167, 204, 74, 255, 255, 223, 207, 251, 255, 101, 242, 153, 242, 111,
+	246, 175, 255, 162, 63, 119, 247, 255, 255, 168, 255, 249, 120, 86, 228, 251,
+	255, 253, 117, 55, 79, 63, 22, 127, 127, 255, 255, 255, 255, 117, 99, 255,
+	241, 255, 242, 248, 255, 245, 255, 247, 255, 101, 246, 252, 255, 255, 50, 245,
+	239, 114, 255, 247, 143, 79, 252, 239, 242, 255, 255, 255, 255, 255, 255, 49,
+	119, 103, 101, 103, 247, 102, 119, 104, 153, 117, 120, 136, 255, 255, 255, 255,
+	135, 223, 116, 255, 151, 250, 88, 104, 141, 19, 69, 201, 171, 108, 255, 138,
+	255, 84, 190, 255, 185, 175, 240, 153, 250, 248, 111, 248, 255, 191, 255, 255,
+	255, 255, 117, 199, 114, 169, 184, 201, 111, 72, 249, 23, 87, 255, 169, 143,
+	255, 255, 255, 34, 251, 245, 247, 255, 247, 127, 116, 43, 95, 246, 106, 255,
+	255, 255, 255, 239, 118, 114, 51, 243, 255, 255, 41, 72, 101, 90, 101, 249,
+	175, 175, 255, 255, 247, 102, 242, 187, 241, 255, 242, 255, 255, 245, 255, 91,
+	150, 175, 246, 255, 245, 255, 98, 191, 104, 191, 169, 201, 111, 58, 123, 31,
+	115, 251, 247, 248, 255, 255, 255, 86, 246, 243, 242, 255, 245, 47, 247, 245,
+	119, 226, 251, 255, 247, 255, 255, 255, 103, 249, 255, 241, 252, 243, 255, 175,
+	241, 255, 169, 182, 207, 255, 255, 250, 248, 50, 119, 135, 98, 111, 245, 248,
+	246, 135, 95, 38, 135, 248, 255, 255, 255, 255, 51, 98, 255, 246, 111, 243,
+	255, 255, 242, 127, 244, 244, 255, 247, 255, 255, 248, 118, 137, 58, 241, 255,
+	106, 89, 76, 255, 95, 102, 255, 255, 255, 95, 255, 255, 247, 5, 255, 247,
+	255, 255, 207, 203, 255, 255, 253, 255, 255, 127, 255, 255, 255, 250, 247, 255,
+	193, 255, 242, 255, 255, 249, 255, 255, 255, 255, 255, 127, 246, 255, 48, 118,
+	119, 118, 152, 183, 121, 119, 121, 111, 118, 120, 152, 255, 255, 255, 255, 97,
+	78, 52, 152, 230, 185, 88, 52, 142, 77, 100, 141, 250, 153, 255, 168, 255,
+	103, 245, 255, 247, 247, 115, 207, 255, 240, 143, 255, 246, 255, 255, 255, 255,
+	255, 101, 243, 255, 245, 31, 244, 191, 255, 245, 191, 255, 184, 255, 255, 250,
+	255, 251, 83, 242, 255, 161, 159, 245, 106, 159, 148, 175, 168, 247, 246, 249,
+	255, 249, 247, 99, 116, 83, 86, 163, 135, 95, 86, 71, 150, 99, 85, 203,
+	191, 255, 206, 253, 83, 241, 247, 229, 255, 242, 103, 255, 245, 223, 111, 252,
+	127, 255, 255, 245, 255, 69, 162, 255, 243, 143, 246, 255, 255, 148, 175, 247,
+	241, 248, 255, 250, 250, 249, 134, 51, 69, 102, 181, 223, 169, 84, 82, 92,
+	71, 106, 175, 106, 191, 223, 248, 49, 243, 255, 102, 255, 245, 239, 255, 242,
+	255, 244, 255, 255, 255, 255, 255, 255, 85, 241, 255, 245, 255, 242, 175, 123,
+	249, 255, 170, 120, 250, 255, 250, 255, 249, 85, 242, 159, 244, 248, 245, 255,
+	255, 241, 255, 120, 255, 255, 255, 255, 255, 248, 81, 89, 100, 136, 133, 205,
+	91, 86, 88, 58, 99, 121, 143, 185, 204, 252, 255, 100, 245, 243, 242, 255,
+	247, 223, 247, 243, 31, 143, 248, 255, 255, 255, 255, 255, 134, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 240, 255, 255, 255, 255, 255, 151, 242, 255,
+	243, 255, 245, 255, 155, 241, 255, 191, 244, 255, 246, 255, 250, 245, 85, 244,
+	175, 242, 122, 241, 248, 255, 243, 111, 104, 250, 249, 247, 255, 255, 255, 85,
+	177, 250, 179, 159, 242, 159, 170, 148, 175, 247, 245, 255, 134, 167, 249, 247,
+	135, 121, 146, 180, 249, 165, 136, 70, 47, 175, 53, 251, 175, 119, 248, 255,
+	255, 88, 242, 249, 149, 255, 241, 255, 143, 152, 159, 255, 255, 255, 255, 253,
+	249, 255, 33, 251, 119, 253, 255, 247, 255, 238, 77, 255, 206, 253, 255, 255,
+	255, 255, 239, 123, 240, 253, 247, 255, 246, 255, 255, 246, 254, 255, 255, 255,
+	245, 254, 255, 253, 98, 111, 242, 79, 255, 255, 207, 51, 95, 143, 84, 159,
+	255, 255, 255, 255, 255, 245, 240, 239, 239, 246, 127, 111, 107, 246, 255, 68,
+	255, 255, 255, 255, 255, 255, 129, 255, 239, 127, 255, 255, 111, 31, 255, 159,
+	255, 255, 111, 255, 255, 255, 255, 64, 167, 136, 152, 151, 248, 138, 87, 137,
+	143, 136, 248, 249, 191, 255, 255, 255, 99, 127, 68, 154, 152, 73, 41, 68,
+	127, 47, 119, 120, 191, 249, 255, 191, 255, 99, 245, 247, 246, 255, 214, 63,
+	255, 241, 191, 71, 253, 255, 254, 255, 255, 255, 119, 242, 175, 247, 143, 182,
+	120, 155, 162, 47, 170, 165, 255, 255, 255, 255, 251, 68, 244, 255, 240, 255,
+	252, 255, 247, 134, 255, 143, 255, 255, 255, 255, 255, 255, 113, 198, 163, 217,
+	196, 188, 95, 87, 111, 63, 103, 168, 175, 202, 255, 95, 255, 50, 163, 118,
+	114, 255, 165, 135, 118, 244, 143, 103, 247, 255, 255, 255, 255, 255, 179, 84,
+	85, 166, 196, 255, 122, 52, 196, 155, 52, 125, 140, 125, 202, 255, 242, 35,
+	115, 254, 244, 125, 244, 255, 255, 86, 255, 38, 252, 254, 255, 255, 255, 255,
+	51, 241, 111, 134, 255, 245, 239, 247, 243, 143, 143, 255, 255, 255, 245, 255,
+	255, 103, 98, 247, 108, 255, 244, 255, 255, 209, 255, 136, 248, 255, 255, 255,
+	255, 255, 33, 251, 204, 235, 253, 243, 255, 255, 250, 255, 162, 228, 255, 255,
+	255, 255, 239, 50, 79, 197, 79, 249, 255, 47, 56, 76, 95, 132, 199, 252,
+	251, 255, 255, 255, 101, 243, 175, 177, 255, 249, 63, 252, 243, 143, 249, 244,
+	255, 255, 255, 250, 207, 231, 255, 255, 255, 255, 255, 111, 255, 255, 255, 255,
+	240, 255, 255, 255, 255, 255, 34, 244, 226, 116, 254, 244, 247, 125, 85, 223,
+	214, 109, 127, 255, 254, 255, 255, 50, 243, 247, 244, 63, 245, 47, 248, 102,
+	255, 120, 245, 245, 246, 127, 255, 255, 118, 194, 121, 195, 189, 244, 171, 201,
+	213, 47, 154, 215, 207, 219, 131, 255, 251, 163, 34, 118, 69, 247, 119, 73,
+	84, 79, 95, 244, 255, 191, 251, 255, 255, 255, 117, 251, 247, 253, 255, 255,
+	127, 49, 237, 255, 194, 253, 255, 246, 255, 255, 239, 100, 253, 255, 255, 255,
+	255, 255, 112, 255, 255, 255, 255, 255, 255, 255, 255, 255, 245, 255, 223, 255,
+	255, 255, 15, 111, 255, 255, 255, 255, 255, 255, 255, 255, 255, 49, 101, 117,
+	103, 150, 166, 90, 87, 88, 103, 85, 119, 167, 175, 255, 250, 255, 82, 79,
+	54, 157, 166, 135, 73, 68, 175, 58, 100, 216, 124, 202, 255, 191, 255, 52,
+	69, 141, 252, 31, 251, 127, 255, 85, 127, 207, 253, 248, 255, 255, 255, 255,
+	81, 200, 148, 203, 199, 251, 124, 52, 170, 45, 163, 207, 93, 191, 255, 255,
+	255, 50, 244, 255, 243, 248, 244, 255, 136, 243, 79, 244, 243, 248, 255, 255,
+	255, 255, 183, 88, 67, 67, 214, 207, 58, 69, 54, 85, 120, 63, 255, 188,
+	207, 255, 248, 69, 246, 143, 243, 255, 245, 223, 143, 243, 255, 225, 255, 255,
+	255, 247, 254, 255, 86, 195, 143, 251, 255, 246, 79, 247, 81, 255, 85, 254,
+	255, 255, 62, 255, 255, 65, 175, 70, 123, 184, 251, 152, 118, 122, 59, 114,
+	168, 252, 253, 255, 253, 255, 33, 244, 245, 251, 246, 253, 119, 244, 247, 79,
+	227, 243, 255, 255, 255, 255, 255, 152, 209, 185, 180, 255, 244, 143, 220, 194,
+	255, 189, 243, 255, 248, 248, 255, 245, 49, 247, 246, 247, 127, 245, 120, 255,
+	230, 143, 95, 245, 248, 247, 255, 255, 255, 53, 117, 255, 244, 143, 244, 63,
+	255, 40, 63, 247, 248, 255, 243, 254, 255, 255, 132, 82, 70, 190, 246, 248,
+	121, 119, 136, 47, 133, 95, 155, 184, 255, 255, 255, 124, 240, 239, 247, 254,
+	247, 255, 239, 246, 223, 253, 255, 255, 255, 255, 255, 255, 34, 252, 255, 246,
+	255, 247, 118, 254, 29, 255, 198, 254, 255, 255, 255, 255, 239, 161, 255, 245,
+	255, 255, 249, 127, 41, 255, 143, 101, 255, 255, 255, 255, 255, 255, 98, 238,
+	247, 255, 255, 255, 239, 47, 255, 31, 179, 255, 223, 255, 255, 255, 255, 81,
+	111, 199, 255, 255, 255, 207, 37, 95, 95, 255, 255, 255, 255, 255, 255, 255,
+	49, 117, 153, 119, 105, 247, 143, 134, 104, 95, 135, 111, 137, 255, 255, 255,
+	255, 133, 175, 101, 255, 175, 122, 27, 55, 255, 47, 117, 155, 255, 184, 255,
+	255, 255, 118, 246, 101, 148, 255, 145, 90, 243, 87, 95, 117, 149, 255, 248,
+	249, 249, 249, 175, 244, 241, 245, 95, 242, 88, 255, 249, 111, 79, 255, 249,
+	255, 249, 249, 247, 99, 243, 255, 245, 250, 243, 255, 249, 145, 255, 159, 249,
+	255, 255, 247, 248, 249, 130, 119, 39, 251, 199, 223, 95, 71, 183, 79, 52,
+	79, 207, 255, 255, 127, 253, 100, 251, 127, 60, 255, 240, 223, 255, 247, 127,
+	239, 252, 255, 255, 255, 255, 255, 53, 241, 255, 245, 119, 243, 127, 239, 247,
+	111, 135, 243, 255, 143, 255, 255, 255, 247, 152, 72, 242, 248, 255, 111, 70,
+	103, 79, 54, 63, 255, 91, 159, 255, 245, 239, 243, 255, 242, 255, 245, 255,
+	255, 241, 255, 255, 252, 255, 255, 255, 255, 255, 117, 242, 175, 245, 247, 246,
+	95, 175, 130, 175, 37, 246, 255, 255, 159, 255, 255, 84, 68, 255, 145, 255,
+	245, 143, 89, 87, 159, 248, 246, 255, 249, 79, 255, 255, 145, 162, 84, 247,
+	248, 245, 152, 251, 181, 185, 74, 255, 249, 250, 191, 252, 253, 49, 239, 231,
+	255, 255, 255, 223, 188, 223, 191, 66, 255, 255, 255, 255, 255, 255, 85, 245,
+	86, 243, 247, 246, 63, 250, 98, 95, 52, 250, 255, 250, 159, 255, 255, 150,
+	177, 101, 166, 247, 243, 72, 137, 244, 105, 148, 150, 255, 255, 249, 255, 249,
+	116, 114, 245, 243, 95, 243, 251, 255, 115, 139, 73, 243, 251, 255, 255, 255,
+	248, 100, 242, 185, 99, 143, 242, 159, 250, 130, 175, 248, 246, 255, 255, 248,
+	255, 250, 223, 243, 255, 245, 255, 243, 255, 255, 240, 255, 255, 110, 247, 255,
+	251, 254, 255, 211, 243, 255, 241, 255, 255, 255, 254, 227, 255, 207, 245, 255,
+	255, 143, 255, 228, 116, 51, 241, 253, 243, 247, 255, 255, 247, 254, 255, 255,
+	255, 255, 254, 255, 244, 243, 255, 255, 255, 255, 255, 255, 143, 255, 95, 192,
+	95, 239, 255, 255, 255, 255, 33, 118, 247, 95, 244, 120, 255, 102, 104, 255,
+	86, 246, 247, 255, 255, 255, 255, 98, 191, 68, 191, 186, 169, 26, 86, 255,
+	58, 149, 250, 175, 251, 255, 255, 255, 82, 247, 133, 247, 169, 191, 79, 95,
+	191, 27, 164, 255, 159, 91, 255, 250, 255, 134, 179, 37, 180, 247, 249, 111,
+	104, 180, 95, 81, 159, 255, 175, 159, 255, 245, 65, 255, 243, 255, 255, 191,
+	74, 255, 191, 75, 163, 255, 255, 155, 255, 255, 255, 246, 220, 221, 240, 255,
+	253, 111, 189, 223, 207, 108, 255, 255, 255, 255, 255, 255, 190, 255, 255, 255,
+	255, 255, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 241, 46,
+	213, 254, 255, 255, 122, 244, 79, 238, 255, 255, 255, 255, 255, 255, 100, 127,
+	104, 255, 127, 244, 117, 71, 159, 31, 102, 111, 255, 246, 255, 255, 255, 228,
+	52, 124, 255, 254, 255, 95, 190, 255, 31, 107, 255, 239, 111, 255, 255, 255,
+	115, 214, 84, 221, 247, 247, 111, 23, 236, 95, 53, 223, 255, 239, 255, 255,
+	251, 199, 239, 237, 111, 255, 255, 79, 76, 223, 15, 235, 255, 255, 255, 255,
+	255, 255, 33, 134, 136, 104, 153, 249, 159, 149, 135, 111, 118, 127, 249, 255,
+	255, 255, 255, 230, 95, 34, 255, 255, 255, 111, 115, 239, 79, 71, 239, 255,
+	255, 255, 255, 255, 119, 247, 253, 241, 207, 251, 31, 255, 244, 223, 207, 253,
+	255, 255, 255, 255, 255, 248, 170, 102, 249, 250, 255, 95, 115, 247, 255, 65,
+	255, 255, 255, 255, 255, 243, 103, 243, 255, 245, 255, 244, 95, 255, 242, 31,
+	249, 246, 255, 255, 255, 255, 255, 84, 248, 248, 241, 255, 246, 255, 255, 242,
+	47, 255, 246, 255, 249, 255, 255, 255, 65, 120, 117, 104, 255, 246, 111, 55,
+	68, 127, 86, 248, 127, 255, 255, 255, 255, 129, 103, 85, 255, 137, 248, 101,
+	69, 118, 95, 133, 255, 255, 255, 255, 255, 255, 113, 254, 227, 255, 254, 255,
+	199, 21, 255, 87, 229, 255, 255, 143, 255, 255, 255, 66, 239, 125, 255, 246,
+	255, 213, 180, 223, 31, 101, 244, 255, 255, 255, 255, 255, 254, 245, 255, 240,
+	111, 252, 255, 255, 248, 143, 255, 254, 255, 255, 255, 255, 255, 68, 215, 6,
+	250, 255, 252, 95, 183, 111, 95, 199, 255, 255, 255, 255, 111, 255, 114, 95,
+	36, 255, 255, 138, 153, 67, 153, 47, 153, 255, 251, 175, 255, 255, 255, 254,
+	241, 252, 252, 191, 250, 47, 255, 246, 223, 207, 253, 255, 255, 255, 255, 254,
+	50, 125, 220, 239, 247, 255, 95, 77, 243, 31, 123, 255, 239, 255, 255, 255,
+	255, 49, 239, 237, 255, 255, 255, 95, 39, 215, 191, 228, 255, 255, 255, 246,
+	255, 255, 255, 252, 254, 247, 143, 246, 239, 143, 248, 239, 15, 254, 255, 255,
+	255, 255, 255, 250, 123, 246, 249, 255, 240, 250, 255, 247, 255, 175, 255, 255,
+	255, 255, 255, 255, 247, 70, 255, 241, 255, 241, 255, 255, 220, 255, 255, 254,
+	255, 255, 246, 255, 255, 65, 248, 39, 245, 255, 245, 255, 255, 253, 255, 102,
+	248, 255, 255, 255, 255, 255, 252, 18, 127, 243, 255, 246, 255, 254, 253, 103,
+	111, 255, 255, 255, 246, 255, 255, 80, 254, 244, 253, 255, 244, 255, 255, 238,
+	255, 111, 255, 255, 255, 255, 255, 255, 237, 251, 255, 246, 255, 240, 255, 255,
+	244, 191, 255, 253, 255, 255, 254, 255, 255, 116, 253, 252, 255, 255, 240, 255,
+	255, 191, 255, 175, 255, 255, 254, 255, 255, 255, 65, 252, 77, 229, 254, 246,
+	255, 255, 246, 255, 45, 238, 255, 255, 255, 255, 255, 235, 251, 109, 74, 254,
+	241, 255, 243, 43, 223, 222, 126, 255, 255, 255, 255, 255, 64, 249, 255, 253,
+	255, 245, 255, 255, 238, 255, 111, 255, 255, 255, 255, 255, 255, 236, 246, 255,
+	246, 255, 241, 255, 255, 242, 63, 255, 253, 255, 255, 109, 255, 255, 48, 159,
+	215, 255, 255, 255, 223, 79, 255, 223, 243, 255, 255, 255, 255, 255, 255, 255,
+	13, 255, 254, 255, 242, 255, 255, 238, 255, 255, 255, 255, 255, 255, 255, 255,
+	246, 168, 39, 241, 255, 245, 255, 255, 249, 255, 233, 255, 255, 255, 255, 255,
+	255, 33, 239, 110, 255, 255, 255, 223, 189, 111, 191, 227, 255, 255, 255, 255,
+	255, 255, 66, 255, 46, 255, 255, 255, 47, 143, 159, 159, 244, 255, 255, 255,
+	255, 255, 255, 80, 255, 255, 255, 255, 255, 95, 222, 255, 223, 244, 255, 255,
+	255, 255, 255, 255, 247, 253, 255, 246, 255, 241, 255, 255, 253, 255, 255, 242,
+	255, 255, 255, 255, 255, 252, 244, 255, 253, 255, 241, 255, 255, 241, 255, 255,
+	255, 255, 255, 255, 255, 255, 48, 251, 175, 246, 253, 246, 255, 255, 253, 255,
+	255, 255, 255, 255, 255, 255, 255, 231, 251, 14, 123, 255, 246, 255, 102, 252,
+	111, 142, 254, 255, 255, 255, 255, 255, 255, 252, 255, 253, 255, 236, 15, 255,
+	253, 207, 255, 254, 255, 255, 255, 255, 255, 251, 251, 255, 252, 245, 252, 239,
+	255, 252, 255, 15, 255, 255, 255, 255, 255, 255, 116, 221, 255, 240, 255, 253,
+	255, 255, 238, 255, 255, 255, 255, 255, 255, 255, 255, 80, 253, 238, 248, 244,
+	243, 255, 247, 252, 255, 207, 255, 255, 255, 255, 255, 255, 82, 248, 242, 251,
+	255, 246, 255, 255, 221, 241, 191, 254, 255, 255, 255, 255, 255,
+};
+
+static const LangModel kLangModels [6] =
+{
+	{ "en", 28, kLettersEn, kContextsEn, kCostsEn },
+	{ "ru", 34, kLettersRu, kContextsRu, kCostsRu },
+	{ "uk", 34, kLettersUk, kContextsUk, kCostsUk },
+	{ "de", 32, kLettersDe, kContextsDe, kCostsDe },
+	{ "fr", 32, kLettersFr, kContextsFr, kCostsFr },
+	{ "es", 34, kLettersEs, kContextsEs, kCostsEs },
+};
@@ -0,0 +1,131 @@
+// The selection translation state machine (see pipeline.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pipeline.h"
+#include "trace.h"
+#include "common.h"
+
+void PipelineInit( Pipeline* p, const PipelineHost* host, const PipelineTimeouts* timeouts )
+{
+	memset(p, 0, sizeof(*p));
+	p->host = *host;
+	p->timeouts = *timeouts;
+	p->state = psIdle;
+}
+
+bool PipelineIsBusy( const Pipeline* p )
+{
+	return (p->state != psIdle);
+}
+
+uint32_t PipelineTimeLeft_ms( const Pipeline* p )
+{
+	uint32_t timeout_ms;
+	switch( p->state )
+	{
+		case psWaitingForWmCopy:        timeout_ms = p->timeouts.wmcopy_ms; break;
+		case psWaitingForKeyboardCopy:  timeout_ms = p->timeouts.keyboard_copy_ms; break;
+		case psDelayBeforePaste:        timeout_ms = p->timeouts.paste_delay_ms; break;
+		default:                        return UINT32_MAX;
+	}
+	uint32_t elapsed_ms = p->host.now_ms(p->host.ctx) - p->start_ms;
+	return (elapsed_ms < timeout_ms) ? timeout_ms - elapsed_ms : 0;
+}
+
+static void BackToIdle( Pipeline* p, bool pasted )
+{
+	p->host.stop_timer(p->host.ctx);
+	p->state = psIdle;
+	TRACE(trAsyncEnd, "translation", p->id);
+	p->host.idle(p->host.ctx, pasted);
+}
+
+void PipelineOnTimer( Pipeline* p )
+{
+	const PipelineHost* h = &p->host;
+	uint32_t now_ms = h->now_ms(h->ctx);
+	uint32_t elapsed_ms = now_ms - p->start_ms;
+
+	switch( p->state )
+	{
+		case psWaitingForWmCopy:
+			if( elapsed_ms >= p->timeouts.wmcopy_ms )
+			{
+				LOG("WM_COPY timed out");
+				TRACE_INSTANT("wm_copy.timeout", elapsed_ms);
+				p->start_ms = now_ms;
+				TRACE_INSTANT("keyboard_copy", p->special_handling);
+				if( h->send_copy_keys(h->ctx, p->special_handling) )
+					p->state = psWaitingForKeyboardCopy;
+				else
+					BackToIdle(p, false);
+			}
+			break;
+
+		case psWaitingForKeyboardCopy:
+			if( elapsed_ms >= p->timeouts.keyboard_copy_ms )
+			{
+				LOG("keyboard copy timed out");
+				TRACE_INSTANT("keyboard_copy.timeout", elapsed_ms);
+				BackToIdle(p, false);
+			}
+			break;
+
+		case psDelayBeforePaste:
+			if( elapsed_ms >= p->timeouts.paste_delay_ms )
+			{
+				TRACE_INSTANT("paste", p->special_handling);
+				h->send_paste_keys(h->ctx, p->special_handling);
+				BackToIdle(p, true);
+			}
+			break;
+
+		default:
+			LOG("turning off timer in state %d (elapsed %lums)", p->state, (unsigned long)elapsed_ms);
+			h->stop_timer(h->ctx);
+	}
+}
+
+void PipelineOnClipboardUpdate( Pipeline* p )
+{
+	const PipelineHost* h = &p->host;
+	if( (p->state == psWaitingForWmCopy) || (p->state == psWaitingForKeyboardCopy) )
+	{
+		TRACE_INSTANT("clipboard.update", p->state);
+		switch( h->translate_clipboard(h->ctx, p->target_layout, p->special_handling) )
+		{
+			case poPaste:
+				p->start_ms = h->now_ms(h->ctx);
+				p->state = psDelayBeforePaste;
+				break;
+
+			case poTyped:
+				TRACE_INSTANT("typed", p->special_handling);
+				BackToIdle(p, true);
+				break;
+
+			case poFailed:
+				break;
+		}
+	}
+}
+
+void PipelineStart( Pipeline* p, PipeWindow target, PipeLayout target_layout )
+{
+	const PipelineHost* h = &p->host;
+	if( PipelineIsBusy(p) )  return LOG("busy");
+
+	p->special_handling = h->special_handling(h->ctx, target);
+	if( p->special_handling == shIgnore )  return LOG("ignored (special handling)");
+
+	p->target_layout = target_layout;
+	p->start_ms = h->now_ms(h->ctx);
+	if( !h->start_timer(h->ctx) )  return;
+
+	p->state = psWaitingForWmCopy;
+	TRACE(trAsyncBegin, "translation", ++p->id);
+	h->post_copy(h->ctx, target);
+	LOG("sent WM_COPY");
+}
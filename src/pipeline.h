@@ -0,0 +1,102 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The selection translation state machine, independent of the system it runs on:
+//
+//   idle --Start--> waiting for WM_COPY --timeout--> waiting for keyboard copy --timeout--> idle
+//                          |                                  |
+//                          +------ clipboard update ----------+--> delay before paste --> paste, idle
+//                                                             |
+//                                                             +--> typed, idle
+//
+// Everything it needs from the outside world (the clock, a periodic timer, the clipboard,
+// key injection and window messages) goes through a PipelineHost: mojibake.c implements
+// it with the Win32 API, tools/pipesim.c with a discrete-event simulation in virtual time.
+
+typedef uintptr_t PipeWindow;   // HWND on Windows
+typedef uintptr_t PipeLayout;   // what to translate with: a Translation* on Windows
+
+typedef enum
+{
+	shNoSpecialHandling,
+	shIgnore,
+	shCtrlInsert,
+} SpecialHandling;
+
+// how the translated selection gets into the target window
+typedef enum
+{
+	poFailed,
+	poPaste,    // it is in the clipboard, to be pasted after the delay
+	poTyped,    // it has been typed over the selection already (which counts as pasted)
+} PipeOutput;
+
+typedef struct
+{
+	uint32_t (*now_ms)( void* ctx );                   // a wrapping millisecond clock
+	bool     (*start_timer)( void* ctx );              // calls PipelineOnTimer periodically (or see PipelineTimeLeft_ms) until stopped
+	void     (*stop_timer)( void* ctx );
+	SpecialHandling (*special_handling)( void* ctx, PipeWindow target );
+	void     (*post_copy)( void* ctx, PipeWindow target );                 // WM_COPY
+	bool     (*send_copy_keys)( void* ctx, SpecialHandling sh );          // Ctrl+C or Ctrl+Ins
+	bool     (*send_paste_keys)( void* ctx, SpecialHandling sh );         // Ctrl+V or Shift+Ins
+	// translates the clipboard in place, or types the translation into a target with `sh`
+	PipeOutput (*translate_clipboard)( void* ctx, PipeLayout target_layout, SpecialHandling sh );
+	void     (*idle)( void* ctx, bool pasted );        // a translation has ended, one way or another
+	void*    ctx;
+} PipelineHost;
+
+typedef struct
+{
+	uint32_t  wmcopy_ms;          // how long to wait for the window to react to WM_COPY
+	uint32_t  keyboard_copy_ms;   // ... and then to the simulated copy keys
+	uint32_t  paste_delay_ms;     // between updating the clipboard and pasting it
+} PipelineTimeouts;
+
+// the defaults, found by trial and error
+#define PIPELINE_DEFAULT_TIMEOUTS  { .wmcopy_ms = 100, .keyboard_copy_ms = 300, .paste_delay_ms = 100 }
+
+typedef enum
+{
+	psIdle,
+	psWaitingForWmCopy,
+	psWaitingForKeyboardCopy,
+	psDelayBeforePaste,
+} PipelineState;
+
+typedef struct
+{
+	PipelineHost      host;
+	PipelineTimeouts  timeouts;
+	PipelineState     state;
+	PipeLayout        target_layout;
+	SpecialHandling   special_handling;
+	uint32_t          start_ms;     // of the current state
+	unsigned          id;           // of the current translation, for tracing
+} Pipeline;
+
+
+// ---- provided by pipeline.c -------------------------------------------------
+
+// All these must be called from the same thread (the host's callbacks are called on it, too).
+
+void PipelineInit( Pipeline* p, const PipelineHost* host, const PipelineTimeouts* timeouts );
+
+bool PipelineIsBusy( const Pipeline* p );
+
+// Starts translating the selection in `target` into `target_layout`;
+// does nothing if busy, or if the target is to be ignored.
+void PipelineStart( Pipeline* p, PipeWindow target, PipeLayout target_layout );
+
+// To be called by the host on each clipboard change, and on each timer tick.
+void PipelineOnClipboardUpdate( Pipeline* p );
+void PipelineOnTimer( Pipeline* p );
+
+// How long until the current state times out (0: it has), UINT32_MAX if idle; lets
+// a host arm a one-shot timer for the next PipelineOnTimer instead of ticking.
+uint32_t PipelineTimeLeft_ms( const Pipeline* p );
+
+#endif
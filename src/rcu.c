@@ -0,0 +1,76 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "rcu.h"
+
+void* RcuRead( RcuCell* cell )
+{
+	// The epoch is announced before the pointer is loaded, and checked again after the
+	// announcement: a writer that has read the reader's epoch before it was announced
+	// (as quiescent, say) has bumped the epoch before that, so the check sees the bump
+	// and the announcement is made again. All sequentially consistent: the writer's
+	// swap, bump and read of reader_epoch on one side, the announcement and the check
+	// on the other.
+	uint64_t epoch = atomic_load(&cell->epoch), seen;
+	for( ;; )
+	{
+		atomic_store(&cell->reader_epoch, epoch);
+		if( (seen = atomic_load(&cell->epoch)) == epoch )  break;
+		epoch = seen;
+	}
+	// If the epoch already counts a publish, the pointer swap that preceded it is
+	// visible too, so the reader cannot end up with a snapshot retired at or before it.
+	return atomic_load(&cell->current);
+}
+
+void RcuReadEnd( RcuCell* cell )
+{
+	atomic_store_explicit(&cell->reader_epoch, RCU_QUIESCENT, memory_order_release);
+}
+
+void RcuReclaim( RcuCell* cell )
+{
+	uint64_t reader_epoch = atomic_load(&cell->reader_epoch);
+
+	unsigned kept = 0;
+	for( unsigned i = 0; i < cell->nretired; ++i )
+	{
+		if( cell->retired[i].epoch <= reader_epoch )
+			cell->release(cell->retired[i].ptr);
+		else
+			cell->retired[kept++] = cell->retired[i];
+	}
+	cell->nretired = kept;
+}
+
+bool RcuPublish( RcuCell* cell, void* next )
+{
+	RcuReclaim(cell);
+	if( cell->nretired == RCU_MAX_RETIRED )  return false;
+
+	void* prev = atomic_exchange(&cell->current, next);
+	uint64_t epoch = atomic_fetch_add(&cell->epoch, 1) + 1;
+
+	if( prev != NULL )
+	{
+		cell->retired[cell->nretired].ptr = prev;
+		cell->retired[cell->nretired].epoch = epoch;
+		++cell->nretired;
+		// a reader that is not in a section right now lets it go at once
+		RcuReclaim(cell);
+	}
+	return true;
+}
+
+void RcuShutdown( RcuCell* cell )
+{
+	for( unsigned i = 0; i < cell->nretired; ++i )
+	{
+		cell->release(cell->retired[i].ptr);
+	}
+	cell->nretired = 0;
+
+	void* p = atomic_exchange(&cell->current, NULL);
+	if( p != NULL )  cell->release(p);
+}
@@ -0,0 +1,69 @@
+#ifndef RCU_H
+#define RCU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+// A pointer to an immutable snapshot, shared between one writer thread and one
+// reader thread without locks (a minimal quiescent-state RCU).
+//
+// The writer publishes a new snapshot with an atomic pointer swap; the old one is
+// retired and freed once the reader has entered a new read-side section after the
+// swap (i.e. has observed the new epoch), or is outside of any, so it cannot be holding
+// the old pointer. A reader that ends its sections is mostly outside of them, and then
+// RcuPublish frees the old snapshot at once, however long the reader stays idle.
+// The reader never blocks and never frees anything.
+
+enum { RCU_MAX_RETIRED = 8 };
+
+typedef struct
+{
+	_Atomic(void*)       current;
+	atomic_uint_fast64_t epoch;          // incremented by each RcuPublish
+	atomic_uint_fast64_t reader_epoch;   // the epoch observed by the reader on its last RcuRead,
+	                                     // RCU_QUIESCENT after RcuReadEnd
+
+	// writer-only
+	void               (*release)( void* );
+	unsigned             nretired;
+	struct { void* ptr; uint64_t epoch; } retired [RCU_MAX_RETIRED];
+} RcuCell;
+
+#define RCU_QUIESCENT  UINT64_MAX
+
+#define RCU_CELL_INIT(release_fn)  { .reader_epoch = RCU_QUIESCENT, .release = (release_fn) }
+
+
+// ---- reader side ------------------------------------------------------------
+
+// Starts a read-side section and returns the current snapshot (can be NULL).
+// The pointer stays valid until RcuReadEnd, or the next RcuRead on the same cell.
+void* RcuRead( RcuCell* cell );
+
+// Ends the read-side section: the reader holds no snapshot until its next RcuRead.
+void RcuReadEnd( RcuCell* cell );
+
+// Inside a read-side section: changes whenever the snapshot may have. A snapshot that has
+// been freed can come back at the same address, so comparing the pointers is not enough.
+static inline uint64_t RcuReadEpoch( RcuCell* cell )
+{
+	return atomic_load_explicit(&cell->reader_epoch, memory_order_relaxed);
+}
+
+// ---- writer side ------------------------------------------------------------
+
+// Swaps in `next` and retires the previous snapshot.
+// Returns false, without publishing, if too many retired snapshots are still
+// waiting for the reader; then `next` remains owned by the caller.
+bool RcuPublish( RcuCell* cell, void* next );
+
+// Releases the retired snapshots the reader can no longer be using.
+// Called by RcuPublish, before and after the swap; can also be called any time from
+// the writer thread.
+void RcuReclaim( RcuCell* cell );
+
+// Releases everything; the reader must have stopped for good.
+void RcuShutdown( RcuCell* cell );
+
+#endif
@@ -0,0 +1,40 @@
+// Retyping a word in another layout (see retype.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "retype.h"
+#include "casemap.h"
+#include "common.h"
+
+// What the key types; CapsLock shifts the letters (the keys whose shifted character is
+// the upper case of the unshifted one).
+static UTF16 KeyChar( const LiveKeymap* km, unsigned key, bool capslock )
+{
+	unsigned sc = key & 0x7F, shifted = key >> 7;
+	UTF16 lower = km->chars[sc][0];
+	if( capslock && (CaseToUpper(lower) != lower) && (km->chars[sc][1] == CaseToUpper(lower)) )
+		shifted ^= 1;
+	return km->chars[sc][shifted];
+}
+
+bool RetypeWord( InjectBatch* b, const uint8_t* keys, unsigned n, unsigned spaces,
+                 const LiveKeymap* from, const LiveKeymap* to, bool capslock )
+{
+	UTF16 text [LIVE_MAX_WORD];
+	unsigned same = n;
+	for( unsigned i = 0; i < n; ++i )
+	{
+		UTF16 typed = KeyChar(from, keys[i], capslock);
+		text[i] = KeyChar(to, keys[i], capslock);
+		if( (keys[i] == 0) || (typed == 0) || (text[i] == 0) )  return false;
+		if( (typed != text[i]) && (same == n) )  same = i;
+	}
+	if( same == n )  return true;   // nothing to fix
+
+	static const UTF16 kSpaces [] = { ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ' };
+	if( spaces > COUNTOF(kSpaces) )  return false;
+	InjectKey(b, INJECT_VK_BACK, n - same + spaces);
+	InjectText(b, text + same, n - same);
+	InjectText(b, kSpaces, spaces);
+	return !b->overflow;
+}
@@ -0,0 +1,23 @@
+#ifndef RETYPE_H
+#define RETYPE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "livedetect.h"
+#include "inject.h"
+
+// Fixing the word just typed in a wrong layout without the clipboard: the keys are known
+// (see LiveDetectorLastWord), so what they typed is erased with Backspace and what they
+// would have typed in the right layout is typed instead, as characters. The keys at the
+// start that type the same in both layouts are left alone.
+
+
+// ---- provided by retype.c ---------------------------------------------------
+
+// Adds to `b` the events that retype the `n` keys (and the `spaces` after them) typed in
+// the layout `from` as if typed in `to`, with CapsLock on or off. Returns false if it
+// can't be told what some key typed in one of them (a dead key, or one typed with AltGr).
+bool RetypeWord( InjectBatch* b, const uint8_t* keys, unsigned n, unsigned spaces,
+                 const LiveKeymap* from, const LiveKeymap* to, bool capslock );
+
+#endif
@@ -0,0 +1,74 @@
+// The platform-independent part of the shared statistics: the seqlock.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <string.h>
+#include "stats.h"
+
+static StatsShared  gStatsPrivate;  // used until published, or if publishing fails
+static StatsShared* gStatsShared = &gStatsPrivate;
+
+void StatsAttach( StatsShared* shm )
+{
+	StatsShared* target = shm ? shm : &gStatsPrivate;
+	if( target == gStatsShared )  return;
+
+	// carry over what has been collected so far
+	StatsData* st = &target->data;
+	memcpy(st, &gStatsShared->data, sizeof(*st));
+	st->magic = STATS_MAGIC;
+	st->size = sizeof(*st);
+	atomic_store_explicit(&target->seq, 0, memory_order_release);
+	gStatsShared = target;
+}
+
+StatsData* StatsBeginUpdate( void )
+{
+	// single writer: a plain read-modify-write of seq is enough
+	unsigned seq = atomic_load_explicit(&gStatsShared->seq, memory_order_relaxed);
+	atomic_store_explicit(&gStatsShared->seq, seq + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	return &gStatsShared->data;
+}
+
+void StatsEndUpdate( void )
+{
+	unsigned seq = atomic_load_explicit(&gStatsShared->seq, memory_order_relaxed);
+	atomic_store_explicit(&gStatsShared->seq, seq + 1, memory_order_release);
+}
+
+const StatsData* StatsCurrent( void )
+{
+	return &gStatsShared->data;
+}
+
+void StatsRecordTime( StatsData* st, StatsHistogram h, uint64_t elapsed_us )
+{
+	unsigned bucket = 0;
+	while( (elapsed_us >>= 1) != 0 && (bucket < STATS_BUCKETS - 1) ) ++bucket;
+	++st->histograms[h][bucket];
+}
+
+void StatsRecordError( StatsData* st, const char* where, uint32_t code )
+{
+	st->last_error = code;
+	strncpy(st->last_error_where, where, STATS_WHERE_SIZE - 1);
+	st->last_error_where[STATS_WHERE_SIZE - 1] = 0;
+}
+
+bool StatsRead( const StatsShared* shm, StatsData* out )
+{
+	for( unsigned attempt = 0; attempt < 1000; ++attempt )
+	{
+		unsigned seq = atomic_load_explicit(&shm->seq, memory_order_acquire);
+		if( seq & 1 )  continue;
+
+		memcpy(out, (const void*)&shm->data, sizeof(*out));
+
+		atomic_thread_fence(memory_order_acquire);
+		if( atomic_load_explicit(&shm->seq, memory_order_relaxed) == seq )
+			return (out->magic == STATS_MAGIC) && (out->size >= sizeof(*out));
+	}
+	return false;
+}
@@ -0,0 +1,149 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+// Live statistics of the running instance, published in a small named shared-memory
+// segment ("Local\kbsw.stats..." on Windows, "/kbsw-stats-UID" with shm_open elsewhere).
+//
+// The running instance is the only writer, always from the same thread; it updates
+// the segment in place under a seqlock, without any syscalls. Readers (kbsw --status,
+// monitoring agents) map it read-only and take consistent snapshots with StatsRead.
+// The layout only ever grows at the end; readers should check `size`.
+
+enum
+{
+	STATS_MAGIC        = 0x7473626B,  // "kbst"
+	STATS_MAX_KEYS     = 8,
+	STATS_BUCKETS      = 24,   // timing histogram buckets: [0] < 2us, [i] < 2^(i+1) us, the last one catches the rest
+	STATS_CMDLINE_SIZE = 1024,
+	STATS_WHERE_SIZE   = 32,
+};
+
+enum
+{
+	STATS_RUNNING = 1,
+	STATS_PAUSED  = 2,
+};
+
+typedef enum
+{
+	stmLayout,          // fixing text typed in a wrong layout
+	stmHexToUnicode,
+	stmUnicodeToHex,
+	STATS_MODES
+} StatsMode;
+
+typedef enum
+{
+	sthSwitch,          // handling of a layout switch activation
+	sthTranslation,     // a selection translation, from the activation to the paste
+	sthQueueDelay,      // how long an activation waited for a busy translation to finish
+	STATS_HISTOGRAMS
+} StatsHistogram;
+
+// the start-up of the running instance, in the order the phases end (see kbsw.c)
+typedef enum
+{
+	spMain,             // the process has got to main
+	spCommandLine,      // parsed
+	spInstanceCheck,    // found no running instance to hand the command line over to
+	spWindow,           // the main window is created, the hook thread started
+	spControlServer,    // listening for control commands, the statistics published
+	spHook,             // the keyboard hook is live
+	spLayouts,          // the LAYOUTs are loaded and assigned to the KEYs
+	STARTUP_PHASES
+} StartupPhase;
+
+typedef struct
+{
+	uint32_t  magic;
+	uint32_t  size;                              // sizeof(StatsData) of the writer
+	uint32_t  pid;
+	uint32_t  flags;                             // STATS_RUNNING, STATS_PAUSED
+	uint64_t  start_time_s;                      // since the Unix epoch
+
+	uint64_t  activations [STATS_MAX_KEYS];      // per switch key
+	uint64_t  ignored_fullscreen;
+	uint64_t  ignored_busy;                      // dropped from a full queue while a translation was busy
+	uint64_t  translations [STATS_MODES];
+	uint64_t  detection_hits;                    // source layout detected
+	uint64_t  detection_misses;
+
+	uint32_t  last_error;
+	char      last_error_where [STATS_WHERE_SIZE];
+	char      command_line [STATS_CMDLINE_SIZE];  // UTF-8
+
+	uint64_t  histograms [STATS_HISTOGRAMS][STATS_BUCKETS];
+
+	uint64_t  activations_queued;                // arrived while a translation was busy
+	uint64_t  activations_coalesced;             // superseded by a later one while queued
+	uint64_t  switches_skipped;                  // the target already had the layout
+	uint64_t  clipboard_bytes_copied;            // preserving the user's clipboard contents
+	uint64_t  clipboard_formats_skipped;         // ... not preserved (can't be retained, over the budgets, or too many)
+	uint64_t  translations_other;                // by translators other than the ones in StatsMode
+	uint64_t  wrong_layout_words;                // --detect verdicts
+	uint64_t  words_retyped;                     // by --fix-word
+	uint64_t  translations_typed;                // of all translations, typed instead of pasted
+	uint32_t  startup_us [STARTUP_PHASES];       // when each phase ended, since the process was created
+	uint64_t  arena_bytes;                       // held for the transient buffers of the translations
+	uint64_t  arena_peak_bytes;                  // the most used by one translation
+	uint64_t  hook_probes;                       // sent by the hook watchdog (see hookwatch.h)
+	uint64_t  hook_probes_failed;                // ... that could not be injected
+	uint64_t  hook_reinstalls;                   // the hook was found gone
+	uint32_t  hook_worst_us;                     // the slowest keyboard hook callback
+} StatsData;
+
+typedef struct
+{
+	atomic_uint  seq;      // odd while an update is in progress
+	StatsData    data;
+} StatsShared;
+
+
+// ---- provided by stats.c ----------------------------------------------------
+
+// Writer side. Every change to the data is bracketed with these:
+//   StatsData* st = StatsBeginUpdate();  ++st->ignored_busy;  StatsEndUpdate();
+// Works even if the segment could not be created (then the data is private).
+StatsData* StatsBeginUpdate( void );
+void StatsEndUpdate( void );
+
+// The writer thread can read the current data directly.
+const StatsData* StatsCurrent( void );
+
+// helpers to be called between StatsBeginUpdate/StatsEndUpdate
+void StatsRecordTime( StatsData* st, StatsHistogram h, uint64_t elapsed_us );
+void StatsRecordError( StatsData* st, const char* where, uint32_t code );
+
+// Switches the writer to the memory `shm` (or back to a private copy if NULL),
+// carrying over the current data. For use by StatsPublish/StatsUnpublish.
+void StatsAttach( StatsShared* shm );
+
+// Reader side: copies a consistent snapshot; returns false if the writer
+// kept updating for too long, or the segment doesn't look right.
+bool StatsRead( const StatsShared* shm, StatsData* out );
+
+
+// ---- provided by stats_win.c / stats_posix.c --------------------------------
+
+// Creates the named segment and makes StatsBeginUpdate write into it.
+bool StatsPublish( void );
+void StatsUnpublish( void );
+
+// Maps the segment of the running instance, read-only; NULL if there is none.
+const StatsShared* StatsOpen( void );
+void StatsClose( const StatsShared* shm );
+
+// a monotonic clock for the timing histograms
+uint64_t StatsNow_us( void );
+
+// the wall clock, for StatsData.start_time_s
+uint64_t StatsWallClock_s( void );
+
+// when the process was created, on the StatsNow_us clock (for StatsData.startup_us)
+uint64_t StatsProcessStart_us( void );
+
+#endif
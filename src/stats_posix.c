@@ -0,0 +1,124 @@
+// The shared statistics segment on POSIX systems: a shm_open object named
+// after the user, and readable by that user only (it holds the command line).
+// Unlike on Windows it outlives a crashed instance, so readers should check
+// that `pid` is still alive.
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "stats.h"
+#include "common.h"
+
+static StatsShared*  gView = NULL;
+
+// the names are shared by all the users: one made by someone else is not ours to use
+static bool IsOurs( int fd )
+{
+	struct stat st;
+	return (fstat(fd, &st) == 0) && (st.st_uid == getuid());
+}
+
+static const char* GetStatsName( void )
+{
+	static char name [64];
+	if( name[0] == 0 )  snprintf(name, sizeof(name), "/kbsw-stats-%u", (unsigned)getuid());
+	return name;
+}
+
+bool StatsPublish( void )
+{
+	int fd = shm_open(GetStatsName(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+	if( fd < 0 )  return LOG("shm_open: %s", strerror(errno)), false;
+	// one left behind by an older version may be readable by all
+	if( !IsOurs(fd) || (fchmod(fd, 0600) != 0) )
+	{
+		close(fd);
+		return LOG("%s: not ours", GetStatsName()), false;
+	}
+
+	void* p = MAP_FAILED;
+	if( ftruncate(fd, sizeof(StatsShared)) == 0 )
+		p = mmap(NULL, sizeof(StatsShared), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if( p == MAP_FAILED )  return LOG("ftruncate/mmap: %s", strerror(errno)), false;
+
+	gView = (StatsShared*) p;
+	StatsAttach(gView);
+	return true;
+}
+
+void StatsUnpublish( void )
+{
+	if( gView == NULL )  return;
+
+	StatsAttach(NULL);
+	munmap(gView, sizeof(StatsShared));
+	shm_unlink(GetStatsName());
+	gView = NULL;
+}
+
+const StatsShared* StatsOpen( void )
+{
+	int fd = shm_open(GetStatsName(), O_RDONLY | O_CLOEXEC, 0);
+	if( fd < 0 )  return NULL;
+	if( !IsOurs(fd) )
+	{
+		close(fd);
+		return NULL;
+	}
+
+	void* p = mmap(NULL, sizeof(StatsShared), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	return (p == MAP_FAILED) ? NULL : (const StatsShared*) p;
+}
+
+void StatsClose( const StatsShared* shm )
+{
+	if( shm )  munmap((void*)shm, sizeof(StatsShared));
+}
+
+uint64_t StatsNow_us( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+uint64_t StatsWallClock_s( void )
+{
+	return (uint64_t) time(NULL);
+}
+
+uint64_t StatsProcessStart_us( void )
+{
+	// the start time in /proc is in clock ticks since the boot
+	uint64_t now_us = StatsNow_us();
+	FILE* f = fopen("/proc/self/stat", "r");
+	if( f == NULL )  return now_us;
+	char buffer [1024];
+	size_t n = fread(buffer, 1, sizeof(buffer) - 1, f);
+	fclose(f);
+	buffer[n] = 0;
+
+	// the fields after the command name, which is in parentheses and may hold anything
+	const char* p = strrchr(buffer, ')');
+	unsigned long long start_ticks;
+	if( (p == NULL) || (sscanf(p + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %*u %*u %*d %*d %*d %*d %*d %*d %llu",
+	                           &start_ticks) != 1) )
+		return now_us;
+
+	struct timespec boot;
+	clock_gettime(CLOCK_BOOTTIME, &boot);
+	uint64_t since_boot_us = (uint64_t)boot.tv_sec * 1000000 + boot.tv_nsec / 1000;
+	uint64_t start_us = start_ticks * 1000000 / sysconf(_SC_CLK_TCK);
+	uint64_t age_us = (since_boot_us > start_us) ? since_boot_us - start_us : 0;
+	return (age_us < now_us) ? now_us - age_us : 0;
+}
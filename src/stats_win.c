@@ -0,0 +1,96 @@
+// The shared statistics segment on Windows: a named pagefile-backed section
+// in the session namespace. It disappears with the last handle, i.e. when
+// the running instance exits (unless a reader still has it open).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <windows.h>
+#include "stats.h"
+#include "common.h"
+
+static const WCHAR kStatsName [] = L"Local\\kbsw.stats.6qZK6nb0dYxsgS6H4b8w";
+
+static HANDLE        ghMapping = NULL;
+static StatsShared*  gView = NULL;
+
+bool StatsPublish( void )
+{
+	ghMapping = CreateFileMappingW(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, sizeof(StatsShared), kStatsName);
+	if( ghMapping == NULL )  return ERR("CreateFileMapping"), false;
+
+	gView = (StatsShared*) MapViewOfFile(ghMapping, FILE_MAP_WRITE, 0, 0, sizeof(StatsShared));
+	if( gView == NULL )
+	{
+		ERR("MapViewOfFile");
+		CloseHandle(ghMapping);
+		ghMapping = NULL;
+		return false;
+	}
+
+	StatsAttach(gView);
+	return true;
+}
+
+void StatsUnpublish( void )
+{
+	if( gView == NULL )  return;
+
+	StatsData* st = StatsBeginUpdate();
+	st->flags &= ~STATS_RUNNING;
+	StatsEndUpdate();
+
+	StatsAttach(NULL);
+	UnmapViewOfFile(gView);
+	CloseHandle(ghMapping);
+	gView = NULL;
+	ghMapping = NULL;
+}
+
+const StatsShared* StatsOpen( void )
+{
+	HANDLE mapping = OpenFileMappingW(FILE_MAP_READ, FALSE, kStatsName);
+	if( mapping == NULL )  return NULL;
+
+	// the view keeps the section alive
+	const StatsShared* shm = (const StatsShared*) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, sizeof(StatsShared));
+	CloseHandle(mapping);
+	return shm;
+}
+
+void StatsClose( const StatsShared* shm )
+{
+	if( shm )  UnmapViewOfFile(shm);
+}
+
+uint64_t StatsNow_us( void )
+{
+	static LARGE_INTEGER freq;
+	if( freq.QuadPart == 0 )  QueryPerformanceFrequency(&freq);
+
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	return (uint64_t)(now.QuadPart / freq.QuadPart) * 1000000
+	     + (uint64_t)(now.QuadPart % freq.QuadPart) * 1000000 / freq.QuadPart;
+}
+
+uint64_t StatsWallClock_s( void )
+{
+	FILETIME ft;
+	GetSystemTimeAsFileTime(&ft);
+	uint64_t t = ((uint64_t)ft.dwHighDateTime << 32) | ft.dwLowDateTime;  // 100ns since 1601
+	return t / 10000000 - 11644473600ULL;
+}
+
+uint64_t StatsProcessStart_us( void )
+{
+	FILETIME created, exited, kernel, user, now;
+	uint64_t now_us = StatsNow_us();
+	if( !GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user) )
+		return ERR("GetProcessTimes"), now_us;
+	GetSystemTimePreciseAsFileTime(&now);
+
+	uint64_t c = ((uint64_t)created.dwHighDateTime << 32) | created.dwLowDateTime;
+	uint64_t n = ((uint64_t)now.dwHighDateTime << 32) | now.dwLowDateTime;
+	uint64_t age_us = (n > c) ? (n - c) / 10 : 0;
+	return (age_us < now_us) ? now_us - age_us : 0;
+}
@@ -0,0 +1,62 @@
+// The double-tap gesture of the switch keys (see tapdetect.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tapdetect.h"
+
+#define COUNT_ACTIVATE              4  // on which transition count value to activate
+#define COUNT_OFF_UP                8  // this sequence should be ignored (switch is up)
+#define COUNT_OFF_DOWN              9  // this sequence should be ignored (switch is down)
+#define ISDOWN( transition_count )  (transition_count & 1)
+#define ISUP( transition_count )    !ISDOWN(transition_count & 1)
+
+void TapDetectorReset( TapDetector* t )
+{
+	t->current = TAP_NONE;
+	t->last_press_ms = 0;
+	t->transitions = 0;
+}
+
+void TapDetectorDown( TapDetector* t, unsigned sw, uint32_t time_ms, uint32_t timeout_ms )
+{
+	uint32_t elapsed_ms = time_ms - t->last_press_ms;
+
+	t->last_press_ms = time_ms;
+
+	if( (sw != t->current) || (elapsed_ms > timeout_ms) )
+	{
+		// could be a new double-press sequence
+		t->current = sw;
+		t->transitions = 1;
+		return;
+	}
+
+	if( ISDOWN(t->transitions) || (elapsed_ms <= TAP_MIN_DELAY_ms) )
+	{
+		// must be an autorepeat or an injected keypress
+		t->transitions = COUNT_OFF_DOWN;
+		return;
+	}
+
+	++t->transitions;
+}
+
+bool TapDetectorUp( TapDetector* t, unsigned sw, uint32_t time_ms, uint32_t timeout_ms )
+{
+	if( sw != t->current )
+	{
+		t->current = TAP_NONE;
+		return false;
+	}
+
+	uint32_t elapsed_ms = time_ms - t->last_press_ms;
+
+	if( ISUP(t->transitions) || (elapsed_ms <= TAP_MIN_DELAY_ms) || (elapsed_ms > timeout_ms) )
+	{
+		t->transitions = COUNT_OFF_UP;
+		return false;
+	}
+
+	++t->transitions;
+	return (t->transitions == COUNT_ACTIVATE);
+}
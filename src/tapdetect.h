@@ -0,0 +1,42 @@
+#ifndef TAPDETECT_H
+#define TAPDETECT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The double-tap gesture of the switch keys: press, release, press, release of the same
+// key, each transition within the tap timeout of the last press. Autorepeats, and presses
+// coming too fast to be typed by a human (injected ones), spoil the sequence; any other
+// key in between starts it over. Fed by the keyboard hook (kbswhook.c) with the index
+// of the switch key and the event time; knows nothing of the system.
+
+enum
+{
+	TAP_NONE         = -1,
+	TAP_MIN_DELAY_ms = 10,   // events coming faster are assumed to be injected
+};
+
+typedef struct
+{
+	int       current;        // the switch key of the sequence, or TAP_NONE
+	uint32_t  last_press_ms;
+	unsigned  transitions;    // counts both presses and releases; odd = the key is down
+} TapDetector;
+
+
+// ---- provided by tapdetect.c ------------------------------------------------
+
+void TapDetectorReset( TapDetector* t );
+
+// The switch key `sw` has gone down or up at `time_ms` (a wrapping millisecond clock);
+// TapDetectorUp returns true when that completes a double tap.
+void TapDetectorDown( TapDetector* t, unsigned sw, uint32_t time_ms, uint32_t timeout_ms );
+bool TapDetectorUp( TapDetector* t, unsigned sw, uint32_t time_ms, uint32_t timeout_ms );
+
+// Some other key: whatever sequence there was is broken.
+static inline void TapDetectorOther( TapDetector* t )
+{
+	t->current = TAP_NONE;
+}
+
+#endif
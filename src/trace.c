@@ -0,0 +1,115 @@
+// The trace event ring.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include "trace.h"
+
+atomic_bool gTraceEnabled;
+
+static TraceEvent            gRing [TRACE_RING_SIZE];
+static atomic_uint_fast64_t  gHead;       // the number of events ever recorded
+static atomic_uint           gNextTid;
+
+static uint32_t CurrentTid( void )
+{
+	static _Thread_local uint32_t tid;
+	if( tid == 0 )  tid = atomic_fetch_add(&gNextTid, 1) + 1;
+	return tid;
+}
+
+void TraceStart( void )
+{
+	for( unsigned i = 0; i < TRACE_RING_SIZE; ++i )
+		atomic_store_explicit(&gRing[i].seq, 0, memory_order_relaxed);
+	atomic_store(&gHead, 0);
+	atomic_store(&gTraceEnabled, true);
+}
+
+void TraceStop( void )
+{
+	atomic_store(&gTraceEnabled, false);
+}
+
+void TraceRecord( TracePhase phase, const char* name, uintptr_t arg, const char* detail )
+{
+	uint64_t n = atomic_fetch_add_explicit(&gHead, 1, memory_order_relaxed);
+	TraceEvent* e = &gRing[n & (TRACE_RING_SIZE - 1)];
+
+	// a seqlock per slot, the same way as in stats.c
+	atomic_store_explicit(&e->seq, 0, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+
+	e->ts_us = AppTraceNow_us();
+	e->name = name;
+	e->arg = arg;
+	e->tid = CurrentTid();
+	e->phase = (char)phase;
+	size_t length = 0;
+	if( detail )
+	{
+		while( (length < TRACE_DETAIL_SIZE - 1) && detail[length] )  ++length;
+		// cut before a UTF-8 sequence that doesn't fit whole, or the JSON would be invalid
+		if( detail[length] )
+			while( (length > 0) && (((unsigned char)detail[length] & 0xC0) == 0x80) )  --length;
+		memcpy(e->detail, detail, length);
+	}
+	e->detail[length] = 0;
+
+	atomic_store_explicit(&e->seq, n + 1, memory_order_release);
+}
+
+static void WriteJsonString( FILE* f, const char* s )
+{
+	fputc('"', f);
+	for( ; *s; ++s )
+	{
+		unsigned char c = (unsigned char)*s;
+		if( (c == '"') || (c == '\\') )  fprintf(f, "\\%c", c);
+		else if( c < 0x20 )  fprintf(f, "\\u%04x", c);
+		else fputc(c, f);
+	}
+	fputc('"', f);
+}
+
+size_t TraceDumpJson( FILE* f )
+{
+	uint64_t head = atomic_load_explicit(&gHead, memory_order_acquire);
+	uint64_t first = (head > TRACE_RING_SIZE) ? head - TRACE_RING_SIZE : 0;
+	size_t count = 0;
+
+	fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", f);
+	for( uint64_t n = first; n < head; ++n )
+	{
+		const TraceEvent* e = &gRing[n & (TRACE_RING_SIZE - 1)];
+		uint64_t seq = atomic_load_explicit(&e->seq, memory_order_acquire);
+		if( seq != n + 1 )  continue;
+
+		TraceEvent copy;
+		memcpy(&copy, (const void*)e, sizeof(copy));
+
+		atomic_thread_fence(memory_order_acquire);
+		if( atomic_load_explicit(&e->seq, memory_order_relaxed) != seq )  continue;
+
+		fprintf(f, "%s\n{\"name\":", count ? "," : "");
+		WriteJsonString(f, copy.name);
+		fprintf(f, ",\"cat\":\"kbsw\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":1,\"tid\":%lu",
+		        copy.phase, (unsigned long long)copy.ts_us, (unsigned long)copy.tid);
+		if( (copy.phase == trAsyncBegin) || (copy.phase == trAsyncEnd) )
+			fprintf(f, ",\"id\":\"0x%llx\"", (unsigned long long)copy.arg);
+		if( copy.phase == trInstant )
+			fputs(",\"s\":\"t\"", f);
+		fprintf(f, ",\"args\":{\"arg\":\"0x%llx\"", (unsigned long long)copy.arg);
+		if( copy.detail[0] )
+		{
+			fputs(",\"detail\":", f);
+			WriteJsonString(f, copy.detail);
+		}
+		fputs("}}", f);
+		++count;
+	}
+	fputs("\n]}\n", f);
+	return count;
+}
@@ -0,0 +1,78 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+// A lock-free in-memory ring of timestamped trace events, for seeing where the time
+// goes in the selection translation pipeline (hook -> activation -> copy -> clipboard
+// update -> detection -> translation -> paste), per application.
+//
+// Recording is off by default; then each TRACE_xxx costs one well-predicted branch.
+// When on, any thread can record (the hook thread and the main thread do); the oldest
+// events get overwritten. TraceDumpJson writes out what's in the ring in the Chrome
+// trace-event format, to be opened in chrome://tracing or https://ui.perfetto.dev.
+//
+// Event names must be string literals (only the pointer is kept).
+
+enum
+{
+	TRACE_RING_SIZE   = 4096,   // a power of 2
+	TRACE_DETAIL_SIZE = 24,
+};
+
+typedef enum
+{
+	trBegin      = 'B',   // a span on the current thread; must nest properly
+	trEnd        = 'E',
+	trInstant    = 'i',
+	trAsyncBegin = 'b',   // a span that may cross other spans; matched by `arg` as the id
+	trAsyncEnd   = 'e',
+} TracePhase;
+
+typedef struct
+{
+	atomic_uint_fast64_t  seq;     // 0 while being written, else the event number + 1
+	uint64_t              ts_us;
+	const char*           name;
+	uintptr_t             arg;
+	uint32_t              tid;
+	char                  phase;
+	char                  detail [TRACE_DETAIL_SIZE];
+} TraceEvent;
+
+extern atomic_bool gTraceEnabled;
+
+#define TRACE_ON()  atomic_load_explicit(&gTraceEnabled, memory_order_relaxed)
+
+#define TRACE(phase, name, arg)           do { if( TRACE_ON() )  TraceRecord(phase, name, (uintptr_t)(arg), NULL); } while( 0 )
+#define TRACE_DETAIL(phase, name, arg, s) do { if( TRACE_ON() )  TraceRecord(phase, name, (uintptr_t)(arg), s); } while( 0 )
+
+#define TRACE_BEGIN(name, arg)    TRACE(trBegin, name, arg)
+#define TRACE_END(name, arg)      TRACE(trEnd, name, arg)
+#define TRACE_INSTANT(name, arg)  TRACE(trInstant, name, arg)
+
+
+// ---- provided by trace.c ----------------------------------------------------
+
+// Starting clears the ring.
+void TraceStart( void );
+void TraceStop( void );
+
+// Use the TRACE_xxx macros instead. `detail` (may be NULL, UTF-8) is copied, truncated
+// to the characters that fit whole.
+void TraceRecord( TracePhase phase, const char* name, uintptr_t arg, const char* detail );
+
+// Writes the recorded events as JSON; returns how many were written.
+// Events being overwritten meanwhile are skipped.
+size_t TraceDumpJson( FILE* f );
+
+
+// ---- should be defined by the application -----------------------------------
+
+// a monotonic clock
+uint64_t AppTraceNow_us( void );
+
+#endif
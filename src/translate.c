@@ -0,0 +1,142 @@
+// The translator registry and pipelines (see translate.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include "translate.h"
+#include "hex.h"
+#include "names.h"
+#include "casemap.h"
+
+static const TranslatorClass* gTranslators [TR_MAX_REGISTERED] =
+{
+	&kHexToUnicode,
+	&kUnicodeToHex,
+	&kClusterToHex,
+	&kNameToChar,
+	&kCharToName,
+	&kCaseInvert,
+	&kCaseCycle,
+};
+static size_t gTranslatorCount = 7;
+
+bool TranslatorRegister( const TranslatorClass* cls )
+{
+	if( gTranslatorCount == TR_MAX_REGISTERED )  return false;
+	gTranslators[gTranslatorCount++] = cls;
+	return true;
+}
+
+const TranslatorClass* TranslatorFind( const char* name, size_t name_length )
+{
+	for( size_t i = 0; i < gTranslatorCount; ++i )
+	{
+		const char* s = gTranslators[i]->name;
+		size_t k = 0;
+		while( (k < name_length) && s[k] && (tolower((unsigned char)s[k]) == tolower((unsigned char)name[k])) ) ++k;
+		if( (k == name_length) && (s[k] == 0) )  return gTranslators[i];
+	}
+	return NULL;
+}
+
+size_t TranslatorCount( void )
+{
+	return gTranslatorCount;
+}
+
+const TranslatorClass* TranslatorAt( size_t index )
+{
+	return (index < gTranslatorCount) ? gTranslators[index] : NULL;
+}
+
+// -----------------------------------------------------------------------------
+
+bool TrPipelineInit( TrPipeline* p, const TranslatorClass* const* classes, const void* const* params, unsigned count )
+{
+	if( (count == 0) || (count > TR_MAX_STAGES) )  return false;
+
+	memset(p, 0, sizeof(*p));
+	p->count = count;
+	for( unsigned i = 0; i < count; ++i )
+	{
+		TrStage* s = &p->stages[i];
+		s->cls = classes[i];
+		s->next = (i + 1 < count) ? &p->stages[i + 1] : NULL;
+		s->cls->init(s->state, params ? params[i] : NULL);
+	}
+	return true;
+}
+
+size_t TrPipelineMaxOutput( const TrPipeline* p, size_t n )
+{
+	for( unsigned i = 0; i < p->count; ++i )
+	{
+		n = p->stages[i].cls->max_output(n);
+	}
+	return n;
+}
+
+void TrEmit( TrStage* stage, UTF16 unit )
+{
+	TrStage* next = stage->next;
+	if( next )
+	{
+		// a 0 would mean the end of the input to the next stage
+		if( unit != 0 )  next->cls->feed(next, unit);
+		return;
+	}
+
+	TrBuffer* out = stage->out;
+	if( out->length < out->size )
+		out->data[out->length++] = unit;
+	else
+		out->overflow = true;
+}
+
+static void FeedRun( TrStage* stage, const UTF16* units, size_t n )
+{
+	if( stage->cls->feed_run )
+	{
+		stage->cls->feed_run(stage, units, n);
+		return;
+	}
+	for( size_t i = 0; i < n; ++i )  stage->cls->feed(stage, units[i]);
+}
+
+void TrEmitRun( TrStage* stage, const UTF16* units, size_t n )
+{
+	if( stage->next )
+	{
+		FeedRun(stage->next, units, n);
+		return;
+	}
+
+	TrBuffer* out = stage->out;
+	size_t room = out->size - out->length;
+	if( n > room )
+	{
+		n = room;
+		out->overflow = true;
+	}
+	memcpy(out->data + out->length, units, n * sizeof(UTF16));
+	out->length += n;
+}
+
+bool TrPipelineRun( TrPipeline* p, const UTF16* input, size_t length, TrBuffer* out )
+{
+	out->length = 0;
+	out->overflow = false;
+	p->stages[p->count - 1].out = out;
+
+	if( length > 0 )  FeedRun(&p->stages[0], input, length);
+
+	// flush the stages in order: what one lets out at the end goes through the rest
+	for( unsigned i = 0; i < p->count; ++i )
+	{
+		p->stages[i].cls->feed(&p->stages[i], 0);
+	}
+
+	out->data[out->length] = 0;
+	return !out->overflow;
+}
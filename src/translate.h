@@ -0,0 +1,99 @@
+#ifndef TRANSLATE_H
+#define TRANSLATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Text translators (hex <-> Unicode and such) and a registry of them by name,
+// so that a KEY=NAME on the command line can be bound to any of them.
+//
+// A translator is a streaming step: it is fed one UTF-16 unit at a time and passes
+// its output on, unit by unit, to the next stage. So several of them chained into a
+// TrPipeline run in a single pass over the text, with no intermediate buffer between
+// the stages; only the last one writes into the output buffer.
+
+typedef uint16_t UTF16;   // same as WCHAR on Windows
+
+enum
+{
+	TR_MAX_STAGES     = 4,
+	TR_STATE_SIZE     = 128,  // bytes of per-stage state
+	TR_MAX_REGISTERED = 32,
+};
+
+typedef struct TrStage TrStage;
+
+typedef struct
+{
+	const char*  name;      // matched case-insensitively
+	const char*  inverse;   // the name of the translator undoing this one, or NULL
+	const char*  description;
+
+	// an upper bound of the output size for `n` input units
+	size_t (*max_output)( size_t n );
+
+	// `state` is TR_STATE_SIZE zeroed bytes; `params` is whatever the creator of the pipeline passes
+	void   (*init)( void* state, const void* params );
+
+	// Consumes one unit and emits any output with TrEmit. At the end of the input it
+	// is called with `unit` == 0: it should then emit whatever it has held back.
+	void   (*feed)( TrStage* stage, UTF16 unit );
+
+	// Optional: consumes `n` units (none of them 0) at once, the same as calling `feed`
+	// for each. For translators that can skip over runs of text they leave as is
+	// and pass them on with TrEmitRun.
+	void   (*feed_run)( TrStage* stage, const UTF16* units, size_t n );
+} TranslatorClass;
+
+typedef struct
+{
+	UTF16*  data;
+	size_t  size;       // in units, not counting the terminating 0
+	size_t  length;
+	bool    overflow;   // some output didn't fit and was dropped
+} TrBuffer;
+
+struct TrStage
+{
+	const TranslatorClass*  cls;
+	TrStage*                next;    // NULL for the last stage
+	TrBuffer*               out;
+	_Alignas(8) unsigned char  state [TR_STATE_SIZE];
+};
+
+typedef struct
+{
+	TrStage   stages [TR_MAX_STAGES];
+	unsigned  count;
+} TrPipeline;
+
+
+// ---- provided by translate.c ------------------------------------------------
+
+// The built-in translators are always there; returns false if the registry is full.
+bool TranslatorRegister( const TranslatorClass* cls );
+const TranslatorClass* TranslatorFind( const char* name, size_t name_length );
+size_t TranslatorCount( void );
+const TranslatorClass* TranslatorAt( size_t index );
+
+// `params` (may be NULL) has an entry for each of the `count` classes.
+bool TrPipelineInit( TrPipeline* p, const TranslatorClass* const* classes, const void* const* params, unsigned count );
+
+// an upper bound of the output size for `n` input units, through all the stages
+size_t TrPipelineMaxOutput( const TrPipeline* p, size_t n );
+
+// Translates `length` units of `input` (with no 0s among them, e.g. up to the terminator)
+// into `out` (which it 0-terminates); returns false if the output didn't fit.
+bool TrPipelineRun( TrPipeline* p, const UTF16* input, size_t length, TrBuffer* out );
+
+// For the translators: passes a unit on to the next stage, or into the output buffer.
+void TrEmit( TrStage* stage, UTF16 unit );
+
+// For the translators: the same for `n` units (none of them 0).
+void TrEmitRun( TrStage* stage, const UTF16* units, size_t n );
+
+// For the translators: the state of the stage, as a `type*`.
+#define TR_STATE(stage, type)  ((type*)(stage)->state)
+
+#endif
@@ -0,0 +1,531 @@
+// Transliteration by rule files compiled into tries (see translit.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "translit.h"
+#include "common.h"
+
+typedef struct
+{
+	UTF16     key [TRANSLIT_MAX_RULE];
+	UTF16     value [TRANSLIT_MAX_RULE];
+	uint8_t   key_length;
+	uint8_t   value_length;
+	uint32_t  seq;   // the line order, for the first of the rules for the same key to count
+} TranslitRule;
+
+typedef struct
+{
+	TranslitRule*  rules;
+	size_t         count;
+	size_t         capacity;
+} RuleList;
+
+// ---- the walk ---------------------------------------------------------------
+
+// returns 0 (the root, which is never a child) if there's no such child
+static uint32_t Child( const TranslitTrie* t, uint32_t node, UTF16 u )
+{
+	const TranslitNode* n = &t->nodes[node];
+	const UTF16* units = t->edge_units + n->edges;
+	size_t lo = 0, hi = n->nedges;
+	while( lo < hi )
+	{
+		size_t mid = (lo + hi) / 2;
+		if( units[mid] < u )  lo = mid + 1;
+		else hi = mid;
+	}
+	return ((lo < n->nedges) && (units[lo] == u)) ? t->edge_nodes[n->edges + lo] : 0;
+}
+
+static uint32_t RootChild( const TranslitTrie* t, UTF16 u )
+{
+	return t->root_children[t->root_index[u >> 8] * 256 + (u & 0xFF)];
+}
+
+static uint32_t NextNode( const TranslitTrie* t, uint32_t node, UTF16 u )
+{
+	return (node == 0) ? RootChild(t, u) : Child(t, node, u);
+}
+
+// ---- compilation ------------------------------------------------------------
+
+typedef struct
+{
+	const TranslitRule*  rules;   // sorted by key, one per key
+	TranslitTrie         view;    // over the arrays below, for the walks while compiling
+	TranslitNode*        nodes;
+	UTF16*               edge_units;
+	uint32_t*            edge_nodes;
+	int32_t*             node_rule;    // the rule for the string of the node, or -1
+	uint32_t*            node_first;   // a rule whose key starts with the string of the node
+	uint8_t*             node_depth;
+	uint32_t             nnodes;
+	uint32_t             nedges;
+	UTF16*               pool;
+	size_t               npool;
+	size_t               pool_capacity;
+} Compiler;
+
+static int CompareRules( const void* a, const void* b )
+{
+	const TranslitRule* ra = (const TranslitRule*) a;
+	const TranslitRule* rb = (const TranslitRule*) b;
+	size_t n = (ra->key_length < rb->key_length) ? ra->key_length : rb->key_length;
+	for( size_t i = 0; i < n; ++i )
+	{
+		if( ra->key[i] != rb->key[i] )  return (ra->key[i] < rb->key[i]) ? -1 : 1;
+	}
+	if( ra->key_length != rb->key_length )  return (ra->key_length < rb->key_length) ? -1 : 1;
+	return (ra->seq < rb->seq) ? -1 : (ra->seq > rb->seq);
+}
+
+// makes the node for the common prefix (of `depth` units) of the keys of the rules [lo, hi)
+static uint32_t BuildNode( Compiler* c, size_t lo, size_t hi, unsigned depth )
+{
+	uint32_t node = c->nnodes++;
+	c->node_first[node] = lo;
+	c->node_depth[node] = depth;
+	c->node_rule[node] = -1;
+
+	// the rule for the prefix itself comes first
+	if( c->rules[lo].key_length == depth )  c->node_rule[node] = lo++;
+
+	uint16_t nedges = 0;
+	for( size_t i = lo; i < hi; ++i )
+	{
+		nedges += (i == lo) || (c->rules[i].key[depth] != c->rules[i - 1].key[depth]);
+	}
+
+	uint32_t edges = c->nedges;
+	c->nedges += nedges;
+	c->nodes[node] = (TranslitNode){ .edges = edges, .nedges = nedges };
+
+	for( size_t i = lo, k = 0; i < hi; ++k )
+	{
+		size_t j = i + 1;
+		while( (j < hi) && (c->rules[j].key[depth] == c->rules[i].key[depth]) )  ++j;
+		c->edge_units[edges + k] = c->rules[i].key[depth];
+		c->edge_nodes[edges + k] = BuildNode(c, i, j, depth + 1);
+		i = j;
+	}
+	return node;
+}
+
+static bool AppendToPool( Compiler* c, const UTF16* units, size_t n )
+{
+	if( c->npool + n > c->pool_capacity )
+	{
+		size_t capacity = c->pool_capacity * 2 + n + 64;
+		UTF16* pool = realloc(c->pool, capacity * sizeof(UTF16));
+		if( pool == NULL )  return false;
+		c->pool = pool;
+		c->pool_capacity = capacity;
+	}
+	memcpy(c->pool + c->npool, units, n * sizeof(UTF16));
+	c->npool += n;
+	return true;
+}
+
+// What a node comes to when the walk can't go on: the text it stands for is cut into the
+// longest strings with rules (or single units, left as is) from the start, until what is
+// left is a string in the trie; the walk goes on from there.
+static bool ComputeFail( Compiler* c, uint32_t node )
+{
+	const UTF16* s = c->rules[c->node_first[node]].key;
+	size_t length = c->node_depth[node];
+
+	TranslitNode* n = &c->nodes[node];
+	n->fail_output = c->npool;
+	n->fail = 0;
+
+	for( size_t pos = 0; pos < length; )
+	{
+		if( pos > 0 )
+		{
+			uint32_t rest = 0;
+			for( size_t k = pos; (k < length) && ((k == pos) || rest); ++k )  rest = Child(&c->view, rest, s[k]);
+			if( rest )
+			{
+				n->fail = rest;
+				break;
+			}
+		}
+
+		uint32_t walk = 0;
+		size_t best = 0;
+		int32_t rule = -1;
+		for( size_t k = pos; k < length; ++k )
+		{
+			walk = Child(&c->view, walk, s[k]);
+			if( walk == 0 )  break;
+			if( c->node_rule[walk] >= 0 )  best = k + 1 - pos, rule = c->node_rule[walk];
+		}
+
+		bool ok = (rule >= 0) ? AppendToPool(c, c->rules[rule].value, c->rules[rule].value_length)
+		                      : AppendToPool(c, s + pos, 1);
+		if( !ok )  return false;
+		pos += (rule >= 0) ? best : 1;
+	}
+
+	n->fail_length = c->npool - n->fail_output;
+	return true;
+}
+
+// Compiles the rules (sorting them) into a Transliterator in a single allocation.
+static Transliterator* Compile( TranslitRule* rules, size_t count )
+{
+	qsort(rules, count, sizeof(*rules), CompareRules);
+
+	// the first rule for each key
+	size_t n = 0;
+	for( size_t i = 0; i < count; ++i )
+	{
+		if( (n > 0) && (rules[n - 1].key_length == rules[i].key_length)
+		    && (memcmp(rules[n - 1].key, rules[i].key, rules[i].key_length * sizeof(UTF16)) == 0) )
+			continue;
+		rules[n++] = rules[i];
+	}
+
+	size_t max_nodes = 1;
+	for( size_t i = 0; i < n; ++i )  max_nodes += rules[i].key_length;
+
+	Compiler c = { .rules = rules };
+	c.nodes      = malloc(max_nodes * sizeof(*c.nodes));
+	c.edge_units = malloc(max_nodes * sizeof(*c.edge_units));
+	c.edge_nodes = malloc(max_nodes * sizeof(*c.edge_nodes));
+	c.node_rule  = malloc(max_nodes * sizeof(*c.node_rule));
+	c.node_first = malloc(max_nodes * sizeof(*c.node_first));
+	c.node_depth = malloc(max_nodes * sizeof(*c.node_depth));
+
+	Transliterator* t = NULL;
+	if( !c.nodes || !c.edge_units || !c.edge_nodes || !c.node_rule || !c.node_first || !c.node_depth )
+		goto done;
+
+	if( n > 0 )  BuildNode(&c, 0, n, 0);
+	else c.nodes[c.nnodes++] = (TranslitNode){0};
+	c.view = (TranslitTrie){ .nodes = c.nodes, .edge_units = c.edge_units, .edge_nodes = c.edge_nodes, .nnodes = c.nnodes };
+
+	for( uint32_t i = 1; i < c.nnodes; ++i )
+	{
+		if( !ComputeFail(&c, i) )  goto done;
+	}
+
+	// the blocks of 256 units that the root has children in (block 0 is for none)
+	uint16_t root_index [256] = {0};
+	size_t nroot_blocks = 1;
+	for( uint16_t k = 0; k < c.nodes[0].nedges; ++k )
+	{
+		UTF16 u = c.edge_units[c.nodes[0].edges + k];
+		if( root_index[u >> 8] == 0 )  root_index[u >> 8] = nroot_blocks++;
+	}
+
+	// all in one block: the nodes and the edges, the root tables, and the pool
+	size_t size_nodes = c.nnodes * sizeof(TranslitNode);
+	size_t size_edge_nodes = c.nedges * sizeof(uint32_t);
+	size_t size_root_children = nroot_blocks * 256 * sizeof(uint32_t);
+	size_t size_edge_units = c.nedges * sizeof(UTF16);
+	size_t size_root_index = sizeof(root_index);
+	size_t size_pool = c.npool * sizeof(UTF16);
+	uint8_t* p = malloc(sizeof(Transliterator) + size_nodes + size_edge_nodes + size_root_children
+	                    + size_edge_units + size_root_index + size_pool);
+	if( p == NULL )  goto done;
+
+	t = (Transliterator*) p;
+	memset(t, 0, sizeof(*t));
+	p += sizeof(Transliterator);
+	t->trie.nodes = memcpy(p, c.nodes, size_nodes);                 p += size_nodes;
+	t->trie.edge_nodes = memcpy(p, c.edge_nodes, size_edge_nodes);  p += size_edge_nodes;
+	uint32_t* root_children = memset(p, 0, size_root_children);      p += size_root_children;
+	t->trie.edge_units = memcpy(p, c.edge_units, size_edge_units);  p += size_edge_units;
+	t->trie.root_index = memcpy(p, root_index, size_root_index);    p += size_root_index;
+	t->trie.pool = c.npool ? memcpy(p, c.pool, size_pool) : (UTF16*)p;
+	t->trie.root_children = root_children;
+	t->trie.nnodes = c.nnodes;
+
+	for( uint16_t k = 0; k < c.nodes[0].nedges; ++k )
+	{
+		UTF16 u = c.edge_units[c.nodes[0].edges + k];
+		root_children[root_index[u >> 8] * 256 + (u & 0xFF)] = c.edge_nodes[c.nodes[0].edges + k];
+	}
+
+done:
+	free(c.nodes);
+	free(c.edge_units);
+	free(c.edge_nodes);
+	free(c.node_rule);
+	free(c.node_first);
+	free(c.node_depth);
+	free(c.pool);
+	return t;
+}
+
+// ---- the translators --------------------------------------------------------
+
+typedef struct
+{
+	uint32_t  node;
+} TranslitState;
+
+static_assert(sizeof(TranslitState) <= TR_STATE_SIZE, "TranslitState doesn't fit in a stage");
+
+static size_t TranslitMaxOutput( size_t n )
+{
+	// each unit ends up in at most one replacement
+	return n * TRANSLIT_MAX_RULE;
+}
+
+static void TranslitInit( void* state, const void* _ )
+{
+	memset(state, 0, sizeof(TranslitState));
+}
+
+static void TranslitFeed( TrStage* stage, UTF16 u )
+{
+	const TranslitTrie* t = &((const Transliterator*) stage->cls)->trie;
+	TranslitState* st = TR_STATE(stage, TranslitState);
+	uint32_t node = st->node;
+
+	for( ;; )
+	{
+		uint32_t next = (u != 0) ? NextNode(t, node, u) : 0;
+		if( next != 0 )
+		{
+			st->node = next;
+			return;
+		}
+		if( node == 0 )
+		{
+			st->node = 0;
+			if( u != 0 )  TrEmit(stage, u);
+			return;
+		}
+
+		const TranslitNode* n = &t->nodes[node];
+		TrEmitRun(stage, t->pool + n->fail_output, n->fail_length);
+		node = n->fail;
+	}
+}
+
+static void TranslitFeedRun( TrStage* stage, const UTF16* units, size_t n )
+{
+	const TranslitTrie* t = &((const Transliterator*) stage->cls)->trie;
+	TranslitState* st = TR_STATE(stage, TranslitState);
+
+	for( size_t i = 0; i < n; )
+	{
+		// at the root, pass on what no rule starts with at once
+		if( st->node == 0 )
+		{
+			size_t k = i;
+			while( (k < n) && !RootChild(t, units[k]) )  ++k;
+			if( k > i )  TrEmitRun(stage, units + i, k - i);
+			i = k;
+			if( i == n )  break;
+		}
+		TranslitFeed(stage, units[i++]);
+	}
+}
+
+// ---- the rule files ---------------------------------------------------------
+
+// returns false if it's not valid UTF-8, or too long
+static bool DecodeToken( const char* s, size_t length, UTF16* out, uint8_t* pcount )
+{
+	size_t n = 0;
+	for( size_t i = 0; i < length; )
+	{
+		unsigned char b = s[i];
+		unsigned len = (b < 0x80) ? 1 : ((b & 0xE0) == 0xC0) ? 2 : ((b & 0xF0) == 0xE0) ? 3 : ((b & 0xF8) == 0xF0) ? 4 : 0;
+		if( (len == 0) || (i + len > length) )  return false;
+
+		uint32_t u = (len == 1) ? b : (b & (0x3F >> (len - 1)));
+		for( unsigned k = 1; k < len; ++k )
+		{
+			if( ((unsigned char)s[i + k] & 0xC0) != 0x80 )  return false;
+			u = (u << 6) | (s[i + k] & 0x3F);
+		}
+		i += len;
+
+		static const uint32_t kMin [5] = { 0, 0, 0x80, 0x800, 0x10000 };
+		if( (u < kMin[len]) || (u > 0x10FFFF) || ((u & 0xFFFFF800) == 0xD800) )  return false;
+
+		if( n + 1 + (u >= 0x10000) > TRANSLIT_MAX_RULE )  return false;
+		if( u < 0x10000 )  out[n++] = u;
+		else
+		{
+			out[n++] = 0xD800 + ((u - 0x10000) >> 10);
+			out[n++] = 0xDC00 + ((u - 0x10000) & 0x3FF);
+		}
+	}
+	*pcount = n;
+	return n > 0;
+}
+
+static bool AddRule( RuleList* list, const UTF16* key, uint8_t key_length, const UTF16* value, uint8_t value_length )
+{
+	if( list->count == list->capacity )
+	{
+		size_t capacity = list->capacity * 2 + 64;
+		TranslitRule* rules = realloc(list->rules, capacity * sizeof(TranslitRule));
+		if( rules == NULL )  return false;
+		list->rules = rules;
+		list->capacity = capacity;
+	}
+
+	TranslitRule* r = &list->rules[list->count];
+	memcpy(r->key, key, key_length * sizeof(UTF16));
+	memcpy(r->value, value, value_length * sizeof(UTF16));
+	r->key_length = key_length;
+	r->value_length = value_length;
+	r->seq = list->count++;
+	return true;
+}
+
+static void CopyName( char* dst, size_t size, const char* src, size_t length )
+{
+	if( length >= size )  length = size - 1;
+	memcpy(dst, src, length);
+	dst[length] = 0;
+}
+
+static void SetUpClass( Transliterator* t, const char* name, const char* inverse, const char* description )
+{
+	strcpy(t->name, name);
+	strcpy(t->inverse, inverse);
+	strcpy(t->description, description);
+	t->cls = (TranslatorClass)
+	{
+		.name = t->name,
+		.inverse = t->inverse[0] ? t->inverse : NULL,
+		.description = t->description,
+		.max_output = TranslitMaxOutput,
+		.init = TranslitInit,
+		.feed = TranslitFeed,
+		.feed_run = TranslitFeedRun,
+	};
+}
+
+bool TranslitRegisterRules( const char* text, size_t length, const char* source )
+{
+	char name [TRANSLIT_MAX_NAME] = "", inverse [TRANSLIT_MAX_NAME] = "";
+	char description [TRANSLIT_MAX_DESCRIPTION] = "";
+	RuleList forward = {0}, reverse = {0};
+	bool ok = true;
+
+	const char* end = text + length;
+	unsigned line_number = 0;
+	for( const char* line = text; ok && (line < end); )
+	{
+		const char* eol = memchr(line, '\n', end - line);
+		if( eol == NULL )  eol = end;
+		++line_number;
+
+		// up to 3 tokens, and the rest of the line after the first one (for the description)
+		const char* tokens [3];
+		size_t lengths [3];
+		unsigned ntokens = 0;
+		const char* rest = eol;
+		for( const char* p = line; p < eol; )
+		{
+			while( (p < eol) && ((*p == ' ') || (*p == '\t') || (*p == '\r')) )  ++p;
+			if( p == eol )  break;
+			if( ntokens == 1 )  rest = p;
+			if( ntokens == 3 )
+			{
+				ntokens = 4;
+				break;
+			}
+			const char* q = p;
+			while( (q < eol) && (*q != ' ') && (*q != '\t') && (*q != '\r') )  ++q;
+			tokens[ntokens] = p;
+			lengths[ntokens++] = q - p;
+			p = q;
+		}
+		line = eol + 1;
+
+		if( (ntokens == 0) || (tokens[0][0] == '#') )  continue;
+
+		bool is_rule = (ntokens == 3) && (lengths[1] == 1) && strchr("=<>", tokens[1][0]);
+		if( !is_rule && (lengths[0] == 4) && (memcmp(tokens[0], "name", 4) == 0) && (ntokens <= 3) && (ntokens >= 2) )
+		{
+			CopyName(name, sizeof(name), tokens[1], lengths[1]);
+			if( ntokens == 3 )  CopyName(inverse, sizeof(inverse), tokens[2], lengths[2]);
+			continue;
+		}
+		if( !is_rule && (lengths[0] == 11) && (memcmp(tokens[0], "description", 11) == 0) )
+		{
+			size_t n = eol - rest;
+			while( (n > 0) && ((rest[n - 1] == '\r') || (rest[n - 1] == ' ') || (rest[n - 1] == '\t')) )  --n;
+			CopyName(description, sizeof(description), rest, n);
+			continue;
+		}
+		if( !is_rule )
+		{
+			LOG("%s:%u: neither a rule nor a name or description", source, line_number);
+			ok = false;
+			break;
+		}
+
+		UTF16 left [TRANSLIT_MAX_RULE], right [TRANSLIT_MAX_RULE];
+		uint8_t nleft, nright;
+		if( !DecodeToken(tokens[0], lengths[0], left, &nleft) || !DecodeToken(tokens[2], lengths[2], right, &nright) )
+		{
+			LOG("%s:%u: not UTF-8, or longer than %u units", source, line_number, TRANSLIT_MAX_RULE);
+			ok = false;
+			break;
+		}
+
+		char op = tokens[1][0];
+		if( (op != '<') && !AddRule(&forward, left, nleft, right, nright) )  ok = false;
+		if( (op != '>') && !AddRule(&reverse, right, nright, left, nleft) )  ok = false;
+	}
+
+	if( ok && !name[0] )
+	{
+		LOG("%s: no name", source);
+		ok = false;
+	}
+	if( ok && (TranslatorFind(name, strlen(name)) || (inverse[0] && TranslatorFind(inverse, strlen(inverse)))) )
+	{
+		LOG("%s: there is a translator named %s or %s already", source, name, inverse);
+		ok = false;
+	}
+	if( ok && (TranslatorCount() + 2 > TR_MAX_REGISTERED) )
+	{
+		LOG("%s: too many translators", source);
+		ok = false;
+	}
+
+	Transliterator* tf = ok ? Compile(forward.rules, forward.count) : NULL;
+	Transliterator* tr = (ok && inverse[0]) ? Compile(reverse.rules, reverse.count) : NULL;
+	if( ok && (!tf || (inverse[0] && !tr)) )
+	{
+		LOG("%s: out of memory", source);
+		ok = false;
+	}
+
+	if( ok )
+	{
+		// these stay to the end
+		if( !description[0] )  CopyName(description, sizeof(description), source, strlen(source));
+		SetUpClass(tf, name, inverse, description);
+		TranslatorRegister(&tf->cls);
+		if( tr )
+		{
+			SetUpClass(tr, inverse, name, description);
+			TranslatorRegister(&tr->cls);
+		}
+	}
+	else
+	{
+		free(tf);
+		free(tr);
+	}
+	free(forward.rules);
+	free(reverse.rules);
+	return ok;
+}
@@ -0,0 +1,79 @@
+#ifndef TRANSLIT_H
+#define TRANSLIT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "translate.h"
+
+// Transliteration (e.g. Cyrillic <-> Latin): text translators made from rule files, in
+// which a rule maps a string to another one, both of up to TRANSLIT_MAX_RULE units:
+//
+//   # a comment
+//   name         RU-GOST GOST-RU           the translator and (optionally) its inverse
+//   description  Russian <-> Latin, GOST 7.79-2000 system B
+//   щ = shh                                both ways
+//   ци > ci                                only from left to right
+//   ц < c                                  only from right to left
+//
+// The strings are UTF-8, with no whitespace in them. If there are several rules for the
+// same string, the first one counts.
+//
+// Each direction is compiled into a flat trie, which is walked with the text: the longest
+// string with a rule wins, and the text without rules is copied as is. There is no going
+// back in the text: when the walk can't go on, each node knows what the text it stands for
+// comes to (the replacements of what has rules in it, the rest as is), and which node to
+// go on from with whatever is left of it. So it takes a single pass, one step per unit.
+
+enum
+{
+	TRANSLIT_MAX_RULE = 8,   // units
+	TRANSLIT_MAX_NAME = 24,
+	TRANSLIT_MAX_DESCRIPTION = 80,
+};
+
+typedef struct
+{
+	uint32_t  edges;         // the children are edge_units/edge_nodes [edges, edges + nedges), by unit
+	uint16_t  nedges;
+	uint16_t  fail_length;
+	uint32_t  fail_output;   // in the pool: what the text up to here comes to when the walk
+	uint32_t  fail;          // can't go on, and the node to go on from (0, the root, or deeper)
+} TranslitNode;
+
+typedef struct
+{
+	const TranslitNode*  nodes;
+	const UTF16*         edge_units;
+	const uint32_t*      edge_nodes;
+	const UTF16*         pool;
+	const uint16_t*      root_index;      // the children of the root by unit, for the most common step:
+	const uint32_t*      root_children;   // root_children [root_index [u >> 8] * 256 + (u & 0xFF)]
+	uint32_t             nnodes;
+} TranslitTrie;
+
+typedef struct
+{
+	TranslatorClass  cls;   // first, so that the stages get to the trie through stage->cls
+	TranslitTrie     trie;
+	char             name [TRANSLIT_MAX_NAME];
+	char             inverse [TRANSLIT_MAX_NAME];
+	char             description [TRANSLIT_MAX_DESCRIPTION];
+} Transliterator;
+
+
+// ---- provided by translit.c -------------------------------------------------
+
+// Compiles the rules in `text` (the contents of a rule file; `source` is its name for the
+// messages) and registers the translators; returns false if something is wrong with them.
+bool TranslitRegisterRules( const char* text, size_t length, const char* source );
+
+
+// ---- provided by translit_win.c / translit_posix.c --------------------------
+
+// Registers the translators of all the rule files (*.txt) in the 'translit' folder next
+// to the executable (on POSIX, $KBSW_TRANSLIT if set); returns how many were loaded.
+// Only does anything on the first call.
+unsigned TranslitLoad( void );
+
+#endif
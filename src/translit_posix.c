@@ -0,0 +1,85 @@
+// Loads the transliteration rule files (see translit.h) on POSIX systems.
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <unistd.h>
+#include "translit.h"
+#include "common.h"
+
+enum { MAX_RULE_FILES = 32, MAX_RULE_FILE_SIZE = 1 << 20 };
+
+// $KBSW_TRANSLIT, or the 'translit' folder next to the executable
+static bool GetRulesDir( char* path, size_t size )
+{
+	const char* env = getenv("KBSW_TRANSLIT");
+	if( env && *env )  return snprintf(path, size, "%s", env) < size;
+
+	ssize_t n = readlink("/proc/self/exe", path, size - 1);
+	if( n <= 0 )  return LOG("readlink: %s", strerror(errno)), false;
+	path[n] = 0;
+
+	char* slash = strrchr(path, '/');
+	size_t dir_length = slash ? slash + 1 - path : 0;
+	return snprintf(path + dir_length, size - dir_length, "translit") < size - dir_length;
+}
+
+static bool LoadRuleFile( const char* path, const char* name )
+{
+	FILE* f = fopen(path, "rb");
+	if( f == NULL )  return LOG("%s: %s", path, strerror(errno)), false;
+
+	char* text = malloc(MAX_RULE_FILE_SIZE);
+	size_t length = text ? fread(text, 1, MAX_RULE_FILE_SIZE, f) : 0;
+	bool ok = text && !ferror(f) && feof(f) && TranslitRegisterRules(text, length, name);
+	if( text && !feof(f) )  LOG("%s: too big", path);
+	fclose(f);
+	free(text);
+	return ok;
+}
+
+static int CompareNames( const void* a, const void* b )
+{
+	return strcmp(*(const char* const*)a, *(const char* const*)b);
+}
+
+unsigned TranslitLoad( void )
+{
+	static bool loaded = false;
+	if( loaded )  return 0;
+	loaded = true;
+
+	char dir [4096];
+	if( !GetRulesDir(dir, sizeof(dir)) )  return 0;
+
+	DIR* d = opendir(dir);
+	if( d == NULL )  return LOG("%s: %s", dir, strerror(errno)), 0;
+
+	// in the order of the names, as readdir has none
+	char* names [MAX_RULE_FILES];
+	unsigned nnames = 0;
+	for( struct dirent* e; (e = readdir(d)) && (nnames < MAX_RULE_FILES); )
+	{
+		size_t len = strlen(e->d_name);
+		if( (len <= 4) || (strcmp(e->d_name + len - 4, ".txt") != 0) || (e->d_name[0] == '.') )  continue;
+		names[nnames] = malloc(len + 1);
+		if( names[nnames] )  memcpy(names[nnames++], e->d_name, len + 1);
+	}
+	closedir(d);
+	qsort(names, nnames, sizeof(names[0]), CompareNames);
+
+	unsigned count = 0;
+	for( unsigned i = 0; i < nnames; ++i )
+	{
+		char path [4096 + 256];
+		snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+		count += LoadRuleFile(path, names[i]);
+		free(names[i]);
+	}
+	return count;
+}
@@ -0,0 +1,77 @@
+// Loads the transliteration rule files (see translit.h) on Windows.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <windows.h>
+#include "translit.h"
+#include "common.h"
+
+enum { MAX_RULE_FILE_SIZE = 1 << 20 };
+
+// the 'translit' folder next to the executable, with a '\' at the end
+static bool GetRulesDir( WCHAR* path, DWORD size, DWORD* plength )
+{
+	DWORD n = GetModuleFileNameW(NULL, path, size);
+	if( (n == 0) || (n >= size) )  return ERR("GetModuleFileName"), false;
+
+	WCHAR* name = wcsrchr(path, L'\\');
+	name = name ? name + 1 : path;
+	static const WCHAR kDirName [] = L"translit\\";
+	if( name - path + COUNTOF(kDirName) + MAX_PATH > size )  return LOG("path too long"), false;
+	wcscpy(name, kDirName);
+	*plength = name - path + COUNTOF(kDirName) - 1;
+	return true;
+}
+
+static bool LoadRuleFile( const WCHAR* path, const WCHAR* name )
+{
+	HANDLE file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if( file == INVALID_HANDLE_VALUE )  return ERR("CreateFile"), false;
+
+	char* text = NULL;
+	DWORD length = 0;
+	LARGE_INTEGER size;
+	if( GetFileSizeEx(file, &size) && (size.QuadPart < MAX_RULE_FILE_SIZE) )
+		text = malloc(size.QuadPart ? size.QuadPart : 1);
+	bool ok = text && ReadFile(file, text, (DWORD)size.QuadPart, &length, NULL);
+	if( !ok )  ERR("GetFileSizeEx/ReadFile");
+	CloseHandle(file);
+
+	char source [MAX_PATH * 3];
+	if( ok && !WideCharToMultiByte(CP_UTF8, 0, name, -1, source, sizeof(source), NULL, NULL) )
+		ok = false;
+	ok = ok && TranslitRegisterRules(text, length, source);
+	free(text);
+	return ok;
+}
+
+unsigned TranslitLoad( void )
+{
+	static bool loaded = false;
+	if( loaded )  return 0;
+	loaded = true;
+
+	WCHAR path [MAX_PATH * 2];
+	DWORD dir_length;
+	if( !GetRulesDir(path, COUNTOF(path), &dir_length) )  return 0;
+
+	wcscpy(path + dir_length, L"*.txt");
+	WIN32_FIND_DATAW fd;
+	HANDLE find = FindFirstFileW(path, &fd);
+	if( find == INVALID_HANDLE_VALUE )  return 0;   // no rule files
+
+	// (NTFS lists the files in the order of their names)
+	unsigned count = 0;
+	do
+	{
+		if( fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY )  continue;
+		if( dir_length + wcslen(fd.cFileName) >= COUNTOF(path) )  continue;
+		wcscpy(path + dir_length, fd.cFileName);
+		count += LoadRuleFile(path, fd.cFileName);
+	}
+	while( FindNextFileW(find, &fd) );
+
+	FindClose(find);
+	return count;
+}
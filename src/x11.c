@@ -0,0 +1,1104 @@
+// kbsw on an X11 display (see x11.h).
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+#include <X11/Xlib.h>
+#include <X11/Xatom.h>
+#include <X11/XKBlib.h>
+#include <X11/keysym.h>
+#include <X11/extensions/Xfixes.h>
+#include "x11.h"
+#include "common.h"
+
+typedef struct { uint16_t keysym, ucs; } KeysymRecord;
+
+#include "keysymtab.h"
+
+enum
+{
+	atPrimary,
+	atClipboard,
+	atTargets,
+	atUtf8String,
+	atText,
+	atIncr,
+	atTimestamp,       // changed to learn the time of the server
+	atPropPrimary,     // where the selections read come
+	atPropClipboard,
+	ATOMS
+};
+
+static const char* const kAtomNames [ATOMS] =
+{
+	"PRIMARY", "CLIPBOARD", "TARGETS", "UTF8_STRING", "TEXT", "INCR", "KBSW_TIME", "KBSW_PRIMARY", "KBSW_CLIPBOARD",
+};
+
+enum { ARENA_KEEP = 256 * 1024 };
+
+static uint64_t Now_us( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static uint32_t Now_ms( void )
+{
+	return (uint32_t)(Now_us() / 1000);
+}
+
+static int OnXError( Display* display, XErrorEvent* e )
+{
+	// a requestor gone in the middle of a transfer, and such: nothing to exit for
+	LOG("X error %u, request %u.%u", e->error_code, e->request_code, e->minor_code);
+	return 0;
+}
+
+// ---- the keysyms ------------------------------------------------------------
+
+static int CompareKeysymRecords( const void* key, const void* record )
+{
+	uint16_t ks = *(const uint16_t*)key, other = ((const KeysymRecord*)record)->keysym;
+	return (ks > other) - (ks < other);
+}
+
+// the character of a keysym, if it is one in the BMP; 0 if not
+static uint16_t KeysymToChar( KeySym ks )
+{
+	if( ((ks >= 0x20) && (ks < 0x7F)) || ((ks >= 0xA0) && (ks < 0x100)) )  return (uint16_t)ks;   // Latin-1
+	if( (ks & 0xFF000000) == 0x01000000 )  return ((ks & 0xFFFFFF) < 0x10000) ? (uint16_t)ks : 0;   // Unicode
+	if( ks >= 0x10000 )  return 0;
+
+	uint16_t key = (uint16_t)ks;
+	const KeysymRecord* r = bsearch(&key, kKeysyms, COUNTOF(kKeysyms), sizeof(kKeysyms[0]), CompareKeysymRecords);
+	return r ? r->ucs : 0;
+}
+
+// ---- the groups -------------------------------------------------------------
+
+// "pc+us+ru:2+inet(evdev)": the first layout is group 1, the others say which they are
+static void ParseSymbols( X11* x, const char* symbols )
+{
+	bool first = true;
+	for( const char* p = symbols; p && *p; )
+	{
+		size_t length = strcspn(p, "+");
+		const char* colon = memchr(p, ':', length);
+		bool pc = (strncmp(p, "pc", 2) == 0) && ((length == 2) || (p[2] == '('));
+		unsigned group = colon ? (unsigned)atoi(colon + 1) : (first && !pc) ? 1 : 0;
+		if( (group >= 1) && (group <= X11_MAX_GROUPS) )
+		{
+			size_t id_length = (colon ? (size_t)(colon - p) : length);
+			if( id_length >= LAYOUT_ID_SIZE )  id_length = LAYOUT_ID_SIZE - 1;
+			memcpy(x->ids[group - 1], p, id_length);
+			x->ids[group - 1][id_length] = 0;
+		}
+		first &= pc;
+		p += length;
+		p += (*p == '+');
+	}
+}
+
+static int CompareKeys( const void* a, const void* b )
+{
+	uint32_t ka = *(const uint32_t*)a, kb = *(const uint32_t*)b;
+	return (ka > kb) - (ka < kb);
+}
+
+// the keys by the char they type, the lowest keycode and level first
+static void IndexKeys( X11* x )
+{
+	for( unsigned g = 0; g < X11_MAX_GROUPS; ++g )
+	{
+		unsigned n = 0;
+		for( unsigned kc = 0; kc < 256; ++kc )
+		{
+			for( unsigned level = 0; level < X11_LEVELS; ++level )
+			{
+				if( x->chars[g][kc][level] )  x->keys[g][n++] = (uint32_t)x->chars[g][kc][level] << 16 | (kc * X11_LEVELS + level);
+			}
+		}
+		qsort(x->keys[g], n, sizeof(x->keys[g][0]), CompareKeys);
+		x->nkeys[g] = n;
+	}
+}
+
+static bool LoadKeymap( X11* x )
+{
+	XkbDescPtr xkb = XkbGetMap(x->display, XkbKeyTypesMask | XkbKeySymsMask, XkbUseCoreKbd);
+	if( xkb == NULL )  return LOG("XkbGetMap failed"), false;
+	XkbGetControls(x->display, XkbAllControlsMask, xkb);
+	XkbGetNames(x->display, XkbGroupNamesMask | XkbSymbolsNameMask, xkb);
+
+	x->ngroups = xkb->ctrls ? xkb->ctrls->num_groups : 1;
+	if( x->ngroups < 1 )  x->ngroups = 1;
+	if( x->ngroups > X11_MAX_GROUPS )  x->ngroups = X11_MAX_GROUPS;
+
+	memset(x->chars, 0, sizeof(x->chars));
+	for( unsigned kc = xkb->min_key_code; (kc <= xkb->max_key_code) && (kc < 256); ++kc )
+	{
+		unsigned key_groups = XkbKeyNumGroups(xkb, kc);
+		for( unsigned g = 0; (g < x->ngroups) && key_groups; ++g )
+		{
+			// a key with fewer groups (digits, space) has the same in the others
+			unsigned kg = (g < key_groups) ? g : g % key_groups;
+			unsigned width = XkbKeyGroupWidth(xkb, kc, kg);
+			for( unsigned level = 0; (level < width) && (level < X11_LEVELS); ++level )
+				x->chars[g][kc][level] = KeysymToChar(XkbKeySymEntry(xkb, kc, level, kg));
+		}
+	}
+
+	IndexKeys(x);
+
+	memset(x->ids, 0, sizeof(x->ids));
+	if( xkb->names && xkb->names->symbols )
+	{
+		char* symbols = XGetAtomName(x->display, xkb->names->symbols);
+		if( symbols )  ParseSymbols(x, symbols);
+		XFree(symbols);
+	}
+	for( unsigned g = 0; g < x->ngroups; ++g )
+	{
+		Atom atom = xkb->names ? xkb->names->groups[g] : None;
+		char* name = atom ? XGetAtomName(x->display, atom) : NULL;
+		snprintf(x->names[g], sizeof(x->names[g]), "%s", name ? name : "?");
+		XFree(name);
+		if( x->ids[g][0] == 0 )  snprintf(x->ids[g], sizeof(x->ids[g]), "group%u", g + 1);
+	}
+	XkbFreeKeyboard(xkb, 0, True);
+
+	XkbStateRec state;
+	if( XkbGetState(x->display, XkbUseCoreKbd, &state) == Success )  x->group = state.locked_group;
+	LOG("%u group(s), %u locked", x->ngroups, x->group);
+	LayoutRegistryInvalidate(&x->layouts);
+	return true;
+}
+
+static size_t EnumerateGroups( void* ctx, LayoutHandle* handles, size_t max )
+{
+	const X11* x = ctx;
+	if( max == 0 )  return x->ngroups;
+	size_t n = 0;
+	for( ; (n < x->ngroups) && (n < max); ++n )  handles[n] = n;
+	return n;
+}
+
+static bool GetGroupId( void* ctx, LayoutHandle handle, char id [LAYOUT_ID_SIZE] )
+{
+	const X11* x = ctx;
+	if( handle >= x->ngroups )  return false;
+	memcpy(id, x->ids[handle], LAYOUT_ID_SIZE);
+	return true;
+}
+
+static bool GetGroupName( void* ctx, const char* id, char* name, size_t name_size )
+{
+	const X11* x = ctx;
+	for( unsigned g = 0; g < x->ngroups; ++g )
+	{
+		if( strcmp(x->ids[g], id) == 0 )  return snprintf(name, name_size, "%s", x->names[g]), true;
+	}
+	return false;
+}
+
+LayoutRegistry* X11Layouts( X11* x )
+{
+	return &x->layouts;
+}
+
+bool X11LockGroup( X11* x, unsigned group )
+{
+	if( group >= x->ngroups )  return LOG("no group %u", group), false;
+	if( (group == x->group) && (x->requested < 0) )
+	{
+		++x->stats.switches_skipped;
+		return true;
+	}
+
+	x->requested = group;
+	x->requested_us = Now_us();
+	if( !XkbLockGroup(x->display, XkbUseCoreKbd, group) )  return LOG("XkbLockGroup failed"), false;
+	XFlush(x->display);
+	++x->stats.switches;
+	return true;
+}
+
+static void OnXkbEvent( X11* x, const XkbEvent* e )
+{
+	switch( e->any.xkb_type )
+	{
+		case XkbStateNotify:
+			if( !(e->state.changed & XkbGroupLockMask) )  break;
+			x->group = e->state.locked_group;
+			if( x->requested == (int)x->group )
+			{
+				x->stats.last_switch_us = (uint32_t)(Now_us() - x->requested_us);
+				x->requested = -1;
+			}
+			if( x->host.group_changed )  x->host.group_changed(x->host.ctx, x->group);
+			break;
+
+		case XkbNewKeyboardNotify:
+		case XkbMapNotify:
+		case XkbNamesNotify:
+		case XkbControlsNotify:
+			LoadKeymap(x);
+			break;
+	}
+}
+
+// ---- the layout translator: the chars as they would be typed in another group ----
+
+typedef struct { const X11* x; unsigned source, target; } GroupParams;
+
+static size_t GroupMaxOutput( size_t n )
+{
+	return n;
+}
+
+static void GroupInit( void* state, const void* params )
+{
+	*(GroupParams*)state = *(const GroupParams*)params;
+}
+
+// the key (keycode * X11_LEVELS + level) that types `unit` in `group`, or 0
+static unsigned FindKey( const X11* x, unsigned group, UTF16 unit )
+{
+	const uint32_t* keys = x->keys[group];
+	size_t lo = 0, hi = x->nkeys[group];
+	while( lo < hi )
+	{
+		size_t mid = (lo + hi) / 2;
+		if( (keys[mid] >> 16) < unit )  lo = mid + 1;
+		else hi = mid;
+	}
+	return ((lo < x->nkeys[group]) && ((keys[lo] >> 16) == unit)) ? keys[lo] & 0xFFFF : 0;
+}
+
+static void GroupFeed( TrStage* stage, UTF16 unit )
+{
+	if( unit == 0 )  return;
+
+	const GroupParams* gp = TR_STATE(stage, GroupParams);
+	unsigned key = FindKey(gp->x, gp->source, unit);
+	UTF16 typed = key ? gp->x->chars[gp->target][key / X11_LEVELS][key % X11_LEVELS] : 0;
+	TrEmit(stage, typed ? typed : unit);
+}
+
+static const TranslatorClass kGroupTranslator =
+{
+	.name = "GROUP",  // not registered: the groups are bound by their number
+	.description = "retype in another XKB group",
+	.max_output = GroupMaxOutput,
+	.init = GroupInit,
+	.feed = GroupFeed,
+};
+
+// the group most likely `text` was typed in, preferring `preferred` (see DetectStringLayout)
+static int DetectGroup( const X11* x, const UTF16* text, size_t length, unsigned preferred )
+{
+	int best = -1;
+	size_t best_score = 0;
+	for( unsigned g = 0; g < x->ngroups; ++g )
+	{
+		size_t score = 0;
+		for( size_t i = 0; i < length; ++i )  score += (FindKey(x, g, text[i]) != 0);
+		if( (score > best_score) || ((score == best_score) && score && (g == preferred)) )
+		{
+			best_score = score;
+			best = g;
+		}
+	}
+	LOG("group %d (score %zu/%zu)", best, best_score, length);
+	return best_score ? best : -1;
+}
+
+// ---- the selections ---------------------------------------------------------
+
+static Bool IsTimestamp( Display* display, XEvent* ev, XPointer arg )
+{
+	const X11* x = (const X11*)arg;
+	return (ev->type == PropertyNotify) && (ev->xproperty.window == x->window) && (ev->xproperty.atom == x->atoms[atTimestamp]);
+}
+
+// the time of the server, by appending nothing to a property of ours (ICCCM 2.1): the selections
+// are owned and asked for as of the time of what made us do it, and nothing here comes from X
+static Time ServerTime( X11* x )
+{
+	XChangeProperty(x->display, x->window, x->atoms[atTimestamp], XA_STRING, 8, PropModeAppend, NULL, 0);
+	XEvent ev;
+	XIfEvent(x->display, &ev, IsTimestamp, (XPointer)x);
+	return ev.xproperty.time;
+}
+
+static int SelectionIndex( const X11* x, Atom selection )
+{
+	return (selection == x->atoms[atPrimary]) ? x11Primary
+	     : (selection == x->atoms[atClipboard]) ? x11Clipboard : -1;
+}
+
+static void FreeTransfer( X11* x, X11Transfer* t )
+{
+	Window requestor = t->requestor;
+	t->requestor = None;
+	for( unsigned i = 0; i < X11_MAX_TRANSFERS; ++i )
+	{
+		if( x->transfers[i].requestor == requestor )  return;   // it is still being served
+	}
+	XSelectInput(x->display, requestor, NoEventMask);
+}
+
+// the end of an INCR transfer: the empty piece
+static void EndTransfer( X11* x, X11Transfer* t )
+{
+	XChangeProperty(x->display, t->requestor, t->property, x->atoms[atUtf8String], 8, PropModeReplace, NULL, 0);
+	FreeTransfer(x, t);
+}
+
+// a requestor that will take no more pieces: its slot is free for others
+static void AbandonTransfer( X11* x, X11Transfer* t, bool destroyed )
+{
+	LOG("transfer to 0x%lx abandoned: %s", t->requestor, destroyed ? "destroyed" : "timed out");
+	++x->stats.transfers_abandoned;
+	if( destroyed )  t->requestor = None;   // its event mask has gone with it
+	else FreeTransfer(x, t);
+}
+
+static void Disown( X11* x, unsigned which )
+{
+	// whatever is still being served goes short
+	for( unsigned i = 0; i < X11_MAX_TRANSFERS; ++i )
+	{
+		X11Transfer* t = &x->transfers[i];
+		if( (t->requestor != None) && (t->selection == which) )  EndTransfer(x, t);
+	}
+	free(x->owned[which]);
+	x->owned[which] = NULL;
+	x->owned_length[which] = 0;
+}
+
+bool X11OwnSelection( X11* x, X11Selection which, const char* utf8, size_t length )
+{
+	char* copy = malloc(length + 1);
+	if( copy == NULL )  return LOG("out of memory"), false;
+	memcpy(copy, utf8, length);
+	copy[length] = 0;
+
+	Disown(x, which);
+	x->owned[which] = copy;
+	x->owned_length[which] = length;
+
+	Atom selection = x->atoms[which == x11Primary ? atPrimary : atClipboard];
+	x->owned_time[which] = ServerTime(x);
+	XSetSelectionOwner(x->display, selection, x->window, x->owned_time[which]);
+	if( XGetSelectionOwner(x->display, selection) != x->window )
+	{
+		Disown(x, which);
+		return LOG("could not own the selection"), false;
+	}
+	return true;
+}
+
+static bool StartTransfer( X11* x, unsigned which, Window requestor, Atom property )
+{
+	for( unsigned i = 0; i < X11_MAX_TRANSFERS; ++i )
+	{
+		X11Transfer* t = &x->transfers[i];
+		if( t->requestor != None )  continue;
+
+		*t = (X11Transfer){ .requestor = requestor, .property = property, .selection = which, .last_ms = Now_ms() };
+		// the requestor deleting the property asks for the next piece; one that dies frees the slot
+		XSelectInput(x->display, requestor, PropertyChangeMask | StructureNotifyMask);
+		long size = (long)x->owned_length[which];
+		XChangeProperty(x->display, requestor, property, x->atoms[atIncr], 32, PropModeReplace,
+		                (const unsigned char*)&size, 1);
+		++x->stats.incr_served;
+		return true;
+	}
+	return LOG("too many transfers"), false;
+}
+
+static void OnSelectionRequest( X11* x, const XSelectionRequestEvent* req )
+{
+	XSelectionEvent reply =
+	{
+		.type = SelectionNotify,
+		.display = x->display,
+		.requestor = req->requestor,
+		.selection = req->selection,
+		.target = req->target,
+		.property = None,
+		.time = req->time,
+	};
+	// obsolete clients give no property: the target then
+	Atom property = (req->property != None) ? req->property : req->target;
+	int which = SelectionIndex(x, req->selection);
+	// a request from before we owned it is for the previous owner (the times wrap)
+	bool stale = (which >= 0) && (req->time != CurrentTime) && ((int32_t)(req->time - x->owned_time[which]) < 0);
+
+	if( (which >= 0) && x->owned[which] && !stale )
+	{
+		if( req->target == x->atoms[atTargets] )
+		{
+			const Atom targets [] = { x->atoms[atTargets], x->atoms[atUtf8String], x->atoms[atText] };
+			XChangeProperty(x->display, req->requestor, property, XA_ATOM, 32, PropModeReplace,
+			                (const unsigned char*)targets, COUNTOF(targets));
+			reply.property = property;
+		}
+		else if( (req->target == x->atoms[atUtf8String]) || (req->target == x->atoms[atText]) )
+		{
+			if( x->owned_length[which] <= x->max_piece )
+			{
+				XChangeProperty(x->display, req->requestor, property, x->atoms[atUtf8String], 8, PropModeReplace,
+				                (const unsigned char*)x->owned[which], (int)x->owned_length[which]);
+				reply.property = property;
+			}
+			else if( StartTransfer(x, which, req->requestor, property) )
+			{
+				reply.property = property;
+			}
+		}
+	}
+	XSendEvent(x->display, req->requestor, False, NoEventMask, (XEvent*)&reply);
+}
+
+// the requestor has taken a piece (deleted the property): the next one
+static void OnTransferProperty( X11* x, const XPropertyEvent* e )
+{
+	for( unsigned i = 0; i < X11_MAX_TRANSFERS; ++i )
+	{
+		X11Transfer* t = &x->transfers[i];
+		if( (t->requestor != e->window) || (t->property != e->atom) )  continue;
+
+		t->last_ms = Now_ms();
+		size_t length = x->owned_length[t->selection];
+		size_t piece = (t->offset < length) ? length - t->offset : 0;
+		if( piece > x->max_piece )  piece = x->max_piece;
+		if( piece == 0 )
+		{
+			EndTransfer(x, t);
+			return;
+		}
+		XChangeProperty(x->display, t->requestor, t->property, x->atoms[atUtf8String], 8, PropModeReplace,
+		                (const unsigned char*)x->owned[t->selection] + t->offset, (int)piece);
+		t->offset += piece;
+		return;
+	}
+}
+
+static void OnTextRead( X11* x, unsigned which, const char* text, size_t length );
+static void Rearm( X11* x );
+
+static void FinishReading( X11* x, unsigned which, bool ok )
+{
+	X11Reading* r = &x->reading[which];
+	r->busy = false;
+	if( ok && (r->data == NULL) )  ok = false;   // an empty selection
+	OnTextRead(x, which, ok ? r->data : NULL, ok ? r->length : 0);
+	free(r->data);
+	r->data = NULL;
+	r->length = r->size = 0;
+}
+
+static bool Append( X11Reading* r, const unsigned char* data, size_t n )
+{
+	if( r->length + n + 1 > r->size )
+	{
+		size_t size = (r->size ? r->size * 2 : 4096);
+		while( size < r->length + n + 1 )  size *= 2;
+		char* grown = realloc(r->data, size);
+		if( grown == NULL )  return false;
+		r->data = grown;
+		r->size = size;
+	}
+	memcpy(r->data + r->length, data, n);
+	r->length += n;
+	r->data[r->length] = 0;
+	return true;
+}
+
+// takes (and deletes) what there is in the property of `which`; false if it's the last
+static bool TakePiece( X11* x, unsigned which )
+{
+	X11Reading* r = &x->reading[which];
+	Atom type;
+	int format;
+	unsigned long nitems, after;
+	unsigned char* data = NULL;
+	Atom property = x->atoms[which == x11Primary ? atPropPrimary : atPropClipboard];
+	r->last_ms = Now_ms();
+	if( (XGetWindowProperty(x->display, x->window, property, 0, 0x1FFFFFFF, True, AnyPropertyType,
+	                        &type, &format, &nitems, &after, &data) != Success) )
+	{
+		FinishReading(x, which, false);
+		return false;
+	}
+
+	if( type == x->atoms[atIncr] )
+	{
+		// the pieces follow, each one after we have deleted the previous one
+		r->incr = true;
+		++x->stats.incr_read;
+		XFree(data);
+		return true;
+	}
+
+	size_t n = nitems * (format / 8);
+	bool ok = (type != None) && ((n == 0) || Append(r, data, n));
+	XFree(data);
+	if( !ok || !r->incr || (n == 0) )
+	{
+		FinishReading(x, which, ok);
+		return false;
+	}
+	return true;
+}
+
+static void OnSelectionNotify( X11* x, const XSelectionEvent* e )
+{
+	int which = SelectionIndex(x, e->selection);
+	// the answer to a read given up, come late, is not that of this one
+	if( (which < 0) || !x->reading[which].busy || (e->time != x->reading[which].time) )  return;
+	if( e->property == None )  return FinishReading(x, which, false);
+	TakePiece(x, which);
+}
+
+static void AbandonReading( X11* x, unsigned which, const char* why )
+{
+	LOG("reading of selection %u abandoned: %s", which, why);
+	++x->stats.reads_abandoned;
+	FinishReading(x, which, false);
+}
+
+static bool StartReading( X11* x, X11Selection which, bool for_translation )
+{
+	X11Reading* r = &x->reading[which];
+	if( r->busy )  return LOG("reading already"), false;
+
+	*r = (X11Reading){ .busy = true, .for_translation = for_translation, .time = ServerTime(x), .last_ms = Now_ms() };
+	Atom selection = x->atoms[which == x11Primary ? atPrimary : atClipboard];
+	Atom property = x->atoms[which == x11Primary ? atPropPrimary : atPropClipboard];
+	XDeleteProperty(x->display, x->window, property);
+	XConvertSelection(x->display, selection, x->atoms[atUtf8String], property, x->window, r->time);
+	XFlush(x->display);
+	Rearm(x);   // for its timeout: an owner that never answers sends no event to wake us
+	return true;
+}
+
+bool X11ReadSelection( X11* x, X11Selection which )
+{
+	return StartReading(x, which, false);
+}
+
+static void OnPropertyNotify( X11* x, const XPropertyEvent* e )
+{
+	if( e->window != x->window )
+	{
+		if( e->state == PropertyDelete )  OnTransferProperty(x, e);
+		return;
+	}
+	for( unsigned which = 0; which < X11_SELECTIONS; ++which )
+	{
+		Atom property = x->atoms[which == x11Primary ? atPropPrimary : atPropClipboard];
+		X11Reading* r = &x->reading[which];
+		if( (e->atom == property) && (e->state == PropertyNewValue) && r->busy && r->incr )
+			TakePiece(x, which);
+	}
+}
+
+// ---- the keys ---------------------------------------------------------------
+
+typedef int (*FakeKeyEvent)( Display* display, unsigned keycode, Bool is_press, unsigned long delay );
+
+// XTest, if both the server and the client library have it
+static FakeKeyEvent LoadXTest( Display* display )
+{
+	static bool loaded = false;
+	static FakeKeyEvent fake = NULL;
+	if( !loaded )
+	{
+		loaded = true;
+		void* lib = dlopen("libXtst.so.6", RTLD_NOW | RTLD_LOCAL);
+		if( lib )  *(void**)&fake = dlsym(lib, "XTestFakeKeyEvent");
+	}
+	int opcode, event, error;
+	return (fake && XQueryExtension(display, "XTEST", &opcode, &event, &error)) ? fake : NULL;
+}
+
+static bool SendChord( X11* x, KeySym modifier, KeySym key )
+{
+	Display* d = x->display;
+	KeyCode kmod = XKeysymToKeycode(d, modifier), kkey = XKeysymToKeycode(d, key);
+	if( (kmod == 0) || (kkey == 0) )  return LOG("no keycode"), false;
+
+	FakeKeyEvent fake = LoadXTest(d);
+	if( fake )
+	{
+		fake(d, kmod, True, CurrentTime);
+		fake(d, kkey, True, CurrentTime);
+		fake(d, kkey, False, CurrentTime);
+		fake(d, kmod, False, CurrentTime);
+		XFlush(d);
+		return true;
+	}
+
+	// a synthetic event, which some clients ignore
+	if( x->target == None )  return false;
+	XKeyEvent ke =
+	{
+		.type = KeyPress,
+		.display = d,
+		.window = x->target,
+		.root = DefaultRootWindow(d),
+		.subwindow = None,
+		.time = CurrentTime,
+		.same_screen = True,
+		.keycode = kkey,
+		.state = ControlMask,
+	};
+	XSendEvent(d, x->target, True, KeyPressMask, (XEvent*)&ke);
+	ke.type = KeyRelease;
+	XSendEvent(d, x->target, True, KeyReleaseMask, (XEvent*)&ke);
+	XFlush(d);
+	return true;
+}
+
+// ---- the translation --------------------------------------------------------
+
+static UTF16* Utf8ToUtf16( Arena* a, const char* utf8, size_t length, size_t* pn )
+{
+	UTF16* out = ArenaAlloc(a, (length + 1) * sizeof(UTF16));
+	if( out == NULL )  return NULL;
+	const unsigned char* p = (const unsigned char*)utf8;
+	const unsigned char* end = p + length;
+	size_t n = 0;
+	while( p < end )
+	{
+		unsigned len = (*p < 0x80) ? 1 : ((*p & 0xE0) == 0xC0) ? 2 : ((*p & 0xF0) == 0xE0) ? 3
+		             : ((*p & 0xF8) == 0xF0) ? 4 : 0;
+		uint32_t u = (len == 1) ? *p : (len ? (*p & (0x7F >> len)) : 0xFFFD);
+		unsigned k = 1;
+		for( ; (k < len) && (p + k < end) && ((p[k] & 0xC0) == 0x80); ++k )  u = (u << 6) | (p[k] & 0x3F);
+		if( (len == 0) || (k < len) )  u = 0xFFFD, k = (len ? k : 1);
+		p += k;
+		if( u >= 0x10000 )
+		{
+			out[n++] = 0xD800 + ((u - 0x10000) >> 10);
+			out[n++] = 0xDC00 + ((u - 0x10000) & 0x3FF);
+		}
+		else out[n++] = (UTF16)u;
+	}
+	out[n] = 0;
+	*pn = n;
+	return out;
+}
+
+static char* Utf16ToUtf8( Arena* a, const UTF16* text, size_t n, size_t* plength )
+{
+	char* out = ArenaAlloc(a, n * 3 + 1);
+	if( out == NULL )  return NULL;
+	size_t length = 0;
+	for( size_t i = 0; i < n; ++i )
+	{
+		uint32_t u = text[i];
+		if( (u >= 0xD800) && (u < 0xDC00) && (i + 1 < n) && (text[i + 1] >= 0xDC00) && (text[i + 1] < 0xE000) )
+			u = 0x10000 + ((u - 0xD800) << 10) + (text[++i] - 0xDC00);
+		if( u < 0x80 )  out[length++] = u;
+		else if( u < 0x800 )
+		{
+			out[length++] = 0xC0 | (u >> 6);
+			out[length++] = 0x80 | (u & 0x3F);
+		}
+		else if( u < 0x10000 )
+		{
+			out[length++] = 0xE0 | (u >> 12);
+			out[length++] = 0x80 | ((u >> 6) & 0x3F);
+			out[length++] = 0x80 | (u & 0x3F);
+		}
+		else
+		{
+			out[length++] = 0xF0 | (u >> 18);
+			out[length++] = 0x80 | ((u >> 12) & 0x3F);
+			out[length++] = 0x80 | ((u >> 6) & 0x3F);
+			out[length++] = 0x80 | (u & 0x3F);
+		}
+	}
+	out[length] = 0;
+	*plength = length;
+	return out;
+}
+
+// the selection read into the CLIPBOARD, translated; it is pasted after the delay
+static PipeOutput TranslateText( X11* x )
+{
+	const X11Translation* t = &x->translation;
+	size_t n;
+	UTF16* text = x->text ? Utf8ToUtf16(&x->arena, x->text, x->text_length, &n) : NULL;
+	if( text == NULL )  return poFailed;
+
+	TrPipeline pipeline;
+	bool ok;
+	if( t->group >= 0 )
+	{
+		int source = DetectGroup(x, text, n, t->group);
+		if( (source < 0) || (source == t->group) )  return LOG("noop"), poFailed;
+		const GroupParams gp = { .x = x, .source = source, .target = t->group };
+		const TranslatorClass* const classes [] = { &kGroupTranslator };
+		const void* const params [] = { &gp };
+		ok = TrPipelineInit(&pipeline, classes, params, 1);
+	}
+	else ok = TrPipelineInit(&pipeline, t->translators, NULL, t->ntranslators);
+	if( !ok )  return LOG("bad translator chain"), poFailed;
+
+	size_t size = TrPipelineMaxOutput(&pipeline, n);
+	UTF16* output = (size < SIZE_MAX / sizeof(UTF16) - 1) ? ArenaAlloc(&x->arena, (size + 1) * sizeof(UTF16)) : NULL;
+	if( output == NULL )  return LOG("out of memory"), poFailed;
+	TrBuffer out = { .data = output, .size = size };
+	if( !TrPipelineRun(&pipeline, text, n, &out) )  LOG("output truncated");
+
+	size_t length;
+	const char* utf8 = Utf16ToUtf8(&x->arena, out.data, out.length, &length);
+	if( (utf8 == NULL) || !X11OwnSelection(x, x11Clipboard, utf8, length) )  return poFailed;
+
+	++x->stats.translations;
+	x->stats.last_translation_us = (uint32_t)(Now_us() - x->started_us);
+	return poPaste;
+}
+
+static void OnTextRead( X11* x, unsigned which, const char* text, size_t length )
+{
+	if( !x->reading[which].for_translation )
+	{
+		if( x->host.selection_read )  x->host.selection_read(x->host.ctx, which, text, length);
+		return;
+	}
+	if( (text == NULL) || !PipelineIsBusy(&x->pipeline) )  return;
+
+	char* copy = ArenaAlloc(&x->arena, length + 1);
+	if( copy == NULL )  return;
+	memcpy(copy, text, length + 1);
+	x->text = copy;
+	x->text_length = length;
+	PipelineOnClipboardUpdate(&x->pipeline);
+}
+
+// another client has taken a selection
+static void OnSelectionOwner( X11* x, const XFixesSelectionNotifyEvent* e )
+{
+	int which = SelectionIndex(x, e->selection);
+	if( (which < 0) || (e->owner == x->window) )  return;
+	if( x->owned[which] )  Disown(x, which);
+
+	// the keyboard copy has come
+	if( (which == x11Clipboard) && (x->pipeline.state == psWaitingForKeyboardCopy) )
+		StartReading(x, x11Clipboard, true);
+}
+
+// ---- the pipeline host (see pipeline.h) ----
+
+static uint32_t HostNow( void* _ )
+{
+	return Now_ms();
+}
+
+static bool HostStartTimer( void* ctx )
+{
+	// armed for each timeout in turn, after the pipeline has moved on (see Rearm)
+	((X11*)ctx)->timer_on = true;
+	return true;
+}
+
+static void HostStopTimer( void* ctx )
+{
+	((X11*)ctx)->timer_on = false;
+}
+
+static SpecialHandling HostSpecialHandling( void* _, PipeWindow target )
+{
+	return shNoSpecialHandling;
+}
+
+static void HostPostCopy( void* ctx, PipeWindow target )
+{
+	// the PRIMARY selection is there already, with no copying
+	X11* x = ctx;
+	x->target = (Window)target;
+	StartReading(x, x11Primary, true);
+}
+
+static bool HostSendCopyKeys( void* ctx, SpecialHandling sh )
+{
+	return SendChord(ctx, XK_Control_L, XK_c);
+}
+
+static bool HostSendPasteKeys( void* ctx, SpecialHandling sh )
+{
+	return SendChord(ctx, XK_Control_L, XK_v);
+}
+
+static PipeOutput HostTranslateClipboard( void* ctx, PipeLayout translation, SpecialHandling sh )
+{
+	return TranslateText(ctx);
+}
+
+static void HostIdle( void* ctx, bool pasted )
+{
+	X11* x = ctx;
+	// a selection still on its way is of no use any more
+	for( unsigned which = 0; which < X11_SELECTIONS; ++which )
+	{
+		if( x->reading[which].busy && x->reading[which].for_translation )  AbandonReading(x, which, "the translation has ended");
+	}
+	x->text = NULL;
+	ArenaTrim(&x->arena);
+	if( x->host.idle )  x->host.idle(x->host.ctx, pasted);
+}
+
+static uint32_t Left_ms( uint32_t now_ms, uint32_t since_ms, uint32_t timeout_ms )
+{
+	uint32_t elapsed_ms = now_ms - since_ms;
+	return (elapsed_ms < timeout_ms) ? timeout_ms - elapsed_ms : 0;
+}
+
+// the reads whose owner, and the transfers whose requestor, have gone quiet for too long
+static void Expire( X11* x )
+{
+	uint32_t now_ms = Now_ms();
+	for( unsigned which = 0; which < X11_SELECTIONS; ++which )
+	{
+		const X11Reading* r = &x->reading[which];
+		if( r->busy && (Left_ms(now_ms, r->last_ms, X11_READ_TIMEOUT_ms) == 0) )  AbandonReading(x, which, "timed out");
+	}
+	for( unsigned i = 0; i < X11_MAX_TRANSFERS; ++i )
+	{
+		X11Transfer* t = &x->transfers[i];
+		if( (t->requestor != None) && (Left_ms(now_ms, t->last_ms, X11_TRANSFER_TIMEOUT_ms) == 0) )  AbandonTransfer(x, t, false);
+	}
+}
+
+// the timer for the next timeout of the pipeline, a read or a transfer, if any waits for one
+static void Rearm( X11* x )
+{
+	uint32_t left_ms = x->timer_on ? PipelineTimeLeft_ms(&x->pipeline) : UINT32_MAX;
+	uint32_t now_ms = Now_ms();
+	for( unsigned which = 0; which < X11_SELECTIONS; ++which )
+	{
+		const X11Reading* r = &x->reading[which];
+		uint32_t read_ms = r->busy ? Left_ms(now_ms, r->last_ms, X11_READ_TIMEOUT_ms) : UINT32_MAX;
+		if( read_ms < left_ms )  left_ms = read_ms;
+	}
+	for( unsigned i = 0; i < X11_MAX_TRANSFERS; ++i )
+	{
+		const X11Transfer* t = &x->transfers[i];
+		uint32_t transfer_ms = (t->requestor != None) ? Left_ms(now_ms, t->last_ms, X11_TRANSFER_TIMEOUT_ms) : UINT32_MAX;
+		if( transfer_ms < left_ms )  left_ms = transfer_ms;
+	}
+	struct itimerspec its = {0};
+	if( left_ms != UINT32_MAX )
+	{
+		its.it_value.tv_sec = left_ms / 1000;
+		its.it_value.tv_nsec = (left_ms % 1000) * 1000000L;
+		if( left_ms == 0 )  its.it_value.tv_nsec = 1;
+	}
+	timerfd_settime(x->timer_fd, 0, &its, NULL);
+}
+
+bool X11IsBusy( const X11* x )
+{
+	return PipelineIsBusy(&x->pipeline);
+}
+
+void X11TranslateSelection( X11* x, const X11Translation* t )
+{
+	if( PipelineIsBusy(&x->pipeline) )  return LOG("busy");
+
+	Window focus;
+	int revert;
+	XGetInputFocus(x->display, &focus, &revert);
+	x->translation = *t;
+	x->started_us = Now_us();
+	PipelineStart(&x->pipeline, (PipeWindow)focus, (PipeLayout)&x->translation);
+	Rearm(x);
+}
+
+// -----------------------------------------------------------------------------
+
+bool X11Open( X11* x, const char* display_name, const X11Host* host )
+{
+	memset(x, 0, sizeof(*x));
+	x->host = *host;
+	x->requested = -1;
+	x->timer_fd = -1;
+	ArenaInit(&x->arena, ARENA_KEEP);
+
+	int major = XkbMajorVersion, minor = XkbMinorVersion, reason;
+	int xkb_opcode, xkb_error;
+	x->display = XkbOpenDisplay((char*)display_name, &x->xkb_event, &xkb_error, &major, &minor, &reason);
+	if( x->display == NULL )  return LOG("cannot open the display (%d)", reason), false;
+	XSetErrorHandler(OnXError);
+	(void)xkb_opcode;
+
+	int xfixes_error;
+	if( !XFixesQueryExtension(x->display, &x->xfixes_event, &xfixes_error) )
+		return LOG("no XFixes"), X11Close(x), false;
+
+	XInternAtoms(x->display, (char**)kAtomNames, ATOMS, False, x->atoms);
+
+	XSetWindowAttributes attributes = { .event_mask = PropertyChangeMask };
+	x->window = XCreateWindow(x->display, DefaultRootWindow(x->display), -10, -10, 1, 1, 0, 0, InputOnly,
+	                          CopyFromParent, CWEventMask, &attributes);
+
+	// the size of a property change that goes in one request, with room for the rest of it
+	long max_request = XExtendedMaxRequestSize(x->display);
+	if( max_request == 0 )  max_request = XMaxRequestSize(x->display);
+	x->max_piece = (size_t)max_request * 4 - 256;
+	if( x->max_piece > 256 * 1024 )  x->max_piece = 256 * 1024;
+
+	for( unsigned which = 0; which < X11_SELECTIONS; ++which )
+	{
+		XFixesSelectSelectionInput(x->display, x->window, x->atoms[which == x11Primary ? atPrimary : atClipboard],
+		                           XFixesSetSelectionOwnerNotifyMask | XFixesSelectionWindowDestroyNotifyMask
+		                           | XFixesSelectionClientCloseNotifyMask);
+	}
+
+	XkbSelectEventDetails(x->display, XkbUseCoreKbd, XkbStateNotify, XkbGroupLockMask, XkbGroupLockMask);
+	unsigned keymap_events = XkbNewKeyboardNotifyMask | XkbMapNotifyMask | XkbNamesNotifyMask | XkbControlsNotifyMask;
+	XkbSelectEvents(x->display, XkbUseCoreKbd, keymap_events, keymap_events);
+
+	const LayoutProvider provider = { EnumerateGroups, GetGroupId, GetGroupName, x };
+	LayoutRegistryInit(&x->layouts, &provider);
+	if( !LoadKeymap(x) )  return X11Close(x), false;
+
+	x->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if( x->timer_fd < 0 )  return LOG("timerfd_create: %s", strerror(errno)), X11Close(x), false;
+
+	const PipelineHost pipeline_host =
+	{
+		.now_ms = HostNow,
+		.start_timer = HostStartTimer,
+		.stop_timer = HostStopTimer,
+		.special_handling = HostSpecialHandling,
+		.post_copy = HostPostCopy,
+		.send_copy_keys = HostSendCopyKeys,
+		.send_paste_keys = HostSendPasteKeys,
+		.translate_clipboard = HostTranslateClipboard,
+		.idle = HostIdle,
+		.ctx = x,
+	};
+	const PipelineTimeouts timeouts = PIPELINE_DEFAULT_TIMEOUTS;
+	PipelineInit(&x->pipeline, &pipeline_host, &timeouts);
+
+	XFlush(x->display);
+	return true;
+}
+
+void X11Close( X11* x )
+{
+	for( unsigned which = 0; which < X11_SELECTIONS; ++which )
+	{
+		free(x->reading[which].data);
+		x->reading[which].data = NULL;
+		if( x->display )  Disown(x, which);
+	}
+	if( x->timer_fd >= 0 )  close(x->timer_fd);
+	x->timer_fd = -1;
+	LayoutRegistryFree(&x->layouts);
+	ArenaFree(&x->arena);
+	if( x->display )
+	{
+		if( x->window )  XDestroyWindow(x->display, x->window);
+		XCloseDisplay(x->display);
+	}
+	x->display = NULL;
+}
+
+unsigned X11Fds( const X11* x, int fds [2] )
+{
+	fds[0] = ConnectionNumber(x->display);
+	fds[1] = x->timer_fd;
+	return 2;
+}
+
+static void HandleEvent( X11* x, XEvent* ev )
+{
+	if( ev->type == x->xkb_event )
+		return OnXkbEvent(x, (const XkbEvent*)ev);
+	if( ev->type == x->xfixes_event + XFixesSelectionNotify )
+		return OnSelectionOwner(x, (const XFixesSelectionNotifyEvent*)ev);
+
+	switch( ev->type )
+	{
+		case SelectionRequest:
+			OnSelectionRequest(x, &ev->xselectionrequest);
+			break;
+
+		case SelectionClear:
+		{
+			int which = SelectionIndex(x, ev->xselectionclear.selection);
+			if( which >= 0 )  Disown(x, which);
+			break;
+		}
+
+		case SelectionNotify:
+			OnSelectionNotify(x, &ev->xselection);
+			break;
+
+		case PropertyNotify:
+			OnPropertyNotify(x, &ev->xproperty);
+			break;
+
+		case DestroyNotify:
+			// a requestor gone in the middle of a transfer (only theirs are watched)
+			for( unsigned i = 0; i < X11_MAX_TRANSFERS; ++i )
+			{
+				X11Transfer* t = &x->transfers[i];
+				if( t->requestor == ev->xdestroywindow.window )  AbandonTransfer(x, t, true);
+			}
+			break;
+	}
+}
+
+bool X11Dispatch( X11* x )
+{
+	uint64_t expirations;
+	if( read(x->timer_fd, &expirations, sizeof(expirations)) == sizeof(expirations) )
+	{
+		PipelineOnTimer(&x->pipeline);
+		Expire(x);
+	}
+
+	while( XPending(x->display) > 0 )
+	{
+		XEvent ev;
+		XNextEvent(x->display, &ev);
+		HandleEvent(x, &ev);
+	}
+	Rearm(x);
+	XFlush(x->display);
+	return true;
+}
+
+bool X11Wait( X11* x, int timeout_ms )
+{
+	if( XPending(x->display) == 0 )
+	{
+		struct pollfd fds [2] = { { .events = POLLIN }, { .events = POLLIN } };
+		int raw [2];
+		X11Fds(x, raw);
+		fds[0].fd = raw[0];
+		fds[1].fd = raw[1];
+		if( (poll(fds, 2, timeout_ms) < 0) && (errno != EINTR) )  return LOG("poll: %s", strerror(errno)), false;
+		if( fds[0].revents & (POLLHUP | POLLERR) )  return LOG("the connection is broken"), false;
+	}
+	return X11Dispatch(x);
+}
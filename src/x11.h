@@ -0,0 +1,172 @@
+#ifndef X11_H
+#define X11_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <X11/Xlib.h>
+#include "layouts.h"
+#include "pipeline.h"
+#include "translate.h"
+#include "arena.h"
+
+// kbsw on an X11 display: what the Win32 API does for it on Windows.
+//   - The layouts are the XKB groups, switched by locking one (XkbLockGroup); the state
+//     notifications of XKB say when it has taken effect, whoever changed it.
+//   - A selection is translated as on Windows, by a Pipeline (pipeline.h): the PRIMARY
+//     selection, which X keeps without any copying, takes the place of WM_COPY, and
+//     Ctrl+C with the CLIPBOARD that of the keyboard copy; the translation goes into the
+//     CLIPBOARD, and is pasted with Ctrl+V (XTest if the server and libXtst have it,
+//     else a synthetic key event).
+//   - The selections are read and served by the ICCCM, INCR transfers included, and
+//     XFixes says when another client takes one.
+//
+// It is all driven by events: those of the connection, and a timer armed for the
+// next timeout of the pipeline, or of a selection being read or served, if any. X11Fds gives the descriptors to wait on (e.g.
+// with those of evdev.h in the same epoll set) and X11Dispatch handles whatever has
+// come; everything runs on that one thread.
+
+enum
+{
+	X11_MAX_GROUPS    = 4,    // XkbNumKbdGroups
+	X11_LEVELS        = 2,    // of each key, looked at to retype: plain and shifted
+	X11_MAX_TRANSFERS = 8,    // INCR transfers served at once
+
+	X11_READ_TIMEOUT_ms     = 3000,   // with no word from the owner of a selection read, it is given up
+	X11_TRANSFER_TIMEOUT_ms = 5000,   // ... and from the requestor of one served in INCR pieces
+};
+
+typedef enum
+{
+	x11Primary,
+	x11Clipboard,
+	X11_SELECTIONS
+} X11Selection;
+
+// What a selection is translated with (the Translation of mojibake.h).
+typedef struct
+{
+	int                     group;      // the XKB group to retype it in, or -1 to use `translators`
+	const TranslatorClass*  translators [TR_MAX_STAGES];
+	unsigned                ntranslators;
+} X11Translation;
+
+typedef struct
+{
+	// the locked group has changed, with X11LockGroup or otherwise
+	void (*group_changed)( void* ctx, unsigned group );
+	// a selection asked for with X11ReadSelection has come (NULL if it could not be had in time)
+	void (*selection_read)( void* ctx, X11Selection which, const char* utf8, size_t length );
+	// a translation has ended, one way or another
+	void (*idle)( void* ctx, bool pasted );
+	void* ctx;
+} X11Host;
+
+typedef struct
+{
+	uint64_t  switches;
+	uint64_t  switches_skipped;     // the group was locked already
+	uint64_t  translations;
+	uint64_t  incr_read;            // selections that came in INCR pieces
+	uint64_t  incr_served;
+	uint64_t  reads_abandoned;      // their owner never answered, or the translation ended first
+	uint64_t  transfers_abandoned;  // their requestor stopped taking the pieces, or is gone
+	uint32_t  last_switch_us;       // from XkbLockGroup to its state notification
+	uint32_t  last_translation_us;  // from X11TranslateSelection to the paste
+} X11Stats;
+
+// a selection being served in INCR pieces
+typedef struct
+{
+	Window    requestor;   // None if the slot is free
+	Atom      property;
+	unsigned  selection;
+	size_t    offset;      // of the next piece; past the end once the empty one is sent
+	uint32_t  last_ms;     // when the requestor last took a piece
+} X11Transfer;
+
+// a selection being read
+typedef struct
+{
+	bool      busy;
+	bool      incr;
+	bool      for_translation;
+	Time      time;        // of the request, which its answer carries: an older one is stale
+	uint32_t  last_ms;     // when the owner was last heard from
+	char*     data;
+	size_t    length, size;
+} X11Reading;
+
+typedef struct
+{
+	Display*      display;
+	Window        window;        // an unmapped one: owns the selections and receives them
+	int           timer_fd;      // for the next timeout of the pipeline, a read or a transfer
+	int           xkb_event;     // the first event code of XKB
+	int           xfixes_event;  // ... and of XFixes
+	X11Host       host;
+	Atom          atoms [16];
+
+	// the XKB groups, and the character on each key (keycode, level) in each of them
+	unsigned      ngroups;
+	unsigned      group;         // the one locked now
+	int           requested;     // by X11LockGroup, until it has taken effect; -1 if none
+	uint64_t      requested_us;
+	char          ids [X11_MAX_GROUPS][LAYOUT_ID_SIZE];
+	char          names [X11_MAX_GROUPS][64];
+	uint16_t      chars [X11_MAX_GROUPS][256][X11_LEVELS];
+	uint32_t      keys [X11_MAX_GROUPS][256 * X11_LEVELS];  // char << 16 | keycode * X11_LEVELS + level, sorted
+	unsigned      nkeys [X11_MAX_GROUPS];
+	LayoutRegistry  layouts;
+
+	// the selections
+	char*         owned [X11_SELECTIONS];          // what is served, UTF-8; NULL if not owned
+	size_t        owned_length [X11_SELECTIONS];
+	Time          owned_time [X11_SELECTIONS];     // since when; requests from before are refused
+	X11Transfer   transfers [X11_MAX_TRANSFERS];
+	X11Reading    reading [X11_SELECTIONS];
+	size_t        max_piece;                        // bytes per property change
+
+	// the translation
+	Pipeline        pipeline;
+	X11Translation  translation;
+	bool            timer_on;
+	Window          target;
+	const char*     text;        // the selection to translate, once read (in `arena`)
+	size_t          text_length;
+	uint64_t        started_us;
+	Arena           arena;
+
+	X11Stats      stats;
+} X11;
+
+
+// ---- provided by x11.c ------------------------------------------------------
+
+// Connects to `display_name` (NULL for $DISPLAY); needs XKB and XFixes.
+bool X11Open( X11* x, const char* display_name, const X11Host* host );
+void X11Close( X11* x );
+
+// The descriptors to wait on for reading; returns how many (2).
+unsigned X11Fds( const X11* x, int fds [2] );
+// Handles all that has come, without waiting; returns false if the connection is broken.
+bool X11Dispatch( X11* x );
+// Waits up to `timeout_ms` (-1: for as long as it takes) for something, then dispatches.
+bool X11Wait( X11* x, int timeout_ms );
+
+// The groups, as layouts: LayoutHandle is the group number.
+LayoutRegistry* X11Layouts( X11* x );
+// Locks `group`, unless it is locked already; the host's group_changed follows.
+bool X11LockGroup( X11* x, unsigned group );
+
+bool X11IsBusy( const X11* x );
+// Translates the selection of the focused window as `t` says (it is copied), then pastes
+// the result over it; the host's idle says when that is done. Does nothing if busy.
+void X11TranslateSelection( X11* x, const X11Translation* t );
+
+// Owns `which`, with `length` bytes of UTF-8 (copied); served until another client takes it.
+bool X11OwnSelection( X11* x, X11Selection which, const char* utf8, size_t length );
+// Asks the owner of `which` for its text; the host's selection_read gets it.
+bool X11ReadSelection( X11* x, X11Selection which );
+
+#endif
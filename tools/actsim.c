@@ -0,0 +1,286 @@
+// A simulator of the activation queue (src/actqueue.c): runs bursty traces of activations
+// (double taps in quick succession, switches and translations of a few windows mixed)
+// through the real queue in virtual time, a millisecond at a time, against translations
+// that keep the pipeline busy for a while, the way kbsw.c does: an activation that comes
+// while a translation is busy, or while others are waiting, is queued, and the queue is
+// drained once the pipeline is idle, until one of them starts a translation again.
+// It counts the actions lost and the delays, next to what dropping them (as kbsw did
+// before the queue) would lose, and checks that
+//   - nothing is lost while no more than ACTQ_SIZE windows wait for a translation;
+//   - the layout ends up as the last switch asked for, after every burst;
+//   - nothing waits longer than a full queue of the slowest translations;
+//   - what a full queue pushes out is counted, and nothing else is lost.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o actsim actsim.c ../src/actqueue.c
+//
+// actsim [--hours=N] [--windows=N] [--seed=N]
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "actqueue.h"
+#include "check.h"
+
+enum
+{
+	DRAIN_DELAY_ms = 1,       // the posted UWM_DRAIN_ACTIVATIONS
+	MAX_EVENTS     = 1 << 20,
+};
+
+typedef struct
+{
+	uint32_t  at_ms;
+	unsigned  binding;        // 0, 1: the layouts; 2: a translation (hex)
+	uintptr_t window;         // focused then
+} Event;
+
+typedef struct
+{
+	const char*  name;
+	uint32_t     hours;
+	uint32_t     burst_gap_ms;      // between the bursts, on average
+	unsigned     max_burst;         // activations in a burst
+	uint32_t     min_spacing_ms;    // between the activations of a burst
+	uint32_t     max_spacing_ms;
+	unsigned     windows;           // the translations go to one of these
+	double       translate_rate;    // of the activations
+	uint32_t     min_translation_ms, max_translation_ms;
+	double       slow_rate;         // translations that take 5 times longer (a slow app)
+} Trace;
+
+typedef struct
+{
+	unsigned  activations;
+	unsigned  lost;                  // neither run nor superseded by a later one
+	unsigned  coalesced;             // superseded while waiting
+	unsigned  ran, queued;
+	unsigned  wrong_layout;          // bursts after which the layout was not the last one asked for
+	unsigned  bursts;
+	uint32_t  delays [MAX_EVENTS];   // of the queued ones that ran
+	unsigned  ndelays;
+	unsigned  pushed_out;            // by a full queue, as counted by it
+} Result;
+
+static Event     gEvents [MAX_EVENTS];
+static unsigned  gCount;
+static uint32_t  gBurstEnds [MAX_EVENTS];   // the last activation of each burst
+static unsigned  gBursts;
+
+static uint32_t Uniform( uint32_t lo, uint32_t hi )
+{
+	return lo + (uint32_t)(rand() % (hi - lo + 1));
+}
+
+static void MakeTrace( const Trace* tr, unsigned seed )
+{
+	srand(seed);
+	gCount = gBursts = 0;
+	uint32_t end_ms = tr->hours * 3600 * 1000;
+	for( uint32_t t = Uniform(0, tr->burst_gap_ms); (t < end_ms) && (gCount + tr->max_burst < MAX_EVENTS);
+	     t += Uniform(tr->burst_gap_ms / 2, tr->burst_gap_ms * 3 / 2) )
+	{
+		unsigned n = Uniform(1, tr->max_burst);
+		for( unsigned i = 0; i < n; ++i )
+		{
+			Event* e = &gEvents[gCount++];
+			e->at_ms = t;
+			e->binding = (rand() < tr->translate_rate * RAND_MAX) ? 2 : (unsigned)(rand() % 2);
+			e->window = 1 + rand() % tr->windows;
+			if( i + 1 < n )  t += Uniform(tr->min_spacing_ms, tr->max_spacing_ms);
+		}
+		gBurstEnds[gBursts++] = t;
+	}
+}
+
+static uint32_t TranslationTime( const Trace* tr )
+{
+	uint32_t ms = Uniform(tr->min_translation_ms, tr->max_translation_ms);
+	return (rand() < tr->slow_rate * RAND_MAX) ? 5 * ms : ms;
+}
+
+static int CompareU32( const void* a, const void* b )
+{
+	uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+	return (x > y) - (x < y);
+}
+
+// Runs the trace through the queue; with `drop`, activations are dropped while busy instead.
+static void Simulate( const Trace* tr, bool drop, Result* r )
+{
+	memset(r, 0, sizeof(*r));
+	static ActivationQueue q;
+	ActivationQueueInit(&q);
+
+	// which events have run or been superseded, to count the rest as lost
+	static uint8_t fate [MAX_EVENTS];   // 0 lost, 1 ran, 2 superseded
+	memset(fate, 0, gCount);
+	static unsigned pending [ACTQ_SIZE + 1];   // the events in the queue, in its order
+
+	uint32_t busy_until = 0, drain_at = UINT32_MAX;
+	int layout = -1, wanted = -1;
+	unsigned next = 0, burst = 0;
+	uint32_t end_ms = gBurstEnds[gBursts - 1] + 60000;
+
+	for( uint32_t now = 0; now < end_ms; ++now )
+	{
+		// the queue drained: until one of them starts a translation
+		if( now == drain_at )
+		{
+			drain_at = UINT32_MAX;
+			Activation act;
+			while( (now >= busy_until) && ActivationQueuePop(&q, &act) )
+			{
+				unsigned ev = pending[0];
+				memmove(pending, pending + 1, q.count * sizeof(pending[0]));
+				fate[ev] = 1;
+				++r->ran;
+				r->delays[r->ndelays++] = now - (uint32_t)act.queued_us;
+				if( act.binding == 2 )  busy_until = now + TranslationTime(tr);
+				else  layout = (int)act.binding;
+			}
+		}
+
+		for( ; (next < gCount) && (gEvents[next].at_ms == now); ++next )
+		{
+			const Event* e = &gEvents[next];
+			++r->activations;
+			bool translation = (e->binding == 2);
+			if( !translation )  wanted = (int)e->binding;
+
+			if( (now < busy_until) || (q.count > 0) )
+			{
+				if( drop )  continue;
+				// as OnActivateLayout: a switch goes to whatever is focused when it runs
+				Activation act = { .binding = e->binding, .target = translation ? e->window : 0, .queued_us = now };
+				unsigned before = q.count, dropped = q.ndropped, coalesced = q.ncoalesced;
+				ActivationQueuePush(&q, &act);
+				++r->queued;
+				// mirror what the queue did to its items
+				if( q.ncoalesced != coalesced )
+				{
+					for( unsigned i = 0; i < before; ++i )
+					{
+						if( gEvents[pending[i]].binding == 2 ? (translation && gEvents[pending[i]].window == e->window)
+						                                    : !translation )
+						{
+							fate[pending[i]] = 2;
+							memmove(pending + i, pending + i + 1, (before - i - 1) * sizeof(pending[0]));
+							--before;
+							break;
+						}
+					}
+				}
+				if( q.ndropped != dropped )
+				{
+					memmove(pending, pending + 1, (before - 1) * sizeof(pending[0]));
+					--before;
+				}
+				pending[before] = next;
+				if( now >= busy_until )  drain_at = now + DRAIN_DELAY_ms;
+				continue;
+			}
+
+			fate[next] = 1;
+			++r->ran;
+			if( translation )  busy_until = now + TranslationTime(tr);
+			else  layout = (int)e->binding;
+		}
+
+		// the translation done: drain what has queued up meanwhile
+		if( (now + 1 == busy_until) && (q.count > 0) )  drain_at = now + 1 + DRAIN_DELAY_ms;
+
+		// a burst over, and everything settled: the layout is the last one asked for
+		if( (burst < gBursts) && (now >= gBurstEnds[burst]) && (now >= busy_until) && (q.count == 0)
+		 && ((burst + 1 == gBursts) || (now < gEvents[next].at_ms)) )
+		{
+			r->wrong_layout += (layout != wanted);
+			++r->bursts;
+			++burst;
+		}
+	}
+
+	r->pushed_out = q.ndropped;
+	r->coalesced = q.ncoalesced;
+	for( unsigned i = 0; i < gCount; ++i )  r->lost += (fate[i] == 0);
+}
+
+static void Report( const char* name, const char* policy, Result* r )
+{
+	uint32_t p50 = 0, p99 = 0, max = 0;
+	if( r->ndelays )
+	{
+		qsort(r->delays, r->ndelays, sizeof(r->delays[0]), CompareU32);
+		p50 = r->delays[r->ndelays / 2];
+		p99 = r->delays[r->ndelays * 99 / 100];
+		max = r->delays[r->ndelays - 1];
+	}
+	printf("%-20s %-6s %7u activations: %5u lost (%.2f%%), %5u queued, %5u superseded; "
+	       "delayed %u ms median, %u ms p99, %u ms max; wrong layout after %u of %u bursts\n",
+	       name, policy, r->activations, r->lost, 100.0 * r->lost / r->activations, r->queued, r->coalesced,
+	       p50, p99, max, r->wrong_layout, r->bursts);
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+int main( int argc, char* argv [] )
+{
+	unsigned hours = 8, windows = 3, seed = 1;
+	for( int i = 1; i < argc; ++i )
+	{
+		if( ParseArg(argv[i], "--hours", &hours) || ParseArg(argv[i], "--windows", &windows)
+		 || ParseArg(argv[i], "--seed", &seed) )
+			continue;
+		fprintf(stderr, "usage: actsim [--hours=N] [--windows=N] [--seed=N]\n");
+		return 2;
+	}
+	if( (hours == 0) || (windows == 0) || (windows > ACTQ_SIZE) )
+		return fprintf(stderr, "the windows should be from 1 to %u\n", ACTQ_SIZE), 2;
+
+	static Result queued, dropped;
+	char what [160];
+
+	// a fast typist: a word or two fixed in a row, every half a minute
+	const Trace typist = { "fast typist", hours, 30000, 4, 150, 400, windows, 0.4, 80, 400, 0.05 };
+	MakeTrace(&typist, seed);
+	Simulate(&typist, false, &queued);
+	Simulate(&typist, true, &dropped);
+	Report(typist.name, "queue", &queued);
+	Report(typist.name, "drop", &dropped);
+	Check((queued.lost == 0) && (queued.pushed_out == 0), "fast typist: nothing lost");
+	Check(queued.wrong_layout == 0, "fast typist: the last switch always wins");
+	snprintf(what, sizeof(what), "fast typist: the queue saves %u of the %u actions dropping loses",
+	         dropped.lost - queued.lost, dropped.lost);
+	Check(dropped.lost > queued.lost, what);
+
+	// slow apps: every translation takes seconds, bursts of many
+	const Trace slow = { "slow apps", hours, 20000, 8, 150, 300, windows, 0.5, 800, 2000, 0.1 };
+	MakeTrace(&slow, seed + 1);
+	Simulate(&slow, false, &queued);
+	Simulate(&slow, true, &dropped);
+	Report(slow.name, "queue", &queued);
+	Report(slow.name, "drop", &dropped);
+	Check((queued.lost == 0) && (queued.wrong_layout == 0), "slow apps: nothing lost, the last switch wins");
+	uint32_t worst_wait_ms = ACTQ_SIZE * slow.max_translation_ms * 5;
+	snprintf(what, sizeof(what), "slow apps: no wait longer than a full queue of the slowest translations (%u ms)",
+	         worst_wait_ms);
+	Check(queued.ndelays && (queued.delays[queued.ndelays - 1] <= worst_wait_ms), what);
+
+	// more windows waiting than the queue holds: the oldest are pushed out, and counted
+	const Trace flood = { "flood", hours, 10000, 24, 100, 150, 2 * ACTQ_SIZE, 1.0, 1500, 3000, 0.0 };
+	MakeTrace(&flood, seed + 2);
+	Simulate(&flood, false, &queued);
+	Report(flood.name, "queue", &queued);
+	Check((queued.pushed_out > 0) && (queued.lost == queued.pushed_out),
+	      "flood: only what a full queue pushes out is lost, and it is counted");
+
+	return gFailed;
+}
@@ -0,0 +1,249 @@
+// Checks the arena of the transient translation buffers (src/arena.c), and measures the
+// memory footprint of the translations with it against what they took before: a buffer
+// of the worst-case output size for each, which went straight to the clipboard.
+// A day of the resident process is played out with the portable translators: mostly
+// short selections, now and then a giant one, each followed by the idle trim.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o arenabench arenabench.c ../src/arena.c
+//     ../src/translate.c ../src/hex.c ../src/grapheme.c ../src/names.c ../src/names_posix.c
+//     ../src/casemap.c
+//
+// arenabench [--count=N] [--giant=KB] [--seed=N]
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "arena.h"
+#include "translate.h"
+#include "common.h"
+#include "check.h"
+
+static double Seconds( void )
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned long* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+static uint64_t gRng;
+
+static uint32_t Random( uint32_t n )
+{
+	// xorshift64*
+	gRng ^= gRng >> 12;
+	gRng ^= gRng << 25;
+	gRng ^= gRng >> 27;
+	return (uint32_t)((gRng * 0x2545F4914F6CDD1DULL) >> 32) % n;
+}
+
+// ---- the arena --------------------------------------------------------------
+
+static void CheckArena( void )
+{
+	Arena a;
+	ArenaInit(&a, ARENA_MIN_BLOCK);
+
+	bool aligned = true;
+	char* first = NULL;
+	for( unsigned i = 1; i < 100; ++i )
+	{
+		char* p = ArenaAlloc(&a, i * 7);
+		aligned &= (p != NULL) && ((uintptr_t)p % ARENA_ALIGN == 0);
+		if( i == 1 )  first = p;
+		memset(p, 0xAB, i * 7);
+	}
+	Check(aligned && (a.held < ARENA_MIN_BLOCK), "small allocations come from the first block, aligned");
+
+	ArenaReset(&a);
+	Check((ArenaAlloc(&a, 16) == first) && (a.used == 16), "a reset reuses the memory");
+
+	size_t peak_before = a.peak;
+	char* big = ArenaAlloc(&a, 1 << 20);
+	Check(big && (a.held >= (1 << 20) + ARENA_MIN_BLOCK / 2) && (a.peak > peak_before), "a big allocation adds a block");
+	memset(big, 0xCD, 1 << 20);
+
+	ArenaReset(&a);
+	size_t held = a.held;
+	Check((ArenaAlloc(&a, 1 << 19) != NULL) && (a.held == held), "a reset keeps the blocks for the next one");
+
+	ArenaTrim(&a);
+	Check((a.held <= a.keep) && (a.held > 0) && (a.used == 0), "a trim frees the blocks beyond the cap");
+	Check(ArenaAlloc(&a, 100) == first, "... and keeps the first one");
+
+	Check(ArenaAlloc(&a, SIZE_MAX - 4) == NULL, "an impossible size fails");
+
+	ArenaFree(&a);
+	Check((a.held == 0) && (a.first == NULL), "freed");
+}
+
+// ---- the day ----------------------------------------------------------------
+
+static const char* const kTranslators [] = { "HEX", "UHEX", "GHEX", "CASE", "CYCLE" };
+
+static const char* const kPieces [] =
+{
+	"Hello world, ", "\\u0041\\u00e9 ", "U+1F4A1 ", "&#x26; ", "0x41 ", "hELLO wORLD ", "\xD0\x9F\xD1\x80\xD0\xB8 ",
+};
+
+// some text, with a bit of everything the translators look for
+static size_t MakeText( UTF16* text, size_t length )
+{
+	size_t n = 0;
+	while( n < length )
+	{
+		const unsigned char* p = (const unsigned char*)kPieces[Random(COUNTOF(kPieces))];
+		while( *p && (n < length) )
+		{
+			if( *p < 0x80 )  text[n++] = *p++;
+			else  { text[n++] = ((p[0] & 0x1F) << 6) | (p[1] & 0x3F); p += 2; }
+		}
+	}
+	return n;
+}
+
+typedef struct
+{
+	size_t  peak;          // of the memory of the buffers at once, during a translation
+	size_t  after_max;     // left after one: the clipboard's copy, and what the arena holds
+	double  after_total;
+	double  seconds;
+} Footprint;
+
+// the old way: a worst-case buffer, then given to the clipboard as is
+static bool TranslateOld( TrPipeline* p, const UTF16* text, size_t length, Footprint* f,
+                          UTF16** pout, size_t* pout_length )
+{
+	size_t size = (TrPipelineMaxOutput(p, length) + 1) * sizeof(UTF16);
+	UTF16* buffer = malloc(size);
+	if( buffer == NULL )  return false;
+	TrBuffer out = { .data = buffer, .size = size / sizeof(UTF16) - 1 };
+	TrPipelineRun(p, text, length, &out);
+	if( size > f->peak )  f->peak = size;
+	*pout = buffer;   // owned by the clipboard
+	*pout_length = out.length;
+	return true;
+}
+
+// the arena: the worst case in the arena, and an exact-size copy for the clipboard
+static bool TranslateArena( Arena* a, TrPipeline* p, const UTF16* text, size_t length, Footprint* f,
+                            UTF16** pout, size_t* pout_length )
+{
+	size_t size = (TrPipelineMaxOutput(p, length) + 1) * sizeof(UTF16);
+	UTF16* buffer = ArenaAlloc(a, size);
+	if( buffer == NULL )  return false;
+	TrBuffer out = { .data = buffer, .size = size / sizeof(UTF16) - 1 };
+	TrPipelineRun(p, text, length, &out);
+
+	UTF16* copy = malloc((out.length + 1) * sizeof(UTF16));
+	if( copy == NULL )  return false;
+	memcpy(copy, buffer, (out.length + 1) * sizeof(UTF16));
+	if( a->held + (out.length + 1) * sizeof(UTF16) > f->peak )  f->peak = a->held + (out.length + 1) * sizeof(UTF16);
+	ArenaReset(a);
+
+	*pout = copy;
+	*pout_length = out.length;
+	return true;
+}
+
+static void PlayDay( unsigned long count, unsigned long giant_units, unsigned long seed )
+{
+	UTF16* text = malloc(giant_units * sizeof(UTF16));
+	if( text == NULL )
+	{
+		printf("FAIL out of memory\n");
+		gFailed = true;
+		return;
+	}
+
+	Arena arena;
+	ArenaInit(&arena, ARENA_MIN_BLOCK);
+	Footprint old = {0}, new = {0};
+	size_t held_idle = 0;   // the most the arena held between the translations
+	unsigned long mismatches = 0, giants = 0;
+	gRng = seed * 0x9E3779B97F4A7C15ULL + 1;
+
+	for( unsigned long i = 0; i < count; ++i )
+	{
+		// one in a hundred is a giant paste, the rest a few words to a paragraph
+		bool giant = (Random(100) == 0);
+		size_t length = MakeText(text, giant ? giant_units : 5 + Random(400));
+		giants += giant;
+
+		const char* name = kTranslators[Random(COUNTOF(kTranslators))];
+		const TranslatorClass* cls = TranslatorFind(name, strlen(name));
+		TrPipeline p;
+		if( (cls == NULL) || !TrPipelineInit(&p, &cls, NULL, 1) )  continue;
+
+		UTF16 *out_old, *out_new;
+		size_t length_old, length_new;
+		double t0 = Seconds();
+		bool ok_old = TranslateOld(&p, text, length, &old, &out_old, &length_old);
+		double t1 = Seconds();
+		TrPipelineInit(&p, &cls, NULL, 1);
+		bool ok_new = TranslateArena(&arena, &p, text, length, &new, &out_new, &length_new);
+		double t2 = Seconds();
+		ArenaTrim(&arena);   // the translation is over: the pipeline goes idle
+
+		old.seconds += t1 - t0;
+		new.seconds += t2 - t1;
+		if( !ok_old || !ok_new || (length_old != length_new) || memcmp(out_old, out_new, length_new * sizeof(UTF16)) )
+			++mismatches;
+		size_t after_old = ok_old ? (TrPipelineMaxOutput(&p, length) + 1) * sizeof(UTF16) : 0;
+		size_t after_new = (ok_new ? (length_new + 1) * sizeof(UTF16) : 0) + arena.held;
+		old.after_total += after_old;
+		new.after_total += after_new;
+		if( after_old > old.after_max )  old.after_max = after_old;
+		if( after_new > new.after_max )  new.after_max = after_new;
+		if( arena.held > held_idle )  held_idle = arena.held;
+		if( ok_old )  free(out_old);
+		if( ok_new )  free(out_new);
+	}
+
+	char what [200];
+	snprintf(what, sizeof(what), "%lu translations (%lu giant), the same output either way", count, giants);
+	Check(mismatches == 0, what);
+	snprintf(what, sizeof(what), "held by the arena between the translations: at most %zu bytes", held_idle);
+	Check(held_idle <= ARENA_MIN_BLOCK, what);
+
+	printf("\n%-34s %12s %12s\n", "", "worst-case", "arena");
+	printf("%-34s %12zu %12zu\n", "peak bytes, during a translation", old.peak, new.peak);
+	printf("%-34s %12zu %12zu\n", "most bytes left after one", old.after_max, new.after_max);
+	printf("%-34s %12.0f %12.0f\n", "mean bytes left after one", old.after_total / count, new.after_total / count);
+	printf("%-34s %12.2f %12.2f\n", "us per translation", old.seconds * 1e6 / count, new.seconds * 1e6 / count);
+	printf("arena: %zu bytes at the peak of use, %zu held now\n", arena.peak, arena.held);
+
+	ArenaFree(&arena);
+	free(text);
+}
+
+int main( int argc, char* argv[] )
+{
+	unsigned long count = 20000, giant_kb = 4096, seed = 1;
+	for( int i = 1; i < argc; ++i )
+	{
+		if( !ParseArg(argv[i], "--count", &count) && !ParseArg(argv[i], "--giant", &giant_kb)
+		    && !ParseArg(argv[i], "--seed", &seed) )
+		{
+			fprintf(stderr, "usage: %s [--count=N] [--giant=KB] [--seed=N]\n", argv[0]);
+			return 1;
+		}
+	}
+	if( count == 0 )  count = 1;
+	if( giant_kb == 0 )  giant_kb = 1;
+
+	CheckArena();
+	PlayDay(count, giant_kb * 1024 / sizeof(UTF16), seed);
+	return gFailed ? 1 : 0;
+}
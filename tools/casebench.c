@@ -0,0 +1,200 @@
+// Measures the throughput of the case translators (src/casemap.c) on a few kinds of text,
+// against a plain loop of towupper/towlower of the C library (in a UTF-8 locale) doing the
+// same, and counts where the two disagree.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o casebench casebench.c ../src/casemap.c ../src/translate.c
+//     ../src/hex.c ../src/grapheme.c ../src/names.c ../src/names_posix.c
+//
+// casebench [--size=KB] [--rounds=N]
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <locale.h>
+#include <wctype.h>
+#include "translate.h"
+#include "casemap.h"
+
+typedef struct
+{
+	const char*  name;
+	const char*  text;   // UTF-8, repeated
+} TextModel;
+
+static const TextModel kTexts [] =
+{
+	{ "english",  "tHE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, AND THEN SOME MORE WORDS FOLLOW. " },
+	{ "russian",  "сЪЕШЬ ЖЕ ЕЩЁ ЭТИХ МЯГКИХ ФРАНЦУЗСКИХ БУЛОК, ДА ВЫПЕЙ ЧАЮ. " },
+	{ "greek",    "ξΕΣΚΕΠΑΖΩ ΤΗΝ ΨΥΧΟΦΘΟΡΑ ΒΔΕΛΥΓΜΙΑ. " },
+	{ "mixed",    "hELLO, мИР! vERSION 2.0 (ΑΛΦΑ) — ÉTÉ À PARIS. " },
+	{ "code",     "IF( X == 0 ) RETURN ERR(\"NO SUCH KEY\"), FALSE; // SEE TRANSLATE.H\n" },
+};
+
+static double Seconds( void )
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned long* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+static double MBps( size_t units, unsigned rounds, double seconds )
+{
+	return (double)units * sizeof(UTF16) * rounds / seconds / (1024 * 1024);
+}
+
+// decodes the UTF-8 text repeatedly up to `size` units (once for SIZE_MAX); a character
+// that doesn't fit is left out
+static size_t MakeText( const char* utf8, UTF16* text, size_t size )
+{
+	size_t n = 0;
+	for( const unsigned char* p = (const unsigned char*)utf8; ; p = *p ? p : (const unsigned char*)utf8 )
+	{
+		unsigned len = (*p < 0x80) ? 1 : (*p < 0xE0) ? 2 : (*p < 0xF0) ? 3 : 4;
+		uint32_t u = (len == 1) ? *p : (*p & (0x3F >> (len - 1)));
+		for( unsigned k = 1; k < len; ++k )  u = (u << 6) | (p[k] & 0x3F);
+		p += len;
+
+		if( n + 1 + (u >= 0x10000) > size )  return n;
+		if( u < 0x10000 )  text[n++] = u;
+		else
+		{
+			text[n++] = 0xD800 + ((u - 0x10000) >> 10);
+			text[n++] = 0xDC00 + ((u - 0x10000) & 0x3FF);
+		}
+		if( (size == SIZE_MAX) && (*p == 0) )  return n;
+	}
+}
+
+static size_t Translate( const TranslatorClass* cls, const UTF16* text, size_t length, UTF16* out, size_t size )
+{
+	TrPipeline p;
+	TrPipelineInit(&p, &cls, NULL, 1);
+	TrBuffer b = { .data = out, .size = size };
+	TrPipelineRun(&p, text, length, &b);
+	return b.length;
+}
+
+// what one would write without the tables: a codepoint at a time, through the C library
+static size_t NaiveInvert( const UTF16* text, size_t length, UTF16* out )
+{
+	size_t n = 0;
+	for( size_t i = 0; i < length; ++i )
+	{
+		uint32_t u = text[i];
+		if( ((u & 0xFC00) == 0xD800) && (i + 1 < length) && ((text[i + 1] & 0xFC00) == 0xDC00) )
+			u = ((u - 0xD800) << 10) + (text[++i] - 0xDC00) + 0x10000;
+		u = iswupper(u) ? towlower(u) : towupper(u);
+		if( u < 0x10000 )  out[n++] = u;
+		else
+		{
+			out[n++] = 0xD800 + ((u - 0x10000) >> 10);
+			out[n++] = 0xDC00 + ((u - 0x10000) & 0x3FF);
+		}
+	}
+	return n;
+}
+
+int main( int argc, char* argv[] )
+{
+	unsigned long size_kb = 1024, rounds = 20;
+	for( int i = 1; i < argc; ++i )
+	{
+		if(      ParseArg(argv[i], "--size", &size_kb) )  size_kb = size_kb ? size_kb : 1;
+		else if( ParseArg(argv[i], "--rounds", &rounds) )  rounds = rounds ? rounds : 1;
+		else
+		{
+			fprintf(stderr, "usage: %s [--size=KB] [--rounds=N]\n", argv[0]);
+			return 1;
+		}
+	}
+	if( !setlocale(LC_CTYPE, "C.UTF-8") && !setlocale(LC_CTYPE, "en_US.UTF-8") )
+		fprintf(stderr, "no UTF-8 locale: towupper/towlower only know ASCII\n");
+
+	size_t size = size_kb * 1024 / sizeof(UTF16);
+	UTF16* text = malloc(size * sizeof(UTF16));
+	UTF16* out = malloc(size * 2 * sizeof(UTF16));
+	UTF16* naive = malloc(size * 2 * sizeof(UTF16));
+	UTF16* back = malloc(size * 2 * sizeof(UTF16));
+	if( !text || !out || !naive || !back )  return fprintf(stderr, "out of memory\n"), 1;
+
+	printf("%lu KB of text, %lu rounds; MB/s of the input\n\n", size_kb, rounds);
+	printf("%-8s %9s %9s %9s %9s   %s\n", "text", "memcpy", "naive", "CASE", "CYCLE", "CASE vs naive");
+	bool failed = false;
+	for( size_t t = 0; t < sizeof(kTexts) / sizeof(kTexts[0]); ++t )
+	{
+		size_t length = MakeText(kTexts[t].text, text, size);
+		double elapsed [4] = {0};
+		size_t n = 0, m = 0;
+		for( unsigned r = 0; r < rounds; ++r )
+		{
+			double t0 = Seconds();
+			memcpy(back, text, length * sizeof(UTF16));
+			double t1 = Seconds();
+			m = NaiveInvert(text, length, naive);
+			double t2 = Seconds();
+			n = Translate(&kCaseInvert, text, length, out, size * 2);
+			double t3 = Seconds();
+			Translate(&kCaseCycle, text, length, back, size * 2);
+			double t4 = Seconds();
+			elapsed[0] += t1 - t0;
+			elapsed[1] += t2 - t1;
+			elapsed[2] += t3 - t2;
+			elapsed[3] += t4 - t3;
+		}
+
+		// where the C library knows a mapping the tables don't, or vice versa
+		size_t differ = 0;
+		for( size_t i = 0; i < n && i < m; ++i )  differ += (out[i] != naive[i]);
+		differ += (n > m) ? n - m : m - n;
+
+		// CASE twice gives the text back
+		size_t k = Translate(&kCaseInvert, out, n, back, size * 2);
+		bool round_trip = (k == length) && (memcmp(back, text, length * sizeof(UTF16)) == 0);
+		failed |= !round_trip;
+
+		printf("%-8s %9.0f %9.0f %9.0f %9.0f   %zu units differ%s\n", kTexts[t].name,
+		       MBps(length, rounds, elapsed[0]), MBps(length, rounds, elapsed[1]),
+		       MBps(length, rounds, elapsed[2]), MBps(length, rounds, elapsed[3]),
+		       differ, round_trip ? "" : ", NO ROUND TRIP");
+	}
+
+	// a few known answers
+	static const struct { const TranslatorClass* cls; const char* input; const char* output; } kKnown [] =
+	{
+		{ &kCaseInvert, "hELLO wORLD",   "Hello World" },
+		{ &kCaseInvert, "пРИВЕТ, ǅ ß ẞ", "Привет, ǆ ß ß" },
+		{ &kCaseCycle,  "hello world",   "HELLO WORLD" },
+		{ &kCaseCycle,  "HELLO WORLD",   "Hello World" },
+		{ &kCaseCycle,  "Hello o'neil",  "hello o'neil" },
+		{ &kCaseCycle,  "42: ЗДРАВСТВУЙ, мир", "42: Здравствуй, Мир" },
+		{ &kCaseCycle,  "X",             "x" },
+	};
+	printf("\n");
+	for( size_t i = 0; i < sizeof(kKnown) / sizeof(kKnown[0]); ++i )
+	{
+		size_t n = MakeText(kKnown[i].input, text, SIZE_MAX);
+		n = Translate(kKnown[i].cls, text, n, out, size * 2);
+		size_t m = MakeText(kKnown[i].output, naive, SIZE_MAX);
+		bool ok = (n == m) && (memcmp(out, naive, n * sizeof(UTF16)) == 0);
+		failed |= !ok;
+		printf("%-6s %s  %s -> %s\n", kKnown[i].cls->name, ok ? "ok  " : "FAIL", kKnown[i].input, kKnown[i].output);
+	}
+
+	free(text);
+	free(out);
+	free(naive);
+	free(back);
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,18 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+// The checks of the tools that check themselves: each one printed, ok or FAIL, and
+// main returning gFailed, for make check.
+
+#include <stdbool.h>
+#include <stdio.h>
+
+static bool gFailed = false;
+
+static inline void Check( bool ok, const char* what )
+{
+	printf("%s %s\n", ok ? "ok  " : "FAIL", what);
+	gFailed |= !ok;
+}
+
+#endif
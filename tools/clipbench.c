@@ -0,0 +1,447 @@
+// A check of the clipboard snapshot (src/clipsave.c) against a fake in-memory clipboard
+// backend, which acts as the Windows clipboard does: the text and the bitmap formats
+// synthesized from one another, bitmaps as objects that only the system can duplicate,
+// delayed rendering (the formats an app has only promised take it a while to render),
+// the owner told when the clipboard is emptied. For each kind of contents, a translation
+// is played through it (the snapshot taken, the target app's copy, kbsw's translated
+// text, the paste, the restore) and checked for
+//   - the contents coming back whole, the synthesized formats with them, but for what
+//     is over the budgets: of the bytes copied, and of the time spent retaining;
+//   - nothing retained twice: a snapshot still on offer carried over to the next one;
+//   - the formats rendered when asked for, the retained data handed over, not copied;
+//   - the snapshot released once another app owns the clipboard, or rendered on exit;
+//   - no data left behind;
+// and the bytes kbsw copies to do it are measured, next to what the eager deep copy it
+// replaces (all the memory formats, synthesized ones too, up to 8 MB; no bitmaps) did.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o clipbench clipbench.c ../src/clipsave.c
+//
+// clipbench
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "clipsave.h"
+#include "check.h"
+
+// the formats, numbered as on Windows
+enum
+{
+	F_TEXT    = 1,        // synthesized from F_UNICODE
+	F_BITMAP  = 2,        // an object
+	F_DIB     = 8,        // synthesized from F_BITMAP, and the other way round
+	F_UNICODE = 13,
+	F_PRIVATE = 0x200,    // not preservable
+	F_HTML    = 0xC001,
+	F_PNG     = 0xC002,
+	F_BROKEN  = 0xC003,   // can't be retained
+	F_OFFICE  = 0xC100,   // ... and on, an office app's
+};
+
+enum { KBSW = 1, USER_APP, TARGET_APP, OTHER_APP };
+
+enum { MAX_SLOTS = 48 };
+
+typedef struct
+{
+	bool      object;         // duplicated by the system only
+	size_t    size;
+	uint8_t*  bytes;
+} Blob;
+
+typedef struct
+{
+	ClipFormat  format;
+	Blob*       data;         // NULL if promised (delayed rendering), or not synthesized yet
+	bool        synthesized;
+	uint32_t    render_ms;    // promised by the user's app: for it to render, when first asked for
+} Slot;
+
+typedef struct
+{
+	int            owner;
+	Slot           slots [MAX_SLOTS];
+	size_t         count;
+	ClipSnapshot*  snap;      // kbsw's: WM_RENDERFORMAT, WM_DESTROYCLIPBOARD
+
+	unsigned       live;            // blobs allocated
+	uint64_t       system_bytes;    // duplicated by the system, not by kbsw
+	unsigned       renders;
+	uint32_t       now_ms;
+} FakeClipboard;
+
+static FakeClipboard gClip;
+
+static Blob* NewBlob( bool object, size_t size )
+{
+	Blob* b = malloc(sizeof(Blob));
+	b->object = object;
+	b->size = size;
+	b->bytes = malloc(size ? size : 1);
+	++gClip.live;
+	return b;
+}
+
+static void FreeBlob( Blob* b )
+{
+	free(b->bytes);
+	free(b);
+	--gClip.live;
+}
+
+static Blob* Pattern( bool object, size_t size, unsigned seed )
+{
+	Blob* b = NewBlob(object, size);
+	for( size_t i = 0; i < size; ++i )  b->bytes[i] = (uint8_t)(seed + i * 31 + (i >> 12));
+	return b;
+}
+
+static bool MatchesPattern( const Blob* b, size_t size, unsigned seed )
+{
+	if( (b == NULL) || (b->size != size) )  return false;
+	for( size_t i = 0; i < size; ++i )  if( b->bytes[i] != (uint8_t)(seed + i * 31 + (i >> 12)) )  return false;
+	return true;
+}
+
+static int Family( ClipFormat format )
+{
+	return ((format == F_UNICODE) || (format == F_TEXT)) ? 1 : ((format == F_BITMAP) || (format == F_DIB)) ? 2 : 0;
+}
+
+static Slot* FindSlot( ClipFormat format )
+{
+	for( size_t i = 0; i < gClip.count; ++i )  if( gClip.slots[i].format == format )  return &gClip.slots[i];
+	return NULL;
+}
+
+// EmptyClipboard: the previous owner is told (kbsw's window gets WM_DESTROYCLIPBOARD)
+static void Empty( int by )
+{
+	if( gClip.owner == KBSW )  ClipSnapshotOwnershipLost(gClip.snap);
+	for( size_t i = 0; i < gClip.count; ++i )  if( gClip.slots[i].data )  FreeBlob(gClip.slots[i].data);
+	gClip.count = 0;
+	gClip.owner = by;
+}
+
+static void Put( ClipFormat format, Blob* data )
+{
+	gClip.slots[gClip.count++] = (Slot){ format, data, false };
+}
+
+// the formats the system lists after the ones put, as it can make them up from those
+static void AddSynthesized( void )
+{
+	size_t n = gClip.count;
+	for( size_t i = 0; i < n; ++i )
+	{
+		ClipFormat other = (gClip.slots[i].format == F_UNICODE) ? F_TEXT : (gClip.slots[i].format == F_BITMAP) ? F_DIB
+		                 : (gClip.slots[i].format == F_DIB) ? F_BITMAP : 0;
+		if( other && !FindSlot(other) )  gClip.slots[gClip.count++] = (Slot){ other, NULL, true };
+	}
+}
+
+// GetClipboardData
+static Blob* Get( ClipFormat format )
+{
+	Slot* s = FindSlot(format);
+	if( s == NULL )  return NULL;
+	gClip.now_ms += s->render_ms;
+	s->render_ms = 0;
+	if( s->data )  return s->data;
+
+	if( !s->synthesized )
+	{
+		// promised: the owner is asked to render it
+		if( gClip.owner == KBSW )  ++gClip.renders, ClipSnapshotRender(gClip.snap, format);
+		return s->data;
+	}
+
+	// made up from the format it comes from, and kept
+	for( size_t i = 0; i < gClip.count; ++i )
+	{
+		Slot* from = &gClip.slots[i];
+		if( from->synthesized || (Family(from->format) != Family(format)) )  continue;
+		Blob* original = Get(from->format);
+		if( original == NULL )  return NULL;
+		size_t size = (format == F_TEXT) ? original->size / 2 : original->size;
+		s->data = NewBlob(format == F_BITMAP, size);
+		for( size_t k = 0; k < size; ++k )  s->data->bytes[k] = original->bytes[(format == F_TEXT) ? 2 * k : k];
+		return s->data;
+	}
+	return NULL;
+}
+
+// ---- the backend ----
+
+static bool FakeOpen( void* _ )   { return true; }
+static void FakeClose( void* _ )  {}
+
+static size_t FakeListFormats( void* _, ClipFormat* formats, size_t max )
+{
+	for( size_t i = 0; (i < gClip.count) && (i < max); ++i )  formats[i] = gClip.slots[i].format;
+	return gClip.count;
+}
+
+// as clipsave_win.c: the synthesized formats are listed after the one they are made from
+static bool FakeIsPreservable( void* _, ClipFormat format, const ClipFormat* formats, size_t nformats )
+{
+	if( format == F_PRIVATE )  return false;
+	int family = Family(format);
+	for( size_t i = 0; family && (i < nformats) && (formats[i] != format); ++i )
+		if( Family(formats[i]) == family )  return false;
+	return true;
+}
+
+static ClipHandle FakeRetain( void* _, ClipFormat format, size_t max_copy, size_t* pcopied )
+{
+	*pcopied = 0;
+	Blob* b = (format == F_BROKEN) ? NULL : Get(format);
+	if( (b == NULL) || (!b->object && (b->size > max_copy)) )  return 0;
+
+	Blob* copy = NewBlob(b->object, b->size);
+	memcpy(copy->bytes, b->bytes, b->size);
+	if( b->object )  gClip.system_bytes += b->size;
+	else *pcopied = b->size;
+	return (ClipHandle)copy;
+}
+
+static void FakeRelease( void* _, ClipFormat format, ClipHandle data )
+{
+	FreeBlob((Blob*)data);
+}
+
+static bool FakeOffer( void* _, const ClipFormat* formats, size_t nformats )
+{
+	Empty(KBSW);
+	for( size_t i = 0; i < nformats; ++i )  Put(formats[i], NULL);
+	AddSynthesized();
+	return true;
+}
+
+static bool FakeRender( void* _, ClipFormat format, ClipHandle data )
+{
+	Slot* s = FindSlot(format);
+	if( (s == NULL) || s->data )  return false;
+	s->data = (Blob*)data;
+	return true;
+}
+
+static uint32_t FakeNow( void* _ )
+{
+	return gClip.now_ms;
+}
+
+// ---- the scenarios ----
+
+// as mojibake.c
+enum
+{
+	BUDGET    = 16 * 1024 * 1024,
+	BUDGET_ms = 100,
+};
+
+typedef struct
+{
+	ClipFormat  format;
+	bool        object;
+	size_t      size;
+	bool        lost;         // expected to be over the budgets
+	uint32_t    render_ms;    // promised: for the app to render
+} Content;
+
+// what the user has copied
+static void UserCopies( const Content* contents, size_t n, unsigned seed )
+{
+	Empty(USER_APP);
+	for( size_t i = 0; i < n; ++i )
+	{
+		Put(contents[i].format, Pattern(contents[i].object, contents[i].size, seed + i));
+		gClip.slots[gClip.count - 1].render_ms = contents[i].render_ms;
+	}
+	AddSynthesized();
+}
+
+static void SetText( int by, const char* text )
+{
+	Empty(by);
+	Blob* b = NewBlob(false, 2 * strlen(text) + 2);
+	for( size_t i = 0; i <= strlen(text); ++i )  b->bytes[2 * i] = text[i], b->bytes[2 * i + 1] = 0;
+	Put(F_UNICODE, b);
+	AddSynthesized();
+}
+
+// a selection translation, as mojibake.c does it with --keep-clip
+static void Translate( void )
+{
+	ClipSnapshotTake(gClip.snap);       // HostPostCopy
+	SetText(TARGET_APP, "ghbdtn");      // the target app's Ctrl+C
+	SetText(KBSW, "privet");            // TranslateClipboard
+	Get(F_UNICODE);                     // the paste
+	ClipSnapshotRestore(gClip.snap);    // RESTORE_DELAY_ms later
+}
+
+// the clipboard holds `contents` again, rendering what is asked for, but for what wasn't kept
+static bool Restored( const Content* contents, size_t n, unsigned seed )
+{
+	for( size_t i = 0; i < n; ++i )
+	{
+		if( (contents[i].format == F_PRIVATE) || (contents[i].format == F_BROKEN) )  continue;
+		if( contents[i].lost )
+		{
+			if( Get(contents[i].format) )  return false;
+			continue;
+		}
+		if( !MatchesPattern(Get(contents[i].format), contents[i].size, seed + i) )  return false;
+		if( (contents[i].format == F_UNICODE) && !Get(F_TEXT) )  return false;
+		if( (contents[i].format == F_BITMAP) && !Get(F_DIB) )  return false;
+	}
+	return true;
+}
+
+// every blob is on the clipboard or retained by the snapshot
+static bool NoneLeft( void )
+{
+	unsigned n = 0;
+	for( size_t i = 0; i < gClip.count; ++i )  n += (gClip.slots[i].data != NULL);
+	for( size_t i = 0; i < gClip.snap->count; ++i )  n += (gClip.snap->items[i].data != 0);
+	return gClip.live == n;
+}
+
+// what the eager deep copy did: the memory formats that fit in 8 MB (synthesized or
+// not, but for the text ones), copied in, and copied out again when rendered; no objects
+static uint64_t EagerBytes( const Content* contents, size_t n, unsigned* plost )
+{
+	const size_t budget = 8 * 1024 * 1024;
+	uint64_t total = 0;
+	*plost = 0;
+	for( size_t i = 0; i < gClip.count; ++i )
+	{
+		const Slot* s = &gClip.slots[i];
+		if( (s->format == F_TEXT) || (s->format == F_PRIVATE) )  continue;
+		size_t size = 0;
+		for( size_t k = 0; k < n; ++k )  if( contents[k].format == s->format )  size = contents[k].size;
+		if( (s->format == F_DIB) || (s->format == F_BITMAP) )
+			for( size_t k = 0; k < n; ++k )  if( Family(contents[k].format) == 2 )  size = contents[k].size;
+		bool object = (s->format == F_BITMAP);
+		if( !object && (total + size <= budget) )  total += size;
+		else *plost += !s->synthesized;
+	}
+	return 2 * total;
+}
+
+static void Report( const char* name, const Content* contents, size_t n, uint64_t copied, uint64_t system,
+                    unsigned skipped, uint32_t spent_ms )
+{
+	unsigned lost;
+	UserCopies(contents, n, 0);
+	uint64_t eager = EagerBytes(contents, n, &lost);
+	printf("%-34s kbsw copied %10llu bytes (the system %10llu), %2u formats lost, in %3u ms; "
+	       "the eager copy: %10llu bytes, %u formats lost\n", name, (unsigned long long)copied,
+	       (unsigned long long)system, skipped, spent_ms, (unsigned long long)eager, lost);
+}
+
+// a translation over `contents`, then a paste of all of them, then another app's copy
+static bool Scenario( const char* name, const Content* contents, size_t n, uint64_t expect_copied )
+{
+	static ClipSnapshot snap;
+	const ClipBackend backend = { FakeOpen, FakeClose, FakeListFormats, FakeIsPreservable, FakeRetain, FakeRelease,
+	                              FakeOffer, FakeRender, FakeNow, NULL };
+	ClipSnapshotInit(&snap, &backend, BUDGET, BUDGET_ms);
+	gClip.snap = &snap;
+
+	unsigned lost = 0;
+	uint32_t slowest_ms = 0;
+	for( size_t i = 0; i < n; ++i )
+	{
+		lost += contents[i].lost;
+		if( contents[i].render_ms > slowest_ms )  slowest_ms = contents[i].render_ms;
+	}
+
+	UserCopies(contents, n, 7);
+	uint64_t system0 = gClip.system_bytes;
+	uint32_t start_ms = gClip.now_ms;
+	Translate();
+	uint32_t spent_ms = gClip.now_ms - start_ms;
+	uint64_t copied = snap.bytes_copied;
+	bool ok = Restored(contents, n, 7) && (snap.bytes_copied == copied) && (snap.formats_skipped == lost) && NoneLeft();
+	Empty(OTHER_APP);
+	ok = ok && (snap.count == 0) && NoneLeft();
+	// given up on once out of time: no later than the end of the render in progress then
+	ok = ok && (spent_ms < BUDGET_ms + slowest_ms);
+
+	char what [160];
+	snprintf(what, sizeof(what), "%s: restored %s, %llu bytes copied, in %u ms", name,
+	         lost ? "but for what is over the budgets" : "whole", (unsigned long long)copied, spent_ms);
+	Check(ok && (copied == expect_copied), what);
+	Report(name, contents, n, copied, gClip.system_bytes - system0, snap.formats_skipped, spent_ms);
+	Empty(OTHER_APP);
+	return ok;
+}
+
+int main( int argc, char* argv [] )
+{
+	if( argc > 1 )  return fprintf(stderr, "usage: clipbench\n"), 2;
+
+	const Content text [] = { { F_UNICODE, false, 2000 }, { F_HTML, false, 10000 }, { F_PRIVATE, false, 100 } };
+	Scenario("text and HTML", text, 3, 12000);
+
+	// PrintScreen: a bitmap, the DIB made up from it
+	const Content screenshot [] = { { F_BITMAP, true, 3840 * 2160 * 4 } };
+	Scenario("a 4K screenshot (a bitmap)", screenshot, 1, 0);
+
+	// an image copied from a browser
+	const Content image [] = { { F_DIB, false, 1920 * 1080 * 4 }, { F_PNG, false, 3 * 1024 * 1024 }, { F_HTML, false, 300 } };
+	Scenario("an image (a DIB, a PNG, HTML)", image, 3, 1920 * 1080 * 4 + 3 * 1024 * 1024 + 300);
+
+	const Content large [] = { { F_PNG, false, 40 * 1024 * 1024, true }, { F_HTML, false, 300 } };
+	Scenario("a 40 MB PNG", large, 2, 300);
+
+	// cells from a spreadsheet: dozens of formats, only promised, each rendered in 10 ms
+	Content cells [24];
+	for( unsigned i = 0; i < 24; ++i )  cells[i] = (Content){ F_OFFICE + i, false, 20000, i >= BUDGET_ms / 10, 10 };
+	Scenario("spreadsheet cells (24 promised)", cells, 24, (BUDGET_ms / 10) * 20000);
+
+	// the details, on text and a screenshot
+	static ClipSnapshot snap;
+	const ClipBackend backend = { FakeOpen, FakeClose, FakeListFormats, FakeIsPreservable, FakeRetain, FakeRelease,
+	                              FakeOffer, FakeRender, FakeNow, NULL };
+	ClipSnapshotInit(&snap, &backend, BUDGET, BUDGET_ms);
+	gClip.snap = &snap;
+	const Content mixed [] = { { F_UNICODE, false, 2000 }, { F_HTML, false, 10000 }, { F_BITMAP, true, 640 * 480 * 4 },
+	                           { F_BROKEN, false, 10 } };
+	UserCopies(mixed, 4, 3);
+	gClip.renders = 0;
+
+	Translate();
+	bool ok = (snap.count == 3) && (snap.formats_skipped == 1) && (snap.bytes_copied == 12000) && (gClip.renders == 0);
+	Check(ok, "restored: the formats promised, none rendered yet, the one that can't be retained counted");
+
+	Translate();
+	ok = (snap.bytes_copied == 12000) && (snap.formats_carried == 3) && (gClip.renders == 0) && NoneLeft();
+	Check(ok, "another translation while on offer: carried over, nothing copied or rendered");
+
+	Blob* retained = (Blob*)snap.items[1].data;
+	ok = (Get(F_HTML) == retained) && (gClip.renders == 1) && (snap.items[1].data == 0) && (snap.bytes_copied == 12000);
+	Check(ok, "a paste: the format rendered, the retained data handed over as it is");
+
+	Translate();
+	ok = (snap.bytes_copied == 22000) && (snap.formats_carried == 5) && Restored(mixed, 3, 3) && NoneLeft();
+	Check(ok, "a translation after a paste: only the format rendered retained again");
+
+	Translate();
+	ClipSnapshotRenderAll(&snap);
+	unsigned renders = gClip.renders;
+	ok = (snap.count == 3) && (snap.items[0].data == 0) && (snap.items[1].data == 0) && (snap.items[2].data == 0);
+	ok = ok && Restored(mixed, 3, 3) && (gClip.renders == renders) && NoneLeft();
+	Check(ok, "exiting while on offer: all rendered, the contents outlive kbsw");
+
+	Translate();
+	SetText(OTHER_APP, "something else");
+	Check((snap.count == 0) && !snap.taken && NoneLeft(), "another app copies: the snapshot released");
+
+	Empty(OTHER_APP);
+	Check(gClip.live == 0, "nothing left behind");
+	return gFailed;
+}
@@ -0,0 +1,366 @@
+// A test daemon for the control channel on POSIX (src/control_posix.c, src/control.c),
+// and a check and benchmark of it: serves requests as kbsw would, with a made-up state,
+// and checks them from the client side:
+//   - the commands, their replies and their result codes;
+//   - a client that connects and says nothing, or stops halfway through a request, only
+//     holds up the others for a while;
+//   - the server stops at once, with such a client connected;
+//   - a second server does not start while one is running;
+//   - the socket is the user's only, and (when run as root) a client of another user is
+//     turned away, and does not talk to the server either;
+// then measures the round trips, each on a connection of its own, as the clients do.
+//
+// The socket is put in a directory of its own, as $XDG_RUNTIME_DIR, unless --daemon.
+// --daemon only serves, until a ctlQuit; --client only checks and measures one that is
+// already running (ctlbench --daemon, in the same $XDG_RUNTIME_DIR), then tells it to quit.
+//
+// gcc -std=c11 -Wall -Werror -O2 -pthread -I../src -o ctlbench ctlbench.c ../src/control.c
+//     ../src/control_posix.c
+//
+// ctlbench [--rounds=N] [--daemon | --client]
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "control.h"
+#include "common.h"
+#include "check.h"
+
+static const char kCommandLine [] = "ctlbench --daemon";
+
+static atomic_bool  gPaused, gQuit;
+static atomic_uint  gRequests;
+static time_t       gStarted;
+
+// ---- the daemon -------------------------------------------------------------
+
+CtlResult AppControlRequest( CtlCommand cmd, const uint8_t* payload, size_t length,
+                             uint8_t* reply, size_t* preply_length )
+{
+	unsigned requests = atomic_fetch_add(&gRequests, 1) + 1;
+	*preply_length = 0;
+	switch( cmd )
+	{
+		case ctlStatus:
+		{
+			CtlStatus st = { (uint32_t)getpid(), atomic_load(&gPaused) ? CTL_STATUS_PAUSED : 0,
+			                 (uint32_t)(time(NULL) - gStarted) };
+			CtlStatusEncode(reply, &st);
+			memcpy(reply + CTL_STATUS_SIZE, kCommandLine, sizeof(kCommandLine) - 1);
+			*preply_length = CTL_STATUS_SIZE + sizeof(kCommandLine) - 1;
+			return ctlOk;
+		}
+
+		case ctlMetrics:
+			CtlPutU32(reply, CTL_METRICS_COUNT);
+			for( unsigned i = 0; i < CTL_METRICS_COUNT; ++i )  CtlPutU64(reply + 4 + 8 * i, 1000 * i + requests);
+			*preply_length = 4 + 8 * CTL_METRICS_COUNT;
+			return ctlOk;
+
+		case ctlPause:
+		case ctlResume:
+			atomic_store(&gPaused, cmd == ctlPause);
+			return ctlOk;
+
+		case ctlReconfigure:
+		{
+			// the arguments are NUL-terminated; "--fail" among them fails it
+			unsigned count = 0;
+			for( size_t i = 0; i < length; i += strlen((const char*)payload + i) + 1 )
+			{
+				if( memchr(payload + i, 0, length - i) == NULL )  return ctlErrProtocol;
+				if( strcmp((const char*)payload + i, "--fail") == 0 )  return ctlErrFailed;
+				++count;
+			}
+			CtlPutU32(reply, count);
+			*preply_length = 4;
+			return ctlOk;
+		}
+
+		case ctlQuit:
+			atomic_store(&gQuit, true);
+			return ctlOk;
+
+		case ctlTrace:
+			CtlPutU32(reply, 0);
+			*preply_length = 4;
+			return ctlOk;
+	}
+	return ctlErrUnknown;
+}
+
+// -----------------------------------------------------------------------------
+
+static uint64_t Now_us( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static const char* SocketPath( void )
+{
+	static char path [sizeof(((struct sockaddr_un*)0)->sun_path)];
+	snprintf(path, sizeof(path), "%s/kbsw.sock", getenv("XDG_RUNTIME_DIR"));
+	return path;
+}
+
+// a client that connects, writes `length` bytes of a request and then keeps quiet
+static int Connect( const void* request, size_t length )
+{
+	struct sockaddr_un addr = { .sun_family = AF_UNIX };
+	snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", SocketPath());
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if( (fd < 0) || (connect(fd, (const struct sockaddr*)&addr, sizeof(addr)) != 0) )
+	{
+		if( fd >= 0 )  close(fd);
+		return -1;
+	}
+	if( length && (send(fd, request, length, MSG_NOSIGNAL) != (ssize_t)length) )
+	{
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+static bool Status( CtlStatus* pst, size_t* preply_length, uint8_t* reply )
+{
+	CtlResult rc;
+	if( !ControlCall(ctlStatus, NULL, 0, &rc, reply, preply_length) || (rc != ctlOk)
+	 || (*preply_length < CTL_STATUS_SIZE) )
+		return false;
+	CtlStatusDecode(reply, pst);
+	return true;
+}
+
+static void CheckCommands( pid_t daemon )
+{
+	static uint8_t reply [CTL_MAX_PAYLOAD];
+	size_t n;
+	CtlResult rc;
+	CtlStatus st;
+
+	bool ok = Status(&st, &n, reply);
+	Check(ok && (st.pid == (uint32_t)daemon) && (n == CTL_STATUS_SIZE + sizeof(kCommandLine) - 1)
+	      && (memcmp(reply + CTL_STATUS_SIZE, kCommandLine, n - CTL_STATUS_SIZE) == 0),
+	      "status: the pid and the command line of the daemon");
+
+	ok = ControlCall(ctlPause, NULL, 0, &rc, reply, &n) && (rc == ctlOk) && Status(&st, &n, reply)
+	  && (st.flags & CTL_STATUS_PAUSED);
+	ok = ok && ControlCall(ctlResume, NULL, 0, &rc, reply, &n) && (rc == ctlOk) && Status(&st, &n, reply)
+	  && !(st.flags & CTL_STATUS_PAUSED);
+	Check(ok, "pause and resume: seen in the status");
+
+	ok = ControlCall(ctlMetrics, NULL, 0, &rc, reply, &n) && (rc == ctlOk) && (n == 4 + 8 * CTL_METRICS_COUNT)
+	  && (CtlGetU32(reply) == CTL_METRICS_COUNT) && (CtlGetU64(reply + 4 + 8) - CtlGetU64(reply + 4) == 1000);
+	Check(ok, "metrics: all of them");
+
+	static const char args [] = "--layouts\0001033\0--per-app";
+	ok = ControlCall(ctlReconfigure, args, sizeof(args), &rc, reply, &n) && (rc == ctlOk) && (n == 4)
+	  && (CtlGetU32(reply) == 3);
+	static const char failing [] = "--layouts\0--fail";
+	ok = ok && ControlCall(ctlReconfigure, failing, sizeof(failing), &rc, reply, &n) && (rc == ctlErrFailed);
+	Check(ok, "reconfigure: the arguments, and a failure");
+
+	ok = ControlCall((CtlCommand)(CTL_COMMAND_LAST + 1), NULL, 0, &rc, reply, &n) && (rc == ctlErrUnknown);
+	Check(ok, "an unknown command: ctlErrUnknown");
+
+	static uint8_t big [CTL_MAX_PAYLOAD + 1];
+	Check(!ControlCall(ctlReconfigure, big, sizeof(big), &rc, reply, &n), "an oversized request: not sent");
+}
+
+// clients that keep quiet hold the server up, but not for long
+static void CheckQuietClients( void )
+{
+	static uint8_t reply [CTL_MAX_PAYLOAD];
+	uint8_t header [CTL_HEADER_SIZE];
+	size_t n = CtlEncode(header, sizeof(header), ctlStatus, 1, NULL, 0);
+	CtlStatus st;
+
+	int quiet = Connect(NULL, 0);
+	uint64_t t0 = Now_us();
+	bool ok = (quiet >= 0) && Status(&st, &n, reply);
+	uint64_t waited_us = Now_us() - t0;
+	char what [128];
+	snprintf(what, sizeof(what), "a client that says nothing: the next one served after %.0f ms",
+	         waited_us / 1000.0);
+	Check(ok, what);
+	if( quiet >= 0 )  close(quiet);
+
+	int halfway = Connect(header, 5);
+	t0 = Now_us();
+	ok = (halfway >= 0) && Status(&st, &n, reply);
+	waited_us = Now_us() - t0;
+	snprintf(what, sizeof(what), "a client that stops halfway: the next one served after %.0f ms",
+	         waited_us / 1000.0);
+	Check(ok, what);
+	if( halfway >= 0 )  close(halfway);
+}
+
+static void CheckStop( void )
+{
+	static uint8_t reply [CTL_MAX_PAYLOAD];
+	size_t n;
+	CtlStatus st;
+
+	Check(!ControlServerStart(), "a second server: not started");
+
+	// make sure the server is serving it, and not still waiting for it
+	int quiet = Connect(NULL, 0);
+	usleep(20000);
+	uint64_t t0 = Now_us();
+	ControlServerStop();
+	uint64_t stop_us = Now_us() - t0;
+	char what [128];
+	snprintf(what, sizeof(what), "stopped in %.1f ms, with a client that says nothing", stop_us / 1000.0);
+	Check((quiet >= 0) && (stop_us < 100000), what);
+	if( quiet >= 0 )  close(quiet);
+
+	struct stat sb;
+	Check(!Status(&st, &n, reply) && (stat(SocketPath(), &sb) != 0), "stopped: no server, no socket");
+
+	Check(ControlServerStart() && Status(&st, &n, reply), "started again");
+}
+
+static void CheckOwner( void )
+{
+	struct stat sb;
+	Check((stat(SocketPath(), &sb) == 0) && S_ISSOCK(sb.st_mode) && ((sb.st_mode & 0777) == 0600)
+	      && (sb.st_uid == getuid()), "the socket: the user's only");
+
+	if( getuid() != 0 )
+		return (void) printf("skip a client of another user: not run as root\n");
+
+	// let another user get at the socket, to see it turned away by the server itself
+	char dir [sizeof(((struct sockaddr_un*)0)->sun_path)];
+	snprintf(dir, sizeof(dir), "%s", getenv("XDG_RUNTIME_DIR"));
+	chmod(dir, 0711);
+	chmod(SocketPath(), 0666);
+
+	pid_t child = fork();
+	if( child == 0 )
+	{
+		if( setgid(65534) != 0 || setuid(65534) != 0 )  _exit(3);
+		static uint8_t reply [CTL_MAX_PAYLOAD];
+		uint8_t request [CTL_HEADER_SIZE];
+		size_t n = CtlEncode(request, sizeof(request), ctlStatus, 1, NULL, 0);
+		// the server may hang up before the request is even written
+		int fd = Connect(NULL, 0);
+		bool served = (fd >= 0) && (send(fd, request, n, MSG_NOSIGNAL) == (ssize_t)n)
+		           && (recv(fd, reply, sizeof(reply), 0) > 0);
+		if( fd >= 0 )  close(fd);
+		CtlResult rc;
+		bool called = ControlCall(ctlStatus, NULL, 0, &rc, reply, &n);
+		_exit((fd < 0) ? 4 : (served ? 1 : 0) | (called ? 2 : 0));
+	}
+	int status = -1;
+	if( child > 0 )  waitpid(child, &status, 0);
+	chmod(SocketPath(), 0600);
+	chmod(dir, 0700);
+
+	int code = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+	Check((code == 0) || (code == 2), "a client of another user: not served");
+	Check((code == 0) || (code == 1), "a server of another user: not talked to");
+}
+
+static int CompareU64( const void* a, const void* b )
+{
+	uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+	return (x > y) - (x < y);
+}
+
+static void Measure( CtlCommand cmd, const char* name, unsigned rounds )
+{
+	static uint8_t reply [CTL_MAX_PAYLOAD];
+	uint64_t* us = malloc(rounds * sizeof(*us));
+	unsigned failed = 0;
+	for( unsigned i = 0; i < rounds; ++i )
+	{
+		size_t n;
+		CtlResult rc;
+		uint64_t t0 = Now_us();
+		if( !ControlCall(cmd, NULL, 0, &rc, reply, &n) || (rc != ctlOk) )  ++failed;
+		us[i] = Now_us() - t0;
+	}
+	qsort(us, rounds, sizeof(*us), CompareU64);
+
+	char what [160];
+	snprintf(what, sizeof(what), "%u round trips of %s: median %llu us, p99 %llu us, max %llu us", rounds, name,
+	         (unsigned long long)us[rounds / 2], (unsigned long long)us[rounds * 99 / 100],
+	         (unsigned long long)us[rounds - 1]);
+	Check(failed == 0, what);
+	free(us);
+}
+
+int main( int argc, char* argv [] )
+{
+	unsigned rounds = 2000;
+	bool daemon = false, client = false;
+	for( int i = 1; i < argc; ++i )
+	{
+		if( strncmp(argv[i], "--rounds=", 9) == 0 && (rounds = strtoul(argv[i] + 9, NULL, 10)) > 0 )  continue;
+		if( strcmp(argv[i], "--daemon") == 0 )  { daemon = true; continue; }
+		if( strcmp(argv[i], "--client") == 0 )  { client = true; continue; }
+		fprintf(stderr, "usage: ctlbench [--rounds=N] [--daemon | --client]\n");
+		return 2;
+	}
+
+	char dir [] = "/tmp/ctlbench-XXXXXX";
+	if( !daemon && !client )
+	{
+		if( mkdtemp(dir) == NULL )  return printf("FAIL mkdtemp: %s\n", strerror(errno)), 1;
+		setenv("XDG_RUNTIME_DIR", dir, 1);
+	}
+
+	gStarted = time(NULL);
+	if( !client && !ControlServerStart() )  return printf("FAIL the server has not started\n"), 1;
+
+	if( daemon )
+	{
+		printf("serving on %s, until a ctlQuit\n", SocketPath());
+		while( !atomic_load(&gQuit) )  usleep(10000);
+		ControlServerStop();
+		return 0;
+	}
+
+	static uint8_t reply [CTL_MAX_PAYLOAD];
+	size_t n;
+	CtlStatus st;
+	if( !Status(&st, &n, reply) )  return printf("FAIL no daemon on %s\n", SocketPath()), 1;
+
+	CheckCommands(client ? (pid_t)st.pid : getpid());
+	CheckQuietClients();
+	if( !client )
+	{
+		CheckStop();
+		CheckOwner();
+	}
+	Measure(ctlStatus, "ctlStatus", rounds);
+	Measure(ctlMetrics, "ctlMetrics", rounds);
+
+	if( client )
+	{
+		CtlResult rc;
+		bool ok = ControlCall(ctlQuit, NULL, 0, &rc, reply, &n) && (rc == ctlOk);
+		for( int i = 0; ok && (i < 100) && Status(&st, &n, reply); ++i )  usleep(10000);
+		Check(ok && !Status(&st, &n, reply), "quit: the daemon is gone");
+	}
+	else
+	{
+		ControlServerStop();
+		rmdir(dir);
+	}
+	return gFailed;
+}
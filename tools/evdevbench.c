@@ -0,0 +1,459 @@
+// Checks the evdev input of Linux (src/evdev.c) and measures it, with no input devices:
+// the events go through pipes, FIFOs and files, as a recorded trace would.
+//   - the double taps, with the modifiers, the autorepeats, the injected events and the
+//     other keys, events split at every byte between writes, SYN_DROPPED, the end of a
+//     pipe and a regular file, a modifier held on one keyboard while another resyncs;
+//   - a long trace of typing with double taps in it, written into a FIFO by another
+//     thread as fast as it goes: the events per second;
+//   - the same at the pace of typing: the wake-ups per keystroke.
+// With FILEs (or FIFOs, or devices) of recorded input_events, reads them and reports what
+// it has found in them.
+//
+// gcc -std=c11 -Wall -Werror -O2 -pthread -I../src -o evdevbench evdevbench.c ../src/evdev.c
+//     ../src/tapdetect.c
+//
+// evdevbench [--keystrokes=N] [--paced=N] [--pace=US] [FILE...]
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include "evdev.h"
+#include "common.h"
+#include "check.h"
+
+static double Seconds( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned long* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+static uint64_t gRng = 1;
+
+static uint32_t Random( uint32_t n )
+{
+	// xorshift64*
+	gRng ^= gRng >> 12;
+	gRng ^= gRng << 25;
+	gRng ^= gRng >> 27;
+	return (uint32_t)((gRng * 0x2545F4914F6CDD1DULL) >> 32) % n;
+}
+
+// ---- the host ---------------------------------------------------------------
+
+typedef struct
+{
+	unsigned  activations;
+	unsigned  last_index;
+	bool      last_modifier;
+} Activations;
+
+static void OnActivate( void* ctx, unsigned index, bool any_modifier_pressed )
+{
+	Activations* a = ctx;
+	++a->activations;
+	a->last_index = index;
+	a->last_modifier = any_modifier_pressed;
+}
+
+static const EvdevConfig kConfig =
+{
+	.tap_timeout_ms = 300,
+	.nkeys = 3,
+	.codes = { KEY_LEFTCTRL, KEY_RIGHTCTRL, KEY_LEFTSHIFT },
+};
+
+static bool Open( EvdevReader* r, Activations* a )
+{
+	memset(a, 0, sizeof(*a));
+	const EvdevHost host = { OnActivate, a };
+	if( !EvdevInit(r, &host) )  return false;
+	EvdevConfigure(r, &kConfig);
+	return true;
+}
+
+// ---- the traces -------------------------------------------------------------
+
+typedef struct
+{
+	struct input_event*  events;
+	size_t    count, size;
+	uint64_t  time_us;
+	unsigned  expected;   // activations
+	unsigned  keystrokes;
+} Trace;
+
+static void Add( Trace* t, uint16_t type, uint16_t code, int32_t value )
+{
+	if( t->count == t->size )
+	{
+		t->size = t->size ? t->size * 2 : 256;
+		t->events = realloc(t->events, t->size * sizeof(t->events[0]));
+		if( t->events == NULL )  exit(1);
+	}
+	struct input_event* ev = &t->events[t->count++];
+	memset(ev, 0, sizeof(*ev));
+	ev->input_event_sec = t->time_us / 1000000;
+	ev->input_event_usec = t->time_us % 1000000;
+	ev->type = type;
+	ev->code = code;
+	ev->value = value;
+}
+
+// a key going down (1), up (0) or repeating (2) `ms` after the previous one, as a
+// keyboard reports it: the scan code, the key, the end of the report
+static void Key( Trace* t, unsigned ms, uint16_t code, int32_t value )
+{
+	t->time_us += ms * 1000;
+	Add(t, EV_MSC, MSC_SCAN, code);
+	Add(t, EV_KEY, code, value);
+	Add(t, EV_SYN, SYN_REPORT, 0);
+	t->keystrokes += (value == 1);
+}
+
+static void DoubleTap( Trace* t, uint16_t code, unsigned ms )
+{
+	Key(t, 400, code, 1);
+	Key(t, ms, code, 0);
+	Key(t, ms, code, 1);
+	Key(t, ms, code, 0);
+}
+
+static void Free( Trace* t )
+{
+	free(t->events);
+	memset(t, 0, sizeof(*t));
+}
+
+static bool WriteAll( int fd, const void* data, size_t size )
+{
+	for( const uint8_t* p = data; size > 0; )
+	{
+		ssize_t n = write(fd, p, size);
+		if( n < 0 && errno == EINTR )  continue;
+		if( n < 0 && errno == EAGAIN )  { usleep(100); continue; }
+		if( n <= 0 )  return false;
+		p += n;
+		size -= n;
+	}
+	return true;
+}
+
+// through a pipe, `chunk` bytes at a time (all at once if 0); the number of activations
+static unsigned Play( const Trace* t, size_t chunk, Activations* pa )
+{
+	EvdevReader r;
+	Activations a;
+	int fds [2];
+	if( !Open(&r, &a) || (pipe(fds) < 0) || !EvdevAddFd(&r, fds[0]) )  return ~0u;
+
+	const uint8_t* data = (const uint8_t*)t->events;
+	size_t size = t->count * sizeof(t->events[0]);
+	if( chunk == 0 )  chunk = size;
+	for( size_t done = 0; done < size; done += chunk )
+	{
+		size_t n = (size - done < chunk) ? size - done : chunk;
+		if( !WriteAll(fds[1], data + done, n) )  break;
+		EvdevWait(&r, 0);
+	}
+	close(fds[1]);
+	while( EvdevWait(&r, 1000) )  ;
+	EvdevClose(&r);
+	if( pa )  *pa = a;
+	return a.activations;
+}
+
+// ---- the checks -------------------------------------------------------------
+
+static void CheckNames( void )
+{
+	Check((EvdevKeyCode("LC", 2) == KEY_LEFTCTRL) && (EvdevKeyCode("LeftControl", 11) == KEY_LEFTCTRL)
+	      && (EvdevKeyCode("RW", 2) == KEY_RIGHTMETA) && (EvdevKeyCode("Caps", 4) == KEY_CAPSLOCK)
+	      && (EvdevKeyCode("SL", 2) == KEY_SCROLLLOCK) && (EvdevKeyCode("L", 1) == 0)
+	      && (EvdevKeyCode("LCt", 3) == 0) && (EvdevKeyCode("XX", 2) == 0),
+	      "the switch key names of the command line");
+}
+
+static void CheckTaps( void )
+{
+	Trace t = {0};
+	Activations a;
+
+	DoubleTap(&t, KEY_RIGHTCTRL, 60);
+	Check((Play(&t, 0, &a) == 1) && (a.last_index == 1) && !a.last_modifier, "a double tap");
+	Free(&t);
+
+	Key(&t, 10, KEY_LEFTALT, 1);
+	DoubleTap(&t, KEY_LEFTCTRL, 60);
+	Key(&t, 10, KEY_LEFTALT, 0);
+	Check((Play(&t, 0, &a) == 1) && (a.last_index == 0) && a.last_modifier, "... with a modifier held");
+	Free(&t);
+
+	DoubleTap(&t, KEY_LEFTSHIFT, 60);
+	Check((Play(&t, 0, &a) == 1) && (a.last_index == 2) && !a.last_modifier, "... of a modifier, which does not count");
+	Free(&t);
+
+	DoubleTap(&t, KEY_LEFTCTRL, 400);
+	Check(Play(&t, 0, NULL) == 0, "too slow");
+	Free(&t);
+
+	DoubleTap(&t, KEY_LEFTCTRL, 5);
+	Check(Play(&t, 0, NULL) == 0, "too fast: injected");
+	Free(&t);
+
+	Key(&t, 200, KEY_LEFTCTRL, 1);
+	Key(&t, 60, KEY_LEFTCTRL, 0);
+	Key(&t, 60, KEY_LEFTCTRL, 1);
+	Key(&t, 30, KEY_LEFTCTRL, 2);
+	Key(&t, 30, KEY_LEFTCTRL, 0);
+	Check(Play(&t, 0, NULL) == 0, "an autorepeat");
+	Free(&t);
+
+	Key(&t, 200, KEY_LEFTCTRL, 1);
+	Key(&t, 60, KEY_LEFTCTRL, 0);
+	Key(&t, 20, KEY_A, 1);
+	Key(&t, 20, KEY_A, 0);
+	Key(&t, 20, KEY_LEFTCTRL, 1);
+	Key(&t, 60, KEY_LEFTCTRL, 0);
+	Check(Play(&t, 0, NULL) == 0, "another key in between");
+	Free(&t);
+
+	// a press, then the kernel drops the rest of the report: the release goes with it,
+	// so the next press and release are only half of a double tap
+	Key(&t, 200, KEY_LEFTCTRL, 1);
+	Add(&t, EV_SYN, SYN_DROPPED, 0);
+	Add(&t, EV_KEY, KEY_LEFTCTRL, 0);
+	Add(&t, EV_SYN, SYN_REPORT, 0);
+	Key(&t, 60, KEY_LEFTCTRL, 1);
+	Key(&t, 60, KEY_LEFTCTRL, 0);
+	Check(Play(&t, 0, NULL) == 0, "SYN_DROPPED breaks the sequence ...");
+	DoubleTap(&t, KEY_LEFTCTRL, 60);
+	Check(Play(&t, 0, NULL) == 1, "... and the next one goes");
+	Free(&t);
+
+	// the same events however they are split between the reads
+	for( unsigned i = 0; i < 6; ++i )  DoubleTap(&t, (i & 1) ? KEY_LEFTCTRL : KEY_RIGHTCTRL, 50 + i * 10);
+	bool same = true;
+	for( size_t chunk = 1; chunk <= 2 * sizeof(struct input_event) + 1; ++chunk )
+		same &= (Play(&t, chunk, NULL) == 6);
+	Check(same, "events split at any byte between the writes");
+	Free(&t);
+}
+
+static void CheckEnds( void )
+{
+	EvdevReader r;
+	Activations a;
+	int fds [2];
+	bool ok = Open(&r, &a) && (pipe(fds) == 0) && EvdevAddFd(&r, fds[0]);
+	ok &= EvdevWait(&r, 0) && (r.nsources == 1);
+	close(fds[1]);
+	ok &= !EvdevWait(&r, 1000) && (r.nsources == 0) && !EvdevWait(&r, 0);
+	EvdevClose(&r);
+	Check(ok, "a pipe is read until its writer goes away");
+
+	Trace t = {0};
+	for( unsigned i = 0; i < 100; ++i )  DoubleTap(&t, KEY_RIGHTCTRL, 50);
+	char path [] = "/tmp/evdevbench-XXXXXX";
+	int fd = mkstemp(path);
+	ok = (fd >= 0) && WriteAll(fd, t.events, t.count * sizeof(t.events[0])) && (lseek(fd, 0, SEEK_SET) == 0);
+	unlink(path);
+	ok &= Open(&r, &a) && EvdevAddFd(&r, fd);
+	unsigned waits = 0;
+	while( EvdevWait(&r, 1000) )  ++waits;
+	EvdevClose(&r);
+	Check(ok && (a.activations == 100) && (waits == 0), "a regular file is read to its end at once");
+	Free(&t);
+
+	// Alt held on one keyboard, while another drops events, then has the double tap
+	Trace alt = {0};
+	Key(&alt, 10, KEY_LEFTALT, 1);
+	Key(&t, 200, KEY_A, 1);
+	Add(&t, EV_SYN, SYN_DROPPED, 0);
+	Add(&t, EV_SYN, SYN_REPORT, 0);
+	DoubleTap(&t, KEY_LEFTCTRL, 60);
+	int one [2], other [2];
+	ok = Open(&r, &a) && (pipe(one) == 0) && (pipe(other) == 0) && EvdevAddFd(&r, one[0]) && EvdevAddFd(&r, other[0])
+	  && WriteAll(one[1], alt.events, alt.count * sizeof(alt.events[0])) && EvdevWait(&r, 1000)
+	  && WriteAll(other[1], t.events, t.count * sizeof(t.events[0])) && EvdevWait(&r, 1000);
+	close(one[1]);
+	close(other[1]);
+	while( EvdevWait(&r, 1000) )  ;
+	EvdevClose(&r);
+	Check(ok && (a.activations == 1) && a.last_modifier, "a modifier held on another keyboard, through a resync");
+	Free(&alt);
+	Free(&t);
+}
+
+// ---- the load ---------------------------------------------------------------
+
+// words of letters with a clean double tap now and then, and a spoiled one
+static void MakeTyping( Trace* t, unsigned long keystrokes )
+{
+	gRng = 0x9E3779B97F4A7C15ULL;
+	while( t->keystrokes < keystrokes )
+	{
+		unsigned dice = Random(40);
+		if( dice == 0 )
+		{
+			DoubleTap(t, kConfig.codes[Random(kConfig.nkeys)], 40 + Random(100));
+			++t->expected;
+		}
+		else if( dice == 1 )
+		{
+			DoubleTap(t, kConfig.codes[Random(kConfig.nkeys)], 2 + Random(8));   // injected
+		}
+		else
+		{
+			uint16_t code = (dice == 2) ? KEY_SPACE : KEY_Q + Random(KEY_P - KEY_Q + 1);
+			Key(t, 30 + Random(150), code, 1);
+			Key(t, 20 + Random(80), code, 0);
+		}
+	}
+}
+
+typedef struct
+{
+	const Trace*  trace;
+	const char*   path;
+	unsigned long pace_us;   // between the keystrokes; 0: as fast as it goes
+} Writer;
+
+static void* WriterThread( void* arg )
+{
+	const Writer* w = arg;
+	int fd = open(w->path, O_WRONLY | O_CLOEXEC);
+	if( fd < 0 )  return NULL;
+	const struct input_event* ev = w->trace->events;
+	size_t count = w->trace->count;
+	if( w->pace_us == 0 )
+	{
+		WriteAll(fd, ev, count * sizeof(ev[0]));
+	}
+	else
+	{
+		// a report at a time, as the kernel hands them out
+		for( size_t i = 0, start = 0; i < count; ++i )
+		{
+			if( (ev[i].type != EV_SYN) || (ev[i].code != SYN_REPORT) )  continue;
+			WriteAll(fd, ev + start, (i + 1 - start) * sizeof(ev[0]));
+			start = i + 1;
+			if( (ev[i - 1].type == EV_KEY) && (ev[i - 1].value == 1) )  usleep(w->pace_us);
+		}
+	}
+	close(fd);
+	return NULL;
+}
+
+static void Load( const char* what, const Trace* t, unsigned long pace_us )
+{
+	char path [64];
+	snprintf(path, sizeof(path), "/tmp/evdevbench-%u.fifo", (unsigned)getpid());
+	unlink(path);
+	if( mkfifo(path, 0600) < 0 )
+	{
+		printf("FAIL mkfifo %s: %s\n", path, strerror(errno));
+		gFailed = true;
+		return;
+	}
+
+	EvdevReader r;
+	Activations a;
+	int fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+	bool ok = Open(&r, &a) && (fd >= 0) && EvdevAddFd(&r, fd);
+
+	Writer w = { t, path, pace_us };
+	pthread_t thread;
+	ok = ok && (pthread_create(&thread, NULL, WriterThread, &w) == 0);
+	// (until the writer opens the FIFO, there is nothing to read and no end of it either)
+
+	double started = Seconds();
+	while( ok && EvdevWait(&r, 1000) )  ;
+	double seconds = Seconds() - started;
+	if( ok )  pthread_join(thread, NULL);
+	unlink(path);
+	EvdevClose(&r);
+
+	char line [300];
+	snprintf(line, sizeof(line), "%s: %u keystrokes, %u activations as expected (%.0f events/s; "
+	         "%llu wake-ups, %.3f per keystroke; %llu reads)", what, t->keystrokes, t->expected,
+	         r.stats.events / seconds, (unsigned long long)r.stats.wakeups,
+	         (double)r.stats.wakeups / t->keystrokes, (unsigned long long)r.stats.reads);
+	Check(ok && (a.activations == t->expected) && (r.stats.events == t->count)
+	      && (r.stats.keystrokes == t->keystrokes), line);
+}
+
+// ---- the files --------------------------------------------------------------
+
+static void ReadTrace( const char* path )
+{
+	EvdevReader r;
+	Activations a;
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if( (fd < 0) || !Open(&r, &a) || !EvdevAddFd(&r, fd) )
+	{
+		printf("FAIL cannot read %s\n", path);
+		gFailed = true;
+		return;
+	}
+	double started = Seconds();
+	while( EvdevWait(&r, -1) )  ;
+	double seconds = Seconds() - started;
+	printf("%s: %llu events, %llu keystrokes, %llu double taps of LC/RC/LS, %llu reports dropped; "
+	       "%.3f wake-ups per keystroke, %.0f events/s\n",
+	       path, (unsigned long long)r.stats.events, (unsigned long long)r.stats.keystrokes,
+	       (unsigned long long)r.stats.activations, (unsigned long long)r.stats.dropped,
+	       r.stats.keystrokes ? (double)r.stats.wakeups / r.stats.keystrokes : 0.0,
+	       seconds > 0 ? r.stats.events / seconds : 0.0);
+	EvdevClose(&r);
+}
+
+int main( int argc, char* argv[] )
+{
+	unsigned long keystrokes = 300000, paced = 500, pace_us = 1000;
+	int first = 1;
+	for( ; (first < argc) && (argv[first][0] == '-'); ++first )
+	{
+		if( !ParseArg(argv[first], "--keystrokes", &keystrokes) && !ParseArg(argv[first], "--paced", &paced)
+		    && !ParseArg(argv[first], "--pace", &pace_us) )
+		{
+			fprintf(stderr, "usage: %s [--keystrokes=N] [--paced=N] [--pace=US] [FILE...]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	CheckNames();
+	CheckTaps();
+	CheckEnds();
+
+	Trace t = {0};
+	MakeTyping(&t, keystrokes);
+	Load("a FIFO, as fast as it goes", &t, 0);
+	Free(&t);
+	MakeTyping(&t, paced);
+	char what [80];
+	snprintf(what, sizeof(what), "a FIFO, a keystroke every %luus", pace_us);
+	Load(what, &t, pace_us);
+	Free(&t);
+
+	for( int i = first; i < argc; ++i )  ReadTrace(argv[i]);
+	return gFailed ? 1 : 0;
+}
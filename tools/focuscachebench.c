@@ -0,0 +1,100 @@
+// A check of the per-focus-target layout cache (src/focuscache.c): the hits and the
+// misses, the eviction of the least recently used entry when it is full, the layout
+// an app had last, a window handle reused by another app, a window forgotten, and the
+// installed layouts changing (only the entries of the layouts gone dropped, what is
+// remembered per app of the rest kept); then the cost of a lookup in a full cache.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o focuscachebench focuscachebench.c ../src/focuscache.c
+//
+// focuscachebench
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+#include "focuscache.h"
+#include "check.h"
+
+enum { EN = 0x409, DE = 0x407, RU = 0x419 };
+
+// the installed layouts, for FocusCacheRetainLayouts
+static bool NotRussian( void* _, uintptr_t layout )
+{
+	return layout != RU;
+}
+
+static unsigned Used( const FocusCache* cache )
+{
+	unsigned n = 0;
+	for( unsigned i = 0; i < FOCUS_CACHE_SIZE; ++i )  n += (cache->entries[i].target != 0);
+	return n;
+}
+
+int main( int argc, char* argv [] )
+{
+	if( argc > 1 )  return fprintf(stderr, "usage: focuscachebench\n"), 2;
+
+	static FocusCache cache;
+	FocusCacheInit(&cache);
+
+	// windows 1.. of app 100
+	FocusCacheStore(&cache, 1, 100, EN);
+	FocusCacheStore(&cache, 2, 100, DE);
+	bool ok = (FocusCacheLookup(&cache, 1, 100) == EN) && (FocusCacheLookup(&cache, 2, 100) == DE)
+	       && (FocusCacheLookup(&cache, 3, 100) == 0) && (FocusCacheLookup(&cache, 0, 100) == 0)
+	       && (cache.nhits == 2) && (cache.nmisses == 2);
+	Check(ok, "a lookup: the layout stored, a miss for a window not seen");
+
+	FocusCacheStore(&cache, 1, 100, RU);
+	Check((FocusCacheLookup(&cache, 1, 100) == RU) && (Used(&cache) == 2), "a store again: updated in place");
+
+	// the app's last layout is that of its most recently used window
+	FocusCacheLookup(&cache, 2, 100);
+	ok = (FocusCacheAppLayout(&cache, 100) == DE) && (FocusCacheAppLayout(&cache, 200) == 0);
+	FocusCacheLookup(&cache, 1, 100);
+	Check(ok && (FocusCacheAppLayout(&cache, 100) == RU), "the layout of an app: that of its window used last");
+
+	// full: the least recently used goes
+	FocusCacheInit(&cache);
+	for( uintptr_t w = 1; w <= FOCUS_CACHE_SIZE; ++w )  FocusCacheStore(&cache, w, 100 + w, EN);
+	for( uintptr_t w = 2; w <= FOCUS_CACHE_SIZE; ++w )  FocusCacheLookup(&cache, w, 100 + w);   // all but 1
+	FocusCacheStore(&cache, 1000, 1100, DE);
+	ok = (cache.nevictions == 1) && (FocusCacheLookup(&cache, 1, 101) == 0) && (FocusCacheLookup(&cache, 1000, 1100) == DE);
+	for( uintptr_t w = 2; w <= FOCUS_CACHE_SIZE; ++w )  ok = ok && (FocusCacheLookup(&cache, w, 100 + w) == EN);
+	Check(ok && (Used(&cache) == FOCUS_CACHE_SIZE), "full: the least recently used entry evicted, the rest kept");
+
+	// a destroyed window's handle reused by another app: not its layout, and dropped
+	ok = (FocusCacheLookup(&cache, 5, 999) == 0) && (Used(&cache) == FOCUS_CACHE_SIZE - 1)
+	  && (FocusCacheLookup(&cache, 5, 105) == 0) && (FocusCacheAppLayout(&cache, 105) == 0);
+	Check(ok, "a handle reused by another app: a miss, and the old entry dropped");
+
+	FocusCacheForgetTarget(&cache, 6);
+	FocusCacheForgetTarget(&cache, 12345);
+	Check((FocusCacheLookup(&cache, 6, 106) == 0) && (Used(&cache) == FOCUS_CACHE_SIZE - 2), "a window forgotten");
+
+	// the installed layouts changed: only what was remembered of the one removed goes
+	FocusCacheInit(&cache);
+	FocusCacheStore(&cache, 1, 100, EN);
+	FocusCacheStore(&cache, 2, 200, RU);
+	FocusCacheStore(&cache, 3, 300, DE);
+	FocusCacheStore(&cache, 4, 300, RU);
+	unsigned dropped = FocusCacheRetainLayouts(&cache, NotRussian, NULL);
+	ok = (dropped == 2) && (Used(&cache) == 2)
+	  && (FocusCacheLookup(&cache, 1, 100) == EN) && (FocusCacheAppLayout(&cache, 100) == EN)
+	  && (FocusCacheLookup(&cache, 2, 200) == 0) && (FocusCacheAppLayout(&cache, 200) == 0)
+	  && (FocusCacheAppLayout(&cache, 300) == DE);
+	Check(ok, "a layout removed: its entries dropped, the per-app memory of the others kept");
+	Check((FocusCacheRetainLayouts(&cache, NotRussian, NULL) == 0) && (Used(&cache) == 2),
+	      "no layout removed (most setting changes): nothing dropped");
+
+	// the cost of a lookup, in a full cache, of the last entry to be found
+	FocusCacheInit(&cache);
+	for( uintptr_t w = 1; w <= FOCUS_CACHE_SIZE; ++w )  FocusCacheStore(&cache, w, 100, EN);
+	const unsigned N = 20000000;
+	uintptr_t sum = 0;
+	clock_t t0 = clock();
+	for( unsigned i = 0; i < N; ++i )  sum += FocusCacheLookup(&cache, FOCUS_CACHE_SIZE - (i & 1), 100);
+	double ns = (double)(clock() - t0) / CLOCKS_PER_SEC * 1e9 / N;
+	printf("a lookup in a full cache of %u: %.1f ns (%u)\n", FOCUS_CACHE_SIZE, ns, (unsigned)(sum & 1));
+	return gFailed;
+}
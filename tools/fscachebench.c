@@ -0,0 +1,145 @@
+// A check of the fullscreen-app cache (src/fscache.c), with a fake clock and a fake
+// source: the expiry after the TTL (across the wrap of the clock too), the invalidation,
+// the refresh ahead of time, a failing source; then a day of activations and foreground
+// changes, simulated, to count the queries left on the path of an activation, and the cost of a cached
+// FullscreenCacheGet.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o fscachebench fscachebench.c ../src/fscache.c
+//
+// fscachebench [--ttl=MS] [--seed=N]
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "fscache.h"
+#include "check.h"
+
+typedef struct
+{
+	uint32_t  now_ms;
+	bool      fullscreen;    // what the system would say
+	bool      failing;
+	unsigned  queries;
+} FakeSource;
+
+static uint32_t FakeNow( void* ctx )
+{
+	return ((FakeSource*)ctx)->now_ms;
+}
+
+static bool FakeQuery( void* ctx, bool* pfullscreen )
+{
+	FakeSource* s = ctx;
+	++s->queries;
+	if( s->failing )  return false;
+	*pfullscreen = s->fullscreen;
+	return true;
+}
+
+static void CheckExpiry( uint32_t ttl_ms, uint32_t start_ms, const char* what )
+{
+	FakeSource s = { .now_ms = start_ms, .fullscreen = true };
+	FullscreenSource source = { FakeNow, FakeQuery, &s };
+	FullscreenCache cache;
+	FullscreenCacheInit(&cache, &source, ttl_ms);
+
+	bool ok = FullscreenCacheGet(&cache) && (s.queries == 1);
+	s.fullscreen = false;
+	s.now_ms += ttl_ms - 1;
+	ok = ok && FullscreenCacheGet(&cache) && (s.queries == 1);    // stale, but not expired yet
+	s.now_ms += 1;
+	ok = ok && !FullscreenCacheGet(&cache) && (s.queries == 2);   // expired: fetched again
+	ok = ok && !FullscreenCacheGet(&cache) && (s.queries == 2);
+	Check(ok, what);
+}
+
+int main( int argc, char* argv [] )
+{
+	uint32_t ttl_ms = 1000;
+	unsigned seed = 1;
+	for( int i = 1; i < argc; ++i )
+	{
+		if( (strncmp(argv[i], "--ttl=", 6) == 0) && ((ttl_ms = strtoul(argv[i] + 6, NULL, 10)) > 0) )  continue;
+		if( strncmp(argv[i], "--seed=", 7) == 0 )  { seed = strtoul(argv[i] + 7, NULL, 10); continue; }
+		fprintf(stderr, "usage: fscachebench [--ttl=MS] [--seed=N]\n");
+		return 2;
+	}
+
+	CheckExpiry(ttl_ms, 5000, "expiry: kept for the TTL, fetched again after it");
+	CheckExpiry(ttl_ms, UINT32_MAX - ttl_ms / 2, "expiry: across the wrap of the clock");
+
+	FakeSource s = { .now_ms = 100 };
+	FullscreenSource source = { FakeNow, FakeQuery, &s };
+	FullscreenCache cache;
+	FullscreenCacheInit(&cache, &source, ttl_ms);
+
+	bool ok = !FullscreenCacheGet(&cache) && (s.queries == 1);
+	s.fullscreen = true;                     // a game comes to the foreground ...
+	FullscreenCacheInvalidate(&cache);       // ... and the app hears of it
+	ok = ok && (s.queries == 1) && FullscreenCacheGet(&cache) && (s.queries == 2);
+	Check(ok, "invalidation: fetched again on the next get, and not before");
+
+	s.fullscreen = false;
+	FullscreenCacheInvalidate(&cache);
+	FullscreenCacheRefresh(&cache);
+	unsigned after_refresh = s.queries;
+	ok = (after_refresh == 3) && !FullscreenCacheGet(&cache) && (s.queries == 3);
+	FullscreenCacheRefresh(&cache);
+	Check(ok && (s.queries == 3), "refresh: fetched ahead of time, once; the get is then free");
+
+	s.fullscreen = true;
+	s.failing = true;
+	FullscreenCacheInvalidate(&cache);
+	ok = !FullscreenCacheGet(&cache) && (s.queries == 4) && !FullscreenCacheGet(&cache) && (s.queries == 5);
+	s.failing = false;
+	ok = ok && FullscreenCacheGet(&cache) && (s.queries == 6) && FullscreenCacheGet(&cache) && (s.queries == 6);
+	Check(ok, "a failing source: not fullscreen, and not cached");
+	Check(cache.nqueries == s.queries, "the diagnostic count of queries");
+
+	// A day of use: activations in bursts (a few words fixed in a row), the foreground
+	// changing every 20 s or so, a game now and then; every change is heard of, so the
+	// answers are never out of date.
+	srand(seed);
+	FakeSource day = { .now_ms = 0 };
+	FullscreenSource day_source = { FakeNow, FakeQuery, &day };
+	FullscreenCacheInit(&cache, &day_source, ttl_ms);
+	unsigned activations = 0, wrong = 0, on_activation = 0;
+	for( uint32_t t = 0; t < 24 * 3600 * 1000u; t += 50 )
+	{
+		day.now_ms = t;
+		if( rand() % 400 == 0 )
+		{
+			// a foreground change, told by the notification
+			day.fullscreen = (rand() % 10 == 0);
+			FullscreenCacheInvalidate(&cache);
+			FullscreenCacheRefresh(&cache);
+		}
+		if( rand() % 1000 == 0 )
+		{
+			// a burst of activations
+			for( unsigned i = 1 + rand() % 5; i > 0; --i, day.now_ms += 300 )
+			{
+				unsigned before = day.queries;
+				++activations;
+				wrong += (FullscreenCacheGet(&cache) != day.fullscreen);
+				on_activation += day.queries - before;
+			}
+		}
+	}
+	char what [160];
+	snprintf(what, sizeof(what), "a day: %u activations, %u queries in all, %u of them on an activation (%.2f per one), "
+	         "%u wrong answers", activations, day.queries, on_activation, (double)on_activation / activations, wrong);
+	Check((wrong == 0) && (on_activation < activations / 2), what);
+
+	// the cost of a cached answer
+	const unsigned N = 50000000;
+	unsigned yes = 0;
+	clock_t t0 = clock();
+	for( unsigned i = 0; i < N; ++i )  yes += FullscreenCacheGet(&cache);
+	double ns = (double)(clock() - t0) / CLOCKS_PER_SEC * 1e9 / N;
+	printf("a cached get: %.1f ns (%u)\n", ns, yes % 2);
+	return gFailed;
+}
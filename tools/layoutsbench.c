@@ -0,0 +1,179 @@
+// A check of the layout registry (src/layouts.c) with a stubbed provider, whose list of
+// layouts changes while it is enumerated, as the list of Windows can (a layout added or
+// removed in the Settings between GetKeyboardLayoutList calls):
+//   - grown between the count and the fill, by fewer and by more than the spare room;
+//   - shrunk in between;
+//   - growing at every call (given up on, with what there is);
+//   - the names fetched once, and kept for the ids still there after a refresh;
+//   - the lookups by handle and by id, and the generation;
+// then the cost of a refresh, and of the lookups, with many layouts.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o layoutsbench layoutsbench.c ../src/layouts.c
+//
+// layoutsbench [--layouts=N]
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "layouts.h"
+#include "check.h"
+
+enum { MAX_LAYOUTS = 4096 };
+
+typedef struct
+{
+	size_t     count;
+	unsigned   next_klid;        // of the next layout added
+	unsigned   klids [MAX_LAYOUTS];
+	size_t     grow_on_fill;     // layouts added after the count, before the fill
+	bool       grow_always;      // ... at every fill, not only the next
+	size_t     shrink_on_fill;   // layouts removed likewise
+	unsigned   enumerations, names;
+} StubProvider;
+
+static void Add( StubProvider* s, size_t n )
+{
+	for( ; n && (s->count < MAX_LAYOUTS); --n )  s->klids[s->count++] = s->next_klid++;
+}
+
+static size_t StubEnumerate( void* ctx, LayoutHandle* handles, size_t max )
+{
+	StubProvider* s = ctx;
+	if( max == 0 )  return s->count;
+
+	++s->enumerations;
+	Add(s, s->grow_on_fill);
+	s->count -= (s->shrink_on_fill < s->count) ? s->shrink_on_fill : s->count;
+	if( !s->grow_always )  s->grow_on_fill = s->shrink_on_fill = 0;
+
+	// as GetKeyboardLayoutList: says how many it has copied, not how many there are
+	size_t n = 0;
+	for( ; (n < s->count) && (n < max); ++n )  handles[n] = 0x10000 + s->klids[n];
+	return n;
+}
+
+static bool StubGetId( void* ctx, LayoutHandle handle, char id [LAYOUT_ID_SIZE] )
+{
+	snprintf(id, LAYOUT_ID_SIZE, "%08X", (unsigned)(handle - 0x10000));
+	return true;
+}
+
+static bool StubGetName( void* ctx, const char* id, char* name, size_t name_size )
+{
+	++((StubProvider*)ctx)->names;
+	snprintf(name, name_size, "Layout %s", id);
+	return true;
+}
+
+// the registry holds what the provider has now, in its order
+static bool Matches( LayoutRegistry* reg, const StubProvider* s )
+{
+	if( LayoutRegistryCount(reg) != s->count )  return false;
+	for( size_t i = 0; i < s->count; ++i )
+	{
+		char id [LAYOUT_ID_SIZE];
+		snprintf(id, sizeof(id), "%08X", s->klids[i]);
+		const LayoutInfo* l = LayoutRegistryAt(reg, i);
+		if( (l->handle != 0x10000 + s->klids[i]) || (strcmp(l->id, id) != 0) )  return false;
+	}
+	return true;
+}
+
+static double Seconds( clock_t t0 )
+{
+	return (double)(clock() - t0) / CLOCKS_PER_SEC;
+}
+
+int main( int argc, char* argv [] )
+{
+	size_t many = 1000;
+	for( int i = 1; i < argc; ++i )
+	{
+		if( (strncmp(argv[i], "--layouts=", 10) == 0) && ((many = strtoul(argv[i] + 10, NULL, 10)) > 0)
+		 && (many < MAX_LAYOUTS) )
+			continue;
+		fprintf(stderr, "usage: layoutsbench [--layouts=N]   (N < %u)\n", MAX_LAYOUTS);
+		return 2;
+	}
+
+	static StubProvider s;
+	s.next_klid = 0x409;
+	Add(&s, 3);
+	const LayoutProvider provider = { StubEnumerate, StubGetId, StubGetName, &s };
+	LayoutRegistry reg;
+	LayoutRegistryInit(&reg, &provider);
+
+	Check(Matches(&reg, &s) && (reg.generation == 1) && (s.enumerations == 1), "the first enumeration");
+
+	s.grow_on_fill = 2;
+	LayoutRegistryInvalidate(&reg);
+	Check(Matches(&reg, &s) && (s.count == 5), "grown while enumerated, within the spare room");
+
+	s.grow_on_fill = 50;
+	unsigned before = s.enumerations;
+	LayoutRegistryInvalidate(&reg);
+	Check(Matches(&reg, &s) && (s.count == 55) && (s.enumerations - before == 2),
+	      "grown while enumerated, past the spare room: enumerated again");
+
+	s.shrink_on_fill = 4;
+	LayoutRegistryInvalidate(&reg);
+	Check(Matches(&reg, &s) && (s.count == 51), "shrunk while enumerated");
+
+	s.grow_on_fill = 100;
+	s.grow_always = true;
+	before = s.enumerations;
+	LayoutRegistryInvalidate(&reg);
+	size_t n = LayoutRegistryCount(&reg);
+	s.grow_always = false;
+	s.grow_on_fill = 0;
+	char what [160];
+	snprintf(what, sizeof(what), "growing at every call: given up after %u enumerations, with %u of %u",
+	         s.enumerations - before, (unsigned)n, (unsigned)s.count);
+	Check((n > 51) && (n <= s.count) && (s.enumerations - before <= 8), what);
+
+	// the names
+	s.count = 3;
+	LayoutRegistryInvalidate(&reg);
+	const LayoutInfo* l = LayoutRegistryFindId(&reg, "0000040A");
+	bool ok = l && (strcmp(LayoutRegistryName(&reg, l), "Layout 0000040A") == 0)
+	       && (strcmp(LayoutRegistryName(&reg, l), "Layout 0000040A") == 0) && (s.names == 1);
+	Check(ok, "a name: fetched once");
+
+	s.klids[0] = s.next_klid++;   // the first one replaced
+	s.klids[1] = 0x40A;           // the named one moved up
+	s.klids[2] = s.next_klid++;
+	unsigned generation = reg.generation;
+	LayoutRegistryInvalidate(&reg);
+	l = LayoutRegistryFindHandle(&reg, 0x10000 + 0x40A);
+	ok = l && (l == LayoutRegistryAt(&reg, 1)) && (strcmp(LayoutRegistryName(&reg, l), "Layout 0000040A") == 0)
+	  && (s.names == 1) && (reg.generation == generation + 1);
+	Check(ok, "after a refresh: the name kept for the id still there, found by handle");
+	Check(!LayoutRegistryFindId(&reg, "00000409") && !LayoutRegistryFindHandle(&reg, 0x10000 + 0x409),
+	      "a layout removed: not found");
+
+	// the costs, with many layouts
+	s.count = 0;
+	Add(&s, many);
+	const unsigned R = 200;
+	clock_t t0 = clock();
+	for( unsigned i = 0; i < R; ++i )
+	{
+		LayoutRegistryInvalidate(&reg);
+		LayoutRegistryCount(&reg);
+	}
+	double refresh_s = Seconds(t0);
+	const unsigned F = 20000;
+	size_t found = 0;
+	t0 = clock();
+	for( unsigned i = 0; i < F; ++i )  found += !!LayoutRegistryFindHandle(&reg, 0x10000 + s.klids[i % many]);
+	double find_s = Seconds(t0);
+	Check(Matches(&reg, &s) && (found == F), "many layouts: all there");
+	printf("%u layouts: a refresh %.1f us, a lookup by handle %.0f ns\n", (unsigned)many,
+	       refresh_s * 1e6 / R, find_s * 1e9 / F);
+
+	LayoutRegistryFree(&reg);
+	return gFailed;
+}
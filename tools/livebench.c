@@ -0,0 +1,293 @@
+// Replays typing through the live wrong-layout detector (src/livedetect.c): the words of
+// the text of each language are turned into the keystrokes (with the Shift presses and
+// the key releases) that type them in the layout of the language, which go through a
+// KeyHistory (src/keyhist.c) the way the hook hands them over. Then:
+//   - with each of the other layouts current, how many of the words are found to be meant
+//     for the right one, how many for another one, and how far into the word;
+//   - with the right layout current, how many words get a verdict anyway (false alarms);
+//   - what a keystroke costs, on the hook side (the push) and on the detector side.
+// The text should not be what the models were made from.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o livebench livebench.c ../src/livedetect.c ../src/keyhist.c
+//     ../src/casemap.c ../src/translate.c ../src/hex.c ../src/grapheme.c ../src/names.c ../src/names_posix.c
+//
+// livebench [--words=N] [--rounds=N] LANG=FILE [LANG=FILE...]   (en, ru, uk, de, fr, es)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "livedetect.h"
+#include "keyhist.h"
+#include "common.h"
+#include "rowkeymaps.h"
+
+static double Seconds( void )
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned long* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+// ---- the traces -------------------------------------------------------------
+
+typedef struct
+{
+	Keystroke*  events;
+	uint32_t*   words;     // the word of each event
+	size_t      nevents;
+	unsigned    nwords;
+	unsigned    nkeys;     // key presses, but for Shift
+} Trace;
+
+static bool Append( Trace* t, size_t* psize, uint16_t scancode, uint8_t flags )
+{
+	if( t->nevents == *psize )
+	{
+		*psize = *psize ? *psize * 2 : 4096;
+		t->events = realloc(t->events, *psize * sizeof(Keystroke));
+		t->words = realloc(t->words, *psize * sizeof(uint32_t));
+		if( !t->events || !t->words )  return false;
+	}
+	t->events[t->nevents] = (Keystroke){ .scancode = scancode, .flags = flags, .time_ms = (uint32_t)t->nevents * 50 };
+	t->words[t->nevents++] = t->nwords;
+	return true;
+}
+
+// Types the words of the text (the runs of non-spaces that the layout can type, and that
+// have a letter in them), each followed by a space.
+static bool MakeTrace( Trace* t, const LiveKeymap* km, const char* path, unsigned max_words )
+{
+	FILE* f = fopen(path, "rb");
+	if( f == NULL )  return fprintf(stderr, "cannot open %s\n", path), false;
+	static unsigned char text [16 << 20];
+	size_t n = fread(text, 1, sizeof(text) - 1, f);
+	fclose(f);
+	text[n] = 0;
+
+	memset(t, 0, sizeof(*t));
+	size_t size = 0;
+	for( const unsigned char* p = text; *p && (t->nwords < max_words); )
+	{
+		while( *p && (*p <= ' ') )  ++p;
+		uint16_t keys [LIVE_MAX_WORD];
+		unsigned nkeys = 0;
+		bool ok = true, letter = false;
+		while( *p > ' ' )
+		{
+			uint32_t u = DecodeUtf8(&p);
+			unsigned key = FindKey(km, u);
+			ok &= (key < LIVE_SCANCODES * 2) && (nkeys < LIVE_MAX_WORD);
+			if( ok )  keys[nkeys++] = key;
+			letter |= ok && (km->symbols[key >> 1][key & 1] >= 2);
+		}
+		if( !ok || !letter )  continue;
+
+		for( unsigned i = 0; i < nkeys; ++i )
+		{
+			bool shifted = keys[i] & 1;
+			if( shifted )  ok &= Append(t, &size, SC_LSHIFT, 0);
+			ok &= Append(t, &size, keys[i] >> 1, 0) && Append(t, &size, keys[i] >> 1, KS_UP);
+			if( shifted )  ok &= Append(t, &size, SC_LSHIFT, KS_UP);
+		}
+		ok &= Append(t, &size, SC_SPACE, 0) && Append(t, &size, SC_SPACE, KS_UP);
+		if( !ok )  return fprintf(stderr, "out of memory\n"), false;
+		t->nkeys += nkeys + 1;
+		++t->nwords;
+	}
+	return true;
+}
+
+// ---- the replay -------------------------------------------------------------
+
+typedef struct
+{
+	unsigned  words;      // that type something else in the current layout
+	unsigned  right;      // verdicts for a layout that types the word right
+	unsigned  wrong;      // ... for one that doesn't
+	unsigned  keys;       // into the word, when right
+} Verdicts;
+
+typedef struct
+{
+	uint8_t            keys [LIVE_MAX_WORD];   // scancode | 0x80 if shifted
+	unsigned           nkeys;
+	bool               shifted;
+	const LiveKeymap*  verdict;
+	unsigned           at;                     // the keys before the verdict
+} Word;
+
+static bool SameText( const Word* w, const LiveKeymap* a, const LiveKeymap* b )
+{
+	for( unsigned k = 0; k < w->nkeys; ++k )
+	{
+		unsigned sc = w->keys[k] & 0x7F, shifted = w->keys[k] >> 7;
+		if( a->chars[sc][shifted] != b->chars[sc][shifted] )  return false;
+	}
+	return true;
+}
+
+static void EndOfWord( Word* w, const LiveKeymap* right, const LiveKeymap* current, Verdicts* v )
+{
+	bool differs = !SameText(w, right, current);
+	v->words += differs;
+	if( w->verdict )
+	{
+		if( differs && SameText(w, right, w->verdict) )
+		{
+			++v->right;
+			v->keys += w->at;
+		}
+		else ++v->wrong;
+	}
+	w->nkeys = 0;
+	w->verdict = NULL;
+}
+
+// Counts the words the right layout types differently from the current one, and the
+// verdicts: for a layout that types them right, or not (all of them are false alarms when
+// the right layout is current).
+static void Replay( const Trace* t, LiveDetector* d, KeyHistory* h, const LiveKeymap* right,
+                    const LiveKeymap* current, Verdicts* v )
+{
+	memset(v, 0, sizeof(*v));
+	LiveDetectorReset(d);
+	Word w = { .nkeys = 0 };
+	unsigned word = 0;
+	for( size_t i = 0; i < t->nevents; )
+	{
+		// in batches, as the hook would hand them over
+		size_t start = i, end = i + 16;
+		for( ; (i < end) && (i < t->nevents); ++i )  KeyHistoryPush(h, &t->events[i]);
+
+		Keystroke ks;
+		for( size_t k = start; KeyHistoryPop(h, &ks); ++k )
+		{
+			if( t->words[k] != word )
+			{
+				EndOfWord(&w, right, current, v);
+				word = t->words[k];
+			}
+			if( ks.scancode == SC_LSHIFT )  w.shifted = !(ks.flags & KS_UP);
+			else if( !(ks.flags & KS_UP) && (ks.scancode != SC_SPACE) )  w.keys[w.nkeys++] = ks.scancode | (w.shifted << 7);
+
+			const LiveKeymap* verdict = LiveDetectorFeed(d, &ks, atomic_load(&h->dropped));
+			if( verdict && !w.verdict )
+			{
+				w.verdict = verdict;
+				w.at = w.nkeys;
+			}
+		}
+	}
+	EndOfWord(&w, right, current, v);
+}
+
+int main( int argc, char* argv[] )
+{
+	unsigned long max_words = 20000, rounds = 5;
+	static LiveKeymap keymaps [COUNTOF(kLayouts)];
+	static Trace traces [COUNTOF(kLayouts)];
+	const LiveKeymap* used [COUNTOF(kLayouts)];
+	unsigned nused = 0;
+
+	const char* files [COUNTOF(kLayouts)] = {0};
+	for( int i = 1; i < argc; ++i )
+	{
+		const char* eq = strchr(argv[i], '=');
+		unsigned layout = COUNTOF(kLayouts);
+		for( unsigned k = 0; eq && (k < COUNTOF(kLayouts)); ++k )
+		{
+			if( (strlen(kLayouts[k].language) == (size_t)(eq - argv[i])) && !strncmp(argv[i], kLayouts[k].language, eq - argv[i]) )
+				layout = k;
+		}
+
+		if(      ParseArg(argv[i], "--words", &max_words) )  max_words = max_words ? max_words : 1;
+		else if( ParseArg(argv[i], "--rounds", &rounds) )  rounds = rounds ? rounds : 1;
+		else if( (argv[i][0] != '-') && (layout < COUNTOF(kLayouts)) )  files[layout] = eq + 1;
+		else
+		{
+			fprintf(stderr, "usage: %s [--words=N] [--rounds=N] LANG=FILE [LANG=FILE...]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	for( unsigned k = 0; k < COUNTOF(kLayouts); ++k )
+	{
+		if( files[k] == NULL )  continue;
+		MakeKeymap(&keymaps[k], k);
+		if( keymaps[k].model == NULL )  return fprintf(stderr, "no model for %s\n", kLayouts[k].language), 1;
+		if( !MakeTrace(&traces[k], &keymaps[k], files[k], max_words) )  return 1;
+		used[nused++] = &keymaps[k];
+	}
+	if( nused < 2 )  return fprintf(stderr, "at least two languages are needed\n"), 1;
+
+	static LiveDetector detector;
+	static KeyHistory history;
+	LiveDetectorInit(&detector, used, nused);
+	KeyHistoryInit(&history);
+
+	printf("%u layouts; words typed for the layout of their language, with another one current\n"
+	       "(the words that type something else in it; a verdict is right if its layout types the word right):\n\n", nused);
+	printf("%-10s %-10s %7s %9s %9s %9s %11s\n", "text", "current", "words", "detected", "wrongly", "at key", "false alarm");
+	for( unsigned k = 0; k < COUNTOF(kLayouts); ++k )
+	{
+		if( files[k] == NULL )  continue;
+
+		Verdicts v;
+		LiveDetectorSetCurrent(&detector, keymaps[k].layout);
+		Replay(&traces[k], &detector, &history, &keymaps[k], &keymaps[k], &v);
+		double false_alarms = 100.0 * v.wrong / traces[k].nwords;
+
+		for( unsigned w = 0; w < COUNTOF(kLayouts); ++w )
+		{
+			if( (files[w] == NULL) || (w == k) )  continue;
+			LiveDetectorSetCurrent(&detector, keymaps[w].layout);
+			Replay(&traces[k], &detector, &history, &keymaps[k], &keymaps[w], &v);
+			unsigned words = v.words ? v.words : 1;
+			printf("%-10s %-10s %7u %8.1f%% %8.1f%% %9.1f %10.2f%%\n", kLayouts[k].name, kLayouts[w].name,
+			       v.words, 100.0 * v.right / words, 100.0 * v.wrong / words,
+			       v.right ? (double)v.keys / v.right : 0.0, false_alarms);
+		}
+	}
+
+	// the costs, on all the traces, with the first layout current
+	size_t nevents = 0;
+	double push = 0, feed = 0;
+	for( unsigned r = 0; r < rounds; ++r )
+	{
+		for( unsigned k = 0; k < COUNTOF(kLayouts); ++k )
+		{
+			const Trace* t = &traces[k];
+			if( files[k] == NULL )  continue;
+			LiveDetectorSetCurrent(&detector, used[0]->layout);
+			nevents += t->nevents;
+			for( size_t i = 0; i < t->nevents; i += KEYHIST_SIZE )
+			{
+				size_t end = (i + KEYHIST_SIZE < t->nevents) ? i + KEYHIST_SIZE : t->nevents;
+				double t0 = Seconds();
+				for( size_t e = i; e < end; ++e )  KeyHistoryPush(&history, &t->events[e]);
+				double t1 = Seconds();
+				Keystroke ks;
+				while( KeyHistoryPop(&history, &ks) )  LiveDetectorFeed(&detector, &ks, 0);
+				double t2 = Seconds();
+				push += t1 - t0;
+				feed += t2 - t1;
+			}
+		}
+	}
+	printf("\n%zu keystroke events (presses and releases), %u layouts scored:\n", nevents, nused);
+	printf("  hook side (KeyHistoryPush):                 %6.1f ns per event\n", push * 1e9 / nevents);
+	printf("  main thread (KeyHistoryPop + the detector): %6.1f ns per event\n", feed * 1e9 / nevents);
+	return 0;
+}
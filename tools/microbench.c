@@ -0,0 +1,594 @@
+// Microbenchmarks of the portable core, to be compared across commits: the command-line
+// parser, the translators, the tap detector, the keystroke ring, the arena, the typing
+// plan, the pipeline and the recording of trace events. Each one is warmed up, then timed over a number of runs of a
+// calibrated size; the median, the 99th percentile and the extremes of the time per unit
+// of work are printed, and written as JSON. With a baseline (an earlier JSON output),
+// the medians are compared with it.
+// The inputs are generated from fixed seeds, so each run does the same work.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o microbench microbench.c ../src/docopt.c
+//     ../src/tapdetect.c ../src/keyhist.c ../src/arena.c ../src/inject.c ../src/pipeline.c
+//     ../src/trace.c ../src/translate.c ../src/hex.c ../src/grapheme.c ../src/names.c
+//     ../src/names_posix.c ../src/casemap.c
+// (or `make bench` from the top directory)
+//
+// microbench [--runs=N] [--warmup=MS] [--run-time=MS] [--json=FILE] [--baseline=FILE] [NAME...]
+//     NAMEs select the benchmarks whose names start with them
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "docopt.h"
+#include "tapdetect.h"
+#include "keyhist.h"
+#include "arena.h"
+#include "inject.h"
+#include "pipeline.h"
+#include "translate.h"
+#include "trace.h"
+#include "common.h"
+
+static double Now_ns( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned long* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+static bool ParseStringArg( const char* arg, const char* name, const char** pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	*pvalue = arg + len + 1;
+	return true;
+}
+
+static uint64_t gRng;
+
+static uint32_t Random( uint32_t n )
+{
+	// xorshift64*
+	gRng ^= gRng >> 12;
+	gRng ^= gRng << 25;
+	gRng ^= gRng >> 27;
+	return (uint32_t)((gRng * 0x2545F4914F6CDD1DULL) >> 32) % n;
+}
+
+// what the benchmarks compute goes here, so that it is not optimized away
+static volatile size_t gSink;
+
+// ---- the command line -------------------------------------------------------
+
+static const char kUsage [] =
+	"Command line: kbsw [options] KEY[=LAYOUT] [KEY[=LAYOUT]...]\n"
+	"\n"
+	"-t --timeout=300   KEY double-press timeout, in milliseconds\n"
+	"-q --quiet         suppress error messages (only return error code)\n"
+	"-F --fullscreen    do not ignore fullscreen apps\n"
+	"-a --per-app       remember the layout of each app, restore it when the app gets focus\n"
+	"-k --keep-clip     keep the clipboard contents when correcting a selection\n"
+	"-d --detect=off    watch for words typed in a wrong layout: off, beep, or switch\n"
+	"-w --fix-word      retype the word just typed when switching to another LAYOUT\n"
+	"-x --exit          stop the running copy of kbsw\n"
+	"-p --pause         make the running instance stop doing anything\n"
+	"-r --resume        make a paused running instance resume working\n"
+	"-s --status        show parameters of the running instance\n"
+	"-T --trace         make the running instance record trace events\n"
+	"-l --list-layouts  display installed keyboard layouts and text translators\n"
+	"-h --help          show this text\n";
+
+struct Options
+{
+	unsigned  tap_timeout_ms;
+	unsigned  flags;
+	unsigned  detect;
+	unsigned  nkeys;
+	size_t    keys_length;
+};
+
+bool AppDocOptSetOption( Options* po, char opt, const char* val )
+{
+	switch( opt )
+	{
+		case 0:
+			++po->nkeys;
+			po->keys_length += strlen(val);
+			return true;
+		case 't':
+			po->tap_timeout_ms = atoi(val);
+			return true;
+		case 'd':
+			po->detect = (strncmp(val, "off", 3) != 0);
+			return true;
+		default:
+			if( strchr("qFakwxprsTlh", opt) == NULL )  return false;
+			po->flags |= 1u << (opt & 31);
+			return true;
+	}
+}
+
+void AppDocOptReportError( const char* bad_arg )
+{
+	fprintf(stderr, "docopt: invalid argument %s\n", bad_arg);
+}
+
+static char* kArgv [] =
+{
+	"kbsw", "-q", "--timeout=250", "--detect=switch", "-k", "--per-app", "LC=HEX", "RC", "CL=00000419",
+	"RS=CASE+HEX",
+};
+
+static size_t BenchDocOpt( void )
+{
+	Options opt;
+	memset(&opt, 0, sizeof(opt));
+	if( !DocOptParseCommandLine(&opt, kUsage, COUNTOF(kArgv), kArgv) )  exit(1);
+	gSink += opt.nkeys + opt.tap_timeout_ms;
+	return 1;
+}
+
+// ---- the translators --------------------------------------------------------
+
+enum { TEXT_UNITS = 16 * 1024 };
+
+static UTF16 gText [TEXT_UNITS];
+static UTF16* gOutput;
+static size_t gOutputSize;
+static TrPipeline gPipeline;
+
+static const char* const kPieces [] =
+{
+	"Hello world, ", "\\u0041\\u00e9 ", "U+1F4A1 ", "&#x26; ", "&#1092; ", "0x41 ", "hELLO wORLD ",
+	"\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 ", "\xC3\xA9t\xC3\xA9 ",
+};
+
+static void MakeText( void )
+{
+	size_t n = 0;
+	gRng = 0x9E3779B97F4A7C15ULL;
+	while( n < TEXT_UNITS )
+	{
+		const unsigned char* p = (const unsigned char*)kPieces[Random(COUNTOF(kPieces))];
+		while( *p && (n < TEXT_UNITS) )
+		{
+			if( *p < 0x80 )  gText[n++] = *p++;
+			else  { gText[n++] = ((p[0] & 0x1F) << 6) | (p[1] & 0x3F); p += 2; }
+		}
+	}
+}
+
+static void SetupTranslator( const char* name )
+{
+	MakeText();
+	const TranslatorClass* cls = TranslatorFind(name, strlen(name));
+	if( (cls == NULL) || !TrPipelineInit(&gPipeline, &cls, NULL, 1) )
+	{
+		fprintf(stderr, "no translator %s\n", name);
+		exit(1);
+	}
+	size_t size = TrPipelineMaxOutput(&gPipeline, TEXT_UNITS) + 1;
+	if( size > gOutputSize )
+	{
+		free(gOutput);
+		gOutput = malloc(size * sizeof(UTF16));
+		gOutputSize = size;
+		if( gOutput == NULL )  exit(1);
+	}
+}
+
+static size_t RunTranslator( void )
+{
+	TrBuffer out = { .data = gOutput, .size = gOutputSize - 1 };
+	TrPipelineRun(&gPipeline, gText, TEXT_UNITS, &out);
+	gSink += out.length;
+	return TEXT_UNITS;
+}
+
+static void SetupHex( void )    { SetupTranslator("HEX"); }
+static void SetupUhex( void )   { SetupTranslator("UHEX"); }
+static void SetupGhex( void )   { SetupTranslator("GHEX"); }
+static void SetupCase( void )   { SetupTranslator("CASE"); }
+static void SetupCycle( void )  { SetupTranslator("CYCLE"); }
+
+// ---- the tap detector -------------------------------------------------------
+
+enum { TAP_EVENTS = 4096, TAP_TIMEOUT_ms = 300 };
+
+typedef struct
+{
+	int       sw;     // the switch key, or TAP_NONE for any other key
+	bool      up;
+	uint32_t  time_ms;
+} TapEvent;
+
+static TapEvent gTapEvents [TAP_EVENTS];
+
+// typing, with double taps, single taps, held and autorepeated switch keys among it
+static void SetupTap( void )
+{
+	gRng = 12345;
+	uint32_t t = 0;
+	unsigned n = 0;
+	while( n + 8 <= TAP_EVENTS )
+	{
+		unsigned sw = Random(3);
+		switch( Random(4) )
+		{
+			case 0:   // a double tap
+				for( unsigned i = 0; i < 4; ++i )
+					gTapEvents[n++] = (TapEvent){ sw, i & 1, t += 40 + Random(60) };
+				break;
+			case 1:   // a single tap
+				gTapEvents[n++] = (TapEvent){ sw, false, t += 100 + Random(200) };
+				gTapEvents[n++] = (TapEvent){ sw, true, t += 50 + Random(100) };
+				break;
+			case 2:   // held, autorepeating
+				for( unsigned i = 0; i < 5; ++i )
+					gTapEvents[n++] = (TapEvent){ sw, false, t += 30 };
+				gTapEvents[n++] = (TapEvent){ sw, true, t += 30 };
+				break;
+			default:  // a few other keys
+				for( unsigned i = 0; i < 6; ++i )
+					gTapEvents[n++] = (TapEvent){ TAP_NONE, i & 1, t += 20 + Random(150) };
+				break;
+		}
+	}
+	for( ; n < TAP_EVENTS; ++n )
+		gTapEvents[n] = (TapEvent){ TAP_NONE, n & 1, t += 100 };
+}
+
+static size_t RunTap( void )
+{
+	TapDetector t;
+	TapDetectorReset(&t);
+	size_t activations = 0;
+	for( unsigned i = 0; i < TAP_EVENTS; ++i )
+	{
+		const TapEvent* e = &gTapEvents[i];
+		if( e->sw == TAP_NONE )  TapDetectorOther(&t);
+		else if( !e->up )  TapDetectorDown(&t, e->sw, e->time_ms, TAP_TIMEOUT_ms);
+		else  activations += TapDetectorUp(&t, e->sw, e->time_ms, TAP_TIMEOUT_ms);
+	}
+	gSink += activations;
+	return TAP_EVENTS;
+}
+
+// ---- the keystroke ring -----------------------------------------------------
+
+static KeyHistory gHistory;
+
+static void SetupKeyHistory( void )
+{
+	KeyHistoryInit(&gHistory);
+}
+
+// a batch of keystrokes through the ring, as between two wake-ups of the main thread
+static size_t RunKeyHistory( void )
+{
+	enum { BATCH = 32 };
+	Keystroke ks = { .scancode = 0x1E };
+	for( unsigned i = 0; i < BATCH; ++i )
+	{
+		ks.time_ms = i;
+		KeyHistoryPush(&gHistory, &ks);
+	}
+	size_t sum = 0;
+	while( KeyHistoryPop(&gHistory, &ks) )  sum += ks.time_ms;
+	KeyHistoryWait(&gHistory);
+	gSink += sum;
+	return BATCH;
+}
+
+// ---- the arena --------------------------------------------------------------
+
+static Arena gArena;
+static size_t gArenaSizes [64];
+
+static void SetupArena( void )
+{
+	ArenaInit(&gArena, ARENA_MIN_BLOCK);
+	gRng = 777;
+	for( unsigned i = 0; i < COUNTOF(gArenaSizes); ++i )
+		gArenaSizes[i] = 16 + Random(1024);
+}
+
+// the buffers of a translation, then the reset at its end
+static size_t RunArena( void )
+{
+	for( unsigned i = 0; i < COUNTOF(gArenaSizes); ++i )
+		gSink += (uintptr_t)ArenaAlloc(&gArena, gArenaSizes[i]) & 0xFF;
+	ArenaReset(&gArena);
+	return COUNTOF(gArenaSizes);
+}
+
+// ---- the typing plan --------------------------------------------------------
+
+static InjectBatch gBatch;
+static UTF16 gWord [24];
+
+static void SetupPlan( void )
+{
+	const char* word = "ghbdtn, rfr ltkf? 1234";
+	for( unsigned i = 0; word[i]; ++i )  gWord[i] = word[i];
+}
+
+static size_t RunPlan( void )
+{
+	gSink += InjectPlanTyping(&gBatch, gWord, strlen("ghbdtn, rfr ltkf? 1234"), false);
+	return 1;
+}
+
+// ---- the pipeline -----------------------------------------------------------
+
+static uint32_t gNow_ms;
+static unsigned gIdles;
+
+static uint32_t HostNow( void* _ )                                  { return gNow_ms; }
+static bool HostStartTimer( void* _ )                               { return true; }
+static void HostStopTimer( void* _ )                                {}
+static SpecialHandling HostSpecialHandling( void* _, PipeWindow w )  { return shNoSpecialHandling; }
+static void HostPostCopy( void* _, PipeWindow target )              {}
+static bool HostSendCopyKeys( void* _, SpecialHandling sh )         { return true; }
+static bool HostSendPasteKeys( void* _, SpecialHandling sh )        { return true; }
+// the "layout" of each translation says how it ends
+static PipeOutput HostTranslate( void* _, PipeLayout l, SpecialHandling sh )  { return (PipeOutput)l; }
+static void HostIdle( void* _, bool pasted )                        { gIdles += pasted; }
+
+static Pipeline gPipe;
+
+static void SetupPipeline( void )
+{
+	static const PipelineHost host =
+	{
+		.now_ms = HostNow,
+		.start_timer = HostStartTimer,
+		.stop_timer = HostStopTimer,
+		.special_handling = HostSpecialHandling,
+		.post_copy = HostPostCopy,
+		.send_copy_keys = HostSendCopyKeys,
+		.send_paste_keys = HostSendPasteKeys,
+		.translate_clipboard = HostTranslate,
+		.idle = HostIdle,
+	};
+	static const PipelineTimeouts timeouts = PIPELINE_DEFAULT_TIMEOUTS;
+	PipelineInit(&gPipe, &host, &timeouts);
+}
+
+// a typed translation and a pasted one, the paste after the delay, in virtual time
+static size_t RunPipeline( void )
+{
+	PipelineStart(&gPipe, 1, poTyped);
+	gNow_ms += 5;
+	PipelineOnClipboardUpdate(&gPipe);
+
+	PipelineStart(&gPipe, 1, poPaste);
+	gNow_ms += 5;
+	PipelineOnClipboardUpdate(&gPipe);
+	for( unsigned i = 0; (i < 10) && PipelineIsBusy(&gPipe); ++i )
+	{
+		gNow_ms += 16;
+		PipelineOnTimer(&gPipe);
+	}
+	gSink += gIdles;
+	return 2;
+}
+
+// ---- the trace ring ---------------------------------------------------------
+
+// a real clock, as the app's (the pipeline, in virtual time, records nothing: tracing is off)
+uint64_t AppTraceNow_us( void )
+{
+	return (uint64_t)(Now_ns() / 1000);
+}
+
+static void SetupTraceOff( void )  { TraceStop(); }
+static void SetupTraceOn( void )   { TraceStart(); }
+
+// the events of a translation: spans, an instant, and the target exe as the detail
+static size_t RunTrace( void )
+{
+	enum { SPANS = 16 };
+	for( unsigned i = 0; i < SPANS; ++i )
+	{
+		TRACE_BEGIN("translate", i);
+		TRACE_DETAIL(trInstant, "target", i, "notepad++.exe");
+		TRACE_END("translate", i);
+	}
+	return 3 * SPANS;
+}
+
+// ---- the runs ---------------------------------------------------------------
+
+typedef struct
+{
+	const char*  name;
+	const char*  unit;          // of the work counted by `run`
+	void   (*setup)( void );
+	size_t (*run)( void );      // one round; returns the units of work done
+} Bench;
+
+static const Bench kBenches [] =
+{
+	{ "docopt.parse",     "command line", NULL,            BenchDocOpt },
+	{ "translate.hex",    "char",         SetupHex,        RunTranslator },
+	{ "translate.uhex",   "char",         SetupUhex,       RunTranslator },
+	{ "translate.ghex",   "char",         SetupGhex,       RunTranslator },
+	{ "translate.case",   "char",         SetupCase,       RunTranslator },
+	{ "translate.cycle",  "char",         SetupCycle,      RunTranslator },
+	{ "tap.detect",       "event",        SetupTap,        RunTap },
+	{ "keyhist.ring",     "keystroke",    SetupKeyHistory, RunKeyHistory },
+	{ "arena.alloc",      "allocation",   SetupArena,      RunArena },
+	{ "inject.plan",      "selection",    SetupPlan,       RunPlan },
+	{ "pipeline.cycle",   "translation",  SetupPipeline,   RunPipeline },
+	{ "trace.off",        "event",        SetupTraceOff,   RunTrace },
+	{ "trace.record",     "event",        SetupTraceOn,    RunTrace },   // last: leaves tracing on
+};
+
+typedef struct
+{
+	double  median, p99, min, max;   // ns per unit
+	unsigned long  rounds;           // per run
+} Result;
+
+static int CompareDoubles( const void* a, const void* b )
+{
+	double x = *(const double*)a, y = *(const double*)b;
+	return (x > y) - (x < y);
+}
+
+static Result Measure( const Bench* b, unsigned runs, double warmup_ns, double run_ns )
+{
+	if( b->setup )  b->setup();
+
+	// warm up the caches and the branch predictors, and see how fast the rounds go
+	unsigned long rounds = 0;
+	double started = Now_ns(), elapsed;
+	do
+	{
+		b->run();
+		++rounds;
+	}
+	while( (elapsed = Now_ns() - started) < warmup_ns );
+
+	Result r = { .rounds = (unsigned long)(rounds * run_ns / elapsed) };
+	if( r.rounds == 0 )  r.rounds = 1;
+
+	double* samples = malloc(runs * sizeof(double));
+	if( samples == NULL )  exit(1);
+	for( unsigned i = 0; i < runs; ++i )
+	{
+		size_t units = 0;
+		double t0 = Now_ns();
+		for( unsigned long k = 0; k < r.rounds; ++k )  units += b->run();
+		samples[i] = (Now_ns() - t0) / (units ? units : 1);
+	}
+	qsort(samples, runs, sizeof(double), CompareDoubles);
+	r.median = (runs % 2) ? samples[runs / 2] : (samples[runs / 2 - 1] + samples[runs / 2]) / 2;
+	r.p99 = samples[(runs * 99 + 99) / 100 - 1];   // the nearest rank
+	r.min = samples[0];
+	r.max = samples[runs - 1];
+	free(samples);
+	return r;
+}
+
+// the median of `name` in an earlier JSON output, or 0
+static double BaselineMedian( const char* json, const char* name )
+{
+	char key [80];
+	snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+	const char* p = json ? strstr(json, key) : NULL;
+	if( p == NULL )  return 0;
+	p = strstr(p, "\"median_ns\": ");
+	return p ? strtod(p + strlen("\"median_ns\": "), NULL) : 0;
+}
+
+static char* ReadFile( const char* path )
+{
+	FILE* f = fopen(path, "rb");
+	if( f == NULL )  return NULL;
+	char* text = NULL;
+	size_t length = 0;
+	char chunk [4096];
+	size_t n;
+	while( (n = fread(chunk, 1, sizeof(chunk), f)) > 0 )
+	{
+		char* grown = realloc(text, length + n + 1);
+		if( grown == NULL )  break;
+		text = grown;
+		memcpy(text + length, chunk, n);
+		length += n;
+		text[length] = 0;
+	}
+	fclose(f);
+	return text;
+}
+
+static bool Selected( const char* name, int argc, char* argv[], int first )
+{
+	if( first == argc )  return true;
+	for( int i = first; i < argc; ++i )
+		if( strncmp(name, argv[i], strlen(argv[i])) == 0 )  return true;
+	return false;
+}
+
+int main( int argc, char* argv[] )
+{
+	unsigned long runs = 15, warmup_ms = 100, run_ms = 20;
+	const char *json_path = NULL, *baseline_path = NULL;
+	int first = 1;
+	for( ; (first < argc) && (argv[first][0] == '-'); ++first )
+	{
+		const char* arg = argv[first];
+		if( !ParseArg(arg, "--runs", &runs) && !ParseArg(arg, "--warmup", &warmup_ms)
+		    && !ParseArg(arg, "--run-time", &run_ms) && !ParseStringArg(arg, "--json", &json_path)
+		    && !ParseStringArg(arg, "--baseline", &baseline_path) )
+		{
+			fprintf(stderr, "usage: %s [--runs=N] [--warmup=MS] [--run-time=MS] [--json=FILE] [--baseline=FILE] [NAME...]\n",
+			        argv[0]);
+			return 1;
+		}
+	}
+	if( runs == 0 )  runs = 1;
+
+	char* baseline = NULL;
+	if( baseline_path && !(baseline = ReadFile(baseline_path)) )
+	{
+		fprintf(stderr, "cannot read %s\n", baseline_path);
+		return 1;
+	}
+	FILE* json = NULL;
+	if( json_path && !(json = fopen(json_path, "w")) )
+	{
+		fprintf(stderr, "cannot write %s\n", json_path);
+		return 1;
+	}
+	if( json )  fprintf(json, "{\n  \"runs\": %lu,\n  \"benchmarks\": [", runs);
+
+	printf("%-18s %-13s %10s %10s %10s %10s %10s%s\n", "benchmark", "ns per", "median", "p99", "min", "max",
+	       "rounds", baseline ? "  vs baseline" : "");
+	unsigned count = 0;
+	for( unsigned i = 0; i < COUNTOF(kBenches); ++i )
+	{
+		const Bench* b = &kBenches[i];
+		if( !Selected(b->name, argc, argv, first) )  continue;
+
+		Result r = Measure(b, runs, warmup_ms * 1e6, run_ms * 1e6);
+		printf("%-18s %-13s %10.2f %10.2f %10.2f %10.2f %10lu", b->name, b->unit, r.median, r.p99, r.min, r.max,
+		       r.rounds);
+		double old = BaselineMedian(baseline, b->name);
+		if( old > 0 )  printf("  %+6.1f%%", (r.median / old - 1) * 100);
+		else if( baseline )  printf("  (new)");
+		printf("\n");
+		fflush(stdout);
+
+		if( json )
+		{
+			fprintf(json, "%s\n    { \"name\": \"%s\", \"unit\": \"%s\", \"median_ns\": %.3f, \"p99_ns\": %.3f, "
+			              "\"min_ns\": %.3f, \"max_ns\": %.3f, \"rounds\": %lu }",
+			        count ? "," : "", b->name, b->unit, r.median, r.p99, r.min, r.max, r.rounds);
+		}
+		++count;
+	}
+
+	if( json )
+	{
+		fprintf(json, "\n  ]\n}\n");
+		fclose(json);
+	}
+	free(baseline);
+	free(gOutput);
+	return 0;
+}
@@ -0,0 +1,157 @@
+// Measures the character name index (src/names.c): the time to map it, how much of it
+// is resident after some lookups, and the latency of the lookups both ways. Linux only
+// (/proc/self/smaps). The Rss of the mapping includes the pages the kernel maps around
+// those actually faulted in, if they are in the page cache anyway; the page faults are
+// what the lookups really touched. The index file is $KBSW_NAMES, or kbsw-names.bin next to namebench:
+//
+// ucdgen names UCD_DIR kbsw-names.bin
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o namebench namebench.c ../src/names.c ../src/names_posix.c ../src/translate.c ../src/hex.c ../src/grapheme.c ../src/casemap.c
+//
+// namebench [--lookups=N]
+
+#define _DEFAULT_SOURCE   // getrusage
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "names.h"
+
+static double Seconds( void )
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned long* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+// the KB of the mapping that the process has touched (its Rss in /proc/self/smaps)
+static unsigned long ResidentKB( const NameIndex* ix )
+{
+	FILE* f = fopen("/proc/self/smaps", "r");
+	if( !f )  return 0;
+
+	char line [512];
+	bool in_mapping = false;
+	unsigned long kb = 0;
+	while( fgets(line, sizeof(line), f) )
+	{
+		unsigned long first, last;
+		if( sscanf(line, "%lx-%lx ", &first, &last) == 2 )
+			in_mapping = (first <= (uintptr_t)ix->data) && ((uintptr_t)ix->data < last);
+		else if( in_mapping && (sscanf(line, "Rss: %lu kB", &kb) == 1) )
+			break;
+	}
+	fclose(f);
+	return kb;
+}
+
+static long PageFaults( void )
+{
+	struct rusage ru;
+	return (getrusage(RUSAGE_SELF, &ru) == 0) ? ru.ru_minflt + ru.ru_majflt : 0;
+}
+
+static uint32_t gRandom = 2463534242u;
+
+static uint32_t Random( void )
+{
+	gRandom ^= gRandom << 13;
+	gRandom ^= gRandom >> 17;
+	gRandom ^= gRandom << 5;
+	return gRandom;
+}
+
+int main( int argc, char* argv[] )
+{
+	unsigned long nlookups = 1000000;
+	for( int i = 1; i < argc; ++i )
+	{
+		if( ParseArg(argv[i], "--lookups", &nlookups) )  nlookups = nlookups ? nlookups : 1;
+		else
+		{
+			fprintf(stderr, "usage: %s [--lookups=N]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	long faults = PageFaults();
+	double t0 = Seconds();
+	const NameIndex* ix = NamesLoad();
+	double t1 = Seconds();
+	long load_faults = PageFaults() - faults;
+	if( !ix )  return fprintf(stderr, "no index file (see the comment in namebench.c)\n"), 1;
+
+	const NameFileHeader* h = ix->header;
+	printf("Unicode %.16s: %u names of their own, %u ranges\n", h->unicode_version, h->ncodepoints, h->nranges);
+	printf("mapped %u KB in %.0f us (%ld page faults); resident: %lu KB\n",
+	       h->size / 1024, (t1 - t0) * 1e6, load_faults, ResidentKB(ix));
+
+	char name [NAMES_MAX_LENGTH];
+	uint32_t cp;
+	faults = PageFaults();
+	NameOfCodepoint(ix, 0x1F4A1, name, sizeof(name));
+	CodepointOfName(ix, name, strlen(name), &cp);
+	faults = PageFaults() - faults;
+	printf("after one lookup each way (%s): %ld page faults; resident %lu KB\n\n", name, faults, ResidentKB(ix));
+
+	// the codepoints to look up: mostly ones with names of their own, some with derived
+	// names (CJK, Hangul), some with no name at all
+	uint32_t* cps = malloc(nlookups * sizeof(uint32_t));
+	char (*names) [NAMES_MAX_LENGTH] = malloc(nlookups * NAMES_MAX_LENGTH);
+	if( !cps || !names )  return fprintf(stderr, "out of memory\n"), 1;
+	for( unsigned long i = 0; i < nlookups; ++i )
+	{
+		uint32_t r = Random();
+		switch( r % 8 )
+		{
+			case 0:   cps[i] = 0x4E00 + (r >> 3) % 0x5200;  break;
+			case 1:   cps[i] = 0xAC00 + (r >> 3) % 11172;  break;
+			case 2:   cps[i] = 0xE0000 + (r >> 3) % 0x10000;  break;
+			default:  cps[i] = ix->codepoints[(r >> 3) % h->ncodepoints];  break;
+		}
+	}
+
+	size_t total = 0, named = 0;
+	double t2 = Seconds();
+	for( unsigned long i = 0; i < nlookups; ++i )
+	{
+		size_t n = NameOfCodepoint(ix, cps[i], names[i], NAMES_MAX_LENGTH);
+		if( n == 0 )  names[i][0] = 0;
+		total += n;
+		named += (n != 0);
+	}
+	double t3 = Seconds();
+
+	size_t found = 0, mismatched = 0;
+	for( unsigned long i = 0; i < nlookups; ++i )
+	{
+		if( names[i][0] && CodepointOfName(ix, names[i], strlen(names[i]), &cp) )
+		{
+			++found;
+			mismatched += (cp != cps[i]);
+		}
+	}
+	double t4 = Seconds();
+
+	printf("%-14s %12s %10s\n", "lookup", "ns each", "hits");
+	printf("%-14s %12.1f %10zu   (%zu chars of names)\n", "codepoint->name", (t3 - t2) * 1e9 / nlookups, named, total);
+	printf("%-14s %12.1f %10zu\n", "name->codepoint", (t4 - t3) * 1e9 / named, found);
+	printf("\nresident after %lu lookups: %lu KB\n", nlookups, ResidentKB(ix));
+	if( (found != named) || mismatched )  printf("MISMATCH: %zu names not found, %zu wrong\n", named - found, mismatched);
+
+	free(cps);
+	free(names);
+	return ((found != named) || mismatched) ? 1 : 0;
+}
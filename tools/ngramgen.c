@@ -0,0 +1,294 @@
+// Generates the letter trigram models of the languages (see src/livedetect.h) from plain
+// text in them (UTF-8): the more of it, the better; a few MB of prose is plenty.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o ngramgen ngramgen.c -lm
+//
+// ngramgen LANG=FILE [LANG=FILE...] > ../src/ngramtab.h
+//     LANG is the ISO 639-1 code of the language (en, ru, ...)
+//
+// The letters of a model are those of the script of its most common letter that make
+// up at least 1/2000 of the letters of the text. The costs of what follows a pair of
+// symbols are -log2 of the probabilities, rounded to whole bits (up to 15): of the
+// trigrams, for the pairs seen at least MIN_CONTEXT times; for the other pairs, of
+// the bigrams that start with the second symbol. The identical rows are stored once.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include "casemap.h"
+#include "casetab.h"
+
+#define COUNTOF(a)  (sizeof(a) / sizeof((a)[0]))
+
+enum
+{
+	CODESPACE = 0x110000,
+	MAX_SYMBOLS = 64,
+	MIN_CONTEXT = 100,
+	MIN_LETTER_SHARE = 2000,   // 1/n of the letters
+};
+
+static bool gIsLetter [CODESPACE];   // has a case, or is the lower case of something
+
+static const CaseRecord* RecordOf( uint32_t cp )
+{
+	if( cp >= CASE_LIMIT )  return &kCaseRecords[0];
+	return &kCaseRecords[kCaseBlocks[kCaseIndex[cp >> CASE_BLOCK_SHIFT]][cp & ((1 << CASE_BLOCK_SHIFT) - 1)]];
+}
+
+static void InitLetters( void )
+{
+	for( uint32_t cp = 0; cp < CASE_LIMIT; ++cp )
+	{
+		const CaseRecord* r = RecordOf(cp);
+		if( (r->upper | r->lower | r->title) == 0 )  continue;
+		gIsLetter[cp] = true;
+		gIsLetter[cp + r->lower] = true;
+	}
+}
+
+static bool IsSpace( uint32_t cp )
+{
+	return (cp <= 0x20) || (cp == 0x85) || (cp == 0xA0) || ((cp >= 0x2000) && (cp <= 0x200A))
+	    || (cp == 0x2028) || (cp == 0x2029) || (cp == 0x202F) || (cp == 0x3000);
+}
+
+static unsigned Script( uint32_t cp )
+{
+	if( (cp < 0x250) || ((cp >= 0x1E00) && (cp < 0x1F00)) )  return 1;   // Latin
+	if( ((cp >= 0x370) && (cp < 0x400)) || ((cp >= 0x1F00) && (cp < 0x2000)) )  return 2;   // Greek
+	if( (cp >= 0x400) && (cp < 0x530) )  return 3;   // Cyrillic
+	return 4 + (cp >> 8);
+}
+
+// decodes UTF-8, skipping what isn't
+static uint32_t* Decode( const unsigned char* p, size_t n, size_t* pcount )
+{
+	uint32_t* out = malloc((n + 1) * sizeof(uint32_t));
+	if( out == NULL )  return NULL;
+	size_t count = 0;
+	for( size_t i = 0; i < n; )
+	{
+		unsigned len = (p[i] < 0x80) ? 1 : (p[i] < 0xC2) ? 0 : (p[i] < 0xE0) ? 2 : (p[i] < 0xF0) ? 3 : (p[i] < 0xF5) ? 4 : 0;
+		if( (len == 0) || (i + len > n) )
+		{
+			++i;
+			continue;
+		}
+		uint32_t u = (len == 1) ? p[i] : (p[i] & (0x3F >> (len - 1)));
+		bool ok = true;
+		for( unsigned k = 1; k < len; ++k )
+		{
+			ok &= ((p[i + k] & 0xC0) == 0x80);
+			u = (u << 6) | (p[i + k] & 0x3F);
+		}
+		i += ok ? len : 1;
+		if( ok && (u < CODESPACE) )  out[count++] = u;
+	}
+	*pcount = count;
+	return out;
+}
+
+typedef struct
+{
+	char      language [4];
+	unsigned  nsymbols;
+	uint32_t  letters [MAX_SYMBOLS];
+	unsigned  nrows;
+	uint8_t*  rows;           // nsymbols costs each, unpacked
+	uint16_t  contexts [MAX_SYMBOLS * MAX_SYMBOLS];
+	size_t    text_size;
+} Model;
+
+static unsigned AddRow( Model* m, const uint8_t* row )
+{
+	for( unsigned i = 0; i < m->nrows; ++i )
+	{
+		if( memcmp(m->rows + i * m->nsymbols, row, m->nsymbols) == 0 )  return i;
+	}
+	memcpy(m->rows + m->nrows * m->nsymbols, row, m->nsymbols);
+	return m->nrows++;
+}
+
+static uint8_t Cost( double p )
+{
+	long q = lround(-log2(p));
+	return (q < 0) ? 0 : (q > 15) ? 15 : (uint8_t)q;
+}
+
+static int CompareLetters( const void* a, const void* b )
+{
+	uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+	return (x > y) - (x < y);
+}
+
+static bool BuildModel( Model* m, const char* language, const char* path )
+{
+	FILE* f = fopen(path, "rb");
+	if( f == NULL )  return fprintf(stderr, "cannot open %s\n", path), false;
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	unsigned char* bytes = malloc(size > 0 ? size : 1);
+	if( (bytes == NULL) || (fread(bytes, 1, size, f) != (size_t)size) )
+		return fprintf(stderr, "cannot read %s\n", path), fclose(f), false;
+	fclose(f);
+
+	size_t n;
+	uint32_t* text = Decode(bytes, size, &n);
+	free(bytes);
+	if( text == NULL )  return fprintf(stderr, "out of memory\n"), false;
+
+	// the alphabet
+	static uint32_t counts [CODESPACE];
+	memset(counts, 0, sizeof(counts));
+	uint64_t nletters = 0;
+	uint32_t top = 0;
+	for( size_t i = 0; i < n; ++i )
+	{
+		text[i] += RecordOf(text[i])->lower;
+		if( !gIsLetter[text[i]] )  continue;
+		++nletters;
+		if( ++counts[text[i]] > counts[top] )  top = text[i];
+	}
+	if( nletters == 0 )  return fprintf(stderr, "%s: no letters\n", path), free(text), false;
+
+	memset(m, 0, sizeof(*m));
+	snprintf(m->language, sizeof(m->language), "%s", language);
+	m->text_size = size;
+	unsigned nalphabet = 0;
+	for( uint32_t cp = 0; cp < CODESPACE; ++cp )
+	{
+		if( !counts[cp] || (Script(cp) != Script(top)) || ((uint64_t)counts[cp] * MIN_LETTER_SHARE < nletters) )  continue;
+		if( nalphabet + 2 == MAX_SYMBOLS )  return fprintf(stderr, "%s: too many letters\n", path), free(text), false;
+		m->letters[nalphabet++] = cp;
+	}
+	qsort(m->letters, nalphabet, sizeof(m->letters[0]), CompareLetters);
+	unsigned N = m->nsymbols = nalphabet + 2;
+
+	// the counts of the trigrams: words are the runs of anything but whitespace, with
+	// two boundaries before and one after
+	static uint8_t symbol_of [CODESPACE];
+	memset(symbol_of, 1, sizeof(symbol_of));
+	for( unsigned i = 0; i < nalphabet; ++i )  symbol_of[m->letters[i]] = i + 2;
+
+	static uint64_t c3 [MAX_SYMBOLS][MAX_SYMBOLS][MAX_SYMBOLS];
+	memset(c3, 0, sizeof(c3));
+	unsigned a = 0, b = 0;
+	for( size_t i = 0; i <= n; ++i )
+	{
+		bool space = (i == n) || IsSpace(text[i]);
+		if( space && (b == 0) )  continue;   // (a = b = 0 between words)
+		unsigned c = space ? 0 : symbol_of[text[i]];
+		++c3[a][b][c];
+		a = space ? 0 : b;
+		b = c;
+	}
+	free(text);
+
+	// the costs
+	static uint64_t c2 [MAX_SYMBOLS][MAX_SYMBOLS], c1 [MAX_SYMBOLS], context [MAX_SYMBOLS][MAX_SYMBOLS];
+	memset(c2, 0, sizeof(c2));
+	memset(c1, 0, sizeof(c1));
+	memset(context, 0, sizeof(context));
+	for( unsigned x = 0; x < N; ++x )
+	for( unsigned y = 0; y < N; ++y )
+	for( unsigned z = 0; z < N; ++z )
+	{
+		c2[y][z] += c3[x][y][z];
+		c1[y] += c3[x][y][z];
+		context[x][y] += c3[x][y][z];
+	}
+
+	m->rows = malloc((N * N + N) * N);
+	if( m->rows == NULL )  return fprintf(stderr, "out of memory\n"), false;
+	uint8_t row [MAX_SYMBOLS];
+	for( unsigned x = 0; x < N; ++x )
+	for( unsigned y = 0; y < N; ++y )
+	{
+		for( unsigned z = 0; z < N; ++z )
+		{
+			double bigram = (c2[y][z] + 0.1) / (c1[y] + 0.1 * N);
+			row[z] = Cost((context[x][y] >= MIN_CONTEXT) ? (c3[x][y][z] + 0.5 * bigram) / (context[x][y] + 0.5) : bigram);
+		}
+		m->contexts[x * N + y] = AddRow(m, row);
+	}
+	return true;
+}
+
+static void PrintArray( const char* type, const char* name, const char* suffix, unsigned count,
+                        unsigned per_line, unsigned (*get)( const Model*, unsigned ), const Model* m,
+                        const char* format )
+{
+	printf("static const %s %s%s [%u] =\n{", type, name, suffix, count);
+	for( unsigned i = 0; i < count; ++i )
+	{
+		printf((i % per_line) ? " " : "\n\t");
+		printf(format, get(m, i));
+		printf(",");
+	}
+	printf("\n};\n\n");
+}
+
+static unsigned GetLetter( const Model* m, unsigned i )  { return m->letters[i]; }
+static unsigned GetContext( const Model* m, unsigned i )  { return m->contexts[i]; }
+
+static unsigned GetCostByte( const Model* m, unsigned i )
+{
+	unsigned stride = (m->nsymbols + 1) / 2, r = i / stride, k = (i % stride) * 2;
+	const uint8_t* row = m->rows + r * m->nsymbols;
+	return row[k] | ((k + 1 < m->nsymbols) ? row[k + 1] << 4 : 0);
+}
+
+int main( int argc, char* argv[] )
+{
+	if( argc < 2 )
+	{
+		fprintf(stderr, "usage: %s LANG=FILE [LANG=FILE...] > ngramtab.h\n", argv[0]);
+		return 1;
+	}
+	InitLetters();
+
+	static Model models [16];
+	unsigned nmodels = argc - 1;
+	if( nmodels > COUNTOF(models) )  return fprintf(stderr, "too many languages\n"), 1;
+
+	printf("// Generated by tools/ngramgen.c. Do not edit.\n//\n");
+	for( unsigned i = 0; i < nmodels; ++i )
+	{
+		const char* eq = strchr(argv[i + 1], '=');
+		if( !eq || (eq == argv[i + 1]) || (eq - argv[i + 1] > 3) )  return fprintf(stderr, "bad argument: %s\n", argv[i + 1]), 1;
+
+		char language [4] = {0};
+		memcpy(language, argv[i + 1], eq - argv[i + 1]);
+		if( !BuildModel(&models[i], language, eq + 1) )  return 1;
+
+		const Model* m = &models[i];
+		printf("// %s: %u symbols, %u rows, %u + %u bytes; from %zu KB of text\n", m->language, m->nsymbols,
+		       m->nrows, m->nsymbols * m->nsymbols * 2, m->nrows * ((m->nsymbols + 1) / 2), m->text_size / 1024);
+	}
+	printf("\n");
+
+	for( unsigned i = 0; i < nmodels; ++i )
+	{
+		const Model* m = &models[i];
+		char suffix [4] = { toupper(m->language[0]), m->language[1], m->language[2], 0 };
+		PrintArray("UTF16", "kLetters", suffix, m->nsymbols - 2, 12, GetLetter, m, "0x%04X");
+		PrintArray("uint16_t", "kContexts", suffix, m->nsymbols * m->nsymbols, 16, GetContext, m, "%u");
+		PrintArray("uint8_t", "kCosts", suffix, m->nrows * ((m->nsymbols + 1) / 2), 16, GetCostByte, m, "%u");
+	}
+
+	printf("static const LangModel kLangModels [%u] =\n{\n", nmodels);
+	for( unsigned i = 0; i < nmodels; ++i )
+	{
+		const Model* m = &models[i];
+		char suffix [4] = { toupper(m->language[0]), m->language[1], m->language[2], 0 };
+		printf("\t{ \"%s\", %u, kLetters%s, kContexts%s, kCosts%s },\n", m->language, m->nsymbols, suffix, suffix, suffix);
+	}
+	printf("};\n");
+	return 0;
+}
@@ -0,0 +1,324 @@
+// A discrete-event simulator of the selection translation pipeline (src/pipeline.c):
+// runs the real state machine in virtual time against models of applications with
+// various copy/paste latencies and failure modes, and reports how a given set of
+// timeouts works out for them.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o pipesim pipesim.c ../src/pipeline.c ../src/trace.c
+//
+// pipesim [--wmcopy=MS] [--keyboard-copy=MS] [--paste-delay=MS] [--timer=MS] [--count=N] [--seed=N]
+//         [--typed=0|1]   (whether the apps without special handling get short translations typed)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "pipeline.h"
+#include "trace.h"
+
+typedef struct { uint32_t min_ms, max_ms; } Range;
+
+typedef struct
+{
+	const char*      name;
+	SpecialHandling  sh;
+	double           wmcopy_rate;    // how often the app reacts to WM_COPY
+	Range            wmcopy_ms;      // ... and how soon the clipboard is updated then
+	double           keycopy_rate;   // the same for the copy keys
+	Range            keycopy_ms;
+	Range            settle_ms;      // a paste that comes sooner than this after the clipboard
+	                                 // update gets the old contents
+} AppModel;
+
+static const AppModel kApps [] =
+{
+	{ "edit control",  shNoSpecialHandling, 1.00, {  1,   5 }, 1.00, {  5,  20 }, {  0,   0 } },
+	{ "browser",       shNoSpecialHandling, 0.00, {  0,   0 }, 1.00, { 20,  80 }, {  0,  20 } },
+	{ "far",           shNoSpecialHandling, 0.00, {  0,   0 }, 1.00, { 10,  40 }, { 30, 150 } },
+	{ "console",       shCtrlInsert,        0.00, {  0,   0 }, 1.00, {  5,  30 }, {  0,   0 } },
+	{ "slow ide",      shNoSpecialHandling, 1.00, { 50, 250 }, 1.00, { 50, 250 }, {  0,  30 } },
+	{ "flaky",         shNoSpecialHandling, 0.50, { 10, 150 }, 0.90, { 30, 400 }, {  0,  50 } },
+};
+
+typedef enum
+{
+	outOk,
+	outNoCopy,      // both copy attempts timed out
+	outClobbered,   // a late copy overwrote the translated text before the paste
+	outEarlyPaste,  // pasted before the app could see the new clipboard contents
+	OUTCOMES
+} Outcome;
+
+static const char* const kOutcomeNames [OUTCOMES] = { "ok", "no copy", "clobbered", "early paste" };
+
+enum { MAX_EVENTS = 4 };
+
+// the simulated world
+typedef struct
+{
+	const AppModel*  app;
+	uint64_t         now_us;
+	uint32_t         timer_ms;
+	bool             timer_on;
+	uint64_t         next_tick_us;
+	uint64_t         clipboard_events [MAX_EVENTS];   // pending app clipboard updates
+	unsigned         nevents;
+	uint64_t         translated_us;
+	uint32_t         settle_ms;
+	bool             clobbered;
+	bool             pasted_ok;
+	bool             done;
+	uint64_t         paste_us;
+	uint64_t         rng;
+	bool             typed;        // --typed
+} World;
+
+static World gWorld;
+
+static uint64_t Random( void )
+{
+	// xorshift64*
+	uint64_t x = gWorld.rng;
+	x ^= x >> 12;  x ^= x << 25;  x ^= x >> 27;
+	gWorld.rng = x;
+	return x * 0x2545F4914F6CDD1DULL;
+}
+
+static double Chance( void )
+{
+	return (Random() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static uint32_t Pick( Range r )
+{
+	return r.min_ms + (uint32_t)(Random() % (r.max_ms - r.min_ms + 1));
+}
+
+static void Schedule( uint32_t delay_ms )
+{
+	if( gWorld.nevents < MAX_EVENTS )
+		gWorld.clipboard_events[gWorld.nevents++] = gWorld.now_us + delay_ms * 1000ULL;
+}
+
+uint64_t AppTraceNow_us( void )
+{
+	return gWorld.now_us;
+}
+
+// ---- the host -------------------------------------------------------------------
+
+static uint32_t SimNow( void* _ )
+{
+	return (uint32_t)(gWorld.now_us / 1000);
+}
+
+static bool SimStartTimer( void* _ )
+{
+	gWorld.timer_on = true;
+	gWorld.next_tick_us = gWorld.now_us + gWorld.timer_ms * 1000ULL;
+	return true;
+}
+
+static void SimStopTimer( void* _ )
+{
+	gWorld.timer_on = false;
+}
+
+static SpecialHandling SimSpecialHandling( void* _, PipeWindow target )
+{
+	return gWorld.app->sh;
+}
+
+static void SimPostCopy( void* _, PipeWindow target )
+{
+	if( Chance() < gWorld.app->wmcopy_rate )  Schedule(Pick(gWorld.app->wmcopy_ms));
+}
+
+static bool SimSendCopyKeys( void* _, SpecialHandling sh )
+{
+	if( Chance() < gWorld.app->keycopy_rate )  Schedule(Pick(gWorld.app->keycopy_ms));
+	return true;
+}
+
+static bool SimSendPasteKeys( void* _, SpecialHandling sh )
+{
+	gWorld.paste_us = gWorld.now_us;
+	gWorld.pasted_ok = (gWorld.now_us - gWorld.translated_us) >= gWorld.settle_ms * 1000ULL;
+	return true;
+}
+
+static PipeOutput SimTranslateClipboard( void* _, PipeLayout target_layout, SpecialHandling sh )
+{
+	gWorld.translated_us = gWorld.now_us;
+	if( !gWorld.typed || (sh != shNoSpecialHandling) )  return poPaste;
+
+	// typed right away: nothing to settle in the clipboard
+	gWorld.paste_us = gWorld.now_us;
+	gWorld.pasted_ok = true;
+	return poTyped;
+}
+
+static void SimIdle( void* _, bool pasted )
+{
+	gWorld.done = true;
+}
+
+// ---- the simulation -------------------------------------------------------------
+
+// runs one translation to the end; returns its outcome and latency
+static Outcome Simulate( Pipeline* p, uint32_t* platency_ms )
+{
+	uint64_t start_us = gWorld.now_us;
+	gWorld.nevents = 0;
+	gWorld.done = gWorld.clobbered = gWorld.pasted_ok = false;
+	gWorld.paste_us = 0;
+	gWorld.settle_ms = Pick(gWorld.app->settle_ms);
+
+	PipelineStart(p, 1, 2);
+	while( !gWorld.done )
+	{
+		// the earliest pending event
+		int next = -1;
+		uint64_t next_us = gWorld.timer_on ? gWorld.next_tick_us : UINT64_MAX;
+		for( unsigned i = 0; i < gWorld.nevents; ++i )
+		{
+			if( gWorld.clipboard_events[i] < next_us )
+			{
+				next = i;
+				next_us = gWorld.clipboard_events[i];
+			}
+		}
+		if( next_us == UINT64_MAX )  break;  // nothing will ever happen
+
+		gWorld.now_us = next_us;
+		if( next < 0 )
+		{
+			gWorld.next_tick_us += gWorld.timer_ms * 1000ULL;
+			PipelineOnTimer(p);
+		}
+		else
+		{
+			gWorld.clipboard_events[next] = gWorld.clipboard_events[--gWorld.nevents];
+			if( p->state == psDelayBeforePaste )  gWorld.clobbered = true;
+			PipelineOnClipboardUpdate(p);
+		}
+	}
+
+	// let the app finish whatever it was doing, then pause a bit before the next one
+	for( unsigned i = 0; i < gWorld.nevents; ++i )
+	{
+		if( gWorld.clipboard_events[i] > gWorld.now_us )  gWorld.now_us = gWorld.clipboard_events[i];
+	}
+	gWorld.now_us += 1000000;
+
+	*platency_ms = (uint32_t)((gWorld.paste_us - start_us) / 1000);
+	return (gWorld.paste_us == 0) ? outNoCopy
+	     : gWorld.clobbered ? outClobbered
+	     : !gWorld.pasted_ok ? outEarlyPaste
+	     : outOk;
+}
+
+static int CompareU32( const void* a, const void* b )
+{
+	uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+	return (x > y) - (x < y);
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned long* pvalue )
+{
+	size_t n = strlen(name);
+	if( strncmp(arg, name, n) != 0 || arg[n] != '=' )  return false;
+	*pvalue = strtoul(arg + n + 1, NULL, 10);
+	return true;
+}
+
+int main( int argc, char* argv[] )
+{
+	PipelineTimeouts timeouts = PIPELINE_DEFAULT_TIMEOUTS;
+	unsigned long count = 10000, seed = 1, timer_ms = 16, typed = 0;  // SetTimer(10) fires on the 15.6ms system tick
+
+	for( int i = 1; i < argc; ++i )
+	{
+		unsigned long v;
+		if(      ParseArg(argv[i], "--wmcopy", &v) )         timeouts.wmcopy_ms = v;
+		else if( ParseArg(argv[i], "--keyboard-copy", &v) )  timeouts.keyboard_copy_ms = v;
+		else if( ParseArg(argv[i], "--paste-delay", &v) )    timeouts.paste_delay_ms = v;
+		else if( ParseArg(argv[i], "--timer", &v) )          timer_ms = v ? v : 1;
+		else if( ParseArg(argv[i], "--count", &v) )          count = v ? v : 1;
+		else if( ParseArg(argv[i], "--seed", &v) )           seed = v;
+		else if( ParseArg(argv[i], "--typed", &v) )          typed = v;
+		else
+		{
+			fprintf(stderr, "usage: %s [--wmcopy=MS] [--keyboard-copy=MS] [--paste-delay=MS]"
+			                " [--timer=MS] [--count=N] [--seed=N] [--typed=0|1]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	const PipelineHost host =
+	{
+		.now_ms = SimNow,
+		.start_timer = SimStartTimer,
+		.stop_timer = SimStopTimer,
+		.special_handling = SimSpecialHandling,
+		.post_copy = SimPostCopy,
+		.send_copy_keys = SimSendCopyKeys,
+		.send_paste_keys = SimSendPasteKeys,
+		.translate_clipboard = SimTranslateClipboard,
+		.idle = SimIdle,
+	};
+
+	uint32_t* latencies = malloc(count * sizeof(uint32_t));
+	if( latencies == NULL )  return fprintf(stderr, "out of memory\n"), 1;
+
+	printf("timeouts: WM_COPY %lums, keyboard copy %lums, paste delay %lums; timer %lums; %lu runs per app\n\n",
+	       (unsigned long)timeouts.wmcopy_ms, (unsigned long)timeouts.keyboard_copy_ms,
+	       (unsigned long)timeouts.paste_delay_ms, timer_ms, count);
+	printf("%-14s %7s %8s %10s %12s   %6s %6s %6s %6s\n",
+	       "app", "ok", "no copy", "clobbered", "early paste", "p50", "p90", "p99", "max");
+
+	clock_t started = clock();
+	for( unsigned a = 0; a < sizeof(kApps) / sizeof(kApps[0]); ++a )
+	{
+		memset(&gWorld, 0, sizeof(gWorld));
+		gWorld.app = &kApps[a];
+		gWorld.timer_ms = timer_ms;
+		gWorld.typed = (typed != 0);
+		gWorld.rng = seed * 0x9E3779B97F4A7C15ULL + a + 1;
+
+		Pipeline p;
+		PipelineInit(&p, &host, &timeouts);
+
+		unsigned long outcomes [OUTCOMES] = {0}, nlatencies = 0;
+		for( unsigned long i = 0; i < count; ++i )
+		{
+			uint32_t latency_ms;
+			Outcome out = Simulate(&p, &latency_ms);
+			++outcomes[out];
+			if( out == outOk )  latencies[nlatencies++] = latency_ms;
+		}
+
+		printf("%-14s", kApps[a].name);
+		for( unsigned o = 0; o < OUTCOMES; ++o )
+			printf(" %*.1f%%", (int)strlen(kOutcomeNames[o]) + ((o == 0) ? 4 : 0), 100.0 * outcomes[o] / count);
+
+		if( nlatencies )
+		{
+			qsort(latencies, nlatencies, sizeof(latencies[0]), CompareU32);
+			printf("   %6lu %6lu %6lu %6lu\n",
+			       (unsigned long)latencies[nlatencies * 50 / 100],
+			       (unsigned long)latencies[nlatencies * 90 / 100],
+			       (unsigned long)latencies[nlatencies * 99 / 100],
+			       (unsigned long)latencies[nlatencies - 1]);
+		}
+		else printf("   %6s %6s %6s %6s\n", "-", "-", "-", "-");
+	}
+	double seconds = (double)(clock() - started) / CLOCKS_PER_SEC;
+
+	printf("\nlatencies (ms) are from the activation to the paste, for the successful runs\n");
+	printf("%.0f simulated translations per second\n",
+	       count * (sizeof(kApps) / sizeof(kApps[0])) / (seconds > 0 ? seconds : 1e-9));
+	free(latencies);
+	return 0;
+}
@@ -0,0 +1,239 @@
+// A stress test of the config cell (src/rcu.c) and a measure of its costs: a writer
+// thread publishes snapshots as fast as it can while a reader thread reads them, as
+// the hook does, and checks each one all the time it holds it. The writer recycles the
+// released snapshots at once, rewriting them, so a snapshot released too early is seen
+// changed (torn) by the reader.
+//   - the reader reading all the time: no torn snapshot, and every
+//     snapshot released once, by the end;
+//   - the reader idle (an idle keyboard): the publishes never fail, and the retired
+//     snapshots are released at once;
+//   - the reader stuck in a section: the publishes fail once RCU_MAX_RETIRED are
+//     waiting, and go through again once it is out;
+// then the cost of a read-side section, and of a publish.
+//
+// gcc -std=c11 -Wall -Werror -O2 -pthread -I../src -o rcubench rcubench.c ../src/rcu.c
+//
+// rcubench [--publishes=N]
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include "rcu.h"
+#include "check.h"
+
+enum
+{
+	FIELDS   = 8,
+	LIVE     = 0x4C495645,
+	RELEASED = 0x44454144,
+};
+
+// every field holds the serial number of the snapshot while it is live
+typedef struct Snapshot
+{
+	_Atomic uint32_t   magic;
+	_Atomic uint64_t   fields [FIELDS];
+	struct Snapshot*   next_free;
+} Snapshot;
+
+static Snapshot*      gFree;        // writer-only
+static unsigned       gAllocated, gReleased;
+static RcuCell        gCell;
+static atomic_bool    gStop;
+static atomic_bool    gIdle;        // the reader stops reading
+static atomic_bool    gStuck;       // the reader stays in a section
+static atomic_uint    gIdleTicks;   // bumped by the reader while idle ...
+static atomic_uint    gStuckTicks;  // ... and while stuck
+static atomic_ullong  gReads, gTorn;
+
+static uint64_t Now_ns( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void Release( void* p )
+{
+	Snapshot* s = p;
+	atomic_store_explicit(&s->magic, RELEASED, memory_order_relaxed);
+	for( unsigned i = 0; i < FIELDS; ++i )  atomic_store_explicit(&s->fields[i], 0, memory_order_relaxed);
+	s->next_free = gFree;
+	gFree = s;
+	++gReleased;
+}
+
+static Snapshot* Make( uint64_t serial )
+{
+	Snapshot* s = gFree;
+	if( s )  gFree = s->next_free;
+	else     s = calloc(1, sizeof(*s)), ++gAllocated;
+	for( unsigned i = 0; i < FIELDS; ++i )  atomic_store_explicit(&s->fields[i], serial, memory_order_relaxed);
+	atomic_store_explicit(&s->magic, LIVE, memory_order_relaxed);
+	return s;
+}
+
+// still the snapshot it was when first read
+static bool Intact( const Snapshot* s, uint64_t serial )
+{
+	if( atomic_load_explicit(&s->magic, memory_order_relaxed) != LIVE )  return false;
+	for( unsigned i = 0; i < FIELDS; ++i )
+		if( atomic_load_explicit(&s->fields[i], memory_order_relaxed) != serial )  return false;
+	return true;
+}
+
+static void* Reader( void* _ )
+{
+	unsigned long long reads = 0, torn = 0;
+	while( !atomic_load(&gStop) )
+	{
+		if( atomic_load(&gIdle) )
+		{
+			atomic_fetch_add(&gIdleTicks, 1);
+			sched_yield();
+			continue;
+		}
+
+		const Snapshot* s = RcuRead(&gCell);
+		uint64_t serial = atomic_load_explicit(&s->fields[0], memory_order_relaxed);
+		// held a while, as by a callback, and checked all along
+		for( unsigned i = 0; i < 16; ++i )  torn += !Intact(s, serial);
+		while( atomic_load(&gStuck) )
+		{
+			atomic_fetch_add(&gStuckTicks, 1);
+			torn += !Intact(s, serial);
+			sched_yield();
+		}
+		RcuReadEnd(&gCell);
+		// no yielding here: on a single CPU the reader is then mostly taken off in a section
+		++reads;
+	}
+	atomic_store(&gReads, reads);
+	atomic_store(&gTorn, torn);
+	return NULL;
+}
+
+// waits until the reader has been seen idle (or stuck) since the flag was set: it stays so
+// until the flag is cleared
+static void WaitForReader( atomic_uint* ticks )
+{
+	unsigned t = atomic_load(ticks);
+	while( atomic_load(ticks) == t )  sched_yield();
+}
+
+int main( int argc, char* argv [] )
+{
+	unsigned publishes = 2000000;
+	for( int i = 1; i < argc; ++i )
+	{
+		if( (strncmp(argv[i], "--publishes=", 12) == 0) && ((publishes = strtoul(argv[i] + 12, NULL, 10)) > 0) )
+			continue;
+		fprintf(stderr, "usage: rcubench [--publishes=N]\n");
+		return 2;
+	}
+
+	RcuCell init = RCU_CELL_INIT(Release);
+	gCell = init;
+	uint64_t serial = 0;
+	RcuPublish(&gCell, Make(++serial));
+
+	pthread_t reader;
+	pthread_create(&reader, NULL, Reader, NULL);
+
+	// the reader busy
+	unsigned refused = 0;
+	uint64_t t0 = Now_ns();
+	for( unsigned i = 0; i < publishes; ++i )
+	{
+		Snapshot* s = Make(++serial);
+		if( !RcuPublish(&gCell, s) )
+		{
+			// the reader is taken off in a section: let it finish
+			Release(s), --gReleased, ++refused;
+			sched_yield();
+		}
+	}
+	uint64_t publish_ns = Now_ns() - t0;
+
+	// the reader idle: everything goes at once
+	atomic_store(&gIdle, true);
+	WaitForReader(&gIdleTicks);
+	RcuReclaim(&gCell);
+	unsigned idle_refused = 0, idle_pending = 0;
+	for( unsigned i = 0; i < 10000; ++i )
+	{
+		Snapshot* s = Make(++serial);
+		if( !RcuPublish(&gCell, s) )  Release(s), --gReleased, ++idle_refused;
+		idle_pending += gCell.nretired;
+	}
+	atomic_store(&gIdle, false);
+
+	// the reader stuck in a section
+	atomic_store(&gStuck, true);
+	WaitForReader(&gStuckTicks);
+	unsigned accepted = 0;
+	for( unsigned i = 0; i < 2 * RCU_MAX_RETIRED; ++i )
+	{
+		Snapshot* s = Make(++serial);
+		if( RcuPublish(&gCell, s) )  ++accepted;
+		else                          Release(s), --gReleased;
+	}
+	atomic_store(&gIdle, true);
+	atomic_store(&gStuck, false);
+	WaitForReader(&gIdleTicks);
+	bool unstuck = RcuPublish(&gCell, Make(++serial)) && (gCell.nretired == 0);
+
+	atomic_store(&gStop, true);
+	pthread_join(reader, NULL);
+	unsigned long long reads = atomic_load(&gReads), torn = atomic_load(&gTorn);
+	RcuShutdown(&gCell);
+
+	// recycled ones are counted once per use
+	unsigned made = (unsigned)serial - refused - idle_refused - (2 * RCU_MAX_RETIRED - accepted);
+	char what [200];
+	snprintf(what, sizeof(what), "%u publishes (%u refused) against %llu reads: no torn snapshot, "
+	         "%u snapshots allocated in all", publishes, refused, reads, gAllocated);
+	Check((torn == 0) && (reads > 0), what);
+	Check(gReleased == made, "every snapshot released once, by the end");
+	Check((idle_refused == 0) && (idle_pending == 0), "the reader idle: no publish refused, nothing left pending");
+	snprintf(what, sizeof(what), "the reader stuck: %u of %u publishes accepted, then again once it is out",
+	         accepted, 2 * RCU_MAX_RETIRED);
+	Check((accepted == RCU_MAX_RETIRED) && unstuck, what);
+
+	// the costs, uncontended
+	RcuCell cell = RCU_CELL_INIT(Release);
+	gCell = cell;
+	RcuPublish(&gCell, Make(++serial));
+	const unsigned N = 10000000;
+	uint64_t sum = 0;
+	t0 = Now_ns();
+	for( unsigned i = 0; i < N; ++i )
+	{
+		const Snapshot* s = RcuRead(&gCell);
+		sum += atomic_load_explicit(&s->fields[i % FIELDS], memory_order_relaxed);
+		RcuReadEnd(&gCell);
+	}
+	uint64_t read_ns = Now_ns() - t0;
+	t0 = Now_ns();
+	for( unsigned i = 0; i < N / 10; ++i )  RcuPublish(&gCell, Make(++serial));
+	uint64_t solo_ns = Now_ns() - t0;
+	RcuShutdown(&gCell);
+
+	printf("a read-side section: %.1f ns; a publish: %.1f ns alone, %.1f ns with a busy reader, yields included (%llu)\n",
+	       (double)read_ns / N, (double)solo_ns / (N / 10), (double)publish_ns / publishes, (unsigned long long)sum % 10);
+
+	while( gFree )
+	{
+		Snapshot* s = gFree;
+		gFree = s->next_free;
+		free(s);
+	}
+	return gFailed;
+}
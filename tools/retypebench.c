@@ -0,0 +1,478 @@
+// Checks the pieces of --fix-word that don't need Windows, and measures them:
+//   - the keystroke ring (src/keyhist.c): the wake-ups, the drops, and the order and the
+//     count of what gets through from a producer thread typing as fast as it can;
+//   - which word the detector (src/livedetect.c) gives as the one just typed;
+//   - the retyping (src/retype.c): the events it plans are sent to a fake injector that
+//     applies them to a line of text, which must then read as typed in the right layout.
+// With text files, the words in them are typed in each of the other layouts and retyped.
+//
+// gcc -std=c11 -Wall -Werror -O2 -pthread -I../src -o retypebench retypebench.c ../src/keyhist.c
+//     ../src/livedetect.c ../src/retype.c ../src/inject.c ../src/casemap.c ../src/translate.c
+//     ../src/hex.c ../src/grapheme.c ../src/names.c ../src/names_posix.c
+//
+// retypebench [--events=N] [LANG=FILE...]   (en, ru, uk, de, fr, es)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include "keyhist.h"
+#include "livedetect.h"
+#include "retype.h"
+#include "inject.h"
+#include "common.h"
+#include "rowkeymaps.h"
+#include "check.h"
+
+static double Seconds( void )
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned long* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+// ---- the ring ---------------------------------------------------------------
+
+static KeyHistory  gHistory;
+static unsigned    gWakeups;
+
+static bool Push( unsigned seq )
+{
+	Keystroke ks = { .scancode = 0x1E, .time_ms = seq };
+	return KeyHistoryPush(&gHistory, &ks);
+}
+
+static void CheckRing( void )
+{
+	KeyHistoryInit(&gHistory);
+	Keystroke ks;
+
+	bool woken = Push(0);
+	Check(!woken, "ring: no wake-up before the consumer waits");
+	Check(!KeyHistoryWait(&gHistory), "ring: waiting on a ring with something in it fails");
+	Check(KeyHistoryPop(&gHistory, &ks) && (ks.time_ms == 0) && !KeyHistoryPop(&gHistory, &ks), "ring: what is pushed pops");
+	Check(KeyHistoryWait(&gHistory), "ring: waiting on the empty ring");
+	woken = Push(1);
+	bool again = Push(2);
+	Check(woken && !again, "ring: one wake-up per wait");
+
+	unsigned seq = 3;
+	while( atomic_load(&gHistory.dropped) == 0 )  Push(seq++);
+	Check(seq == KEYHIST_SIZE + 2, "ring: a full ring drops and counts");
+	bool in_order = true;
+	for( unsigned expected = 1; KeyHistoryPop(&gHistory, &ks); ++expected )  in_order &= (ks.time_ms == expected);
+	Check(in_order, "ring: the ones that fit come out in order");
+}
+
+typedef struct { unsigned long count; double seconds; } ProducerArgs;
+
+static atomic_bool  gWake, gDone;   // the producer's side of a message queue
+
+static void* Producer( void* arg )
+{
+	ProducerArgs* pa = arg;
+	double t0 = Seconds();
+	// in bursts, letting the consumer run between them
+	unsigned burst = 0, random = 1;
+	for( unsigned long i = 0; i < pa->count; ++i )
+	{
+		if( Push(i + 1) )
+		{
+			++gWakeups;
+			atomic_store(&gWake, true);
+		}
+		if( burst-- == 0 )
+		{
+			random = random * 1103515245 + 12345;
+			burst = (random >> 16) % (KEYHIST_SIZE / 2);
+			sched_yield();
+		}
+	}
+	pa->seconds = Seconds() - t0;
+	atomic_store(&gDone, true);
+	return NULL;
+}
+
+// The consumer sleeps (spins) while the ring is armed, until woken up: nothing may be
+// left in the ring once the producer is done without having woken it.
+static void RaceRing( unsigned long count )
+{
+	KeyHistoryInit(&gHistory);
+	KeyHistoryWait(&gHistory);
+	gWakeups = 0;
+	atomic_store(&gWake, false);
+	atomic_store(&gDone, false);
+
+	ProducerArgs pa = { count, 0 };
+	pthread_t thread;
+	pthread_create(&thread, NULL, Producer, &pa);
+
+	unsigned long popped = 0, batches = 0;
+	uint32_t last = 0;
+	bool in_order = true, lost_wakeup = false;
+	for( ;; )
+	{
+		Keystroke ks;
+		bool any = false;
+		while( KeyHistoryPop(&gHistory, &ks) )
+		{
+			in_order &= (ks.time_ms > last);
+			last = ks.time_ms;
+			++popped;
+			any = true;
+		}
+		batches += any;
+		if( !KeyHistoryWait(&gHistory) )  continue;
+
+		bool woken;
+		while( !(woken = atomic_exchange(&gWake, false)) && !atomic_load(&gDone) )  sched_yield();
+		if( !woken && !atomic_exchange(&gWake, false) )
+		{
+			lost_wakeup = (atomic_load(&gHistory.head) != atomic_load(&gHistory.tail));
+			while( KeyHistoryPop(&gHistory, &ks) )  ++popped;
+			break;
+		}
+	}
+	pthread_join(thread, NULL);
+
+	unsigned long dropped = atomic_load(&gHistory.dropped);
+	Check(in_order, "ring race: in order");
+	Check(!lost_wakeup, "ring race: no keystrokes left without a wake-up");
+	Check(popped + dropped == count, "ring race: every keystroke is either read or counted as dropped");
+	printf("     %lu keystrokes in bursts: %lu read in %lu batches, %lu dropped, %u wake-ups\n",
+	       count, popped, batches, dropped, gWakeups);
+}
+
+// ---- typing -----------------------------------------------------------------
+
+static LiveKeymap  gKeymaps [COUNTOF(kLayouts)];
+
+// Types the UTF-8 `text` in the layout, the way the hook sees it: '\b' is Backspace, '\n'
+// Enter, '\a' AltGr+Q. Returns false if the layout can't type some of it.
+static bool Type( LiveDetector* d, const LiveKeymap* km, const char* text )
+{
+	for( const unsigned char* p = (const unsigned char*)text; *p; )
+	{
+		uint32_t u = DecodeUtf8(&p);
+		Keystroke down = { .flags = 0 }, up = { .flags = KS_UP };
+		switch( u )
+		{
+			case '\b':  down.scancode = SC_BACKSPACE; break;
+			case '\n':  down.scancode = SC_ENTER; break;
+			case ' ':   down.scancode = SC_SPACE; break;
+			case '\a':
+			{
+				Keystroke altgr = { .scancode = SC_RALT }, q = { .scancode = 0x10 };
+				LiveDetectorFeed(d, &altgr, 0);
+				LiveDetectorFeed(d, &q, 0);
+				altgr.flags = q.flags = KS_UP;
+				LiveDetectorFeed(d, &q, 0);
+				LiveDetectorFeed(d, &altgr, 0);
+				continue;
+			}
+			default:
+			{
+				unsigned key = FindKey(km, u);
+				if( key == LIVE_SCANCODES * 2 )  return false;
+				down.scancode = key >> 1;
+				if( key & 1 )
+				{
+					Keystroke shift = { .scancode = SC_LSHIFT };
+					LiveDetectorFeed(d, &shift, 0);
+				}
+			}
+		}
+		up.scancode = down.scancode;
+		LiveDetectorFeed(d, &down, 0);
+		LiveDetectorFeed(d, &up, 0);
+		Keystroke shift_up = { .scancode = SC_LSHIFT, .flags = KS_UP };
+		LiveDetectorFeed(d, &shift_up, 0);
+	}
+	return true;
+}
+
+// ---- the fake injector: a line of text ----------------------------------------
+
+typedef struct
+{
+	UTF16   text [256];
+	size_t  length;
+	size_t  events;
+	size_t  batches;
+} Line;
+
+static bool ApplyEvents( void* ctx, const InjectEvent* events, size_t count )
+{
+	Line* line = ctx;
+	++line->batches;
+	line->events += count;
+	for( size_t i = 0; i < count; ++i )
+	{
+		if( events[i].up )  continue;
+		if( events[i].vk == INJECT_VK_BACK )
+		{
+			if( line->length == 0 )  return false;
+			--line->length;
+		}
+		else if( (events[i].vk == 0) && (line->length < COUNTOF(line->text)) )
+			line->text[line->length++] = events[i].unit;
+		else return false;
+	}
+	return true;
+}
+
+static void SetLine( Line* line, const char* utf8 )
+{
+	memset(line, 0, sizeof(*line));
+	for( const unsigned char* p = (const unsigned char*)utf8; *p && (line->length < COUNTOF(line->text)); )
+		line->text[line->length++] = DecodeUtf8(&p);
+}
+
+static bool LineIs( const Line* line, const char* utf8 )
+{
+	Line expected;
+	SetLine(&expected, utf8);
+	return (line->length == expected.length) && !memcmp(line->text, expected.text, line->length * sizeof(UTF16));
+}
+
+// Types `typed` in `from`, which shows as `screen`, then retypes the word just typed in
+// `to`, and checks that the line then reads `expected` (NULL: that the retyping is refused).
+static void CheckRetype( unsigned from, unsigned to, const char* typed, bool capslock,
+                         const char* screen, const char* expected )
+{
+	static LiveDetector d;
+	const LiveKeymap* keymaps [] = { &gKeymaps[from], &gKeymaps[to] };
+	LiveDetectorInit(&d, keymaps, 2);
+	LiveDetectorSetCurrent(&d, gKeymaps[from].layout);
+	bool typeable = Type(&d, &gKeymaps[from], typed);
+
+	const uint8_t* keys;
+	unsigned spaces;
+	bool reported;
+	unsigned n = LiveDetectorLastWord(&d, &keys, &spaces, &reported);
+
+	static InjectBatch batch;
+	InjectBatchInit(&batch);
+	Line line;
+	SetLine(&line, screen);
+	Injector injector = { ApplyEvents, &line };
+	bool planned = typeable && n && RetypeWord(&batch, keys, n, spaces, &gKeymaps[from], &gKeymaps[to], capslock);
+	bool ok = expected ? (planned && InjectSend(&batch, &injector) && LineIs(&line, expected)) : !planned;
+
+	char what [256];
+	snprintf(what, sizeof(what), "retype: '%s' in %s -> '%s' (%zu events)", screen, kLayouts[to].name,
+	         expected ? expected : "(refused)", batch.count);
+	Check(ok && (line.batches <= 1), what);
+}
+
+static void CheckLastWord( void )
+{
+	static LiveDetector d;
+	const LiveKeymap* keymaps [] = { &gKeymaps[0], &gKeymaps[1] };
+	static const struct { const char* typed; unsigned keys; unsigned spaces; } kCases [] =
+	{
+		{ "ghbdtn", 6, 0 },
+		{ "ghbdtn ", 6, 1 },            // (reported: a verdict for Russian when it ended)
+		{ "ghbdtn   ", 6, 3 },
+		{ "ghbdtn  \b", 6, 1 },
+		{ "ghbdtn  \b\bf", 7, 0 },      // back into the word
+		{ "ghbdtn\n", 0, 0 },
+		{ "ghbdtn x", 1, 0 },
+		{ "ghbdtn\b\b\b\b\b\b\b", 0, 0 },  // into the word before
+		{ "a\ab", 3, 0 },
+	};
+	for( unsigned i = 0; i < COUNTOF(kCases); ++i )
+	{
+		LiveDetectorInit(&d, keymaps, 2);
+		LiveDetectorSetCurrent(&d, gKeymaps[0].layout);
+		Type(&d, &gKeymaps[0], kCases[i].typed);
+		const uint8_t* keys;
+		unsigned spaces;
+		bool reported;
+		unsigned n = LiveDetectorLastWord(&d, &keys, &spaces, &reported);
+
+		char what [128], shown [64];
+		size_t k = 0;
+		for( const char* p = kCases[i].typed; *p && (k + 3 < sizeof(shown)); ++p )
+		{
+			if( *p == '\b' )       shown[k++] = '\\', shown[k++] = 'b';
+			else if( *p == '\n' )  shown[k++] = '\\', shown[k++] = 'n';
+			else if( *p == '\a' )  shown[k++] = '\\', shown[k++] = 'a';
+			else shown[k++] = *p;
+		}
+		shown[k] = 0;
+		snprintf(what, sizeof(what), "last word: '%s' -> %u keys + %u spaces", shown, kCases[i].keys, kCases[i].spaces);
+		Check((n == kCases[i].keys) && (spaces == kCases[i].spaces) && (!spaces || reported), what);
+	}
+
+	LiveDetectorInit(&d, keymaps, 2);
+	LiveDetectorSetCurrent(&d, gKeymaps[0].layout);
+	Type(&d, &gKeymaps[0], "ghbdtn ");
+	LiveDetectorSettle(&d);
+	const uint8_t* keys;
+	unsigned spaces;
+	bool reported;
+	Check(LiveDetectorLastWord(&d, &keys, &spaces, &reported) == 0, "last word: none once settled");
+}
+
+// ---- the words of the text files ----------------------------------------------
+
+// Types each word (with a space after it) in each of the other layouts and retypes it in
+// its own; counts the events, and how many are left out (the ones with keys of its own
+// layout that the other has nothing on, or that type the same in both).
+static void RetypeWords( unsigned right, const char* path, unsigned long max_words )
+{
+	static char text [16 << 20];
+	FILE* f = fopen(path, "rb");
+	if( f == NULL )
+	{
+		fprintf(stderr, "cannot open %s\n", path);
+		gFailed = true;
+		return;
+	}
+	size_t size = fread(text, 1, sizeof(text) - 1, f);
+	fclose(f);
+	text[size] = 0;
+
+	for( unsigned wrong = 0; wrong < COUNTOF(kLayouts); ++wrong )
+	{
+		if( (wrong == right) || (gKeymaps[wrong].model == NULL) )  continue;
+
+		static LiveDetector d;
+		const LiveKeymap* keymaps [] = { &gKeymaps[wrong], &gKeymaps[right] };
+		unsigned long words = 0, planned_words = 0, retyped = 0, skipped = 0, mismatches = 0, events = 0;
+		double seconds = 0;
+		char* p = text;
+		while( *p && (words < max_words) )
+		{
+			// the next word, typed in its layout, shown in the wrong one
+			while( *p && ((unsigned char)*p <= ' ') )  ++p;
+			char* start = p;
+			while( (unsigned char)*p > ' ' )  ++p;
+			if( p == start )  break;
+			char word [256], shown [4 * LIVE_MAX_WORD + 8];
+			size_t len = p - start, n = 0;
+			if( len >= sizeof(word) )  continue;
+			memcpy(word, start, len);
+			word[len] = 0;
+			++words;
+
+			bool ok = true;
+			for( const unsigned char* q = (const unsigned char*)word; *q && ok; )
+			{
+				unsigned key = FindKey(&gKeymaps[right], DecodeUtf8(&q));
+				UTF16 u = (key < LIVE_SCANCODES * 2) ? gKeymaps[wrong].chars[key >> 1][key & 1] : 0;
+				ok = (u != 0) && (u < 0x800) && (n + 3 < sizeof(shown));
+				if( !ok )  break;
+				if( u < 0x80 )  shown[n++] = u;
+				else shown[n++] = 0xC0 | (u >> 6), shown[n++] = 0x80 | (u & 0x3F);
+			}
+			if( !ok || (n == 0) || (n > LIVE_MAX_WORD) )
+			{
+				++skipped;
+				continue;
+			}
+			shown[n] = 0;
+
+			LiveDetectorInit(&d, keymaps, 2);
+			LiveDetectorSetCurrent(&d, gKeymaps[wrong].layout);
+			Type(&d, &gKeymaps[wrong], shown);
+
+			const uint8_t* keys;
+			unsigned spaces;
+			bool reported;
+			unsigned nkeys = LiveDetectorLastWord(&d, &keys, &spaces, &reported);
+
+			static InjectBatch batch;
+			Line line;
+			SetLine(&line, shown);
+			Injector injector = { ApplyEvents, &line };
+			double t0 = Seconds();
+			InjectBatchInit(&batch);
+			bool planned = RetypeWord(&batch, keys, nkeys, spaces, &gKeymaps[wrong], &gKeymaps[right], false);
+			seconds += Seconds() - t0;
+			++planned_words;
+			if( !planned )
+			{
+				++skipped;
+				continue;
+			}
+			if( batch.count == 0 )
+			{
+				++skipped;   // nothing to fix
+				continue;
+			}
+			++retyped;
+			events += batch.count;
+			mismatches += !InjectSend(&batch, &injector) || !LineIs(&line, word);
+		}
+
+		char what [128];
+		snprintf(what, sizeof(what), "retype: %s words typed in %s come out right", kLayouts[right].name, kLayouts[wrong].name);
+		Check(mismatches == 0, what);
+		printf("     %lu words: %lu retyped (%.1f events each, one batch; %.0f ns to plan), %lu left as they are; %lu wrong\n",
+		       words, retyped, retyped ? (double)events / retyped : 0.0, planned_words ? seconds * 1e9 / planned_words : 0.0,
+		       skipped, mismatches);
+	}
+}
+
+int main( int argc, char* argv[] )
+{
+	unsigned long events = 1000000, max_words = 20000;
+	const char* files [COUNTOF(kLayouts)] = {0};
+	for( int i = 1; i < argc; ++i )
+	{
+		const char* eq = strchr(argv[i], '=');
+		unsigned layout = COUNTOF(kLayouts);
+		for( unsigned k = 0; eq && (k < COUNTOF(kLayouts)); ++k )
+		{
+			if( (strlen(kLayouts[k].language) == (size_t)(eq - argv[i])) && !strncmp(argv[i], kLayouts[k].language, eq - argv[i]) )
+				layout = k;
+		}
+
+		if( ParseArg(argv[i], "--events", &events) )  events = events ? events : 1;
+		else if( (argv[i][0] != '-') && (layout < COUNTOF(kLayouts)) )  files[layout] = eq + 1;
+		else
+		{
+			fprintf(stderr, "usage: %s [--events=N] [LANG=FILE...]\n", argv[0]);
+			return 1;
+		}
+	}
+	for( unsigned k = 0; k < COUNTOF(kLayouts); ++k )  MakeKeymap(&gKeymaps[k], k);
+
+	CheckRing();
+	RaceRing(events);
+	CheckLastWord();
+
+	// en 0, ru 1, uk 2, de 3, fr 4, es 5
+	CheckRetype(0, 1, "ghbdtn", false, "ghbdtn", "привет");
+	CheckRetype(0, 1, "ghbdtn ", false, "ghbdtn ", "привет ");
+	CheckRetype(0, 1, "Ghbdtn", false, "Ghbdtn", "Привет");
+	CheckRetype(0, 1, "GHBDTN", true, "ghbdtn", "привет");        // typed with CapsLock on, so seen in lower case
+	CheckRetype(0, 1, "ghbdtn", true, "GHBDTN", "ПРИВЕТ");
+	CheckRetype(0, 1, "2012ujl", false, "2012ujl", "2012год");    // the digits are left alone
+	CheckRetype(1, 0, "руддщ", false, "руддщ", "hello");
+	CheckRetype(1, 0, "руддщ   ", false, "руддщ   ", "hello   ");
+	CheckRetype(0, 3, "y", false, "y", "z");
+	CheckRetype(0, 1, "a\ab", false, "a?b", NULL);                  // AltGr: not known what it typed
+	CheckRetype(0, 0, "abc", false, "abc", "abc");                  // the same layout: nothing to do
+
+	for( unsigned k = 0; k < COUNTOF(kLayouts); ++k )
+	{
+		if( files[k] )  RetypeWords(k, files[k], max_words);
+	}
+	return gFailed ? 1 : 0;
+}
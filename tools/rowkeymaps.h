@@ -0,0 +1,74 @@
+#ifndef ROWKEYMAPS_H
+#define ROWKEYMAPS_H
+
+// The keymaps of a few common layouts, for the tools that type through src/livedetect.c
+// without Windows to ask: the main block only, with no dead keys (their characters
+// count as typed).
+
+#include <stdint.h>
+#include <string.h>
+#include "livedetect.h"
+
+// the layouts, by rows (the shifted ones after the unshifted ones): ` 1..= / q..] / \ / a..' / z../
+static const struct { const char* language; const char* name; const char* rows [10]; } kLayouts [] =
+{
+	{ "en", "US", { "`1234567890-=", "qwertyuiop[]", "\\", "asdfghjkl;'", "zxcvbnm,./",
+	                "~!@#$%^&*()_+", "QWERTYUIOP{}", "|", "ASDFGHJKL:\"", "ZXCVBNM<>?" } },
+	{ "ru", "Russian", { "ё1234567890-=", "йцукенгшщзхъ", "\\", "фывапролджэ", "ячсмитьбю.",
+	                     "Ё!\"№;%:?*()_+", "ЙЦУКЕНГШЩЗХЪ", "/", "ФЫВАПРОЛДЖЭ", "ЯЧСМИТЬБЮ," } },
+	{ "uk", "Ukrainian", { "'1234567890-=", "йцукенгшщзхї", "ґ", "фівапролджє", "ячсмитьбю.",
+	                       "₴!\"№;%:?*()_+", "ЙЦУКЕНГШЩЗХЇ", "Ґ", "ФІВАПРОЛДЖЄ", "ЯЧСМИТЬБЮ," } },
+	{ "de", "German", { "^1234567890ß´", "qwertzuiopü+", "#", "asdfghjklöä", "yxcvbnm,.-",
+	                    "°!\"§$%&/()=?`", "QWERTZUIOPÜ*", "'", "ASDFGHJKLÖÄ", "YXCVBNM;:_" } },
+	{ "fr", "French", { "²&é\"'(-è_çà)=", "azertyuiop^$", "*", "qsdfghjklmù", "wxcvbn,;:!",
+	                    "³1234567890°+", "AZERTYUIOP¨£", "µ", "QSDFGHJKLM%", "WXCVBN?./§" } },
+	{ "es", "Spanish", { "º1234567890'¡", "qwertyuiop`+", "ç", "asdfghjklñ´", "zxcvbnm,.-",
+	                     "ª!\"·$%&/()=?¿", "QWERTYUIOP^*", "Ç", "ASDFGHJKLÑ¨", "ZXCVBNM;:_" } },
+};
+
+static const uint8_t kRowScancodes [5][13] =
+{
+	{ 0x29, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D },
+	{ 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B },
+	{ 0x2B },
+	{ 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28 },
+	{ 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35 },
+};
+
+static uint32_t DecodeUtf8( const unsigned char** pp )
+{
+	const unsigned char* p = *pp;
+	unsigned len = (*p < 0x80) ? 1 : (*p < 0xE0) ? 2 : (*p < 0xF0) ? 3 : 4;
+	uint32_t u = (len == 1) ? *p : (*p & (0x3F >> (len - 1)));
+	for( unsigned k = 1; k < len && p[k]; ++k )  u = (u << 6) | (p[k] & 0x3F);
+	*pp = p + len;
+	return u;
+}
+
+static void MakeKeymap( LiveKeymap* km, unsigned layout )
+{
+	static UTF16 chars [LIVE_SCANCODES][2];
+	memset(chars, 0, sizeof(chars));
+	for( unsigned shifted = 0; shifted < 2; ++shifted )
+	{
+		for( unsigned row = 0; row < 5; ++row )
+		{
+			const unsigned char* p = (const unsigned char*)kLayouts[layout].rows[row + shifted * 5];
+			for( unsigned k = 0; *p; ++k )
+				chars[kRowScancodes[row][k]][shifted] = DecodeUtf8(&p);
+		}
+	}
+	LiveKeymapInit(km, layout + 1, kLayouts[layout].language, chars);
+}
+
+// the key (scancode * 2 + shifted) that types `u`, or LIVE_SCANCODES * 2
+static unsigned FindKey( const LiveKeymap* km, uint32_t u )
+{
+	for( unsigned k = 0; k < LIVE_SCANCODES * 2; ++k )
+	{
+		if( km->chars[k >> 1][k & 1] == u )  return k;
+	}
+	return LIVE_SCANCODES * 2;
+}
+
+#endif
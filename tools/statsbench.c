@@ -0,0 +1,180 @@
+// A stress test of the statistics seqlock (src/stats.c) and a measure of its costs:
+// the writer updates the data as fast as it can, keeping it to a pattern that every
+// update changes all of (the counters, the histograms, the command line), while readers
+// in another process take snapshots with StatsRead, as kbsw --status does, and check
+// that none is torn; then the cost of an update and of a read. Also checks that the
+// published segment (src/stats_posix.c) is readable by the user only, even one left
+// behind readable by all, if there is no running instance to get in the way of.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o statsbench statsbench.c ../src/stats.c ../src/stats_posix.c
+//
+// statsbench [--updates=N] [--readers=N]
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include "stats.h"
+#include "check.h"
+
+// what the readers report back, in the shared mapping after the segment
+typedef struct
+{
+	atomic_bool       done;        // the writer has finished
+	atomic_ullong     snapshots, failed, torn;
+} Report;
+
+static void Fill( StatsData* st, uint64_t n )
+{
+	for( unsigned i = 0; i < STATS_MAX_KEYS; ++i )  st->activations[i] = n + i;
+	for( unsigned i = 0; i < STATS_MODES; ++i )  st->translations[i] = n;
+	for( unsigned h = 0; h < STATS_HISTOGRAMS; ++h )
+		for( unsigned b = 0; b < STATS_BUCKETS; ++b )  st->histograms[h][b] = n;
+	memset(st->command_line, 'a' + n % 26, STATS_CMDLINE_SIZE - 1);
+	st->hook_worst_us = (uint32_t)n;
+}
+
+static bool Consistent( const StatsData* st )
+{
+	uint64_t n = st->activations[0];
+	for( unsigned i = 0; i < STATS_MAX_KEYS; ++i )  if( st->activations[i] != n + i )  return false;
+	for( unsigned i = 0; i < STATS_MODES; ++i )  if( st->translations[i] != n )  return false;
+	for( unsigned h = 0; h < STATS_HISTOGRAMS; ++h )
+		for( unsigned b = 0; b < STATS_BUCKETS; ++b )  if( st->histograms[h][b] != n )  return false;
+	for( unsigned i = 0; i < STATS_CMDLINE_SIZE - 1; ++i )
+		if( st->command_line[i] != (char)('a' + n % 26) )  return false;
+	return st->hook_worst_us == (uint32_t)n;
+}
+
+static const StatsShared*  gShm;
+static Report*             gReport;
+
+static void* Reader( void* _ )
+{
+	StatsData snapshot;
+	unsigned long long snapshots = 0, failed = 0, torn = 0;
+	while( !atomic_load(&gReport->done) )
+	{
+		if( !StatsRead(gShm, &snapshot) )  ++failed;
+		else if( ++snapshots, !Consistent(&snapshot) )  ++torn;
+	}
+	atomic_fetch_add(&gReport->snapshots, snapshots);
+	atomic_fetch_add(&gReport->failed, failed);
+	atomic_fetch_add(&gReport->torn, torn);
+	return NULL;
+}
+
+int main( int argc, char* argv [] )
+{
+	unsigned updates = 2000000, nreaders = 2;
+	for( int i = 1; i < argc; ++i )
+	{
+		if( (strncmp(argv[i], "--updates=", 10) == 0) && ((updates = strtoul(argv[i] + 10, NULL, 10)) > 0) )  continue;
+		if( (strncmp(argv[i], "--readers=", 10) == 0) && ((nreaders = strtoul(argv[i] + 10, NULL, 10)) > 0) )  continue;
+		fprintf(stderr, "usage: statsbench [--updates=N] [--readers=N]\n");
+		return 2;
+	}
+
+	// the segment, shared with the readers' process as the named one would be
+	size_t size = sizeof(StatsShared) + sizeof(Report);
+	uint8_t* shared = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if( shared == MAP_FAILED )  return printf("FAIL mmap\n"), 1;
+	gShm = (const StatsShared*) shared;
+	gReport = (Report*)(shared + sizeof(StatsShared));
+	StatsAttach((StatsShared*) shared);
+	Fill(StatsBeginUpdate(), 0);
+	StatsEndUpdate();
+
+	pid_t child = fork();
+	if( child == 0 )
+	{
+		pthread_t threads [16];
+		nreaders = (nreaders < 16) ? nreaders : 16;
+		for( unsigned i = 0; i < nreaders; ++i )  pthread_create(&threads[i], NULL, Reader, NULL);
+		for( unsigned i = 0; i < nreaders; ++i )  pthread_join(threads[i], NULL);
+		_exit(0);
+	}
+
+	uint64_t t0 = StatsNow_us();
+	for( unsigned n = 1; n <= updates; ++n )
+	{
+		Fill(StatsBeginUpdate(), n);
+		StatsEndUpdate();
+		// let the readers see it still, now and then
+		if( (n & 4095) == 0 )  sched_yield();
+	}
+	uint64_t update_us = StatsNow_us() - t0;
+	atomic_store(&gReport->done, true);
+	waitpid(child, NULL, 0);
+
+	unsigned long long snapshots = atomic_load(&gReport->snapshots), failed = atomic_load(&gReport->failed),
+	                   torn = atomic_load(&gReport->torn);
+	char what [200];
+	snprintf(what, sizeof(what), "%u updates against %u readers: %llu snapshots, %llu torn (%llu reads gave up)",
+	         updates, nreaders, snapshots, torn, failed);
+	Check((snapshots > 0) && (torn == 0), what);
+
+	StatsData snapshot;
+	Check(StatsRead(gShm, &snapshot) && Consistent(&snapshot) && (snapshot.activations[0] == updates),
+	      "the last update read");
+	// mid-update: the reader gives up rather than return what it has
+	StatsBeginUpdate();
+	Check(!StatsRead(gShm, &snapshot), "a read during an update: given up");
+	StatsEndUpdate();
+	StatsData* st = StatsBeginUpdate();
+	st->magic = 0;
+	StatsEndUpdate();
+	Check(!StatsRead(gShm, &snapshot), "a segment that does not look right: refused");
+	StatsBeginUpdate()->magic = STATS_MAGIC;
+	StatsEndUpdate();
+
+	// the costs, uncontended
+	const unsigned N = 2000000;
+	t0 = StatsNow_us();
+	for( unsigned i = 0; i < N; ++i )
+	{
+		++StatsBeginUpdate()->ignored_busy;
+		StatsEndUpdate();
+	}
+	uint64_t counter_us = StatsNow_us() - t0;
+	const unsigned R = 200000;
+	t0 = StatsNow_us();
+	for( unsigned i = 0; i < R; ++i )  StatsRead(gShm, &snapshot);
+	uint64_t read_us = StatsNow_us() - t0;
+	printf("an update: %.1f ns for a counter, %.1f ns for the whole pattern with readers; a read (%zu bytes): %.1f ns\n",
+	       counter_us * 1000.0 / N, update_us * 1000.0 / updates, sizeof(StatsData), read_us * 1000.0 / R);
+
+	StatsAttach(NULL);
+	munmap(shared, size);
+
+	// the named segment: the user's only
+	const StatsShared* running = StatsOpen();
+	if( running )
+	{
+		StatsClose(running);
+		printf("skip the named segment: an instance is running\n");
+	}
+	else
+	{
+		char path [64];
+		snprintf(path, sizeof(path), "/dev/shm/kbsw-stats-%u", (unsigned)getuid());
+		struct stat sb;
+		// as left behind by an older version
+		int fd = shm_open(path + 8, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+		if( fd >= 0 )  fchmod(fd, 0644), close(fd);
+		bool published = StatsPublish();
+		bool ok = published && (stat(path, &sb) == 0) && ((sb.st_mode & 0777) == 0600);
+		if( published )  StatsUnpublish();
+		Check(ok, "the named segment: readable by the user only");
+	}
+	return gFailed;
+}
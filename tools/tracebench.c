@@ -0,0 +1,146 @@
+// A check of the trace ring (src/trace.c) and of what TraceDumpJson writes: the detail
+// truncated to the characters that fit whole, whatever the cut falls on (the exe names
+// are UTF-8), so the JSON strings stay valid; the quotes and the control characters
+// escaped; only the last TRACE_RING_SIZE events kept; nothing recorded while stopped.
+// Then several threads recording at once, and the dump of what they left.
+// (The cost of recording is measured by microbench: trace.off, trace.record.)
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o tracebench tracebench.c ../src/trace.c -pthread
+//
+// tracebench
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "trace.h"
+#include "check.h"
+
+static uint64_t gNow_us;
+
+uint64_t AppTraceNow_us( void )
+{
+	return gNow_us++;
+}
+
+// the dump, as a string; *pcount events
+static char* Dump( size_t* pcount )
+{
+	FILE* f = tmpfile();
+	if( f == NULL )  return printf("FAIL tmpfile\n"), exit(1), NULL;
+	*pcount = TraceDumpJson(f);
+	long size = ftell(f);
+	char* json = malloc(size + 1);
+	rewind(f);
+	json[fread(json, 1, size, f)] = 0;
+	fclose(f);
+	return json;
+}
+
+static bool IsValidUtf8( const char* s )
+{
+	for( const unsigned char* p = (const unsigned char*)s; *p; )
+	{
+		unsigned n = (*p < 0x80) ? 0 : ((*p & 0xE0) == 0xC0) ? 1 : ((*p & 0xF0) == 0xE0) ? 2 : ((*p & 0xF8) == 0xF0) ? 3 : 4;
+		if( n == 4 )  return false;
+		for( ++p; n > 0; --n, ++p )  if( (*p & 0xC0) != 0x80 )  return false;
+	}
+	return true;
+}
+
+// the detail of the only event recorded, as dumped (unescaped: the tests use no escapes)
+static bool RecordedDetail( const char* detail, char* out, size_t out_size )
+{
+	TraceStart();
+	TRACE_DETAIL(trInstant, "target", 0, detail);
+	size_t count;
+	char* json = Dump(&count);
+	const char* p = strstr(json, "\"detail\":\"");
+	const char* end = p ? strchr(p += strlen("\"detail\":\""), '"') : NULL;
+	bool ok = (count == 1) && end && ((size_t)(end - p) < out_size);
+	if( ok )  memcpy(out, p, end - p), out[end - p] = 0;
+	free(json);
+	return ok;
+}
+
+static void* Recorder( void* arg )
+{
+	for( unsigned i = 0; i < 100000; ++i )  TRACE_DETAIL(trInstant, "thread", arg, "détail");
+	return NULL;
+}
+
+int main( int argc, char* argv [] )
+{
+	if( argc > 1 )  return fprintf(stderr, "usage: tracebench\n"), 2;
+
+	// the names of other scripts, with the cut on every byte of a sequence
+	static const char* const kDetails [] =
+	{
+		"короткое.exe",                               // Cyrillic: 2 bytes a letter
+		"x" "короткое_имя_программы.exe",             // the same, shifted by a byte
+		"日本語のとても長い名前のプログラム.exe",           // 3 bytes
+		"a" "日本語のとても長い名前のプログラム.exe",
+		"ab" "日本語のとても長い名前のプログラム.exe",
+		"😀😀😀😀😀😀😀😀.exe",                           // 4 bytes
+		"a😀😀😀😀😀😀😀😀.exe",
+		"ab😀😀😀😀😀😀😀😀.exe",
+		"abc😀😀😀😀😀😀😀😀.exe",
+		"plain_ascii_name_long_enough.exe",
+	};
+	bool ok = true;
+	for( unsigned i = 0; i < sizeof(kDetails) / sizeof(kDetails[0]); ++i )
+	{
+		const char* d = kDetails[i];
+		char got [TRACE_DETAIL_SIZE * 2];
+		size_t n;
+		bool this_ok = RecordedDetail(d, got, sizeof(got)) && IsValidUtf8(got) && ((n = strlen(got)) < TRACE_DETAIL_SIZE)
+		            && (strncmp(got, d, n) == 0)
+		            // as much as fits: the next character would not
+		            && ((d[n] == 0) || (n + 1 + ((d[n] & 0xE0) == 0xC0) + 2 * ((d[n] & 0xF0) == 0xE0)
+		                                + 3 * ((d[n] & 0xF8) == 0xF0) > TRACE_DETAIL_SIZE - 1));
+		if( !this_ok )  printf("  %s -> %s\n", d, got);
+		ok = ok && this_ok;
+	}
+	Check(ok, "a long detail: cut between characters, as many as fit");
+
+	char got [TRACE_DETAIL_SIZE];
+	Check(RecordedDetail("kbsw.exe", got, sizeof(got)) && (strcmp(got, "kbsw.exe") == 0), "a short detail: whole");
+
+	TraceStart();
+	TRACE_DETAIL(trInstant, "target", 0, "a\"b\\c\td");
+	size_t count;
+	char* json = Dump(&count);
+	Check((count == 1) && strstr(json, "\"detail\":\"a\\\"b\\\\c\\u0009d\""), "quotes, backslashes, controls: escaped");
+	free(json);
+
+	TraceStart();
+	for( unsigned i = 0; i < 2 * TRACE_RING_SIZE + 5; ++i )  TRACE_INSTANT("tick", i);
+	json = Dump(&count);
+	char last [64];
+	snprintf(last, sizeof(last), "\"arg\":\"0x%x\"", 2 * TRACE_RING_SIZE + 4);
+	Check((count == TRACE_RING_SIZE) && strstr(json, last) && !strstr(json, "\"arg\":\"0x0\""),
+	      "a full ring: the latest events kept");
+	free(json);
+
+	TraceStop();
+	TRACE_INSTANT("tick", 0);
+	json = Dump(&count);
+	Check(count == TRACE_RING_SIZE, "stopped: nothing recorded");
+	free(json);
+
+	TraceStart();
+	pthread_t threads [4];
+	for( uintptr_t i = 0; i < 4; ++i )  pthread_create(&threads[i], NULL, Recorder, (void*)(i + 1));
+	for( unsigned i = 0; i < 4; ++i )  pthread_join(threads[i], NULL);
+	json = Dump(&count);
+	unsigned details = 0;
+	for( const char* p = json; (p = strstr(p, "\"detail\":\"détail\"")) != NULL; ++p )  ++details;
+	// a writer preempted for a whole lap of the ring finishes after the one that took its slot
+	// over, and the slot is skipped: at most one each, and the events dumped are all whole
+	Check((count + 4 >= TRACE_RING_SIZE) && (count <= TRACE_RING_SIZE) && (details == count),
+	      "4 threads at once: a full ring of whole events, but for the writers preempted");
+	free(json);
+	return gFailed;
+}
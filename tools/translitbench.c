@@ -0,0 +1,240 @@
+// Compiles the transliteration rule files (src/translit.c), checks some known translations
+// and the round trips through each translator and its inverse, and measures the throughput
+// of them, against memcpy of the same amount of text.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o translitbench translitbench.c ../src/translit.c ../src/translate.c
+//     ../src/hex.c ../src/grapheme.c ../src/names.c ../src/names_posix.c ../src/casemap.c
+//
+// translitbench [--size=KB] [--rounds=N] [DIR]   (DIR is ../translit by default)
+
+#define _DEFAULT_SOURCE   // dirent
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <dirent.h>
+#include "translate.h"
+#include "translit.h"
+
+// covers the letters of the Russian alphabet, in lower case, capitalized and all capitals
+static const char kRussian [] =
+	"Съешь же ещё этих мягких французских булок, да выпей чаю. "
+	"Широкая электрификация южных губерний даст мощный толчок подъёму сельского хозяйства. "
+	"В чащах юга жил бы цитрус? Да, но фальшивый экземпляр! ЩИ ДА КАША, 1 ЦЕНТ. ";
+
+static const char kEnglish [] =
+	"The quick brown fox jumps over the lazy dog, and nothing in here has any rules at all. ";
+
+static const struct { const char* translator; const char* input; const char* output; } kKnown [] =
+{
+	{ "RU-GOST",  "щи да каша",        "shhi da kasha" },
+	{ "RU-GOST",  "Цирк, цапля, Щука", "Cirk, czaplya, Shhuka" },
+	{ "RU-GOST",  "подъезд, объём",    "pod``ezd, ob``yom" },
+	{ "GOST-RU",  "SHHI i ceny`",      "ЩИ и цены" },
+	{ "RU-BGN",   "щука, Тсс, шчи",    "shchuka, T·ss, sh·chi" },
+	{ "BGN-RU",   "shch sh·ch",        "щ шч" },
+	{ "CYR-ISO9", "Щука, ґанок, ў",    "Ŝuka, g̀anok, ǔ" },
+	{ "ISO9-CYR", "Ŝuka, g̀anok",       "Щука, ґанок" },
+};
+
+static double Seconds( void )
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned long* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+static double MBps( size_t units, unsigned rounds, double seconds )
+{
+	return (double)units * sizeof(UTF16) * rounds / seconds / (1024 * 1024);
+}
+
+// decodes the UTF-8 text repeatedly up to `size` units; a character that doesn't fit is left out
+static size_t MakeText( const char* utf8, UTF16* text, size_t size )
+{
+	size_t n = 0;
+	for( const unsigned char* p = (const unsigned char*)utf8; ; p = *p ? p : (const unsigned char*)utf8 )
+	{
+		unsigned len = (*p < 0x80) ? 1 : (*p < 0xE0) ? 2 : (*p < 0xF0) ? 3 : 4;
+		uint32_t u = (len == 1) ? *p : (*p & (0x3F >> (len - 1)));
+		for( unsigned k = 1; k < len; ++k )  u = (u << 6) | (p[k] & 0x3F);
+		p += len;
+
+		if( n + 1 + (u >= 0x10000) > size )  return n;
+		if( u < 0x10000 )  text[n++] = u;
+		else
+		{
+			text[n++] = 0xD800 + ((u - 0x10000) >> 10);
+			text[n++] = 0xDC00 + ((u - 0x10000) & 0x3FF);
+		}
+		if( (size == SIZE_MAX) && (*p == 0) )  return n;
+	}
+}
+
+static size_t Translate( const TranslatorClass* cls, const UTF16* text, size_t length, UTF16* out, size_t size )
+{
+	TrPipeline p;
+	TrPipelineInit(&p, &cls, NULL, 1);
+	TrBuffer b = { .data = out, .size = size };
+	TrPipelineRun(&p, text, length, &b);
+	return b.length;
+}
+
+static void PrintUtf16( const UTF16* s, size_t n )
+{
+	for( size_t i = 0; i < n; ++i )
+	{
+		uint32_t u = s[i];
+		if( ((u & 0xFC00) == 0xD800) && (i + 1 < n) )  u = ((u - 0xD800) << 10) + (s[++i] - 0xDC00) + 0x10000;
+		if( u < 0x80 )  putchar(u);
+		else if( u < 0x800 )  printf("%c%c", 0xC0 | (u >> 6), 0x80 | (u & 0x3F));
+		else if( u < 0x10000 )  printf("%c%c%c", 0xE0 | (u >> 12), 0x80 | ((u >> 6) & 0x3F), 0x80 | (u & 0x3F));
+		else printf("%c%c%c%c", 0xF0 | (u >> 18), 0x80 | ((u >> 12) & 0x3F), 0x80 | ((u >> 6) & 0x3F), 0x80 | (u & 0x3F));
+	}
+}
+
+static unsigned CompileAll( const char* dir )
+{
+	DIR* d = opendir(dir);
+	if( d == NULL )  return fprintf(stderr, "can't open %s\n", dir), 0;
+
+	unsigned count = 0;
+	for( struct dirent* e; (e = readdir(d)); )
+	{
+		size_t len = strlen(e->d_name);
+		if( (len <= 4) || (strcmp(e->d_name + len - 4, ".txt") != 0) )  continue;
+
+		char path [4096];
+		snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+		FILE* f = fopen(path, "rb");
+		static char text [1 << 20];
+		size_t length = f ? fread(text, 1, sizeof(text), f) : 0;
+		if( f )  fclose(f);
+
+		size_t before = TranslatorCount();
+		double t0 = Seconds();
+		bool ok = TranslitRegisterRules(text, length, e->d_name);
+		double t1 = Seconds();
+		printf("%-16s %s, %.0f us", e->d_name, ok ? "compiled" : "FAILED", (t1 - t0) * 1e6);
+		for( size_t i = before; i < TranslatorCount(); ++i )
+		{
+			const Transliterator* t = (const Transliterator*) TranslatorAt(i);
+			printf(", %s: %u nodes", t->name, t->trie.nnodes);
+		}
+		printf("\n");
+		count += ok;
+	}
+	closedir(d);
+	return count;
+}
+
+int main( int argc, char* argv[] )
+{
+	unsigned long size_kb = 1024, rounds = 20;
+	const char* dir = "../translit";
+	for( int i = 1; i < argc; ++i )
+	{
+		if(      ParseArg(argv[i], "--size", &size_kb) )  size_kb = size_kb ? size_kb : 1;
+		else if( ParseArg(argv[i], "--rounds", &rounds) )  rounds = rounds ? rounds : 1;
+		else if( argv[i][0] != '-' )  dir = argv[i];
+		else
+		{
+			fprintf(stderr, "usage: %s [--size=KB] [--rounds=N] [DIR]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	size_t first = TranslatorCount();
+	if( CompileAll(dir) == 0 )  return 1;
+	size_t last = TranslatorCount();
+
+	size_t size = size_kb * 1024 / sizeof(UTF16);
+	size_t out_size = size * TRANSLIT_MAX_RULE;
+	UTF16* text = malloc(size * sizeof(UTF16));
+	UTF16* tmp = malloc((out_size + 1) * sizeof(UTF16));
+	UTF16* out = malloc((out_size + 1) * sizeof(UTF16));
+	if( !text || !tmp || !out )  return fprintf(stderr, "out of memory\n"), 1;
+
+	// the known translations
+	unsigned failures = 0;
+	printf("\n");
+	for( size_t i = 0; i < sizeof(kKnown) / sizeof(kKnown[0]); ++i )
+	{
+		const TranslatorClass* cls = TranslatorFind(kKnown[i].translator, strlen(kKnown[i].translator));
+		if( cls == NULL )  continue;
+
+		size_t n = MakeText(kKnown[i].input, text, SIZE_MAX);
+		size_t m = MakeText(kKnown[i].output, tmp, SIZE_MAX);
+		size_t k = Translate(cls, text, n, out, out_size);
+		bool ok = (k == m) && (memcmp(out, tmp, k * sizeof(UTF16)) == 0);
+		failures += !ok;
+		printf("%-9s %s  ", cls->name, ok ? "ok  " : "FAIL");
+		PrintUtf16(text, n);
+		printf(" -> ");
+		PrintUtf16(out, k);
+		printf("\n");
+	}
+
+	// the round trips, and the throughput
+	printf("\n%lu KB of text, %lu rounds; MB/s of the input\n\n", size_kb, rounds);
+	printf("%-9s %-8s %9s %9s %9s   %s\n", "", "text", "memcpy", "there", "back", "round trip");
+	for( size_t i = first; i < last; ++i )
+	{
+		const TranslatorClass* cls = TranslatorAt(i);
+		const TranslatorClass* inverse = cls->inverse ? TranslatorFind(cls->inverse, strlen(cls->inverse)) : NULL;
+		if( (inverse == NULL) || (strncmp(cls->name, "RU", 2) && strncmp(cls->name, "CYR", 3)) )  continue;
+
+		for( unsigned model = 0; model < 2; ++model )
+		{
+			size_t length = MakeText(model ? kEnglish : kRussian, text, size);
+			double elapsed [3] = {0};
+			size_t n = 0, m = 0;
+			for( unsigned r = 0; r < rounds; ++r )
+			{
+				double t0 = Seconds();
+				memcpy(tmp, text, length * sizeof(UTF16));
+				double t1 = Seconds();
+				n = Translate(cls, text, length, tmp, out_size);
+				double t2 = Seconds();
+				m = Translate(inverse, tmp, n, out, out_size);
+				double t3 = Seconds();
+				elapsed[0] += t1 - t0;
+				elapsed[1] += t2 - t1;
+				elapsed[2] += t3 - t2;
+			}
+
+			size_t diff = 0;
+			while( (diff < m) && (diff < length) && (out[diff] == text[diff]) )  ++diff;
+			printf("%-9s %-8s %9.0f %9.0f %9.0f   ", cls->name, model ? "english" : "russian",
+			       MBps(length, rounds, elapsed[0]), MBps(length, rounds, elapsed[1]), MBps(n, rounds, elapsed[2]));
+			if( model == 1 )  printf("-\n");   // not the language of the translator
+			else if( (m == length) && (diff == m) )  printf("exact\n");
+			else
+			{
+				printf("differs at %zu: ", diff);
+				size_t from = (diff > 8) ? diff - 8 : 0;
+				PrintUtf16(text + from, 24);
+				printf(" -> ");
+				PrintUtf16(out + from, (m > from + 24) ? 24 : m - from);
+				printf("\n");
+			}
+		}
+	}
+
+	free(text);
+	free(tmp);
+	free(out);
+	return failures ? 1 : 0;
+}
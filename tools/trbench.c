@@ -0,0 +1,180 @@
+// Measures the throughput of the text translators (src/translate.c) on a few kinds of
+// generated text, against memcpy of the same amount of it, and that of a fused chain
+// of translators against running them one after another through a buffer. Also that of
+// the grapheme cluster segmentation alone (src/grapheme.c).
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o trbench trbench.c ../src/translate.c ../src/hex.c ../src/grapheme.c
+//     ../src/names.c ../src/names_posix.c ../src/casemap.c
+//
+// trbench [--size=KB] [--rounds=N]
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "translate.h"
+#include "hex.h"
+#include "grapheme.h"
+
+typedef struct
+{
+	const char*  name;
+	const char*  pieces [8];   // the text is made of these, in turn
+} TextModel;
+
+static const TextModel kTexts [] =
+{
+	{ "prose", { "The quick brown fox jumps over the lazy dog, ", "and then some more words follow. ",
+	             "Nothing here is to be decoded at all; ", "it is all plain text until the end. " } },
+	{ "json",  { "{\"name\": \"caf\\u00e9\", ", "\"icon\": \"\\ud83d\\udca1\", ",
+	             "\"note\": \"mostly plain text in between\"}, " } },
+	{ "html",  { "<p>Fish &#x26; chips &#38; a ", "&#x1F4A1; idea, at 0x41 past", " the hour.</p>\n" } },
+	{ "digits", { "1000 2000 3000 4000 5000 ", "0.5 0.25 0.125 " } },
+	{ "emoji",  { "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB ", "\xF0\x9F\x87\xBA\xF0\x9F\x87\xA6 ",
+	              "cafe\xCC\x81 ", "\xED\x95\x9C\xEA\xB8\x80 " } },   // UTF-8
+};
+
+static double Seconds( void )
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// decodes the UTF-8 pieces; a character that doesn't fit at the end is left out
+static size_t MakeText( const TextModel* m, UTF16* text, size_t size )
+{
+	size_t n = 0;
+	for( unsigned i = 0; ; i = (m->pieces[i + 1] ? i + 1 : 0) )
+	{
+		for( const unsigned char* p = (const unsigned char*)m->pieces[i]; *p; )
+		{
+			unsigned len = (*p < 0x80) ? 1 : (*p < 0xE0) ? 2 : (*p < 0xF0) ? 3 : 4;
+			uint32_t u = (len == 1) ? *p : (*p & (0x3F >> (len - 1)));
+			for( unsigned k = 1; k < len; ++k )  u = (u << 6) | (p[k] & 0x3F);
+			p += len;
+
+			if( n + 1 + (u >= 0x10000) > size )  return n;
+			if( u < 0x10000 )  text[n++] = u;
+			else
+			{
+				text[n++] = 0xD800 + ((u - 0x10000) >> 10);
+				text[n++] = 0xDC00 + ((u - 0x10000) & 0x3FF);
+			}
+		}
+	}
+}
+
+// returns the number of clusters, so that the work is not optimized away
+static size_t Segment( const UTF16* text, size_t length )
+{
+	GraphemeState st = {0};
+	size_t nclusters = 0;
+	for( size_t i = 0; i < length; ++i )
+	{
+		uint32_t u = text[i];
+		if( ((u & 0xFC00) == 0xD800) && (i + 1 < length) )  u = ((u - 0xD800) << 10) + (text[++i] - 0xDC00) + 0x10000;
+		nclusters += GraphemeIsBoundary(&st, u);
+	}
+	return nclusters;
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned long* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+static double MBps( size_t units, unsigned rounds, double seconds )
+{
+	return (double)units * sizeof(UTF16) * rounds / seconds / (1024 * 1024);
+}
+
+static void Translate( const TranslatorClass* const* classes, unsigned count,
+                       const UTF16* text, size_t length, TrBuffer* out )
+{
+	TrPipeline p;
+	TrPipelineInit(&p, classes, NULL, count);
+	TrPipelineRun(&p, text, length, out);
+}
+
+int main( int argc, char* argv[] )
+{
+	unsigned long size_kb = 1024, rounds = 20;
+	for( int i = 1; i < argc; ++i )
+	{
+		if(      ParseArg(argv[i], "--size", &size_kb) )  size_kb = size_kb ? size_kb : 1;
+		else if( ParseArg(argv[i], "--rounds", &rounds) )  rounds = rounds ? rounds : 1;
+		else
+		{
+			fprintf(stderr, "usage: %s [--size=KB] [--rounds=N]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	const TranslatorClass* const hex [] = { &kHexToUnicode };
+	const TranslatorClass* const uhex [] = { &kUnicodeToHex };
+	const TranslatorClass* const chain [] = { &kHexToUnicode, &kUnicodeToHex };
+
+	size_t size = size_kb * 1024 / sizeof(UTF16);
+	size_t out_size = kUnicodeToHex.max_output(size);
+	UTF16* text = malloc(size * sizeof(UTF16));
+	UTF16* tmp = malloc((size + 1) * sizeof(UTF16));
+	UTF16* out = malloc((out_size + 1) * sizeof(UTF16));
+	if( !text || !tmp || !out )  return fprintf(stderr, "out of memory\n"), 1;
+
+	printf("%lu KB of text, %lu rounds; MB/s of the input\n\n", size_kb, rounds);
+	printf("%-8s %9s %9s %9s %12s %12s\n", "text", "memcpy", "HEX", "segment", "HEX+UHEX", "HEX, UHEX");
+
+	for( unsigned t = 0; t < sizeof(kTexts) / sizeof(kTexts[0]); ++t )
+	{
+		size_t length = MakeText(&kTexts[t], text, size);
+		double elapsed [5] = {0};
+		size_t nclusters = 0;
+
+		for( unsigned r = 0; r < rounds; ++r )
+		{
+			double t0 = Seconds();
+			memcpy(tmp, text, length * sizeof(UTF16));
+			double t1 = Seconds();
+
+			TrBuffer b1 = { .data = tmp, .size = size };
+			Translate(hex, 1, text, length, &b1);
+			double t2 = Seconds();
+
+			TrBuffer b2 = { .data = out, .size = out_size };
+			Translate(chain, 2, text, length, &b2);
+			double t3 = Seconds();
+
+			// the same two, one after another through an intermediate buffer
+			b1.size = size;
+			Translate(hex, 1, text, length, &b1);
+			Translate(uhex, 1, tmp, b1.length, &b2);
+			double t4 = Seconds();
+
+			nclusters += Segment(text, length);
+			double t5 = Seconds();
+
+			elapsed[0] += t1 - t0;
+			elapsed[1] += t2 - t1;
+			elapsed[2] += t3 - t2;
+			elapsed[3] += t4 - t3;
+			elapsed[4] += t5 - t4;
+		}
+
+		printf("%-8s %9.0f %9.0f %9.0f %12.0f %12.0f   (%zu clusters)\n", kTexts[t].name,
+		       MBps(length, rounds, elapsed[0]), MBps(length, rounds, elapsed[1]),
+		       MBps(length, rounds, elapsed[4]), MBps(length, rounds, elapsed[2]),
+		       MBps(length, rounds, elapsed[3]), nclusters / rounds);
+	}
+
+	free(text);
+	free(tmp);
+	free(out);
+	return 0;
+}
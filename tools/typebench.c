@@ -0,0 +1,307 @@
+// Checks the choice between typing a translated selection and pasting it (src/inject.c,
+// InjectPlanTyping) and what the pipeline (src/pipeline.c) does with each, and measures them:
+//   - the plan for texts of various kinds, sent to a fake injector that counts the events
+//     and the calls, which must add up to one call with a press and a release per unit;
+//   - the pipeline with a fake host in virtual time: a typed translation ends at once, with
+//     no paste keys and no delay, while a pasted one waits for the paste delay;
+// With text files, selections of a few words from each line are planned, to see how many
+// of them would be typed.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o typebench typebench.c ../src/inject.c
+//     ../src/pipeline.c ../src/trace.c
+//
+// typebench [FILE...]
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "inject.h"
+#include "pipeline.h"
+#include "trace.h"
+#include "common.h"
+#include "check.h"
+
+static double Seconds( void )
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// UTF-8 to UTF-16, for the texts in the checks and the files
+static size_t ToUtf16( const char* utf8, UTF16* out, size_t max )
+{
+	const unsigned char* p = (const unsigned char*)utf8;
+	size_t n = 0;
+	while( *p && n + 2 <= max )
+	{
+		unsigned len = (*p < 0x80) ? 1 : (*p < 0xE0) ? 2 : (*p < 0xF0) ? 3 : 4;
+		uint32_t u = (len == 1) ? *p : (*p & (0x3F >> (len - 1)));
+		for( unsigned k = 1; k < len && p[k]; ++k )  u = (u << 6) | (p[k] & 0x3F);
+		p += len;
+		if( u >= 0x10000 )
+		{
+			out[n++] = 0xD800 + ((u - 0x10000) >> 10);
+			out[n++] = 0xDC00 + ((u - 0x10000) & 0x3FF);
+		}
+		else out[n++] = u;
+	}
+	return n;
+}
+
+// ---- the plan ---------------------------------------------------------------
+
+typedef struct
+{
+	unsigned  calls;
+	size_t    events;
+	size_t    downs;
+	bool      in_order;   // each press followed by its release, the units as planned
+	UTF16     text [INJECT_MAX_EVENTS];
+	size_t    length;
+} Counter;
+
+static bool CountEvents( void* ctx, const InjectEvent* events, size_t count )
+{
+	Counter* c = ctx;
+	++c->calls;
+	c->events += count;
+	for( size_t i = 0; i < count; ++i )
+	{
+		if( events[i].up )  continue;
+		++c->downs;
+		c->in_order &= (i + 1 < count) && events[i + 1].up && (events[i + 1].unit == events[i].unit)
+		               && (events[i].vk == 0) && (events[i + 1].vk == 0);
+		c->text[c->length++] = events[i].unit;
+	}
+	return true;
+}
+
+static void CheckPlan( const char* utf8, bool special_target, bool typed )
+{
+	static InjectBatch batch;
+	UTF16 text [256];
+	size_t n = ToUtf16(utf8, text, COUNTOF(text));
+
+	Counter counter = { .in_order = true };
+	const Injector fake = { CountEvents, &counter };
+	bool planned = InjectPlanTyping(&batch, text, n, special_target);
+	bool sent = planned && InjectSend(&batch, &fake);
+
+	char what [200];
+	snprintf(what, sizeof(what), "%-8s [%.40s]%s (%zu units, %zu events in %u call(s))",
+	         typed ? "typed" : "pasted", utf8, special_target ? " into a special target" : "",
+	         n, counter.events, counter.calls);
+	Check((planned == typed) && (sent == typed)
+	      && (typed ? (counter.calls == 1) && (counter.events == n * 2) && (counter.downs == n)
+	                  && counter.in_order && (counter.length == n)
+	                  && (memcmp(counter.text, text, n * sizeof(text[0])) == 0)
+	                : (counter.calls == 0) && (batch.count == 0)),
+	      what);
+}
+
+static void CheckPlans( void )
+{
+	char longest [INJECT_MAX_TYPED + 2];
+	memset(longest, 'a', sizeof(longest));
+	longest[INJECT_MAX_TYPED] = 0;
+
+	CheckPlan("привет", false, true);
+	CheckPlan("hello, world.", false, true);
+	CheckPlan("U+0040 -> @ 0x40", false, true);
+	CheckPlan("😀 and ✓", false, true);           // a surrogate pair types as two units
+	CheckPlan(longest, false, true);
+	CheckPlan("привет", true, false);             // special targets get pasted
+	CheckPlan("", false, false);                   // nothing to type
+	CheckPlan("two\r\nlines", false, false);       // line breaks may act as commands
+	CheckPlan("a\ttab", false, false);
+	CheckPlan("f(x)", false, false);               // editors may close these as they are typed
+	CheckPlan("[list]", false, false);
+	CheckPlan("don't", false, false);
+	CheckPlan("\"quoted\"", false, false);
+	CheckPlan("a) b] c} <d>", false, true);       // the closing ones are safe
+	longest[INJECT_MAX_TYPED] = 'a';
+	longest[INJECT_MAX_TYPED + 1] = 0;
+	CheckPlan(longest, false, false);              // too long
+
+	// a batch left over from a typed text must not be sent after a paste plan
+	static InjectBatch batch;
+	const UTF16 word [] = { 'w', 'o', 'r', 'd' }, line [] = { 'a', '\n', 'b' };
+	bool typed = InjectPlanTyping(&batch, word, COUNTOF(word), false);
+	bool pasted = !InjectPlanTyping(&batch, line, COUNTOF(line), false);
+	Check(typed && pasted && (batch.count == 0), "a paste plan clears the batch");
+}
+
+// ---- the pipeline -----------------------------------------------------------
+
+typedef struct
+{
+	uint32_t    now_ms;
+	bool        timer_on;
+	PipeOutput  output;      // what the translation does
+	unsigned    translations, copy_keys, paste_keys, idles;
+	bool        pasted;
+	uint32_t    idle_ms;
+} FakeHost;
+
+static FakeHost gHost;
+
+uint64_t AppTraceNow_us( void )
+{
+	return gHost.now_ms * 1000ULL;
+}
+
+static uint32_t HostNow( void* _ )                                  { return gHost.now_ms; }
+static bool HostStartTimer( void* _ )                               { return gHost.timer_on = true; }
+static void HostStopTimer( void* _ )                                { gHost.timer_on = false; }
+static SpecialHandling HostSpecialHandling( void* _, PipeWindow w )  { return (SpecialHandling)w; }
+static void HostPostCopy( void* _, PipeWindow target )              {}
+static bool HostSendCopyKeys( void* _, SpecialHandling sh )         { return ++gHost.copy_keys; }
+static bool HostSendPasteKeys( void* _, SpecialHandling sh )        { return ++gHost.paste_keys; }
+
+static PipeOutput HostTranslate( void* _, PipeLayout layout, SpecialHandling sh )
+{
+	++gHost.translations;
+	return gHost.output;
+}
+
+static void HostIdle( void* _, bool pasted )
+{
+	++gHost.idles;
+	gHost.pasted = pasted;
+	gHost.idle_ms = gHost.now_ms;
+}
+
+// one translation, the app copying after `copy_ms`; false if it has not ended in a second
+static bool Run( Pipeline* p, PipeOutput output, uint32_t copy_ms )
+{
+	memset(&gHost, 0, sizeof(gHost));
+	gHost.output = output;
+	PipelineStart(p, shNoSpecialHandling, 1);
+	for( uint32_t ms = 1; (ms <= 1000) && (gHost.idles == 0); ++ms )
+	{
+		gHost.now_ms = ms;
+		if( ms == copy_ms )  PipelineOnClipboardUpdate(p);
+		if( gHost.timer_on && (ms % 16 == 0) )  PipelineOnTimer(p);
+	}
+	return (gHost.idles == 1);
+}
+
+static void CheckPipeline( void )
+{
+	const PipelineHost host =
+	{
+		.now_ms = HostNow,
+		.start_timer = HostStartTimer,
+		.stop_timer = HostStopTimer,
+		.special_handling = HostSpecialHandling,
+		.post_copy = HostPostCopy,
+		.send_copy_keys = HostSendCopyKeys,
+		.send_paste_keys = HostSendPasteKeys,
+		.translate_clipboard = HostTranslate,
+		.idle = HostIdle,
+	};
+	const PipelineTimeouts timeouts = PIPELINE_DEFAULT_TIMEOUTS;
+	Pipeline p;
+	PipelineInit(&p, &host, &timeouts);
+
+	char what [200];
+	bool ended = Run(&p, poTyped, 5);
+	snprintf(what, sizeof(what), "typed: ends at the copy, with no paste keys (%lums)", (unsigned long)gHost.idle_ms);
+	Check(ended && gHost.pasted && (gHost.idle_ms == 5) && (gHost.paste_keys == 0) && !gHost.timer_on
+	      && !PipelineIsBusy(&p), what);
+
+	ended = Run(&p, poPaste, 5);
+	snprintf(what, sizeof(what), "pasted: ends after the paste delay (%lums)", (unsigned long)gHost.idle_ms);
+	Check(ended && gHost.pasted && (gHost.idle_ms >= 5 + timeouts.paste_delay_ms) && (gHost.paste_keys == 1)
+	      && !gHost.timer_on, what);
+
+	ended = Run(&p, poFailed, 5);
+	Check(ended && !gHost.pasted && (gHost.translations == 1) && (gHost.copy_keys == 1) && (gHost.paste_keys == 0),
+	      "failed: waits for another copy, then gives up");
+
+	// a late copy coming after the text has been typed changes nothing
+	ended = Run(&p, poTyped, 150);
+	PipelineOnClipboardUpdate(&p);
+	Check(ended && (gHost.translations == 1) && (gHost.copy_keys == 1) && !PipelineIsBusy(&p),
+	      "typed after the keyboard copy, then a late WM_COPY reply is ignored");
+}
+
+// ---- the files --------------------------------------------------------------
+
+static const unsigned kWords [] = { 1, 2, 3, 5, 8 };
+
+static void PlanSelections( const char* path )
+{
+	FILE* f = fopen(path, "r");
+	if( f == NULL )
+	{
+		printf("FAIL cannot open %s\n", path);
+		gFailed = true;
+		return;
+	}
+
+	static InjectBatch batch;
+	unsigned long planned [COUNTOF(kWords)] = {0}, typed [COUNTOF(kWords)] = {0};
+	unsigned long long events [COUNTOF(kWords)] = {0};
+	unsigned long total = 0;
+	double seconds = 0;
+	char line [4096];
+	UTF16 text [4096];
+	while( fgets(line, sizeof(line), f) )
+	{
+		line[strcspn(line, "\r\n")] = 0;
+		// the first few words of the line, as a selection would have them
+		for( unsigned w = 0; w < COUNTOF(kWords); ++w )
+		{
+			char* end = line;
+			unsigned nwords = 0;
+			while( *end && nwords < kWords[w] )
+			{
+				while( *end == ' ' )  ++end;
+				if( *end == 0 )  break;
+				while( *end && *end != ' ' )  ++end;
+				++nwords;
+			}
+			if( nwords < kWords[w] )  continue;
+
+			char saved = *end;
+			*end = 0;
+			size_t n = ToUtf16(line, text, COUNTOF(text));
+			*end = saved;
+
+			double started = Seconds();
+			bool ok = InjectPlanTyping(&batch, text, n, false);
+			seconds += Seconds() - started;
+			++total;
+
+			++planned[w];
+			if( ok )
+			{
+				++typed[w];
+				events[w] += batch.count;
+			}
+		}
+	}
+	fclose(f);
+
+	printf("%s:", path);
+	for( unsigned w = 0; w < COUNTOF(kWords); ++w )
+	{
+		if( planned[w] == 0 )  continue;
+		printf("  %u word(s) %.0f%% typed (%.0f events)", kWords[w], 100.0 * typed[w] / planned[w],
+		       typed[w] ? (double)events[w] / typed[w] : 0.0);
+	}
+	printf("; %.0f ns to plan\n", total ? seconds * 1e9 / total : 0.0);
+}
+
+int main( int argc, char* argv[] )
+{
+	CheckPlans();
+	CheckPipeline();
+	for( int i = 1; i < argc; ++i )  PlanSelections(argv[i]);
+	return gFailed ? 1 : 0;
+}
@@ -0,0 +1,533 @@
+// Generates the Unicode data tables from the UCD files (https://www.unicode.org/Public/UCD/latest/ucd/).
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o ucdgen ucdgen.c
+//
+// ucdgen grapheme UCD_DIR > ../src/graphemetab.h
+//     from auxiliary/GraphemeBreakProperty.txt and emoji/emoji-data.txt
+//
+// ucdgen names UCD_DIR kbsw-names.bin
+//     the character name index (see src/names.h) from UnicodeData.txt
+//
+// ucdgen case UCD_DIR > ../src/casetab.h
+//     the simple case mappings from UnicodeData.txt
+//
+// ucdgen keysyms /usr/include/X11/keysymdef.h > ../src/keysymtab.h
+//     the characters of the X11 keysyms, from the comments of keysymdef.h (not the UCD,
+//     but its table of codepoints all the same)
+//
+// The files are looked for in UCD_DIR itself too.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "grapheme.h"
+#include "names.h"
+
+#define COUNTOF(a)  (sizeof(a) / sizeof((a)[0]))
+
+enum
+{
+	CODESPACE = 0x110000,
+	GRAPHEME_BLOCK_SHIFT = 7,
+	GRAPHEME_BLOCK = 1 << GRAPHEME_BLOCK_SHIFT,
+};
+
+// the property value names, in the order of GraphemeBreak
+static const char* const kGraphemeBreakNames [GRAPHEME_BREAK_VALUES] =
+{
+	"Other", "CR", "LF", "Control", "Extend", "ZWJ", "Regional_Indicator", "Prepend",
+	"SpacingMark", "L", "V", "T", "LV", "LVT", "Extended_Pictographic",
+};
+
+static uint8_t gProperty [CODESPACE];
+static char gVersion [32];
+
+static FILE* OpenUcdFile( const char* dir, const char* subdir, const char* name )
+{
+	char path [1024];
+	snprintf(path, sizeof(path), "%s/%s/%s", dir, subdir, name);
+	FILE* f = fopen(path, "r");
+	if( f )  return f;
+
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+	f = fopen(path, "r");
+	if( f == NULL )  fprintf(stderr, "cannot open %s\n", path);
+	return f;
+}
+
+// Reads the lines like "1F1E6..1F1FF ; Regional_Indicator # ..." and sets gProperty for the
+// values it knows (the others are skipped). Picks up the version from the first line.
+static bool ReadPropertyFile( FILE* f, const char* const* names, unsigned nnames, bool only_over_other )
+{
+	char line [1024];
+	for( unsigned lineno = 1; fgets(line, sizeof(line), f); ++lineno )
+	{
+		const char* v = strstr(line, "-");
+		if( (lineno == 1) && (line[0] == '#') && v && !gVersion[0] )
+		{
+			sscanf(v + 1, "%31[0-9.]", gVersion);
+			size_t n = strlen(gVersion);
+			if( n && (gVersion[n - 1] == '.') )  gVersion[n - 1] = 0;
+		}
+
+		char* hash = strchr(line, '#');
+		if( hash )  *hash = 0;
+
+		unsigned first, last;
+		char name [64];
+		int n = sscanf(line, "%x..%x ; %63[A-Za-z_]", &first, &last, name);
+		if( n < 3 )
+		{
+			n = sscanf(line, "%x ; %63[A-Za-z_]", &first, name);
+			if( n < 2 )  continue;
+			last = first;
+		}
+		if( (first > last) || (last >= CODESPACE) )
+			return fprintf(stderr, "line %u: bad range\n", lineno), false;
+
+		for( unsigned i = 0; i < nnames; ++i )
+		{
+			if( strcmp(name, names[i]) != 0 )  continue;
+			for( unsigned cp = first; cp <= last; ++cp )
+			{
+				if( only_over_other && (gProperty[cp] != gbOther) )
+				{
+					fprintf(stderr, "line %u: U+%04X is %s already\n", lineno, cp, kGraphemeBreakNames[gProperty[cp]]);
+					continue;
+				}
+				gProperty[cp] = i;
+			}
+		}
+	}
+	return true;
+}
+
+static int GenerateGraphemeTables( const char* dir )
+{
+	FILE* f = OpenUcdFile(dir, "auxiliary", "GraphemeBreakProperty.txt");
+	if( f == NULL )  return 1;
+	bool ok = ReadPropertyFile(f, kGraphemeBreakNames, gbExtendedPictographic, false);
+	fclose(f);
+
+	f = OpenUcdFile(dir, "emoji", "emoji-data.txt");
+	if( f == NULL )  return 1;
+	ok = ok && ReadPropertyFile(f, kGraphemeBreakNames, GRAPHEME_BREAK_VALUES, true);
+	fclose(f);
+	if( !ok )  return 1;
+
+	// the second level: the distinct blocks of two values per byte, the first one: their indices
+	static uint8_t blocks [CODESPACE / GRAPHEME_BLOCK][GRAPHEME_BLOCK / 2];
+	static unsigned index [CODESPACE / GRAPHEME_BLOCK];
+	unsigned nblocks = 0;
+
+	for( unsigned b = 0; b < COUNTOF(index); ++b )
+	{
+		uint8_t packed [GRAPHEME_BLOCK / 2];
+		for( unsigned i = 0; i < COUNTOF(packed); ++i )
+		{
+			const uint8_t* p = &gProperty[b * GRAPHEME_BLOCK + i * 2];
+			packed[i] = p[0] | (p[1] << 4);
+		}
+
+		unsigned k = 0;
+		while( (k < nblocks) && (memcmp(blocks[k], packed, sizeof(packed)) != 0) )  ++k;
+		if( k == nblocks )  memcpy(blocks[nblocks++], packed, sizeof(packed));
+		index[b] = k;
+	}
+	if( nblocks > 256 )  return fprintf(stderr, "too many distinct blocks (%u)\n", nblocks), 1;
+
+	printf("// Generated by tools/ucdgen.c from GraphemeBreakProperty.txt and emoji-data.txt\n"
+	       "// of Unicode %s. Do not edit.\n"
+	       "//\n"
+	       "// The GraphemeBreak value of a codepoint is a nibble (the low one for the even\n"
+	       "// codepoints) of kGraphemeBlocks[kGraphemeIndex[cp >> %d]][(cp & %d) >> 1].\n"
+	       "// %u + %u bytes.\n\n",
+	       gVersion[0] ? gVersion : "(unknown version)", GRAPHEME_BLOCK_SHIFT, GRAPHEME_BLOCK - 1,
+	       (unsigned)COUNTOF(index), nblocks * GRAPHEME_BLOCK / 2);
+
+	printf("enum { GRAPHEME_BLOCK_SHIFT = %d };\n\n", GRAPHEME_BLOCK_SHIFT);
+
+	printf("static const uint8_t kGraphemeIndex [%u] =\n{", (unsigned)COUNTOF(index));
+	for( unsigned b = 0; b < COUNTOF(index); ++b )
+	{
+		printf("%s%u,", (b % 24) ? " " : "\n\t", index[b]);
+	}
+	printf("\n};\n\n");
+
+	printf("static const uint8_t kGraphemeBlocks [%u][%d] =\n{\n", nblocks, GRAPHEME_BLOCK / 2);
+	for( unsigned k = 0; k < nblocks; ++k )
+	{
+		printf("\t{");
+		for( unsigned i = 0; i < GRAPHEME_BLOCK / 2; ++i )
+		{
+			printf("%s0x%02X,", (i % 16) ? " " : (i ? "\n\t " : ""), blocks[k][i]);
+		}
+		printf("},\n");
+	}
+	printf("};\n");
+	return 0;
+}
+
+// ---- the name index ---------------------------------------------------------
+
+typedef struct
+{
+	uint32_t  codepoint;
+	char*     name;
+} NameEntry;
+
+static int CompareByName( const void* a, const void* b )
+{
+	return strcmp(((const NameEntry*)a)->name, ((const NameEntry*)b)->name);
+}
+
+static int CompareByCodepoint( const void* a, const void* b )
+{
+	uint32_t x = **(const uint32_t* const*)a, y = **(const uint32_t* const*)b;
+	return (x > y) - (x < y);
+}
+
+// the version is not in UnicodeData.txt: it is taken from another file, if it's there
+static void ReadVersion( const char* dir )
+{
+	FILE* f = OpenUcdFile(dir, "auxiliary", "GraphemeBreakProperty.txt");
+	if( f == NULL )  return;
+	ReadPropertyFile(f, NULL, 0, false);
+	fclose(f);
+}
+
+static bool Append( uint8_t** pbuffer, size_t* plength, size_t* psize, const void* data, size_t n )
+{
+	while( *plength + n > *psize )
+	{
+		*psize = *psize ? *psize * 2 : 65536;
+		*pbuffer = realloc(*pbuffer, *psize);
+		if( *pbuffer == NULL )  return false;
+	}
+	memcpy(*pbuffer + *plength, data, n);
+	*plength += n;
+	return true;
+}
+
+static int GenerateNameIndex( const char* dir, const char* out_path )
+{
+	FILE* f = OpenUcdFile(dir, ".", "UnicodeData.txt");
+	if( f == NULL )  return 1;
+
+	static NameEntry entries [CODESPACE / 4];
+	static NameRange ranges [64];
+	unsigned nentries = 0, nranges = 0;
+	char line [1024];
+	for( unsigned lineno = 1; fgets(line, sizeof(line), f); ++lineno )
+	{
+		unsigned cp;
+		char name [128];
+		if( sscanf(line, "%x;%127[^;]", &cp, name) != 2 )  continue;
+		if( cp >= CODESPACE )  return fprintf(stderr, "line %u: bad codepoint\n", lineno), 1;
+
+		if( name[0] != '<' )
+		{
+			size_t n = strlen(name);
+			if( n >= NAMES_MAX_LENGTH )  return fprintf(stderr, "line %u: name too long\n", lineno), 1;
+			if( nentries == COUNTOF(entries) )  return fprintf(stderr, "too many names\n"), 1;
+			entries[nentries].codepoint = cp;
+			entries[nentries].name = malloc(n + 1);
+			if( entries[nentries].name == NULL )  return fprintf(stderr, "out of memory\n"), 1;
+			memcpy(entries[nentries].name, name, n + 1);
+			++nentries;
+			continue;
+		}
+
+		// the ranges: <CJK Ideograph Extension A, First> ... <CJK Ideograph Extension A, Last>
+		const char* prefix = strstr(name, "CJK Ideograph") ? "CJK UNIFIED IDEOGRAPH-"
+		                   : strstr(name, "Tangut Ideograph") ? "TANGUT IDEOGRAPH-"
+		                   : strstr(name, "Hangul Syllable") ? ""
+		                   : NULL;
+		if( prefix == NULL )  continue;
+		if( strstr(name, ", First>") )
+		{
+			if( nranges == COUNTOF(ranges) )  return fprintf(stderr, "too many ranges\n"), 1;
+			NameRange* r = &ranges[nranges];
+			memset(r, 0, sizeof(*r));
+			r->first = r->last = cp;
+			r->kind = prefix[0] ? nrHexSuffix : nrHangul;
+			memcpy(r->prefix, prefix, strlen(prefix));
+		}
+		else if( strstr(name, ", Last>") && nranges < COUNTOF(ranges) )
+		{
+			ranges[nranges++].last = cp;
+		}
+	}
+	fclose(f);
+	if( (nentries == 0) || (nentries > 0xFFFF) )  return fprintf(stderr, "%u names?\n", nentries), 1;
+	ReadVersion(dir);
+
+	// the names in order, front-coded
+	qsort(entries, nentries, sizeof(entries[0]), CompareByName);
+
+	uint8_t* names = NULL;
+	size_t names_length = 0, names_size = 0;
+	unsigned nblocks = (nentries + NAMES_BLOCK - 1) / NAMES_BLOCK;
+	uint32_t* blocks = malloc(nblocks * sizeof(uint32_t));
+	if( blocks == NULL )  return fprintf(stderr, "out of memory\n"), 1;
+
+	for( unsigned i = 0; i < nentries; ++i )
+	{
+		const char* name = entries[i].name;
+		size_t prefix = 0;
+		if( i % NAMES_BLOCK == 0 )
+			blocks[i / NAMES_BLOCK] = names_length;
+		else
+			while( name[prefix] && (name[prefix] == entries[i - 1].name[prefix]) )  ++prefix;
+
+		size_t rest = strlen(name) - prefix;
+		uint32_t cp = entries[i].codepoint;
+		uint8_t head [2] = { prefix, rest }, tail [3] = { cp, cp >> 8, cp >> 16 };
+		if( !Append(&names, &names_length, &names_size, head, 2)
+		 || !Append(&names, &names_length, &names_size, name + prefix, rest)
+		 || !Append(&names, &names_length, &names_size, tail, 3) )
+			return fprintf(stderr, "out of memory\n"), 1;
+	}
+
+	// the codepoints in order, with the index of their name
+	const uint32_t** by_codepoint = malloc(nentries * sizeof(*by_codepoint));
+	uint32_t* codepoints = malloc(nentries * sizeof(uint32_t));
+	uint16_t* order = malloc(nentries * sizeof(uint16_t));
+	if( !by_codepoint || !codepoints || !order )  return fprintf(stderr, "out of memory\n"), 1;
+	for( unsigned i = 0; i < nentries; ++i )  by_codepoint[i] = &entries[i].codepoint;
+	qsort(by_codepoint, nentries, sizeof(*by_codepoint), CompareByCodepoint);
+	for( unsigned i = 0; i < nentries; ++i )
+	{
+		codepoints[i] = *by_codepoint[i];
+		order[i] = (const NameEntry*)by_codepoint[i] - entries;
+	}
+
+	NameFileHeader h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, NAMES_MAGIC, sizeof(h.magic));
+	snprintf(h.unicode_version, sizeof(h.unicode_version), "%.15s", gVersion);
+	h.ncodepoints = nentries;
+	h.nblocks = nblocks;
+	h.nranges = nranges;
+	h.codepoints = sizeof(h);
+	h.order = h.codepoints + nentries * sizeof(uint32_t);
+	h.names = (h.order + nentries * sizeof(uint16_t) + 3) & ~3u;
+	h.blocks = (h.names + names_length + 3) & ~3u;
+	h.ranges = h.blocks + nblocks * sizeof(uint32_t);
+	h.size = h.ranges + nranges * sizeof(NameRange);
+
+	f = fopen(out_path, "wb");
+	if( f == NULL )  return fprintf(stderr, "cannot create %s\n", out_path), 1;
+	static const uint8_t kPadding [4];
+	bool ok = (fwrite(&h, sizeof(h), 1, f) == 1)
+	       && (fwrite(codepoints, sizeof(uint32_t), nentries, f) == nentries)
+	       && (fwrite(order, sizeof(uint16_t), nentries, f) == nentries)
+	       && (fwrite(kPadding, 1, h.names - (h.order + nentries * sizeof(uint16_t)), f) == h.names - (h.order + nentries * sizeof(uint16_t)))
+	       && (fwrite(names, 1, names_length, f) == names_length)
+	       && (fwrite(kPadding, 1, h.blocks - (h.names + names_length), f) == h.blocks - (h.names + names_length))
+	       && (fwrite(blocks, sizeof(uint32_t), nblocks, f) == nblocks)
+	       && (fwrite(ranges, sizeof(NameRange), nranges, f) == nranges);
+	ok = (fclose(f) == 0) && ok;
+	if( !ok )  return fprintf(stderr, "cannot write %s\n", out_path), 1;
+
+	size_t raw = 0;
+	for( unsigned i = 0; i < nentries; ++i )  raw += strlen(entries[i].name) + 1;
+	fprintf(stderr, "%s: Unicode %s, %u names (%zu bytes of them, front-coded into %zu) and %u ranges, %u bytes\n",
+	        out_path, gVersion[0] ? gVersion : "?", nentries, raw, names_length, nranges, h.size);
+	return 0;
+}
+
+// ---- the case mappings ------------------------------------------------------
+
+typedef struct
+{
+	int32_t  upper, lower, title;   // the differences from the codepoint
+} CaseDeltas;
+
+static int GenerateCaseTables( const char* dir )
+{
+	FILE* f = OpenUcdFile(dir, ".", "UnicodeData.txt");
+	if( f == NULL )  return 1;
+
+	// the distinct mappings, as differences, so that whole alphabets share a few of them;
+	// gProperty is the index of that of each codepoint (0 for none)
+	static CaseDeltas records [256];
+	unsigned nrecords = 1, limit = 0, nmapped = 0;
+	char line [1024];
+	for( unsigned lineno = 1; fgets(line, sizeof(line), f); ++lineno )
+	{
+		// the fields 12-14 (from 0): the simple upper, lower and title case mappings
+		const char* field [15];
+		unsigned nfields = 0;
+		for( char* p = line; p && (nfields < COUNTOF(field)); )
+		{
+			field[nfields++] = p;
+			p = strchr(p, ';');
+			if( p )  *p++ = 0;
+		}
+		if( nfields < COUNTOF(field) )  continue;
+
+		unsigned cp, upper = 0, lower = 0, title = 0;
+		if( sscanf(field[0], "%x", &cp) != 1 )  continue;
+		if( cp >= CODESPACE )  return fprintf(stderr, "line %u: bad codepoint\n", lineno), 1;
+		bool has_upper = (sscanf(field[12], "%x", &upper) == 1);
+		bool has_lower = (sscanf(field[13], "%x", &lower) == 1);
+		bool has_title = (sscanf(field[14], "%x", &title) == 1);
+		if( !has_upper && !has_lower && !has_title )  continue;
+		// the translators rely on a mapping giving as many UTF-16 units as it takes
+		bool bmp = (cp < 0x10000);
+		if( (has_upper && ((upper < 0x10000) != bmp)) || (has_lower && ((lower < 0x10000) != bmp))
+		    || (has_title && ((title < 0x10000) != bmp)) )
+			return fprintf(stderr, "line %u: a case mapping crosses the BMP boundary\n", lineno), 1;
+
+		CaseDeltas d =
+		{
+			.upper = has_upper ? (int32_t)upper - (int32_t)cp : 0,
+			.lower = has_lower ? (int32_t)lower - (int32_t)cp : 0,
+			.title = has_title ? (int32_t)title - (int32_t)cp : has_upper ? (int32_t)upper - (int32_t)cp : 0,
+		};
+		unsigned k = 1;
+		while( (k < nrecords) && memcmp(&records[k], &d, sizeof(d)) )  ++k;
+		if( k == COUNTOF(records) )  return fprintf(stderr, "too many distinct case mappings\n"), 1;
+		if( k == nrecords )  records[nrecords++] = d;
+		gProperty[cp] = k;
+		limit = cp + 1;
+		++nmapped;
+	}
+	fclose(f);
+	ReadVersion(dir);
+
+	// the size of the blocks that makes the smallest tables
+	unsigned best_shift = 0, best_size = ~0u;
+	static uint8_t blocks [CODESPACE];
+	static unsigned index [CODESPACE];
+	for( unsigned pass = 0; pass < 2; ++pass )
+	{
+		for( unsigned shift = 3; shift <= 9; ++shift )
+		{
+			if( pass && (shift != best_shift) )  continue;
+
+			unsigned block = 1 << shift, nindex = (limit + block - 1) >> shift, nblocks = 0;
+			for( unsigned b = 0; b < nindex; ++b )
+			{
+				unsigned k = 0;
+				while( (k < nblocks) && memcmp(blocks + k * block, gProperty + b * block, block) )  ++k;
+				if( k == nblocks )  memcpy(blocks + nblocks++ * block, gProperty + b * block, block);
+				index[b] = k;
+			}
+
+			unsigned size = nindex * ((nblocks > 256) ? 2 : 1) + nblocks * block;
+			if( !pass && (size < best_size) )  best_shift = shift, best_size = size;
+			if( !pass )  continue;
+
+			const char* index_type = (nblocks > 256) ? "uint16_t" : "uint8_t";
+			printf("// Generated by tools/ucdgen.c from UnicodeData.txt of Unicode %s. Do not edit.\n"
+			       "//\n"
+			       "// The simple case mappings of the %u codepoints that have them, as differences from\n"
+			       "// the codepoint: kCaseRecords[kCaseBlocks[kCaseIndex[cp >> %u]][cp & %u]] for the\n"
+			       "// codepoints below CASE_LIMIT (the others have none). %u + %u + %u bytes.\n\n",
+			       gVersion[0] ? gVersion : "(unknown version)", nmapped, shift, block - 1,
+			       nrecords * (unsigned)sizeof(CaseDeltas), size - nblocks * block, nblocks * block);
+
+			printf("enum { CASE_BLOCK_SHIFT = %u, CASE_LIMIT = 0x%X };\n\n", shift, nindex << shift);
+
+			printf("static const CaseRecord kCaseRecords [%u] =\n{\n", nrecords);
+			for( unsigned k = 0; k < nrecords; ++k )
+			{
+				printf("\t{ %d, %d, %d },\n", records[k].upper, records[k].lower, records[k].title);
+			}
+			printf("};\n\n");
+
+			printf("static const %s kCaseIndex [%u] =\n{", index_type, nindex);
+			for( unsigned b = 0; b < nindex; ++b )
+			{
+				printf("%s%u,", (b % 24) ? " " : "\n\t", index[b]);
+			}
+			printf("\n};\n\n");
+
+			printf("static const uint8_t kCaseBlocks [%u][%u] =\n{\n", nblocks, block);
+			for( unsigned k = 0; k < nblocks; ++k )
+			{
+				printf("\t{");
+				for( unsigned i = 0; i < block; ++i )
+				{
+					printf("%s%u,", (i % 32) ? " " : (i ? "\n\t " : ""), blocks[k * block + i]);
+				}
+				printf("},\n");
+			}
+			printf("};\n");
+		}
+	}
+	return 0;
+}
+
+// -----------------------------------------------------------------------------
+
+typedef struct { unsigned keysym, ucs; } KeysymPair;
+
+static int CompareKeysyms( const void* a, const void* b )
+{
+	const KeysymPair *x = a, *y = b;
+	return (x->keysym > y->keysym) - (x->keysym < y->keysym);
+}
+
+static int GenerateKeysymTable( const char* path )
+{
+	FILE* f = fopen(path, "r");
+	if( f == NULL )  return fprintf(stderr, "cannot open %s\n", path), 1;
+
+	// "#define XK_Cyrillic_yu  0x06c0  /* U+044E CYRILLIC SMALL LETTER YU */"; a mapping in
+	// parentheses is only an approximate one, and left out. Latin-1 (the keysym is the
+	// codepoint) and the Unicode keysyms (0x1000000 + the codepoint) need no table.
+	static KeysymPair pairs [0x10000];
+	unsigned npairs = 0;
+	char line [1024];
+	while( fgets(line, sizeof(line), f) )
+	{
+		char name [128];
+		unsigned keysym, ucs;
+		if( sscanf(line, "#define XK_%127s 0x%x /* U+%x", name, &keysym, &ucs) != 3 )  continue;
+		if( (keysym >= 0x10000) || (ucs >= 0x10000) )  continue;
+		if( ((keysym >= 0x20) && (keysym < 0x7F)) || ((keysym >= 0xA0) && (keysym < 0x100)) )  continue;
+		pairs[npairs++] = (KeysymPair){ keysym, ucs };
+	}
+	fclose(f);
+
+	qsort(pairs, npairs, sizeof(pairs[0]), CompareKeysyms);
+	// the aliases come with the same character: only the first of each keysym stays
+	unsigned n = 0;
+	for( unsigned i = 0; i < npairs; ++i )
+	{
+		if( (n == 0) || (pairs[n - 1].keysym != pairs[i].keysym) )  pairs[n++] = pairs[i];
+	}
+
+	printf("// Generated by tools/ucdgen.c from X11/keysymdef.h. Do not edit.\n"
+	       "//\n"
+	       "// The characters of the %u keysyms below 0x10000 that have one, other than Latin-1,\n"
+	       "// sorted by the keysym. %u bytes.\n\n", n, n * 4);
+	printf("static const KeysymRecord kKeysyms [%u] =\n{", n);
+	for( unsigned i = 0; i < n; ++i )
+	{
+		printf("%s{ 0x%04X, 0x%04X },", (i % 6) ? " " : "\n\t", pairs[i].keysym, pairs[i].ucs);
+	}
+	printf("\n};\n");
+	return 0;
+}
+
+// -----------------------------------------------------------------------------
+
+int main( int argc, char* argv[] )
+{
+	if( (argc == 3) && (strcmp(argv[1], "grapheme") == 0) )  return GenerateGraphemeTables(argv[2]);
+	if( (argc == 4) && (strcmp(argv[1], "names") == 0) )  return GenerateNameIndex(argv[2], argv[3]);
+	if( (argc == 3) && (strcmp(argv[1], "case") == 0) )  return GenerateCaseTables(argv[2]);
+	if( (argc == 3) && (strcmp(argv[1], "keysyms") == 0) )  return GenerateKeysymTable(argv[2]);
+
+	fprintf(stderr, "usage: %s grapheme UCD_DIR > graphemetab.h\n"
+	                "       %s names UCD_DIR kbsw-names.bin\n"
+	                "       %s case UCD_DIR > casetab.h\n"
+	                "       %s keysyms KEYSYMDEF_H > keysymtab.h\n", argv[0], argv[0], argv[0], argv[0]);
+	return 1;
+}
@@ -0,0 +1,263 @@
+// A simulator of the keyboard hook watchdog (src/hookwatch.c): runs the real state
+// machine in virtual time, a millisecond at a time, against a simulated hook that the
+// system removes, as Windows does, when a callback takes longer than the timeout (or
+// for no visible reason), with typing, mouse input, failing reinstalls and probes that
+// cannot be injected; checks that the losses are found and mended, in how long, and
+// that a healthy hook is left alone: the probes are input too, and none is sent but for
+// keystrokes the hook has missed, none while there is no input (the screensaver and the
+// locking would never come) or only the mouse.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o watchsim watchsim.c ../src/hookwatch.c
+//
+// watchsim [--period=MS] [--probe-timeout=MS] [--unseen=MS]
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hookwatch.h"
+#include "common.h"
+#include "check.h"
+
+enum
+{
+	HOOK_TIMEOUT_us = 300000,   // LowLevelHooksTimeout
+	CALLBACK_us     = 40,       // of an ordinary callback
+	PROBE_DELAY_ms  = 2,        // from SendInput to the callback
+	NEVER           = UINT32_MAX,
+};
+
+typedef struct
+{
+	const char*  name;
+	uint32_t     duration_ms;
+	uint32_t     typing_ms;        // between the keystrokes; 0 for none
+	uint32_t     mouse_ms;         // between the mouse moves; 0 for none
+	uint32_t     slow_at_ms;       // a keystroke whose callback takes slow_us
+	uint32_t     slow_us;
+	uint32_t     remove_at_ms;     // the system removes the hook, with no slow callback
+	unsigned     failing_reinstalls;
+	bool         probes_blocked;   // SendInput fails (UIPI)
+	uint32_t     typing_from_ms;   // no typing before this
+} Scenario;
+
+// the simulated world
+typedef struct
+{
+	const Scenario*  sc;
+	uint32_t   now_ms;
+	uint32_t   last_input_ms;
+	bool       hooked;
+	uint32_t   probe_at_ms;        // a probe on its way
+	uint32_t   reinstall_at_ms;    // a reinstall asked for
+	unsigned   reinstalls;
+	unsigned   failing;            // reinstalls still to fail
+	uint32_t   lost_at_ms;         // the hook is gone since
+	uint32_t   recovered_ms;       // the longest it has been gone
+	unsigned   missed;             // keystrokes the hook has not seen
+	unsigned   injected;           // probes, as input to the system
+	uint32_t   longest_idle_ms;    // with no input at all, as the idle timer of the system sees it
+	unsigned   changes;
+	HookPulse  pulse;
+	HookWatchdog  watchdog;
+} World;
+
+static World gWorld;
+
+static void Lose( World* w )
+{
+	w->hooked = false;
+	w->lost_at_ms = w->now_ms;
+}
+
+static void Callback( World* w, bool probe, uint32_t elapsed_us )
+{
+	HookPulseBeat(&w->pulse, probe, elapsed_us);
+	if( elapsed_us > HOOK_TIMEOUT_us )  Lose(w);
+}
+
+// ---- the host ---------------------------------------------------------------
+
+static uint32_t HostNow( void* ctx )
+{
+	return ((World*)ctx)->now_ms;
+}
+
+static bool HostSendProbe( void* ctx )
+{
+	World* w = ctx;
+	if( w->sc->probes_blocked )  return false;
+	w->probe_at_ms = w->now_ms + PROBE_DELAY_ms;
+	w->last_input_ms = w->now_ms;   // injected input is input: the idle timer starts again
+	++w->injected;
+	return true;
+}
+
+static void HostReinstall( void* ctx )
+{
+	World* w = ctx;
+	w->reinstall_at_ms = w->now_ms + 1;
+}
+
+static void HostChanged( void* ctx )
+{
+	++((World*)ctx)->changes;
+}
+
+// -----------------------------------------------------------------------------
+
+static void Step( World* w )
+{
+	const Scenario* sc = w->sc;
+	uint32_t t = w->now_ms;
+
+	if( (t == sc->remove_at_ms) && w->hooked )  Lose(w);
+
+	// raw input sees the keystrokes, hooked or not
+	if( (t >= sc->typing_from_ms) && sc->typing_ms && (t % sc->typing_ms == 0) )
+	{
+		w->last_input_ms = t;
+		HookPulseKeyboard(&w->pulse);
+		if( w->hooked )  Callback(w, false, (t == sc->slow_at_ms) ? sc->slow_us : CALLBACK_us);
+		else ++w->missed;
+	}
+	if( sc->mouse_ms && (t % sc->mouse_ms == 0) )  w->last_input_ms = t;
+	if( t - w->last_input_ms > w->longest_idle_ms )  w->longest_idle_ms = t - w->last_input_ms;
+
+	if( t == w->probe_at_ms )
+	{
+		w->probe_at_ms = NEVER;
+		HookPulseKeyboard(&w->pulse);
+		if( w->hooked )  Callback(w, true, CALLBACK_us);
+	}
+
+	if( t == w->reinstall_at_ms )
+	{
+		w->reinstall_at_ms = NEVER;
+		++w->reinstalls;
+		if( w->failing )  --w->failing;
+		else
+		{
+			if( !w->hooked && (t - w->lost_at_ms > w->recovered_ms) )  w->recovered_ms = t - w->lost_at_ms;
+			w->hooked = true;
+		}
+	}
+
+	if( (t % w->watchdog.config.period_ms == 0) && t )  HookWatchTick(&w->watchdog, &w->pulse);
+}
+
+static const World* Run( const Scenario* sc, const HookWatchConfig* config )
+{
+	World* w = &gWorld;
+	memset(w, 0, sizeof(*w));
+	w->sc = sc;
+	w->hooked = true;
+	w->probe_at_ms = w->reinstall_at_ms = NEVER;
+	w->failing = sc->failing_reinstalls;
+	const HookWatchHost host = { HostNow, HostSendProbe, HostReinstall, HostChanged, w };
+	HookWatchInit(&w->watchdog, &host, config);
+
+	for( w->now_ms = 0; w->now_ms < sc->duration_ms; ++w->now_ms )  Step(w);
+
+	const HookWatchStats* st = &w->watchdog.stats;
+	printf("%-28s probes %3llu (input %llu, slow %llu, after reinstall %llu; %llu failed), "
+	       "reinstalls %u, down %5u ms, missed %u, slowest %u us, longest idle %u s\n", sc->name,
+	       (unsigned long long)(st->probes[hrInput] + st->probes[hrSlow] + st->probes[hrReinstalled]),
+	       (unsigned long long)st->probes[hrInput], (unsigned long long)st->probes[hrSlow],
+	       (unsigned long long)st->probes[hrReinstalled], (unsigned long long)st->probes_failed, w->reinstalls,
+	       w->hooked ? w->recovered_ms : w->now_ms - w->lost_at_ms, w->missed, st->worst_us, w->longest_idle_ms / 1000);
+	return w;
+}
+
+static bool ParseArg( const char* arg, const char* name, uint32_t* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+int main( int argc, char* argv [] )
+{
+	HookWatchConfig c = HOOKWATCH_DEFAULT_CONFIG;
+	for( int i = 1; i < argc; ++i )
+	{
+		if( ParseArg(argv[i], "--period", &c.period_ms) || ParseArg(argv[i], "--probe-timeout", &c.probe_timeout_ms)
+		 || ParseArg(argv[i], "--unseen", &c.unseen_ms) )
+			continue;
+		fprintf(stderr, "usage: watchsim [--period=MS] [--probe-timeout=MS] [--unseen=MS]\n");
+		return 2;
+	}
+	if( (c.period_ms == 0) || (c.probe_timeout_ms > c.period_ms) )
+		return fprintf(stderr, "the probe timeout is checked once a period: it should not be longer\n"), 2;
+
+	const uint32_t minute = 60000, off = NEVER;
+	// a probe is sent at a tick, and found missing at the next one; the reinstall takes a millisecond
+	const uint32_t detect_ms = 2 * c.period_ms + 1;
+	const World* w;
+
+	const Scenario typing = { "typing", 10 * minute, 150, 0, off, 0, off, 0, false };
+	w = Run(&typing, &c);
+	Check(w->reinstalls == 0, "typing: never reinstalled");
+	Check(w->injected == 0, "typing: no probes");
+
+	const Scenario idle = { "idle", 10 * minute, 0, 0, off, 0, off, 0, false };
+	w = Run(&idle, &c);
+	Check((w->reinstalls == 0) && (w->injected == 0) && (w->longest_idle_ms == idle.duration_ms - 1),
+	      "idle: no probes, the idle timer left to run");
+
+	// the mouse never reaches the hook, and is not keyboard input it has missed
+	const Scenario mouse = { "mouse only", 10 * minute, 0, 20, off, 0, off, 0, false };
+	w = Run(&mouse, &c);
+	Check((w->reinstalls == 0) && (w->injected == 0), "mouse only: no probes");
+
+	const Scenario slow_removed = { "slow callback, removed", 3 * minute, 150, 0, 60000, 400000, off, 0, false };
+	w = Run(&slow_removed, &c);
+	Check(w->hooked && (w->reinstalls == 1) && (w->recovered_ms <= detect_ms), "slow callback: reinstalled at once");
+	Check(w->watchdog.stats.worst_us == 400000, "slow callback: the worst latency recorded");
+
+	const Scenario slow_kept = { "slow callback, kept", 3 * minute, 150, 0, 60000, 150000, off, 0, false };
+	w = Run(&slow_kept, &c);
+	Check((w->reinstalls == 0) && (w->watchdog.stats.probes[hrSlow] == 1), "slow callback under the timeout: probed only");
+
+	const Scenario removed = { "removed while typing", 3 * minute, 150, 0, off, 0, 60001, 0, false };
+	w = Run(&removed, &c);
+	Check(w->hooked && (w->reinstalls == 1) && (w->recovered_ms <= c.unseen_ms + detect_ms + c.period_ms),
+	      "removed while typing: found by the unseen input");
+
+	// no input, no probes: it is found once there is some again
+	const Scenario removed_idle = { "removed while idle", 5 * minute, 150, 0, off, 0, 60001, 0, false, 4 * minute };
+	w = Run(&removed_idle, &c);
+	Check(w->hooked && (w->reinstalls == 1) && (w->injected == 2) && (w->longest_idle_ms == removed_idle.typing_from_ms - 1)
+	      && (w->recovered_ms <= removed_idle.typing_from_ms - removed_idle.remove_at_ms + c.unseen_ms + detect_ms + c.period_ms),
+	      "removed while idle: found at the input that follows");
+
+	// however long the mouse alone has been used, the first keystrokes find it
+	const Scenario removed_mouse = { "removed after the mouse", 20 * minute, 150, 20, off, 0, 15 * minute, 0, false, 15 * minute + 1000 };
+	w = Run(&removed_mouse, &c);
+	Check(w->hooked && (w->reinstalls == 1) && (w->injected == 2)
+	      && (w->recovered_ms <= removed_mouse.typing_from_ms - removed_mouse.remove_at_ms + c.unseen_ms + detect_ms + c.period_ms),
+	      "removed after a long while of the mouse: found at the keystrokes that follow");
+
+	const Scenario failing = { "reinstalls failing", 5 * minute, 150, 0, off, 0, 60001, 5, false };
+	w = Run(&failing, &c);
+	Check(w->hooked && (w->reinstalls == 6) && (w->watchdog.stats.losses == 6), "reinstalls failing: back after the sixth");
+
+	const Scenario down = { "reinstalls always failing", 30 * minute, 150, 0, off, 0, 60001, 1000, false };
+	w = Run(&down, &c);
+	unsigned bound = 0;
+	for( uint32_t t = 0, b = c.period_ms; t < down.duration_ms; t += b + c.period_ms, b = (b * 2 < c.max_backoff_ms) ? b * 2 : c.max_backoff_ms )
+		++bound;
+	Check(!w->hooked && (w->reinstalls > 1) && (w->reinstalls <= bound), "reinstalls always failing: backing off");
+
+	// nothing learnt, nothing done: the same probe again, no sooner than unseen_ms
+	const Scenario blocked = { "probes blocked", 10 * minute, 150, 0, off, 0, 60001, 0, true };
+	w = Run(&blocked, &c);
+	Check((w->reinstalls == 0) && (w->watchdog.stats.probes_failed > 0)
+	      && (w->watchdog.stats.probes_failed <= (blocked.duration_ms - blocked.remove_at_ms) / c.unseen_ms),
+	      "probes blocked: no reinstalls, no more than one attempt every unseen_ms");
+
+	return gFailed;
+}
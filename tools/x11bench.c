@@ -0,0 +1,471 @@
+// Checks the X11 backend (src/x11.c) and measures it, on a display of its own (e.g. under
+// xvfb-run, as 'make X11=1 xcheck' does), with two connections: kbsw, and an "app" that owns and
+// reads the selections and has a focused window for the keys.
+//   - the PRIMARY and CLIPBOARD selections both ways, small and in INCR pieces;
+//   - an owner that never answers: the read given up, and its late answer ignored;
+//   - requestors that die in the middle of an INCR transfer: their slots freed;
+//   - a translation of the PRIMARY selection, and one through Ctrl+C and the CLIPBOARD
+//     when there is none: the result in the CLIPBOARD, and Ctrl+V sent to the window;
+//   - the XKB groups, if there are two or more (it tries 'setxkbmap -layout us,ru'):
+//     locking them, and retyping in another group;
+//   - the latencies of a group switch and of a translation (to the CLIPBOARD), in µs.
+//
+// gcc -std=c11 -Wall -Werror -O2 -I../src -o x11bench x11bench.c ../src/x11.c ../src/pipeline.c
+//     ../src/translate.c ../src/casemap.c ../src/layouts.c ../src/arena.c ../src/trace.c
+//     -lX11 -lXfixes -ldl
+//
+// x11bench [--rounds=N] [--size=BYTES]
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <poll.h>
+#include <X11/Xlib.h>
+#include <X11/keysym.h>
+#include "x11.h"
+#include "casemap.h"
+#include "common.h"
+#include "check.h"
+
+static uint64_t Now_us( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+uint64_t AppTraceNow_us( void )
+{
+	return Now_us();
+}
+
+static bool ParseArg( const char* arg, const char* name, unsigned long* pvalue )
+{
+	size_t len = strlen(name);
+	if( (strncmp(arg, name, len) != 0) || (arg[len] != '=') )  return false;
+	char* end;
+	*pvalue = strtoul(arg + len + 1, &end, 10);
+	return (*end == 0);
+}
+
+// ---- the two sides, and the window of the app ----
+
+typedef struct
+{
+	X11       x;
+	bool      read_done;
+	char*     read;         // what X11ReadSelection has brought
+	size_t    read_length;
+	bool      changed;
+	unsigned  group;
+	bool      idle;
+	bool      pasted;
+} Side;
+
+static void OnGroupChanged( void* ctx, unsigned group )
+{
+	Side* s = ctx;
+	s->changed = true;
+	s->group = group;
+}
+
+static void OnSelectionRead( void* ctx, X11Selection which, const char* utf8, size_t length )
+{
+	Side* s = ctx;
+	free(s->read);
+	s->read = utf8 ? memcpy(malloc(length + 1), utf8, length + 1) : NULL;
+	s->read_length = length;
+	s->read_done = true;
+}
+
+static void OnIdle( void* ctx, bool pasted )
+{
+	Side* s = ctx;
+	s->idle = true;
+	s->pasted = pasted;
+}
+
+static Side gKbsw, gApp;
+
+static Display* gTarget;       // the app's window, on a connection of its own
+static Window gWindow;
+static unsigned gPastes, gCopies;
+static const char* gCopyText;  // what the app puts into the CLIPBOARD on Ctrl+C
+static XSelectionRequestEvent gHeld [2];   // the requests of the window, if it owns a selection
+static unsigned gNHeld;
+
+static bool Open( Side* s )
+{
+	const X11Host host = { OnGroupChanged, OnSelectionRead, OnIdle, s };
+	return X11Open(&s->x, NULL, &host);
+}
+
+static void OnTargetEvent( const XEvent* ev )
+{
+	// not answered until it is asked to
+	if( (ev->type == SelectionRequest) && (gNHeld < COUNTOF(gHeld)) )  gHeld[gNHeld++] = ev->xselectionrequest;
+	if( (ev->type != KeyPress) || !(ev->xkey.state & ControlMask) )  return;
+	KeySym ks = XLookupKeysym((XKeyEvent*)&ev->xkey, 0);
+	if( ks == XK_v )  ++gPastes;
+	if( ks == XK_c )
+	{
+		++gCopies;
+		if( gCopyText )  X11OwnSelection(&gApp.x, x11Clipboard, gCopyText, strlen(gCopyText));
+	}
+}
+
+// Handles the events of everyone until `*flag`, or `timeout_ms`; returns `*flag`.
+static bool Pump( bool* flag, int timeout_ms )
+{
+	uint64_t deadline = Now_us() + timeout_ms * 1000ULL;
+	while( !*flag )
+	{
+		uint64_t now = Now_us();
+		if( now >= deadline )  break;
+
+		struct pollfd fds [5];
+		int raw [2];
+		X11Fds(&gKbsw.x, raw);
+		fds[0].fd = raw[0];
+		fds[1].fd = raw[1];
+		X11Fds(&gApp.x, raw);
+		fds[2].fd = raw[0];
+		fds[3].fd = raw[1];
+		fds[4].fd = ConnectionNumber(gTarget);
+		for( unsigned i = 0; i < COUNTOF(fds); ++i )  fds[i].events = POLLIN;
+		if( !XPending(gKbsw.x.display) && !XPending(gApp.x.display) && !XPending(gTarget) )
+			poll(fds, COUNTOF(fds), (int)((deadline - now + 999) / 1000));
+
+		X11Dispatch(&gKbsw.x);
+		X11Dispatch(&gApp.x);
+		while( XPending(gTarget) > 0 )
+		{
+			XEvent ev;
+			XNextEvent(gTarget, &ev);
+			OnTargetEvent(&ev);
+		}
+	}
+	return *flag;
+}
+
+static bool OpenTarget( void )
+{
+	gTarget = XOpenDisplay(NULL);
+	if( gTarget == NULL )  return false;
+	gWindow = XCreateSimpleWindow(gTarget, DefaultRootWindow(gTarget), 0, 0, 200, 100, 0, 0, 0);
+	XSelectInput(gTarget, gWindow, KeyPressMask | StructureNotifyMask);
+	XMapWindow(gTarget, gWindow);
+	for( ;; )
+	{
+		XEvent ev;
+		XNextEvent(gTarget, &ev);
+		if( ev.type == MapNotify )  break;
+	}
+	XSetInputFocus(gTarget, gWindow, RevertToParent, CurrentTime);
+	XSync(gTarget, False);
+	return true;
+}
+
+// ---- the selections ----
+
+static char* MakeText( size_t size )
+{
+	// ASCII and Cyrillic, so that the pieces split characters
+	static const char* const kWords [] = { "hello ", "привет ", "world\n", "мир " };
+	char* text = malloc(size + 16);
+	size_t length = 0;
+	for( unsigned i = 0; length < size; ++i )
+	{
+		const char* w = kWords[i % COUNTOF(kWords)];
+		memcpy(text + length, w, strlen(w));
+		length += strlen(w);
+	}
+	text[size] = 0;
+	return text;
+}
+
+static void RoundTrip( Side* from, Side* to, X11Selection which, size_t size )
+{
+	char* text = MakeText(size);
+	uint64_t incr_read = to->x.stats.incr_read, incr_served = from->x.stats.incr_served;
+	bool incr = (size > from->x.max_piece);
+
+	bool ok = X11OwnSelection(&from->x, which, text, size);
+	to->read_done = false;
+	ok = ok && X11ReadSelection(&to->x, which);
+	uint64_t start = Now_us();
+	ok = ok && Pump(&to->read_done, 10000);
+	uint64_t elapsed = Now_us() - start;
+	ok = ok && to->read && (to->read_length == size) && (memcmp(to->read, text, size) == 0);
+	ok = ok && (!incr || ((to->x.stats.incr_read == incr_read + 1) && (from->x.stats.incr_served == incr_served + 1)));
+
+	char what [128];
+	snprintf(what, sizeof(what), "%s, %zu bytes, %s%s (%.1f ms)", which == x11Primary ? "PRIMARY" : "CLIPBOARD",
+	         size, from == &gKbsw ? "kbsw to the app" : "the app to kbsw", incr ? ", INCR" : "", elapsed / 1000.0);
+	Check(ok, what);
+	free(text);
+}
+
+static void CheckReadEmpty( void )
+{
+	XSetSelectionOwner(gApp.x.display, XInternAtom(gApp.x.display, "PRIMARY", False), None, CurrentTime);
+	gKbsw.read_done = false;
+	X11ReadSelection(&gKbsw.x, x11Primary);
+	Check(Pump(&gKbsw.read_done, 2000) && (gKbsw.read == NULL), "no PRIMARY selection: NULL");
+}
+
+static void Answer( const XSelectionRequestEvent* req, const char* text )
+{
+	XChangeProperty(gTarget, req->requestor, req->property, XInternAtom(gTarget, "UTF8_STRING", False), 8,
+	                PropModeReplace, (const unsigned char*)text, (int)strlen(text));
+	XSelectionEvent reply = { .type = SelectionNotify, .display = gTarget, .requestor = req->requestor,
+	                          .selection = req->selection, .target = req->target, .property = req->property, .time = req->time };
+	XSendEvent(gTarget, req->requestor, False, NoEventMask, (XEvent*)&reply);
+	XFlush(gTarget);
+}
+
+static void CheckSilentOwner( void )
+{
+	Atom clipboard = XInternAtom(gTarget, "CLIPBOARD", False);
+	XSetSelectionOwner(gTarget, clipboard, gWindow, CurrentTime);
+	XSync(gTarget, False);
+	gNHeld = 0;
+
+	uint64_t abandoned = gKbsw.x.stats.reads_abandoned;
+	gKbsw.read_done = false;
+	bool ok = X11ReadSelection(&gKbsw.x, x11Clipboard);
+	ok = ok && Pump(&gKbsw.read_done, X11_READ_TIMEOUT_ms + 1000) && (gKbsw.read == NULL);
+	Check(ok && (gKbsw.x.stats.reads_abandoned == abandoned + 1) && (gNHeld == 1), "an owner that never answers: given up");
+
+	// the first answer comes after the second request: it is not the second one's
+	gKbsw.read_done = false;
+	ok = X11ReadSelection(&gKbsw.x, x11Clipboard);
+	bool never = false;
+	for( uint64_t until = Now_us() + 1000000; ok && (gNHeld < 2) && (Now_us() < until); )  Pump(&never, 10);
+	ok = ok && (gNHeld == 2);
+	if( ok )
+	{
+		// taken as the answer, it would be read before the right one is even there
+		Answer(&gHeld[0], "stale");
+		Pump(&gKbsw.read_done, 200);
+		Answer(&gHeld[1], "fresh");
+	}
+	ok = ok && Pump(&gKbsw.read_done, 2000) && gKbsw.read && (strcmp(gKbsw.read, "fresh") == 0);
+	Check(ok, "a late answer to the read given up: ignored");
+	gNHeld = COUNTOF(gHeld);
+	XSetSelectionOwner(gTarget, clipboard, None, CurrentTime);
+	XFlush(gTarget);
+}
+
+// more requestors than there are slots, each gone after the first piece
+static void CheckDeadRequestors( size_t size )
+{
+	char* text = MakeText(size);
+	bool ok = (size > gKbsw.x.max_piece) && X11OwnSelection(&gKbsw.x, x11Primary, text, size);
+	uint64_t abandoned = gKbsw.x.stats.transfers_abandoned;
+	for( unsigned i = 0; ok && (i < 2 * X11_MAX_TRANSFERS); ++i )
+	{
+		Display* d = XOpenDisplay(NULL);
+		if( d == NULL )  break;
+		Window w = XCreateSimpleWindow(d, DefaultRootWindow(d), 0, 0, 1, 1, 0, 0, 0);
+		Atom property = XInternAtom(d, "X11BENCH", False);
+		XConvertSelection(d, XInternAtom(d, "PRIMARY", False), XInternAtom(d, "UTF8_STRING", False), property, w, CurrentTime);
+		XFlush(d);
+		bool answered = false;
+		for( uint64_t until = Now_us() + 2000000; !answered && (Now_us() < until); )
+		{
+			bool never = false;
+			Pump(&never, 10);
+			while( XPending(d) > 0 )
+			{
+				XEvent ev;
+				XNextEvent(d, &ev);
+				answered |= (ev.type == SelectionNotify);
+			}
+		}
+		XCloseDisplay(d);   // with the INCR transfer just begun
+		ok = answered;
+	}
+	bool never = false;
+	Pump(&never, 200);
+	ok = ok && (gKbsw.x.stats.transfers_abandoned == abandoned + 2 * X11_MAX_TRANSFERS);
+	Check(ok, "requestors gone in the middle of INCR transfers: their slots freed");
+	free(text);
+	RoundTrip(&gKbsw, &gApp, x11Primary, size);
+}
+
+// ---- the translations ----
+
+static bool Translate( const X11Translation* t, const char* expected, uint32_t* latency_us )
+{
+	unsigned pastes = gPastes;
+	gKbsw.idle = gKbsw.pasted = false;
+	X11TranslateSelection(&gKbsw.x, t);
+	bool ok = Pump(&gKbsw.idle, 3000) && gKbsw.pasted;
+	if( latency_us )  *latency_us = gKbsw.x.stats.last_translation_us;
+
+	// the Ctrl+V may come after the idle
+	for( uint64_t until = Now_us() + 1000000; ok && (gPastes == pastes) && (Now_us() < until); )
+	{
+		bool never = false;
+		Pump(&never, 10);
+	}
+	ok = ok && (gPastes == pastes + 1);
+
+	gApp.read_done = false;
+	ok = ok && X11ReadSelection(&gApp.x, x11Clipboard) && Pump(&gApp.read_done, 2000);
+	return ok && gApp.read && (strcmp(gApp.read, expected) == 0);
+}
+
+static void CheckTranslations( void )
+{
+	const X11Translation invert = { .group = -1, .translators = { &kCaseInvert }, .ntranslators = 1 };
+
+	X11OwnSelection(&gApp.x, x11Primary, "Hello, World", 12);
+	Check(Translate(&invert, "hELLO, wORLD", NULL), "the PRIMARY selection translated, and pasted");
+
+	// no PRIMARY: Ctrl+C, and the CLIPBOARD
+	XSetSelectionOwner(gApp.x.display, XInternAtom(gApp.x.display, "PRIMARY", False), None, CurrentTime);
+	XFlush(gApp.x.display);
+	unsigned copies = gCopies;
+	gCopyText = "Ctrl+C";
+	bool ok = Translate(&invert, "cTRL+c", NULL);
+	gCopyText = NULL;
+	Check(ok && (gCopies == copies + 1), "with no PRIMARY selection: Ctrl+C, then the CLIPBOARD translated");
+}
+
+// ---- the groups ----
+
+static int FindGroup( const X11* x, const char* id )
+{
+	for( unsigned g = 0; g < x->ngroups; ++g )
+	{
+		if( strcmp(x->ids[g], id) == 0 )  return g;
+	}
+	return -1;
+}
+
+static bool LockGroup( unsigned group, uint32_t* latency_us )
+{
+	gKbsw.changed = false;
+	if( !X11LockGroup(&gKbsw.x, group) || !Pump(&gKbsw.changed, 2000) )  return false;
+	if( latency_us )  *latency_us = gKbsw.x.stats.last_switch_us;
+	return (gKbsw.group == group) && (gKbsw.x.group == group);
+}
+
+static bool CheckGroups( void )
+{
+	if( gKbsw.x.ngroups < 2 )
+	{
+		if( system("setxkbmap -layout us,ru 2>/dev/null") == 0 )
+		{
+			bool never = false;
+			Pump(&never, 500);   // the new keymap
+		}
+	}
+	if( gKbsw.x.ngroups < 2 )
+	{
+		printf("skip the groups: only %u (no setxkbmap?)\n", gKbsw.x.ngroups);
+		return false;
+	}
+
+	Check(LayoutRegistryCount(X11Layouts(&gKbsw.x)) == gKbsw.x.ngroups, "a layout for each group");
+	Check(LockGroup(1, NULL), "group 2 locked");
+	uint64_t skipped = gKbsw.x.stats.switches_skipped;
+	Check(X11LockGroup(&gKbsw.x, 1) && (gKbsw.x.stats.switches_skipped == skipped + 1), "locked already: skipped");
+	Check(LockGroup(0, NULL), "group 1 locked");
+
+	int us = FindGroup(&gKbsw.x, "us"), ru = FindGroup(&gKbsw.x, "ru");
+	if( (us >= 0) && (ru >= 0) )
+	{
+		const X11Translation to_ru = { .group = ru };
+		X11OwnSelection(&gApp.x, x11Primary, "ghbdtn", 6);
+		Check(Translate(&to_ru, "привет", NULL), "retyped in the ru group");
+		X11OwnSelection(&gApp.x, x11Primary, "привет", strlen("привет"));
+		Check(!Translate(&to_ru, "", NULL), "in the ru group already: nothing to do");
+	}
+	else printf("skip the retyping: no us and ru groups\n");
+	return true;
+}
+
+// ---- the latencies ----
+
+static int CompareU32( const void* a, const void* b )
+{
+	uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+	return (x > y) - (x < y);
+}
+
+static void Report( const char* what, uint32_t* samples, unsigned n )
+{
+	if( n == 0 )  return;
+	qsort(samples, n, sizeof(samples[0]), CompareU32);
+	printf("%-24s median %6u µs   p99 %6u µs   max %6u µs   (%u)\n", what,
+	       samples[n / 2], samples[(n * 99) / 100], samples[n - 1], n);
+}
+
+static void Measure( unsigned rounds, bool groups )
+{
+	uint32_t* samples = malloc(rounds * sizeof(uint32_t));
+	unsigned n = 0;
+
+	if( groups )
+	{
+		for( unsigned i = 0; i < rounds; ++i )
+		{
+			if( LockGroup((i + 1) % 2, &samples[n]) )  ++n;
+		}
+		LockGroup(0, NULL);
+		Report("group switch", samples, n);
+	}
+
+	// no need to wait before pasting into this window
+	gKbsw.x.pipeline.timeouts.paste_delay_ms = 1;
+	const X11Translation invert = { .group = -1, .translators = { &kCaseInvert }, .ntranslators = 1 };
+	n = 0;
+	for( unsigned i = 0; i < rounds; ++i )
+	{
+		X11OwnSelection(&gApp.x, x11Primary, "Hello, World", 12);
+		if( Translate(&invert, "hELLO, wORLD", &samples[n]) )  ++n;
+	}
+	Report("translation", samples, n);
+	free(samples);
+}
+
+int main( int argc, char* argv [] )
+{
+	unsigned long rounds = 100, size = 3 << 20;
+	for( int i = 1; i < argc; ++i )
+	{
+		if( ParseArg(argv[i], "--rounds", &rounds) || ParseArg(argv[i], "--size", &size) )  continue;
+		fprintf(stderr, "usage: x11bench [--rounds=N] [--size=BYTES]\n");
+		return 2;
+	}
+
+	if( !Open(&gKbsw) || !Open(&gApp) || !OpenTarget() )
+	{
+		fprintf(stderr, "cannot open the display (run it under xvfb-run)\n");
+		return 1;
+	}
+
+	RoundTrip(&gApp, &gKbsw, x11Primary, 5);
+	RoundTrip(&gKbsw, &gApp, x11Clipboard, 5);
+	RoundTrip(&gApp, &gKbsw, x11Primary, size);
+	RoundTrip(&gKbsw, &gApp, x11Clipboard, size);
+	RoundTrip(&gApp, &gKbsw, x11Clipboard, size);
+	CheckReadEmpty();
+	CheckSilentOwner();
+	CheckDeadRequestors(size);
+	CheckTranslations();
+	bool groups = CheckGroups();
+	Measure(rounds, groups);
+
+	X11Close(&gApp.x);
+	X11Close(&gKbsw.x);
+	XCloseDisplay(gTarget);
+	return gFailed;
+}